@@ -783,7 +783,7 @@ static const unsigned char Arial_100BINO_index[] = {
 };
 /* Size: 49 bytes */
 
-const ILI9341_t3_font_t Arial_100BINO = {
+constexpr ILI9341_t3_font_t Arial_100BINO = {
     Arial_100BINO_index,
     0,
     Arial_100BINO_data,
@@ -802,3 +802,9 @@ const ILI9341_t3_font_t Arial_100BINO = {
     0,
     74
 };
+
+// the flat glyph table needs gnu++14, a gnu++11 build still gets the font
+#if __cplusplus >= 201402L
+#include "Arial_100BINO_table.h"
+FONTTABLE(Arial_100BINO)
+#endif
@@ -0,0 +1,9 @@
+#ifndef __Arial_100BINO_table_h__
+#define __Arial_100BINO_table_h__
+
+#include "Arial_100BINO.h"
+#include "PatriotRacing_FontTable.h"
+
+extern const FontTable Arial_100BINO_table;
+
+#endif
@@ -421,7 +421,7 @@ static const unsigned char Arial_100_BINO_index[] = {
 };
 /* Size: 22 bytes */
 
-const ILI9341_t3_font_t Arial_100_BINO = {
+constexpr ILI9341_t3_font_t Arial_100_BINO = {
     Arial_100_BINO_index,
     0,
     Arial_100_BINO_data,
@@ -440,3 +440,9 @@ const ILI9341_t3_font_t Arial_100_BINO = {
     0,
     78
 };
+
+// the flat glyph table needs gnu++14, a gnu++11 build still gets the font
+#if __cplusplus >= 201402L
+#include "Arial_100_BINO_table.h"
+FONTTABLE(Arial_100_BINO)
+#endif
@@ -0,0 +1,98 @@
+#include "Arial_16_AA4.h"
+
+static const unsigned char Arial_16_AA4_data[] = {
+  0x19, 0x00, 0xC0, 0x00, 0x00, 0x07, 0xAA, 0x70, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFD, 0x20, 0x00, 
+  0x2D, 0xFF, 0xCC, 0xFF, 0xA0, 0x00, 0xCF, 0xF7, 0x00, 0xDF, 0xF5, 0x03, 0xFF, 0xD0, 0x00, 0xAF, 
+  0xF5, 0x0A, 0xFF, 0x70, 0x00, 0xAF, 0xF5, 0x0F, 0xFF, 0x20, 0x00, 0xCF, 0xF5, 0x5F, 0xFD, 0x00, 
+  0x00, 0xFF, 0xF2, 0x7F, 0xFA, 0x00, 0x02, 0xFF, 0xF0, 0xAF, 0xF7, 0x00, 0x05, 0xFF, 0xC0, 0xAF, 
+  0xF5, 0x00, 0x0A, 0xFF, 0x70, 0xAF, 0xF5, 0x00, 0x0F, 0xFF, 0x20, 0x7F, 0xF7, 0x00, 0x7F, 0xF8, 
+  0x00, 0x3F, 0xFD, 0x58, 0xFF, 0xD2, 0x00, 0x08, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x7D, 0xFF, 
+  0x82, 0x00, 0x00, 0x13, 0x00, 0x90, 0x00, 0x00, 0x00, 0x8A, 0x70, 0x00, 0x00, 0xAF, 0xFA, 0x00, 
+  0x02, 0xDF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF3, 0x0D, 0xFF, 0xFF, 0xFD, 0x08, 0xFF, 0xDA, 0xFF, 
+  0xA0, 0xAA, 0x30, 0xAF, 0xF5, 0x00, 0x00, 0x0D, 0xFF, 0x30, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 
+  0x5F, 0xFA, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0xAF, 0xF5, 0x00, 0x00, 0x0F, 0xFF, 0x00, 
+  0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x5F, 0xFA, 0x00, 0x00, 0x07, 0xAA, 0x50, 0x00, 0x19, 0x00, 
+  0xC0, 0x00, 0x00, 0x38, 0xAA, 0x72, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x8F, 0xFF, 
+  0xAC, 0xFF, 0xF3, 0x00, 0xFF, 0xF5, 0x00, 0x8F, 0xF8, 0x03, 0xAD, 0xC0, 0x00, 0x5F, 0xFA, 0x00, 
+  0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x5F, 0xFF, 
+  0x80, 0x00, 0x00, 0x05, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xA0, 0x00, 0x00, 0x08, 0xFF, 
+  0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x50, 0x00, 0x00, 0x05, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x0D, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x7A, 0xAA, 0xAA, 0xAA, 0xAA, 
+  0x00, 0x19, 0x00, 0xC0, 0x00, 0x00, 0x27, 0xAA, 0x83, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0x70, 
+  0x00, 0x2F, 0xFF, 0xCA, 0xFF, 0xF3, 0x00, 0xAF, 0xFA, 0x00, 0x8F, 0xFA, 0x00, 0x7A, 0xD2, 0x00, 
+  0x5F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF7, 0x00, 0x00, 0x02, 0x5C, 0xFF, 0xD0, 0x00, 0x00, 
+  0x0A, 0xFF, 0xF8, 0x20, 0x00, 0x00, 0x0D, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x70, 
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x35, 0xA3, 0x00, 0x05, 0xFF, 0xA0, 0x8F, 0xF8, 0x00, 0x0C, 
+  0xFF, 0x50, 0x2F, 0xFF, 0x75, 0xAF, 0xFD, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x5C, 
+  0xFF, 0xD8, 0x20, 0x00, 0x1B, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xAA, 0x30, 0x00, 0x00, 
+  0x00, 0x0A, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 
+  0xA0, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x05, 0xFF, 0xCD, 0xFF, 0x30, 0x00, 0x03, 
+  0xFF, 0xD2, 0xFF, 0xF0, 0x00, 0x02, 0xDF, 0xD2, 0x5F, 0xFC, 0x00, 0x02, 0xDF, 0xD2, 0x08, 0xFF, 
+  0x80, 0x00, 0xDF, 0xF7, 0x55, 0xCF, 0xF8, 0x50, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x35, 0x55, 0x55, 0x8F, 0xFC, 0x53, 0x00, 0x00, 0x00, 0x0A, 0xFF, 
+  0x70, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x19, 
+  0x00, 0xC0, 0x00, 0x03, 0xAA, 0xAA, 0xAA, 0xA7, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x0F, 
+  0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x5F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 
+  0x00, 0xDF, 0xFC, 0xFF, 0x82, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xC5, 0x7F, 
+  0xFF, 0x50, 0x03, 0x55, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xA0, 0x02, 0x52, 
+  0x00, 0x05, 0xFF, 0x80, 0xAF, 0xF5, 0x00, 0x0C, 0xFF, 0x50, 0x7F, 0xFA, 0x00, 0x5F, 0xFD, 0x00, 
+  0x2F, 0xFF, 0xCC, 0xFF, 0xF3, 0x00, 0x05, 0xFF, 0xFF, 0xFD, 0x50, 0x00, 0x00, 0x28, 0xAA, 0x50, 
+  0x00, 0x00, 0x17, 0x00, 0xB0, 0x00, 0x00, 0x28, 0xAA, 0x50, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xA0, 
+  0x00, 0x5F, 0xFD, 0xAF, 0xFF, 0x30, 0x2F, 0xFF, 0x20, 0x7F, 0xF8, 0x08, 0xFF, 0x80, 0x02, 0x53, 
+  0x00, 0xFF, 0xF7, 0xAA, 0x70, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xA0, 0x07, 0xFF, 0xFF, 0xAF, 0xFF, 
+  0x80, 0xAF, 0xFF, 0x20, 0x3F, 0xFD, 0x0A, 0xFF, 0xA0, 0x00, 0xFF, 0xF0, 0xAF, 0xF5, 0x00, 0x0F, 
+  0xFF, 0x0A, 0xFF, 0x50, 0x03, 0xFF, 0xC0, 0x7F, 0xF7, 0x00, 0x8F, 0xF7, 0x02, 0xFF, 0xD7, 0x7F, 
+  0xFD, 0x20, 0x08, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x05, 0xCF, 0xFA, 0x20, 0x00, 0x19, 0x00, 0xC0, 
+  0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xD2, 0x00, 0x00, 0x00, 
+  0x0C, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xD2, 0x00, 0x00, 
+  0x00, 0x08, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 
+  0x00, 0x00, 0x00, 0xDF, 0xF3, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xFF, 
+  0x70, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 
+  0x17, 0x00, 0xB0, 0x00, 0x00, 0x5A, 0xAA, 0x50, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xD2, 0x00, 0xCF, 
+  0xFD, 0xAD, 0xFF, 0x80, 0x3F, 0xFF, 0x20, 0x2F, 0xFF, 0x05, 0xFF, 0xA0, 0x00, 0xFF, 0xF0, 0x3F, 
+  0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x8F, 0xFC, 0xAF, 0xFD, 0x20, 0x03, 0xDF, 0xFF, 0xFA, 0x00, 0x05, 
+  0xFF, 0xDA, 0xFF, 0xF5, 0x02, 0xFF, 0xD2, 0x03, 0xFF, 0xC0, 0x8F, 0xF8, 0x00, 0x0F, 0xFF, 0x0A, 
+  0xFF, 0x50, 0x02, 0xFF, 0xF0, 0xAF, 0xF7, 0x00, 0x7F, 0xFA, 0x05, 0xFF, 0xD5, 0x7F, 0xFF, 0x30, 
+  0x0A, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x08, 0xDF, 0xFA, 0x30, 0x00, 0x17, 0x00, 0xB0, 0x00, 0x00, 
+  0x38, 0xAA, 0x30, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0xAF, 0xFF, 0x30, 0x2F, 
+  0xFF, 0x20, 0x3F, 0xFA, 0x05, 0xFF, 0xA0, 0x00, 0xFF, 0xD0, 0xAF, 0xF5, 0x00, 0x0F, 0xFF, 0x0A, 
+  0xFF, 0x50, 0x03, 0xFF, 0xF0, 0xAF, 0xF7, 0x00, 0x8F, 0xFF, 0x05, 0xFF, 0xD7, 0x8F, 0xFF, 0xD0, 
+  0x0A, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x08, 0xFF, 0xCD, 0xFF, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xF0, 
+  0x7D, 0xF5, 0x00, 0x8F, 0xF8, 0x07, 0xFF, 0xD5, 0x8F, 0xFD, 0x00, 0x0D, 0xFF, 0xFF, 0xFD, 0x20, 
+  0x00, 0x28, 0xFF, 0xD8, 0x20, 0x00, 0x0C, 0xC2, 0x60, 0x00, 0x05, 0x55, 0x00, 0x3F, 0xFC, 0x00, 
+  0x5F, 0xFA, 0x00, 0x7A, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x5F, 0xFA, 0x00, 0x8F, 0xF7, 0x00
+};
+/* Size: 989 bytes */
+
+static const unsigned char Arial_16_AA4_index[] = {
+  0x00, 0x06, 0x32, 0xB9, 0x11, 0x5D, 0x1D, 0xF9, 0x0A, 0x9D, 0xC0, 0x35, 0xBE, 0xD8
+};
+/* Size: 14 bytes */
+
+constexpr ILI9341_t3_font_t Arial_16_AA4 = {
+    Arial_16_AA4_index,
+    0,
+    Arial_16_AA4_data,
+    23,
+    2,
+    48,
+    58,
+    0,
+    0,
+    10,
+    4,
+    5,
+    1,
+    3,
+    4,
+    0,
+    16
+};
+
+// the flat glyph table needs gnu++14, a gnu++11 build still gets the font
+#if __cplusplus >= 201402L
+#include "Arial_16_AA4_table.h"
+FONTTABLE(Arial_16_AA4)
+#endif
@@ -0,0 +1,9 @@
+#ifndef __Arial_16_AA4_table_h__
+#define __Arial_16_AA4_table_h__
+
+#include "Arial_16_AA4.h"
+#include "PatriotRacing_FontTable.h"
+
+extern const FontTable Arial_16_AA4_table;
+
+#endif
@@ -0,0 +1,215 @@
+#include "Arial_24_AA4.h"
+
+static const unsigned char Arial_24_AA4_data[] = {
+  0x18, 0xCA, 0x26, 0x80, 0x00, 0x00, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 
+  0x00, 0x4F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 
+  0xF8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x0F, 0xFF, 0xB0, 0x4F, 0xFF, 0x00, 0x00, 0x00, 
+  0x0F, 0xFF, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 
+  0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x4F, 
+  0xFF, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x8F, 0xF8, 0x00, 0x04, 0xFF, 
+  0xB0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x04, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 
+  0xBF, 0xFB, 0x8F, 0xFF, 0xB0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFB, 
+  0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0x80, 0x00, 0x4F, 0xFB, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x08, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 
+  0x8F, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x0B, 
+  0xFF, 0xF8, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x0F, 0xFF, 
+  0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x08, 0xFF, 
+  0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0xFF, 
+  0xF0, 0x00, 0x8F, 0xFB, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xBF, 0xF8, 
+  0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x40, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 
+  0xFF, 0xFF, 0xF4, 0x00, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x00, 0x00, 
+  0x11, 0x81, 0x4C, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x57, 0x02, 0x00, 
+  0x00, 0x8F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x4F, 0xFF, 0xF4, 0x04, 0x8B, 
+  0xFF, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x4F, 0xF4, 0x00, 0xBF, 0xFB, 0x00, 0x8F, 0xFB, 0x00, 0x04, 
+  0x80, 0x00, 0x00, 0x0A, 0x28, 0x5A, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x8F, 0xFF, 0xFF, 0xFF, 
+  0xF0, 0x8F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xB0, 0x88, 0x88, 0x88, 0x88, 0x40, 
+  0x06, 0x28, 0x2A, 0x00, 0x0F, 0xFF, 0xF8, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0xBF, 0xFF, 0xB0, 
+  0x88, 0x88, 0x40, 0x0E, 0xC5, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 
+  0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
+  0xC0, 0x2C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 
+  0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xFF, 0xB4, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0xBF, 
+  0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x0B, 
+  0xFF, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 
+  0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 
+  0xF0, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 
+  0xFF, 0x88, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x08, 
+  0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 
+  0x4F, 0xFF, 0xF8, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 
+  0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 
+  0x88, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x4F, 
+  0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0D, 
+  0xC0, 0x2B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x4B, 
+  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xFB, 0x4F, 0xFF, 0xF8, 0x08, 0xFF, 0x80, 
+  0x08, 0xFF, 0xFF, 0x00, 0x44, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 
+  0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
+  0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x48, 0x88, 0x80, 0x00, 0x00, 0x12, 
+  0xC0, 0x2C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 
+  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x04, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x04, 0xBF, 0xFF, 0xF0, 
+  0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 
+  0xFF, 0xF8, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFB, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFB, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
+  0xFF, 0xFB, 0x88, 0x88, 0x88, 0x88, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xF4, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x00, 0x12, 0xC0, 0x2C, 0x80, 0x00, 
+  0x00, 0x00, 0x00, 0x48, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xB0, 
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xB0, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x08, 0xFF, 0xFF, 
+  0x40, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 
+  0x00, 0x44, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 
+  0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x48, 0x8F, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xFF, 
+  0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 
+  0xFF, 0xF4, 0x00, 0x08, 0xFF, 0xFF, 0xB8, 0x8B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 
+  0x8B, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x13, 0xB8, 0x34, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 
+  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 
+  0x00, 0x4F, 0xFF, 0xFB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0xFF, 0xFF, 0xB0, 
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x04, 
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 
+  0xFB, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 
+  0x08, 0xFF, 0xFF, 0x88, 0x88, 0x8F, 0xFF, 0xFB, 0x88, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x04, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x48, 0x88, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xB8, 0x84, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x12, 0xC0, 0x2C, 0x80, 0x00, 0x00, 0x04, 0x88, 0x88, 0x88, 
+  0x88, 0x88, 0x84, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 
+  0xBF, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x08, 0x88, 0x00, 
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 
+  0xB4, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x48, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 
+  0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 
+  0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x4B, 0xFF, 0xFF, 0x40, 0x00, 0x08, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 
+  0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x80, 0x00, 0x00, 
+  0x00, 0x00, 0x10, 0xC0, 0x2C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x8F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x4F, 0xFF, 0xF8, 0x00, 0x4F, 
+  0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x04, 0x88, 0x40, 0x04, 0xFF, 
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x4F, 0xFF, 
+  0xFF, 0xFB, 0x8F, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xB0, 0x8F, 0xFF, 
+  0xFB, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 
+  0xF0, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 
+  0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x4F, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 
+  0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xFF, 0xB8, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+  0x8B, 0xFF, 0xF8, 0x40, 0x00, 0x00, 0x11, 0xB8, 0x34, 0x80, 0x04, 0x88, 0x88, 0x88, 0x88, 0x88, 
+  0x88, 0x88, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x48, 0x88, 0x88, 0x88, 
+  0x88, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xC0, 
+  0x2C, 0x40, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 
+  0xFF, 0xB4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x08, 0xFF, 0xFF, 
+  0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x08, 0xFF, 
+  0xFF, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 
+  0x8F, 0xFF, 0xF8, 0x8B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 
+  0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 
+  0x00, 0x4F, 0xFF, 0xFB, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 
+  0xB0, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x8F, 
+  0xFF, 0xF0, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 
+  0xFF, 0xFF, 0x80, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x88, 
+  0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFF, 
+  0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x11, 0xC0, 
+  0x2C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x4B, 0xFF, 0xFB, 0x00, 0x04, 0xFF, 0xFF, 
+  0x80, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 
+  0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 
+  0xFF, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFF, 0x80, 
+  0x0F, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0xF8, 0x04, 0xBF, 0xFF, 0xFF, 
+  0x80, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x88, 0x84, 0x8F, 
+  0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x48, 0xFF, 0xF0, 0x00, 0x04, 
+  0xFF, 0xFF, 0x80, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x0F, 0xFF, 0xFF, 0x88, 
+  0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 
+  0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x09, 0x88, 
+  0x42, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 
+  0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x04, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 
+  0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00
+};
+/* Size: 2847 bytes */
+
+static const unsigned char Arial_24_AA4_index[] = {
+  0x00, 0x01, 0x30, 0x1B, 0xC1, 0xE3, 0x20, 0x02, 0x13, 0x2B, 0xF3, 0x8F, 0x42, 0xF5, 0x0B, 0x5E, 
+  0x76, 0xC6, 0x7A, 0x28, 0x66, 0x92, 0xE9, 0xFE, 0xAC, 0xE0
+};
+/* Size: 26 bytes */
+
+constexpr ILI9341_t3_font_t Arial_24_AA4 = {
+    Arial_24_AA4_index,
+    0,
+    Arial_24_AA4_data,
+    23,
+    2,
+    37,
+    37,
+    43,
+    58,
+    12,
+    5,
+    5,
+    3,
+    5,
+    5,
+    0,
+    29
+};
+
+// the flat glyph table needs gnu++14, a gnu++11 build still gets the font
+#if __cplusplus >= 201402L
+#include "Arial_24_AA4_table.h"
+FONTTABLE(Arial_24_AA4)
+#endif
@@ -0,0 +1,16 @@
+#ifndef __Arial_24_AA4_h__
+#define __Arial_24_AA4_h__
+
+#include <ILI9341_t3.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const ILI9341_t3_font_t Arial_24_AA4;
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
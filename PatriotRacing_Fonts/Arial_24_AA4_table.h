@@ -0,0 +1,9 @@
+#ifndef __Arial_24_AA4_table_h__
+#define __Arial_24_AA4_table_h__
+
+#include "Arial_24_AA4.h"
+#include "PatriotRacing_FontTable.h"
+
+extern const FontTable Arial_24_AA4_table;
+
+#endif
@@ -121,7 +121,7 @@ static const unsigned char Arial_48BINO_index[] = {
 };
 /* Size: 20 bytes */
 
-const ILI9341_t3_font_t Arial_48BINO = {
+constexpr ILI9341_t3_font_t Arial_48BINO = {
     Arial_48BINO_index,
     0,
     Arial_48BINO_data,
@@ -140,3 +140,9 @@ const ILI9341_t3_font_t Arial_48BINO = {
     0,
     40
 };
+
+// the flat glyph table needs gnu++14, a gnu++11 build still gets the font
+#if __cplusplus >= 201402L
+#include "Arial_48BINO_table.h"
+FONTTABLE(Arial_48BINO)
+#endif
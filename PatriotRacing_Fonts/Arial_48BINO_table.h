@@ -0,0 +1,9 @@
+#ifndef __Arial_48BINO_table_h__
+#define __Arial_48BINO_table_h__
+
+#include "Arial_48BINO.h"
+#include "PatriotRacing_FontTable.h"
+
+extern const FontTable Arial_48BINO_table;
+
+#endif
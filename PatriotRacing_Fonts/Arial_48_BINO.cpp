@@ -143,7 +143,7 @@ static const unsigned char Arial_48_BINO_index[] = {
 };
 /* Size: 26 bytes */
 
-const ILI9341_t3_font_t Arial_48_BINO = {
+constexpr ILI9341_t3_font_t Arial_48_BINO = {
     Arial_48_BINO_index,
     0,
     Arial_48_BINO_data,
@@ -162,3 +162,9 @@ const ILI9341_t3_font_t Arial_48_BINO = {
     0,
     46
 };
+
+// the flat glyph table needs gnu++14, a gnu++11 build still gets the font
+#if __cplusplus >= 201402L
+#include "Arial_48_BINO_table.h"
+FONTTABLE(Arial_48_BINO)
+#endif
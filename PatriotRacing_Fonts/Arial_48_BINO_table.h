@@ -0,0 +1,9 @@
+#ifndef __Arial_48_BINO_table_h__
+#define __Arial_48_BINO_table_h__
+
+#include "Arial_48_BINO.h"
+#include "PatriotRacing_FontTable.h"
+
+extern const FontTable Arial_48_BINO_table;
+
+#endif
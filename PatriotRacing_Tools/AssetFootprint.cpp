@@ -0,0 +1,668 @@
+/*
+
+	Program name: Bob Jones Patriot Racing asset footprint report
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	what every font, glyph and icon costs in flash on the Teensy, against what a render trace
+	(PatriotRacing_RenderTrace.h) says actually gets drawn, then a plan for cutting them down to
+	fit the budget
+
+		fonts        the GFXfonts in Adafruit_fonts.h and the ILI9341_t3 fonts in
+		             PatriotRacing_Fonts are built in, so every glyph is measured from the tables
+		             themselves: a GFXfont glyph is its bitmap and its GFXglyph, an ILI9341_t3 glyph
+		             is its header and rows in the packed data plus its flat table entry
+		             (PatriotRacing_FontTable.h), the index is counted once for the font
+		icons        read out of the icon headers (every const array, the PackedIcon / PackedMono
+		             structs that point at them and the sprite rows of the atlas table), a packed
+		             icon is its data, palette and struct, a sprite is its words in the atlas
+
+	the plan goes biggest saving first and keeps a running total:
+		- drop the fonts and icons the trace never drew
+		- cut each drawn ILI9341_t3 font down to the drawn chars (FontCompiler -c)
+		- cut each drawn GFXfont to the drawn range (fontconvert first / last) with the glyphs in
+		  between that were never drawn blanked
+		- FONTTABLE_PACKED, only if that still doesn't fit
+	a plan is only as good as the trace, drive every screen, every menu page and every choice
+	before trusting it. the sizes are what's in the source, the linker only keeps what something
+	references, and a const array in a header is a copy in every file that uses it
+
+	AssetFootprint [-b bytes] [-g] [-t trace] ... [icon files]
+		-b bytes         the flash the fonts and icons get (default ASSET_BUDGET)
+		-g               a line for every glyph
+		-t trace         a render trace, the RT lines out of the Serial log (anything else on the
+		                 line before RT is skipped), can be given more than once
+		icon files       default DEFAULT_ICONS, run from the repo root
+
+	to get a trace on the PC build ScreenBudget and MenuScreenBench with -DRENDER_TRACE and
+	PatriotRacing_RenderTrace.cpp, and run them with -t
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/AssetFootprint.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp PatriotRacing_Fonts/Arial_100BINO.cpp PatriotRacing_Fonts/Arial_100_BINO.cpp PatriotRacing_Fonts/Arial_48BINO.cpp PatriotRacing_Fonts/Arial_48_BINO.cpp PatriotRacing_Fonts/Arial_24_AA4.cpp -o AssetFootprint
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "PatriotRacing_Font.h"
+#include "PatriotRacing_FontTable.h"
+#include "Adafruit_fonts.h"
+#include "Arial_100BINO_table.h"
+#include "Arial_100_BINO_table.h"
+#include "Arial_48BINO_table.h"
+#include "Arial_48_BINO_table.h"
+#include "Arial_24_AA4_table.h"
+
+#define ASSET_BUDGET 65536        // a quarter of the Teensy 3.2's 256k, the rest is code and libraries
+#define GFXGLYPH_BYTES 8          // sizeof(GFXglyph) on the Teensy, 7 bytes padded
+#define GFXFONT_BYTES 16          // sizeof(GFXfont)
+#define T3FONT_BYTES 28           // sizeof(ILI9341_t3_font_t)
+#define TABLE_ENTRY_BYTES 12      // sizeof(FontTableEntry)
+#define TABLE_BYTES 12            // sizeof(FontTable)
+#define PACKED_ICON_BYTES 20      // sizeof(PackedIcon)
+#define PACKED_MONO_BYTES 12      // sizeof(PackedMono)
+#define CODES 256
+
+static const char *DEFAULT_ICONS[] = {
+	"PatriotRacing_Utilities/PatriotRacing_Icons.h",
+	"PatriotRacing_Utilities/GPUSA_Icons.h",
+	"PatriotRacing_Utilities/PatriotRacing_PackedIcons.h",
+	"PatriotRacing_Utilities/PatriotRacing_ThemeIcons.h",
+	"PatriotRacing_Utilities/PatriotRacing_BootImage.h",
+	"PatriotRacing_Utilities/PatriotRacing_Atlas.h",
+	"PatriotRacing_Utilities/PatriotRacing_Atlas.cpp",
+};
+
+struct Font {
+	const char *Name;
+	const GFXfont *GFX;           // one or the other
+	const FontTable *Table;
+	uint32_t Glyph[CODES];        // bytes of each glyph, 0 if the font doesn't have it
+	bool Drawn[CODES];
+	uint32_t Fixed;               // struct, index, everything that isn't a glyph
+	uint32_t Bytes;
+	uint32_t DrawnBytes;
+	uint16_t Glyphs;
+	uint16_t DrawnGlyphs;
+};
+
+struct Array {
+	std::string Name;
+	std::string File;
+	uint32_t Bytes;
+	bool Owned;                   // part of an icon
+};
+
+struct Icon {
+	std::string Name;
+	std::string File;
+	uint32_t Bytes;
+	bool Drawn;
+};
+
+struct Step {
+	std::string What;
+	std::string How;
+	uint32_t Saves;
+};
+
+#define GFX(Name) {#Name, &Name, NULL, {}, {}, 0, 0, 0, 0, 0}
+#define T3(Name) {#Name, NULL, &Name##_table, {}, {}, 0, 0, 0, 0, 0}
+
+static Font Fonts[] = {
+	GFX(arial6), GFX(arial7), GFX(arial8), GFX(arial9), GFX(arial10), GFX(arial11), GFX(arial12),
+	GFX(arial14), GFX(arial16), GFX(arial18),
+	GFX(arialbd6), GFX(arialbd7), GFX(arialbd8), GFX(arialbd9), GFX(arialbd10), GFX(arialbd12),
+	GFX(arialbd14), GFX(arialbd16), GFX(arialbd18),
+	T3(Arial_100BINO), T3(Arial_100_BINO), T3(Arial_48BINO), T3(Arial_48_BINO), T3(Arial_24_AA4),
+};
+
+#define FONTS (sizeof(Fonts) / sizeof(Fonts[0]))
+
+static std::vector<Array> Arrays;
+static std::vector<Icon> Icons;
+static std::map<std::string, int> Unknown;        // trace names that aren't a font or an icon
+
+// bytes of the glyph's header and rows in the packed data, glyphs start on a byte
+static uint32_t T3GlyphBytes(const ILI9341_t3_font_t &Font, const FontGlyph &Glyph) {
+
+	uint32_t bit = Glyph.Bits;
+	uint16_t y = 0;
+
+	if (Font.version == 23) {
+		bit = ((bit + 7) & ~7UL) + (uint32_t) Glyph.Width * Glyph.Height * FontBPP(Font);
+	}
+	else {
+		// a 1 bit flag before each row, 3 more bits of repeat count when it's set
+		while (y < Glyph.Height) {
+			if (FontFetchBit(Glyph.Data, bit++)) {
+				y += FontFetchBits(Glyph.Data, bit, 3) + 2;
+				bit += 3;
+			}
+			else {
+				y++;
+			}
+			bit += Glyph.Width;
+		}
+	}
+	return (bit + 7) / 8;
+}
+
+static uint32_t T3IndexBytes(uint32_t Codes, uint8_t BitsIndex) {
+	return (Codes * BitsIndex + 7) / 8;
+}
+
+// codes in index1 and index2, not the gap between them
+static uint32_t T3IndexCodes(const ILI9341_t3_font_t &Font) {
+
+	uint32_t codes = Font.index1_last - Font.index1_first + 1;
+
+	if (Font.index2_last > 0) {
+		codes += Font.index2_last - Font.index2_first + 1;
+	}
+	return codes;
+}
+
+static void Measure(Font &F) {
+
+	FontGlyph g;
+	uint16_t c;
+
+	if (F.GFX != NULL) {
+		for (c = F.GFX->first; (c <= F.GFX->last) && (c < CODES); c++) {
+			const GFXglyph &gl = F.GFX->glyph[c - F.GFX->first];
+
+			F.Glyph[c] = GFXGLYPH_BYTES + ((uint32_t) gl.width * gl.height + 7) / 8;
+		}
+		F.Fixed = GFXFONT_BYTES;
+	}
+	else {
+		const ILI9341_t3_font_t &font = *F.Table->Font;
+
+		for (c = 0; c < CODES; c++) {
+			if (FontTableGlyph(*F.Table, c, g)) {
+				F.Glyph[c] = T3GlyphBytes(font, g) + ((F.Table->Glyph != NULL) ? TABLE_ENTRY_BYTES : 0);
+			}
+		}
+		F.Fixed = T3FONT_BYTES + TABLE_BYTES + T3IndexBytes(T3IndexCodes(font), font.bits_index);
+		// a code in the range the font doesn't have still has its table entry
+		if (F.Table->Glyph != NULL) {
+			for (c = FontTableFirst(font); c < FontTableFirst(font) + FontTableCount(font); c++) {
+				if (F.Glyph[c] == 0) {
+					F.Fixed += TABLE_ENTRY_BYTES;
+				}
+			}
+		}
+	}
+}
+
+static void Total(Font &F) {
+
+	uint16_t c;
+
+	F.Bytes = F.Fixed;
+	F.DrawnBytes = 0;
+	F.Glyphs = 0;
+	F.DrawnGlyphs = 0;
+	for (c = 0; c < CODES; c++) {
+		F.Bytes += F.Glyph[c];
+		if (F.Glyph[c] > 0) {
+			F.Glyphs++;
+			if (F.Drawn[c]) {
+				F.DrawnGlyphs++;
+				F.DrawnBytes += F.Glyph[c];
+			}
+		}
+	}
+}
+
+// the first and last codes drawn, false if none were
+static bool DrawnRange(const Font &F, uint16_t &First, uint16_t &Last) {
+
+	uint16_t c;
+	bool any = false;
+
+	for (c = 0; c < CODES; c++) {
+		if (F.Drawn[c] && (F.Glyph[c] > 0)) {
+			if (!any) {
+				First = c;
+			}
+			Last = c;
+			any = true;
+		}
+	}
+	return any;
+}
+
+// what the font would cost with only the drawn glyphs
+static uint32_t PrunedBytes(const Font &F) {
+
+	uint16_t first = 0, last = 0, c;
+	uint32_t bytes;
+
+	if (!DrawnRange(F, first, last)) {
+		return 0;
+	}
+	if (F.GFX != NULL) {
+		// every code from first to last keeps its GFXglyph, the blanked ones lose their bitmap
+		bytes = GFXFONT_BYTES;
+		for (c = first; c <= last; c++) {
+			bytes += F.Drawn[c] ? F.Glyph[c] : GFXGLYPH_BYTES;
+		}
+		return bytes;
+	}
+	// FontCompiler -c puts the codes from first to last in the index, the missing ones point at nothing
+	bytes = T3FONT_BYTES + TABLE_BYTES + T3IndexBytes(last - first + 1, F.Table->Font->bits_index);
+	for (c = first; c <= last; c++) {
+		if (F.Drawn[c]) {
+			bytes += F.Glyph[c];
+		}
+		else if (F.Table->Glyph != NULL) {
+			bytes += TABLE_ENTRY_BYTES;
+		}
+	}
+	return bytes;
+}
+
+// what cutting the font down saves, nothing when every glyph it has got drawn
+static uint32_t Pruned(const Font &F) {
+
+	uint32_t bytes = PrunedBytes(F);
+
+	return (bytes < F.Bytes) ? F.Bytes - bytes : 0;
+}
+
+// "37,43-58", the FontCompiler -c list of the drawn codes
+static std::string CodeList(const Font &F) {
+
+	std::string out;
+	char buf[16];
+	uint16_t c = 0, end;
+
+	while (c < CODES) {
+		if (!F.Drawn[c] || (F.Glyph[c] == 0)) {
+			c++;
+			continue;
+		}
+		for (end = c; (end + 1 < CODES) && F.Drawn[end + 1] && (F.Glyph[end + 1] > 0); end++) {
+		}
+		if (end == c) {
+			snprintf(buf, sizeof(buf), "%s%u", out.empty() ? "" : ",", c);
+		}
+		else {
+			snprintf(buf, sizeof(buf), "%s%u-%u", out.empty() ? "" : ",", c, end);
+		}
+		out += buf;
+		c = end + 1;
+	}
+	return out;
+}
+
+static std::string Strip(const std::string &Line, bool &InComment) {
+
+	std::string out;
+	size_t i = 0;
+
+	while (i < Line.size()) {
+		if (InComment) {
+			if (Line.compare(i, 2, "*/") == 0) {
+				InComment = false;
+				i += 2;
+			}
+			else {
+				i++;
+			}
+		}
+		else if (Line.compare(i, 2, "/*") == 0) {
+			InComment = true;
+			i += 2;
+		}
+		else if (Line.compare(i, 2, "//") == 0) {
+			break;
+		}
+		else {
+			out += Line[i++];
+		}
+	}
+	return out;
+}
+
+static uint32_t TypeBytes(const std::string &Type) {
+
+	if ((Type == "uint16_t") || (Type == "int16_t")) {
+		return 2;
+	}
+	if ((Type == "uint32_t") || (Type == "int32_t")) {
+		return 4;
+	}
+	if ((Type == "uint8_t") || (Type == "int8_t") || (Type == "char") || (Type == "unsigned char")) {
+		return 1;
+	}
+	return 0;
+}
+
+// "const uint16_t name [] PROGMEM = {" with static or not, the type and name, false for anything else
+static bool ArrayStart(const std::string &Line, std::string &Type, std::string &Name) {
+
+	const char *types[] = {"unsigned char", "uint16_t", "uint8_t", "uint32_t", "int16_t", "int8_t", "int32_t", "char"};
+	size_t p = Line.find("const ");
+	size_t q, b;
+	size_t t;
+
+	if ((p == std::string::npos) || (Line.find('[') == std::string::npos) || (Line.find('=') == std::string::npos)) {
+		return false;
+	}
+	p += 6;
+	for (t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+		if (Line.compare(p, strlen(types[t]), types[t]) == 0) {
+			Type = types[t];
+			q = p + strlen(types[t]);
+			while ((q < Line.size()) && isspace((unsigned char) Line[q])) {
+				q++;
+			}
+			b = q;
+			while ((q < Line.size()) && (isalnum((unsigned char) Line[q]) || (Line[q] == '_'))) {
+				q++;
+			}
+			Name = Line.substr(b, q - b);
+			return !Name.empty() && (Line.find('[', q) != std::string::npos);
+		}
+	}
+	return false;
+}
+
+// comma separated numbers from the array's opening brace to its closing one
+static uint32_t CountValues(const std::string &Body) {
+
+	uint32_t n = 0;
+	size_t i;
+	bool in = false;
+
+	for (i = 0; i < Body.size(); i++) {
+		if (isalnum((unsigned char) Body[i]) || (Body[i] == '-')) {
+			if (!in) {
+				n++;
+			}
+			in = true;
+		}
+		else if ((Body[i] == ',') || isspace((unsigned char) Body[i])) {
+			in = false;
+		}
+	}
+	return n;
+}
+
+static void ReadIcons(const char *Path) {
+
+	FILE *f = fopen(Path, "r");
+	char buf[4096];
+	std::string line, type, name, body;
+	bool comment = false, inArray = false;
+	uint32_t width, height, offset, words;
+	char sprite[64], kind[32], fields[256];
+
+	if (f == NULL) {
+		printf("can't read %s\n", Path);
+		exit(1);
+	}
+	while (fgets(buf, sizeof(buf), f)) {
+		// the atlas table rows carry the sprite's name in the comment
+		if (sscanf(buf, " {%u, %u, SPRITE_%*[A-Z0-9], %u, %u}%*[ ,\t]// %63s", &width, &height, &offset, &words, sprite) == 5) {
+			Icons.push_back({std::string("ATLAS_") + sprite, Path, words * 4, false});
+			continue;
+		}
+		line = Strip(buf, comment);
+		if (inArray) {
+			body += line;
+			if (line.find('}') != std::string::npos) {
+				body = body.substr(0, body.find('}'));
+				Arrays.push_back({name, Path, CountValues(body) * TypeBytes(type), false});
+				inArray = false;
+			}
+			continue;
+		}
+		if (ArrayStart(line, type, name)) {
+			body = line.substr(line.find('{') + 1);
+			if (body.find('}') != std::string::npos) {
+				body = body.substr(0, body.find('}'));
+				Arrays.push_back({name, Path, CountValues(body) * TypeBytes(type), false});
+			}
+			else {
+				inArray = true;
+			}
+			continue;
+		}
+		// const PackedIcon name = {32, 32, name_palette, 91, name_data, 1293};
+		if (sscanf(line.c_str(), " const %31s %63s = {%255[^}]", kind, sprite, fields) == 3) {
+			std::string k = kind;
+			uint32_t bytes;
+
+			if ((k != "PackedIcon") && (k != "PackedMono")) {
+				continue;
+			}
+			bytes = (k == "PackedIcon") ? PACKED_ICON_BYTES : PACKED_MONO_BYTES;
+			for (Array &a : Arrays) {
+				if (!a.Owned && (strstr(fields, a.Name.c_str()) != NULL)) {
+					a.Owned = true;
+					bytes += a.Bytes;
+				}
+			}
+			Icons.push_back({sprite, Path, bytes, false});
+		}
+	}
+	fclose(f);
+}
+
+// the atlas words are in the sprites, the rest of the arrays that no struct took are raw icons
+static void RawIcons() {
+
+	bool atlas = false;
+
+	for (const Icon &i : Icons) {
+		if (i.Name.compare(0, 6, "ATLAS_") == 0) {
+			atlas = true;
+		}
+	}
+	for (Array &a : Arrays) {
+		if ((a.Name == "AtlasWords") && atlas) {
+			continue;
+		}
+		if (!a.Owned) {
+			Icons.push_back({a.Name, a.File, a.Bytes, false});
+		}
+	}
+}
+
+static void ReadTrace(const char *Path) {
+
+	FILE *f = fopen(Path, "r");
+	char buf[512], name[128];
+	const char *rt;
+	unsigned code;
+	int n;
+	size_t i;
+	bool found;
+
+	if (f == NULL) {
+		printf("can't read %s\n", Path);
+		exit(1);
+	}
+	while (fgets(buf, sizeof(buf), f)) {
+		rt = strstr(buf, "RT ");
+		if (rt == NULL) {
+			continue;
+		}
+		n = sscanf(rt + 3, "%127s %u", name, &code);
+		if (n < 1) {
+			continue;
+		}
+		found = false;
+		for (i = 0; i < FONTS; i++) {
+			if (strcmp(Fonts[i].Name, name) == 0) {
+				if ((n == 2) && (code < CODES)) {
+					Fonts[i].Drawn[code] = true;
+				}
+				found = true;
+			}
+		}
+		for (Icon &ic : Icons) {
+			if (ic.Name == name) {
+				ic.Drawn = true;
+				found = true;
+			}
+		}
+		if (!found) {
+			Unknown[name]++;
+		}
+	}
+	fclose(f);
+}
+
+static void GlyphLines(const Font &F, bool Traced) {
+
+	uint16_t c;
+
+	for (c = 0; c < CODES; c++) {
+		if (F.Glyph[c] == 0) {
+			continue;
+		}
+		printf("    0x%02X %c %6u bytes%s\n", c, isprint(c) ? c : ' ', F.Glyph[c], !Traced ? "" : (F.Drawn[c] ? "  drawn" : ""));
+	}
+}
+
+int main(int argc, char **argv) {
+
+	std::vector<const char *> traces, files;
+	std::vector<Step> steps;
+	uint32_t budget = ASSET_BUDGET, fonts = 0, icons = 0, total, saved = 0, packed = 0;
+	uint16_t first = 0, last = 0;
+	bool glyphs = false;
+	char how[512];
+	size_t i;
+	int a;
+
+	for (a = 1; a < argc; a++) {
+		if ((strcmp(argv[a], "-b") == 0) && (a + 1 < argc)) {
+			budget = strtoul(argv[++a], NULL, 0);
+		}
+		else if ((strcmp(argv[a], "-t") == 0) && (a + 1 < argc)) {
+			traces.push_back(argv[++a]);
+		}
+		else if (strcmp(argv[a], "-g") == 0) {
+			glyphs = true;
+		}
+		else if (argv[a][0] == '-') {
+			printf("AssetFootprint [-b bytes] [-g] [-t trace] ... [icon files]\n");
+			return 1;
+		}
+		else {
+			files.push_back(argv[a]);
+		}
+	}
+	if (files.empty()) {
+		files.assign(DEFAULT_ICONS, DEFAULT_ICONS + sizeof(DEFAULT_ICONS) / sizeof(DEFAULT_ICONS[0]));
+	}
+
+	for (const char *f : files) {
+		ReadIcons(f);
+	}
+	RawIcons();
+	for (i = 0; i < FONTS; i++) {
+		Measure(Fonts[i]);
+	}
+	for (const char *t : traces) {
+		ReadTrace(t);
+	}
+
+	printf("fonts                  glyphs  bytes    a glyph%s\n", traces.empty() ? "" : "   drawn   drawn bytes");
+	for (i = 0; i < FONTS; i++) {
+		Font &f = Fonts[i];
+
+		Total(f);
+		fonts += f.Bytes;
+		printf("  %-18s %6u %8u %7.0f", f.Name, f.Glyphs, f.Bytes, (double) (f.Bytes - f.Fixed) / f.Glyphs);
+		if (!traces.empty()) {
+			printf("   %5u %8u", f.DrawnGlyphs, f.DrawnBytes);
+		}
+		printf("\n");
+		if (glyphs) {
+			GlyphLines(f, !traces.empty());
+		}
+	}
+	printf("  %-18s        %8u\n", "all fonts", fonts);
+
+	printf("icons\n");
+	for (const Icon &ic : Icons) {
+		icons += ic.Bytes;
+		printf("  %-28s %8u  %s%s\n", ic.Name.c_str(), ic.Bytes, ic.File.c_str(), (!traces.empty() && ic.Drawn) ? "  drawn" : "");
+	}
+	printf("  %-28s %8u\n", "all icons", icons);
+
+	total = fonts + icons;
+	printf("fonts and icons %u bytes, budget %u\n", total, budget);
+	if (traces.empty()) {
+		printf("no trace (-t), no plan\n");
+		return (total > budget) ? 1 : 0;
+	}
+	for (const auto &u : Unknown) {
+		printf("the trace has %s (%d lines), not a font or icon here\n", u.first.c_str(), u.second);
+	}
+
+	// the plan, whole assets the trace never drew, then the drawn fonts cut to their drawn glyphs
+	for (i = 0; i < FONTS; i++) {
+		const Font &f = Fonts[i];
+
+		if (f.DrawnGlyphs == 0) {
+			steps.push_back({f.Name, "never drawn, drop it", f.Bytes});
+		}
+		else if (f.GFX != NULL) {
+			DrawnRange(f, first, last);
+			snprintf(how, sizeof(how), "fontconvert %u %u, blank the %u not drawn in between", first, last, (unsigned) (last - first + 1 - f.DrawnGlyphs));
+			steps.push_back({f.Name, how, Pruned(f)});
+		}
+		else {
+			snprintf(how, sizeof(how), "FontCompiler -c %s, the other options as it was made", CodeList(f).c_str());
+			steps.push_back({f.Name, how, Pruned(f)});
+			if (f.Table->Glyph != NULL) {
+				first = 0;
+				last = 0;
+				DrawnRange(f, first, last);
+				packed += (last - first + 1) * TABLE_ENTRY_BYTES;
+			}
+		}
+	}
+	for (const Icon &ic : Icons) {
+		if (!ic.Drawn) {
+			steps.push_back({ic.Name, "never drawn, drop it", ic.Bytes});
+		}
+	}
+	std::stable_sort(steps.begin(), steps.end(), [](const Step &A, const Step &B) {
+		return A.Saves > B.Saves;
+	});
+
+	printf("pruning plan\n");
+	for (const Step &s : steps) {
+		if (s.Saves == 0) {
+			continue;
+		}
+		saved += s.Saves;
+		printf("  %-28s %8u  %8u left  %s\n", s.What.c_str(), s.Saves, total - saved, s.How.c_str());
+	}
+	if ((total - saved > budget) && (packed > 0)) {
+		saved += packed;
+		printf("  %-28s %8u  %8u left  %s\n", "flat glyph tables", packed, total - saved, "-DFONTTABLE_PACKED");
+	}
+	printf("%u bytes after the plan, %s the %u byte budget by %u\n", total - saved, (total - saved > budget) ? "over" : "under",
+		budget, (total - saved > budget) ? total - saved - budget : budget - (total - saved));
+
+	return (total - saved > budget) ? 1 : 0;
+}
@@ -0,0 +1,399 @@
+/*
+
+	Program name: Bob Jones Patriot Racing sprite atlas builder
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	reads the icon headers (const uint16_t name [] RGB565 arrays and const unsigned char name [] 1 bit
+	arrays, the way image2cpp writes them) and writes the atlas (PatriotRacing_Sprites.h has the
+	format)
+		PatriotRacing_Atlas.cpp    the words, one PROGMEM array
+		PatriotRacing_Atlas.h      the constexpr table, a handle per sprite (ATLAS_ + the array name)
+		                           and AtlasDraw
+
+	AtlasBuild [-o PatriotRacing_Utilities] [-n name,name] [-x] Icons.h ...
+		-o folder        where the two files go (default PatriotRacing_Utilities)
+		-n names         only these arrays (default all of them)
+		-x               report only, don't write anything
+
+	sizes come from the image2cpp comment next to the array ("// 'Key', 20x20px"), or a square that
+	fits the byte count. every sprite is drawn out of the new atlas with SpriteDraw and compared with
+	the source array before anything is written. the report says which arrays weren't PROGMEM (on a
+	Teensy 4 those were taking RAM too)
+
+	to remake the checked in atlas
+	AtlasBuild PatriotRacing_Utilities/PatriotRacing_Icons.h PatriotRacing_Utilities/GPUSA_Icons.h
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities PatriotRacing_Tools/AtlasBuild.cpp -o AtlasBuild
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "PatriotRacing_Sprites.h"
+#include "MockDisplay.h"
+
+#define FORE 0xFFFF
+#define BACK 0x0000
+
+struct Source {
+	std::string Name;
+	uint8_t Format;
+	bool Progmem;
+	uint16_t Width;
+	uint16_t Height;
+	std::vector<uint32_t> Values;     // uint16_t pixels or bytes
+	uint32_t Offset;
+	uint32_t Words;
+};
+
+static uint32_t SourceBytes(const Source &S) {
+	return S.Values.size() * ((S.Format == SPRITE_RGB565) ? 2 : 1);
+}
+
+// values this size sprite needs in the source array
+static uint32_t SourceCount(uint8_t Format, uint32_t W, uint32_t H) {
+	return (Format == SPRITE_RGB565) ? W * H : ((W + 7) / 8) * H;
+}
+
+static bool ReadArrays(const char *Path, std::vector<Source> &Sources) {
+
+	FILE *f = fopen(Path, "rb");
+	std::string text, dims, decl;
+	size_t at, next16, next8, open, close, name0, name1, c, x, s;
+	const char *p;
+	char *end;
+	uint32_t w, h;
+
+	if (f == NULL) {
+		printf("can't open %s\n", Path);
+		return false;
+	}
+	for (int ch; (ch = fgetc(f)) != EOF; ) {
+		text += (char) ch;
+	}
+	fclose(f);
+
+	at = 0;
+	while (true) {
+		next16 = text.find("const uint16_t", at);
+		next8 = text.find("const unsigned char", at);
+		if ((next16 == std::string::npos) && (next8 == std::string::npos)) {
+			break;
+		}
+
+		Source src;
+		if (next16 < next8) {
+			at = next16;
+			src.Format = SPRITE_RGB565;
+			name0 = text.find_first_not_of(" \t", at + 14);
+		}
+		else {
+			at = next8;
+			src.Format = SPRITE_MONO;
+			name0 = text.find_first_not_of(" \t", at + 19);
+		}
+		name1 = text.find_first_of(" \t[", name0);
+		open = text.find('{', name1);
+		close = text.find('}', open);
+		if ((name1 == std::string::npos) || (open == std::string::npos) || (close == std::string::npos)) {
+			break;
+		}
+		src.Name = text.substr(name0, name1 - name0);
+		decl = text.substr(name1, open - name1);
+		src.Progmem = decl.find("PROGMEM") != std::string::npos;
+
+		for (p = text.c_str() + open + 1; p < text.c_str() + close; ) {
+			if ((p[0] == '0') && ((p[1] == 'x') || (p[1] == 'X'))) {
+				src.Values.push_back(strtoul(p, &end, 16));
+				p = end;
+			}
+			else if ((p[0] == '/') && (p[1] == '/')) {
+				while ((p < text.c_str() + close) && (*p != '\n')) {
+					p++;
+				}
+			}
+			else {
+				p++;
+			}
+		}
+
+		// "WxHpx" just before the array or on its first line, it has to agree with the count
+		src.Width = src.Height = 0;
+		c = (at > 200) ? at - 200 : 0;
+		dims = text.substr(c, open + 200 - c);
+		for (c = 0; (c = dims.find("px", c)) != std::string::npos; c++) {
+			x = dims.rfind('x', c - 1);
+			if (x == std::string::npos) {
+				continue;
+			}
+			s = dims.find_last_not_of("0123456789", x - 1);
+			if (s == std::string::npos) {
+				continue;
+			}
+			w = atoi(dims.c_str() + s + 1);
+			h = atoi(dims.c_str() + x + 1);
+			if (w && h && (SourceCount(src.Format, w, h) == src.Values.size())) {
+				src.Width = w;
+				src.Height = h;
+			}
+		}
+		for (w = 1; (src.Width == 0) && (w <= 320); w++) {
+			if (SourceCount(src.Format, w, w) == src.Values.size()) {
+				src.Width = src.Height = w;
+			}
+		}
+		if (src.Width == 0) {
+			printf("%s: %u values and no size that fits, skipped\n", src.Name.c_str(), (unsigned) src.Values.size());
+		}
+		else {
+			Sources.push_back(src);
+		}
+		at = close;
+	}
+	return true;
+}
+
+// appends the sprite to the atlas in its format
+static void Place(Source &S, std::vector<uint32_t> &Words) {
+
+	uint32_t i, x, y, stride, bit;
+
+	S.Offset = Words.size();
+	if (S.Format == SPRITE_RGB565) {
+		for (i = 0; i < S.Values.size(); i += 2) {
+			Words.push_back(S.Values[i] | ((i + 1 < S.Values.size()) ? S.Values[i + 1] << 16 : 0));
+		}
+	}
+	else {
+		stride = (S.Width + 7) / 8;
+		for (y = 0; y < S.Height; y++) {
+			for (x = 0; x < S.Width; x += 32) {
+				uint32_t w = 0;
+				for (bit = 0; (bit < 32) && (x + bit < S.Width); bit++) {
+					if (S.Values[y * stride + (x + bit) / 8] & (0x80 >> ((x + bit) & 7))) {
+						w |= 0x80000000UL >> bit;
+					}
+				}
+				Words.push_back(w);
+			}
+		}
+	}
+	S.Words = Words.size() - S.Offset;
+}
+
+// draw it out of the atlas and compare with the source
+static bool Verify(const Source &S, const std::vector<uint32_t> &Words) {
+
+	static MockDisplay got;
+	uint32_t x, y, stride;
+	uint16_t want;
+
+	got.Clear(0x1234);
+	if (S.Format == SPRITE_RGB565) {
+		SpriteDraw(got, Words.data(), 0, 0, Sprite565{S.Width, S.Height, S.Offset});
+	}
+	else {
+		SpriteDraw(got, Words.data(), 0, 0, SpriteMono{S.Width, S.Height, S.Offset}, FORE, BACK);
+	}
+	stride = (S.Width + 7) / 8;
+	for (y = 0; y < S.Height; y++) {
+		for (x = 0; x < S.Width; x++) {
+			if ((x >= MOCK_W) || (y >= MOCK_H)) {
+				continue;
+			}
+			if (S.Format == SPRITE_RGB565) {
+				want = S.Values[y * S.Width + x];
+			}
+			else {
+				want = (S.Values[y * stride + x / 8] & (0x80 >> (x & 7))) ? FORE : BACK;
+			}
+			if (got.Pixels[y * MOCK_W + x] != want) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static void PutLine(FILE *f, const std::string &Text) {
+	fputs(Text.c_str(), f);
+	fputs("\r\n", f);
+}
+
+static void Header(FILE *f, const char *What) {
+	PutLine(f, "/*");
+	PutLine(f, "");
+	PutLine(f, std::string("\tProgram name: Bob Jones Patriot Racing sprite atlas ") + What);
+	PutLine(f, "");
+	PutLine(f, "\tmade by PatriotRacing_Tools/AtlasBuild from PatriotRacing_Icons.h and GPUSA_Icons.h, don't");
+	PutLine(f, "\tedit, change the icon and run it again");
+	PutLine(f, "");
+	PutLine(f, "*/");
+	PutLine(f, "");
+}
+
+static bool Write(const std::string &Folder, const std::vector<Source> &Sources, const std::vector<uint32_t> &Words) {
+
+	std::string path = Folder + "/PatriotRacing_Atlas.h";
+	std::string line;
+	char buf[160];
+	size_t i;
+	FILE *f;
+
+	f = fopen(path.c_str(), "wb");
+	if (f == NULL) {
+		printf("can't write %s\n", path.c_str());
+		return false;
+	}
+	Header(f, "table");
+	PutLine(f, "#ifndef PATRIOT_RACING_ATLAS_H");
+	PutLine(f, "#define PATRIOT_RACING_ATLAS_H");
+	PutLine(f, "");
+	PutLine(f, "#include \"PatriotRacing_Sprites.h\"");
+	PutLine(f, "");
+	snprintf(buf, sizeof(buf), "#define ATLAS_SPRITES %u", (unsigned) Sources.size());
+	PutLine(f, buf);
+	snprintf(buf, sizeof(buf), "#define ATLAS_WORDS %u", (unsigned) Words.size());
+	PutLine(f, buf);
+	PutLine(f, "");
+	PutLine(f, "extern const uint32_t AtlasWords[ATLAS_WORDS];");
+	PutLine(f, "");
+	PutLine(f, "// width, height, format, offset, words");
+	PutLine(f, "constexpr SpriteInfo AtlasTable[ATLAS_SPRITES] = {");
+	for (i = 0; i < Sources.size(); i++) {
+		const Source &s = Sources[i];
+		snprintf(buf, sizeof(buf), "\t{%u, %u, %s, %u, %u}%s\t\t// %s", s.Width, s.Height, (s.Format == SPRITE_RGB565) ? "SPRITE_RGB565" : "SPRITE_MONO", s.Offset, s.Words, (i + 1 < Sources.size()) ? "," : "", s.Name.c_str());
+		PutLine(f, buf);
+	}
+	PutLine(f, "};");
+	PutLine(f, "");
+	for (i = 0; i < Sources.size(); i++) {
+		const Source &s = Sources[i];
+		if (s.Format == SPRITE_RGB565) {
+			snprintf(buf, sizeof(buf), "constexpr Sprite565 ATLAS_%s = SpriteHandle<SPRITE_RGB565>(AtlasTable[%u]);", s.Name.c_str(), (unsigned) i);
+		}
+		else {
+			snprintf(buf, sizeof(buf), "constexpr SpriteMono ATLAS_%s = SpriteHandle<SPRITE_MONO>(AtlasTable[%u]);", s.Name.c_str(), (unsigned) i);
+		}
+		PutLine(f, buf);
+	}
+	PutLine(f, "");
+	PutLine(f, "template <class Display>");
+	PutLine(f, "void AtlasDraw(Display &D, int16_t X, int16_t Y, const Sprite565 &S) {");
+	PutLine(f, "\tSpriteDraw(D, AtlasWords, X, Y, S);");
+	PutLine(f, "}");
+	PutLine(f, "");
+	PutLine(f, "template <class Display>");
+	PutLine(f, "void AtlasDraw(Display &D, int16_t X, int16_t Y, const SpriteMono &S, uint16_t Fore, uint16_t Back) {");
+	PutLine(f, "\tSpriteDraw(D, AtlasWords, X, Y, S, Fore, Back);");
+	PutLine(f, "}");
+	PutLine(f, "");
+	PutLine(f, "#endif");
+	fclose(f);
+
+	path = Folder + "/PatriotRacing_Atlas.cpp";
+	f = fopen(path.c_str(), "wb");
+	if (f == NULL) {
+		printf("can't write %s\n", path.c_str());
+		return false;
+	}
+	Header(f, "data");
+	PutLine(f, "#include \"PatriotRacing_Atlas.h\"");
+	PutLine(f, "");
+	PutLine(f, "#ifndef PROGMEM");
+	PutLine(f, " #define PROGMEM");
+	PutLine(f, "#endif");
+	PutLine(f, "");
+	PutLine(f, "const uint32_t AtlasWords[ATLAS_WORDS] PROGMEM = {");
+	for (const Source &s : Sources) {
+		snprintf(buf, sizeof(buf), "\t// %s, %ux%upx", s.Name.c_str(), s.Width, s.Height);
+		PutLine(f, buf);
+		line = "\t";
+		for (i = 0; i < s.Words; i++) {
+			snprintf(buf, sizeof(buf), "0x%08x%s", Words[s.Offset + i], (s.Offset + i + 1 < Words.size()) ? "," : "");
+			line += buf;
+			if (((i % 8) != 7) && (i + 1 != s.Words)) {
+				line += " ";
+			}
+			else {
+				PutLine(f, line);
+				line = "\t";
+			}
+		}
+	}
+	PutLine(f, "};");
+	fclose(f);
+	return true;
+}
+
+int main(int argc, char **argv) {
+
+	std::vector<Source> sources, keep;
+	std::vector<uint32_t> words;
+	std::string folder = "PatriotRacing_Utilities";
+	std::string names;
+	bool report = false;
+	uint32_t before = 0, ram = 0;
+	int a;
+
+	for (a = 1; a < argc; a++) {
+		if ((strcmp(argv[a], "-o") == 0) && (a + 1 < argc)) {
+			folder = argv[++a];
+		}
+		else if ((strcmp(argv[a], "-n") == 0) && (a + 1 < argc)) {
+			names = std::string(",") + argv[++a] + ",";
+		}
+		else if (strcmp(argv[a], "-x") == 0) {
+			report = true;
+		}
+		else if (argv[a][0] != '-') {
+			if (!ReadArrays(argv[a], sources)) {
+				return 1;
+			}
+		}
+		else {
+			printf("AtlasBuild [-o folder] [-n name,name] [-x] Icons.h ...\n");
+			return 1;
+		}
+	}
+
+	printf("sprite                 format   size       offset  words  was\n");
+	for (Source &s : sources) {
+		if (!names.empty() && (names.find("," + s.Name + ",") == std::string::npos)) {
+			continue;
+		}
+		if (s.Width > SPRITES_BAND) {
+			printf("%s is wider than SPRITES_BAND, skipped\n", s.Name.c_str());
+			continue;
+		}
+		Place(s, words);
+		if (!Verify(s, words)) {
+			printf("%s doesn't draw back the same\n", s.Name.c_str());
+			return 1;
+		}
+		printf("%-22s %-7s %3ux%-3u   %7u %6u  %u bytes%s\n", s.Name.c_str(), (s.Format == SPRITE_RGB565) ? "565" : "mono", s.Width, s.Height, s.Offset, s.Words, SourceBytes(s), s.Progmem ? "" : ", not PROGMEM");
+		before += SourceBytes(s);
+		if (!s.Progmem) {
+			ram += SourceBytes(s);
+		}
+		keep.push_back(s);
+	}
+	printf("%u sprites, atlas %u bytes (the arrays were %u), %u bytes were const but not PROGMEM\n", (unsigned) keep.size(), (unsigned) words.size() * 4, before, ram);
+
+	if (report || keep.empty()) {
+		return 0;
+	}
+	if (!Write(folder, keep, words)) {
+		return 1;
+	}
+	printf("wrote %s/PatriotRacing_Atlas.h and .cpp\n", folder.c_str());
+	return 0;
+}
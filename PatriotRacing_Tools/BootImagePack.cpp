@@ -0,0 +1,300 @@
+/*
+
+	Program name: Bob Jones Patriot Racing boot image packer
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	reads a 1 bit image2cpp array (const unsigned char name [] = { ... }, msb is the leftmost pixel,
+	rows padded to a byte) and writes it as a run length PackedMono (PatriotRacing_BootSplash.h has
+	the format), then prints the flash and what boot would push over SPI both ways
+
+	BootImagePack [-o PatriotRacing_Utilities/PatriotRacing_BootImage.h] [-n BootImage] [-x] Icons.h
+		-o file          where the table goes
+		-n name          the array (default BootImage), the table is name_packed
+		-x               report only, don't write anything
+
+	the size comes from the image2cpp comment in the array ("// 'BootLogo', 240x160px"). the packed
+	image is drawn back through BootSplash into a mock display and compared with the source before
+	anything is written
+
+	to remake the checked in table
+	BootImagePack PatriotRacing_Utilities/PatriotRacing_Icons.h
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities PatriotRacing_Tools/BootImagePack.cpp PatriotRacing_Utilities/PatriotRacing_BootSplash.cpp -o BootImagePack
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "PatriotRacing_BootSplash.h"
+#include "MockDisplay.h"
+
+#define FORE 0xFFFF
+#define BACK 0x0000
+#define SPI_MHZ 30.0              // ILI9341_t3 default
+#define WINDOW_BYTES 11           // CASET, PASET, RAMWR
+
+// the array's bytes and its size from the image2cpp comment
+static bool ReadImage(const char *Path, const std::string &Name, std::vector<uint8_t> &Bytes, uint16_t &W, uint16_t &H) {
+
+	FILE *f = fopen(Path, "rb");
+	std::string text, key;
+	size_t at, open, close, px, x, s;
+	const char *p;
+	char *end;
+
+	if (f == NULL) {
+		printf("can't open %s\n", Path);
+		return false;
+	}
+	for (int ch; (ch = fgetc(f)) != EOF; ) {
+		text += (char) ch;
+	}
+	fclose(f);
+
+	key = "const unsigned char " + Name + " ";
+	at = text.find(key);
+	if (at == std::string::npos) {
+		key = "const unsigned char " + Name + "[";
+		at = text.find(key);
+	}
+	open = (at == std::string::npos) ? at : text.find('{', at);
+	close = (open == std::string::npos) ? open : text.find('}', open);
+	if (close == std::string::npos) {
+		printf("no %s in %s\n", Name.c_str(), Path);
+		return false;
+	}
+
+	W = H = 0;
+	px = text.find("px", open);
+	if ((px != std::string::npos) && (px < close)) {
+		x = text.rfind('x', px - 1);
+		s = text.find_last_not_of("0123456789", x - 1);
+		W = atoi(text.c_str() + s + 1);
+		H = atoi(text.c_str() + x + 1);
+	}
+
+	for (p = text.c_str() + open + 1; p < text.c_str() + close; ) {
+		if ((p[0] == '0') && ((p[1] == 'x') || (p[1] == 'X'))) {
+			Bytes.push_back(strtoul(p, &end, 16));
+			p = end;
+		}
+		else if ((p[0] == '/') && (p[1] == '/')) {
+			while ((p < text.c_str() + close) && (*p != '\n')) {
+				p++;
+			}
+		}
+		else {
+			p++;
+		}
+	}
+
+	if ((W == 0) || (Bytes.size() != (size_t) ((W + 7) / 8) * H)) {
+		printf("%s: %u bytes doesn't match a %ux%u image\n", Name.c_str(), (unsigned) Bytes.size(), W, H);
+		return false;
+	}
+	return true;
+}
+
+static bool Bit(const std::vector<uint8_t> &Bytes, uint16_t W, uint32_t X, uint32_t Y) {
+	return Bytes[Y * ((W + 7) / 8) + X / 8] & (0x80 >> (X & 7));
+}
+
+static void PutRun(std::vector<uint8_t> &Out, uint32_t Run) {
+
+	if (Run < BOOTSPLASH_LONG) {
+		Out.push_back(Run);
+	}
+	else {
+		Out.push_back(BOOTSPLASH_LONG | (Run >> 8));
+		Out.push_back(Run & 0xFF);
+	}
+}
+
+// alternating runs, Back first
+static void Pack(const std::vector<uint8_t> &Bytes, uint16_t W, uint16_t H, std::vector<uint8_t> &Out) {
+
+	bool color = false, bit;
+	uint32_t run = 0, x, y;
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++) {
+			bit = Bit(Bytes, W, x, y);
+			if (bit != color) {
+				PutRun(Out, run);
+				color = bit;
+				run = 0;
+			}
+			if (run == BOOTSPLASH_MAX_RUN) {
+				// split it, a 0 run of the other color keeps the colors in step
+				PutRun(Out, run);
+				PutRun(Out, 0);
+				run = 0;
+			}
+			run++;
+		}
+	}
+	PutRun(Out, run);
+}
+
+static bool Verify(const std::vector<uint8_t> &Bytes, uint16_t W, uint16_t H, const std::vector<uint8_t> &Packed, uint32_t &Steps, uint32_t &Windows) {
+
+	static MockDisplay got;
+	PackedMono image = {W, H, Packed.data(), (uint32_t) Packed.size()};
+	BootSplash splash;
+	uint32_t x, y;
+
+	got.Clear(0x1234);
+	splash.Begin(image, 0, 0, FORE, BACK);
+	Steps = 1;
+	while (splash.Step(got)) {
+		Steps++;
+	}
+	Windows = got.Windows;
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++) {
+			if ((x < MOCK_W) && (y < MOCK_H) && (got.Pixels[y * MOCK_W + x] != (Bit(Bytes, W, x, y) ? FORE : BACK))) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static void PutLine(FILE *f, const std::string &Text) {
+	fputs(Text.c_str(), f);
+	fputs("\r\n", f);
+}
+
+static bool Write(const std::string &Path, const std::string &Name, uint16_t W, uint16_t H, uint32_t Raw, const std::vector<uint8_t> &Packed) {
+
+	FILE *f = fopen(Path.c_str(), "wb");
+	std::string line;
+	char buf[160];
+	size_t i;
+
+	if (f == NULL) {
+		printf("can't write %s\n", Path.c_str());
+		return false;
+	}
+	PutLine(f, "/*");
+	PutLine(f, "");
+	PutLine(f, "\tProgram name: Bob Jones Patriot Racing packed boot image");
+	PutLine(f, "");
+	PutLine(f, "\tmade by PatriotRacing_Tools/BootImagePack from PatriotRacing_Icons.h, don't edit, change the");
+	PutLine(f, "\traw image and run it again");
+	PutLine(f, "");
+	PutLine(f, "*/");
+	PutLine(f, "");
+	PutLine(f, "#ifndef PATRIOT_RACING_BOOTIMAGE_H");
+	PutLine(f, "#define PATRIOT_RACING_BOOTIMAGE_H");
+	PutLine(f, "");
+	PutLine(f, "#include \"PatriotRacing_BootSplash.h\"");
+	PutLine(f, "");
+	PutLine(f, "#ifndef PROGMEM");
+	PutLine(f, " #define PROGMEM");
+	PutLine(f, "#endif");
+	PutLine(f, "");
+	snprintf(buf, sizeof(buf), "// %s, %ux%upx, %u bytes (raw %u)", Name.c_str(), W, H, (unsigned) Packed.size(), Raw);
+	PutLine(f, buf);
+	PutLine(f, "static const uint8_t " + Name + "_packed_data [] PROGMEM = {");
+	line = "\t";
+	for (i = 0; i < Packed.size(); i++) {
+		snprintf(buf, sizeof(buf), "0x%02x%s", Packed[i], (i + 1 < Packed.size()) ? "," : "");
+		line += buf;
+		if (((i % 24) == 23) || (i + 1 == Packed.size())) {
+			PutLine(f, line);
+			line = "\t";
+		}
+		else {
+			line += " ";
+		}
+	}
+	PutLine(f, "};");
+	snprintf(buf, sizeof(buf), "const PackedMono %s_packed = {%u, %u, %s_packed_data, %u};", Name.c_str(), W, H, Name.c_str(), (unsigned) Packed.size());
+	PutLine(f, buf);
+	PutLine(f, "");
+	PutLine(f, "#endif");
+	fclose(f);
+	return true;
+}
+
+int main(int argc, char **argv) {
+
+	std::string out = "PatriotRacing_Utilities/PatriotRacing_BootImage.h";
+	std::string name = "BootImage";
+	const char *path = NULL;
+	std::vector<uint8_t> bytes, packed;
+	bool report = false;
+	uint16_t w, h;
+	uint32_t steps, windows, pixels, setBits = 0, x, y;
+	double oldBytes, opaqueBytes, newBytes;
+	int a;
+
+	for (a = 1; a < argc; a++) {
+		if ((strcmp(argv[a], "-o") == 0) && (a + 1 < argc)) {
+			out = argv[++a];
+		}
+		else if ((strcmp(argv[a], "-n") == 0) && (a + 1 < argc)) {
+			name = argv[++a];
+		}
+		else if (strcmp(argv[a], "-x") == 0) {
+			report = true;
+		}
+		else if (argv[a][0] != '-') {
+			path = argv[a];
+		}
+		else {
+			path = NULL;
+			break;
+		}
+	}
+	if (path == NULL) {
+		printf("BootImagePack [-o file] [-n name] [-x] Icons.h\n");
+		return 1;
+	}
+
+	if (!ReadImage(path, name, bytes, w, h)) {
+		return 1;
+	}
+	Pack(bytes, w, h, packed);
+	if (!Verify(bytes, w, h, packed, steps, windows)) {
+		printf("%s doesn't draw back the same\n", name.c_str());
+		return 1;
+	}
+
+	pixels = (uint32_t) w * h;
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			setBits += Bit(bytes, w, x, y);
+		}
+	}
+
+	// the old way, a fill then a window per lit pixel (drawBitmap -> drawPixel)
+	oldBytes = pixels * 2.0 + WINDOW_BYTES + setBits * (2.0 + WINDOW_BYTES);
+	// or a window for every pixel (drawBitmap with a background color)
+	opaqueBytes = pixels * (2.0 + WINDOW_BYTES);
+	newBytes = pixels * 2.0 + windows * WINDOW_BYTES;
+
+	printf("%s %ux%u, %u bytes raw, %u packed (%.1f%%)\n", name.c_str(), w, h, (unsigned) bytes.size(), (unsigned) packed.size(), 100.0 * packed.size() / bytes.size());
+	printf("fill + pixel at a time  %u lit pixels, %.0f bytes, %.1f ms at %.0f MHz\n", setBits, oldBytes, oldBytes * 8 / (SPI_MHZ * 1000), SPI_MHZ);
+	printf("every pixel at a time   %.0f bytes, %.1f ms\n", opaqueBytes, opaqueBytes * 8 / (SPI_MHZ * 1000));
+	printf("bands                   %u steps of up to %u pixels, %.0f bytes, %.1f ms, longest step %.2f ms\n", steps, BOOTSPLASH_BAND, newBytes, newBytes * 8 / (SPI_MHZ * 1000), (BOOTSPLASH_BAND * 2.0 + WINDOW_BYTES) * 8 / (SPI_MHZ * 1000));
+
+	if (report) {
+		return 0;
+	}
+	if (!Write(out, name, w, h, bytes.size(), packed)) {
+		return 1;
+	}
+	printf("wrote %s\n", out.c_str());
+	return 0;
+}
@@ -0,0 +1,507 @@
+/*
+
+	Program name: Bob Jones Patriot Racing font decoder benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	every glyph checked against ILI9341_t3's own bit walk and a per glyph CRC,
+	                            	a few glyphs checked against what was decoded by hand
+
+	draws every glyph of each of our fonts into a 320 x 240 RGB565 buffer with PatriotRacing_Font and
+	reports glyphs / sec and pixels / sec (glyph bitmap pixels, set or not). before timing it checks
+	the result is pixel exact:
+		every char code the font has is decoded twice, by PatriotRacing_Font and by RefDecode below,
+		a copy of the bit walk in ILI9341_t3's drawFontChar (what the panel really shows), and the
+		metrics and pixels must be the same
+		a CRC of each glyph (code, metrics, pixels) from RefDecode, all of a font's glyph CRCs
+		together must match the golden value below
+		the glyphs in Hand must match what was decoded by hand from the font bytes
+		the CRC of each font's test page must match the golden value below
+		each glyph must match the bitmap in the font's .eff file (the font generator's output) when there is one
+
+	the glyph golden values come from RefDecode, not the decoder being tested, and were checked
+	against a separate decode of the raw font arrays (not this code). if you change the decoder on
+	purpose only the page CRCs can move, rerun with -g to print new golden values and paste them in
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/FontBench.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp PatriotRacing_Fonts/Arial_100BINO.cpp PatriotRacing_Fonts/Arial_100_BINO.cpp PatriotRacing_Fonts/Arial_48BINO.cpp PatriotRacing_Fonts/Arial_48_BINO.cpp -o FontBench
+
+	FontBench [-g] [font folder, default PatriotRacing_Fonts]
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "PatriotRacing_Font.h"
+#include "Arial_100BINO.h"
+#include "Arial_100_BINO.h"
+#include "Arial_48BINO.h"
+#include "Arial_48_BINO.h"
+
+#define SCREEN_W 320
+#define SCREEN_H 240
+#define BENCH_MS 500
+#define TEXT_COLOR 0xFFE0     // yellow on black, like the race screen
+
+struct BenchFont {
+	const char *Name;
+	const ILI9341_t3_font_t *Font;
+	const char *EFF;          // .eff from the font generator, NULL if we don't have it
+	uint32_t Golden;          // CRC of the test page
+	uint32_t GlyphGolden;     // CRC of every glyph's CRC, in code order
+};
+
+static BenchFont Fonts[] = {
+	{"Arial_100BINO", &Arial_100BINO, NULL, 0x2B8706B9, 0x232BAC01},
+	{"Arial_100_BINO", &Arial_100_BINO, "Arial_100_BINO.eff", 0xA085A389, 0x975DC142},
+	{"Arial_48BINO", &Arial_48BINO, NULL, 0xD8593C6D, 0xE870DC0D},
+	{"Arial_48_BINO", &Arial_48_BINO, "Arial_48_BINO.eff", 0x51014EB6, 0x09973A2F},
+};
+
+/*
+	decoded by hand. Arial_100_BINO '-' starts at data[0]:
+		0x0A 0x09 0x2A 0x8E 0xA0 0x3F 0xFF 0xFF 0xFF 0xFE
+		000 encoding 0, 0101000 width 40, 0010010 height 18, 0101 xoffset 5, 010100 yoffset 20,
+		0111010 delta 58, 1 000 the next row twice, 0000 then 36 ones
+	the rest of the rows of that one and the others were read off the same way (a script over the
+	arrays in the font .cpp), all of them are the italic bar they should be: every row is Run set
+	pixels from Start[row], the rest clear
+*/
+static const uint8_t Slant100[18] = {4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0};
+static const uint8_t Slant48[9] = {2, 2, 1, 1, 1, 1, 1, 0, 0};
+
+struct HandGlyph {
+	const ILI9341_t3_font_t *Font;
+	uint16_t Code;
+	uint8_t Width;
+	uint8_t Height;
+	int8_t XOffset;
+	int8_t YOffset;
+	uint8_t Delta;
+	uint8_t Run;
+	const uint8_t *Start;
+};
+
+static const HandGlyph Hand[] = {
+	{&Arial_100BINO, '-', 40, 18, 2, 14, 47, 36, Slant100},
+	{&Arial_100BINO, '.', 22, 18, 3, -23, 35, 18, Slant100},
+	{&Arial_100_BINO, '-', 40, 18, 5, 20, 58, 36, Slant100},
+	{&Arial_100_BINO, '.', 22, 18, 3, -18, 33, 18, Slant100},
+	{&Arial_48BINO, '-', 19, 9, 0, 6, 23, 17, Slant48},
+	{&Arial_48BINO, '.', 11, 9, 1, -6, 19, 9, Slant48},
+	{&Arial_48_BINO, '-', 19, 9, 0, 11, 19, 17, Slant48},
+	{&Arial_48_BINO, '.', 11, 9, 0, -1, 16, 9, Slant48},
+};
+
+// a glyph as metrics and one byte a pixel, 1 = set
+struct BenchGlyph {
+	int32_t Width;
+	int32_t Height;
+	int32_t XOffset;
+	int32_t YOffset;
+	int32_t Delta;
+	std::vector<uint8_t> Pixels;
+};
+
+static uint16_t Screen[SCREEN_W * SCREEN_H];
+
+static uint32_t CRC32(const uint8_t *Data, uint32_t Length) {
+
+	uint32_t crc = 0xFFFFFFFF;
+	uint32_t i;
+	uint8_t b;
+
+	for (i = 0; i < Length; i++) {
+		crc ^= Data[i];
+		for (b = 0; b < 8; b++) {
+			crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+		}
+	}
+	return ~crc;
+}
+
+// ILI9341_t3's fetchbit / fetchbits_unsigned / fetchbits_signed
+static uint32_t RefBit(const uint8_t *p, uint32_t Index) {
+	return (p[Index >> 3] & (0x80 >> (Index & 7))) ? 1 : 0;
+}
+
+static uint32_t RefBits(const uint8_t *p, uint32_t Index, uint32_t Required) {
+
+	uint32_t val = 0;
+
+	while (Required--) {
+		val = (val << 1) | RefBit(p, Index++);
+	}
+	return val;
+}
+
+static int32_t RefSigned(const uint8_t *p, uint32_t Index, uint32_t Required) {
+
+	uint32_t val = RefBits(p, Index, Required);
+
+	if (val & (1 << (Required - 1))) {
+		return (int32_t) val - (1 << Required);
+	}
+	return (int32_t) val;
+}
+
+// drawFontChar's walk for version 1 fonts, each row's bits go to drawFontBits for 1 or n rows
+static bool RefDecode(const ILI9341_t3_font_t &Font, uint16_t c, BenchGlyph &G) {
+
+	uint32_t bitoffset, x, y, n, b, xsize, bits, i;
+	const uint8_t *data;
+
+	if ((c >= Font.index1_first) && (c <= Font.index1_last)) {
+		bitoffset = (c - Font.index1_first) * Font.bits_index;
+	}
+	else if ((c >= Font.index2_first) && (c <= Font.index2_last)) {
+		bitoffset = (c - Font.index2_first + Font.index1_last - Font.index1_first + 1) * Font.bits_index;
+	}
+	else {
+		return false;
+	}
+	data = Font.data + RefBits(Font.index, bitoffset, Font.bits_index);
+	if (RefBits(data, 0, 3) != 0) {
+		return false;
+	}
+	G.Width = RefBits(data, 3, Font.bits_width);
+	bitoffset = Font.bits_width + 3;
+	G.Height = RefBits(data, bitoffset, Font.bits_height);
+	bitoffset += Font.bits_height;
+	G.XOffset = RefSigned(data, bitoffset, Font.bits_xoffset);
+	bitoffset += Font.bits_xoffset;
+	G.YOffset = RefSigned(data, bitoffset, Font.bits_yoffset);
+	bitoffset += Font.bits_yoffset;
+	G.Delta = RefBits(data, bitoffset, Font.bits_delta);
+	bitoffset += Font.bits_delta;
+	G.Pixels.assign(G.Width * G.Height, 0);
+
+	y = 0;
+	while (y < (uint32_t) G.Height) {
+		n = 1;
+		b = RefBit(data, bitoffset++);
+		if (b) {
+			n = RefBits(data, bitoffset, 3) + 2;
+			bitoffset += 3;
+		}
+		x = 0;
+		do {
+			xsize = G.Width - x;
+			if (xsize > 32) {
+				xsize = 32;
+			}
+			bits = RefBits(data, bitoffset, xsize);
+			// drawFontBits, msb is the leftmost pixel, clipped to the glyph like the panel clips
+			for (i = 0; i < xsize; i++) {
+				if (bits & (1UL << (xsize - 1 - i))) {
+					for (b = y; (b < y + n) && (b < (uint32_t) G.Height); b++) {
+						G.Pixels[b * G.Width + x + i] = 1;
+					}
+				}
+			}
+			bitoffset += xsize;
+			x += xsize;
+		} while (x < (uint32_t) G.Width);
+		y += n;
+	}
+	return true;
+}
+
+// the same glyph from PatriotRacing_Font
+static bool Decode(const ILI9341_t3_font_t &Font, uint16_t c, BenchGlyph &G) {
+
+	FontGlyph g;
+
+	if (!FontGetGlyph(Font, c, g)) {
+		return false;
+	}
+	G.Width = g.Width;
+	G.Height = g.Height;
+	G.XOffset = g.XOffset;
+	G.YOffset = g.YOffset;
+	G.Delta = g.Delta;
+	G.Pixels.assign(G.Width * G.Height, 0);
+	FontDecode(Font, g, [&](uint16_t x, uint16_t y, uint16_t length, uint16_t rows, uint8_t alpha) {
+		for (uint16_t j = y; j < y + rows; j++) {
+			memset(&G.Pixels[j * G.Width + x], alpha ? 1 : 0, length);
+		}
+	});
+	return true;
+}
+
+static bool SameGlyph(const BenchGlyph &A, const BenchGlyph &B) {
+	return (A.Width == B.Width) && (A.Height == B.Height) && (A.XOffset == B.XOffset) && (A.YOffset == B.YOffset) && (A.Delta == B.Delta) && (A.Pixels == B.Pixels);
+}
+
+// code (u16), width, height, xoffset, yoffset, delta (a byte each), then the pixels
+static uint32_t GlyphCRC(uint16_t c, const BenchGlyph &G) {
+
+	std::vector<uint8_t> bytes(7 + G.Pixels.size());
+
+	bytes[0] = c;
+	bytes[1] = c >> 8;
+	bytes[2] = G.Width;
+	bytes[3] = G.Height;
+	bytes[4] = G.XOffset;
+	bytes[5] = G.YOffset;
+	bytes[6] = G.Delta;
+	memcpy(&bytes[7], G.Pixels.data(), G.Pixels.size());
+	return CRC32(bytes.data(), bytes.size());
+}
+
+// every code 1 - 255 through both decoders, returns the CRC of the glyph CRCs
+// 0 ends a string so it's never drawn, and drawFontChar takes it as in an empty index2 (0 - 0)
+static uint32_t CheckGlyphs(const ILI9341_t3_font_t &Font, int *Bad) {
+
+	BenchGlyph ref, got;
+	std::vector<uint8_t> crcs;
+	uint32_t crc;
+	uint16_t c;
+	uint8_t n;
+	bool hr, hg;
+	int checked = 0;
+
+	*Bad = 0;
+	for (c = 1; c < 256; c++) {
+		hr = RefDecode(Font, c, ref);
+		hg = Decode(Font, c, got);
+		if (hr != hg) {
+			printf("  char %u is %s by ILI9341_t3, %s by ours\n", c, hr ? "there" : "missing", hg ? "there" : "missing");
+			(*Bad)++;
+			continue;
+		}
+		if (!hr) {
+			continue;
+		}
+		checked++;
+		if (!SameGlyph(ref, got)) {
+			printf("  char %u differs from ILI9341_t3's walk\n", c);
+			(*Bad)++;
+		}
+		crc = GlyphCRC(c, ref);
+		for (n = 0; n < 4; n++) {
+			crcs.push_back(crc >> (n * 8));
+		}
+	}
+	printf("  %d glyphs the same as ILI9341_t3's walk, %d differ\n", checked - *Bad, *Bad);
+	return CRC32(crcs.data(), crcs.size());
+}
+
+// the glyphs decoded by hand
+static int CheckHand(const ILI9341_t3_font_t &Font) {
+
+	BenchGlyph ref, got;
+	int checked = 0;
+	int bad = 0;
+	int32_t x, y;
+	size_t i;
+
+	for (i = 0; i < sizeof(Hand) / sizeof(Hand[0]); i++) {
+		const HandGlyph &h = Hand[i];
+
+		if (h.Font != &Font) {
+			continue;
+		}
+		BenchGlyph want = {h.Width, h.Height, h.XOffset, h.YOffset, h.Delta, std::vector<uint8_t>(h.Width * h.Height, 0)};
+		for (y = 0; y < h.Height; y++) {
+			for (x = h.Start[y]; x < h.Start[y] + h.Run; x++) {
+				want.Pixels[y * h.Width + x] = 1;
+			}
+		}
+		checked++;
+		if (!RefDecode(Font, h.Code, ref) || !Decode(Font, h.Code, got) || !SameGlyph(want, ref) || !SameGlyph(want, got)) {
+			printf("  '%c' isn't what was decoded by hand\n", h.Code);
+			bad++;
+		}
+	}
+	printf("  %d glyphs decoded by hand match, %d differ\n", checked - bad, bad);
+	return bad;
+}
+
+static FontCanvas Canvas() {
+
+	FontCanvas c;
+
+	c.Pixels = Screen;
+	c.Width = SCREEN_W;
+	c.Height = SCREEN_H;
+	c.Stride = SCREEN_W;
+	return c;
+}
+
+// every char the font has, in order
+static uint16_t CharSet(const ILI9341_t3_font_t &Font, uint16_t *Codes) {
+
+	FontGlyph g;
+	uint16_t n = 0;
+	uint16_t c;
+
+	for (c = 0; c < 256; c++) {
+		if (FontGetGlyph(Font, c, g)) {
+			Codes[n++] = c;
+		}
+	}
+	return n;
+}
+
+// all the chars, wrapped onto as many lines as fit (it's fine if the big fonts run off the bottom)
+static uint32_t TestPage(const ILI9341_t3_font_t &Font, uint32_t *Pixels) {
+
+	FontCanvas c = Canvas();
+	FontGlyph g;
+	uint16_t codes[256];
+	uint16_t n = CharSet(Font, codes);
+	uint16_t i;
+	int16_t x = 0;
+	int16_t y = 0;
+	uint16_t line = Font.cap_height + Font.line_space + 4;
+
+	memset(Screen, 0, sizeof(Screen));
+	*Pixels = 0;
+	for (i = 0; i < n; i++) {
+		FontGetGlyph(Font, codes[i], g);
+		if (x + g.Delta > SCREEN_W) {
+			x = 0;
+			y += line;
+		}
+		x += FontDrawChar(c, Font, x, y, codes[i], TEXT_COLOR);
+		*Pixels += (uint32_t) g.Width * g.Height;
+	}
+	return n;
+}
+
+// compare each glyph with the generator's bitmap, the .eff is a u32 count then per char
+// i32 width, height, xoffset, yoffset, delta, u16 id, then width x height bytes of 0 / 1
+static int CheckEFF(const ILI9341_t3_font_t &Font, const char *Path) {
+
+	FILE *f = fopen(Path, "rb");
+	uint32_t count, code;
+	int32_t hdr[5];
+	uint16_t id;
+	int checked = 0;
+	int bad = 0;
+	FontGlyph g;
+
+	if (f == NULL) {
+		printf("  can't open %s, skipped\n", Path);
+		return 0;
+	}
+	if (fread(&count, 4, 1, f) != 1) {
+		fclose(f);
+		return 1;
+	}
+
+	for (code = 0; code < count; code++) {
+		if ((fread(hdr, 4, 5, f) != 5) || (fread(&id, 2, 1, f) != 1)) {
+			bad++;
+			break;
+		}
+		std::vector<uint8_t> want(hdr[0] * hdr[1]);
+		std::vector<uint8_t> got(want.size(), 0);
+		if (want.size() && (fread(want.data(), 1, want.size(), f) != want.size())) {
+			bad++;
+			break;
+		}
+		if (!FontGetGlyph(Font, code, g)) {
+			continue;
+		}
+		checked++;
+		if ((g.Width != hdr[0]) || (g.Height != hdr[1])) {
+			printf("  char %u is %u x %u, generator says %d x %d\n", code, g.Width, g.Height, hdr[0], hdr[1]);
+			bad++;
+			continue;
+		}
+		FontDecode(Font, g, [&](uint16_t x, uint16_t y, uint16_t length, uint16_t rows, uint8_t alpha) {
+			for (uint16_t j = y; j < y + rows; j++) {
+				memset(&got[j * g.Width + x], alpha ? 1 : 0, length);
+			}
+		});
+		if (got != want) {
+			printf("  char %u pixels differ from the generator\n", code);
+			bad++;
+		}
+	}
+	fclose(f);
+
+	printf("  %s: %d glyphs match, %d differ\n", Path, checked - bad, bad);
+	return bad;
+}
+
+int main(int argc, char **argv) {
+
+	bool golden = false;
+	const char *folder = "PatriotRacing_Fonts";
+	char path[256];
+	uint32_t pixels, crc, n, glyphs;
+	int bad;
+	uint64_t done, px;
+	double sec;
+	int fail = 0;
+	size_t i;
+	int a;
+
+	for (a = 1; a < argc; a++) {
+		if (strcmp(argv[a], "-g") == 0) {
+			golden = true;
+		}
+		else {
+			folder = argv[a];
+		}
+	}
+
+	for (i = 0; i < sizeof(Fonts) / sizeof(Fonts[0]); i++) {
+		const BenchFont &bf = Fonts[i];
+
+		printf("%s\n", bf.Name);
+
+		crc = CheckGlyphs(*bf.Font, &bad);
+		fail += bad;
+		if (golden) {
+			printf("  glyph golden 0x%08X\n", crc);
+		}
+		else if (crc != bf.GlyphGolden) {
+			printf("  glyph CRC 0x%08X, expected 0x%08X\n", crc, bf.GlyphGolden);
+			fail++;
+		}
+		fail += CheckHand(*bf.Font);
+
+		glyphs = TestPage(*bf.Font, &pixels);
+		crc = CRC32((const uint8_t *) Screen, sizeof(Screen));
+		if (golden) {
+			printf("  golden 0x%08X\n", crc);
+		}
+		else if (crc != bf.Golden) {
+			printf("  test page CRC 0x%08X, expected 0x%08X\n", crc, bf.Golden);
+			fail++;
+		}
+		if (bf.EFF != NULL) {
+			snprintf(path, sizeof(path), "%s/%s", folder, bf.EFF);
+			fail += CheckEFF(*bf.Font, path);
+		}
+
+		done = 0;
+		px = 0;
+		auto start = std::chrono::steady_clock::now();
+		do {
+			for (n = 0; n < 16; n++) {
+				TestPage(*bf.Font, &pixels);
+				done += glyphs;
+				px += pixels;
+			}
+			sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		} while (sec < BENCH_MS / 1000.0);
+
+		printf("  %u glyphs, %.0f glyphs/sec, %.1f Mpixels/sec\n", glyphs, done / sec, px / sec / 1e6);
+	}
+
+	if (fail) {
+		printf("FAILED %d checks\n", fail);
+		return 1;
+	}
+	return 0;
+}
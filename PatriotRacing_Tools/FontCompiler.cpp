@@ -0,0 +1,750 @@
+/*
+
+	Program name: Bob Jones Patriot Racing font compiler
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	constexpr font struct and the FONTTABLE flat glyph table in what it writes
+	1.2    Kris 	10/19/2026	chars the .eff doesn't really have are left out, the default 32-126 works
+	1.3    Kris 	10/19/2026	Name_table.h declares the flat glyph table, Name.h is the plain font again
+
+	turns a font generator .eff file into an ILI9341_t3_font_t table (Name.cpp / Name.h, same layout
+	as the ones in PatriotRacing_Fonts) with only the chars we actually draw, and prints what it will
+	cost in flash. Name_table.h declares the flat glyph table (PatriotRacing_FontTable.h, gnu++14)
+	the .cpp builds when the compiler can, Name.h is only the font so it builds anywhere
+
+	FontCompiler [options] Font.eff
+		-c 45-46,48-58   char codes to keep, ranges and single codes (default 32-126), chars
+		                 the .eff doesn't have are left out
+		-t "0123456789." chars to keep as text, added to -c
+		-n Name          table name (default the .eff name)
+		-o folder        where Name.cpp / Name.h / Name_table.h go (default next to the .eff)
+		-b 1|2|4|8       bits per pixel, 1 is version 1 (what ILI9341_t3 draws), 2 / 4 / 8 are
+		                 version 23 anti aliased (ILI9341_t3n, and our PatriotRacing_Font decoder)
+		-s 2             shrink by this much, the .eff is 1 bit so this is what gives 2+ bpp its
+		                 grey levels (a 100 px .eff with -s 2 -b 4 is a smooth 50 px font)
+		-r               compress repeated rows (version 1 only, it's the only run length coding the
+		                 format has, each repeat is 3 bits for up to 9 rows)
+		-a 78            cap height (default, the lowest glyph bottom in the subset)
+		-l 0             line space (default 0, same as the tables we have)
+		-m               match the old font generator, it never repeats into a glyph's last row,
+		                 costs a few bytes but rebuilds the checked in tables exactly
+		-x               report only, don't write anything
+
+	every glyph is decoded back out of the new table with FontDecode and compared with what went in
+	before anything is written
+
+	to rebuild the tables we have (these come out byte for byte the same as what's checked in)
+	FontCompiler -r -m -a 78 -c 45-46,48-58 PatriotRacing_Fonts/Arial_100_BINO.eff
+	FontCompiler -r -m -a 46 -c 37,43-58 PatriotRacing_Fonts/Arial_48_BINO.eff
+
+	Arial_100BINO / Arial_48BINO have no .eff, and the Arial_100BINO.cpp at the repo root is the old
+	copy of the one in PatriotRacing_Fonts (no flat glyph table), only one of them should end up in a
+	build
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities PatriotRacing_Tools/FontCompiler.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp -o FontCompiler
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <string>
+
+#include "PatriotRacing_Font.h"
+
+#define EFF_CHARS 256
+#define FONT_STRUCT_BYTES 28      // sizeof(ILI9341_t3_font_t) on the Teensy (3 pointers, 14 bytes, padding)
+
+// one char from the .eff, Top is from the top of the line (the .eff yoffset), Pixels are 0 / 1
+struct Source {
+	int32_t Width;
+	int32_t Height;
+	int32_t XOffset;
+	int32_t Top;
+	int32_t Delta;
+	std::vector<uint8_t> Pixels;
+};
+
+// one char ready to pack, Pixels are 0 .. (1 << bpp) - 1
+struct Glyph {
+	bool Used;
+	int32_t Width;
+	int32_t Height;
+	int32_t XOffset;
+	int32_t Top;
+	int32_t Delta;
+	std::vector<uint8_t> Pixels;
+	uint32_t Offset;              // byte offset in the data
+	uint32_t Bytes;
+};
+
+// msb first, like the font decoder reads it
+struct BitWriter {
+
+	std::vector<uint8_t> Data;
+	uint32_t Bit = 0;
+
+	void Put(uint32_t Value, uint8_t Count) {
+
+		int8_t i;
+
+		for (i = Count - 1; i >= 0; i--) {
+			if ((Bit >> 3) >= Data.size()) {
+				Data.push_back(0);
+			}
+			if ((Value >> i) & 1) {
+				Data[Bit >> 3] |= 0x80 >> (Bit & 7);
+			}
+			Bit++;
+		}
+	}
+
+	void Align() {
+		Bit = (Bit + 7) & ~7UL;
+		while ((Bit >> 3) > Data.size()) {
+			Data.push_back(0);
+		}
+	}
+};
+
+static bool ReadEFF(const char *Path, std::vector<Source> &Chars) {
+
+	FILE *f = fopen(Path, "rb");
+	uint32_t count, i;
+	int32_t hdr[5];
+	uint16_t id;
+
+	if (f == NULL) {
+		printf("can't open %s\n", Path);
+		return false;
+	}
+	if ((fread(&count, 4, 1, f) != 1) || (count > EFF_CHARS)) {
+		printf("%s isn't an .eff file\n", Path);
+		fclose(f);
+		return false;
+	}
+	Chars.resize(count);
+	for (i = 0; i < count; i++) {
+		Source &s = Chars[i];
+		if ((fread(hdr, 4, 5, f) != 5) || (fread(&id, 2, 1, f) != 1) || (hdr[0] < 0) || (hdr[1] < 0)) {
+			printf("%s is short at char %u\n", Path, i);
+			fclose(f);
+			return false;
+		}
+		s.Width = hdr[0];
+		s.Height = hdr[1];
+		s.XOffset = hdr[2];
+		s.Top = hdr[3];
+		s.Delta = hdr[4];
+		s.Pixels.resize(s.Width * s.Height);
+		if (s.Pixels.size() && (fread(s.Pixels.data(), 1, s.Pixels.size(), f) != s.Pixels.size())) {
+			printf("%s is short at char %u\n", Path, i);
+			fclose(f);
+			return false;
+		}
+	}
+	fclose(f);
+	return true;
+}
+
+// the font generator writes a blank 1 x 1 (often with a negative advance) for every char it
+// didn't draw, the space is blank too so it counts when it moves the pen
+static bool InEFF(const Source &S, uint16_t Code) {
+
+	bool blank = (S.Width * S.Height <= 1) && ((S.Pixels.size() == 0) || (S.Pixels[0] == 0));
+
+	if (S.Delta <= 0) {
+		return false;
+	}
+	return !blank || (Code == ' ');
+}
+
+// "45-46,48-58" or "37" into the keep list
+static bool ParseRanges(const char *Text, bool *Keep) {
+
+	char *end;
+	long a, b, c;
+
+	while (*Text) {
+		a = strtol(Text, &end, 0);
+		if (end == Text) {
+			return false;
+		}
+		b = a;
+		Text = end;
+		if (*Text == '-') {
+			b = strtol(Text + 1, &end, 0);
+			if (end == Text + 1) {
+				return false;
+			}
+			Text = end;
+		}
+		if ((a < 0) || (b >= EFF_CHARS) || (a > b)) {
+			return false;
+		}
+		for (c = a; c <= b; c++) {
+			Keep[c] = true;
+		}
+		if (*Text == ',') {
+			Text++;
+		}
+	}
+	return true;
+}
+
+// shrink by Scale, each output pixel is how much of its Scale x Scale block was set, in bpp levels
+static void Shrink(const Source &S, int32_t Scale, uint8_t BPP, Glyph &G) {
+
+	int32_t max = (1 << BPP) - 1;
+	int32_t x0, y0, x1, y1, x, y, sx, sy, count;
+
+	if ((S.Width == 0) || (S.Height == 0)) {
+		G.Width = G.Height = 0;
+		G.XOffset = S.XOffset / Scale;
+		G.Top = S.Top / Scale;
+		G.Delta = (S.Delta + Scale / 2) / Scale;
+		return;
+	}
+
+	// the blocks are on the line's grid, not the glyph's, so every glyph shrinks the same way
+	x0 = (S.XOffset >= 0) ? S.XOffset / Scale : -((-S.XOffset + Scale - 1) / Scale);
+	y0 = (S.Top >= 0) ? S.Top / Scale : -((-S.Top + Scale - 1) / Scale);
+	x1 = (S.XOffset + S.Width + Scale - 1 - ((S.XOffset + S.Width < 0) ? Scale - 1 : 0)) / Scale;
+	y1 = (S.Top + S.Height + Scale - 1 - ((S.Top + S.Height < 0) ? Scale - 1 : 0)) / Scale;
+	G.XOffset = x0;
+	G.Top = y0;
+	G.Width = x1 - x0;
+	G.Height = y1 - y0;
+	G.Delta = (S.Delta + Scale / 2) / Scale;
+	G.Pixels.assign(G.Width * G.Height, 0);
+
+	for (y = 0; y < G.Height; y++) {
+		for (x = 0; x < G.Width; x++) {
+			count = 0;
+			for (sy = (y0 + y) * Scale - S.Top; sy < (y0 + y + 1) * Scale - S.Top; sy++) {
+				for (sx = (x0 + x) * Scale - S.XOffset; sx < (x0 + x + 1) * Scale - S.XOffset; sx++) {
+					if ((sx >= 0) && (sx < S.Width) && (sy >= 0) && (sy < S.Height)) {
+						count += S.Pixels[sy * S.Width + sx];
+					}
+				}
+			}
+			G.Pixels[y * G.Width + x] = (count * max + Scale * Scale / 2) / (Scale * Scale);
+		}
+	}
+}
+
+// bits for 0 .. Value
+static uint8_t BitsFor(uint32_t Value) {
+
+	uint8_t bits = 1;
+
+	while ((bits < 32) && (Value >= (1UL << bits))) {
+		bits++;
+	}
+	return bits;
+}
+
+// bits for a two's complement Min .. Max
+static uint8_t SignedBitsFor(int32_t Min, int32_t Max) {
+
+	uint8_t bits = 1;
+
+	while ((Min < -(1L << (bits - 1))) || (Max > (1L << (bits - 1)) - 1)) {
+		bits++;
+	}
+	return bits;
+}
+
+static bool RowsEqual(const Glyph &G, int32_t A, int32_t B) {
+	return memcmp(&G.Pixels[A * G.Width], &G.Pixels[B * G.Width], G.Width) == 0;
+}
+
+struct Table {
+	ILI9341_t3_font_t Font;
+	std::vector<uint8_t> Data;
+	std::vector<uint8_t> Index;
+	uint32_t RowsRepeated;
+};
+
+static void Pack(std::vector<Glyph> &Glyphs, uint16_t First1, uint16_t Last1, uint16_t First2, uint16_t Last2, uint8_t BPP, bool RLE, bool Match, int32_t Cap, int32_t Line, Table &T) {
+
+	BitWriter data, index;
+	int32_t xmin = 0, xmax = 0, ymin = 0, ymax = 0;
+	uint32_t wmax = 0, hmax = 0, dmax = 0;
+	uint8_t bw, bh, bx, by, bd, bi;
+	int32_t y, n, x, yoff;
+	uint16_t c;
+	bool first = true;
+
+	for (c = 0; c < Glyphs.size(); c++) {
+		Glyph &g = Glyphs[c];
+		if (!g.Used) {
+			continue;
+		}
+		yoff = Cap - g.Height - g.Top;
+		if (first || (g.XOffset < xmin)) xmin = g.XOffset;
+		if (first || (g.XOffset > xmax)) xmax = g.XOffset;
+		if (first || (yoff < ymin)) ymin = yoff;
+		if (first || (yoff > ymax)) ymax = yoff;
+		if ((uint32_t) g.Width > wmax) wmax = g.Width;
+		if ((uint32_t) g.Height > hmax) hmax = g.Height;
+		if ((uint32_t) g.Delta > dmax) dmax = g.Delta;
+		first = false;
+	}
+	bw = BitsFor(wmax);
+	bh = BitsFor(hmax);
+	bx = SignedBitsFor(xmin, xmax);
+	by = SignedBitsFor(ymin, ymax);
+	bd = BitsFor(dmax);
+
+	T.RowsRepeated = 0;
+	for (c = 0; c < Glyphs.size(); c++) {
+		Glyph &g = Glyphs[c];
+		if (!g.Used) {
+			continue;
+		}
+		g.Offset = data.Bit >> 3;
+		data.Put(0, 3);
+		data.Put(g.Width, bw);
+		data.Put(g.Height, bh);
+		data.Put((uint32_t) g.XOffset, bx);
+		data.Put((uint32_t) (Cap - g.Height - g.Top), by);
+		data.Put(g.Delta, bd);
+
+		if (BPP == 1) {
+			y = 0;
+			while (y < g.Height) {
+				n = 1;
+				if (RLE) {
+					while ((n < 9) && (y + n < g.Height - (Match ? 1 : 0)) && RowsEqual(g, y, y + n)) {
+						n++;
+					}
+				}
+				if (n > 1) {
+					data.Put(1, 1);
+					data.Put(n - 2, 3);
+					T.RowsRepeated += n - 1;
+				}
+				else {
+					data.Put(0, 1);
+				}
+				for (x = 0; x < g.Width; x++) {
+					data.Put(g.Pixels[y * g.Width + x], 1);
+				}
+				y += n;
+			}
+		}
+		else {
+			data.Align();
+			for (x = 0; x < g.Width * g.Height; x++) {
+				data.Put(g.Pixels[x], BPP);
+			}
+		}
+		data.Align();
+		g.Bytes = (data.Bit >> 3) - g.Offset;
+	}
+
+	// chars inside the ranges we didn't keep point at the next kept glyph and are never drawn
+	bi = BitsFor(data.Data.size());
+	for (c = First1; c <= Last1; c++) {
+		for (n = c; (n < (int32_t) Glyphs.size()) && !Glyphs[n].Used; n++) {
+		}
+		index.Put((n < (int32_t) Glyphs.size()) ? Glyphs[n].Offset : 0, bi);
+	}
+	if (Last2) {
+		for (c = First2; c <= Last2; c++) {
+			for (n = c; (n < (int32_t) Glyphs.size()) && !Glyphs[n].Used; n++) {
+			}
+			index.Put((n < (int32_t) Glyphs.size()) ? Glyphs[n].Offset : 0, bi);
+		}
+	}
+	index.Align();
+
+	T.Data = data.Data;
+	T.Index = index.Data;
+	memset(&T.Font, 0, sizeof(T.Font));
+	T.Font.index = T.Index.data();
+	T.Font.unicode = 0;
+	T.Font.data = T.Data.data();
+	T.Font.version = (BPP == 1) ? 1 : 23;
+	T.Font.reserved = (BPP == 1) ? 0 : BitsFor(BPP) - 1;
+	T.Font.index1_first = First1;
+	T.Font.index1_last = Last1;
+	T.Font.index2_first = First2;
+	T.Font.index2_last = Last2;
+	T.Font.bits_index = bi;
+	T.Font.bits_width = bw;
+	T.Font.bits_height = bh;
+	T.Font.bits_xoffset = bx;
+	T.Font.bits_yoffset = by;
+	T.Font.bits_delta = bd;
+	T.Font.line_space = Line;
+	T.Font.cap_height = Cap;
+}
+
+// decode every kept glyph back out of the table and compare
+static int Verify(const Table &T, const std::vector<Glyph> &Glyphs, uint8_t BPP) {
+
+	FontGlyph g;
+	uint8_t max = (1 << BPP) - 1;
+	int bad = 0;
+	uint16_t c;
+
+	for (c = 0; c < Glyphs.size(); c++) {
+		const Glyph &want = Glyphs[c];
+		if (!want.Used) {
+			continue;
+		}
+		if (!FontGetGlyph(T.Font, c, g) || (g.Width != want.Width) || (g.Height != want.Height) || (g.XOffset != want.XOffset) || (g.Delta != want.Delta) || (FontGlyphTop(T.Font, g) != want.Top)) {
+			printf("char %u header doesn't decode\n", c);
+			bad++;
+			continue;
+		}
+		std::vector<uint8_t> got(want.Pixels.size(), 0);
+		FontDecode(T.Font, g, [&](uint16_t x, uint16_t y, uint16_t length, uint16_t rows, uint8_t alpha) {
+			uint8_t level = (alpha * max + FONT_ALPHA_SOLID / 2) / FONT_ALPHA_SOLID;
+			for (uint16_t j = y; j < y + rows; j++) {
+				memset(&got[j * g.Width + x], level, length);
+			}
+		});
+		if (got != want.Pixels) {
+			printf("char %u pixels don't decode\n", c);
+			bad++;
+		}
+	}
+	return bad;
+}
+
+// Name.cpp / Name.h like the font generator writes them (CRLF, 16 bytes a line)
+static void PutLine(FILE *f, const char *Text) {
+	fputs(Text, f);
+	fputs("\r\n", f);
+}
+
+static void PutArray(FILE *f, const char *Name, const char *Suffix, const std::vector<uint8_t> &Bytes) {
+
+	char line[128];
+	size_t i;
+
+	snprintf(line, sizeof(line), "static const unsigned char %s_%s[] = {", Name, Suffix);
+	PutLine(f, line);
+	for (i = 0; i < Bytes.size(); i++) {
+		if ((i % 16) == 0) {
+			strcpy(line, " ");
+		}
+		// the generator leaves ", " after the last byte of every line but the end
+		snprintf(line + strlen(line), sizeof(line) - strlen(line), " 0x%02X%s", Bytes[i], (i + 1 < Bytes.size()) ? "," : "");
+		if ((i % 16) == 15) {
+			strcat(line, " ");
+		}
+		if (((i % 16) == 15) || (i + 1 == Bytes.size())) {
+			PutLine(f, line);
+		}
+	}
+	PutLine(f, "};");
+	snprintf(line, sizeof(line), "/* Size: %u bytes */", (unsigned) Bytes.size());
+	PutLine(f, line);
+}
+
+static bool Write(const char *Folder, const char *Name, const Table &T) {
+
+	std::string path;
+	char line[128];
+	const ILI9341_t3_font_t &ft = T.Font;
+	unsigned v[] = {ft.version, ft.reserved, ft.index1_first, ft.index1_last, ft.index2_first, ft.index2_last, ft.bits_index, ft.bits_width, ft.bits_height, ft.bits_xoffset, ft.bits_yoffset, ft.bits_delta, ft.line_space, ft.cap_height};
+	size_t i;
+	FILE *f;
+
+	path = std::string(Folder) + "/" + Name + ".cpp";
+	f = fopen(path.c_str(), "wb");
+	if (f == NULL) {
+		printf("can't write %s\n", path.c_str());
+		return false;
+	}
+	snprintf(line, sizeof(line), "#include \"%s.h\"", Name);
+	PutLine(f, line);
+	PutLine(f, "");
+	PutArray(f, Name, "data", T.Data);
+	PutLine(f, "");
+	PutArray(f, Name, "index", T.Index);
+	PutLine(f, "");
+	// constexpr so FONTTABLE can read it at compile time (PatriotRacing_FontTable.h)
+	snprintf(line, sizeof(line), "constexpr ILI9341_t3_font_t %s = {", Name);
+	PutLine(f, line);
+	snprintf(line, sizeof(line), "    %s_index,", Name);
+	PutLine(f, line);
+	PutLine(f, "    0,");
+	snprintf(line, sizeof(line), "    %s_data,", Name);
+	PutLine(f, line);
+	for (i = 0; i < sizeof(v) / sizeof(v[0]); i++) {
+		snprintf(line, sizeof(line), "    %u%s", v[i], (i + 1 < sizeof(v) / sizeof(v[0])) ? "," : "");
+		PutLine(f, line);
+	}
+	PutLine(f, "};");
+	PutLine(f, "");
+	PutLine(f, "// the flat glyph table needs gnu++14, a gnu++11 build still gets the font");
+	PutLine(f, "#if __cplusplus >= 201402L");
+	snprintf(line, sizeof(line), "#include \"%s_table.h\"", Name);
+	PutLine(f, line);
+	snprintf(line, sizeof(line), "FONTTABLE(%s)", Name);
+	PutLine(f, line);
+	PutLine(f, "#endif");
+	fclose(f);
+
+	path = std::string(Folder) + "/" + Name + ".h";
+	f = fopen(path.c_str(), "wb");
+	if (f == NULL) {
+		printf("can't write %s\n", path.c_str());
+		return false;
+	}
+	snprintf(line, sizeof(line), "#ifndef __%s_h__", Name);
+	PutLine(f, line);
+	snprintf(line, sizeof(line), "#define __%s_h__", Name);
+	PutLine(f, line);
+	PutLine(f, "");
+	PutLine(f, "#include <ILI9341_t3.h>");
+	PutLine(f, "");
+	PutLine(f, "#ifdef __cplusplus");
+	PutLine(f, "extern \"C\" {");
+	PutLine(f, "#endif");
+	PutLine(f, "");
+	snprintf(line, sizeof(line), "extern const ILI9341_t3_font_t %s;", Name);
+	PutLine(f, line);
+	PutLine(f, "");
+	PutLine(f, "#ifdef __cplusplus");
+	PutLine(f, "} // extern \"C\"");
+	PutLine(f, "#endif");
+	PutLine(f, "");
+	PutLine(f, "#endif");
+	fclose(f);
+
+	path = std::string(Folder) + "/" + Name + "_table.h";
+	f = fopen(path.c_str(), "wb");
+	if (f == NULL) {
+		printf("can't write %s\n", path.c_str());
+		return false;
+	}
+	snprintf(line, sizeof(line), "#ifndef __%s_table_h__", Name);
+	PutLine(f, line);
+	snprintf(line, sizeof(line), "#define __%s_table_h__", Name);
+	PutLine(f, line);
+	PutLine(f, "");
+	snprintf(line, sizeof(line), "#include \"%s.h\"", Name);
+	PutLine(f, line);
+	PutLine(f, "#include \"PatriotRacing_FontTable.h\"");
+	PutLine(f, "");
+	snprintf(line, sizeof(line), "extern const FontTable %s_table;", Name);
+	PutLine(f, line);
+	PutLine(f, "");
+	PutLine(f, "#endif");
+	fclose(f);
+	return true;
+}
+
+static void Usage() {
+	printf("FontCompiler [-c ranges] [-t chars] [-n name] [-o folder] [-b bpp] [-s scale] [-r] [-m] [-a cap] [-l line] [-x] Font.eff\n");
+}
+
+int main(int argc, char **argv) {
+
+	std::vector<Source> src;
+	std::vector<Glyph> glyphs;
+	bool keep[EFF_CHARS] = {false};
+	bool ranges = false, rle = false, match = false, report = false;
+	const char *eff = NULL, *folder = NULL, *name = NULL;
+	std::string base, dir;
+	int32_t scale = 1, cap = -1, line = 0;
+	uint8_t bpp = 1;
+	uint16_t first, last, first1, last1, first2, last2, c, gapfrom, gapto, prev, best;
+	uint32_t kept, full, total, dropped;
+	Table table, all;
+	int a;
+
+	for (a = 1; a < argc; a++) {
+		if ((strcmp(argv[a], "-c") == 0) && (a + 1 < argc)) {
+			if (!ParseRanges(argv[++a], keep)) {
+				printf("bad range %s\n", argv[a]);
+				return 1;
+			}
+			ranges = true;
+		}
+		else if ((strcmp(argv[a], "-t") == 0) && (a + 1 < argc)) {
+			for (const char *p = argv[++a]; *p; p++) {
+				keep[(uint8_t) *p] = true;
+			}
+			ranges = true;
+		}
+		else if ((strcmp(argv[a], "-n") == 0) && (a + 1 < argc)) {
+			name = argv[++a];
+		}
+		else if ((strcmp(argv[a], "-o") == 0) && (a + 1 < argc)) {
+			folder = argv[++a];
+		}
+		else if ((strcmp(argv[a], "-b") == 0) && (a + 1 < argc)) {
+			bpp = atoi(argv[++a]);
+		}
+		else if ((strcmp(argv[a], "-s") == 0) && (a + 1 < argc)) {
+			scale = atoi(argv[++a]);
+		}
+		else if ((strcmp(argv[a], "-a") == 0) && (a + 1 < argc)) {
+			cap = atoi(argv[++a]);
+		}
+		else if ((strcmp(argv[a], "-l") == 0) && (a + 1 < argc)) {
+			line = atoi(argv[++a]);
+		}
+		else if (strcmp(argv[a], "-r") == 0) {
+			rle = true;
+		}
+		else if (strcmp(argv[a], "-m") == 0) {
+			match = true;
+		}
+		else if (strcmp(argv[a], "-x") == 0) {
+			report = true;
+		}
+		else if (argv[a][0] != '-') {
+			eff = argv[a];
+		}
+		else {
+			Usage();
+			return 1;
+		}
+	}
+	if ((eff == NULL) || ((bpp != 1) && (bpp != 2) && (bpp != 4) && (bpp != 8)) || (scale < 1)) {
+		Usage();
+		return 1;
+	}
+	if (!ranges) {
+		ParseRanges("32-126", keep);
+	}
+	if (rle && (bpp != 1)) {
+		printf("-r only works for 1 bpp (version 23 has no row repeats), ignored\n");
+		rle = false;
+	}
+
+	base = eff;
+	dir = ".";
+	if (base.find_last_of("/\\") != std::string::npos) {
+		dir = base.substr(0, base.find_last_of("/\\"));
+		base = base.substr(base.find_last_of("/\\") + 1);
+	}
+	if (base.find('.') != std::string::npos) {
+		base = base.substr(0, base.find('.'));
+	}
+	if (name == NULL) {
+		name = base.c_str();
+	}
+	if (folder == NULL) {
+		folder = dir.c_str();
+	}
+
+	if (!ReadEFF(eff, src)) {
+		return 1;
+	}
+
+	// chars the .eff doesn't have can't be kept
+	dropped = 0;
+	for (c = 0; c < EFF_CHARS; c++) {
+		if (keep[c] && ((c >= src.size()) || !InEFF(src[c], c))) {
+			keep[c] = false;
+			dropped++;
+		}
+	}
+	if (dropped) {
+		printf("%u of the chars asked for aren't in %s, left out\n", dropped, eff);
+	}
+
+	// shrink / convert everything, the full printable set is packed too for the report
+	glyphs.resize(src.size());
+	for (c = 0; c < src.size(); c++) {
+		Shrink(src[c], scale, bpp, glyphs[c]);
+		glyphs[c].Used = (c >= 32) && (c <= 126) && InEFF(src[c], c);
+	}
+	if (cap < 0) {
+		for (c = 0; c < src.size(); c++) {
+			if (keep[c] && (c < src.size()) && (glyphs[c].Top + glyphs[c].Height > cap)) {
+				cap = glyphs[c].Top + glyphs[c].Height;
+			}
+		}
+	}
+	// a blank space is only its advance, the 1 x 1 the .eff has sits anywhere (up to 25 px above
+	// the line) and can put the y offset out of the 8 bits the decoder has
+	if ((src.size() > ' ') && InEFF(src[' '], ' ') && (glyphs[' '].Width * glyphs[' '].Height <= 1) &&
+		((glyphs[' '].Pixels.size() == 0) || (glyphs[' '].Pixels[0] == 0))) {
+		glyphs[' '].Width = glyphs[' '].Height = 0;
+		glyphs[' '].Pixels.clear();
+		glyphs[' '].XOffset = 0;
+		glyphs[' '].Top = cap;
+	}
+	Pack(glyphs, 32, 126, 0, 0, bpp, rle, match, cap, line, all);
+	full = all.Data.size() + all.Index.size() + FONT_STRUCT_BYTES;
+
+	// the kept codes in two ranges, split at the biggest gap so the fewest index entries are wasted
+	first = EFF_CHARS;
+	last = 0;
+	for (c = 0; c < src.size(); c++) {
+		glyphs[c].Used = keep[c];
+		if (keep[c]) {
+			if (first == EFF_CHARS) {
+				first = c;
+			}
+			last = c;
+		}
+	}
+	if (first == EFF_CHARS) {
+		printf("no chars to keep\n");
+		return 1;
+	}
+	gapfrom = gapto = first;
+	prev = first;
+	best = 0;
+	for (c = first + 1; c <= last; c++) {
+		if (!keep[c]) {
+			continue;
+		}
+		if (c - prev - 1 > best) {
+			best = c - prev - 1;
+			gapfrom = prev;
+			gapto = c;
+		}
+		prev = c;
+	}
+	first1 = first;
+	last1 = best ? gapfrom : last;
+	first2 = best ? gapto : 0;
+	last2 = best ? last : 0;
+	Pack(glyphs, first1, last1, first2, last2, bpp, rle, match, cap, line, table);
+
+	if (Verify(table, glyphs, bpp)) {
+		return 1;
+	}
+
+	// what it costs
+	printf("%s, %u bpp%s%s, cap height %d\n", name, bpp, rle ? ", repeated rows" : "", (scale > 1) ? ", shrunk" : "", cap);
+	printf("  char   size     bytes\n");
+	kept = 0;
+	for (c = 0; c < glyphs.size(); c++) {
+		if (glyphs[c].Used) {
+			printf("  %3u %c  %3d x %-3d %5u\n", c, ((c > 32) && (c < 127)) ? c : ' ', glyphs[c].Width, glyphs[c].Height, glyphs[c].Bytes);
+			kept++;
+		}
+	}
+	total = table.Data.size() + table.Index.size() + FONT_STRUCT_BYTES;
+	printf("  %u chars, data %u + index %u + font %u = %u bytes of flash\n", kept, (unsigned) table.Data.size(), (unsigned) table.Index.size(), FONT_STRUCT_BYTES, total);
+	printf("  all of 32-126 would be %u bytes, the subset saves %u (%.0f%%)\n", full, full - total, 100.0 * (full - total) / full);
+	if (rle) {
+		printf("  %u rows repeated instead of stored\n", table.RowsRepeated);
+	}
+
+	if (report) {
+		return 0;
+	}
+	if (!Write(folder, name, table)) {
+		return 1;
+	}
+	printf("wrote %s/%s.cpp and %s.h\n", folder, name, name);
+	return 0;
+}
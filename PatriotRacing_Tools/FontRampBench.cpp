@@ -0,0 +1,223 @@
+/*
+
+	Program name: Bob Jones Patriot Racing font blend ramp benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	draws a page of text in each of a set of text / background colors with FontDrawString (a
+	FontBlend565 per edge pixel) and with FontRamp (PatriotRacing_FontRamp.h, a ramp lookup per pixel)
+	and reports:
+		check        the two pages are the same pixel for pixel, on a plain background and with
+		             text over a striped one (the blend fallback), for every font
+		draw         glyphs / sec and Mpixels / sec (glyph bitmap pixels, set or not) for the page,
+		             the fill that puts the background back before each page taken out
+		cache        ramp hits and misses with the screen's colors, and with more pairs than
+		             FONTRAMP_ENTRIES so the LRU has to throw some out
+
+	Arial_24_AA4 is a 4 bit font made from Arial_48_BINO.eff for this (our other fonts are 1 bit,
+	they only have the solid level), to rebuild it
+	FontCompiler -s 2 -b 4 -c 37,43-58 -n Arial_24_AA4 PatriotRacing_Fonts/Arial_48_BINO.eff
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/FontRampBench.cpp PatriotRacing_Utilities/PatriotRacing_FontRamp.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp PatriotRacing_Fonts/Arial_24_AA4.cpp PatriotRacing_Fonts/Arial_48_BINO.cpp -o FontRampBench
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "PatriotRacing_Font.h"
+#include "PatriotRacing_FontRamp.h"
+#include "Arial_24_AA4.h"
+#include "Arial_48_BINO.h"
+
+#define SCREEN_W 320
+#define SCREEN_H 240
+#define BENCH_MS 300
+#define STRIPE 0x4208          // grid grey, what the striped background is drawn with
+
+struct BenchFont {
+	const char *Name;
+	const ILI9341_t3_font_t *Font;
+};
+
+static const BenchFont Fonts[] = {
+	{"Arial_24_AA4", &Arial_24_AA4},
+	{"Arial_48_BINO", &Arial_48_BINO},
+};
+
+struct ColorPair {
+	uint16_t Fore;
+	uint16_t Back;
+};
+
+// readouts on both themes, the warning colors and the menu highlight bar
+static const ColorPair Screen[] = {
+	{0xFFFF, 0x0000},
+	{0xFFE0, 0x0000},
+	{0xF800, 0x0000},
+	{0x07E0, 0x0000},
+	{0x0000, 0xFFFF},
+	{0x001F, 0xFFFF},
+	{0xFFFF, 0x001F},
+};
+
+#define PAIRS (sizeof(Screen) / sizeof(Screen[0]))
+
+static uint16_t PixelsA[SCREEN_W * SCREEN_H];
+static uint16_t PixelsB[SCREEN_W * SCREEN_H];
+
+static FontCanvas Canvas(uint16_t *Pixels) {
+
+	FontCanvas c;
+
+	c.Pixels = Pixels;
+	c.Width = SCREEN_W;
+	c.Height = SCREEN_H;
+	c.Stride = SCREEN_W;
+	return c;
+}
+
+static void Fill(uint16_t *Pixels, uint16_t Back, bool Striped) {
+
+	uint32_t i;
+
+	for (i = 0; i < SCREEN_W * SCREEN_H; i++) {
+		Pixels[i] = (Striped && ((i / SCREEN_W) % 8 < 2)) ? STRIPE : Back;
+	}
+}
+
+// every char the font has, over and over down the screen, returns the glyphs drawn
+template <class DrawFunc>
+static uint32_t Page(const ILI9341_t3_font_t &Font, DrawFunc &&Draw) {
+
+	char text[64];
+	FontGlyph g;
+	uint16_t c, n = 0;
+	int16_t y;
+	uint32_t glyphs = 0;
+
+	for (c = 32; c < 127; c++) {
+		if (FontGetGlyph(Font, c, g) && (n < sizeof(text) - 1)) {
+			text[n++] = c;
+		}
+	}
+	text[n] = 0;
+	for (y = 0; y + Font.cap_height <= SCREEN_H; y += Font.cap_height + 4) {
+		Draw(y, text);
+		glyphs += n;
+	}
+	return glyphs;
+}
+
+static int Check(const BenchFont &Bf, FontRamp &Ramps, bool Striped) {
+
+	uint8_t p;
+
+	for (p = 0; p < PAIRS; p++) {
+		Fill(PixelsA, Screen[p].Back, Striped);
+		Fill(PixelsB, Screen[p].Back, Striped);
+		FontCanvas a = Canvas(PixelsA);
+		FontCanvas b = Canvas(PixelsB);
+		Page(*Bf.Font, [&](int16_t Y, const char *Text) {
+			FontDrawString(a, *Bf.Font, 0, Y, Text, Screen[p].Fore);
+			Ramps.DrawString(b, *Bf.Font, 0, Y, Text, Screen[p].Fore, Screen[p].Back);
+		});
+		if (memcmp(PixelsA, PixelsB, sizeof(PixelsA)) != 0) {
+			printf("  %s colors %04X on %04X%s don't match FontDrawString\n", Bf.Name, Screen[p].Fore, Screen[p].Back, Striped ? " striped" : "");
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// seconds per pass of Work, run for at least BENCH_MS
+template <class WorkFunc>
+static double Time(WorkFunc &&Work) {
+
+	uint32_t passes = 0;
+	double sec;
+
+	auto start = std::chrono::steady_clock::now();
+	do {
+		Work(passes++);
+		sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	} while (sec < BENCH_MS / 1000.0);
+	return sec / passes;
+}
+
+int main() {
+
+	FontRamp ramps;
+	uint32_t glyphs, pixels, hits, misses, sum = 0;
+	double fill, draw, drawRamp;
+	int fail = 0;
+	size_t f;
+	uint8_t p;
+
+	for (f = 0; f < sizeof(Fonts) / sizeof(Fonts[0]); f++) {
+		const BenchFont &bf = Fonts[f];
+
+		printf("%s, %u bpp\n", bf.Name, FontBPP(*bf.Font));
+		pixels = 0;
+		fail += Check(bf, ramps, false);
+		fail += Check(bf, ramps, true);
+
+		// the fill that puts the background back is timed on its own and taken out of the draws
+		fill = Time([&](uint32_t Pass) {
+			Fill(PixelsA, Screen[Pass % PAIRS].Back, false);
+		});
+
+		glyphs = Page(*bf.Font, [&](int16_t, const char *Text) {
+			FontGlyph g;
+			for (; *Text; Text++) {
+				FontGetGlyph(*bf.Font, (uint8_t) *Text, g);
+				pixels += (uint32_t) g.Width * g.Height;
+			}
+		});
+		draw = Time([&](uint32_t Pass) {
+			const ColorPair &pair = Screen[Pass % PAIRS];
+			FontCanvas c = Canvas(PixelsA);
+			Fill(PixelsA, pair.Back, false);
+			Page(*bf.Font, [&](int16_t Y, const char *Text) {
+				FontDrawString(c, *bf.Font, 0, Y, Text, pair.Fore);
+			});
+		}) - fill;
+		drawRamp = Time([&](uint32_t Pass) {
+			const ColorPair &pair = Screen[Pass % PAIRS];
+			FontCanvas c = Canvas(PixelsB);
+			Fill(PixelsB, pair.Back, false);
+			Page(*bf.Font, [&](int16_t Y, const char *Text) {
+				ramps.DrawString(c, *bf.Font, 0, Y, Text, pair.Fore, pair.Back);
+			});
+		}) - fill;
+		printf("  FontDrawString %8.0f glyphs/sec %6.1f Mpixels/sec\n", glyphs / draw, pixels / draw / 1e6);
+		printf("  FontRamp       %8.0f glyphs/sec %6.1f Mpixels/sec, %.2fx\n", glyphs / drawRamp, pixels / drawRamp / 1e6, draw / drawRamp);
+		sum += PixelsA[SCREEN_W * 10 + 10] + PixelsB[SCREEN_W * 10 + 10];
+	}
+
+	// the screen's colors fit, twice as many pairs as entries round robin is the worst case
+	ramps.Invalidate();
+	hits = ramps.GetHits();
+	misses = ramps.GetMisses();
+	for (f = 0; f < 1000; f++) {
+		sum += ramps.Get(Screen[f % PAIRS].Fore, Screen[f % PAIRS].Back)[8];
+	}
+	printf("cache  %u screen pairs, %u hits %u misses\n", (unsigned) PAIRS, ramps.GetHits() - hits, ramps.GetMisses() - misses);
+	hits = ramps.GetHits();
+	misses = ramps.GetMisses();
+	for (f = 0; f < 1000; f++) {
+		p = f % (FONTRAMP_ENTRIES * 2);
+		sum += ramps.Get(0xFFFF, p * 0x0841)[8];
+	}
+	printf("cache  %u pairs round robin, %u hits %u misses (%u)\n", FONTRAMP_ENTRIES * 2, ramps.GetHits() - hits, ramps.GetMisses() - misses, sum & 1);
+
+	if (fail) {
+		printf("FAILED %d checks\n", fail);
+		return 1;
+	}
+	return 0;
+}
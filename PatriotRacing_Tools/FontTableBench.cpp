@@ -0,0 +1,162 @@
+/*
+
+	Program name: Bob Jones Patriot Racing flat glyph table benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	compares finding glyphs through the packed index (FontGetGlyph) with the flat tables the compiler
+	builds (FontTableGlyph, PatriotRacing_FontTable.h) for each of our fonts:
+		check        every char code 0 - 255 gives the same answer and the same glyph both ways
+		flash        the packed index against the flat table, on the Teensy
+		lookup       ns per glyph lookup, cycling through the string "25.4 -3:07"
+		draw         glyphs / sec drawing the same string with FontDrawString and FontTableDrawString
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/FontTableBench.cpp PatriotRacing_Utilities/PatriotRacing_FontTable.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp PatriotRacing_Fonts/Arial_100BINO.cpp PatriotRacing_Fonts/Arial_100_BINO.cpp PatriotRacing_Fonts/Arial_48BINO.cpp PatriotRacing_Fonts/Arial_48_BINO.cpp PatriotRacing_Fonts/Arial_24_AA4.cpp -o FontTableBench
+
+	add -DFONTTABLE_PACKED to build it the way a flash starved build would, no flat tables, the
+	checks still have to pass and the two columns should come out the same
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "PatriotRacing_Font.h"
+#include "PatriotRacing_FontTable.h"
+#include "Arial_100BINO_table.h"
+#include "Arial_100_BINO_table.h"
+#include "Arial_48BINO_table.h"
+#include "Arial_48_BINO_table.h"
+#include "Arial_24_AA4_table.h"
+
+#define SCREEN_W 320
+#define SCREEN_H 240
+#define BENCH_MS 300
+#define LOOKUPS 1000000
+#define TARGET_ENTRY 12           // FontTableEntry on the Teensy
+#define TEXT "25.4 -3:07"
+#define TEXT_COLOR 0xFFE0
+
+struct BenchFont {
+	const char *Name;
+	const FontTable *Table;
+};
+
+static const BenchFont Fonts[] = {
+	{"Arial_100BINO", &Arial_100BINO_table},
+	{"Arial_100_BINO", &Arial_100_BINO_table},
+	{"Arial_48BINO", &Arial_48BINO_table},
+	{"Arial_48_BINO", &Arial_48_BINO_table},
+	{"Arial_24_AA4", &Arial_24_AA4_table},
+};
+
+static uint16_t Screen[SCREEN_W * SCREEN_H];
+
+static bool Same(const FontGlyph &A, const FontGlyph &B) {
+	return (A.Data == B.Data) && (A.Bits == B.Bits) && (A.Code == B.Code) && (A.Width == B.Width) && (A.Height == B.Height) &&
+		(A.XOffset == B.XOffset) && (A.YOffset == B.YOffset) && (A.Delta == B.Delta);
+}
+
+static int Check(const BenchFont &Bf) {
+
+	FontGlyph a, b;
+	bool ha, hb;
+	uint16_t c;
+	int bad = 0;
+
+	for (c = 0; c < 256; c++) {
+		memset(&a, 0, sizeof(a));
+		memset(&b, 0, sizeof(b));
+		ha = FontGetGlyph(*Bf.Table->Font, c, a);
+		hb = FontTableGlyph(*Bf.Table, c, b);
+		if ((ha != hb) || (ha && !Same(a, b))) {
+			printf("  char %u differs from FontGetGlyph\n", c);
+			bad++;
+		}
+	}
+	return bad;
+}
+
+// the smallest bits wide index entry count that reaches the last code, what the font generator writes
+static uint32_t IndexBytes(const ILI9341_t3_font_t &Font) {
+
+	uint32_t codes = Font.index1_last - Font.index1_first + 1;
+
+	if (Font.index2_last > 0) {
+		codes += Font.index2_last - Font.index2_first + 1;
+	}
+	return (codes * Font.bits_index + 7) / 8;
+}
+
+// seconds per pass of Work, run for at least BENCH_MS
+template <class WorkFunc>
+static double Time(WorkFunc &&Work) {
+
+	uint32_t passes = 0;
+	double sec;
+
+	auto start = std::chrono::steady_clock::now();
+	do {
+		Work();
+		passes++;
+		sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	} while (sec < BENCH_MS / 1000.0);
+	return sec / passes;
+}
+
+int main() {
+
+	FontCanvas canvas = {Screen, SCREEN_W, SCREEN_H, SCREEN_W};
+	const char *text = TEXT;
+	uint32_t n, sum = 0;
+	double packed, flat;
+	int fail = 0;
+	size_t f;
+
+	printf("flat tables %s\n", (Arial_100_BINO_table.Glyph != NULL) ? "built" : "left out (FONTTABLE_PACKED)");
+
+	for (f = 0; f < sizeof(Fonts) / sizeof(Fonts[0]); f++) {
+		const BenchFont &bf = Fonts[f];
+		const ILI9341_t3_font_t &font = *bf.Table->Font;
+
+		printf("%s\n", bf.Name);
+		fail += Check(bf);
+		printf("  flash  index %u bytes, flat table %u bytes (%u codes)\n", IndexBytes(font), FontTableCount(font) * TARGET_ENTRY, FontTableCount(font));
+
+		packed = Time([&]() {
+			FontGlyph g;
+			for (n = 0; n < LOOKUPS; n++) {
+				FontGetGlyph(font, (uint8_t) text[n % (sizeof(TEXT) - 1)], g);
+				sum += g.Delta;
+			}
+		}) / LOOKUPS;
+		flat = Time([&]() {
+			FontGlyph g;
+			for (n = 0; n < LOOKUPS; n++) {
+				FontTableGlyph(*bf.Table, (uint8_t) text[n % (sizeof(TEXT) - 1)], g);
+				sum += g.Delta;
+			}
+		}) / LOOKUPS;
+		printf("  lookup FontGetGlyph %.1f ns, FontTableGlyph %.1f ns, %.1fx\n", packed * 1e9, flat * 1e9, packed / flat);
+
+		packed = Time([&]() {
+			FontDrawString(canvas, font, 0, 0, TEXT, TEXT_COLOR);
+		});
+		flat = Time([&]() {
+			FontTableDrawString(canvas, *bf.Table, 0, 0, TEXT, TEXT_COLOR);
+		});
+		printf("  draw   FontDrawString %.0f glyphs/sec, FontTableDrawString %.0f glyphs/sec, %.2fx\n",
+			(sizeof(TEXT) - 1) / packed, (sizeof(TEXT) - 1) / flat, packed / flat);
+	}
+	printf("(%u)\n", (sum + Screen[SCREEN_W * 20 + 20]) & 1);
+
+	if (fail) {
+		printf("FAILED %d checks\n", fail);
+		return 1;
+	}
+	return 0;
+}
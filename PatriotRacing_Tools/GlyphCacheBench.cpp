@@ -0,0 +1,186 @@
+/*
+
+	Program name: Bob Jones Patriot Racing glyph cache benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	the digit set of every font has to fit in GLYPHCACHE_WORDS
+
+	times redrawing the big data readout (Arial_100_BINO at DATA_Y) two ways into a mock display
+	(MockDisplay.h):
+		decode    bit walk the font for every pixel of the cell and push it, what drawFontChar does
+		          with an opaque background (setTextColor(fore, back))
+		cache     GlyphCache, pre decoded runs pushed with writeRect
+	both must produce the same pixels, then it prints us per readout, the speedup and the cache size
+
+	first it caches the readout chars, - . 0-9 :, of every font in PatriotRacing_Fonts
+	and prints the run words each needs, every one has to fit in GLYPHCACHE_WORDS
+
+	on the car, time GlyphCache::DrawString against tft.print with micros() around the DATA_Y redraw
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/GlyphCacheBench.cpp PatriotRacing_Utilities/PatriotRacing_GlyphCache.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp PatriotRacing_Fonts/Arial_100BINO.cpp PatriotRacing_Fonts/Arial_100_BINO.cpp PatriotRacing_Fonts/Arial_48BINO.cpp PatriotRacing_Fonts/Arial_48_BINO.cpp PatriotRacing_Fonts/Arial_24_AA4.cpp PatriotRacing_Fonts/Arial_16_AA4.cpp -o GlyphCacheBench
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "PatriotRacing_GlyphCache.h"
+#include "Arial_100BINO.h"
+#include "Arial_100_BINO.h"
+#include "Arial_48BINO.h"
+#include "Arial_48_BINO.h"
+#include "Arial_24_AA4.h"
+#include "Arial_16_AA4.h"
+#include "MockDisplay.h"
+
+#define DATA_Y 55             // same as PatriotRacing_Utilities.h
+#define FORE 0xFFFF
+#define BACK 0x0010           // dark theme background
+#define BENCH_MS 500
+
+static MockDisplay Decoded;
+static MockDisplay Cached;
+static GlyphCache Cache;
+
+struct SizeFont {
+	const char *Name;
+	const ILI9341_t3_font_t *Font;
+};
+
+static const SizeFont Fonts[] = {
+	{"Arial_100BINO", &Arial_100BINO},
+	{"Arial_100_BINO", &Arial_100_BINO},
+	{"Arial_48BINO", &Arial_48BINO},
+	{"Arial_48_BINO", &Arial_48_BINO},
+	{"Arial_24_AA4", &Arial_24_AA4},
+	{"Arial_16_AA4", &Arial_16_AA4},
+};
+
+// the old way, every pixel of the cell comes from the font bits (rows above and below the glyph
+// are background), same loop as drawFontChar's opaque path
+static int16_t DecodeString(MockDisplay &D, int16_t X, int16_t Y, const char *Text, int16_t Height) {
+
+	const ILI9341_t3_font_t &font = Arial_100_BINO;
+	FontGlyph g;
+	uint32_t bit;
+	int16_t top, y, x, i, repeat, left;
+
+	for (; *Text; Text++) {
+		if (!FontGetGlyph(font, (uint8_t) *Text, g)) {
+			continue;
+		}
+		top = FontGlyphTop(font, g);
+		left = g.XOffset;
+		D.setAddrWindow(X, Y, g.Delta, Height);
+
+		for (y = 0; y < top; y++) {
+			for (x = 0; x < g.Delta; x++) {
+				D.pushColor(BACK);
+			}
+		}
+
+		bit = g.Bits;
+		y = 0;
+		while (y < g.Height) {
+			repeat = 1;
+			if (FontFetchBit(g.Data, bit++)) {
+				repeat = FontFetchBits(g.Data, bit, 3) + 2;
+				bit += 3;
+			}
+			for (i = 0; i < repeat; i++) {
+				for (x = 0; x < g.Delta; x++) {
+					if ((x >= left) && (x < left + g.Width) && FontFetchBit(g.Data, bit + x - left)) {
+						D.pushColor(FORE);
+					}
+					else {
+						D.pushColor(BACK);
+					}
+				}
+			}
+			bit += g.Width;
+			y += repeat;
+		}
+
+		for (y = top + g.Height; y < Height; y++) {
+			for (x = 0; x < g.Delta; x++) {
+				D.pushColor(BACK);
+			}
+		}
+		X += g.Delta;
+	}
+	return X;
+}
+
+int main() {
+
+	const char *readout[] = {"23.4", "23.5", "-8.88", "12:34", "100.0", "0.00"};
+	const size_t count = sizeof(readout) / sizeof(readout[0]);
+	uint32_t n, reps;
+	size_t i;
+	double decode, cache;
+	int fail = 0;
+
+	for (i = 0; i < sizeof(Fonts) / sizeof(Fonts[0]); i++) {
+		if (Cache.Begin(*Fonts[i].Font, "-.0123456789:", FORE, BACK)) {
+			printf("%-16s %5u words of %u\n", Fonts[i].Name, Cache.GetBytes() / 2, GLYPHCACHE_WORDS);
+		}
+		else {
+			printf("%-16s doesn't fit in %u words\n", Fonts[i].Name, GLYPHCACHE_WORDS);
+			fail++;
+		}
+	}
+	printf("%u bytes a cache (runs %u, band %u)\n", (unsigned) sizeof(GlyphCache), GLYPHCACHE_WORDS * 2, GLYPHCACHE_BAND * 2);
+
+	if (!Cache.Begin(Arial_100_BINO, "-.0123456789:", FORE, BACK)) {
+		printf("cache full\n");
+		return 1;
+	}
+	printf("cache %u bytes, cell height %d\n", Cache.GetBytes(), Cache.GetHeight());
+
+	// same pixels both ways
+	for (i = 0; i < count; i++) {
+		memset(Decoded.Pixels, 0, sizeof(Decoded.Pixels));
+		memset(Cached.Pixels, 0, sizeof(Cached.Pixels));
+		DecodeString(Decoded, 0, DATA_Y, readout[i], Cache.GetHeight());
+		Cache.DrawString(Cached, 0, DATA_Y, readout[i]);
+		if (memcmp(Decoded.Pixels, Cached.Pixels, sizeof(Decoded.Pixels)) != 0) {
+			printf("\"%s\" differs\n", readout[i]);
+			fail++;
+		}
+	}
+
+	auto time = [&](bool UseCache) {
+		reps = 0;
+		auto start = std::chrono::steady_clock::now();
+		double sec;
+		do {
+			for (n = 0; n < 64; n++) {
+				for (i = 0; i < count; i++) {
+					if (UseCache) {
+						Cache.DrawString(Cached, 0, DATA_Y, readout[i]);
+					}
+					else {
+						DecodeString(Decoded, 0, DATA_Y, readout[i], Cache.GetHeight());
+					}
+				}
+				reps += count;
+			}
+			sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		} while (sec < BENCH_MS / 1000.0);
+		return sec * 1e6 / reps;
+	};
+
+	Decoded.Reset();
+	Cached.Reset();
+	decode = time(false);
+	printf("decode  %.2f us per readout, %.1f windows, %.0f pixels\n", decode, (double) Decoded.Windows / reps, (double) Decoded.Pushed / reps);
+	cache = time(true);
+	printf("cache   %.2f us per readout, %.1f windows, %.0f pixels\n", cache, (double) Cached.Windows / reps, (double) Cached.Pushed / reps);
+	printf("speedup %.1fx\n", decode / cache);
+
+	return fail ? 1 : 0;
+}
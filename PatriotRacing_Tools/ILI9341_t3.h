@@ -0,0 +1,68 @@
+/*
+
+	Program name: Bob Jones Patriot Racing PC tools
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	PC stand in for the ILI9341_t3 library header, just the font structs (its own and the Adafruit
+	GFXfont one it also takes) so the font tables in PatriotRacing_Fonts, Adafruit_fonts.h and the
+	font code in PatriotRacing_Utilities compile in the PC tools (build the tools with
+	-IPatriotRacing_Tools), the layout must match the library
+
+*/
+
+#ifndef _ILI9341_t3H_
+#define _ILI9341_t3H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef PROGMEM
+ #define PROGMEM
+#endif
+
+typedef struct {
+	const unsigned char *index;
+	const unsigned char *unicode;
+	const unsigned char *data;
+	unsigned char version;
+	unsigned char reserved;
+	unsigned char index1_first;
+	unsigned char index1_last;
+	unsigned char index2_first;
+	unsigned char index2_last;
+	unsigned char bits_index;
+	unsigned char bits_width;
+	unsigned char bits_height;
+	unsigned char bits_xoffset;
+	unsigned char bits_yoffset;
+	unsigned char bits_delta;
+	unsigned char line_space;
+	unsigned char cap_height;
+} ILI9341_t3_font_t;
+
+#ifndef _GFXFONT_H_
+#define _GFXFONT_H_
+
+typedef struct {
+	uint16_t bitmapOffset;
+	uint8_t width;
+	uint8_t height;
+	uint8_t xAdvance;
+	int8_t xOffset;
+	int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+	uint8_t *bitmap;
+	GFXglyph *glyph;
+	uint16_t first;
+	uint16_t last;
+	uint8_t yAdvance;
+} GFXfont;
+
+#endif
+
+#endif
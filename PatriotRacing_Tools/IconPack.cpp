@@ -0,0 +1,426 @@
+/*
+
+	Program name: Bob Jones Patriot Racing icon packer
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	reads the raw RGB565 icon headers (the const uint16_t name [] PROGMEM = { ... } arrays image2cpp
+	makes) and writes PackedIcon tables (PatriotRacing_IconPack.h) for them, then prints raw vs
+	packed flash for each one
+
+	IconPack [-o PatriotRacing_Utilities/PatriotRacing_PackedIcons.h] [-n name,name] [-t] [-x] Icons.h ...
+		-o file          where the tables go (default PatriotRacing_Utilities/PatriotRacing_PackedIcons.h,
+		                 PatriotRacing_Utilities/PatriotRacing_ThemeIcons.h with -t)
+		-n names         only these arrays (default every uint16_t array in the files)
+		-t               theme icons, every pixel goes through the palette so ThemeIconDraw can swap
+		                 it for a theme LUT (PatriotRacing_Theme.h). icons with more than 256 colors
+		                 get the rare ones moved to the nearest palette color, the report shows the
+		                 worst channel error. the table for graph_icon565 is graph_icon_theme
+		-x               report only, don't write anything
+
+	the size comes from the image2cpp comment next to the array ("// 'Car', 32x32px"), or the
+	square root when there isn't one. icons that come out bigger packed are left out. each packed
+	icon is decoded back with IconReader and compared before anything is written. the table for
+	graph_icon565 is graph_icon_packed
+
+	to remake the checked in tables
+	IconPack PatriotRacing_Utilities/PatriotRacing_Icons.h PatriotRacing_Utilities/GPUSA_Icons.h
+	IconPack -t PatriotRacing_Utilities/PatriotRacing_Icons.h PatriotRacing_Utilities/GPUSA_Icons.h
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Utilities PatriotRacing_Tools/IconPack.cpp PatriotRacing_Utilities/PatriotRacing_IconPack.cpp -o IconPack
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "PatriotRacing_IconPack.h"
+
+#define MIN_PALETTE_USES 3        // a palette entry costs 2 bytes, it has to save at least that
+#define MAX_PALETTE 256
+#define PACKED_ICON_BYTES 20      // sizeof(PackedIcon) on the Teensy
+
+struct Icon {
+	std::string Name;
+	std::string Packed;
+	uint16_t Width;
+	uint16_t Height;
+	std::vector<uint16_t> Pixels;
+	std::vector<uint16_t> Palette;
+	std::vector<uint8_t> Data;
+	uint8_t Error;                // worst channel error from -t moving colors
+};
+
+static bool Theme = false;
+
+// every "const uint16_t name [] PROGMEM = {" array in the file
+static bool ReadIcons(const char *Path, std::vector<Icon> &Icons) {
+
+	FILE *f = fopen(Path, "rb");
+	std::string text, dims;
+	size_t at, open, close, name0, name1, c;
+	const char *p;
+	char *end;
+	int w, h;
+
+	if (f == NULL) {
+		printf("can't open %s\n", Path);
+		return false;
+	}
+	for (int ch; (ch = fgetc(f)) != EOF; ) {
+		text += (char) ch;
+	}
+	fclose(f);
+
+	at = 0;
+	while ((at = text.find("const uint16_t", at)) != std::string::npos) {
+		name0 = text.find_first_not_of(" \t", at + 14);
+		name1 = text.find_first_of(" \t[", name0);
+		open = text.find('{', name1);
+		close = text.find('}', open);
+		if ((name0 == std::string::npos) || (open == std::string::npos) || (close == std::string::npos)) {
+			break;
+		}
+
+		Icon icon;
+		icon.Name = text.substr(name0, name1 - name0);
+		for (p = text.c_str() + open + 1; p < text.c_str() + close; ) {
+			if ((p[0] == '0') && ((p[1] == 'x') || (p[1] == 'X'))) {
+				icon.Pixels.push_back((uint16_t) strtoul(p, &end, 16));
+				p = end;
+			}
+			else if ((p[0] == '/') && (p[1] == '/')) {
+				while ((p < text.c_str() + close) && (*p != '\n')) {
+					p++;
+				}
+			}
+			else {
+				p++;
+			}
+		}
+
+		// the image2cpp comment is on one of the lines just before the array, or the first line in it
+		icon.Width = icon.Height = 0;
+		c = (at > 200) ? at - 200 : 0;
+		dims = text.substr(c, open + 200 - c);
+		for (c = 0; (c = dims.find("px", c)) != std::string::npos; c++) {
+			size_t x = dims.rfind('x', c - 1);
+			size_t s = dims.find_last_not_of("0123456789", x - 1);
+			if ((x == std::string::npos) || (s == std::string::npos)) {
+				continue;
+			}
+			w = atoi(dims.c_str() + s + 1);
+			h = atoi(dims.c_str() + x + 1);
+			if ((w > 0) && (h > 0) && ((size_t) (w * h) == icon.Pixels.size())) {
+				icon.Width = w;
+				icon.Height = h;
+			}
+		}
+		if (icon.Width == 0) {
+			w = (int) sqrt((double) icon.Pixels.size());
+			if ((size_t) (w * w) != icon.Pixels.size()) {
+				printf("%s: %u pixels and no size comment, skipped\n", icon.Name.c_str(), (unsigned) icon.Pixels.size());
+				at = close;
+				continue;
+			}
+			icon.Width = icon.Height = w;
+		}
+
+		icon.Packed = icon.Name;
+		if ((icon.Packed.size() > 3) && (icon.Packed.compare(icon.Packed.size() - 3, 3, "565") == 0)) {
+			icon.Packed.resize(icon.Packed.size() - 3);
+		}
+		icon.Packed += "_packed";
+		Icons.push_back(icon);
+		at = close;
+	}
+	return true;
+}
+
+// how many pixels from At are the same color, up to ICONPACK_MAX_COUNT
+static uint32_t RunLength(const std::vector<uint16_t> &Pixels, uint32_t At) {
+
+	uint32_t n = 1;
+
+	while ((At + n < Pixels.size()) && (n < ICONPACK_MAX_COUNT) && (Pixels[At + n] == Pixels[At])) {
+		n++;
+	}
+	return n;
+}
+
+// channel difference in 565 steps (green halved so all three are out of 31)
+static uint8_t Distance(uint16_t A, uint16_t B) {
+
+	int r = abs((A >> 11) - (B >> 11));
+	int g = abs(((A >> 5) & 0x3F) - ((B >> 5) & 0x3F)) / 2;
+	int b = abs((A & 0x1F) - (B & 0x1F));
+
+	return (uint8_t) std::max(r, std::max(g, b));
+}
+
+// the palette color closest to C, keeps the worst distance in Error
+static uint16_t Nearest(const std::vector<uint16_t> &Palette, uint16_t C, uint8_t &Error) {
+
+	uint16_t best = Palette[0];
+	uint8_t d, least = 255;
+
+	for (uint16_t p : Palette) {
+		d = Distance(p, C);
+		if (d < least) {
+			least = d;
+			best = p;
+		}
+	}
+	Error = std::max(Error, least);
+	return best;
+}
+
+static void Pack(Icon &I) {
+
+	std::map<uint16_t, uint32_t> uses;
+	std::map<uint16_t, uint8_t> index;
+	std::vector<std::pair<uint32_t, uint16_t>> order;
+	uint32_t at, n, j;
+	bool indexed;
+
+	// palette, the most used colors first
+	for (uint16_t c : I.Pixels) {
+		uses[c]++;
+	}
+	for (auto &u : uses) {
+		if (Theme || (u.second >= MIN_PALETTE_USES)) {
+			order.push_back(std::make_pair(u.second, u.first));
+		}
+	}
+	std::sort(order.begin(), order.end(), [](const std::pair<uint32_t, uint16_t> &A, const std::pair<uint32_t, uint16_t> &B) {
+		return (A.first != B.first) ? A.first > B.first : A.second < B.second;
+	});
+	for (j = 0; (j < order.size()) && (j < MAX_PALETTE); j++) {
+		index[order[j].second] = j;
+		I.Palette.push_back(order[j].second);
+	}
+	I.Error = 0;
+	if (Theme) {
+		for (uint16_t &c : I.Pixels) {
+			if (index.count(c) == 0) {
+				c = Nearest(I.Palette, c, I.Error);
+			}
+		}
+	}
+
+	at = 0;
+	while (at < I.Pixels.size()) {
+		n = RunLength(I.Pixels, at);
+		indexed = index.count(I.Pixels[at]) != 0;
+		if (n >= 2) {
+			if (indexed) {
+				I.Data.push_back(ICONPACK_RUN_INDEX | (n - 1));
+				I.Data.push_back(index[I.Pixels[at]]);
+			}
+			else {
+				I.Data.push_back(ICONPACK_RUN_COLOR | (n - 1));
+				I.Data.push_back(I.Pixels[at] & 0xFF);
+				I.Data.push_back(I.Pixels[at] >> 8);
+			}
+			at += n;
+			continue;
+		}
+
+		// single pixels of the same kind until a run starts
+		n = 1;
+		while ((at + n < I.Pixels.size()) && (n < ICONPACK_MAX_COUNT) && (RunLength(I.Pixels, at + n) < 2) && ((index.count(I.Pixels[at + n]) != 0) == indexed)) {
+			n++;
+		}
+		I.Data.push_back((indexed ? ICONPACK_COPY_INDEX : ICONPACK_COPY_COLOR) | (n - 1));
+		for (j = at; j < at + n; j++) {
+			if (indexed) {
+				I.Data.push_back(index[I.Pixels[j]]);
+			}
+			else {
+				I.Data.push_back(I.Pixels[j] & 0xFF);
+				I.Data.push_back(I.Pixels[j] >> 8);
+			}
+		}
+		at += n;
+	}
+}
+
+static bool Verify(const Icon &I) {
+
+	PackedIcon p = {I.Width, I.Height, I.Palette.data(), (uint16_t) I.Palette.size(), I.Data.data(), (uint32_t) I.Data.size()};
+	std::vector<uint16_t> got(I.Pixels.size() + 37);
+	IconReader reader;
+	uint32_t n = 0, k;
+
+	// odd sized reads so the ops get split across calls
+	reader.Begin(p);
+	while ((k = reader.Read(&got[n], 37)) != 0) {
+		n += k;
+		if (n > I.Pixels.size()) {
+			break;
+		}
+	}
+	got.resize(n);
+	return got == I.Pixels;
+}
+
+static void PutLine(FILE *f, const std::string &Text) {
+	fputs(Text.c_str(), f);
+	fputs("\r\n", f);
+}
+
+static bool Write(const char *Path, const std::vector<Icon> &Icons) {
+
+	FILE *f = fopen(Path, "wb");
+	char buf[128];
+	std::string line;
+	size_t i;
+
+	if (f == NULL) {
+		printf("can't write %s\n", Path);
+		return false;
+	}
+	PutLine(f, "/*");
+	PutLine(f, "");
+	PutLine(f, Theme ? "\tProgram name: Bob Jones Patriot Racing theme icons" : "\tProgram name: Bob Jones Patriot Racing packed icons");
+	PutLine(f, "");
+	PutLine(f, "\tmade by PatriotRacing_Tools/IconPack from PatriotRacing_Icons.h and GPUSA_Icons.h, don't edit,");
+	PutLine(f, "\tchange the raw icon and run it again");
+	PutLine(f, "");
+	PutLine(f, "*/");
+	PutLine(f, "");
+	PutLine(f, Theme ? "#ifndef PATRIOT_RACING_THEMEICONS_H" : "#ifndef PATRIOT_RACING_PACKEDICONS_H");
+	PutLine(f, Theme ? "#define PATRIOT_RACING_THEMEICONS_H" : "#define PATRIOT_RACING_PACKEDICONS_H");
+	PutLine(f, "");
+	PutLine(f, "#include \"PatriotRacing_IconPack.h\"");
+	PutLine(f, "");
+	PutLine(f, "#ifndef PROGMEM");
+	PutLine(f, " #define PROGMEM");
+	PutLine(f, "#endif");
+
+	for (const Icon &I : Icons) {
+		PutLine(f, "");
+		snprintf(buf, sizeof(buf), "// %s, %ux%upx, %u colors, %u bytes (raw %u)", I.Name.c_str(), I.Width, I.Height, (unsigned) I.Palette.size(), (unsigned) (I.Data.size() + I.Palette.size() * 2), (unsigned) (I.Pixels.size() * 2));
+		PutLine(f, buf);
+		snprintf(buf, sizeof(buf), "static const uint16_t %s_palette [] PROGMEM = {", I.Packed.c_str());
+		PutLine(f, buf);
+		line = "\t";
+		for (i = 0; i < I.Palette.size(); i++) {
+			snprintf(buf, sizeof(buf), "0x%04x%s", I.Palette[i], (i + 1 < I.Palette.size()) ? ", " : "");
+			line += buf;
+			if (((i % 16) == 15) || (i + 1 == I.Palette.size())) {
+				PutLine(f, line);
+				line = "\t";
+			}
+		}
+		PutLine(f, "};");
+		snprintf(buf, sizeof(buf), "static const uint8_t %s_data [] PROGMEM = {", I.Packed.c_str());
+		PutLine(f, buf);
+		line = "\t";
+		for (i = 0; i < I.Data.size(); i++) {
+			snprintf(buf, sizeof(buf), "0x%02x%s", I.Data[i], (i + 1 < I.Data.size()) ? ", " : "");
+			line += buf;
+			if (((i % 24) == 23) || (i + 1 == I.Data.size())) {
+				PutLine(f, line);
+				line = "\t";
+			}
+		}
+		PutLine(f, "};");
+		snprintf(buf, sizeof(buf), "const PackedIcon %s = {%u, %u, %s_palette, %u, %s_data, %u};", I.Packed.c_str(), I.Width, I.Height, I.Packed.c_str(), (unsigned) I.Palette.size(), I.Packed.c_str(), (unsigned) I.Data.size());
+		PutLine(f, buf);
+	}
+	PutLine(f, "");
+	PutLine(f, "#endif");
+	fclose(f);
+	return true;
+}
+
+int main(int argc, char **argv) {
+
+	std::vector<Icon> icons, keep;
+	const char *packedOut = "PatriotRacing_Utilities/PatriotRacing_PackedIcons.h";
+	const char *themeOut = "PatriotRacing_Utilities/PatriotRacing_ThemeIcons.h";
+	const char *out = packedOut;
+	std::string names;
+	bool report = false;
+	uint32_t raw = 0, packed = 0, bytes;
+	int a;
+
+	for (a = 1; a < argc; a++) {
+		if ((strcmp(argv[a], "-o") == 0) && (a + 1 < argc)) {
+			out = argv[++a];
+		}
+		else if ((strcmp(argv[a], "-n") == 0) && (a + 1 < argc)) {
+			names = std::string(",") + argv[++a] + ",";
+		}
+		else if (strcmp(argv[a], "-x") == 0) {
+			report = true;
+		}
+		else if (strcmp(argv[a], "-t") == 0) {
+			Theme = true;
+			if (out == packedOut) {
+				out = themeOut;
+			}
+		}
+		else if (argv[a][0] != '-') {
+			if (!ReadIcons(argv[a], icons)) {
+				return 1;
+			}
+		}
+		else {
+			printf("IconPack [-o out.h] [-n name,name] [-t] [-x] Icons.h ...\n");
+			return 1;
+		}
+	}
+
+	printf("icon                     size      colors    raw   packed\n");
+	for (Icon &i : icons) {
+		if (!names.empty() && (names.find("," + i.Name + ",") == std::string::npos)) {
+			continue;
+		}
+		if (Theme) {
+			i.Packed.replace(i.Packed.size() - 7, 7, "_theme");
+		}
+		if (i.Width > ICONPACK_BAND) {
+			printf("%s is wider than ICONPACK_BAND, skipped\n", i.Name.c_str());
+			continue;
+		}
+		Pack(i);
+		if (!Verify(i)) {
+			printf("%s doesn't decode back\n", i.Name.c_str());
+			return 1;
+		}
+		bytes = i.Data.size() + i.Palette.size() * 2 + PACKED_ICON_BYTES;
+		printf("%-24s %3ux%-3u   %4u   %6u   %6u  %3.0f%%\n", i.Name.c_str(), i.Width, i.Height, (unsigned) i.Palette.size(), (unsigned) i.Pixels.size() * 2, bytes, 100.0 * bytes / (i.Pixels.size() * 2));
+		if (i.Error) {
+			printf("  colors moved, worst channel error %u\n", i.Error);
+		}
+		if (bytes >= i.Pixels.size() * 2) {
+			// too noisy to pack, leave it raw
+			printf("  bigger packed, left out\n");
+			continue;
+		}
+		raw += i.Pixels.size() * 2;
+		packed += bytes;
+		keep.push_back(i);
+	}
+	printf("total raw %u bytes, packed %u bytes, saves %u (%.0f%%)\n", raw, packed, raw - packed, raw ? 100.0 * (raw - packed) / raw : 0.0);
+
+	if (report || keep.empty()) {
+		return 0;
+	}
+	if (!Write(out, keep)) {
+		return 1;
+	}
+	printf("wrote %s\n", out);
+	return 0;
+}
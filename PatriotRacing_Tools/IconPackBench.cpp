@@ -0,0 +1,111 @@
+/*
+
+	Program name: Bob Jones Patriot Racing packed icon benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	draws every packed icon (PatriotRacing_PackedIcons.h) and its raw RGB565 array into a mock
+	display (MockDisplay.h) and checks they come out the same, then prints per icon
+		flash     raw bytes vs packed (data + palette + struct)
+		decode    CPU us per draw on this PC, raw is one writeRect, packed decodes bands into writeRect
+		bus       bytes over SPI per draw, and what that is at SPI_HZ
+	on the car the bus time is what counts, the decode only has to keep up with it (time IconDraw
+	against writeRect with micros() around the menu icons to see that)
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities PatriotRacing_Tools/IconPackBench.cpp PatriotRacing_Utilities/PatriotRacing_IconPack.cpp -o IconPackBench
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include <ILI9341_t3.h>
+#include "PatriotRacing_Icons.h"
+#include "GPUSA_Icons.h"
+#include "PatriotRacing_PackedIcons.h"
+#include "MockDisplay.h"
+
+#define SPI_HZ 30000000.0     // display SPI clock
+#define BENCH_MS 200
+
+struct BenchIcon {
+	const char *Name;
+	const uint16_t *Raw;
+	const PackedIcon *Packed;
+};
+
+static const BenchIcon Icons[] = {
+	{"graph_icon565", graph_icon565, &graph_icon_packed},
+	{"cyborg_icon565", cyborg_icon565, &cyborg_icon_packed},
+	{"race_icon565", race_icon565, &race_icon_packed},
+	{"car_icon565", car_icon565, &car_icon_packed},
+	{"transceiver_icon565", transceiver_icon565, &transceiver_icon_packed},
+	{"calibrate_icon565", calibrate_icon565, &calibrate_icon_packed},
+	{"GForce_icon565", GForce_icon565, &GForce_icon_packed},
+	{"SSD_icon565", SSD_icon565, &SSD_icon_packed},
+	{"clock_icon565", clock_icon565, &clock_icon_packed},
+	{"GPUSA_Logo", GPUSA_Logo, &GPUSA_Logo_packed},
+};
+
+static MockDisplay Raw;
+static MockDisplay Packed;
+
+// us per call of Draw, run for BENCH_MS
+template <class DrawFunc>
+static double Time(DrawFunc &&Draw) {
+
+	uint32_t reps = 0;
+	double sec;
+
+	auto start = std::chrono::steady_clock::now();
+	do {
+		for (int i = 0; i < 64; i++) {
+			Draw();
+		}
+		reps += 64;
+		sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	} while (sec < BENCH_MS / 1000.0);
+	return sec * 1e6 / reps;
+}
+
+int main() {
+
+	uint32_t raw, packed, rawtotal = 0, packedtotal = 0, rawbus, packedbus;
+	double rawus, packedus;
+	int fail = 0;
+	size_t i;
+
+	printf("icon                    flash raw  packed    decode raw  packed    bus bytes raw  packed   (us at SPI)\n");
+	for (i = 0; i < sizeof(Icons) / sizeof(Icons[0]); i++) {
+		const BenchIcon &b = Icons[i];
+		const PackedIcon &p = *b.Packed;
+
+		Raw.Clear(0x1234);
+		Packed.Clear(0x1234);
+		Raw.writeRect(4, 4, p.Width, p.Height, b.Raw);
+		IconDraw(Packed, 4, 4, p);
+		if (memcmp(Raw.Pixels, Packed.Pixels, sizeof(Raw.Pixels)) != 0) {
+			printf("%s differs\n", b.Name);
+			fail++;
+			continue;
+		}
+		rawbus = Raw.Bytes();
+		packedbus = Packed.Bytes();
+
+		rawus = Time([&]() { Raw.writeRect(4, 4, p.Width, p.Height, b.Raw); });
+		packedus = Time([&]() { IconDraw(Packed, 4, 4, p); });
+
+		raw = (uint32_t) p.Width * p.Height * sizeof(uint16_t);
+		packed = IconPackBytes(p);
+		rawtotal += raw;
+		packedtotal += packed;
+		printf("%-22s %7u %7u    %7.2f %7.2f    %10u %7u   (%.0f / %.0f)\n", b.Name, raw, packed, rawus, packedus, rawbus, packedbus, rawbus * 8 / SPI_HZ * 1e6, packedbus * 8 / SPI_HZ * 1e6);
+	}
+	printf("flash %u bytes raw, %u packed (%.0f%% saved)\n", rawtotal, packedtotal, 100.0 * (rawtotal - packedtotal) / rawtotal);
+
+	return fail ? 1 : 0;
+}
@@ -0,0 +1,238 @@
+/*
+
+	Program name: Bob Jones Patriot Racing lap ticker benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	the clock in Arial_16_AA4, the 24 px one was a thousand bytes a second on its
+	                            	own, fails over the budget
+
+	a 10 minute race (laps of about a minute) through the panel emulator (PanelEmulator.h), the race
+	clock and the lap list refreshed every second two ways:
+		repaint      the way the screens did it, the clock box and the lap list filled and
+		             everything in them drawn again every second
+		ticker       the clock a NumberField (only the digits that changed) and the lap list a
+		             LapTicker (PatriotRacing_LapTicker.h), a lap is one card and a scroll
+	and prints the SPI bytes of a second without a new lap, a second with one, and the average.
+	after every second the two panels must show the same pixels (Shown, so the scroll counts), and
+	the ticker's average has to stay inside BUDGET_BYTES a second
+
+	the clock is Arial_16_AA4, a NumberField cell of it is about 400 bytes so a quiet second is about
+	one of those (Arial_24_AA4 was twice that). to rebuild the font
+	FontCompiler -s 3 -b 4 -c 48-58 -n Arial_16_AA4 PatriotRacing_Fonts/Arial_48_BINO.eff
+
+	runs the race screens (rotation 1 and 3, the ticker beside the clock, cards are columns) and
+	portrait (rotation 0 and 2, the ticker under the clock, cards are rows)
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/LapTickerBench.cpp PatriotRacing_Utilities/PatriotRacing_LapTicker.cpp PatriotRacing_Utilities/PatriotRacing_NumberField.cpp PatriotRacing_Utilities/PatriotRacing_GlyphCache.cpp PatriotRacing_Utilities/PatriotRacing_TextRun.cpp PatriotRacing_Utilities/PatriotRacing_TextMetrics.cpp PatriotRacing_Utilities/PatriotRacing_FontTable.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp PatriotRacing_Fonts/Arial_16_AA4.cpp -o LapTickerBench
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "PanelEmulator.h"
+#include "PatriotRacing_LapTicker.h"
+#include "PatriotRacing_NumberField.h"
+#include "PatriotRacing_TextRun.h"
+#include "Adafruit_fonts.h"
+#include "Arial_16_AA4.h"
+
+#define RACE_SECONDS 600
+#define MAX_LAPS 32
+#define FORE 0xFFFF
+#define BACK 0x0010
+#define MARGIN 4
+#define BUDGET_BYTES 700          // a second of the clock and the ticker, laps included
+
+// where things go, along the scroll (x in landscape, y in portrait)
+struct Layout {
+	uint8_t Rotation;
+	int16_t Clock;             // the clock box is 0 to Clock - 1
+	int16_t Cell;
+};
+
+static const Layout Layouts[] = {
+	{1, 104, 72},
+	{3, 104, 72},
+	{0, 40, 40},
+	{2, 40, 40}
+};
+
+static PanelEmulator Repaint;
+static PanelEmulator Ticker;
+static GlyphCache Cache;
+static TextRun Run;
+static float LapTime[MAX_LAPS];
+static uint16_t Laps;
+static int Overflow = 0;
+
+// a lap's card in the box X, Y, W, H, always the same boxes so a card covers the one before it
+static void DrawCard(PanelEmulator &D, int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Lap) {
+
+	char lap[8], time[16];
+	int16_t h12 = Run.Height(&arial12), w, w2;
+
+	snprintf(lap, sizeof(lap), "L%u", Lap + 1);
+	snprintf(time, sizeof(time), "%d:%04.1f", (int) (LapTime[Lap] / 60), LapTime[Lap] - 60 * (int) (LapTime[Lap] / 60));
+	if (H > W) {
+		// a column
+		w = Run.Draw(D, X + MARGIN, Y + MARGIN, &arial12, lap, FORE, BACK, W - 2 * MARGIN);
+		w2 = Run.Draw(D, X + MARGIN, Y + MARGIN + h12, &arial10, time, FORE, BACK, W - 2 * MARGIN);
+	}
+	else {
+		w = 40 + Run.Draw(D, X + MARGIN, Y + (H - h12) / 2, &arial12, lap, FORE, BACK, 40);
+		w2 = 40 + Run.Draw(D, X + MARGIN + 40, Y + (H - h12) / 2, &arial12, time, FORE, BACK, W - 2 * MARGIN - 40);
+	}
+	if (w2 > w) {
+		w = w2;
+	}
+
+	// wider than its box it runs into the next cell in the panel's memory
+	if (w > W - 2 * MARGIN) {
+		if (Overflow++ < 5) {
+			printf("  card %s %s is %d wide, the box is %d\n", lap, time, w, W - 2 * MARGIN);
+		}
+	}
+}
+
+// the clock and every card showing, from scratch
+static void RepaintSecond(const Layout &L, const char *Clock) {
+
+	int16_t cells = (320 - L.Clock) / L.Cell, c, at;
+	bool columns = L.Rotation & 1;
+
+	if (columns) {
+		Repaint.fillRect(0, 0, L.Clock, Repaint.height(), BACK);
+		Cache.DrawString(Repaint, MARGIN, MARGIN, Clock);
+		Repaint.fillRect(L.Clock, 0, cells * L.Cell, Repaint.height(), BACK);
+	}
+	else {
+		Repaint.fillRect(0, 0, Repaint.width(), L.Clock, BACK);
+		Cache.DrawString(Repaint, MARGIN, MARGIN, Clock);
+		Repaint.fillRect(0, L.Clock, Repaint.width(), cells * L.Cell, BACK);
+	}
+
+	// newest last
+	for (c = 0; c < cells; c++) {
+		if (Laps + c < cells) {
+			continue;
+		}
+		at = L.Clock + c * L.Cell;
+		if (columns) {
+			DrawCard(Repaint, at, 0, L.Cell, Repaint.height(), Laps - cells + c);
+		}
+		else {
+			DrawCard(Repaint, 0, at, Repaint.width(), L.Cell, Laps - cells + c);
+		}
+	}
+}
+
+static int RunRace(const Layout &L) {
+
+	LapTicker ticker;
+	NumberField clock;
+	PanelFrame f;
+	char text[8];
+	float next;
+	uint32_t t, x, y, quiet = 0, laps = 0, quietBytes = 0, lapBytes = 0, repaintBytes = 0, worst = 0;
+	uint16_t done;
+	bool pushed;
+	int bad = 0;
+
+	Repaint.setRotation(L.Rotation);
+	Ticker.setRotation(L.Rotation);
+	Repaint.setScrollArea(0, 0);
+	Repaint.setScroll(0);
+	Repaint.fillScreen(BACK);
+	Ticker.fillScreen(BACK);
+	ticker.Begin(Ticker, L.Clock, 320, L.Cell, BACK);
+	clock.Begin(Cache, MARGIN, MARGIN, NUMBERFIELD_LEFT);
+
+	// about a minute a lap
+	srand(L.Rotation + 1);
+	for (Laps = 0; Laps < MAX_LAPS; Laps++) {
+		LapTime[Laps] = 55.0f + (rand() % 120) * 0.1f;
+	}
+	Laps = 0;
+	next = LapTime[0];
+
+	for (t = 1; t <= RACE_SECONDS; t++) {
+		snprintf(text, sizeof(text), "%02u:%02u", t / 60, t % 60);
+		done = Laps;
+		while ((next <= t) && (Laps < MAX_LAPS - 1)) {
+			Laps++;
+			next += LapTime[Laps];
+		}
+
+		Repaint.StartFrame();
+		RepaintSecond(L, text);
+		repaintBytes += Repaint.EndFrame().Bytes;
+
+		Ticker.StartFrame();
+		clock.Print(Ticker, text);
+		pushed = (done < Laps);
+		for (; done < Laps; done++) {
+			ticker.Push(Ticker, [&](int16_t X, int16_t Y, int16_t W, int16_t H) {
+				DrawCard(Ticker, X, Y, W, H, done);
+			});
+		}
+		f = Ticker.EndFrame();
+		if (f.Bytes > worst) {
+			worst = f.Bytes;
+		}
+		if (pushed) {
+			lapBytes += f.Bytes;
+			laps++;
+		}
+		else {
+			quietBytes += f.Bytes;
+			quiet++;
+		}
+
+		for (y = 0; y < (uint32_t) Ticker.height(); y++) {
+			for (x = 0; x < (uint32_t) Ticker.width(); x++) {
+				if (Ticker.Shown(x, y) != Repaint.Shown(x, y)) {
+					if (bad++ < 5) {
+						printf("  rotation %u, panels differ at %u, %u after %s\n", L.Rotation, x, y, text);
+					}
+					x = Ticker.width();
+					y = Ticker.height();
+				}
+			}
+		}
+	}
+	printf("rotation %u, %u cards of %u, %u seconds, %u laps\n", L.Rotation, ticker.GetCells(), L.Cell, RACE_SECONDS, laps);
+	ticker.End(Ticker);
+
+	printf("  repaint  %8.0f bytes a second\n", (double) repaintBytes / RACE_SECONDS);
+	printf("  ticker   %8.0f bytes a second without a lap, %.0f a second with one, %.0f average, worst %u\n",
+		quiet ? (double) quietBytes / quiet : 0.0, laps ? (double) lapBytes / laps : 0.0,
+		(double) (quietBytes + lapBytes) / RACE_SECONDS, worst);
+	if ((quietBytes + lapBytes) / RACE_SECONDS > BUDGET_BYTES) {
+		printf("  over the budget of %u bytes a second\n", BUDGET_BYTES);
+		bad++;
+	}
+
+	return bad;
+}
+
+int main() {
+
+	size_t i;
+	int fail = 0;
+
+	if (!Cache.Begin(Arial_16_AA4, "0123456789:", FORE, BACK)) {
+		printf("cache full\n");
+		return 1;
+	}
+
+	for (i = 0; i < sizeof(Layouts) / sizeof(Layouts[0]); i++) {
+		fail += RunRace(Layouts[i]);
+	}
+
+	return (fail || Overflow) ? 1 : 0;
+}
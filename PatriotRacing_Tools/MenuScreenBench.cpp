@@ -0,0 +1,158 @@
+/*
+
+	Program name: Bob Jones Patriot Racing menu screen benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	-t render trace
+	1.2    Kris 	10/19/2026	reports the whole MenuScreen's RAM, the row masks are gone
+	1.3    Kris 	10/19/2026	the pages come from SetupPages.h
+
+	presses the buttons through every setup page (SetupPages.h) two ways on the panel
+	emulator (PanelEmulator.h):
+		redraw       clear the screen and draw the whole page for every press, what the menu did
+		layers       MenuScreen, the page once then only the rows a press changed
+	after every press both panels must show the same thing, then it prints the bytes and bus time
+	per press at the normal display clock and at SLOW_MHZ, the clock when the SD card shares the bus,
+	and the CPU time to build the rows
+
+	MenuScreenBench [-t file]
+		-t file          write the render trace (PatriotRacing_RenderTrace.h) of the pages to file
+		                 for AssetFootprint, needs a build with -DRENDER_TRACE
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities PatriotRacing_Tools/MenuScreenBench.cpp PatriotRacing_Utilities/PatriotRacing_MenuScreen.cpp PatriotRacing_Utilities/PatriotRacing_TextMetrics.cpp PatriotRacing_Utilities/PatriotRacing_RenderTrace.cpp -o MenuScreenBench
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "PatriotRacing_MenuScreen.h"
+#include "SetupPages.h"
+#include "Adafruit_fonts.h"
+#include "PanelEmulator.h"
+#include "PatriotRacing_RenderTrace.h"
+
+#define SLOW_MHZ 12.0
+#define BACK 0x0000
+
+static const MenuScreenColors Dark = {BACK, 0xFFFF, 0x001F, 0xFFFF, 0xFFE0, 0x0000, 0x7BEF};
+
+// a walk through a page, down every item changing each a couple of times, then back up
+static const uint8_t Presses[] = {
+	MENUSCREEN_C_BUTTON, MENUSCREEN_C_BUTTON, MENUSCREEN_R_BUTTON, MENUSCREEN_C_BUTTON,
+	MENUSCREEN_R_BUTTON, MENUSCREEN_C_BUTTON, MENUSCREEN_C_BUTTON, MENUSCREEN_R_BUTTON,
+	MENUSCREEN_C_BUTTON, MENUSCREEN_L_BUTTON, MENUSCREEN_L_BUTTON, MENUSCREEN_R_BUTTON
+};
+
+static PanelEmulator Redraw;
+static PanelEmulator Layers;
+static MenuScreen Old;
+static MenuScreen New;
+
+// the same frame's bus time at SLOW_MHZ, the per call overhead doesn't change
+static double Slow(const PanelFrame &Frame) {
+	return Frame.Micros - Frame.Bytes * 8 / PANEL_SPI_MHZ + Frame.Bytes * 8 / SLOW_MHZ;
+}
+
+static bool Same() {
+
+	int16_t x, y;
+
+	for (y = 0; y < Redraw.height(); y++) {
+		for (x = 0; x < Redraw.width(); x++) {
+			if (Redraw.Shown(x, y) != Layers.Shown(x, y)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static FILE *Trace = NULL;
+
+static void TraceLine(const char *Line) {
+	fprintf(Trace, "%s\n", Line);
+}
+
+int main(int argc, char **argv) {
+
+	uint8_t oldChoices[MENUSCREEN_ROWS], newChoices[MENUSCREEN_ROWS];
+	uint8_t p, i;
+	uint32_t presses = 0;
+	double redrawBytes = 0, layerBytes = 0, redrawUs = 0, layerUs = 0, redrawSlow = 0, layerSlow = 0, cpu = 0;
+	PanelFrame f;
+	int bad = 0;
+
+	if ((argc == 3) && (strcmp(argv[1], "-t") == 0)) {
+#ifndef RENDER_TRACE
+		printf("-t needs a build with -DRENDER_TRACE\n");
+		return 1;
+#endif
+		Trace = fopen(argv[2], "w");
+		if (Trace == NULL) {
+			printf("can't write %s\n", argv[2]);
+			return 1;
+		}
+		RENDERTRACE_NAME(arial12);
+		RENDERTRACE_NAME(arialbd14);
+		RenderTraceBegin(TraceLine);
+	}
+	else if (argc != 1) {
+		printf("MenuScreenBench [-t file]\n");
+		return 1;
+	}
+
+	Redraw.setRotation(1);
+	Layers.setRotation(1);
+	Old.Begin(&arial12, &arialbd14, Dark);
+	New.Begin(&arial12, &arialbd14, Dark);
+
+	for (p = 0; p < SETUP_PAGES; p++) {
+		memset(oldChoices, 0, sizeof(oldChoices));
+		memset(newChoices, 0, sizeof(newChoices));
+		Redraw.fillScreen(BACK);
+		Old.Show(Redraw, SetupPages[p], oldChoices, 0);
+		New.Show(Layers, SetupPages[p], newChoices, 0);
+
+		for (i = 0; i < sizeof(Presses); i++, presses++) {
+
+			// the old way, the press changes the settings and everything is drawn again
+			Old.Press(Redraw, Presses[i]);
+			Redraw.StartFrame();
+			Redraw.fillScreen(BACK);
+			Old.Show(Redraw, SetupPages[p], oldChoices, Old.GetItem());
+			f = Redraw.EndFrame();
+			redrawBytes += f.Bytes;
+			redrawUs += f.Micros;
+			redrawSlow += Slow(f);
+
+			Layers.StartFrame();
+			auto start = std::chrono::steady_clock::now();
+			New.Press(Layers, Presses[i]);
+			cpu += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e6;
+			f = Layers.EndFrame();
+			layerBytes += f.Bytes;
+			layerUs += f.Micros;
+			layerSlow += Slow(f);
+
+			if (!Same()) {
+				printf("%s differs after press %u\n", SetupPages[p].Title, i);
+				bad++;
+				break;
+			}
+		}
+	}
+
+	printf("%u presses over %u pages\n", presses, (unsigned) SETUP_PAGES);
+	printf("redraw  %8.0f bytes a press, %6.2f ms at %.0f MHz, %6.2f ms at %.0f MHz\n", redrawBytes / presses, redrawUs / presses / 1000, PANEL_SPI_MHZ, redrawSlow / presses / 1000, SLOW_MHZ);
+	printf("layers  %8.0f bytes a press, %6.2f ms at %.0f MHz, %6.2f ms at %.0f MHz, %.1f us building rows\n", layerBytes / presses, layerUs / presses / 1000, PANEL_SPI_MHZ, layerSlow / presses / 1000, SLOW_MHZ, cpu / presses);
+	printf("%.1fx less on the bus, %u bytes of RAM for the band, %u for the whole MenuScreen\n", redrawBytes / layerBytes, (unsigned) (MENUSCREEN_BAND * sizeof(uint16_t)), (unsigned) sizeof(MenuScreen));
+	if (Trace != NULL) {
+		fclose(Trace);
+	}
+	return bad ? 1 : 0;
+}
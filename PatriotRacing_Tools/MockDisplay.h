@@ -0,0 +1,127 @@
+/*
+
+	Program name: Bob Jones Patriot Racing PC tools
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	just enough of the ILI9341_t3 drawing calls to draw into memory on the PC and count what would
+	have gone over SPI (address windows and pixels), for the display benchmarks
+
+*/
+
+#ifndef PATRIOT_RACING_MOCKDISPLAY_H
+#define PATRIOT_RACING_MOCKDISPLAY_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define MOCK_W 320
+#define MOCK_H 240
+
+struct MockDisplay {
+
+	uint16_t Pixels[MOCK_W * MOCK_H];
+	uint32_t Windows;
+	uint32_t Pushed;
+	uint8_t Rotation;
+
+	// the write position for pushColor
+	uint16_t *Next;
+	int16_t WinW, Col;
+
+	MockDisplay() {
+		Rotation = 1;
+		Clear(0);
+	}
+
+	void Clear(uint16_t Color) {
+
+		uint32_t i;
+
+		for (i = 0; i < MOCK_W * MOCK_H; i++) {
+			Pixels[i] = Color;
+		}
+		Reset();
+	}
+
+	void Reset() {
+		Windows = 0;
+		Pushed = 0;
+	}
+
+	// bytes on the bus, 2 per pixel and ~11 for each address window (CASET, PASET, RAMWR)
+	uint32_t Bytes() const {
+		return Pushed * 2 + Windows * 11;
+	}
+
+	// only remembered, the panel does the turning so what's drawn lands the same
+	void setRotation(uint8_t r) {
+		Rotation = r & 3;
+	}
+
+	void setAddrWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+		(void) h;
+		Windows++;
+		Next = &Pixels[y * MOCK_W + x];
+		WinW = w;
+		Col = 0;
+	}
+
+	void pushColor(uint16_t color) {
+		Pushed++;
+		*Next++ = color;
+		if (++Col == WinW) {
+			Next += MOCK_W - WinW;
+			Col = 0;
+		}
+	}
+
+	void writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors) {
+
+		int16_t j, x0, x1;
+
+		Windows++;
+		Pushed += (uint32_t) w * h;
+		x0 = (x < 0) ? 0 : x;
+		x1 = (x + w > MOCK_W) ? MOCK_W : x + w;
+		if (x1 <= x0) {
+			return;
+		}
+		for (j = 0; j < h; j++) {
+			if ((y + j >= 0) && (y + j < MOCK_H)) {
+				memcpy(&Pixels[(y + j) * MOCK_W + x0], &pcolors[j * w + x0 - x], (x1 - x0) * sizeof(uint16_t));
+			}
+		}
+	}
+
+	void drawPixel(int16_t x, int16_t y, uint16_t color) {
+		fillRect(x, y, 1, 1, color);
+	}
+
+	void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+		fillRect(x, y, w, 1, color);
+	}
+
+	void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+		fillRect(x, y, 1, h, color);
+	}
+
+	void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+
+		int16_t i, j;
+
+		Windows++;
+		Pushed += (uint32_t) w * h;
+		for (j = y; j < y + h; j++) {
+			for (i = x; i < x + w; i++) {
+				if ((i >= 0) && (i < MOCK_W) && (j >= 0) && (j < MOCK_H)) {
+					Pixels[j * MOCK_W + i] = color;
+				}
+			}
+		}
+	}
+};
+
+#endif
@@ -0,0 +1,251 @@
+/*
+
+	Program name: Bob Jones Patriot Racing race monitor task split, PC test harness
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	checks the xml numbers for NaN, negative and out of range floats first
+	1.2    Kris 	10/19/2026	SetCarTag has to work in setup and be refused once the tasks are running
+
+	runs the radio and web tasks from PatriotRacing_MonitorTasks on two threads against a fake UART
+	that fills at the EBYTE baud rate, while a handful of fake browsers hammer the xml endpoint.
+	prints the radio counters at the end, overruns should be 0 and frames should match what was sent.
+	before that a snapshot with floats the encoder can't just cast (NaN, -0.01, 1e20, negative) has
+	to come out as the text below
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -pthread -IPatriotRacing_Utilities PatriotRacing_Tools/MonitorTasksHost.cpp PatriotRacing_Utilities/PatriotRacing_MonitorTasks.cpp PatriotRacing_Utilities/PatriotRacing_Monitor.cpp -o MonitorTasksHost
+
+	MonitorTasksHost [seconds] [browsers] [baud]
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+#include "PatriotRacing_MonitorTasks.h"
+
+#define UART_SIZE 256         // ESP32 HardwareSerial default rx buffer
+#define PACKET_MS 50          // each car sends every 50 ms
+#define TEST_PAYLOAD 40       // same size as the Transceiver struct
+
+// the fake UART, one writer (the radio) one reader (the radio task)
+static uint8_t UART[UART_SIZE];
+static std::atomic<uint32_t> UARTHead(0);
+static std::atomic<uint32_t> UARTTail(0);
+static std::atomic<uint32_t> UARTLost(0);
+static MonitorRadio *Radio = NULL;
+
+static void UARTPut(uint8_t b) {
+
+	uint32_t head = UARTHead.load(std::memory_order_relaxed);
+
+	if (head - UARTTail.load(std::memory_order_acquire) >= UART_SIZE) {
+		// the ESP32 driver would raise UART_BUFFER_FULL_ERROR here
+		UARTLost.fetch_add(1);
+		Radio->Overrun();
+		return;
+	}
+	UART[head % UART_SIZE] = b;
+	UARTHead.store(head + 1, std::memory_order_release);
+}
+
+static uint16_t UARTRead(uint8_t *Buffer, uint16_t Size, uint16_t *Waiting) {
+
+	uint32_t tail = UARTTail.load(std::memory_order_relaxed);
+	uint32_t head = UARTHead.load(std::memory_order_acquire);
+	uint16_t n = 0;
+
+	while ((tail != head) && (n < Size)) {
+		Buffer[n++] = UART[tail % UART_SIZE];
+		tail++;
+	}
+	UARTTail.store(tail, std::memory_order_release);
+	*Waiting = head - tail;
+
+	return n;
+}
+
+// stand in for the Transceiver decode in the sketch, payload is car, sequence, volts
+static bool TestDecode(const uint8_t *Payload, uint8_t Length, MonitorData &Data) {
+
+	uint8_t car = Payload[0];
+	uint32_t seq;
+
+	if ((Length != TEST_PAYLOAD) || (car >= MONITOR_CARS)) {
+		return false;
+	}
+	memcpy(&seq, &Payload[1], sizeof(seq));
+	Data.RaceTime = seq / 20;
+	Data.Car.Volts[car] = 20.0f + (seq % 100) / 10.0f;
+	Data.Car.RPM[car] = seq % 4096;
+	Data.Car.HaveData[car] = 1;
+
+	return true;
+}
+
+static void SendFrame(const uint8_t *Payload, uint8_t Length, uint32_t BaudDelayNs) {
+
+	uint8_t cs = Length;
+	uint8_t i;
+
+	UARTPut(ET_HEADER1);
+	UARTPut(ET_HEADER2);
+	UARTPut(Length);
+	for (i = 0; i < Length; i++) {
+		std::this_thread::sleep_for(std::chrono::nanoseconds(BaudDelayNs));
+		UARTPut(Payload[i]);
+		cs ^= Payload[i];
+	}
+	UARTPut(cs);
+}
+
+static MonitorPublisher Publisher;
+static std::atomic<bool> Browsing(true);
+static std::atomic<uint32_t> Requests(0);
+static std::atomic<uint64_t> BytesServed(0);
+
+// a browser polling xml with whatever boxes it has checked, copies the bytes like a socket send would
+static void Browser(int Id) {
+
+	char local[MONITOR_XML_SIZE];
+	uint16_t ch = (Id & 1) ? MON_CH_ALL : (MON_CH_CORE | MON_CH_VOLTS | MON_CH_LAPTIME);
+	const MonitorSnapshot *snap;
+
+	while (Browsing.load(std::memory_order_relaxed)) {
+		snap = Publisher.Acquire(ch, MON_CARS_ALL);
+		memcpy(local, snap->XML, snap->Length);
+		BytesServed.fetch_add(snap->Length, std::memory_order_relaxed);
+		Publisher.Release(snap);
+		Requests.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+struct NumberCheck {
+	uint8_t Car;
+	float Value;
+	const char *Text;
+};
+
+// lap times (one decimal) the way they have to show up in the xml
+static const NumberCheck Numbers[] = {
+	{0, NAN, "<C0LT>NaN</C0LT>"},
+	{1, -0.01f, "<C1LT>0.0</C1LT>"},
+	{2, 1e20f, "<C2LT>400000000.0</C2LT>"},
+	{3, -62.25f, "<C3LT>-62.3</C3LT>"},
+	{4, 59.96f, "<C4LT>60.0</C4LT>"},
+};
+
+static int CheckNumbers() {
+
+	static MonitorData data;
+	static char xml[MONITOR_XML_SIZE];
+	size_t i;
+	int bad = 0;
+
+	memset(&data, 0, sizeof(data));
+	for (i = 0; i < sizeof(Numbers) / sizeof(Numbers[0]); i++) {
+		data.RM[Numbers[i].Car].LapTime = Numbers[i].Value;
+	}
+	xml[Publisher.Serialize(data, xml, sizeof(xml) - 1)] = 0;
+	for (i = 0; i < sizeof(Numbers) / sizeof(Numbers[0]); i++) {
+		if (!strstr(xml, Numbers[i].Text)) {
+			printf("numbers          %s missing\n", Numbers[i].Text);
+			bad++;
+		}
+	}
+	printf("numbers          %s\n", bad ? "wrong" : "ok");
+	return bad;
+}
+
+int main(int argc, char **argv) {
+
+	int seconds = (argc > 1) ? atoi(argv[1]) : 5;
+	int browsers = (argc > 2) ? atoi(argv[2]) : 4;
+	int baud = (argc > 3) ? atoi(argv[3]) : 9600;
+	uint32_t bytens = 10000000000ULL / baud;     // 10 bits per byte on the wire
+	uint8_t payload[TEST_PAYLOAD];
+	uint32_t sent = 0;
+	uint32_t seq = 0;
+	uint8_t car;
+	int i;
+
+	static MonitorState state;
+	static MonitorRadio radio(state, TestDecode);
+	static MonitorWeb web(state, Publisher);
+	static MonitorTaskConfig config;
+	std::thread *browser[16];
+
+	Radio = &radio;
+	Publisher.Begin(MONITOR_CARS);
+	if (!Publisher.SetCarTag(0, "B") || CheckNumbers()) {
+		return 1;
+	}
+
+	config.Radio = &radio;
+	config.Web = &web;
+	config.Read = UARTRead;
+	config.UARTSize = UART_SIZE;
+	config.Serve = NULL;
+
+	if (browsers > 16) {
+		browsers = 16;
+	}
+
+	MonitorStartTasks(config);
+	for (i = 0; i < browsers; i++) {
+		browser[i] = new std::thread(Browser, i);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	auto next = start;
+	while (std::chrono::steady_clock::now() - start < std::chrono::seconds(seconds)) {
+		// each car in turn, like the repeaters forwarding them
+		for (car = 0; car < MONITOR_CARS; car++) {
+			memset(payload, 0, sizeof(payload));
+			payload[0] = car;
+			memcpy(&payload[1], &seq, sizeof(seq));
+			SendFrame(payload, sizeof(payload), bytens);
+			sent++;
+			seq++;
+		}
+		next += std::chrono::milliseconds(PACKET_MS);
+		std::this_thread::sleep_until(next);
+	}
+
+	// let the radio drain what's left
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	Browsing = false;
+	for (i = 0; i < browsers; i++) {
+		browser[i]->join();
+		delete browser[i];
+	}
+	MonitorStopTasks(config);
+
+	// the web tasks were reading the encoders, too late to rebuild them
+	if (Publisher.SetCarTag(0, "X") || Publisher.Begin(MONITOR_CARS)) {
+		printf("SetCarTag / Begin went through after the tasks started\n");
+		return 1;
+	}
+
+	const MonitorRadioStats &s = radio.GetStats();
+	printf("frames sent      %u\n", sent);
+	printf("frames decoded   %u\n", s.Frames.load());
+	printf("bytes            %u\n", s.Bytes.load());
+	printf("bad checksum     %u\n", s.BadChecksum.load());
+	printf("bad length       %u\n", s.BadLength.load());
+	printf("dropped          %u\n", s.Dropped.load());
+	printf("overruns         %u (bytes lost %u)\n", s.Overruns.load(), UARTLost.load());
+	printf("max backlog      %u of %u\n", s.MaxBacklog.load(), UART_SIZE);
+	printf("state retries    %u\n", state.GetRetries());
+	printf("published        %u\n", web.GetPublished());
+	printf("requests         %u (%.1f MB)\n", Requests.load(), BytesServed.load() / 1e6);
+
+	return ((s.Overruns.load() == 0) && (s.Frames.load() == sent)) ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+/*
+
+	Program name: Bob Jones Patriot Racing numeric readout benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	NaN, infinities and values too big for 32 bits through Format, the speed
+	                            	trace drops out (NaN) every so often
+
+	plays a speed trace (0 -> 35 mph and back, one decimal, some noise) through a NumberField and
+	through the old erase-and-print redraw, left and right justified, and compares the SPI bytes per
+	update. after every update the two screens must match. every DROPOUT updates the sensor is gone
+	for a few (NaN), the field has to show NUMBERFIELD_NAN like the full redraw does
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/NumberFieldBench.cpp PatriotRacing_Utilities/PatriotRacing_NumberField.cpp PatriotRacing_Utilities/PatriotRacing_GlyphCache.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp PatriotRacing_Fonts/Arial_100_BINO.cpp -o NumberFieldBench
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "PatriotRacing_NumberField.h"
+#include "Arial_100_BINO.h"
+#include "MockDisplay.h"
+
+#define DATA_Y 55             // same as PatriotRacing_Utilities.h
+#define FORE 0xFFFF
+#define BACK 0x0010
+#define UPDATES 2000
+#define DROPOUT 250
+
+static MockDisplay Full;
+static MockDisplay Incremental;
+static GlyphCache Cache;
+
+// what the screens did before, clear everything the last value covered and print the new one
+static int16_t FullLeft = 0;
+static int16_t FullRight = 0;
+
+static void FullRedraw(const char *Text, uint8_t Justify, int16_t X) {
+
+	int16_t w = Cache.StringWidth(Text);
+	int16_t left = (Justify == NUMBERFIELD_RIGHT) ? X - w : X;
+
+	if (FullRight > FullLeft) {
+		Full.fillRect(FullLeft, DATA_Y, FullRight - FullLeft, Cache.GetHeight(), BACK);
+	}
+	Cache.DrawString(Full, left, DATA_Y, Text);
+	FullLeft = left;
+	FullRight = left + w;
+}
+
+static int Run(uint8_t Justify) {
+
+	NumberField field;
+	int16_t x = (Justify == NUMBERFIELD_RIGHT) ? MOCK_W - 4 : 4;
+	char text[16];
+	float speed;
+	uint32_t i;
+	int bad = 0;
+
+	Full.Clear(BACK);
+	Incremental.Clear(BACK);
+	FullLeft = FullRight = 0;
+	field.Begin(Cache, x, DATA_Y, Justify);
+	srand(1);
+
+	for (i = 0; i < UPDATES; i++) {
+		// accelerate, cruise, brake, with a little sensor noise
+		speed = 35.0f * sinf(i * 3.14159f / UPDATES) + (rand() % 5 - 2) * 0.1f;
+		if ((i % DROPOUT) < 3) {
+			speed = NAN;
+		}
+		NumberField::Format(speed, 1, text, sizeof(text));
+
+		FullRedraw(text, Justify, x);
+		field.Print(Incremental, text);
+
+		if (memcmp(Full.Pixels, Incremental.Pixels, sizeof(Full.Pixels)) != 0) {
+			if (bad++ < 5) {
+				printf("  screens differ after \"%s\"\n", text);
+			}
+		}
+	}
+
+	printf("%s justified, %u updates\n", (Justify == NUMBERFIELD_RIGHT) ? "right" : "left", UPDATES);
+	printf("  full redraw  %8.0f bytes per update\n", (double) Full.Bytes() / UPDATES);
+	printf("  incremental  %8.0f bytes per update (%.0f%%)\n", (double) Incremental.Bytes() / UPDATES, 100.0 * Incremental.Bytes() / Full.Bytes());
+
+	return bad;
+}
+
+int main() {
+
+	char buf[16];
+	int fail = 0;
+	size_t i;
+
+	// Format has to agree with printf
+	const float values[] = {0.0f, -0.04f, 23.45f, 9.96f, -8.88f, 100.0f, 0.05f, 1234.5f};
+	for (i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+		char want[16];
+		NumberField::Format(values[i], 1, buf, sizeof(buf));
+		snprintf(want, sizeof(want), "%.1f", values[i]);
+		if ((strcmp(buf, want) != 0) && !((strcmp(want, "-0.0") == 0) && (strcmp(buf, "0.0") == 0))) {
+			printf("Format(%g) gave %s, printf %s\n", values[i], buf, want);
+			fail++;
+		}
+	}
+
+	// nothing printf would do, it has to be the dashes or a clamp and not undefined
+	struct {
+		float Value;
+		const char *Want;
+	} odd[] = {{NAN, NUMBERFIELD_NAN}, {-NAN, NUMBERFIELD_NAN}, {INFINITY, "400000000.0"}, {-INFINITY, "-400000000.0"}, {1e20f, "400000000.0"}};
+	for (i = 0; i < sizeof(odd) / sizeof(odd[0]); i++) {
+		NumberField::Format(odd[i].Value, 1, buf, sizeof(buf));
+		if (strcmp(buf, odd[i].Want) != 0) {
+			printf("Format(%g) gave %s, want %s\n", odd[i].Value, buf, odd[i].Want);
+			fail++;
+		}
+	}
+
+	if (!Cache.Begin(Arial_100_BINO, "-.0123456789:", FORE, BACK)) {
+		printf("cache full\n");
+		return 1;
+	}
+
+	fail += Run(NUMBERFIELD_LEFT);
+	fail += Run(NUMBERFIELD_RIGHT);
+
+	return fail ? 1 : 0;
+}
@@ -0,0 +1,191 @@
+/*
+
+	Program name: Bob Jones Patriot Racing orientation benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	draws the same test screen (background, bars, a grid, 64x64 blits and some single pixels) into a
+	320x240 RGB565 canvas in both orientations two ways:
+		generic      the orientation checked at run time and every pixel moved through it, the way a
+		             software rotated canvas (Adafruit GFXcanvas16 and friends) does it
+		oriented     OrientedCanvas<ORIENTATION_BELOW> / <ORIENTATION_ABOVE> (PatriotRacing_Orientation.h)
+	both must come out the same, then it prints us per screen. on the PC Below's rows are a memcpy the
+	compiler does with SIMD and Above's are a reversed copy it doesn't, so Above comes out slower there,
+	on the Teensy both are a plain word at a time copy. the last line draws through
+	OrientedDisplay into a mock panel (MockDisplay.h) both ways round to show the bus traffic doesn't
+	change with the orientation, the panel does the flip
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities PatriotRacing_Tools/OrientationBench.cpp -o OrientationBench
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "PatriotRacing_Orientation.h"
+#include "MockDisplay.h"
+
+#define CANVAS_W 320
+#define CANVAS_H 240
+#define BLIT 64
+#define BENCH_MS 200
+
+static const char *Names[] = {"Below", "Above"};
+
+static uint16_t Generic[CANVAS_W * CANVAS_H];
+static uint16_t Oriented[CANVAS_W * CANVAS_H];
+static uint16_t Blit[BLIT * BLIT];
+
+// the run time version, one switch and a bounds check per pixel
+struct GenericCanvas {
+
+	uint16_t *Pixels;
+	uint8_t Orientation;
+
+	void drawPixel(int16_t X, int16_t Y, uint16_t Color) {
+
+		int16_t x, y;
+
+		if ((X < 0) || (Y < 0) || (X >= CANVAS_W) || (Y >= CANVAS_H)) {
+			return;
+		}
+		switch (Orientation) {
+		case ORIENTATION_ABOVE:
+			x = CANVAS_W - 1 - X;
+			y = CANVAS_H - 1 - Y;
+			break;
+		default:
+			x = X;
+			y = Y;
+			break;
+		}
+		Pixels[y * CANVAS_W + x] = Color;
+	}
+
+	void writeRect(int16_t X, int16_t Y, int16_t W, int16_t H, const uint16_t *Colors) {
+
+		int16_t i, j;
+
+		for (j = 0; j < H; j++) {
+			for (i = 0; i < W; i++) {
+				drawPixel(X + i, Y + j, Colors[j * W + i]);
+			}
+		}
+	}
+
+	void fillRect(int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Color) {
+
+		int16_t i, j;
+
+		for (j = 0; j < H; j++) {
+			for (i = 0; i < W; i++) {
+				drawPixel(X + i, Y + j, Color);
+			}
+		}
+	}
+
+	void drawFastHLine(int16_t X, int16_t Y, int16_t W, uint16_t Color) {
+		fillRect(X, Y, W, 1, Color);
+	}
+
+	void drawFastVLine(int16_t X, int16_t Y, int16_t H, uint16_t Color) {
+		fillRect(X, Y, 1, H, Color);
+	}
+};
+
+// us per call of Draw, run for BENCH_MS
+template <class DrawFunc>
+static double Time(DrawFunc &&Draw) {
+
+	uint32_t reps = 0;
+	double sec;
+
+	auto start = std::chrono::steady_clock::now();
+	do {
+		Draw();
+		reps++;
+		sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	} while (sec * 1000 < BENCH_MS);
+	return sec * 1e6 / reps;
+}
+
+// something like the race screen, partly off the right edge so clipping gets used
+template <class Screen>
+static void DrawScreen(Screen &S) {
+
+	int16_t i;
+
+	S.fillRect(0, 0, CANVAS_W, CANVAS_H, 0x0000);
+	for (i = 0; i < 5; i++) {
+		S.fillRect(10 + i * 60, 20, 40, 100 - i * 15, 0x07E0 + i);
+	}
+	for (i = 0; i < 8; i++) {
+		S.drawFastHLine(45, 210 - i * 20, 255, 0x4208);
+		S.drawFastVLine(45 + i * 32, 50, 160, 0x4208);
+	}
+	for (i = 0; i < 6; i++) {
+		S.writeRect(i * 56, 150, BLIT, BLIT, Blit);
+	}
+	for (i = 0; i < 200; i++) {
+		S.drawPixel((i * 37) % CANVAS_W, (i * 53) % CANVAS_H, 0xF800);
+	}
+}
+
+int main() {
+
+	FontCanvas canvas = {Oriented, CANVAS_W, CANVAS_H, CANVAS_W};
+	GenericCanvas generic = {Generic, ORIENTATION_BELOW};
+	static MockDisplay panel;
+	uint32_t bytes[2];
+	double slow, fast;
+	uint8_t o;
+	uint32_t i;
+	int bad = 0;
+
+	for (i = 0; i < BLIT * BLIT; i++) {
+		Blit[i] = (uint16_t) (i * 2654435761u >> 16);
+	}
+
+	printf("orientation   generic us   oriented us   speedup\n");
+	for (o = ORIENTATION_BELOW; o <= ORIENTATION_ABOVE; o++) {
+		generic.Orientation = o;
+		memset(Generic, 0xAA, sizeof(Generic));
+		memset(Oriented, 0x55, sizeof(Oriented));
+		DrawScreen(generic);
+		OrientationSelect(o, [&](auto Flip) {
+			OrientedCanvas<decltype(Flip)::value> screen(canvas);
+			DrawScreen(screen);
+		});
+		if (memcmp(Generic, Oriented, sizeof(Generic)) != 0) {
+			printf("%s differs\n", Names[o]);
+			bad++;
+			continue;
+		}
+
+		slow = Time([&]() { DrawScreen(generic); });
+		OrientationSelect(o, [&](auto Flip) {
+			OrientedCanvas<decltype(Flip)::value> screen(canvas);
+			fast = Time([&]() { DrawScreen(screen); });
+		});
+		printf("%-12s %11.2f %13.2f   %5.1fx\n", Names[o], slow, fast, slow / fast);
+	}
+
+	for (o = ORIENTATION_BELOW; o <= ORIENTATION_ABOVE; o++) {
+		panel.Reset();
+		OrientationSelect(o, [&](auto Flip) {
+			OrientedDisplay<MockDisplay, decltype(Flip)::value> screen(panel);
+			screen.Begin();
+			DrawScreen(screen);
+		});
+		bytes[o] = panel.Bytes();
+	}
+	printf("panel bus bytes per screen, Below %u, Above %u (setRotation %u / %u)\n", bytes[0], bytes[1], OrientationRotation(ORIENTATION_BELOW), OrientationRotation(ORIENTATION_ABOVE));
+	if (bytes[0] != bytes[1]) {
+		bad++;
+	}
+	return bad ? 1 : 0;
+}
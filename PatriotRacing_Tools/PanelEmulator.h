@@ -0,0 +1,505 @@
+/*
+
+	Program name: Bob Jones Patriot Racing PC tools
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	getRotation, for code that has to know which way the scroll runs
+
+	an ILI9341 on the PC for screen budgets. MockDisplay only counts windows and pixels, this one takes
+	the drawing calls apart into the commands ILI9341_t3 sends (CASET, PASET, RAMWR, MADCTL,
+	VSCRDEF, VSCRSADD and their data bytes) and runs those through a model of the controller:
+	240 x 320 of GRAM, the column / page window, the write pointer wrapping inside it, MADCTL
+	turning and mirroring the address, and vertical scroll deciding which GRAM row shows where
+
+	every byte is counted, and the bus time of a frame is
+
+		bytes * 8 / clock + transactions * PANEL_TRANSACTION_US
+
+	clock is in MHz like SD_SPI_SPEED (PANEL_SPI_MHZ is the ILI9341_t3 default). a transaction is one
+	drawing call (beginTransaction, CS, the bytes, endTransaction), the overhead is a rough guess for
+	a Teensy 3.6, check it against a scope if a budget is tight
+
+		PanelEmulator tft;
+		tft.StartFrame();
+		... draw with tft like it's the ILI9341_t3 ...
+		PanelFrame f = tft.EndFrame();
+		PanelReport(stdout, "race", f, 20.0);
+		tft.WritePNG("race.png");
+
+	the PNG is the panel as the code sees it in the current rotation, with the scroll applied
+
+*/
+
+#ifndef PATRIOT_RACING_PANELEMULATOR_H
+#define PATRIOT_RACING_PANELEMULATOR_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define PANEL_GRAM_W 240              // native portrait
+#define PANEL_GRAM_H 320
+#define PANEL_SPI_MHZ 30.0
+#define PANEL_TRANSACTION_US 0.25
+
+// the commands ILI9341_t3 uses for drawing
+#define PANEL_CASET 0x2A
+#define PANEL_PASET 0x2B
+#define PANEL_RAMWR 0x2C
+#define PANEL_VSCRDEF 0x33
+#define PANEL_MADCTL 0x36
+#define PANEL_VSCRSADD 0x37
+
+#define PANEL_MADCTL_MY 0x80
+#define PANEL_MADCTL_MX 0x40
+#define PANEL_MADCTL_MV 0x20
+#define PANEL_MADCTL_BGR 0x08
+
+struct PanelFrame {
+	uint32_t Bytes;
+	uint32_t Commands;
+	uint32_t Windows;              // RAMWR
+	uint32_t Pixels;
+	uint32_t Transactions;
+	double Micros;
+};
+
+class PanelEmulator {
+
+public:
+
+	uint16_t GRAM[PANEL_GRAM_W * PANEL_GRAM_H];
+	double MHz;
+
+	PanelEmulator() {
+		MHz = PANEL_SPI_MHZ;
+		memset(GRAM, 0, sizeof(GRAM));
+		memset(&Total, 0, sizeof(Total));
+		memset(&Start, 0, sizeof(Start));
+		Cmd = 0;
+		Count = 0;
+		ColStart = PageStart = 0;
+		ColEnd = PANEL_GRAM_W - 1;
+		PageEnd = PANEL_GRAM_H - 1;
+		Col = Page = 0;
+		MADCTL = PANEL_MADCTL_MX | PANEL_MADCTL_BGR;
+		TFA = 0;
+		VSA = PANEL_GRAM_H;
+		VSP = 0;
+		Rotation = 0;
+	}
+
+	// the controller, one byte at a time with D/C low (command) or high (data)
+
+	void Command(uint8_t c) {
+		Total.Bytes++;
+		Total.Commands++;
+		Cmd = c;
+		Count = 0;
+		if (c == PANEL_RAMWR) {
+			Total.Windows++;
+			Col = ColStart;
+			Page = PageStart;
+		}
+	}
+
+	void Data(uint8_t d) {
+
+		Total.Bytes++;
+		switch (Cmd) {
+		case PANEL_CASET:
+		case PANEL_PASET:
+		case PANEL_VSCRDEF:
+		case PANEL_VSCRSADD:
+		case PANEL_MADCTL:
+			if (Count < sizeof(Param)) {
+				Param[Count] = d;
+			}
+			Count++;
+			Parameters();
+			break;
+		case PANEL_RAMWR:
+			if (Count & 1) {
+				Write((Param[0] << 8) | d);
+			}
+			else {
+				Param[0] = d;
+			}
+			Count++;
+			break;
+		default:
+			break;
+		}
+	}
+
+	// what ILI9341_t3 sends for each call
+
+	int16_t width() const {
+		return (Rotation & 1) ? PANEL_GRAM_H : PANEL_GRAM_W;
+	}
+
+	int16_t height() const {
+		return (Rotation & 1) ? PANEL_GRAM_W : PANEL_GRAM_H;
+	}
+
+	uint8_t getRotation() const {
+		return Rotation;
+	}
+
+	void setRotation(uint8_t r) {
+
+		static const uint8_t madctl[4] = {
+			PANEL_MADCTL_MX | PANEL_MADCTL_BGR,
+			PANEL_MADCTL_MV | PANEL_MADCTL_BGR,
+			PANEL_MADCTL_MY | PANEL_MADCTL_BGR,
+			PANEL_MADCTL_MX | PANEL_MADCTL_MY | PANEL_MADCTL_MV | PANEL_MADCTL_BGR
+		};
+
+		Rotation = r & 3;
+		Transaction();
+		Command(PANEL_MADCTL);
+		Data(madctl[Rotation]);
+	}
+
+	// Top and Bottom rows (in GRAM order) stay put, the rest scrolls
+	void setScrollArea(uint16_t Top, uint16_t Bottom) {
+		Transaction();
+		Command(PANEL_VSCRDEF);
+		Data16(Top);
+		Data16(PANEL_GRAM_H - Top - Bottom);
+		Data16(Bottom);
+	}
+
+	void setScroll(uint16_t Offset) {
+		Transaction();
+		Command(PANEL_VSCRSADD);
+		Data16(Offset);
+	}
+
+	void setAddrWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+		Transaction();
+		Window(x, y, x + w - 1, y + h - 1);
+	}
+
+	void pushColor(uint16_t color) {
+		Transaction();
+		Data16(color);
+	}
+
+	void writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors) {
+
+		int32_t i;
+
+		if ((w <= 0) || (h <= 0)) {
+			return;
+		}
+		Transaction();
+		Window(x, y, x + w - 1, y + h - 1);
+		for (i = 0; i < (int32_t) w * h; i++) {
+			Data16(pcolors[i]);
+		}
+	}
+
+	void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+
+		int32_t i;
+
+		// the library clips fills to the screen, writeRect it doesn't
+		if (x < 0) {
+			w += x;
+			x = 0;
+		}
+		if (y < 0) {
+			h += y;
+			y = 0;
+		}
+		if (x + w > width()) {
+			w = width() - x;
+		}
+		if (y + h > height()) {
+			h = height() - y;
+		}
+		if ((w <= 0) || (h <= 0)) {
+			return;
+		}
+		Transaction();
+		Window(x, y, x + w - 1, y + h - 1);
+		for (i = 0; i < (int32_t) w * h; i++) {
+			Data16(color);
+		}
+	}
+
+	void fillScreen(uint16_t color) {
+		fillRect(0, 0, width(), height(), color);
+	}
+
+	void drawPixel(int16_t x, int16_t y, uint16_t color) {
+		fillRect(x, y, 1, 1, color);
+	}
+
+	void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+		fillRect(x, y, w, 1, color);
+	}
+
+	void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+		fillRect(x, y, 1, h, color);
+	}
+
+	// counting
+
+	void StartFrame() {
+		Start = Total;
+	}
+
+	PanelFrame EndFrame() const {
+
+		PanelFrame f;
+
+		f.Bytes = Total.Bytes - Start.Bytes;
+		f.Commands = Total.Commands - Start.Commands;
+		f.Windows = Total.Windows - Start.Windows;
+		f.Pixels = Total.Pixels - Start.Pixels;
+		f.Transactions = Total.Transactions - Start.Transactions;
+		f.Micros = f.Bytes * 8 / MHz + f.Transactions * PANEL_TRANSACTION_US;
+		return f;
+	}
+
+	// the pixel the viewer sees at X, Y of the current rotation
+	uint16_t Shown(int16_t X, int16_t Y) const {
+
+		uint16_t gx, gy;
+
+		Address(X, Y, gx, gy);
+		if ((gy >= TFA) && (gy < TFA + VSA)) {
+			gy = TFA + (gy - TFA + VSP - TFA + VSA) % VSA;
+		}
+		return GRAM[gy * PANEL_GRAM_W + gx];
+	}
+
+	// what's on the panel, RGB 8 bit, stored (not compressed) deflate so no zlib is needed
+	bool WritePNG(const char *Path) const {
+
+		static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+		FILE *f = fopen(Path, "wb");
+		uint8_t head[13], row[1 + PANEL_GRAM_H * 3], block[5];
+		uint32_t w = width(), h = height(), raw = h * (1 + w * 3), crc, adler1 = 1, adler2 = 0;
+		uint32_t x, y, i, left, n;
+		uint16_t c;
+
+		if (f == NULL) {
+			return false;
+		}
+		fwrite(sig, 1, 8, f);
+		Put32(head, w);
+		Put32(head + 4, h);
+		head[8] = 8;        // bits per channel
+		head[9] = 2;        // RGB
+		head[10] = head[11] = head[12] = 0;
+		Chunk(f, "IHDR", head, 13);
+
+		// IDAT, zlib header, stored blocks of up to 65535 bytes, adler32
+		n = raw + 2 + 4 + 5 * ((raw + 65534) / 65535);
+		Put32(block, n);
+		fwrite(block, 1, 4, f);
+		crc = Crc(0xFFFFFFFF, (const uint8_t *) "IDAT", 4);
+		fwrite("IDAT", 1, 4, f);
+		block[0] = 0x78;
+		block[1] = 0x01;
+		crc = Crc(crc, block, 2);
+		fwrite(block, 1, 2, f);
+
+		left = 65535;       // room in the current block, a new block header goes in when it's full
+		n = raw;
+		for (y = 0; y < h; y++) {
+			row[0] = 0;         // no filter
+			for (x = 0; x < w; x++) {
+				c = Shown(x, y);
+				row[1 + x * 3] = ((c >> 11) * 255 + 15) / 31;
+				row[2 + x * 3] = (((c >> 5) & 0x3F) * 255 + 31) / 63;
+				row[3 + x * 3] = ((c & 0x1F) * 255 + 15) / 31;
+			}
+			for (i = 0; i < 1 + w * 3; i++) {
+				if (left == 65535) {
+					block[0] = (n <= 65535) ? 1 : 0;
+					block[1] = ((n < 65535) ? n : 65535) & 0xFF;
+					block[2] = ((n < 65535) ? n : 65535) >> 8;
+					block[3] = ~block[1];
+					block[4] = ~block[2];
+					crc = Crc(crc, block, 5);
+					fwrite(block, 1, 5, f);
+				}
+				crc = Crc(crc, row + i, 1);
+				fputc(row[i], f);
+				adler1 = (adler1 + row[i]) % 65521;
+				adler2 = (adler2 + adler1) % 65521;
+				n--;
+				left = (left == 1) ? 65535 : left - 1;
+			}
+		}
+		Put32(block, (adler2 << 16) | adler1);
+		crc = Crc(crc, block, 4);
+		fwrite(block, 1, 4, f);
+		Put32(block, ~crc);
+		fwrite(block, 1, 4, f);
+
+		Chunk(f, "IEND", NULL, 0);
+		return fclose(f) == 0;
+	}
+
+private:
+
+	PanelFrame Total;
+	PanelFrame Start;
+
+	uint8_t Cmd;
+	uint32_t Count;             // data bytes since the command
+	uint8_t Param[6];
+	uint16_t ColStart, ColEnd, PageStart, PageEnd;
+	uint16_t Col, Page;         // RAMWR write pointer
+	uint8_t MADCTL;
+	uint16_t TFA, VSA, VSP;
+	uint8_t Rotation;
+
+	void Transaction() {
+		Total.Transactions++;
+	}
+
+	void Data16(uint16_t d) {
+		Data(d >> 8);
+		Data(d & 0xFF);
+	}
+
+	void Window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+		Command(PANEL_CASET);
+		Data16(x0);
+		Data16(x1);
+		Command(PANEL_PASET);
+		Data16(y0);
+		Data16(y1);
+		Command(PANEL_RAMWR);
+	}
+
+	// a command's parameters are used once the last one is in
+	void Parameters() {
+
+		switch (Cmd) {
+		case PANEL_CASET:
+			if (Count == 4) {
+				ColStart = (Param[0] << 8) | Param[1];
+				ColEnd = (Param[2] << 8) | Param[3];
+			}
+			break;
+		case PANEL_PASET:
+			if (Count == 4) {
+				PageStart = (Param[0] << 8) | Param[1];
+				PageEnd = (Param[2] << 8) | Param[3];
+			}
+			break;
+		case PANEL_MADCTL:
+			if (Count == 1) {
+				MADCTL = Param[0];
+			}
+			break;
+		case PANEL_VSCRDEF:
+			if ((Count == 6) && (((Param[0] << 8) | Param[1]) + ((Param[2] << 8) | Param[3]) + ((Param[4] << 8) | Param[5]) == PANEL_GRAM_H)) {
+				TFA = (Param[0] << 8) | Param[1];
+				VSA = (Param[2] << 8) | Param[3];
+			}
+			break;
+		case PANEL_VSCRSADD:
+			if (Count == 2) {
+				VSP = (Param[0] << 8) | Param[1];
+				if ((VSP < TFA) || (VSP >= TFA + VSA)) {
+					VSP = TFA;
+				}
+			}
+			break;
+		}
+	}
+
+	// column / page address to GRAM, MV swaps them, MX / MY mirror
+	void Address(uint16_t C, uint16_t P, uint16_t &GX, uint16_t &GY) const {
+
+		if (MADCTL & PANEL_MADCTL_MV) {
+			GX = P;
+			GY = C;
+		}
+		else {
+			GX = C;
+			GY = P;
+		}
+		if (MADCTL & PANEL_MADCTL_MX) {
+			GX = PANEL_GRAM_W - 1 - GX;
+		}
+		if (MADCTL & PANEL_MADCTL_MY) {
+			GY = PANEL_GRAM_H - 1 - GY;
+		}
+	}
+
+	void Write(uint16_t Color) {
+
+		uint16_t gx, gy;
+
+		Total.Pixels++;
+		Address(Col, Page, gx, gy);
+		if ((gx < PANEL_GRAM_W) && (gy < PANEL_GRAM_H)) {
+			GRAM[gy * PANEL_GRAM_W + gx] = Color;
+		}
+		if (++Col > ColEnd) {
+			Col = ColStart;
+			Page = (Page >= PageEnd) ? PageStart : Page + 1;
+		}
+	}
+
+	static void Put32(uint8_t *p, uint32_t v) {
+		p[0] = v >> 24;
+		p[1] = v >> 16;
+		p[2] = v >> 8;
+		p[3] = v;
+	}
+
+	static uint32_t Crc(uint32_t c, const uint8_t *p, uint32_t n) {
+
+		uint32_t i;
+		uint8_t k;
+
+		for (i = 0; i < n; i++) {
+			c ^= p[i];
+			for (k = 0; k < 8; k++) {
+				c = (c >> 1) ^ (0xEDB88320 & (0 - (c & 1)));
+			}
+		}
+		return c;
+	}
+
+	static void Chunk(FILE *f, const char *Type, const uint8_t *p, uint32_t n) {
+
+		uint8_t b[4];
+		uint32_t crc;
+
+		Put32(b, n);
+		fwrite(b, 1, 4, f);
+		fwrite(Type, 1, 4, f);
+		crc = Crc(0xFFFFFFFF, (const uint8_t *) Type, 4);
+		if (n) {
+			fwrite(p, 1, n, f);
+			crc = Crc(crc, p, n);
+		}
+		Put32(b, ~crc);
+		fwrite(b, 1, 4, f);
+	}
+
+};
+
+// one line per frame, returns false if it's over BudgetMs
+static inline bool PanelReport(FILE *f, const char *Name, const PanelFrame &Frame, double BudgetMs) {
+
+	bool over = Frame.Micros > BudgetMs * 1000;
+
+	fprintf(f, "%-16s %8u bytes %6u windows %7u pixels %5u calls %8.2f ms of %6.1f%s\n", Name, Frame.Bytes, Frame.Windows, Frame.Pixels, Frame.Transactions, Frame.Micros / 1000, BudgetMs, over ? "  OVER" : "");
+	return !over;
+}
+
+#endif
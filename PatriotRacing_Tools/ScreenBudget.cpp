@@ -0,0 +1,237 @@
+/*
+
+	Program name: Bob Jones Patriot Racing screen budget check
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	-t render trace
+
+	draws the screens through the panel emulator (PanelEmulator.h) and prints a line per frame with
+	the bytes, windows, pixels and bus time, then exits 1 if any frame went over its budget, so a
+	layout that won't fit in the UPDATE_LIMIT loop fails here instead of on the car
+
+		boot            the packed boot image in bands (BootSplash)
+		race draw       clearing the screen and drawing the race screen from nothing
+		race update     one UPDATE_LIMIT tick of the race screen, readouts and strip chart
+		race above      race draw again with the panel turned for ORIENTATION_ABOVE
+
+	the budgets are in Budgets below, they're bus time in ms at the clock given with -m. the race
+	update is the one that matters, it shares each UPDATE_LIMIT tick with the sensors and the SD card
+
+	ScreenBudget [-m MHz] [-p dir] [-t file]
+		-m MHz           SPI clock (default PANEL_SPI_MHZ, 30)
+		-p dir           write dir/<screen>.png of each screen as it ends up
+		-t file          write the render trace (PatriotRacing_RenderTrace.h) of the screens to file
+		                 for AssetFootprint, needs a build with -DRENDER_TRACE
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/ScreenBudget.cpp PatriotRacing_Utilities/PatriotRacing_BootSplash.cpp PatriotRacing_Utilities/PatriotRacing_IconPack.cpp PatriotRacing_Utilities/PatriotRacing_NumberField.cpp PatriotRacing_Utilities/PatriotRacing_GlyphCache.cpp PatriotRacing_Utilities/PatriotRacing_StripChart.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp PatriotRacing_Utilities/PatriotRacing_RenderTrace.cpp PatriotRacing_Fonts/Arial_100_BINO.cpp PatriotRacing_Fonts/Arial_48BINO.cpp -o ScreenBudget
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+#include "PanelEmulator.h"
+#include "PatriotRacing_BootSplash.h"
+#include "PatriotRacing_BootImage.h"
+#include "PatriotRacing_IconPack.h"
+#include "PatriotRacing_PackedIcons.h"
+#include "PatriotRacing_NumberField.h"
+#include "PatriotRacing_StripChart.h"
+#include "PatriotRacing_Orientation.h"
+#include "PatriotRacing_RenderTrace.h"
+#include "Arial_100_BINO.h"
+#include "Arial_48BINO.h"
+
+#define UPDATE_LIMIT 500         // same as PatriotRacing_Utilities.h
+#define DATA_Y 55
+#define GRAPH_X 45
+#define GRAPH_Y 210
+#define GRAPH_W 255
+#define GRAPH_H 160
+#define BACK 0x0000
+#define FORE 0xFFFF
+#define UPDATES 10               // race update frames
+#define SAMPLES 25               // strip chart samples per update (50 a second)
+
+struct Budget {
+	const char *Name;
+	double Ms;
+};
+
+static const Budget Budgets[] = {
+	{"boot", 70.0},
+	{"race draw", 90.0},
+	{"race update", 25.0},
+	{"race above", 90.0},
+};
+
+static PanelEmulator Panel;
+static GlyphCache Big;
+static GlyphCache Small;
+static NumberField Speed;
+static NumberField Amps;
+static NumberField Volts;
+static StripChart Chart;
+
+static std::string Pngs;
+static FILE *Trace = NULL;
+static uint32_t Sample = 0;
+static int Over = 0;
+
+static double BudgetFor(const char *Name) {
+
+	uint8_t i;
+
+	for (i = 0; i < sizeof(Budgets) / sizeof(Budgets[0]); i++) {
+		if (strcmp(Budgets[i].Name, Name) == 0) {
+			return Budgets[i].Ms;
+		}
+	}
+	return UPDATE_LIMIT;
+}
+
+static void Report(const char *Name, const char *Line) {
+
+	std::string path;
+
+	if (!PanelReport(stdout, Line, Panel.EndFrame(), BudgetFor(Name))) {
+		Over++;
+	}
+	if (!Pngs.empty()) {
+		path = Pngs + "/" + Name + ".png";
+		for (size_t i = Pngs.size() + 1; i < path.size(); i++) {
+			if (path[i] == ' ') {
+				path[i] = '_';
+			}
+		}
+		if (!Panel.WritePNG(path.c_str())) {
+			printf("can't write %s\n", path.c_str());
+		}
+	}
+}
+
+static void TraceLine(const char *Line) {
+	fprintf(Trace, "%s\n", Line);
+}
+
+// the readouts and chart for tick n, what the race screen does every UPDATE_LIMIT
+template <class Display>
+static void RaceValues(Display &D, uint32_t n) {
+
+	uint8_t i;
+
+	Speed.Print(D, 25.0f + 10.0f * sinf(n * 0.3f), 1);
+	Amps.Print(D, 18.0f + 4.0f * sinf(n * 1.3f), 1);
+	Volts.Print(D, 24.6f - n * 0.01f, 1);
+
+	for (i = 0; i < SAMPLES; i++, Sample++) {
+		Chart.Add(20.0f + 15.0f * sinf(Sample * 0.05f));
+	}
+	Chart.Draw(D);
+}
+
+template <class Display>
+static void RaceDraw(Display &D) {
+
+	D.fillRect(0, 0, 320, 240, BACK);
+	IconDraw(D, 4, GRAPH_Y - GRAPH_H, car_icon_packed);
+	IconDraw(D, 4, GRAPH_Y - 32, clock_icon_packed);
+	Speed.Invalidate();
+	Amps.Invalidate();
+	Volts.Invalidate();
+	Chart.Redraw(D);
+	RaceValues(D, 0);
+}
+
+int main(int argc, char **argv) {
+
+	BootSplash splash;
+	uint32_t n;
+	char line[32];
+	int a;
+
+	for (a = 1; a < argc; a++) {
+		if ((strcmp(argv[a], "-m") == 0) && (a + 1 < argc)) {
+			Panel.MHz = atof(argv[++a]);
+		}
+		else if ((strcmp(argv[a], "-p") == 0) && (a + 1 < argc)) {
+			Pngs = argv[++a];
+		}
+		else if ((strcmp(argv[a], "-t") == 0) && (a + 1 < argc)) {
+			Trace = fopen(argv[++a], "w");
+			if (Trace == NULL) {
+				printf("can't write %s\n", argv[a]);
+				return 1;
+			}
+		}
+		else {
+			printf("ScreenBudget [-m MHz] [-p dir] [-t file]\n");
+			return 1;
+		}
+	}
+	if (Panel.MHz <= 0) {
+		printf("bad clock\n");
+		return 1;
+	}
+	if (Trace != NULL) {
+#ifndef RENDER_TRACE
+		printf("-t needs a build with -DRENDER_TRACE\n");
+		return 1;
+#endif
+		RENDERTRACE_NAME(Arial_100_BINO);
+		RENDERTRACE_NAME(Arial_48BINO);
+		RENDERTRACE_ICON(car_icon_packed);
+		RENDERTRACE_ICON(clock_icon_packed);
+		RENDERTRACE_ICON(BootImage_packed);
+		RenderTraceBegin(TraceLine);
+	}
+
+	Big.Begin(Arial_100_BINO, "-.0123456789:", FORE, BACK);
+	Small.Begin(Arial_48BINO, "-.0123456789:", FORE, BACK);
+	Speed.Begin(Big, 300, DATA_Y, NUMBERFIELD_RIGHT);
+	Amps.Begin(Small, 4, 4, NUMBERFIELD_LEFT);
+	Volts.Begin(Small, 316, 4, NUMBERFIELD_RIGHT);
+	Chart.Begin(GRAPH_X, GRAPH_Y, GRAPH_W, GRAPH_H - 90, 0.0f, 40.0f, BACK);
+	Chart.SetGrid(4, 0x4208);
+	Chart.AddTrace(0x07E0);
+
+	printf("%.1f MHz, %.2f us per call, budgets in ms of bus time\n", Panel.MHz, PANEL_TRANSACTION_US);
+
+	Panel.setRotation(OrientationRotation(ORIENTATION_BELOW));
+	Panel.StartFrame();
+	Panel.fillScreen(BACK);
+	splash.Begin(BootImage_packed, (320 - BootImage_packed.Width) / 2, (240 - BootImage_packed.Height) / 2, FORE, BACK);
+	splash.Draw(Panel);
+	Report("boot", "boot");
+
+	Panel.StartFrame();
+	RaceDraw(Panel);
+	Report("race draw", "race draw");
+
+	for (n = 1; n <= UPDATES; n++) {
+		Panel.StartFrame();
+		RaceValues(Panel, n);
+		snprintf(line, sizeof(line), "race update %u", n);
+		Report("race update", line);
+	}
+
+	Panel.StartFrame();
+	Panel.setRotation(OrientationRotation(ORIENTATION_ABOVE));
+	RaceDraw(Panel);
+	Report("race above", "race above");
+
+	if (Trace != NULL) {
+		fclose(Trace);
+	}
+	if (Over) {
+		printf("%d frame%s over budget\n", Over, (Over == 1) ? "" : "s");
+		return 1;
+	}
+	return 0;
+}
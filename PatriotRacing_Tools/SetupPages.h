@@ -0,0 +1,64 @@
+/*
+
+	Program name: Bob Jones Patriot Racing PC tools
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	the option arrays from PatriotRacing_Utilities/PatriotRacing_Utilities.h (that header needs
+	Arduino.h and Colors.h so it can't be included on the PC) made into MenuScreen pages, for the
+	benches that draw the setup menu. the labels are the array names and the pages just hold
+	MENUSCREEN_ROWS items each, the real labels and pages are the sketch's
+
+*/
+
+#ifndef PATRIOT_RACING_SETUPPAGES_H
+#define PATRIOT_RACING_SETUPPAGES_H
+
+#include "PatriotRacing_MenuScreen.h"
+
+static const char *AirRateText[] = {"2.40k", "2.41k", "2.42k", "4.8k", "9.6k", "19.2k", "38.4k", "62.5k"};
+static const char *HighPowerText[] = {"30 dB",  "27 dB", "24 dB", "21 dB"};
+static const char *PowerText[] = {"22 dB",  "17 dB", "13 dB", "10 dB"};
+static const char *ASensorDirectionText[] = {"+X", "-X", "+Y", "-X", "+Z", "-Z"};
+static const char *ThemeText[] = {"Dark", "Light"};
+static const char *OrientationText[] = {"Below", "Above"};
+static const char *YesNoText[] = {"No", "Yes"};
+static const char *TextJustifyText[] = {"Left", "Right"};
+static const char *CyborgInputText[] = {"Amps", "Speed"};
+static const char *SendTimeText[] = {"Off", "1 sec", "2 sec", "3 sec", "4 sec","5 sec"};
+static const char *GPSReadTimeText[] = {"0 sec", "5 sec", "10 sec", "20 sec"};
+static const char *GPSToleranceText[] = {"Off", "3 ft", "6 ft", "9 ft", "13 ft","16 ft", "19 ft", "23 ft", "26 ft", "29 ft", "31 ft"};
+static const char *AccelFSRange[] = {"+/- 2 G", "+/- 4 G", "+/- 8 G", "+/- 16 G"};
+static const char *AccelLPFilterText[] = {"256 Hz", "188 Hz", "98 Hz", "42 Hz", "20 Hz", "10 Hz", "5 Hz"};
+static const char *AccelHPFilterText[] = {"Off", "5 Hz", "2.5 Hz", "1.25 Hz", "0.63 Hz"};
+static const char *CarText[] = {"Blue", "Red", "White"};
+static const char *MotorText[] = {"C0", "C1", "C2", "C3", "U0", "U1", "U2", "U3", "U4", "U5", "U6", "U7", "U8", "U9"};
+static const char *TireText[] = {"Kojaks", "Duranos", "Ones", "Pro Ones", "Test"};
+
+#define SETUP_ITEM(Choices) MENUSCREEN_ITEM(#Choices, Choices)
+
+static const MenuScreenItem SetupItems1[] = {
+	SETUP_ITEM(AirRateText), SETUP_ITEM(HighPowerText), SETUP_ITEM(PowerText), SETUP_ITEM(SendTimeText),
+	SETUP_ITEM(ThemeText), SETUP_ITEM(OrientationText), SETUP_ITEM(TextJustifyText)
+};
+
+static const MenuScreenItem SetupItems2[] = {
+	SETUP_ITEM(YesNoText), SETUP_ITEM(CarText), SETUP_ITEM(TireText), SETUP_ITEM(MotorText),
+	SETUP_ITEM(CyborgInputText), SETUP_ITEM(GPSReadTimeText), SETUP_ITEM(GPSToleranceText)
+};
+
+static const MenuScreenItem SetupItems3[] = {
+	SETUP_ITEM(AccelFSRange), SETUP_ITEM(AccelLPFilterText), SETUP_ITEM(AccelHPFilterText), SETUP_ITEM(ASensorDirectionText)
+};
+
+static const MenuScreenPage SetupPages[] = {
+	MENUSCREEN_PAGE("Setup 1", SetupItems1),
+	MENUSCREEN_PAGE("Setup 2", SetupItems2),
+	MENUSCREEN_PAGE("Setup 3", SetupItems3)
+};
+
+#define SETUP_PAGES (sizeof(SetupPages) / sizeof(SetupPages[0]))
+
+#endif
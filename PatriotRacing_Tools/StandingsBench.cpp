@@ -0,0 +1,354 @@
+/*
+
+	Program name: Bob Jones Patriot Racing standings benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	replays a race monitor crossing feed (a full field, about 90 s laps, some crossings swapped and
+	some resent like the feed does) through Standings and after every event checks it against a
+	brute force copy that sorts the whole field and measures the gaps again:
+		positions    more laps first, the same laps crossed first
+		crossed      the car that crossed gets its gaps to the leader and the car ahead measured
+		the rest     keep what they had at their own crossing, unless the car ahead is on the
+		             same lap, then the gaps are the difference of the crossing times
+		changes      every car whose position or gaps changed is in the change set
+	then the cases that went wrong before (the leader finishing a lap, out of order crossings on the
+	same lap), and the time a lap event takes
+
+	StandingsBench [cars] [laps]
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Utilities PatriotRacing_Tools/StandingsBench.cpp PatriotRacing_Utilities/PatriotRacing_Standings.cpp -o StandingsBench
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+#include "PatriotRacing_Standings.h"
+
+#define DEFAULT_CARS 64
+#define DEFAULT_LAPS 40
+#define MAX_EVENTS (STANDINGS_MAX_CARS * (STANDINGS_MAX_LAPS + 1) * 2)
+#define CLOSE 0.001f
+
+struct Event {
+	uint16_t Number;
+	uint16_t Laps;
+	float CrossTime;
+	float LapTime;
+};
+
+// the brute force copy, indexed the same as the Standings slots
+struct Reference {
+	uint16_t Number;
+	uint16_t Laps;
+	float CrossTime;
+	uint8_t Pos;
+	float GapLeader;
+	float GapAhead;
+	uint16_t LapsLeader;
+	uint16_t LapsAhead;
+};
+
+static Event Events[MAX_EVENTS];
+static uint32_t EventCount = 0;
+static Standings Live;
+static Reference Ref[STANDINGS_MAX_CARS];
+static Reference Before[STANDINGS_MAX_CARS];
+static uint8_t RefOrder[STANDINGS_MAX_CARS];
+static float RefFirst[STANDINGS_MAX_LAPS + 1];
+static uint8_t RefCount = 0;
+static int Fail = 0;
+
+static void Report(const char *Format, uint16_t Number, double Got, double Want) {
+
+	if (Fail++ < 10) {
+		printf("  car %u: ", Number);
+		printf(Format, Got, Want);
+		printf("\n");
+	}
+}
+
+static bool RefAhead(uint8_t A, uint8_t B) {
+
+	if (Ref[A].Laps != Ref[B].Laps) {
+		return Ref[A].Laps > Ref[B].Laps;
+	}
+	return Ref[A].CrossTime < Ref[B].CrossTime;
+}
+
+// the whole field again, insertion sort keeps cars that tie where they were
+static void RefSort() {
+
+	uint8_t i, j, s;
+
+	for (i = 1; i < RefCount; i++) {
+		s = RefOrder[i];
+		for (j = i; (j > 0) && RefAhead(s, RefOrder[j - 1]); j--) {
+			RefOrder[j] = RefOrder[j - 1];
+		}
+		RefOrder[j] = s;
+	}
+	for (i = 0; i < RefCount; i++) {
+		Ref[RefOrder[i]].Pos = i + 1;
+	}
+}
+
+static void RefEvent(uint8_t Slot, const Event &E) {
+
+	Reference &c = Ref[Slot];
+	uint8_t i;
+
+	if (Slot == RefCount) {
+		memset(&c, 0, sizeof(c));
+		c.Number = E.Number;
+		RefOrder[RefCount] = Slot;
+		RefCount++;
+	}
+	c.Laps = E.Laps;
+	c.CrossTime = E.CrossTime;
+	if ((RefFirst[E.Laps] < 0.0f) || (E.CrossTime < RefFirst[E.Laps])) {
+		RefFirst[E.Laps] = E.CrossTime;
+	}
+	RefSort();
+
+	// the car that crossed
+	if (c.Pos == 1) {
+		c.GapLeader = c.GapAhead = 0.0f;
+		c.LapsLeader = c.LapsAhead = 0;
+	}
+	else {
+		const Reference &ahead = Ref[RefOrder[c.Pos - 2]];
+		c.LapsLeader = Ref[RefOrder[0]].Laps - c.Laps;
+		c.GapLeader = c.CrossTime - RefFirst[c.Laps];
+		c.LapsAhead = ahead.Laps - c.Laps;
+		c.GapAhead = (c.LapsAhead == 0) ? c.CrossTime - ahead.CrossTime : 0.0f;
+	}
+
+	// everyone else only when the car ahead is on the same lap
+	for (i = 1; i < RefCount; i++) {
+		Reference &o = Ref[RefOrder[i]];
+		const Reference &ahead = Ref[RefOrder[i - 1]];
+		if ((&o == &c) || (ahead.Laps != o.Laps)) {
+			continue;
+		}
+		o.GapLeader = o.CrossTime - RefFirst[o.Laps];
+		o.GapAhead = o.CrossTime - ahead.CrossTime;
+		o.LapsAhead = 0;
+	}
+}
+
+static bool GapsDiffer(const Reference &A, const Reference &B) {
+	return (fabsf(A.GapLeader - B.GapLeader) > CLOSE) || (fabsf(A.GapAhead - B.GapAhead) > CLOSE) ||
+		(A.LapsLeader != B.LapsLeader) || (A.LapsAhead != B.LapsAhead);
+}
+
+static void Check(const char *When) {
+
+	uint8_t i, flags;
+	int before = Fail;
+
+	if (Live.GetCount() != RefCount) {
+		Report("count %.0f, should be %.0f", 0, Live.GetCount(), RefCount);
+		return;
+	}
+	for (i = 0; i < RefCount; i++) {
+		const Standing &s = Live.GetCar(i);
+		const Reference &r = Ref[i];
+		flags = Live.GetChangeFlags(i);
+		if (s.Pos != r.Pos) {
+			Report("position %.0f, should be %.0f", r.Number, s.Pos, r.Pos);
+		}
+		if (fabsf(s.GapLeader - r.GapLeader) > CLOSE) {
+			Report("gap to leader %.3f, should be %.3f", r.Number, s.GapLeader, r.GapLeader);
+		}
+		if (fabsf(s.GapAhead - r.GapAhead) > CLOSE) {
+			Report("gap ahead %.3f, should be %.3f", r.Number, s.GapAhead, r.GapAhead);
+		}
+		if (s.LapsLeader != r.LapsLeader) {
+			Report("laps to leader %.0f, should be %.0f", r.Number, s.LapsLeader, r.LapsLeader);
+		}
+		if (s.LapsAhead != r.LapsAhead) {
+			Report("laps to car ahead %.0f, should be %.0f", r.Number, s.LapsAhead, r.LapsAhead);
+		}
+		if (Before[i].Number != r.Number) {
+			// new, the whole car is in the change set
+			continue;
+		}
+		if ((r.Pos != Before[i].Pos) && !(flags & STANDING_POS)) {
+			Report("moved from %.0f to %.0f and isn't in the change set", r.Number, Before[i].Pos, r.Pos);
+		}
+		if (GapsDiffer(r, Before[i]) && !(flags & STANDING_GAP)) {
+			Report("gap changed (%.3f to %.3f) and isn't in the change set", r.Number, Before[i].GapAhead, r.GapAhead);
+		}
+	}
+	if ((Fail > before) && (before < 10)) {
+		printf("  after %s\n", When);
+	}
+}
+
+static void Start() {
+
+	uint16_t i;
+
+	Live.Reset();
+	RefCount = 0;
+	for (i = 0; i <= STANDINGS_MAX_LAPS; i++) {
+		RefFirst[i] = -1.0f;
+	}
+	RefFirst[0] = 0.0f;
+}
+
+// one event through both, true if Standings took it
+static bool Feed(const Event &E) {
+
+	uint8_t slot = Live.GetSlot(E.Number), got;
+	char when[48];
+
+	if (slot == STANDING_NOT_FOUND) {
+		slot = RefCount;
+	}
+	memcpy(Before, Ref, sizeof(Ref));
+	Live.ClearChanges();
+	got = Live.LapEvent(E.Number, E.Laps, E.CrossTime, E.LapTime);
+	if ((slot < RefCount) && (E.Laps <= Ref[slot].Laps)) {
+		if (got != 0) {
+			Report("took a resend of lap %.0f (%.0f)", E.Number, E.Laps, got);
+		}
+		return false;
+	}
+	RefEvent(slot, E);
+	snprintf(when, sizeof(when), "car %u lap %u at %.3f", E.Number, E.Laps, E.CrossTime);
+	Check(when);
+	return true;
+}
+
+// a field of Cars running Laps laps, the feed sorted by crossing time and then messed up a little
+static void MakeFeed(uint8_t Cars, uint16_t Laps) {
+
+	uint32_t i, j;
+	uint16_t lap;
+	uint8_t car;
+	float pace, t, l;
+	Event e;
+
+	EventCount = 0;
+	srand(27);
+	for (car = 0; car < Cars; car++) {
+		pace = 85.0f + (rand() % 1000) * 0.01f;
+		t = car * 0.4f;            // the grid
+		for (lap = 1; lap <= Laps; lap++) {
+			l = pace + (rand() % 400) * 0.01f - 2.0f;
+			t += l;
+			Events[EventCount].Number = 10 + car * 3;
+			Events[EventCount].Laps = lap;
+			Events[EventCount].CrossTime = t;
+			Events[EventCount].LapTime = l;
+			EventCount++;
+		}
+	}
+
+	// by time
+	for (i = 1; i < EventCount; i++) {
+		e = Events[i];
+		for (j = i; (j > 0) && (Events[j - 1].CrossTime > e.CrossTime); j--) {
+			Events[j] = Events[j - 1];
+		}
+		Events[j] = e;
+	}
+
+	// the feed swaps a crossing now and then and sends some twice
+	for (i = 1; i < EventCount; i++) {
+		if ((rand() % 8) == 0) {
+			e = Events[i];
+			Events[i] = Events[i - 1];
+			Events[i - 1] = e;
+		}
+	}
+	for (i = EventCount; i > 1; i--) {
+		if (((rand() % 10) == 0) && (EventCount < MAX_EVENTS)) {
+			memmove(&Events[i + 1], &Events[i], (EventCount - i) * sizeof(Event));
+			Events[i] = Events[i - 2];
+			EventCount++;
+		}
+	}
+}
+
+// the two cases from the review, by hand
+static void Scripted() {
+
+	const Standing *p2;
+	static const Event leader[] = {
+		{1, 1, 100.0f, 100.0f},
+		{2, 1, 105.0f, 105.0f},
+		{1, 2, 200.0f, 100.0f}
+	};
+	static const Event outoforder[] = {
+		{2, 1, 101.0f, 101.0f},
+		{3, 1, 102.0f, 102.0f},
+		{1, 1, 100.0f, 100.0f}
+	};
+	uint8_t i;
+
+	// the leader finishing lap 2 doesn't put P2 a lap down
+	Start();
+	for (i = 0; i < 3; i++) {
+		Feed(leader[i]);
+	}
+	p2 = &Live.GetCar(Live.GetSlotAtPos(2));
+	if ((p2->LapsAhead != 0) || (p2->LapsLeader != 0) || (fabsf(p2->GapAhead - 5.0f) > CLOSE)) {
+		Report("after the leader's lap 2, %.0f laps down, should be %.0f", p2->Number, p2->LapsLeader, 0);
+	}
+
+	// the first car on the lap reported last
+	Start();
+	for (i = 0; i < 3; i++) {
+		Feed(outoforder[i]);
+	}
+	p2 = &Live.GetCar(Live.GetSlotAtPos(2));
+	if (fabsf(p2->GapAhead - 1.0f) > CLOSE) {
+		Report("out of order, gap ahead %.3f, should be %.3f", p2->Number, p2->GapAhead, 1.0);
+	}
+}
+
+int main(int argc, char **argv) {
+
+	int cars = (argc > 1) ? atoi(argv[1]) : DEFAULT_CARS;
+	int laps = (argc > 2) ? atoi(argv[2]) : DEFAULT_LAPS;
+	uint32_t i, taken = 0;
+	double us;
+
+	if ((cars < 1) || (cars > STANDINGS_MAX_CARS) || (laps < 1) || (laps > STANDINGS_MAX_LAPS)) {
+		printf("cars 1 to %d, laps 1 to %d\n", STANDINGS_MAX_CARS, STANDINGS_MAX_LAPS);
+		return 1;
+	}
+
+	Scripted();
+
+	MakeFeed(cars, laps);
+	Start();
+	for (i = 0; i < EventCount; i++) {
+		if (Feed(Events[i])) {
+			taken++;
+		}
+	}
+	printf("%d cars, %d laps, %u events, %u taken, %s\n", cars, laps, EventCount, taken, Fail ? "FAILED" : "all match");
+
+	// the same feed again with nothing else going on, to time it
+	auto t0 = std::chrono::steady_clock::now();
+	Live.Reset();
+	for (i = 0; i < EventCount; i++) {
+		Live.LapEvent(Events[i].Number, Events[i].Laps, Events[i].CrossTime, Events[i].LapTime);
+		Live.ClearChanges();
+	}
+	us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+	printf("  %.3f us a lap event on this PC\n", us / EventCount);
+
+	return Fail ? 1 : 0;
+}
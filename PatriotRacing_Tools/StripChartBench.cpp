@@ -0,0 +1,243 @@
+/*
+
+	Program name: Bob Jones Patriot Racing strip chart benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	Add and Draw on two threads, NaN samples, Add(float) on a chart with more
+	                            	than one trace
+
+	feeds three traces (speed, amps, volts with some noise) into the GRAPH_X / Y / W / H chart two ways
+	into a mock display (MockDisplay.h) for 1, 4, 16 and 64 samples per column:
+		redraw    what the graph did, clear the plot and draw every column again from the raw
+		          history each time a sample comes in
+		strip     StripChart, Add every sample and Draw, only the newest column goes out
+	every so often the strip chart screen is checked against a Redraw of the same chart on a clean
+	screen. prints us and SPI bytes per sample, strip should stay flat as the history gets longer
+
+	then a thread Adds (every so often a NaN) while the main one Draws as fast as it can, the way the
+	data task and the screen update share a chart, and when the thread is done one more Draw has to
+	match a Redraw. Add(float) on that three trace chart must not finish a column
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -pthread -IPatriotRacing_Tools -IPatriotRacing_Utilities PatriotRacing_Tools/StripChartBench.cpp PatriotRacing_Utilities/PatriotRacing_StripChart.cpp -o StripChartBench
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <atomic>
+
+#include "PatriotRacing_StripChart.h"
+#include "MockDisplay.h"
+
+#define GRAPH_X 45            // same as PatriotRacing_Utilities.h
+#define GRAPH_Y 210
+#define GRAPH_W 255
+#define GRAPH_H 160
+#define BACK 0x0000
+#define GRID 0x4208
+#define TRACES 3
+#define SAMPLES 20000
+#define CHECK_EVERY 97
+#define LOW 0.0f
+#define HIGH 60.0f
+
+static const uint16_t TraceColor[TRACES] = {0xFFE0, 0xF800, 0x07FF};
+
+static MockDisplay Old;
+static MockDisplay Strip;
+static MockDisplay Check;
+
+// raw history for the old redraw, oldest first
+static float History[TRACES][GRAPH_W * 64];
+
+static void Sample(uint32_t I, float *Out) {
+	Out[0] = 30.0f + 25.0f * sinf(I * 0.013f) + (rand() % 5 - 2) * 0.2f;
+	Out[1] = 20.0f + 15.0f * sinf(I * 0.031f + 1.0f) + (rand() % 9 - 4) * 0.5f;
+	Out[2] = 48.0f + 2.0f * sinf(I * 0.002f) + (rand() % 3 - 1) * 0.1f;
+}
+
+static int16_t Row(float Value) {
+
+	float r = (HIGH - Value) * (GRAPH_H - 1) / (HIGH - LOW);
+
+	if (r <= 0.0f) {
+		return 0;
+	}
+	if (r >= GRAPH_H - 1) {
+		return GRAPH_H - 1;
+	}
+	return (int16_t) (r + 0.5f);
+}
+
+// clear the plot and draw the last GRAPH_W columns of history, newest on the right
+static void OldRedraw(uint32_t Count, uint16_t PerColumn) {
+
+	int16_t top = GRAPH_Y - GRAPH_H;
+	uint32_t columns = Count / PerColumn;
+	uint32_t first, c, s;
+	int16_t lo, hi, r, g, last;
+	uint8_t t;
+
+	Old.fillRect(GRAPH_X, top, GRAPH_W, GRAPH_H, BACK);
+	for (g = 1; g <= 4; g++) {
+		Old.drawFastHLine(GRAPH_X, top + ((GRAPH_H - 1) * g) / 5, GRAPH_W, GRID);
+	}
+	first = (columns > GRAPH_W) ? columns - GRAPH_W : 0;
+	for (t = 0; t < TRACES; t++) {
+		last = -1;
+		for (c = first; c < columns; c++) {
+			lo = hi = (last < 0) ? Row(History[t][c * PerColumn]) : last;
+			for (s = c * PerColumn; s < (c + 1) * PerColumn; s++) {
+				r = Row(History[t][s]);
+				lo = (r < lo) ? r : lo;
+				hi = (r > hi) ? r : hi;
+				last = r;
+			}
+			Old.drawFastVLine(GRAPH_X + (c - first), top + lo, hi - lo + 1, TraceColor[t]);
+		}
+	}
+}
+
+static int Run(uint16_t PerColumn) {
+
+	StripChart chart;
+	float v[TRACES];
+	uint32_t i, oldBytes, stripBytes;
+	double oldSec = 0.0, stripSec = 0.0;
+	uint8_t t;
+	int bad = 0;
+
+	chart.Begin(GRAPH_X, GRAPH_Y, GRAPH_W, GRAPH_H, LOW, HIGH, BACK);
+	chart.SetSamplesPerColumn(PerColumn);
+	chart.SetGrid(4, GRID);
+	for (t = 0; t < TRACES; t++) {
+		chart.AddTrace(TraceColor[t]);
+	}
+
+	Old.Clear(BACK);
+	Strip.Clear(BACK);
+	chart.Draw(Strip);
+	Strip.Reset();
+	srand(1);
+
+	for (i = 0; i < SAMPLES; i++) {
+		Sample(i, v);
+
+		auto start = std::chrono::steady_clock::now();
+		chart.Add(v);
+		chart.Draw(Strip);
+		stripSec += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		// Redraw doesn't change anything the next Draw depends on
+		if ((i % CHECK_EVERY) == 0) {
+			Check.Clear(BACK);
+			chart.Redraw(Check);
+			if (memcmp(Strip.Pixels, Check.Pixels, sizeof(Strip.Pixels)) != 0) {
+				if (bad++ < 5) {
+					printf("  strip chart differs from a redraw after sample %u\n", i);
+				}
+			}
+		}
+	}
+	stripBytes = Strip.Bytes();
+
+	// the old way is timed on its own, the history has to be in order for it
+	Old.Reset();
+	srand(1);
+	for (i = 0; i < SAMPLES; i++) {
+		Sample(i, v);
+		auto start = std::chrono::steady_clock::now();
+		for (t = 0; t < TRACES; t++) {
+			if (i < GRAPH_W * PerColumn) {
+				History[t][i] = v[t];
+			}
+			else {
+				memmove(&History[t][0], &History[t][1], (GRAPH_W * PerColumn - 1) * sizeof(float));
+				History[t][GRAPH_W * PerColumn - 1] = v[t];
+			}
+		}
+		OldRedraw((i < GRAPH_W * PerColumn) ? i + 1 : GRAPH_W * PerColumn, PerColumn);
+		oldSec += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+	oldBytes = Old.Bytes();
+
+	printf("%4u per column  history %6u   redraw %8.2f us %7u bytes   strip %6.2f us %5u bytes   %s\n", PerColumn, GRAPH_W * PerColumn, oldSec * 1e6 / SAMPLES, oldBytes / SAMPLES, stripSec * 1e6 / SAMPLES, stripBytes / SAMPLES, bad ? "DIFFERS" : "ok");
+	return bad;
+}
+
+// Add on a thread of its own, Draw here
+static int Tasks() {
+
+	StripChart chart;
+	std::atomic<bool> adding(true);
+	uint32_t draws = 0;
+	uint8_t t;
+	int bad = 0;
+
+	chart.Begin(GRAPH_X, GRAPH_Y, GRAPH_W, GRAPH_H, LOW, HIGH, BACK);
+	chart.SetGrid(4, GRID);
+	for (t = 0; t < TRACES; t++) {
+		chart.AddTrace(TraceColor[t]);
+	}
+	Strip.Clear(BACK);
+	chart.Draw(Strip);
+
+	std::thread data([&]() {
+		float v[TRACES];
+		uint32_t i;
+		for (i = 0; i < SAMPLES * 10; i++) {
+			Sample(i, v);
+			if ((i % 101) == 0) {
+				v[i % TRACES] = NAN;
+			}
+			chart.Add(v);
+		}
+		adding = false;
+	});
+	while (adding) {
+		chart.Draw(Strip);
+		draws++;
+	}
+	data.join();
+	chart.Draw(Strip);
+
+	Check.Clear(BACK);
+	chart.Redraw(Check);
+	if (memcmp(Strip.Pixels, Check.Pixels, sizeof(Strip.Pixels)) != 0) {
+		printf("  Add and Draw on two threads, the chart differs from a redraw\n");
+		bad++;
+	}
+
+	// one value for three traces, nothing gets finished
+	for (t = 0; t < 10; t++) {
+		chart.Add(30.0f);
+	}
+	if (chart.Draw(Strip) != 0) {
+		printf("  Add(float) on a three trace chart finished a column\n");
+		bad++;
+	}
+
+	printf("two threads      %u samples, %u draws   %s\n", SAMPLES * 10, draws, bad ? "DIFFERS" : "ok");
+	return bad;
+}
+
+int main() {
+
+	const uint16_t perColumn[] = {1, 4, 16, 64};
+	int bad = 0;
+	uint8_t i;
+
+	printf("%u samples, %u traces, %dx%d chart\n", SAMPLES, TRACES, GRAPH_W, GRAPH_H);
+	for (i = 0; i < sizeof(perColumn) / sizeof(perColumn[0]); i++) {
+		bad += Run(perColumn[i]);
+	}
+	bad += Tasks();
+	return bad ? 1 : 0;
+}
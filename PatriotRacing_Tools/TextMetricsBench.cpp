@@ -0,0 +1,126 @@
+/*
+
+	Program name: Bob Jones Patriot Racing text metrics benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	lays out a menu screen (centered title, left items, right justified units) with the GFXfonts in
+	Adafruit_fonts.h three ways:
+		glyphs    walk the glyph table for every string, what the menus did
+		advance   TextMetrics::Width, the byte advance tables
+		label     TextMetrics::LabelWidth, the LRU cache on top
+	all three must give the same widths, then it prints ns per layout and the cache hit rate
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities PatriotRacing_Tools/TextMetricsBench.cpp PatriotRacing_Utilities/PatriotRacing_TextMetrics.cpp -o TextMetricsBench
+
+*/
+
+#include <stdio.h>
+#include <chrono>
+
+#include "PatriotRacing_TextMetrics.h"
+#include "Adafruit_fonts.h"
+
+#define SCREEN_W 320
+#define LAYOUTS 200000
+
+struct Line {
+	const GFXfont *Font;
+	const char *Text;
+	uint8_t Justify;             // 0 left, 1 right, 2 center
+	int16_t X;
+};
+
+static const Line Menu[] = {
+	{&arialbd14, "Car Setup", 2, SCREEN_W / 2},
+	{&arial12, "Wheel diameter", 0, 10}, {&arial12, "inches", 1, 310},
+	{&arial12, "Motor sprocket", 0, 10}, {&arial12, "teeth", 1, 310},
+	{&arial12, "Wheel sprocket", 0, 10}, {&arial12, "teeth", 1, 310},
+	{&arial12, "Battery warning", 0, 10}, {&arial12, "volts", 1, 310},
+	{&arial12, "Amp warning", 0, 10}, {&arial12, "amps", 1, 310},
+	{&arial12, "Temp warning", 0, 10}, {&arial12, "deg F", 1, 310},
+	{&arial12, "GForce warning", 0, 10}, {&arial12, "g", 1, 310},
+	{&arial9, "Left: Back   Center: Select   Right: Next", 2, SCREEN_W / 2}
+};
+
+#define LINES (sizeof(Menu) / sizeof(Menu[0]))
+
+typedef uint16_t (*Measure)(TextMetrics &M, const GFXfont *Font, const char *Text);
+
+static uint16_t ByGlyphs(TextMetrics &M, const GFXfont *Font, const char *Text) {
+	(void) M;
+	return TextMetrics::GlyphWidth(Font, Text);
+}
+
+static uint16_t ByAdvance(TextMetrics &M, const GFXfont *Font, const char *Text) {
+	return M.Width(Font, Text);
+}
+
+static uint16_t ByLabel(TextMetrics &M, const GFXfont *Font, const char *Text) {
+	return M.LabelWidth(Font, Text);
+}
+
+// where each line starts, summed so the compiler can't drop the work
+static int32_t Layout(TextMetrics &M, Measure F, int16_t *X) {
+
+	int32_t sum = 0;
+	uint8_t i;
+	uint16_t w;
+
+	for (i = 0; i < LINES; i++) {
+		w = F(M, Menu[i].Font, Menu[i].Text);
+		X[i] = (Menu[i].Justify == 0) ? Menu[i].X : (Menu[i].Justify == 1) ? Menu[i].X - w : Menu[i].X - w / 2;
+		sum += X[i];
+	}
+	return sum;
+}
+
+static double Time(TextMetrics &M, Measure F) {
+
+	int16_t x[LINES];
+	volatile int32_t sink = 0;
+	uint32_t i;
+
+	auto start = std::chrono::steady_clock::now();
+	for (i = 0; i < LAYOUTS; i++) {
+		sink += Layout(M, F, x);
+	}
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / LAYOUTS;
+}
+
+int main() {
+
+	static TextMetrics metrics;
+	int16_t a[LINES], b[LINES], c[LINES];
+	double glyphs, advance, label;
+	uint8_t i;
+	int bad = 0;
+
+	metrics.AddFont(&arial9);
+	metrics.AddFont(&arial12);
+	metrics.AddFont(&arialbd14);
+
+	Layout(metrics, ByGlyphs, a);
+	Layout(metrics, ByAdvance, b);
+	Layout(metrics, ByLabel, c);
+	for (i = 0; i < LINES; i++) {
+		if ((a[i] != b[i]) || (a[i] != c[i])) {
+			printf("\"%s\" %d %d %d\n", Menu[i].Text, a[i], b[i], c[i]);
+			bad++;
+		}
+	}
+
+	glyphs = Time(metrics, ByGlyphs);
+	advance = Time(metrics, ByAdvance);
+	label = Time(metrics, ByLabel);
+
+	printf("%u lines, %u fonts, advance tables %u bytes\n", (unsigned) LINES, 3, 3 * TEXTMETRICS_CHARS);
+	printf("glyphs   %7.1f ns per layout\n", glyphs);
+	printf("advance  %7.1f ns per layout  %.1fx\n", advance, glyphs / advance);
+	printf("label    %7.1f ns per layout  %.1fx, %u hits %u misses\n", label, glyphs / label, metrics.GetHits(), metrics.GetMisses());
+	printf("%s\n", bad ? "widths differ" : "widths match");
+	return bad ? 1 : 0;
+}
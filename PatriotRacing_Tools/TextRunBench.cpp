@@ -0,0 +1,265 @@
+/*
+
+	Program name: Bob Jones Patriot Racing text run benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	the menu text comes from SetupPages.h
+
+	draws the setup menu's labels and values and the race readouts through the panel emulator
+	(PanelEmulator.h) two ways and prints what each costs on the bus:
+		print        the way print goes through a string, the old text's box erased with a
+		             fillRect, then each glyph's bitmap box composed and sent in its own window
+		run          TextRun (PatriotRacing_TextRun.h), the whole string in one band and one window
+	command bytes are everything that isn't pixels (CASET, PASET, RAMWR and their arguments), the
+	bus time counts PANEL_TRANSACTION_US for every call as well as the bytes
+
+	before anything is counted each string is checked against the same text drawn straight into a
+	RAM screen (TextRunPlot / FontTableDrawString), the panel has to show the same pixels
+
+	TextRunBench [-m MHz]
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/TextRunBench.cpp PatriotRacing_Utilities/PatriotRacing_TextRun.cpp PatriotRacing_Utilities/PatriotRacing_TextMetrics.cpp PatriotRacing_Utilities/PatriotRacing_FontTable.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp PatriotRacing_Fonts/Arial_100_BINO.cpp PatriotRacing_Fonts/Arial_48_BINO.cpp PatriotRacing_Fonts/Arial_24_AA4.cpp -o TextRunBench
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "PanelEmulator.h"
+#include "PatriotRacing_TextRun.h"
+#include "SetupPages.h"
+#include "Adafruit_fonts.h"
+#include "Arial_100_BINO_table.h"
+#include "Arial_48_BINO_table.h"
+#include "Arial_24_AA4_table.h"
+
+#define SCREEN_W 320
+#define SCREEN_H 240
+#define BACK 0x0000
+#define FORE 0xFFFF
+#define CELL 8192               // biggest glyph cell, Arial_100_BINO is about 70 x 80
+
+struct Cost {
+	uint32_t Strings;
+	uint32_t Chars;
+	PanelFrame Print;
+	PanelFrame Run;
+};
+
+static PanelEmulator Panel;
+static TextRun Run;
+static uint16_t Screen[SCREEN_W * SCREEN_H];
+static uint16_t Cell[CELL];
+static int Fail = 0;
+
+static void Add(PanelFrame &Sum, const PanelFrame &F) {
+
+	Sum.Bytes += F.Bytes;
+	Sum.Commands += F.Commands;
+	Sum.Windows += F.Windows;
+	Sum.Pixels += F.Pixels;
+	Sum.Transactions += F.Transactions;
+	Sum.Micros += F.Micros;
+}
+
+// top of the line to the baseline, same as TextRun works it out
+static int16_t Ascent(const GFXfont *Font) {
+
+	int16_t ascent = 0;
+	uint16_t i;
+
+	for (i = 0; i <= Font->last - Font->first; i++) {
+		if (-Font->glyph[i].yOffset > ascent) {
+			ascent = -Font->glyph[i].yOffset;
+		}
+	}
+	return ascent;
+}
+
+// the way print goes, the old text's box erased, then a window per glyph for its bitmap's box
+static void PrintGFX(const GFXfont *Font, int16_t X, int16_t Y, const char *Text) {
+
+	int16_t line = Run.Height(Font);
+	int16_t base = Y + Ascent(Font);
+	const GFXglyph *g;
+	int32_t i;
+	char one[2] = {0, 0};
+
+	Panel.fillRect(X, Y, TextMetrics::GlyphWidth(Font, Text), line, BACK);
+	for (; *Text; Text++) {
+		one[0] = *Text;
+		if (((uint8_t) *Text < Font->first) || ((uint8_t) *Text > Font->last)) {
+			continue;
+		}
+		g = &Font->glyph[(uint8_t) *Text - Font->first];
+		if ((g->width > 0) && (g->width * g->height <= CELL)) {
+			for (i = 0; i < g->width * g->height; i++) {
+				Cell[i] = BACK;
+			}
+			TextRunPlot(Font, -g->xOffset, -g->yOffset, one, [&](int16_t PX, int16_t PY) {
+				Cell[PY * g->width + PX] = FORE;
+			});
+			Panel.writeRect(X + g->xOffset, base + g->yOffset, g->width, g->height, Cell);
+		}
+		X += g->xAdvance;
+	}
+}
+
+static void PrintTable(const FontTable &Table, int16_t X, int16_t Y, const char *Text) {
+
+	FontGlyph g;
+	int32_t i;
+
+	Panel.fillRect(X, Y, FontTableStringWidth(Table, Text), Run.Height(Table), BACK);
+	for (; *Text; Text++) {
+		if (!FontTableGlyph(Table, (uint8_t) *Text, g)) {
+			continue;
+		}
+		if ((g.Width > 0) && (g.Width * g.Height <= CELL)) {
+			FontCanvas c = {Cell, g.Width, g.Height, g.Width};
+
+			for (i = 0; i < g.Width * g.Height; i++) {
+				Cell[i] = BACK;
+			}
+			FontDrawGlyph(c, *Table.Font, -g.XOffset, -FontGlyphTop(*Table.Font, g), g, FORE);
+			Panel.writeRect(X + g.XOffset, Y + FontGlyphTop(*Table.Font, g), g.Width, g.Height, Cell);
+		}
+		X += g.Delta;
+	}
+}
+
+// the panel has to match the RAM screen everywhere
+static void Compare(const char *Text) {
+
+	int16_t x, y;
+
+	for (y = 0; y < SCREEN_H; y++) {
+		for (x = 0; x < SCREEN_W; x++) {
+			if (Panel.Shown(x, y) != Screen[y * SCREEN_W + x]) {
+				printf("\"%s\" differs at %d, %d\n", Text, x, y);
+				Fail++;
+				return;
+			}
+		}
+	}
+}
+
+static void Clear() {
+
+	uint32_t i;
+
+	Panel.fillScreen(BACK);
+	for (i = 0; i < SCREEN_W * SCREEN_H; i++) {
+		Screen[i] = BACK;
+	}
+}
+
+static void String(Cost &C, const GFXfont *Font, int16_t X, int16_t Y, const char *Text) {
+
+	int16_t line = Run.Height(Font);
+
+	Clear();
+	Run.Draw(Panel, X, Y, Font, Text, FORE, BACK);
+	// plotted straight onto the screen, only inside the line TextRun sends
+	TextRunPlot(Font, X, Y + Ascent(Font), Text, [&](int16_t PX, int16_t PY) {
+		if ((PX >= X) && (PX < SCREEN_W) && (PY >= Y) && (PY < Y + line) && (PY < SCREEN_H)) {
+			Screen[PY * SCREEN_W + PX] = FORE;
+		}
+	});
+	Compare(Text);
+
+	Panel.StartFrame();
+	PrintGFX(Font, X, Y, Text);
+	Add(C.Print, Panel.EndFrame());
+	Panel.StartFrame();
+	Run.Draw(Panel, X, Y, Font, Text, FORE, BACK);
+	Add(C.Run, Panel.EndFrame());
+	C.Strings++;
+	C.Chars += strlen(Text);
+}
+
+static void String(Cost &C, const FontTable &Table, int16_t X, int16_t Y, const char *Text) {
+
+	FontCanvas screen = {Screen, SCREEN_W, SCREEN_H, SCREEN_W};
+
+	Clear();
+	Run.Draw(Panel, X, Y, Table, Text, FORE, BACK);
+	FontTableDrawString(screen, Table, X, Y, Text, FORE);
+	Compare(Text);
+
+	Panel.StartFrame();
+	PrintTable(Table, X, Y, Text);
+	Add(C.Print, Panel.EndFrame());
+	Panel.StartFrame();
+	Run.Draw(Panel, X, Y, Table, Text, FORE, BACK);
+	Add(C.Run, Panel.EndFrame());
+	C.Strings++;
+	C.Chars += strlen(Text);
+}
+
+static void Report(const char *Name, const Cost &C) {
+
+	printf("%-22s %3u strings %4u chars\n", Name, C.Strings, C.Chars);
+	printf("  print  %5u windows %7u command bytes %8u bytes %8.2f ms\n", C.Print.Windows, C.Print.Bytes - C.Print.Pixels * 2, C.Print.Bytes, C.Print.Micros / 1000);
+	printf("  run    %5u windows %7u command bytes %8u bytes %8.2f ms, %.1fx less bus time, %.1fx fewer command bytes\n",
+		C.Run.Windows, C.Run.Bytes - C.Run.Pixels * 2, C.Run.Bytes, C.Run.Micros / 1000, C.Print.Micros / C.Run.Micros,
+		(double) (C.Print.Bytes - C.Print.Pixels * 2) / (C.Run.Bytes - C.Run.Pixels * 2));
+}
+
+int main(int argc, char **argv) {
+
+	Cost labels = {}, values = {}, readouts = {};
+	uint8_t p, i, c;
+	int a;
+
+	for (a = 1; a < argc; a++) {
+		if ((strcmp(argv[a], "-m") == 0) && (a + 1 < argc)) {
+			Panel.MHz = atof(argv[++a]);
+		}
+		else {
+			printf("TextRunBench [-m MHz]\n");
+			return 1;
+		}
+	}
+	if (Panel.MHz <= 0) {
+		printf("bad clock\n");
+		return 1;
+	}
+	Panel.setRotation(1);
+	printf("%.1f MHz, %.2f us per call\n", Panel.MHz, PANEL_TRANSACTION_US);
+
+	// every label and every choice in the setup menu, the labels in arial12 and the values in
+	// arial10, the titles in arialbd14
+	for (p = 0; p < SETUP_PAGES; p++) {
+		String(labels, &arialbd14, 10, 4, SetupPages[p].Title);
+		for (i = 0; i < SetupPages[p].Count; i++) {
+			const MenuScreenItem &item = SetupPages[p].Items[i];
+
+			String(labels, &arial12, 10, 40, item.Label);
+			for (c = 0; c < item.Count; c++) {
+				String(values, &arial10, 200, 40, item.Choices[c]);
+			}
+		}
+	}
+
+	// the race screen readouts
+	String(readouts, Arial_100_BINO_table, 100, 55, "25.4");
+	String(readouts, Arial_48_BINO_table, 4, 4, "18.3");
+	String(readouts, Arial_48_BINO_table, 200, 4, "24.61");
+	String(readouts, Arial_24_AA4_table, 4, 180, "12:07");
+	String(readouts, Arial_24_AA4_table, 200, 180, "-3.5%");
+
+	Report("menu labels", labels);
+	Report("menu values", values);
+	Report("race readouts", readouts);
+
+	if (Fail) {
+		printf("FAILED %d checks\n", Fail);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,117 @@
+/*
+
+	Program name: Bob Jones Patriot Racing theme table benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+	1.1    Kris 	10/19/2026	icons only, the glyph tables were 0.5x and are gone
+
+	draws the theme icons (PatriotRacing_ThemeIcons.h) on the Light theme into a mock display
+	(MockDisplay.h) two ways:
+		blend     decode and put every pixel over the background as it's drawn (ThemeRecolor),
+		          what light mode would cost without tables
+		lut       ThemeIconDraw with tables built once
+	both must come out the same, then it prints us per draw and what building a table costs
+	(that's all a theme change does)
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/ThemeBench.cpp PatriotRacing_Utilities/PatriotRacing_Theme.cpp PatriotRacing_Utilities/PatriotRacing_IconPack.cpp -o ThemeBench
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "PatriotRacing_Theme.h"
+#include "PatriotRacing_ThemeIcons.h"
+#include "MockDisplay.h"
+
+#define LIGHT_BACK 0xFFFF
+#define BENCH_MS 200
+
+struct BenchIcon {
+	const char *Name;
+	const PackedIcon *Icon;
+};
+
+static const BenchIcon Icons[] = {
+	{"graph_icon_theme", &graph_icon_theme},
+	{"cyborg_icon_theme", &cyborg_icon_theme},
+	{"car_icon_theme", &car_icon_theme},
+	{"calibrate_icon_theme", &calibrate_icon_theme},
+	{"clock_icon_theme", &clock_icon_theme},
+	{"GPUSA_Logo_theme", &GPUSA_Logo_theme},
+};
+
+static MockDisplay Blend;
+static MockDisplay Lut;
+
+// us per call of Draw, run for BENCH_MS
+template <class DrawFunc>
+static double Time(DrawFunc &&Draw) {
+
+	uint32_t reps = 0;
+	double sec;
+
+	auto start = std::chrono::steady_clock::now();
+	do {
+		Draw();
+		reps++;
+		sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	} while (sec * 1000 < BENCH_MS);
+	return sec * 1e6 / reps;
+}
+
+// the icon recolored a pixel at a time as it's decoded
+static void BlendIcon(const PackedIcon &Icon) {
+
+	uint16_t band[ICONPACK_BAND];
+	uint16_t rows = ICONPACK_BAND / Icon.Width;
+	uint32_t i, n;
+	uint16_t y, r;
+	IconReader reader;
+
+	reader.Begin(Icon);
+	for (y = 0; y < Icon.Height; y += r) {
+		r = (Icon.Height - y < rows) ? Icon.Height - y : rows;
+		n = reader.Read(band, (uint32_t) r * Icon.Width);
+		for (i = 0; i < n; i++) {
+			band[i] = ThemeRecolor(band[i], LIGHT_BACK);
+		}
+		Blend.writeRect(0, y, Icon.Width, r, band);
+	}
+}
+
+int main() {
+
+	static ThemeLUT table;
+	double blend, lut, build;
+	uint8_t i;
+	int bad = 0;
+
+	printf("icon                     blend us   lut us   speedup\n");
+	for (i = 0; i < sizeof(Icons) / sizeof(Icons[0]); i++) {
+		const PackedIcon &icon = *Icons[i].Icon;
+
+		ThemeIconLUT(table, icon, LIGHT_BACK);
+		Blend.Clear(LIGHT_BACK);
+		Lut.Clear(LIGHT_BACK);
+		BlendIcon(icon);
+		ThemeIconDraw(Lut, 0, 0, icon, table);
+		if (memcmp(Blend.Pixels, Lut.Pixels, sizeof(Blend.Pixels)) != 0) {
+			printf("%s differs\n", Icons[i].Name);
+			bad++;
+			continue;
+		}
+
+		blend = Time([&]() { BlendIcon(icon); });
+		lut = Time([&]() { ThemeIconDraw(Lut, 0, 0, icon, table); });
+		printf("%-24s %8.2f %8.2f   %5.1fx\n", Icons[i].Name, blend, lut, blend / lut);
+	}
+
+	build = Time([&]() { ThemeIconLUT(table, graph_icon_theme, LIGHT_BACK); });
+	printf("icon table build %.2f us, %u bytes each\n", build, (unsigned) sizeof(ThemeLUT));
+	return bad ? 1 : 0;
+}
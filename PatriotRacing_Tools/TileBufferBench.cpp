@@ -0,0 +1,211 @@
+/*
+
+	Program name: Bob Jones Patriot Racing tile buffer benchmark
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation
+
+	draws 500 frames of a race screen (big speed readout, amps / volts / clock readouts and a strip
+	chart along the bottom) three ways, one frame every FRAME_US, and reports the bytes on the bus and
+	how long the CPU is tied up per frame:
+		direct    straight to the panel like the screens do today, the CPU waits for every byte
+		buffer    full screen TileBuffer, flushed through a port that acts like DMA (busy for as
+		          long as the bytes take at SPI_HZ, on a simulated clock)
+		budget    only the readouts are buffered (BUDGET_H rows), the chart is still drawn direct
+		          before the buffer is flushed so it doesn't wait on the port
+	at the end the mock panel must match what was drawn direct. the buffer sends whole tiles so it
+	puts more bytes on the bus than direct, the win is that the CPU isn't waiting for them
+
+	build (from the repo root)
+	g++ -std=gnu++17 -O2 -IPatriotRacing_Tools -IPatriotRacing_Utilities -IPatriotRacing_Fonts PatriotRacing_Tools/TileBufferBench.cpp PatriotRacing_Utilities/PatriotRacing_TileBuffer.cpp PatriotRacing_Utilities/PatriotRacing_NumberField.cpp PatriotRacing_Utilities/PatriotRacing_GlyphCache.cpp PatriotRacing_Utilities/PatriotRacing_Font.cpp PatriotRacing_Fonts/Arial_100_BINO.cpp PatriotRacing_Fonts/Arial_48BINO.cpp -o TileBufferBench
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+#include "PatriotRacing_TileBuffer.h"
+#include "PatriotRacing_NumberField.h"
+#include "Arial_100_BINO.h"
+#include "Arial_48BINO.h"
+#include "MockDisplay.h"
+
+#define FRAMES 500
+#define FRAME_US 20000        // 50 updates a second
+#define SPI_HZ 30000000.0     // display SPI clock
+#define BACK 0x0000
+#define FORE 0xFFFF
+#define DATA_Y 55             // same as PatriotRacing_Utilities.h
+#define CHART_Y 176           // strip chart across the bottom
+#define CHART_H 60
+#define BUDGET_H 168          // 320 x 168 x 2 = 107k instead of 150k
+
+// simulated time in us, the frames and the bus both run on it
+static double Now = 0;
+
+static double BusMicros(uint32_t Bytes) {
+	return Bytes * 8 / SPI_HZ * 1e6;
+}
+
+// acts like the DMA port, the pixels land right away but it stays busy for as long as SPI would take
+struct MockDMAPort {
+
+	MockDisplay &D;
+	double Until;
+
+	MockDMAPort(MockDisplay &D) : D(D), Until(0) {
+	}
+
+	bool Busy() const {
+		return Now < Until;
+	}
+
+	void Send(const TileRect *Rect, uint8_t Count) {
+
+		uint32_t before = D.Bytes();
+		uint8_t i;
+		int16_t row;
+
+		// one window per rectangle with the rows streamed into it, like the real port
+		for (i = 0; i < Count; i++) {
+			for (row = 0; row < Rect[i].H; row++) {
+				memcpy(&D.Pixels[(Rect[i].Y + row) * MOCK_W + Rect[i].X], Rect[i].Pixels + (int32_t) row * Rect[i].Stride, Rect[i].W * sizeof(uint16_t));
+			}
+			D.Windows++;
+			D.Pushed += (uint32_t) Rect[i].W * Rect[i].H;
+		}
+		Until = Now + BusMicros(D.Bytes() - before);
+	}
+};
+
+static GlyphCache Big;
+static GlyphCache Small;
+static uint16_t Frame[MOCK_W * MOCK_H];
+static MockDisplay Direct;
+static MockDisplay Panel;
+
+struct Readouts {
+	NumberField Speed;
+	NumberField Amps;
+	NumberField Volts;
+	NumberField Clock;
+
+	void Begin() {
+		Speed.Begin(Big, 300, DATA_Y, NUMBERFIELD_RIGHT);
+		Amps.Begin(Small, 4, 4, NUMBERFIELD_LEFT);
+		Volts.Begin(Small, 316, 4, NUMBERFIELD_RIGHT);
+		Clock.Begin(Small, 110, 4, NUMBERFIELD_LEFT);
+	}
+
+	template <class Target>
+	void Draw(Target &T, uint32_t n) {
+
+		char clock[8];
+
+		Speed.Print(T, 25.0f + 10.0f * sinf(n * 0.01f), 1);
+		Amps.Print(T, 18.0f + 4.0f * sinf(n * 0.13f), 1);
+		Volts.Print(T, 24.6f - n * 0.001f, 1);
+		snprintf(clock, sizeof(clock), "%02u:%02u", (unsigned) ((n / 50 / 60) % 60), (unsigned) ((n / 50) % 60));
+		Clock.Print(T, clock);
+	}
+};
+
+// strip chart cursor, clear a column and plot
+template <class Target>
+static void DrawChart(Target &T, uint32_t n) {
+
+	int16_t x = n % MOCK_W;
+	int16_t y = CHART_Y + CHART_H / 2 - (int16_t) ((CHART_H / 2 - 1) * sinf(n * 0.05f));
+
+	T.drawFastVLine(x, CHART_Y, CHART_H, BACK);
+	T.drawPixel(x, y, 0x07E0);
+}
+
+int main() {
+
+	Readouts direct, buffered, budget;
+	TileBuffer tiles;
+	MockDMAPort port(Panel);
+	uint32_t n, rects, bytes;
+	double cpu, bus;
+	int fail = 0;
+
+	Big.Begin(Arial_100_BINO, "-.0123456789:", FORE, BACK);
+	Small.Begin(Arial_48BINO, "-.0123456789:", FORE, BACK);
+
+	// direct, the draw calls block until their bytes are out
+	direct.Begin();
+	Direct.Clear(BACK);
+	auto start = std::chrono::steady_clock::now();
+	for (n = 0; n < FRAMES; n++) {
+		direct.Draw(Direct, n);
+		DrawChart(Direct, n);
+	}
+	cpu = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e6 / FRAMES;
+	bus = BusMicros(Direct.Bytes()) / FRAMES;
+	printf("direct  %6.0f bytes/frame, CPU busy %7.1f us/frame (%.1f drawing + %.1f waiting on SPI)\n", (double) Direct.Bytes() / FRAMES, cpu + bus, cpu, bus);
+
+	// full screen buffer, the CPU only draws and starts the flush
+	buffered.Begin();
+	Panel.Clear(BACK);
+	memset(Frame, 0, sizeof(Frame));
+	tiles.Begin(Frame, 0, 0, MOCK_W, MOCK_H);
+	port.Until = Now = 0;
+	cpu = 0;
+	rects = 0;
+	for (n = 0; n < FRAMES; n++, Now += FRAME_US) {
+		tiles.BeginFrame();
+		buffered.Draw(tiles, n);
+		DrawChart(tiles, n);
+		tiles.EndFrame(port);
+		cpu += tiles.GetStats().DrawMicros + tiles.GetStats().FlushMicros;
+		rects += tiles.GetStats().Rects;
+	}
+	Now = port.Until;
+	tiles.Flush(port);
+	printf("buffer  %6.0f bytes/frame, CPU busy %7.1f us/frame, %.1f rects/frame, %u flushes deferred\n", (double) Panel.Bytes() / FRAMES, cpu / FRAMES, (double) rects / FRAMES, tiles.GetStats().Deferred);
+	if (memcmp(Panel.Pixels, Direct.Pixels, sizeof(Panel.Pixels)) != 0) {
+		printf("  panel differs from direct drawing\n");
+		fail++;
+	}
+
+	// memory budget, the readouts go through the buffer and the chart goes direct
+	budget.Begin();
+	Panel.Clear(BACK);
+	memset(Frame, 0, sizeof(Frame));
+	tiles.Begin(Frame, 0, 0, MOCK_W, BUDGET_H);
+	if (!tiles.Covers(0, DATA_Y, MOCK_W, Big.GetHeight()) || tiles.Covers(0, CHART_Y, 1, CHART_H)) {
+		printf("  Covers is wrong\n");
+		fail++;
+	}
+	port.Until = Now = 0;
+	cpu = 0;
+	rects = 0;
+	for (n = 0; n < FRAMES; n++, Now += FRAME_US) {
+		// the direct drawing goes first, while the bus is free, then the buffer starts sending
+		if (port.Until > Now) {
+			cpu += port.Until - Now;
+		}
+		bytes = Panel.Bytes();
+		DrawChart(Panel, n);
+		cpu += BusMicros(Panel.Bytes() - bytes);
+
+		tiles.BeginFrame();
+		budget.Draw(tiles, n);
+		tiles.EndFrame(port);
+		cpu += tiles.GetStats().DrawMicros + tiles.GetStats().FlushMicros;
+		rects += tiles.GetStats().Rects;
+	}
+	Now = port.Until;
+	tiles.Flush(port);
+	printf("budget  %6.0f bytes/frame, CPU busy %7.1f us/frame, %.1f rects/frame, buffer %u bytes\n", (double) Panel.Bytes() / FRAMES, cpu / FRAMES, (double) rects / FRAMES, (unsigned) (MOCK_W * BUDGET_H * sizeof(uint16_t)));
+	if (memcmp(Panel.Pixels, Direct.Pixels, sizeof(Panel.Pixels)) != 0) {
+		printf("  panel differs from direct drawing\n");
+		fail++;
+	}
+
+	return fail ? 1 : 0;
+}
@@ -21,6 +21,7 @@
 	15.0   Kris 	03/09/2025  added direction text for accelerometer install direction
 	16.0   Kris 	03/14/2026  move #defines that are not changeable
 	16.1   Kris 	05/27/2026  added CYBORG selector for amps 
+	16.2   Kris 	10/19/2026  value tables const so they stay in flash
 
 */
 
@@ -234,7 +235,7 @@ const char *SendTimeText[] = 	{"Off", "1 sec", "2 sec", "3 sec", "4 sec","5 sec"
 // so let's wait a few seconds until the car starts moving
 // or if start location is not on the track	
 const char *GPSReadTimeText[] = 	{"0 sec", "5 sec", "10 sec", "20 sec"};  // text for the menu option
-uint32_t GPSReadTime[] = {0, 5000, 10000, 20000}; // actual delay value in millis
+const uint32_t GPSReadTime[] = {0, 5000, 10000, 20000}; // actual delay value in millis
 
 // index of array matches distance in meters, value==element number
 
@@ -243,7 +244,7 @@ const char *GPSToleranceText[] = {"Off", "3 ft", "6 ft", "9 ft", "13 ft","16 ft"
   
 // accelerometer 
 const char *AccelFSRange[] = 	{"+/- 2 G", "+/- 4 G", "+/- 8 G", "+/- 16 G"};  
-float AccelFSBits[] = {16384.0, 8192.0, 4096.0, 2048.0};
+const float AccelFSBits[] = {16384.0, 8192.0, 4096.0, 2048.0};
 const char *AccelLPFilterText[] = 	{"256 Hz", "188 Hz", "98 Hz", "42 Hz", "20 Hz", "10 Hz", "5 Hz"}; 
 const char *AccelHPFilterText[] = 	{"Off", "5 Hz", "2.5 Hz", "1.25 Hz", "0.63 Hz"}; 
 const char *CarText[] = {"Blue", "Red", "White"};  
@@ -273,7 +274,7 @@ note the last element is for the data logger test stand so the car speed is some
  spit the difference 58.625, r = 9.3304664198
 */
 
-float TireRadius[] = {9.3304664198, 9.085624504, 9.012156264821, 9.085624504, 1.95 }; 
+const float TireRadius[] = {9.3304664198, 9.085624504, 9.012156264821, 9.085624504, 1.95 }; 
 
 
 
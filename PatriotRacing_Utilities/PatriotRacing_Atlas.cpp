@@ -0,0 +1,3269 @@
+/*
+
+	Program name: Bob Jones Patriot Racing sprite atlas data
+
+	made by PatriotRacing_Tools/AtlasBuild from PatriotRacing_Icons.h and GPUSA_Icons.h, don't
+	edit, change the icon and run it again
+
+*/
+
+#include "PatriotRacing_Atlas.h"
+
+#ifndef PROGMEM
+ #define PROGMEM
+#endif
+
+const uint32_t AtlasWords[ATLAS_WORDS] PROGMEM = {
+	// graph_icon565, 32x32px
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+	0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21ad0003, 0x5b753a92, 0x7c577437,
+	0x7c577c57, 0x42d36bd6, 0x00044290, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x42d30004, 0x74376bf6, 0x957e953c, 0x851d853d,
+	0x84fd851d, 0x955d8d3e, 0x74376c18, 0x00874af3, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x2a0f0000, 0x84b963d6, 0x957d9d9e, 0x8d5d8d5d, 0x853d8d3d,
+	0x8d3e851d, 0x7cfd84fd, 0x7cdd7cdd, 0x6bf684fc, 0x000042b2, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x7c5742d3, 0x9d9da5de, 0x957d957d, 0x8d5d955d, 0x8d3d8d3d,
+	0x851d8d3e, 0x7cfe851e, 0x7cde7cde, 0x7cde74de, 0x5b75747a, 0x00000024, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x4b340000, 0xa5be8cd9, 0x9d9e9dbe, 0x957e959e, 0x8d5e957e, 0x8d3e8d5e,
+	0x851e8d3e, 0x84fe851e, 0x7cfe7cfe, 0x74be7cde, 0x7cbc74be, 0x00045b96, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x8cd942d4, 0xa5dea5de, 0x9dbe9dbe, 0x959e9d9e, 0x957e957e, 0x8d5e8d5e,
+	0x853e8d3e, 0x851e851e, 0x7cfe84fe, 0x74de7cfe, 0x74be74be, 0x5b757cbc, 0x00000000, 0x00000000,
+	0x00000000, 0x2a100000, 0xa5fe7458, 0xa5ffa5fe, 0xa5dfa5ff, 0x9ddfa5df, 0xa5ff9ddf, 0x959f9dbf,
+	0x959f959f, 0x957f957f, 0x8d7f8d7f, 0x957f8d7f, 0x8d3f8d5f, 0x7c9b74be, 0x000042d3, 0x00000000,
+	0x00000000, 0x5b960005, 0xae1eae3f, 0xae1fd73f, 0xa5ffa61f, 0xa5ffa5ff, 0xae1fceff, 0x9dbf9dbf,
+	0x9dbf9dbf, 0xcf1f959f, 0x959f959f, 0x8d7f959f, 0xc6df8d7f, 0x74bf851f, 0x194b63f8, 0x00000000,
+	0x00000000, 0x8d1a3273, 0xae1fae3f, 0xae1fe79f, 0xa5ffa5ff, 0xa5df9ddf, 0xa5ffd73f, 0x957f959f,
+	0x8d5f8d7f, 0xdf5f8d5f, 0x853f853f, 0x7d1f851f, 0xd71f7cff, 0x74df853f, 0x4b15851f, 0x00000000,
+	0x00040000, 0xb65f5376, 0xae3fae3f, 0xae1fe79f, 0xa5ffa61f, 0xa5dfae3f, 0xa5ffd73f, 0x959f959f,
+	0x8d7f957f, 0xdf7f8d5f, 0x851f957f, 0x7d1f851f, 0xd71f7cff, 0x74df853f, 0x6c3974df, 0x0000194a,
+	0x114d0000, 0xb65f7458, 0xae5fb65f, 0xae3fe7bf, 0xae1fae1f, 0xa5ffa5ff, 0xa61fd73f, 0x959f9dbf,
+	0x957f959f, 0xdf7f957f, 0xae5fa5ff, 0x851f851e, 0xd73f7d1f, 0x7cff853f, 0x84fe7cff, 0x00002211,
+	0x19d20000, 0xb67fadfd, 0xb65fb65f, 0xb65fefbf, 0xae3fb65f, 0xae1fae3f, 0xae3fdf5f, 0xa5ffa5ff,
+	0xa5dfa5df, 0xefdf9dbf, 0xc69fdf5f, 0x853fd73f, 0xd75f8d7f, 0x851f8d5f, 0x74ff7cff, 0x00004315,
+	0x2a740000, 0xbe7fb67f, 0xb67fb67f, 0xae3fefdf, 0xa61fa61f, 0xa5ffa5ff, 0xae5fdf7f, 0x9ddf9dff,
+	0xae3f9ddf, 0xffffdf5f, 0x9dbfae3f, 0xd73fceff, 0xdf7fceff, 0x851f8d7f, 0x74ff7cff, 0x00044b37,
+	0x32950001, 0xbe9fbe9f, 0xb67fbe7f, 0xb67fefbf, 0xae1fae5f, 0xceff9dbf, 0xae3fdf5f, 0x9ddfa5ff,
+	0xceff957e, 0xe79fb65f, 0x8d7f8d9f, 0x8d5f8d5f, 0xf7ffd6ff, 0x7d1f8d7f, 0x7d1f7d1f, 0x00075399,
+	0x32950003, 0x8d5e8d5d, 0x8d5e8d5e, 0x957fdf7f, 0xae3f957e, 0x957ec69f, 0xa61ff7ff, 0x8d7e8d5f,
+	0x959fceff, 0xdf7f853f, 0x7d1f853f, 0x7d1f7d1f, 0xe77f7cff, 0x74ff853f, 0x74df74df, 0x000953ba,
+	0x11d40003, 0x01340113, 0x01550155, 0x4b9abe7f, 0x5bfabe7f, 0x01d901b9, 0xae1e9dbf, 0xbe7fbe9f,
+	0x0a3c22bc, 0xc6bf0a3d, 0x127e127d, 0x1a9e127e, 0xa61f127e, 0x1a9e335f, 0x1a9e1a9e, 0x00082aba,
+	0x11b40002, 0x0031000f, 0x00110011, 0xd73fb63f, 0x011632b7, 0x01570136, 0x22ba955e, 0x09d94b7a,
+	0x017a0179, 0xbe7f017a, 0x019c019b, 0x01dc01dc, 0x9dbf01bc, 0x00dc01dd, 0x00dc00dc, 0x00061219,
+	0x11d50000, 0x000f002f, 0x0010000f, 0x84dbb63f, 0x53bb53bb, 0x53fc53bb, 0x6c9dbe9f, 0x53fc53fc,
+	0x53fd53fc, 0xd73f53fd, 0x5c3e541d, 0x541e541e, 0xc6df541e, 0x00dc01dd, 0x00dc00dc, 0x00041a38,
+	0x01130000, 0x000d00f0, 0x000e000e, 0x0031adfe, 0x00110011, 0x00330032, 0x01777cdd, 0x00560035,
+	0x00770056, 0xae3f0078, 0x00b900b9, 0x009a009a, 0x959f00bb, 0x00dc01dd, 0x00fd00dc, 0x00002a75,
+	0x002c0000, 0x000c2214, 0x000d000c, 0x0010adfe, 0x0010000f, 0x001100b2, 0x01567cbc, 0x00340014,
+	0x00560035, 0xae1f0056, 0x00780119, 0x00990099, 0x957f009a, 0x00bb01bc, 0x0a1c00bc, 0x000019b2,
+	0x00040000, 0x000a3ad6, 0x000c000b, 0x000eadfe, 0x000f000e, 0x0010000f, 0x01357cbc, 0x00130012,
+	0x00340014, 0xa61f0096, 0x00770077, 0x00790078, 0x8d7f0079, 0x00bb019c, 0x331c011c, 0x00000007,
+	0x00000000, 0x09500952, 0x000a000a, 0x004eadfd, 0x000e000e, 0x000f000e, 0x017484db, 0x00320011,
+	0x00940032, 0xa5ff0074, 0x00760076, 0x00970097, 0x957f0098, 0x00da017b, 0x42f700da, 0x00000000,
+	0x00000000, 0x53770005, 0x00090009, 0x6c7c6c17, 0x645c645c, 0x645c645c, 0x6c7c8d3c, 0x647d645d,
+	0x647d6c7d, 0x8d5e647d, 0x647e647e, 0x647f647e, 0x8d7f647f, 0x0079017a, 0x000a3b3c, 0x00000000,
+	0x00000000, 0x00af0000, 0x00083ab4, 0x00090009, 0x000a000a, 0x000b000b, 0x000d000c, 0x000e000d,
+	0x0010000f, 0x00110010, 0x00130012, 0x00340013, 0x00360035, 0x01990056, 0x00003295, 0x00000000,
+	0x00000000, 0x00000000, 0x116f2a55, 0x00080008, 0x00090008, 0x000a0009, 0x000b000a, 0x000d000c,
+	0x000e000d, 0x000f000f, 0x00110010, 0x00120012, 0x00340013, 0x5bda00b5, 0x00000002, 0x00000000,
+	0x00000000, 0x00000000, 0x43170003, 0x0007114e, 0x00080008, 0x00090008, 0x000b0009, 0x000b000a,
+	0x000c000c, 0x000e000d, 0x000f000e, 0x00310010, 0x00930012, 0x0006641a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00020000, 0x32723ad6, 0x00070007, 0x00080008, 0x00090009, 0x000a0009,
+	0x000b000a, 0x000c000c, 0x000e000d, 0x000f000f, 0x64190133, 0x00000006, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x11710000, 0x006b6c18, 0x00080007, 0x00080008, 0x00090008,
+	0x000a0009, 0x000b000a, 0x000d000b, 0x5378000e, 0x000242f6, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4b360007, 0x198e6c37, 0x00070007, 0x00080007,
+	0x00090008, 0x000a0009, 0x5b97010f, 0x002a63d8, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x19d20006, 0x63d763d8, 0x5b9563b6,
+	0x63b75b96, 0x6bf863f8, 0x00073ab5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00050004,
+	0x00040005, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// sssgraph_icon565, 32x32px
+	0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4,
+	0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4,
+	0x20e420e4, 0x20e420e4, 0x20e420e4, 0x210420e3, 0x1a2419e4, 0x1a241a24, 0x1a241a24, 0x1a241a24,
+	0x1a241a24, 0x1a241a24, 0x1a241a24, 0x19c41a04, 0x20e42104, 0x20e420e4, 0x20e420e4, 0x20e420e4,
+	0x20e420e4, 0x20e320e4, 0x1a4420e3, 0x0f2a0d87, 0x0f4b0f4b, 0x172b172b, 0x172b172b, 0x170b170b,
+	0x16eb170b, 0x16ca16cb, 0x168a16aa, 0x1649166a, 0x14651608, 0x20e419e4, 0x20e420e4, 0x20e420e4,
+	0x20e420e4, 0x20e320e4, 0x0f4a1446, 0x16ee16ed, 0x1eed16ee, 0x1ecd1ece, 0x1ead1ecd, 0x1e8d1ead,
+	0x266d266d, 0x262d264d, 0x260c260c, 0x2dcc25ec, 0x2d8b2dac, 0x12831d28, 0x20e420e3, 0x20e420e4,
+	0x20e420e4, 0x144620e3, 0x170e0f4c, 0x16ee170e, 0x1eee1eee, 0x1ece1eee, 0x1ead1ece, 0x268d26ad,
+	0x266d268d, 0x264d264d, 0x260c262d, 0x2dcc2dec, 0x2d8b2dac, 0x24a82d8b, 0x20e41203, 0x20e420e4,
+	0x20e420e4, 0x0f4b1a44, 0x170e170e, 0x1f0e170e, 0x1eee1f0e, 0x1eee1eee, 0x1ece1ece, 0x26ae26ad,
+	0x266d268d, 0x264d266d, 0x260c262d, 0x2dac2dec, 0x2d4b2489, 0x2d6b2d8b, 0x19a41c47, 0x20e420e4,
+	0x20e320e4, 0x16ed0d87, 0x170e170e, 0x1f0e1f0e, 0x1f0e1f0e, 0x1eee1eee, 0x26ce1eee, 0x26ae26ae,
+	0x268d268e, 0x264d266d, 0x2e2d2e2d, 0x1b672e0c, 0x12c61245, 0x356b2d8b, 0x0b65250a, 0x20e420e4,
+	0x212320e3, 0x16ee0f2a, 0x1f0e16ee, 0x1f0e1f0e, 0x1f0e1f0e, 0x1eee1eee, 0x26ce26ee, 0x26ae26ae,
+	0x268d268e, 0x264d266d, 0x2e2d2e2d, 0x1285256b, 0x12a51245, 0x2d6b2d8b, 0x04a704c7, 0x20e42124,
+	0x1a0420e3, 0x16ee0f4b, 0x1f0e1eee, 0x1f0e1f0e, 0x1f0e1f0e, 0x26ee1eee, 0x26ce26ee, 0x26ae26ce,
+	0x2e8d268e, 0x2e4d2e6d, 0x2dec2e4d, 0x124512e6, 0x2d2b1b67, 0x1508358c, 0x04c704a6, 0x20e419e5,
+	0x1a4420e3, 0x1eee0f2b, 0x1eee1eee, 0x1f0e1f0e, 0x26ee1f0e, 0x26ee26ee, 0x1cca1d6b, 0x26ae268d,
+	0x2e8e268e, 0x2e4d2e6d, 0x1b672e2d, 0x1b471265, 0x35ac2dac, 0x04c71d49, 0x04e704a6, 0x20e41a45,
+	0x1a4420e4, 0x1ece172b, 0x1eee1eee, 0x1eee1eee, 0x26ee26ee, 0x1e2d26ee, 0x0aa60ac6, 0x264d13e8,
+	0x2e8e2e8e, 0x2e4d2e6d, 0x12651be8, 0x2dac1b06, 0x1d6a35cc, 0x04c70507, 0x05080486, 0x20e41a66,
+	0x1a4420e4, 0x1ece172b, 0x1eee1ece, 0x1eee1eee, 0x26ee26ee, 0x13c826ae, 0x12a60aa5, 0x12c612a6,
+	0x2e2d1c69, 0x24692e6d, 0x12c61265, 0x1b8724ea, 0x03241367, 0x04c70426, 0x05280486, 0x20e41a86,
+	0x1a4420e4, 0x1ecd172b, 0x1ece1ece, 0x26ee1eee, 0x26ae26ee, 0x0aa513c8, 0x258c1367, 0x12a61c49,
+	0x12c61285, 0x12851ba8, 0x2d4b1285, 0x0a4424ca, 0x02030203, 0x04a60385, 0x05480466, 0x20e41aa6,
+	0x1a4420e4, 0x1ead172b, 0x1ece1ead, 0x26ce26ce, 0x13c826ad, 0x136712a6, 0x2eae264d, 0x260d2e8e,
+	0x12a51c29, 0x12651285, 0x360d248a, 0x02231ca9, 0x02030203, 0x04860365, 0x05690466, 0x20e41aa7,
+	0x1a4420e4, 0x1ead170b, 0x26ad1ead, 0x268d26ae, 0x0aa613c8, 0x1c291347, 0x13671367, 0x2e4d1387,
+	0x252b2e6e, 0x12c61285, 0x1dcb2dac, 0x02030446, 0x01e20203, 0x04860364, 0x05480446, 0x20e41aa6,
+	0x1a4420e4, 0x268d170b, 0x26ae268d, 0x13061d0a, 0x13470aa5, 0x13a8264d, 0x12a612a6, 0x2e2d1285,
+	0x2e4d2e6d, 0x2ded2dec, 0x056815ca, 0x02030446, 0x01e20203, 0x04660344, 0x05080445, 0x20e41a66,
+	0x1a4420e4, 0x266d16eb, 0x268d268d, 0x0a851306, 0x262d0ac6, 0x13a82e8e, 0x128512a6, 0x2e2d1285,
+	0x2e4d2e4d, 0x15ca2e2d, 0x05680588, 0x02030426, 0x01e201e2, 0x04660344, 0x04c70425, 0x20e41a46,
+	0x1a4420e4, 0x266d16eb, 0x268d266d, 0x12a61c69, 0x2e8e1c69, 0x1ba72e8e, 0x12851285, 0x2e0d1285,
+	0x12c62e2d, 0x02630284, 0x05470324, 0x02030406, 0x01c201e2, 0x04450324, 0x04860405, 0x20e41a25,
+	0x1a4420e4, 0x264d16cb, 0x266d264d, 0x264d266d, 0x2e6d2e6d, 0x1b872e6d, 0x12851285, 0x2dec1265,
+	0x0243260c, 0x02230223, 0x052702e4, 0x01e20405, 0x01c201c2, 0x04250324, 0x04460405, 0x20e419e5,
+	0x1a4420e4, 0x262d16cb, 0x264d264d, 0x260c260c, 0x2e4d260d, 0x1b872e4d, 0x12651285, 0x25cb1265,
+	0x02230589, 0x02230223, 0x050702c4, 0x01e203e5, 0x01c201c2, 0x04050304, 0x03e503e4, 0x20e419c4,
+	0x1a4420e4, 0x260c16aa, 0x1cca262d, 0x12850a85, 0x24ea1265, 0x1b872e2d, 0x12651265, 0x05680a44,
+	0x02230568, 0x02030223, 0x04e702a4, 0x01c203c5, 0x01a201c2, 0x03e502e3, 0x03a403c4, 0x20e419a4,
+	0x1a2420e4, 0x260c168a, 0x1ca9260c, 0x12651265, 0x24ca1265, 0x1b672e2d, 0x02441265, 0x05480223,
+	0x02030548, 0x02030203, 0x04c702a4, 0x01c203a5, 0x01a201a2, 0x03c402e3, 0x036303a4, 0x20e41963,
+	0x1a2420e4, 0x25ec1e6a, 0x1c892dec, 0x12651265, 0x24aa1265, 0x13472e0d, 0x02230243, 0x05270223,
+	0x02030527, 0x01e20203, 0x04a60283, 0x01a20385, 0x018201a2, 0x03a402c3, 0x03230384, 0x20e41963,
+	0x1a0420e4, 0x2dcc1e2a, 0x24692dcc, 0x12451245, 0x248a1265, 0x03051dcb, 0x02230223, 0x04e70203,
+	0x020204e7, 0x01e201e2, 0x04660263, 0x01a20364, 0x018101a2, 0x038402a3, 0x02e20363, 0x20e41943,
+	0x214420e4, 0x2dac1608, 0x1ba82d8b, 0x12451245, 0x0ba61244, 0x02a40466, 0x02030223, 0x03e50203,
+	0x01e203e5, 0x01c201c2, 0x03840223, 0x01a202c3, 0x01810181, 0x03430222, 0x02c20343, 0x20e41923,
+	0x20e420e4, 0x2d8b0c86, 0x12452469, 0x0a241245, 0x02030223, 0x02030203, 0x02030203, 0x01e201e2,
+	0x01c201e2, 0x01c201c2, 0x01a201a2, 0x01810182, 0x01610181, 0x02620161, 0x0a620303, 0x20e420e3,
+	0x20e420e4, 0x1d281a44, 0x1b8724ea, 0x03440b65, 0x03440344, 0x03240324, 0x03040324, 0x02e40304,
+	0x02c302e4, 0x02a302c3, 0x028302a3, 0x02620263, 0x02220242, 0x02c20202, 0x118302c2, 0x20e420e3,
+	0x20e420e4, 0x12c320e4, 0x0d081cc9, 0x04e704e7, 0x04e704e7, 0x04c704c7, 0x04a604a6, 0x04660486,
+	0x04450466, 0x04050425, 0x03c403e5, 0x038403a4, 0x03430363, 0x02e20323, 0x20e30a22, 0x20e420e4,
+	0x20e420e4, 0x210320e4, 0x04660a83, 0x04a704c7, 0x04a604a7, 0x048604a6, 0x04660486, 0x04450466,
+	0x04050425, 0x03e40405, 0x03a403c4, 0x03630384, 0x03230343, 0x0a2202e2, 0x20e42103, 0x20e420e4,
+	0x20e420e4, 0x20e320e4, 0x122420e4, 0x04a70406, 0x04c704c7, 0x04e704c7, 0x04e804e7, 0x04a704e7,
+	0x04460486, 0x03c40405, 0x036303a4, 0x03030323, 0x028202e2, 0x20e311a3, 0x20e420e4, 0x20e420e4,
+	0x20e420e4, 0x20e420e4, 0x20e420e4, 0x19c520e4, 0x130712a6, 0x13681327, 0x13a81388, 0x13271368,
+	0x12a612e6, 0x12241265, 0x11c31204, 0x11831183, 0x20e31943, 0x20e420e4, 0x20e420e4, 0x20e420e4,
+	0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e320e3, 0x20e320e3, 0x20e320e3, 0x20e320e3,
+	0x20e320e3, 0x20e420e4, 0x20e320e4, 0x20e320e3, 0x20e420e4, 0x20e420e4, 0x20e420e4, 0x20e420e4,
+	// cyborg_icon565, 32x32px
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x51810820, 0xcbe39303, 0xf3c0ec21,
+	0xd220f2e0, 0x60c0a180, 0x00001840, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x72a40820, 0xfe6cedab, 0xfd21fdc6, 0xfc20fca0,
+	0xfb00fb80, 0xea40faa0, 0x9100d1c0, 0x00002840, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x31220000, 0xff76ddef, 0xfecfff53, 0xfe03fe69, 0xfcc0fd60,
+	0xfba0fc20, 0xfaa0fb20, 0xd9c0ea40, 0x70c0c960, 0x00000800, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0xf6d349c3, 0xfffeffdc, 0xff32ffb8, 0xfe44feeb, 0xfd20fdc0,
+	0xfc00fca0, 0xfb20fb80, 0xea40faa0, 0xc160d1c0, 0x10209900, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x39620000, 0xff76f68f, 0xffdcffdc, 0xff31ff98, 0xfe43feca, 0xfd20fdc0,
+	0xfc00fca0, 0xfb40fba0, 0xfa80fb00, 0xd180e220, 0xa120c160, 0x00000800, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0xe58a0840, 0xff32feae, 0xff75ff75, 0xff0cff52, 0xfe01fe86, 0xfd00fd80,
+	0xfbe0fc80, 0xfb40fba0, 0xfac0fb20, 0xd9e0f260, 0xc980c960, 0x00008100, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0xfe2a82e3, 0xfeacfe6b, 0xfeecfeed, 0xfe86feca, 0xfda0fe22, 0xfca0fd40,
+	0xfbc0fc40, 0xfb40fb80, 0xfac0fb20, 0xe220f260, 0xc980d1a0, 0x3080d180, 0x00000000, 0x00000000,
+	0x00000000, 0x08200000, 0xfd86ed05, 0xfdc8fda8, 0xfdc5fde7, 0xfd21fd43, 0xfd20fd80, 0xfc40fcc0,
+	0xfba0fbe0, 0xfb60fb60, 0xfbe0fc21, 0xf300fb80, 0xc980ea40, 0xa160c980, 0x00000000, 0x00000000,
+	0x00000000, 0x49800000, 0xfd66fd44, 0xfe25ed6c, 0xfdc1fe02, 0xfc40fd40, 0xfc60fbc0, 0xfbe0fc20,
+	0xfb80fba0, 0xfd66fc22, 0xfc00fca0, 0xfb40fb80, 0xd9e0f2c0, 0xd9c0c160, 0x00000820, 0x00000000,
+	0x00000000, 0x93230000, 0xfd64fe2b, 0xf4e2fda4, 0xcb64d3a3, 0xfc20ebe1, 0xfb20fba0, 0xfb80fba0,
+	0xfc02fb40, 0xfd02f526, 0xdb42fc61, 0xd2a1c2c2, 0xd9e0e280, 0xc960c980, 0x000048c0, 0x00000000,
+	0x00000000, 0xcc850000, 0xfd23ff13, 0x326aa283, 0x11ea128d, 0x81e21947, 0xfb20fbc1, 0xfb20faa0,
+	0xfd46fb40, 0xc3a3fd24, 0x1b4f4a8a, 0x226b234f, 0xa9605144, 0xc960c160, 0x00008940, 0x00000000,
+	0x08200000, 0xfd636222, 0x92c5fd82, 0x55782391, 0x565c8efd, 0x096823d2, 0xfbc17223, 0xf200fa80,
+	0xfd01f341, 0x2b70cbc4, 0x7edd4517, 0x34545ebd, 0x414411c9, 0xc16098e0, 0x5100d9c0, 0x00000000,
+	0xe5aa20c1, 0xe502dd0a, 0x2aeddc01, 0xf7ff5557, 0x879fafdf, 0x3350a79f, 0xc3830926, 0xf200fae0,
+	0xfcc1f3c1, 0x3cb5532c, 0xbfdfe7df, 0x9f9f879f, 0x094743d1, 0xb12060a1, 0xcbc3b940, 0x0000ca80,
+	0xfd037aa3, 0xd401dc64, 0x2b70a2c3, 0x8f9f55da, 0x7f7f879f, 0x33d2977e, 0x72460927, 0xe9e0fbe0,
+	0xdbc1f401, 0x2d7922cd, 0x879f9f9f, 0x975e777f, 0x00a433b1, 0xa0e03945, 0xcb01b940, 0x40c0f2a0,
+	0xfba08200, 0xcba1dba2, 0x122b92a4, 0x3e3c1c75, 0x671e5efe, 0x2b9056de, 0x59840106, 0xe9e0fca2,
+	0xbac0f421, 0x13f319e9, 0x5efe463c, 0x4e7d5ede, 0x008323d2, 0x98e03104, 0xcaa1b920, 0x4080da00,
+	0xeac07960, 0xcb40c241, 0x2a29c2c2, 0x2d9909c9, 0x4e9d361c, 0x09675598, 0x932800c4, 0xf200fcc2,
+	0xba60f421, 0x01684a28, 0x25ba14d7, 0x5e5c3e3c, 0x00a41167, 0xa1004144, 0xb180b920, 0x4080c9a0,
+	0xd9e060c0, 0xcac0c200, 0x732bdba2, 0x092611a8, 0x1a2a1acd, 0x010600e5, 0xc4674baf, 0xf200fd00,
+	0xe360fca1, 0x1a0a92e7, 0x2b900946, 0x09063390, 0x32ac00a4, 0xb94071c5, 0xa960b120, 0x48a0c140,
+	0xc98068c0, 0xcaa0c1e0, 0xc384fbe0, 0x42cb8328, 0x11c919c9, 0x744f2aac, 0xfd42b3e8, 0xfc82fd20,
+	0xfc40fce0, 0xab26ca80, 0x1a0a532b, 0x220911a8, 0x9ac66bcd, 0xc160b140, 0xa960b960, 0x48c0c160,
+	0xd1a050c0, 0xc260b9e0, 0xfba0fba0, 0xcbc3ec03, 0xd446d406, 0xd423d425, 0xfcc0fce2, 0xfc80fca0,
+	0xfc00fc40, 0xe300fba0, 0xcb63cae1, 0xcb63c3a5, 0xd1e0ca40, 0xc224c980, 0xb160cbcb, 0x2860d180,
+	0x99a00000, 0xa140da40, 0xfb80eae0, 0xfbe0fba0, 0xfce0fc60, 0xfcc2fd01, 0xfd22fd22, 0xfd02fd22,
+	0xfcc1fce2, 0xfc20fc60, 0xfb81fbe1, 0xfa80fb20, 0xc9a0e220, 0xb940b940, 0xc9c0b120, 0x00007100,
+	0x00000000, 0xc9e030a0, 0xca00b160, 0xfb60e2c0, 0xfc80fbe0, 0xf4c6f440, 0xfda0fd60, 0xfdc0fdc0,
+	0xfd60fda0, 0xfc80fd00, 0xfb81eac1, 0xea40fac0, 0xc140d1a0, 0xc9e0b140, 0x1840d280, 0x00000000,
+	0x00000000, 0x28800000, 0xb1c08180, 0xda00d200, 0xd260da20, 0xd300d2c0, 0xdb40d320, 0xe300db40,
+	0xdae0dae0, 0xdaa0dae0, 0xca00d260, 0xc9c0c1c0, 0xda20d1e0, 0x7980c220, 0x00001840, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x28600000, 0x894058c0, 0xc241b1c0, 0xba62c201, 0xbaa2ba82,
+	0xb241ba62, 0xb201b221, 0xb1e0ba01, 0x69009180, 0x08203880, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09050000, 0x4a680106, 0x11c92966, 0x2aac1a0a,
+	0x11ea228c, 0x29450947, 0x00834a88, 0x00000883, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0xba601840, 0x29c88284, 0x81e3222a, 0xd323d302, 0x93a9b2e3,
+	0xb2e39368, 0xdaa1da81, 0x11677a44, 0x81403944, 0x28e0ba80, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0xdb800820, 0x7285d3e4, 0x1a0b2a29, 0x49a521c8, 0xa2846962,
+	0x61439243, 0x220a3985, 0x31a619ea, 0xc18069a2, 0x0800b960, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x28c00000, 0xd3e3e320, 0x628782a4, 0x19ca29e8, 0x1a2b11ea,
+	0x22ad1a6c, 0x31c6222a, 0x79e25205, 0xc980c1a0, 0x00002860, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xba802080, 0xb383eba1, 0x5a2682a4, 0x62675a47,
+	0x5a266266, 0x7a645a05, 0xd1a0b242, 0x2860c1a0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08200000, 0xd2c07180, 0xf441e360, 0xbc22d442,
+	0xd3a1bbe2, 0xd240eb41, 0x7120d200, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x18400000, 0xaa6071a0, 0xdb40d2e0,
+	0xcac1db41, 0x59409a21, 0x00000820, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10400000,
+	0x00000820, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// race_icon565, 32x32px
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x002010a2,
+	0x10820020, 0x00004208, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000841, 0x98a26882, 0xc904b8e4,
+	0xb8e3d104, 0x7904a986, 0x08612000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x50000841, 0xfb6dc166, 0xfc30fc51, 0xfb0bfb8e,
+	0xfb8efaeb, 0xfc51fc30, 0xb965fb4d, 0x08415000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x30202965, 0xfcf3c186, 0xfcf3fdb7, 0xfb8efc30, 0xfa8afb0b,
+	0xfb0bfa8a, 0xfc30fb8e, 0xfdb6fcf3, 0xc186fcd3, 0x29653020, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x10a20000, 0xf3ef6041, 0xfdb6fe9a, 0xfc30fcf3, 0xfb0cfb8e, 0xfa28fa89,
+	0xfa8afa08, 0xfb8efb0c, 0xfcf3fc30, 0xfe9afdd7, 0x6021f3ae, 0x000010a2, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x706110a2, 0xfebafd34, 0xfcf3fdd7, 0xfb8efc30, 0xfa69faeb, 0xf9a6fa28,
+	0xfa28f9a6, 0xfb0bfa8a, 0xfc30fbae, 0xfdd7fcf3, 0xfd14feba, 0x10a27061, 0x00000000, 0x00000000,
+	0x00000000, 0x29450000, 0xfd346021, 0xfdd7feba, 0xfc30fcf3, 0xfaebfb8e, 0xfa49facb, 0xf965f9a6,
+	0xf9c7f965, 0xfacbfa08, 0xfb8efb0c, 0xfcf3fc30, 0xfedbfdd7, 0x5820fd14, 0x00002965, 0x00000000,
+	0x00000000, 0x28000000, 0xfebaf3cf, 0xfcf3fdd7, 0xfb8efc30, 0xfa89faeb, 0xfa69faeb, 0xf924f965,
+	0xf965f924, 0xfa28fa08, 0xfb0cfa89, 0xfc30fb8e, 0xfe18fd55, 0xf3aefeba, 0x00002800, 0x00000000,
+	0x00000000, 0xc1860841, 0xfdd7fe9a, 0xfc30fcf3, 0xfaebfb8e, 0xfa28fa69, 0xf965f9a6, 0xf8e3f924,
+	0xf945f8e3, 0xf9a6f986, 0xfa8afa28, 0xfb8efaeb, 0xfcf3fc30, 0xfe9afdd7, 0x0841c165, 0x00000000,
+	0x00000000, 0xfcf35000, 0xfcf3fdd7, 0xfb8efc30, 0xfa8afb0c, 0x9104fa28, 0xf924f965, 0xf8c3f8e3,
+	0xf8e3f8c3, 0xf965f924, 0xfa289104, 0xfb0cfa8a, 0xfc30fb8e, 0xfdd7fcf3, 0x5020fcd3, 0x00000000,
+	0x08410000, 0xfdb7c166, 0xfc30fcf3, 0xfb0cfb8e, 0xfa08fa8a, 0x0000c165, 0xf8e4b0e3, 0xf8a2f8a2,
+	0xf8a2f882, 0xd904f8e3, 0x99240800, 0xfa69fa08, 0xfb8efb0c, 0xfcf3fc30, 0xb945fdd7, 0x00000861,
+	0x20000000, 0xfcf3fb6d, 0xfb8efc30, 0xfa8afaeb, 0xca69fa28, 0x00006b0c, 0xf8c33082, 0xf862f8a2,
+	0xf8a2f861, 0x5061f8c3, 0x4a490861, 0xf208c2eb, 0xfb0bfa8a, 0xfc30fb8e, 0xfb2cfcf3, 0x00002000,
+	0x70a20000, 0xfc30fc51, 0x91e7eb6d, 0xbbefab4d, 0x8c712041, 0x7befe71c, 0x90c38c51, 0xf841f882,
+	0xf861f841, 0x6b4dc0c2, 0xce799492, 0x1841b5b6, 0xbbefa34d, 0xdb2d81c7, 0xfc30fc30, 0x00006841,
+	0x98820000, 0xd38efc30, 0x2104c5f7, 0xef5d5aeb, 0x39e74a49, 0x4a69632c, 0x1841d69a, 0xf841e841,
+	0xf841f841, 0xbdd75145, 0x420873ae, 0x29455aeb, 0x630ce73c, 0xbdd70841, 0xfc30c3cf, 0x0000a945,
+	0xb90410a2, 0x18c3cb0c, 0x8410defb, 0x6b4dad55, 0xe73c3186, 0x18e38410, 0x0000528a, 0xf8216841,
+	0x9041f820, 0x31a60000, 0x5acb31a6, 0x528aef5d, 0xb5b64a69, 0xe73c73ae, 0xaa8a3186, 0x18c3b8e3,
+	0xc9240020, 0x0000d28a, 0x0000632c, 0xbdd7b596, 0x949239c7, 0xbdd76b4d, 0x4041c618, 0xc8208020,
+	0x6020e821, 0x9cf36820, 0x5acbdedb, 0x42089cf3, 0xce7994b2, 0x5aeb0841, 0xb2280841, 0x0020c904,
+	0xd0e30020, 0xa28afa89, 0x39e7e73c, 0x00209cd3, 0xdefb73ae, 0x420810a2, 0xf041c38e, 0x5820f020,
+	0xd8207020, 0xc2aaf841, 0x0020630c, 0x9cf3ce59, 0x8c510000, 0xd6ba39c7, 0xfa89a36d, 0x0841c8e3,
+	0xb8a21082, 0xe9a6fa28, 0x632cb534, 0x62aaef5d, 0xca6968a2, 0xd041b104, 0xf820f840, 0x9020f821,
+	0xf8206800, 0xf820f820, 0xa8a2e041, 0x8104ca69, 0xef5d4165, 0xad557bef, 0xfa08d9c7, 0x18c3b882,
+	0xa0610000, 0xf965f9a6, 0x000098e3, 0xe1049aaa, 0xf841f882, 0xf840f841, 0xf841f861, 0x5800f820,
+	0xf0205820, 0xf882f820, 0xf841f861, 0xf882f861, 0xb2ebf0a2, 0x68820841, 0xf9c7f965, 0x00009841,
+	0x80e30000, 0xf924f924, 0x6041f8e3, 0xf882f0e3, 0xf841f841, 0xf820f820, 0xf924f945, 0x9800b000,
+	0x8020c800, 0xf841f861, 0xf840f820, 0xf841f841, 0xf9a7f965, 0xe8e36841, 0xf924f924, 0x00006841,
+	0x20000000, 0xf8e3f8c2, 0xf8c3f8a3, 0xf861f882, 0xf820f841, 0xf820f820, 0xf020f840, 0xf8005820,
+	0x7041f800, 0xf800e041, 0xf820f820, 0xf841f820, 0xf882f861, 0xf8c3f882, 0xf8a3f8e3, 0x00002841,
+	0x08410000, 0xf8a3c041, 0xf882f8a2, 0xf841f861, 0xf820f841, 0xf820f820, 0x8820f820, 0xf800c020,
+	0xe020f800, 0xf8006820, 0xf820f820, 0xf841f820, 0xf841f841, 0xf882f882, 0xb841f8c3, 0x00000861,
+	0x00000000, 0xf8615000, 0xf841f861, 0xf841f841, 0xf820f820, 0xf800f800, 0x6820e000, 0xf800f800,
+	0xf800f800, 0xc8208820, 0xf820f800, 0xf820f800, 0xf841f841, 0xf861f841, 0x5000f861, 0x00000000,
+	0x00000000, 0xc8200821, 0xf841f841, 0xf820f840, 0xf800f820, 0xf800f800, 0xe0007020, 0xf800f800,
+	0xf800f800, 0x5820f000, 0xf800f820, 0xf800f800, 0xf840f821, 0xf861f841, 0x0820c020, 0x00000000,
+	0x00000000, 0x28000000, 0xf841f020, 0xf820f841, 0xf800f820, 0xf800f800, 0xf861e800, 0xf800f820,
+	0xf800f800, 0xe020f800, 0xf800f800, 0xf820f800, 0xf861f820, 0xf020f861, 0x00002800, 0x00000000,
+	0x00000000, 0x29450000, 0xf8006000, 0xf904f965, 0xf800f800, 0xf800f800, 0xf841f840, 0xf800f800,
+	0xf800f800, 0xf924f924, 0xf800f800, 0xf800f800, 0xf862f840, 0x5800f800, 0x00002965, 0x00000000,
+	0x00000000, 0x00000000, 0x782010a2, 0xf820f861, 0xf800f800, 0xf820f800, 0xf800f840, 0xf800f800,
+	0xf800f800, 0xf820f841, 0xf800f800, 0xf820f800, 0xf800f861, 0x18c27020, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x10a20000, 0xf0006000, 0xf800f800, 0xf800f800, 0xf800f800, 0xf800f800,
+	0xf800f800, 0xf800f800, 0xf800f800, 0xf800f800, 0x6000f000, 0x000018c3, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x30202965, 0xf800c800, 0xf800f800, 0xf800f800, 0xf800f800,
+	0xf800f800, 0xf800f800, 0xf800f800, 0xc000f800, 0x31862820, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x50200841, 0xf800c000, 0xf800f800, 0xf800f800,
+	0xf800f800, 0xf800f800, 0xc020f800, 0x08205000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000841, 0xa0006820, 0xd000b800,
+	0xb820d000, 0x70619800, 0x08412841, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00201082,
+	0x10a20020, 0x000031a6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// car_icon565, 32x32px
+	0x00000000, 0x00000000, 0x00200020, 0x00a10060, 0x00a100a1, 0x010100e1, 0x02030142, 0x032502e5,
+	0x03050325, 0x01420223, 0x00a10102, 0x006000a1, 0x00200040, 0x00000020, 0x00000000, 0x00000000,
+	0x00000000, 0x00200020, 0x00a10060, 0x00e100c1, 0x01220102, 0x01620142, 0x042701e3, 0x062b076d,
+	0x068b062b, 0x01e30589, 0x01010142, 0x00a100e1, 0x006100a1, 0x00200040, 0x00000000, 0x00000000,
+	0x00000000, 0x00a10040, 0x010200e1, 0x01620142, 0x01620162, 0x01e30183, 0x05ea0264, 0x02e50447,
+	0x034502c4, 0x0264064b, 0x01420183, 0x01010122, 0x00e20102, 0x006100c1, 0x00200040, 0x00000000,
+	0x00400000, 0x00e100a1, 0x01e30142, 0x02e502a5, 0x02230284, 0x02640223, 0x06cc0305, 0x028403e6,
+	0x03050264, 0x02e5068c, 0x01c30223, 0x01c201c3, 0x02030223, 0x00e10162, 0x004000c1, 0x00000020,
+	0x00600020, 0x014200c1, 0x03250203, 0x0fee07ef, 0x0325056a, 0x03a60305, 0x07ee05ea, 0x02640386,
+	0x02a40223, 0x062b06cc, 0x02a403c6, 0x03860264, 0x060a062b, 0x018302c5, 0x00a100e1, 0x00000020,
+	0x00a10020, 0x01e30122, 0x07ef0325, 0x04060508, 0x06cc072d, 0x076d072c, 0x034504e7, 0x02230284,
+	0x02240203, 0x038502e5, 0x064b05ea, 0x062b04e9, 0x030502e5, 0x030505ea, 0x00c20142, 0x00200040,
+	0x00a10040, 0x02630142, 0x056907ae, 0x03250386, 0x05ea0345, 0x032504a8, 0x022402a4, 0x02230223,
+	0x02030203, 0x02240223, 0x03050284, 0x02c50509, 0x02240223, 0x05ca02a4, 0x00e10223, 0x00400060,
+	0x00c10061, 0x02840162, 0x0589076d, 0x02c40345, 0x02a402a4, 0x02240284, 0x02230223, 0x02230224,
+	0x02230223, 0x02230223, 0x02030203, 0x02030223, 0x022401e3, 0x05ca02a4, 0x01010224, 0x004000a1,
+	0x00e100a1, 0x02230162, 0x17f003c6, 0x02e50467, 0x02230264, 0x02230223, 0x03050264, 0x03a60386,
+	0x03c603c6, 0x02840385, 0x02030223, 0x02030203, 0x026401e3, 0x03860549, 0x01010182, 0x004000a1,
+	0x012200c1, 0x02230182, 0x05090305, 0x030517ef, 0x02230224, 0x02a40223, 0x03050345, 0x03250305,
+	0x03050325, 0x04060345, 0x022403a6, 0x02030203, 0x038601e3, 0x022404c8, 0x00e10162, 0x004000a1,
+	0x014200e1, 0x022301e3, 0x068b0325, 0x02e406cc, 0x02230224, 0x032502c4, 0x030502a4, 0x070b0509,
+	0x05c906cc, 0x032503c6, 0x03e60385, 0x01e30223, 0x028401e3, 0x02230569, 0x01010162, 0x006000c1,
+	0x01c30122, 0x02c40223, 0x17ef03c6, 0x02a40407, 0x02840224, 0x02a40325, 0x03a602e5, 0x058a27f0,
+	0x056904e8, 0x058a072c, 0x03450325, 0x020303a6, 0x022401e3, 0x03250447, 0x014201c3, 0x00a100e1,
+	0x02640182, 0x03a50305, 0x07ee0548, 0x02840345, 0x03250264, 0x02e402c4, 0x03c60345, 0x0fee062a,
+	0x040604a8, 0x05ea03c6, 0x02e50569, 0x028403e6, 0x02030203, 0x04a80284, 0x01c30223, 0x00e20142,
+	0x060a0264, 0x17ee07ed, 0x04e82ff0, 0x028402c4, 0x034502a4, 0x04a80385, 0x04260487, 0x06ab0467,
+	0x04670fef, 0x038503a6, 0x0385068b, 0x03e602e5, 0x02030203, 0x04a80224, 0x046704c8, 0x016203c7,
+	0x27f10305, 0x04870548, 0x03250407, 0x028402a4, 0x034502e5, 0x67f404c8, 0x056947f2, 0x04e804a8,
+	0x072c078e, 0x03040385, 0x05690427, 0x040602c4, 0x01e30224, 0x020301c3, 0x02230223, 0x02240407,
+	0x1ff00345, 0x03850426, 0x02c40305, 0x02640284, 0x03860304, 0x17ef06cb, 0x47f3076d, 0x05ea05eb,
+	0x056937f2, 0x03050385, 0x05aa03a6, 0x040602e5, 0x01e30224, 0x018301c3, 0x01e301c3, 0x02640386,
+	0x17f00345, 0x03a60447, 0x02e50325, 0x028402a4, 0x03850325, 0x1fef060a, 0x06cc0589, 0x4ff34ff3,
+	0x0406060a, 0x03250385, 0x05aa03c6, 0x04460305, 0x02030264, 0x018301e3, 0x01e301c3, 0x02640385,
+	0x37f10305, 0x0548064b, 0x03850467, 0x02a402e5, 0x03850305, 0x47f20508, 0x05090569, 0x058905aa,
+	0x03c50487, 0x03850385, 0x054904c8, 0x04a80325, 0x022302a5, 0x02030203, 0x02640224, 0x02040488,
+	0x04670223, 0x17ef078d, 0x05894ff3, 0x02c40345, 0x038502e5, 0x37f10447, 0x0508070b, 0x04a804c8,
+	0x04260487, 0x03c603e6, 0x068b04a8, 0x044703c6, 0x02840468, 0x04a80264, 0x03a60427, 0x01220264,
+	0x026401c3, 0x03c60305, 0x1ff00569, 0x02e403c6, 0x034502a4, 0x054903c6, 0x070b5ff4, 0x056905aa,
+	0x05690548, 0x04870548, 0x04a80426, 0x03e6064b, 0x04a80427, 0x04070346, 0x014201e3, 0x00c10122,
+	0x01c30142, 0x02e50264, 0x2ff10427, 0x032504c8, 0x02e502c4, 0x04070385, 0x57f305a9, 0x3ff15ff4,
+	0x6ff537f1, 0x06cc6ff5, 0x04670509, 0x062b0487, 0x03e603c6, 0x0264058a, 0x01220162, 0x006100c1,
+	0x01830102, 0x02a40203, 0x06ab03c6, 0x03a517ef, 0x02e502e5, 0x03a50325, 0x05090426, 0x27ef06cc,
+	0x27ef37f0, 0x87f74ff2, 0x054906cc, 0x04470446, 0x032505ca, 0x01e30284, 0x00e10122, 0x00400061,
+	0x016200c1, 0x028401e3, 0x06cb03e6, 0x03c627f0, 0x03050305, 0x03450305, 0x046703e6, 0x07ad05ea,
+	0x27ef0fee, 0x5ff427f0, 0x06cc87f7, 0x03e604c8, 0x04e803a6, 0x01c302c5, 0x00c10122, 0x00400061,
+	0x014200c1, 0x02e501e3, 0x4ff30548, 0x03a504e8, 0x03250345, 0x03450325, 0x044703a5, 0x77f5070c,
+	0xa7f997f8, 0x37f1c7fb, 0x77f56ff5, 0x0447060a, 0x02e50325, 0x02240427, 0x00c10142, 0x00200061,
+	0x01220061, 0x032501c3, 0x060a3ff1, 0x03c60447, 0x042603c6, 0x03e60406, 0x042703c6, 0x05ca04c8,
+	0x076c068b, 0xbffb37f1, 0x6ff537f1, 0x050957f3, 0x02640325, 0x03860223, 0x00e101c3, 0x00200060,
+	0x01020061, 0x02e501c3, 0x07ad1ff0, 0x046704a8, 0x37f10549, 0x058927ef, 0x048704a8, 0x04e804a8,
+	0x062b0589, 0x47f2074c, 0x0fefb7fa, 0x07ed47f2, 0x02230305, 0x01830182, 0x016202e5, 0x00200060,
+	0x00e20040, 0x02230162, 0x27f003e6, 0x060a07ce, 0x07ce57f4, 0x5ff407ed, 0x06cc3ff2, 0x04c80549,
+	0x05ea0509, 0x77f507cd, 0x078dc7fb, 0x042704e8, 0x01e302c5, 0x01220162, 0x02840122, 0x002000c1,
+	0x00a10020, 0x01830102, 0x04060284, 0x4ff327f0, 0x044705ea, 0x05080447, 0x97f8072c, 0x04c8064b,
+	0x062a0509, 0x37f19ff8, 0x04a806cc, 0x02a40385, 0x01c30223, 0x00e10122, 0x014200c1, 0x00400122,
+	0x00600020, 0x010100c1, 0x02230182, 0x03850325, 0x03050325, 0x03a60305, 0x47f204a8, 0x04e806cb,
+	0x064a0509, 0x060a7ff6, 0x03250447, 0x02030284, 0x01820162, 0x00c10142, 0x01c300a1, 0x002000c1,
+	0x00400000, 0x00c10061, 0x01630102, 0x020301c3, 0x02230203, 0x02a40264, 0x17ef03c6, 0x05aa0fee,
+	0x06cb05aa, 0x04a86ff5, 0x02840325, 0x016201e2, 0x00e10101, 0x01620122, 0x01220183, 0x00000040,
+	0x00000000, 0x00400020, 0x00c100a1, 0x01220101, 0x01830142, 0x022301e3, 0x054802e5, 0x57f37ff6,
+	0x5ff357f3, 0x03a61fef, 0x01e30264, 0x01020162, 0x006100a1, 0x00600060, 0x00400060, 0x00000020,
+	0x00000000, 0x00200000, 0x00600040, 0x00a10060, 0x010100c1, 0x01830142, 0x02e50223, 0x04a80427,
+	0x046704a7, 0x02640385, 0x014201c3, 0x006100e1, 0x00200040, 0x00200020, 0x00000020, 0x00000000,
+	// transceiver_icon565, 32x32px
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x4aed0882, 0x74d56c73, 0x74d574d5, 0x74d574d5, 0x74d574d5, 0x74d574d5,
+	0x74d574d5, 0x74d574d5, 0x74d574d5, 0x74d574d5, 0x747374d5, 0x08824aed, 0x00000000, 0x00000000,
+	0x00000000, 0x3a4a0000, 0x6d9b85da, 0x5d5a5d5a, 0x555a555a, 0x555a555a, 0x6d9b659b, 0x6d9b6d9b,
+	0x657b6d9b, 0x555a555a, 0x555a555a, 0x555a555a, 0x555a555a, 0x85da6d9b, 0x00003a4a, 0x00000000,
+	0x00000000, 0x85fc3a4a, 0x5d5b5d5b, 0x657b5d5a, 0x5d5b657b, 0x555a555a, 0x6d9b657b, 0x6d9b6d9b,
+	0x5d5a6d9b, 0x555a555a, 0x555a555a, 0x555a555a, 0x555a555a, 0x555a555a, 0x3a4a7ddb, 0x00000000,
+	0x08820000, 0x657b7dba, 0x5d5a657b, 0x5d7b5d7b, 0x6d9b5d7b, 0x555a5d5a, 0x6d9b5d5b, 0x6d9b6d9b,
+	0x5d5a6d9b, 0x555a555a, 0x555a555a, 0x555a555a, 0x657b657b, 0x555a5d5a, 0x7d9a555a, 0x00000862,
+	0x42cc0000, 0x657b6d9b, 0x657b657b, 0x6d9b6d9b, 0x657b5d5a, 0x555a6d9b, 0x75bb5d5b, 0x6d9b75bb,
+	0x555a5d5a, 0x555a555a, 0x555a555a, 0x657b555a, 0x6d9b6d9b, 0x5d5b6d9b, 0x6d9b657b, 0x000042ec,
+	0x5c330000, 0x6d9b6d9b, 0x6d9b6d9b, 0x963c85fc, 0x7ddc85fb, 0x555a6d9b, 0x75bc5d5b, 0x555a659b,
+	0x657b555a, 0x555a657b, 0x555a555a, 0x6d9b5d7b, 0x6d9b657b, 0x6d9b657b, 0x6d9b6d9b, 0x00005c33,
+	0x64750000, 0x6d9b6d9b, 0x6d9b6d9b, 0xf7df9e5c, 0xf7dff7df, 0xcf1defbf, 0x75bb9e5c, 0x555a5d5b,
+	0x555a555a, 0x555a555a, 0x5d5a555a, 0x6d9b75bc, 0x6d9b657b, 0x6d9b6d9b, 0x6d9b6d9b, 0x00006475,
+	0x5c750000, 0x6d9b6d9b, 0x75bb6d9b, 0xf7df9e5c, 0xf7dff7df, 0xf7dff7df, 0xf7bff7df, 0x6dbbbedd,
+	0x555a555a, 0x555a555a, 0x555a5d5a, 0x659b6d9b, 0x6d9b5d7b, 0x6d9b75bb, 0x6d9b6d9b, 0x00006475,
+	0x5c750000, 0x6d9b6d9b, 0x75bc75bb, 0xf7dfa67d, 0xf7dff7df, 0xf7dff7df, 0xf7dff7df, 0xf7bff7df,
+	0x5d5aaebd, 0x5d7b555a, 0x555a659b, 0x657b657b, 0x75bc75bc, 0x75bb75bc, 0x6d9b6d9b, 0x00006475,
+	0x5c750000, 0x75bb6d9b, 0x75bc75bc, 0x9dda85fc, 0xc6bcae3a, 0xf7dfe77e, 0xf7dff7df, 0xf7dff7df,
+	0xdf7ef7df, 0x5d5a75bb, 0x6d9c657b, 0x75bc75bc, 0x75bc75bc, 0x75bc75bc, 0x6d9b75bb, 0x00005c75,
+	0x5c550000, 0x75bb6d9b, 0x75bc75bc, 0x6d5a75bc, 0x5c765c76, 0x6cd75456, 0xefbeae5b, 0xf7dff7df,
+	0xf7dff7df, 0x85fbefbe, 0x75bc657b, 0x75bc75bc, 0x6d9b75bc, 0x75bc657b, 0x6d9b6d9b, 0x00005c75,
+	0x5c540000, 0x75bc75bb, 0x75bc75bc, 0x75bc75bc, 0x54556d5a, 0x44144414, 0x54754414, 0xf7dfb67b,
+	0xf7dff7df, 0xf7bff7df, 0x5d7b963d, 0x657b5d5b, 0x6d9b75bc, 0x6d9b657b, 0x6d9b657b, 0x00005c75,
+	0x4c340000, 0x75bc6d9b, 0x75bc75bc, 0x75bc75bc, 0x54f96d9c, 0x44144414, 0x44144414, 0x7d384414,
+	0xf7dfef9e, 0xf7dff7df, 0x7dbbefbe, 0x555a657b, 0x5d7b5d5a, 0x75bc6d9b, 0x6d9b6d9b, 0x00005c75,
+	0x4c140000, 0x6d9b5d5b, 0x75bc75bc, 0xe79e9e5d, 0xae9dd73e, 0x4414757a, 0x44144414, 0x44144414,
+	0xe77e64b6, 0xf7dff7df, 0xe75ef7df, 0x6d9c757b, 0x6d9b6d9c, 0x75bc75bc, 0x75bb6d9b, 0x00005c55,
+	0x4c140000, 0x5d5b555a, 0x6d9b75bc, 0xf7df963c, 0xf7dff7df, 0xd71df7df, 0x44147517, 0x44144414,
+	0x64b64414, 0xf7dfef9e, 0xf7dff7df, 0x6d5ab65b, 0x75bc75bc, 0x75bc6d9b, 0x6d9b75bc, 0x00005434,
+	0x44140000, 0x555a555a, 0x6d9b5d5b, 0xf7df9e7d, 0xf7dff7df, 0xf7dff7df, 0xae3af7df, 0x44144414,
+	0x44144414, 0xf7df8578, 0xf7dff7df, 0x74f7f7bf, 0x75bc6d5a, 0x6d9b75bc, 0x657b75bc, 0x00004c14,
+	0x44140000, 0x555a555a, 0x555a555a, 0xa63a75bb, 0xf7bfc6dc, 0xf7dff7df, 0xf7dff7df, 0x4414be9b,
+	0x44144414, 0xbe9c4c35, 0xf7dff7df, 0xbe9cf7df, 0x6d5a5c76, 0x6d9b75bc, 0x555a657b, 0x00004414,
+	0x44140000, 0x555a555a, 0x555a555a, 0x4cd8555a, 0x64b64c35, 0xf7bfae3a, 0xf7dff7df, 0xae3af7df,
+	0x44144414, 0x5c964414, 0xf7dff7be, 0xf7bff7df, 0x5c766cb6, 0x75bc6d5a, 0x555a657b, 0x00004414,
+	0x43f40000, 0x555a555a, 0x555a555a, 0x555a555a, 0x5c766519, 0x7d385c76, 0xf7dfef9e, 0xf7dff7df,
+	0x44147517, 0x44144414, 0xf7dfae5b, 0xf7dff7df, 0x5c759dda, 0x5d395c76, 0x555a555a, 0x000043f4,
+	0x43f30000, 0x555a555a, 0x555a555a, 0x555a555a, 0x6d3a657b, 0x5c765c76, 0xf7bf7d38, 0xf7dff7df,
+	0x4414d71d, 0x44144414, 0xf7df6cd7, 0xf7dff7df, 0x5c75cedc, 0x44355c75, 0x555a54f8, 0x000043f4,
+	0x43f30000, 0x555a555a, 0x555a555a, 0x7dfb555a, 0xbefec6fd, 0x5c76755a, 0xae3a5c76, 0xf7dff7df,
+	0x6cf7f7df, 0x44144414, 0xe77e4414, 0xf7dff7df, 0x5c75efbe, 0x44145475, 0x54f94c35, 0x000043f3,
+	0x43f30000, 0x555a555a, 0x555a555a, 0xefbf657b, 0xf7dff7df, 0x6d39c6dd, 0x64b65c76, 0xf7dff7bf,
+	0xa61af7df, 0x44144414, 0xbe9b4414, 0xf7dff7df, 0x6cf7f7df, 0x44144c35, 0x44144c35, 0x00003b92,
+	0x43f30000, 0x555a555a, 0x555a555a, 0xf7df7ddb, 0xf7dff7df, 0x5cb7d71d, 0x4c356d39, 0xf7dfc6dc,
+	0xcefcf7df, 0x44144414, 0xa61a4414, 0xf7dff7df, 0x8558f7df, 0x44144414, 0x44144414, 0x0000330f,
+	0x43d30000, 0x555a555a, 0x555a555a, 0xd75e5d5a, 0xf7dff7df, 0x5c7595b9, 0x4cd85476, 0xf7dfa63a,
+	0xdf5df7df, 0x44144414, 0x95b94414, 0xf7dff7df, 0x8578f7df, 0x44144414, 0x44144414, 0x0000330f,
+	0x3b710000, 0x555a555a, 0x555a555a, 0x5d5a555a, 0x6cf77d58, 0x4c355455, 0x44554414, 0x85786d7a,
+	0x85588578, 0x44144414, 0x5c964414, 0x85788578, 0x5c968578, 0x44144414, 0x44144414, 0x00002aad,
+	0x222a0000, 0x555a553a, 0x555a555a, 0x555a555a, 0x5476553a, 0x44144c35, 0x44144414, 0x4cd84455,
+	0x44144414, 0x44144414, 0x44144414, 0x44144414, 0x44144414, 0x44144414, 0x44144414, 0x000019a8,
+	0x00410000, 0x555a4c97, 0x555a555a, 0x555a555a, 0x655a555a, 0x44144c56, 0x44144414, 0x44554414,
+	0x44144cd8, 0x44144414, 0x44144414, 0x44144414, 0x44144414, 0x44144414, 0x3b924414, 0x00000041,
+	0x00000000, 0x54d81988, 0x555a553a, 0x555a555a, 0x5d5b555a, 0x4455553a, 0x44144414, 0x44144414,
+	0x4cd84455, 0x44144414, 0x44144414, 0x44144414, 0x44144414, 0x44144414, 0x11463bd3, 0x00000000,
+	0x00000000, 0x19870000, 0x55194c56, 0x555a553a, 0x555a555a, 0x553a555a, 0x44144455, 0x44144414,
+	0x44554414, 0x44144cd8, 0x44144414, 0x44144414, 0x44144414, 0x3b5143f3, 0x00001126, 0x00000000,
+	0x00000000, 0x00000000, 0x19e90041, 0x33502aee, 0x33503350, 0x33503350, 0x2a8d3330, 0x2a8d2a8d,
+	0x2a8d2a8d, 0x32ee2ace, 0x2a8c2a8c, 0x2a8c2a8c, 0x222b2a8c, 0x00411967, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// calibrate_icon565, 32x32px
+	0x00000000, 0x42280861, 0x7bcf6b4d, 0x7bcf7bcf, 0x7bcf7bcf, 0x7bcf7bcf, 0x7bcf7bcf, 0x7bcf7bcf,
+	0x7bcf7bcf, 0x7bcf7bcf, 0x7bcf7bcf, 0x7bcf7bcf, 0x7bcf7bcf, 0x6b4d7bcf, 0x08614228, 0x00000000,
+	0x18c30000, 0x738e6b4d, 0x738e738e, 0x738e738e, 0x738e738e, 0x738e738e, 0x738e738e, 0x6b6d738e,
+	0x738e6b6d, 0x738e738e, 0x738e738e, 0x738e738e, 0x738e738e, 0x738e738e, 0x6b4d738e, 0x000018c3,
+	0x630c0841, 0x6b4d6b4d, 0x6b4d6b4d, 0x6b4d6b4d, 0x6b4d6b4d, 0x8c716b4d, 0xd69ab5b6, 0xef7de71c,
+	0xdefbef5d, 0xad55ce59, 0x6b4d7bef, 0x6b4d6b4d, 0x6b4d6b4d, 0x6b4d6b4d, 0x6b4d6b4d, 0x0841630c,
+	0x630c39c7, 0x630c630c, 0x630c630c, 0x630c630c, 0x9cf3632c, 0xf79ee71c, 0xdefbef7d, 0xce59ce79,
+	0xd69ace59, 0xf79ee71c, 0xce79f79e, 0x630c8c51, 0x630c630c, 0x630c630c, 0x630c630c, 0x39c7630c,
+	0x5acb4a69, 0x5acb5acb, 0x5acb5acb, 0x7bcf5acb, 0xf79ededb, 0xb596dedb, 0x84308c71, 0x7bcf7bef,
+	0x7bef7bcf, 0x94b28430, 0xe73cbdf7, 0xbdf7f79e, 0x5acb632c, 0x5acb5acb, 0x5acb5acb, 0x4a695acb,
+	0x528a528a, 0x528a528a, 0x528a528a, 0xef5d8c51, 0xad75e73c, 0x738e8430, 0x31a64a69, 0x21242124,
+	0x29452124, 0x52aa39e7, 0x8c717bcf, 0xef7dc618, 0x6b4ddedb, 0x528a528a, 0x528a528a, 0x528a528a,
+	0x4a494a49, 0x4a494a49, 0x84304a49, 0xdedbef7d, 0x7bcf94b2, 0x21244228, 0x62a52944, 0xa4458bc5,
+	0x83859c25, 0x21244a24, 0x52aa2945, 0xa5348410, 0xdefbe73c, 0x4a49630c, 0x4a494a49, 0x4a494a49,
+	0x42084208, 0x42084208, 0xe73c6b4d, 0x9492d6ba, 0x2965738e, 0x73052924, 0xfea6ee25, 0xfea6fea6,
+	0xfea6fea6, 0xdda5fea6, 0x21244a44, 0x7bef39c7, 0xe73ca514, 0x4a49d69a, 0x42084208, 0x42084208,
+	0x39c739c7, 0x420839c7, 0xdefbd69a, 0x73ae9cd3, 0x41252945, 0x9a27d94b, 0xfea6fe86, 0xfea6fea6,
+	0xfea6fea6, 0xe605fea6, 0x14c31c83, 0x31a62164, 0xad758430, 0xa534e73c, 0x39c739c7, 0x39c739c7,
+	0x31863186, 0x8c513186, 0xb596e73c, 0x31868430, 0xe94c4125, 0xe14bf94c, 0xfea6ac45, 0xfea6fea6,
+	0xfea6fea6, 0x6c04fea6, 0x0e820e82, 0x21441523, 0x94924228, 0xe73cc638, 0x318652aa, 0x31863186,
+	0x29452945, 0xd6ba3186, 0x9cd3d69a, 0x2924528a, 0xf94cd14b, 0xf94cf94c, 0xee46a1a9, 0xfea6fea6,
+	0xfea6fea6, 0x1523cd66, 0x4eeb2ea6, 0x14230e82, 0x738e2124, 0xe71ca514, 0x2945a534, 0x29452945,
+	0x21042104, 0xe71c632c, 0x8c71b596, 0x81282124, 0xf94cf94c, 0xf94cf94c, 0x9b86f16b, 0xac86d5a7,
+	0xe627aca6, 0x16a34c25, 0x0e839f34, 0x0e820e82, 0x39c72204, 0xc6389cd3, 0x3186dedb, 0x21042104,
+	0x18c318c3, 0xdedb9cd3, 0x632ca514, 0xd94b2124, 0xf94cf94c, 0xf98bf94c, 0x6166f9ca, 0x21242124,
+	0x21242124, 0x772e2c05, 0x0e838f11, 0x0e820e82, 0x21241443, 0xb5968430, 0x5aebdefb, 0x18c318c3,
+	0x10821082, 0xce79c618, 0x4228a534, 0x89282924, 0xf14cc14a, 0xf9caf96c, 0x21248187, 0x21242124,
+	0x21242124, 0xdf3b3186, 0x16a346e8, 0x14c30e23, 0x21241b04, 0xa5346b4d, 0x8410dedb, 0x10821082,
+	0x10820841, 0xc618d69a, 0x2965ad55, 0x21242124, 0x29242124, 0x91875946, 0x21242924, 0x21242124,
+	0x21242124, 0xb6369cf3, 0x22442be5, 0x21242124, 0x21242124, 0xad5552aa, 0x9cd3d69a, 0x08410841,
+	0x10820000, 0xbdf7dedb, 0x2945ad75, 0x29452945, 0x21242124, 0x21242124, 0x21242124, 0x21242124,
+	0x528a2945, 0x5aebef5d, 0x29452945, 0x29452945, 0x29452945, 0xad754a69, 0xa534ce79, 0x00000000,
+	0x08610000, 0xbdf7d6ba, 0x3186b5b6, 0x29652965, 0x29652965, 0x29652965, 0x29652965, 0x29652965,
+	0xce593186, 0x3186ce59, 0x29652965, 0x29652965, 0x29652965, 0xb59652aa, 0xa514ce59, 0x00000000,
+	0x00200000, 0xc618ce59, 0x4228bdd7, 0x31a631a6, 0x31a631a6, 0x31a631a6, 0x31a631a6, 0x31a631a6,
+	0xe73c8430, 0x31a67bef, 0x31a631a6, 0x31a631a6, 0x31a631a6, 0xb5b66b4d, 0x9492ce79, 0x00000000,
+	0x00000000, 0xc638ad75, 0x632cbdd7, 0x39e739e7, 0x39e739e7, 0x39e739e7, 0x39e739e7, 0x528a39e7,
+	0xd6badefb, 0x39e74a49, 0x39e739e7, 0x39e739e7, 0x39e739e7, 0xb5b68c51, 0x6b6dd69a, 0x00000000,
+	0x00000000, 0xce797bef, 0x9492bdd7, 0x42084208, 0x42084208, 0x42084208, 0x42084208, 0xb5964208,
+	0x9cd3e71c, 0x42084208, 0x42084208, 0x42084208, 0x42084208, 0xbdd7b5b6, 0x39e7ce79, 0x00000000,
+	0x00000000, 0xce7939e7, 0xc618bdd7, 0x4a49528a, 0x4a494a49, 0x4a494a49, 0x4a494a49, 0xce594a49,
+	0x5aebd69a, 0x4a494a49, 0x4a494a49, 0x4a494a49, 0x6b6d4a49, 0xbdf7c638, 0x0841c618, 0x00000000,
+	0x00000000, 0xb5960020, 0xc618c638, 0x528a94b2, 0x528a528a, 0x528a528a, 0x528a528a, 0xa514528a,
+	0x528a6b4d, 0x528a528a, 0x528a528a, 0x528a528a, 0xb5b6528a, 0xce59bdd7, 0x00007bcf, 0x00000000,
+	0x00000000, 0x528a0000, 0xbdd7ce59, 0x73aed69a, 0x52aa52aa, 0x52aa52aa, 0x52aa52aa, 0x52aa52aa,
+	0x52aa52aa, 0x52aa52aa, 0x52aa52aa, 0x52aa52aa, 0xce5994b2, 0xc618bdf7, 0x000018e3, 0x00000000,
+	0x00000000, 0x00200000, 0xc6389cf3, 0xce79bdf7, 0x5aeb738e, 0x5aeb5aeb, 0x5aeb5aeb, 0x5aeb5aeb,
+	0x5aeb5aeb, 0x5aeb5aeb, 0x5aeb5aeb, 0x8c715aeb, 0xbdd7d6ba, 0x632cc638, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0xbdd718e3, 0xc618bdf7, 0x8430d6ba, 0x632c632c, 0x632c632c, 0x632c632c,
+	0x632c632c, 0x632c632c, 0x632c632c, 0xdedb9cf3, 0xc618bdd7, 0x002094b2, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x31a60000, 0xbdf7bdd7, 0xdefbbdf7, 0x7bcfb5b6, 0x6b4d6b4d, 0x6b4d6b4d,
+	0x6b4d6b4d, 0x6b4d6b4d, 0xce598c51, 0xbdd7dedb, 0xa514c618, 0x00001082, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0xb5963186, 0xbdd7bdf7, 0xe73cce79, 0xad55ce59, 0x8c5194b2,
+	0x9cd38c71, 0xd6bab596, 0xc638e71c, 0xbdf7bdd7, 0x108294b2, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x10a20000, 0xbdf78c51, 0xb5b6bdf7, 0xd69ac638, 0xe73cdefb,
+	0xdefbe71c, 0xc618ce79, 0xbdf7b5b6, 0x632cbdd7, 0x00000020, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x39c70000, 0xbdf78c71, 0xbdf7bdf7, 0xb5b6bdd7,
+	0xbdd7bdd7, 0xbdf7bdf7, 0x73aeb5b6, 0x000018e3, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x18c30000, 0x73ae4a69, 0x9cd39492,
+	0x8c519cd3, 0x42086b6d, 0x00000861, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// GForce_icon565, 32x32px
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x4b0c2166, 0x9e1a7cb4, 0xbf5fb6fe,
+	0xb6fdbf5f, 0x74739df9, 0x21454acc, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x7cf52986, 0xbf3fa67b, 0xbf5fbf5f, 0xbf5fbf5f,
+	0xbf5fbf5f, 0xbf5fbf5f, 0xa65bb73f, 0x29867493, 0x00000020, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x6c5210a3, 0xbf5faefd, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f,
+	0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xaefdbf5f, 0x10c37472, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x29c70000, 0xbf5f8d97, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f,
+	0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0x95d8bf5f, 0x000031e8, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0xa67b3a09, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f,
+	0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0x29c7a65b, 0x00000000, 0x00000000,
+	0x00000000, 0x29c70000, 0xbf5fa67b, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f,
+	0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xa67cbf5f, 0x000031e8, 0x00000000,
+	0x00000000, 0x8d9710c3, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xce17bf3e,
+	0xbf3ebdb7, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0x10c395b8, 0x00000000,
+	0x00200000, 0xbf3f6c52, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xcdf7bf1d, 0xf347ec0c,
+	0xb36bb286, 0xbefdb5b6, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0x7473bf5f, 0x00000020,
+	0x29860000, 0xbf5faefd, 0xb73fbf5f, 0x967caefe, 0xbf5faf3e, 0xce38bf3e, 0xfb68e46e, 0xfb27fb47,
+	0xaa66b266, 0xb3cdaaa7, 0xbf3eb5f8, 0xb73ebf5f, 0xaedd961a, 0xb73fb71f, 0xb6febf5f, 0x00002986,
+	0x7cf40020, 0xb73fbf5f, 0x23927599, 0x13d40310, 0xcdf7661c, 0xfb47ec4d, 0xfb27fb26, 0xfb27fb27,
+	0xaa66b266, 0xaa66aa66, 0xb3acaa66, 0xa65bb5b6, 0x01482ace, 0x5cb5222b, 0xbf5faf3f, 0x00207cd4,
+	0xa67b2166, 0xbf5fbf5f, 0x02f06558, 0x2c1402f0, 0xf368a40f, 0xfb47fb47, 0xfb47fb47, 0xfb27fb47,
+	0xaa66b266, 0xaa66aa66, 0xaa66aa66, 0x9badaaa7, 0x01283b4f, 0x1bf40128, 0xaf3f66bf, 0x21459e5b,
+	0xbf3f4b0c, 0xbf5fbf5f, 0x0b52861b, 0x13511436, 0x930a32ee, 0xfb27e327, 0xfb47fb47, 0xfb27fb47,
+	0xaa66b266, 0xaa66aa66, 0x9a46aa66, 0x214761e7, 0x131011ca, 0x24f809ca, 0x5ebf367f, 0x4aecaf1f,
+	0xbf5f7cb4, 0xbf5fbf5f, 0x2435a6de, 0x94f12d9c, 0x330e83cc, 0x9b0a3aee, 0xfb27e328, 0xfb27fb27,
+	0xaa66b266, 0x9a46aa66, 0x216769e7, 0x836829c7, 0x2d3a9d2f, 0x2ddd12ef, 0x367f367f, 0x64935ebf,
+	0xbf5f9e1a, 0xbf5fbf5f, 0x86dfbf5f, 0xb5313e7f, 0xd44afc89, 0x230f7bad, 0x9b0a42ed, 0xfb27f327,
+	0xa266aa66, 0x296769e6, 0x7b481987, 0xfd88d4c8, 0x365fbdd0, 0x367f365f, 0x367f367f, 0x4559367f,
+	0xbf5fb71e, 0xbf5fbf5f, 0xb75fbf5f, 0xc5318eff, 0xfc89fc89, 0xdc6af48a, 0x2b0f7bad, 0x9b0a3aee,
+	0x296769e6, 0x7b4829c7, 0xfd68dd08, 0xfd88fd88, 0x367fbdcf, 0x367f367f, 0x367f367f, 0x467f367f,
+	0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xdd71bf5f, 0xfcaafc89, 0xfc89fc89, 0xcc4afc8a, 0x1aef6b8d,
+	0x6b081988, 0xfd68cca8, 0xfd88fd88, 0xfd88fd88, 0x367fbdcf, 0x367f367f, 0x367f367f, 0x3e7f367f,
+	0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xe591bf5f, 0xfcaafc8a, 0xfcaafcaa, 0xfcaafcaa, 0x5b6dfc8a,
+	0xfd8862c8, 0xfd88fd88, 0xfd88fd88, 0xfd88fd88, 0x367fbdcf, 0x367f367f, 0x367f367f, 0x367f367f,
+	0xbf5fb6fd, 0xbf5fbf5f, 0xbf5fbf5f, 0xe591bf5f, 0xfcaafc8a, 0xfcaafcaa, 0xfcaafcaa, 0x636dfcaa,
+	0xfd8862c8, 0xfd88fd88, 0xfd88fd88, 0xfd88fd88, 0x367fbdcf, 0x367f367f, 0x367f367f, 0x3e5e367f,
+	0xbf5f9df9, 0xbf5fbf5f, 0xbf5fbf5f, 0xe591bf5f, 0xfcaafc8a, 0xfcaafcaa, 0xfcaafcaa, 0x636dfcaa,
+	0xfd8862c8, 0xfd88fd88, 0xfd88fd88, 0xfd88fd88, 0x367fbdcf, 0x367f367f, 0x367f367f, 0x3559367f,
+	0xbf5f7473, 0xbf5fbf5f, 0xbf5fbf5f, 0xd5f4bf5f, 0xfcaaeccb, 0xfcaafcaa, 0xfcaafcaa, 0x636dfcaa,
+	0xfd8862c8, 0xfd88fd88, 0xfd88fd88, 0xed8afd88, 0x367f9df3, 0x367f367f, 0x367f367f, 0x2c54367f,
+	0xb73f4acc, 0xbf5fbf5f, 0xbf5fbf5f, 0xb73ebf5f, 0xb531965a, 0xfca9f4aa, 0xfcaafcaa, 0x636dfcaa,
+	0xfd8862c8, 0xfd88fd88, 0xf589fd88, 0x6639bdd0, 0x367f3e5e, 0x367f367f, 0x367f367f, 0x22cd365f,
+	0xa65b2145, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0x6e9eaf3f, 0xbd3065fa, 0xfc89ecab, 0x636dfc8a,
+	0xfd8862c8, 0xed8afd88, 0x6639bdcf, 0x367f3e5e, 0x367f367f, 0x367f367f, 0x367f367f, 0x0946359b,
+	0x74930020, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xaf3fbf5f, 0x3e5e5ebf, 0xc5306dd8, 0x636dfcaa,
+	0xfd8862c8, 0x6e18c5ce, 0x365f3e5e, 0x367f367f, 0x367f367f, 0x367f367f, 0x367f367f, 0x00413495,
+	0x21650000, 0xbf5faefd, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0x66bfaf3f, 0x365f367f, 0x3bd16df9,
+	0x6e383aec, 0x367f365f, 0x367f367f, 0x367f367f, 0x367f367f, 0x367f367f, 0x3e3e367f, 0x00001166,
+	0x00200000, 0xbf5f7472, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xaf3fbf5f, 0x365e5ebf, 0x14152d9b,
+	0x2d391310, 0x367f363e, 0x367f367f, 0x367f367f, 0x367f367f, 0x367f367f, 0x3433365f, 0x00000021,
+	0x00000000, 0x95d810c3, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0x55dbaf3f, 0x03110b52,
+	0x09aa01aa, 0x367f2cf8, 0x367f367f, 0x367f367f, 0x367f367f, 0x367f367f, 0x08e43539, 0x00000000,
+	0x00000000, 0x31e80000, 0xbf5fa67b, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xaf3fbf5f, 0x0b104d18,
+	0x1bf40169, 0x367f363e, 0x367f367f, 0x367f367f, 0x367f367f, 0x35dc367f, 0x000019e9, 0x00000000,
+	0x00000000, 0x00000000, 0xa67c29c7, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0x5539af3f,
+	0x363f2455, 0x367f367f, 0x367f367f, 0x367f367f, 0x367f367f, 0x1a0935dc, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x31e80000, 0xbf3f95b8, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f, 0xaf3fbf5f,
+	0x367f5e9e, 0x367f367f, 0x367f367f, 0x367f367f, 0x3539365f, 0x00001a09, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x747310c3, 0xbf5fb6fe, 0xbf5fbf5f, 0xbf5fbf5f, 0xbf5fbf5f,
+	0x66bfaf3f, 0x367f367f, 0x367f367f, 0x3e3e367f, 0x10e43433, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x7cf52986, 0xb73fa65b, 0xbf5fbf5f, 0xbf5fbf5f,
+	0xaf3fbf5f, 0x367f66bf, 0x359b365f, 0x118634b6, 0x00000021, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x4aec2165, 0x9e1a7cb4, 0xbf5fb6fe,
+	0xb6febf5f, 0x3c74961a, 0x11461aac, 0x00000041, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// SSD_icon565, 32x33px
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10420000, 0x30452024, 0x598c510a,
+	0x596b618c, 0x282640c8, 0x08211823, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x18430000, 0x8b51514a, 0xe6dcc557, 0xef1def3d,
+	0xef3def3d, 0xde5bef1d, 0x726eacb6, 0x10423066, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x10420000, 0xa43340e8, 0xe69cde7b, 0xe69ce69c, 0xe69ce69c,
+	0xe69ce69c, 0xe69ce69c, 0xe69ce69c, 0x7aafcdd9, 0x00202865, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x618c2044, 0xd61acd99, 0xd61ad61a, 0xde1ad61a, 0xde1ade1a,
+	0xde1ade1a, 0xde1ade1a, 0xd61ad61a, 0xd63ad61a, 0x5129ac95, 0x00000822, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x20240000, 0xc578592b, 0xcd99cd99, 0xcd99cd99, 0xcd99cd99, 0xcd99cd99,
+	0xcd99cd99, 0xcd99cd99, 0xcd99cd99, 0xcdb9cd99, 0xb496cdd9, 0x10224047, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x40282044, 0xbd17ac75, 0xc518c518, 0xc518c518, 0xc519c519, 0xcd19cd19,
+	0xcd19cd19, 0xcd19cd19, 0xc518cd39, 0xc558c518, 0xbd17cd79, 0x38277a6f, 0x00000801, 0x00000000,
+	0x00000000, 0x10420000, 0x69ad4048, 0xb496b496, 0xbc97bc97, 0xbc97bc97, 0xc498c498, 0xc498c498,
+	0xc498c498, 0xc498c498, 0xc4b8c498, 0xbc97bcb7, 0xb496bc96, 0x4028ac15, 0x00003047, 0x00000000,
+	0x00000000, 0x30460000, 0x7a4f50aa, 0xac15ac15, 0xb416b416, 0xbc16b416, 0xcd19ccf8, 0xcd19cd19,
+	0xcd19cd19, 0xcd39cd39, 0xcd59cd19, 0xb416c518, 0xac15b416, 0x508aac15, 0x20444008, 0x00000000,
+	0x00000000, 0x48692044, 0x7a0f4809, 0xa395a3b4, 0xab95ab95, 0xb396b396, 0xffdff77e, 0xffdfffbf,
+	0xffffffbf, 0xffffffbf, 0xffdfffbf, 0xabd6f75e, 0xa394ab95, 0x586ba394, 0x38284809, 0x00000000,
+	0x00000000, 0x40294088, 0x690d500a, 0xa314a354, 0xab15a314, 0xb316ab36, 0xccd9f77e, 0xddfcc438,
+	0xf6febb56, 0xe65cb336, 0xcd19bc17, 0xa335ef3d, 0x9b14a355, 0x500a92d2, 0x40084809, 0x00002024,
+	0x10420000, 0x48094028, 0x580b500a, 0xa2d49251, 0xa2b4a2b4, 0xaab6aab5, 0xcc59f75e, 0xdddbc3b8,
+	0xeeddb2b7, 0xe63cbad6, 0xccb9bb77, 0xa2b4ef3e, 0x9ad3a2b4, 0x580a794f, 0x40085009, 0x00003827,
+	0x20240000, 0x48094008, 0x600c500a, 0x9a12708e, 0xa234a274, 0xaa35a235, 0xcc39f75e, 0xddbbc398,
+	0xf6feb276, 0xe61bb276, 0xc498b336, 0x9a33ef1d, 0x89d19a33, 0x580b686d, 0x4809500a, 0x08214008,
+	0x30260000, 0x500a4808, 0x600c580b, 0x788f680d, 0x99b391b2, 0xa9d5a1d4, 0xffbff75e, 0xffdfffbf,
+	0xffdfffbf, 0xffdfffbf, 0xffdfffbf, 0x99d3eefd, 0x702e9152, 0x604c680d, 0x4809500a, 0x18434008,
+	0x38070000, 0x500a4809, 0x600c580b, 0x780f680d, 0x90d28030, 0xc3b8a154, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0x88b1eedd, 0x700e780f, 0x600c680d, 0x4809604c, 0x20244008,
+	0x38070000, 0x500a4809, 0x600d580b, 0x780f680e, 0x88118010, 0xf75e9913, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0x8011eedd, 0x700e800f, 0x600c680d, 0x4809580b, 0x30464008,
+	0x38081042, 0x500a4809, 0x600d580b, 0x780f700e, 0x88318010, 0xffffd55a, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0x8011eedd, 0x700e8010, 0x600c680d, 0x5009580b, 0x30664849,
+	0x38070821, 0x500a4809, 0x600c580b, 0x780f700e, 0x99938010, 0xffffffdf, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0x8811eedd, 0x700e8010, 0x600c680d, 0x502a580b, 0x3086506a,
+	0x38070000, 0x500a4809, 0x600c580b, 0x780f700d, 0x99538010, 0xffffe67c, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0x8011eedd, 0x700e8010, 0x600c680d, 0x504a580b, 0x28254008,
+	0x38270000, 0x500a4809, 0x600c580b, 0x780e680d, 0x8811800f, 0xffff9933, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0x8010eedd, 0x700e780f, 0x600c680d, 0x480a584b, 0x18234008,
+	0x20240000, 0x500a4808, 0x600c580b, 0x700e680d, 0x8891780f, 0xffffaa95, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0x8010eedd, 0x700e780f, 0x604c680d, 0x4809500a, 0x10224008,
+	0x18430000, 0x48094008, 0x580b500a, 0x680e680c, 0x99f3784f, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0x780feedd, 0x680d700e, 0x580b684d, 0x4808500a, 0x00003827,
+	0x00000000, 0x48093827, 0x580b500a, 0x704d600c, 0x91d2702e, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0x780feedd, 0x684e700e, 0x500a580c, 0x40084809, 0x00002845,
+	0x00000000, 0x40081824, 0x500a4809, 0x682d604c, 0x91b2680d, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0x702ee6dc, 0x600c704e, 0x500a580b, 0x38084809, 0x00000821,
+	0x00000000, 0x40680000, 0x504a4809, 0x580b582b, 0x708e680d, 0xa2949ab3, 0xaa94a294, 0xaa95aa95,
+	0xaa95aa95, 0xaa94aa95, 0xa294a294, 0x706e9232, 0x580b600c, 0x4809500a, 0x20444008, 0x00000000,
+	0x00000000, 0x18430000, 0x48294889, 0x580b500a, 0x600d600c, 0x700e680d, 0x780f780f, 0x8010780f,
+	0x780f800f, 0x780f780f, 0x700e700f, 0x600c706e, 0x500a580b, 0x48094809, 0x00003047, 0x00000000,
+	0x00000000, 0x00000000, 0x48492864, 0x500a4809, 0x580b580b, 0x680d600c, 0x700e680d, 0x700e700e,
+	0x700e700e, 0x680e700e, 0x704d680d, 0x580b686d, 0x4809500a, 0x38274008, 0x00001042, 0x00000000,
+	0x00000000, 0x00000000, 0x30860000, 0x48094849, 0x500a5009, 0x600c580b, 0x600d600c, 0x680d680d,
+	0x680d680d, 0x600d680d, 0x580b684d, 0x586b580b, 0x4009480a, 0x10223827, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x40082044, 0x48094808, 0x580b500a, 0x580b580b, 0x600c580b,
+	0x600c600c, 0x606c580b, 0x500a580b, 0x48095009, 0x38274009, 0x00001042, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x18430000, 0x40083827, 0x48094809, 0x500a500a, 0x500a500a,
+	0x500a500a, 0x500a586b, 0x48094809, 0x40084008, 0x08212846, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20440000, 0x40083827, 0x48094009, 0x48094809,
+	0x506a4809, 0x48094809, 0x40084008, 0x10233046, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10230000, 0x38262004, 0x38083827,
+	0x40284028, 0x30263827, 0x08212044, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08410000,
+	0x00000841, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// xxSSD_icon565, 32x32px
+	0x00040807, 0x08610001, 0x08800000, 0x00010000, 0x00200001, 0x00400040, 0x00400040, 0x00250023,
+	0x00030004, 0x00400020, 0x00400040, 0x00210020, 0x00200001, 0x00000020, 0x00010000, 0x00051887,
+	0x10850004, 0x00200841, 0x00200040, 0x00200040, 0x00200020, 0x00400040, 0x00400040, 0x00010020,
+	0x00200001, 0x00400040, 0x00400040, 0x00200020, 0x002010c2, 0x002008c0, 0x000010a0, 0x00040002,
+	0x00001083, 0x10e00020, 0x7c68c671, 0x63878ccc, 0x7c6a7c6b, 0x7ca77c88, 0x7c897c87, 0x744c746b,
+	0x746b744c, 0x7ca87c89, 0x7ca87ca7, 0x7c8b7c8a, 0x7c4a6bc8, 0xdf347c48, 0x00200060, 0x10830020,
+	0x00400000, 0x84880060, 0x952984c7, 0x8cea63c4, 0x6c256c26, 0x6c426c43, 0x6c246c43, 0x6c076c26,
+	0x6c266c07, 0x6c426c23, 0x6c436c42, 0x6c266c25, 0x84a77426, 0x6be38d08, 0x00409d4b, 0x00000860,
+	0x19200000, 0x8d08be70, 0x6c227463, 0x6c2484a6, 0x74447445, 0x74817462, 0x74827481, 0x74457464,
+	0x74857486, 0x74a27483, 0x748374a2, 0x74657464, 0x5b619528, 0x95676c02, 0xc6b163a2, 0x00200020,
+	0x00200040, 0x7c858cca, 0x8d0563c0, 0x53417444, 0x63c363c3, 0x63e163e1, 0x63e263e1, 0x63e463e3,
+	0x63e463e5, 0x64016402, 0x63e163e1, 0x63a363c3, 0x84c65361, 0x63a08d05, 0x8cca7c85, 0x08800020,
+	0x002008a1, 0x6be48ceb, 0x4b009547, 0x7c687446, 0x74497449, 0x7c687c68, 0x7c897c88, 0x7c8b7c8a,
+	0x7c6a7c6b, 0x74677c68, 0x74277447, 0x6c087408, 0x6be47448, 0x63e27464, 0x53049d6a, 0x00008caf,
+	0x10c00000, 0x74256386, 0x6c037424, 0x952d7c68, 0x5b495b48, 0x5b685b68, 0x63896388, 0x638c638b,
+	0x638b6b8c, 0x63886389, 0x5b485b68, 0x53285b28, 0x7407950d, 0x84c663a2, 0x6bc763a3, 0x004173cd,
+	0x00400020, 0x6c256be7, 0x6c246403, 0xb6338d0b, 0x4a89846f, 0x39e63a07, 0x4aaa3a27, 0x420b422a,
+	0x4a4b420a, 0x3a0752cb, 0x31c63a07, 0x94d14248, 0x7c89be54, 0x746463e3, 0x63a77c86, 0x002073ed,
+	0x00200020, 0x7ca66be6, 0x6c037cc4, 0x4ae65323, 0x31a74a88, 0x4229424a, 0x29882987, 0x39cb2969,
+	0x296939ab, 0x29872988, 0x3a094229, 0x52c92966, 0x5b854ac6, 0x6c427464, 0x6be663c2, 0x0040848e,
+	0x00400020, 0x74836c25, 0x64206c60, 0x8ced7446, 0x39e8636b, 0x31a831c8, 0x3a0a3187, 0x420c39ea,
+	0x39ea4a2c, 0x39c839ea, 0x39e831c8, 0x6bac31c7, 0x6c2584cc, 0x7cc26c41, 0x5bc37483, 0x0060742a,
+	0x00600040, 0x74816c44, 0x6c406420, 0xb6518d27, 0x3a077c4d, 0x29462966, 0x4a8b31c7, 0x420b422a,
+	0x422a422b, 0x42294a4a, 0x31a62145, 0x844e3a07, 0x7c85b630, 0x7ce16420, 0x5bc27cc3, 0x00606be9,
+	0x00600040, 0x7cc36404, 0x6c407cc1, 0x53445b81, 0x216452e7, 0x31a62985, 0x4a4839e7, 0x420839e7,
+	0x31c639e8, 0x52893a07, 0x29a62144, 0x4ac72144, 0x5bc25344, 0x6c606c60, 0x6c246420, 0x004084ac,
+	0x00400020, 0x74836c06, 0x6c407480, 0x848a6c44, 0x2164636a, 0x31a52124, 0x73ac52a9, 0x630b634b,
+	0x6b4b632b, 0x7bee73ad, 0x29652124, 0x636a2985, 0x6c2384aa, 0x6c606420, 0x64066c63, 0x00207c4d,
+	0x00400002, 0x6c456c09, 0x64216400, 0xbe938d2a, 0x29867c2e, 0x296510c3, 0x94905b0a, 0x7c0e8c4f,
+	0x94b08c4f, 0x9cd29d12, 0x212518e3, 0x846f31c7, 0x7c87c693, 0x7cc363e0, 0x5ba77cc7, 0x00036bae,
+	0x00200002, 0x7ca76408, 0x63e274a4, 0x5b275343, 0x18c44248, 0x31872105, 0x736c4a69, 0x738c736b,
+	0x6bab73ac, 0x844f73ec, 0x212518e3, 0x426710c3, 0x5b635305, 0x74836c42, 0x63a86c05, 0x00037c30,
+	0x00400020, 0x7cc56c47, 0x64016c62, 0x8cae7427, 0x20e75aec, 0x18841885, 0x398520c3, 0x41e53964,
+	0x21814245, 0x29a329c3, 0x10c21902, 0x5b4a2145, 0x6c048ccc, 0x746263e0, 0x73e87c85, 0x00017c0f,
+	0x00600040, 0x6c436405, 0x74636420, 0xc695956b, 0x2927632d, 0x290520c5, 0x52463164, 0x73aa62c8,
+	0x84aa6bc8, 0x21805b66, 0x110229e4, 0x8caf10c2, 0x9549c693, 0x74217462, 0x6ba66c03, 0x0021842e,
+	0x00400020, 0x7cc563e7, 0x64217cc3, 0x4ac44b21, 0x08804266, 0x21210880, 0x3a4229a1, 0x5b444263,
+	0x958884e7, 0x6c059dca, 0x004021c0, 0x42a60040, 0x4b014ac4, 0x84c46c01, 0x6ba67c85, 0x00007bed,
+	0x00400042, 0x746463c7, 0x6c617482, 0x7c896c45, 0x08e05327, 0x196000a0, 0x322029e0, 0x326029e0,
+	0x6c614300, 0xa60bbeec, 0x11404b03, 0x4ac71942, 0x6c067c8b, 0x7c836c23, 0x63a57444, 0x00607c2d,
+	0x00400001, 0x74657429, 0x6c416420, 0xbed28d69, 0x0900640a, 0x09400060, 0x220221e2, 0x19a00960,
+	0x8d6619e0, 0xae4dc74f, 0x3a648d0c, 0x740d1101, 0x8d0bc694, 0x6c216c03, 0x6c267444, 0x00207c4c,
+	0x00200001, 0x7ca66be8, 0x64207ca3, 0x53855381, 0x00603ac5, 0x22460060, 0x32a8436a, 0x006000e3,
+	0x642611a0, 0xa610ae6f, 0x1962744b, 0x3a670020, 0x53245348, 0x7cc46402, 0x63e57ca5, 0x0020742b,
+	0x00201082, 0x6c235b64, 0x74a374a2, 0x6c496c45, 0x008032a6, 0x6c7211a6, 0x5c558d98, 0x00a7098c,
+	0x00c10042, 0x744e5b8b, 0x00803247, 0x3a6700a2, 0x64066c2b, 0x7ca37484, 0x53636402, 0x08e0744b,
+	0x00200000, 0x7ca57c68, 0x5c006420, 0xae717d08, 0x096453aa, 0x74f52269, 0x649895db, 0x118f1a32,
+	0x218908e9, 0x198621c8, 0x00401985, 0x7c8e0060, 0x7cc8b671, 0x64415be0, 0x74677ca4, 0x00207c4c,
+	0x00200000, 0x8ce66364, 0x64417482, 0x53c66c65, 0x01622243, 0x436d09a4, 0x64766cf5, 0x00ed2292,
+	0x112a114d, 0x19651967, 0x00a00901, 0x32811160, 0x5bc163e4, 0x85246c81, 0x63c66402, 0x002084af,
+	0x00200000, 0x74248489, 0x642163e0, 0x74a86c64, 0x22634b86, 0x2ac61202, 0x43af43ac, 0x2a6f3310,
+	0x1928116b, 0x2a041986, 0x22002a21, 0x43202a60, 0x74a274a4, 0x6c614340, 0x84cb63e3, 0x08a40020,
+	0x00000000, 0x84a794ec, 0x95667c83, 0x5be36402, 0x5c056ca7, 0x4be44ba3, 0x3b864be6, 0x32c93308,
+	0x2a062a28, 0x4b433283, 0x5be05be2, 0x64415c00, 0x64406440, 0x85258523, 0x63a97c87, 0x000408a3,
+	0x08400001, 0x6384a54f, 0x536084a6, 0x7ca77485, 0x6c656c86, 0x6ca46484, 0x43825c63, 0x2aa42ae3,
+	0x42c53ac6, 0x64024b22, 0x74a17482, 0x74827481, 0x74827ce3, 0x53607ce3, 0xadd37427, 0x10870002,
+	0x10a30002, 0x8cab0040, 0x9d8b63a4, 0x6c2663c5, 0x6c457447, 0x64626443, 0x5c246443, 0x5be85c06,
+	0x5ba75ba8, 0x6c636404, 0x74837483, 0x74857464, 0x74656c04, 0x7c667465, 0x0020950c, 0x00040863,
+	0x00010804, 0x19000000, 0x6366a56e, 0x6367952d, 0x6be66be8, 0x640363e4, 0x6c266c24, 0x63e96c08,
+	0x6be963c9, 0x6c056c27, 0x63e463e4, 0x6be86bc7, 0x6bc8742a, 0xb6107408, 0x00600040, 0x00020001,
+	0x00020824, 0x002010c2, 0x00201920, 0x8cb05b29, 0x844d7c2d, 0x848b848b, 0x846c848b, 0x73ae7c0e,
+	0x7c4f7c2f, 0x7c4b7c6d, 0x742c742b, 0x7c107c0f, 0x94b173ae, 0x00200020, 0x00600060, 0x000118e3,
+	0x00020003, 0x00200000, 0x10a00020, 0x08410000, 0x00200000, 0x00200020, 0x00000020, 0x00230021,
+	0x00000001, 0x00200020, 0x00200020, 0x00030002, 0x00010003, 0x08800000, 0x00200020, 0x00000020,
+	// clock_icon565, 32x32px
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00c30000, 0x1cb212eb, 0x25b62575, 0x25b625b6, 0x25b625b6, 0x25b625b6,
+	0x25b625b6, 0x25b625b6, 0x25b625b6, 0x257525b6, 0x12eb1cb2, 0x000000c3, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x25b6132c, 0x25b625b6, 0x25b625b6, 0x25b625b6, 0x25d625b6, 0x4e383df7,
+	0x3e174e38, 0x25b625d6, 0x25b625b6, 0x25b625b6, 0x25b625b6, 0x132c25b6, 0x00000000, 0x00000000,
+	0x00000000, 0x132c0000, 0x25b625b6, 0x25b625b6, 0x25b625b6, 0x6e7925b6, 0xf7dfbf5c, 0xf7dfffff,
+	0xfffff7df, 0xbf5df7df, 0x2db67699, 0x25b625b6, 0x25b625b6, 0x25b625b6, 0x0000132c, 0x00000000,
+	0x00000000, 0x259600c2, 0x259625b6, 0x25962596, 0x6e792596, 0xe7bee7be, 0x56188eda, 0x25962db6,
+	0x2db62596, 0x8eda4e18, 0xe7bedfbe, 0x25966e79, 0x25962596, 0x25962596, 0x00c32596, 0x00000000,
+	0x00000000, 0x259512cb, 0x25952595, 0x25962595, 0xefdfaf1c, 0x25967e79, 0x25952595, 0x25952595,
+	0x25952595, 0x25952595, 0x76792595, 0xaf1cefdf, 0x25952d96, 0x25952595, 0x12cb2595, 0x00000000,
+	0x00000000, 0x25751c71, 0x25752575, 0xbf5d2595, 0x3db6d77d, 0x25752575, 0x25752575, 0x25752575,
+	0x25752575, 0x25752575, 0x25752575, 0xcf7d35b6, 0x2d96c75d, 0x25752575, 0x1c712575, 0x00000000,
+	0x00000000, 0x25751d14, 0x25752575, 0xd77daefb, 0x25752d95, 0x25752575, 0x25752575, 0x2d952575,
+	0x25752d96, 0x25752575, 0x25752575, 0x2d952575, 0xaf1ccf7d, 0x25752575, 0x1d142575, 0x00000000,
+	0x00000000, 0x25541d34, 0x66382554, 0x3d96efdf, 0x25542554, 0x25542554, 0x25542554, 0x5df72554,
+	0x25546618, 0x25542554, 0x25542554, 0x25542554, 0xefbe3595, 0x25546e38, 0x1d342554, 0x00000000,
+	0x00000000, 0x1d341d34, 0xe79e2554, 0x1d347658, 0x1d341d34, 0x1d341d34, 0x1d341d34, 0x66171d34,
+	0x1d346e38, 0x1d341d34, 0x1d341d34, 0x1d341d34, 0x6e381d34, 0x2554e7be, 0x1d341d34, 0x00000000,
+	0x00000000, 0x1d341d13, 0xe79e6e18, 0x1d342534, 0x1d141d34, 0x1d341d14, 0x1d141d34, 0x6e181d34,
+	0x1d147638, 0x1d341d14, 0x1d341d34, 0x1d341d34, 0x25341d34, 0x7638df9d, 0x1d131d34, 0x00000000,
+	0x00000000, 0x1d131cf3, 0x8e79b71c, 0x1d131d13, 0x1d131d13, 0x1d131d13, 0x1d131d13, 0x76381d13,
+	0x1d137e58, 0x1d131d13, 0x1d131d13, 0x1d131d13, 0x1d131d13, 0xbf3c8659, 0x1cf31d13, 0x00000000,
+	0x00000000, 0x1cf31cf3, 0x4d95efdf, 0x1cf31cf3, 0x1cf31cf3, 0x1cf31cf3, 0x1cf31cf3, 0x7e381cf3,
+	0x1cf38659, 0x1cf31cf3, 0x1cf31cf3, 0x1cf31cf3, 0x1cf31cf3, 0xf7df4575, 0x1cd324f3, 0x00000000,
+	0x00000000, 0x35341cd2, 0x24f3ffff, 0x1cd31cd3, 0x1cd31cd3, 0x1cd31cd3, 0x1cd31cd3, 0x86591cd3,
+	0x1cd38e79, 0x1cd31cd3, 0x1cd31cd3, 0x1cd31cd3, 0x1cd31cd3, 0xffff1cf3, 0x1cd23d54, 0x00000000,
+	0x00000000, 0xaeda1cb2, 0x8638ffff, 0x1cb21cb2, 0x1cd21cb2, 0x1cb21cb2, 0x1cb21cb2, 0x8e591cb2,
+	0x1cb2a6ba, 0x1cb21cb2, 0x1cb21cb2, 0x1cb21cb2, 0x1cd21cb2, 0xe79e1cb2, 0x1cb24d75, 0x00000000,
+	0x00000000, 0x65b61c92, 0x4534ffff, 0x1cb21cb2, 0x1cb21cb2, 0x1cb21cb2, 0x1cb21cb2, 0x4d551cb2,
+	0x4d75efbe, 0x1cb21cb2, 0x1cb21cb2, 0x1cb21cb2, 0x1cb21cb2, 0xe79e1cb2, 0x1c924d55, 0x00000000,
+	0x00000000, 0x1c911c71, 0x1c925d96, 0x1c921c92, 0x1c921c92, 0x1c921c92, 0x1c921c91, 0x1c921c92,
+	0xd75d4534, 0x1c913d13, 0x1c921c91, 0x1c921c92, 0x1c921c92, 0xf7df1c92, 0x1c713d13, 0x00000000,
+	0x00000000, 0x1c711c71, 0x1c711c71, 0x1c711c71, 0x1c711c71, 0x1c711c71, 0x1c711c71, 0x1c711c71,
+	0x34d31c71, 0x2cb2b6db, 0x1c711c71, 0x1c711c71, 0x1c711c71, 0xf7df3cf3, 0x1c711c71, 0x00000000,
+	0x00000000, 0x1c511c51, 0x1c511c51, 0x1c511c51, 0x1c511c51, 0x1c511c51, 0x1c711c51, 0x1c511c51,
+	0x1c711c51, 0x65962492, 0x1c511c51, 0x1c511c51, 0x1c511c51, 0xbefb7df7, 0x1c511c71, 0x00000000,
+	0x00000000, 0x1c501c30, 0x1c501c50, 0x1c501c50, 0x1c501c50, 0x1c501c50, 0x1c501c50, 0x1c501c50,
+	0x1c501c50, 0x1c501c50, 0x1c501c50, 0x1c501c50, 0x1c501c50, 0x6db6d75d, 0x1c301c50, 0x00000000,
+	0x00000000, 0x1c301c30, 0x1c301c30, 0x1c301c30, 0x1c301c30, 0x1c301c30, 0x1c301c30, 0x1c301c30,
+	0x1c301c30, 0x1c301c30, 0x1c301c30, 0x1c301c30, 0x65751c30, 0x1c50e79e, 0x1c301c30, 0x00000000,
+	0x00000000, 0x1410140f, 0x14101410, 0x14101410, 0x14101410, 0x14101410, 0x14101410, 0x14101410,
+	0x14101410, 0x14101410, 0x14101410, 0x14101410, 0xe79e2471, 0x14106d75, 0x140f1410, 0x00000000,
+	0x00000000, 0x140f13cf, 0x140f140f, 0x140f140f, 0x140f1c10, 0x140f140f, 0x140f140f, 0x140f140f,
+	0x140f140f, 0x140f140f, 0x140f140f, 0x1c30140f, 0xae9ac6fb, 0x140f140f, 0x13cf140f, 0x00000000,
+	0x00000000, 0x13ef134c, 0x13ef13ef, 0x655513ef, 0x2c50c71c, 0x13ef13ef, 0x13ef13ef, 0x13ef13ef,
+	0x13ef13ef, 0x13ef13ef, 0x13ef13ef, 0xc6fb2430, 0x1c10c6fb, 0x13ef13ef, 0x134c13ef, 0x00000000,
+	0x00000000, 0x13ef09e7, 0x13ef13ef, 0x1bef13ef, 0xe79ea679, 0x13ef6534, 0x13cf13ef, 0x13ef13cf,
+	0x13ef13ef, 0x13ef13ef, 0x5d3413ef, 0xae79e79e, 0x13ef1c0f, 0x13ef13ef, 0x09e713ef, 0x00000000,
+	0x00000000, 0x13cf0082, 0x13cf13cf, 0x13cf13cf, 0x653413cf, 0xd73ce77d, 0x3c717db6, 0x13cf13cf,
+	0x13cf13cf, 0x75963471, 0xe77dd73c, 0x13cf6534, 0x13cf13cf, 0x13cf13cf, 0x008213cf, 0x00000000,
+	0x00000000, 0x0a080000, 0x13ce13ce, 0x13ce13ce, 0x13ae13ce, 0x65341bcf, 0xf7beb6ba, 0xe77df7df,
+	0xf7dfe77d, 0xbebaf7be, 0x1bcf6d54, 0x13ce13ce, 0x13ae13ce, 0x13ce13ce, 0x00000a08, 0x00000000,
+	0x00000000, 0x00000000, 0x13ae0a08, 0x13ae13ae, 0x13ae13ae, 0x13ae13ae, 0x13ae13ae, 0x44922c30,
+	0x34304492, 0x13ae13ae, 0x13ae13ae, 0x13ae13ae, 0x13ae13ae, 0x0a0813ae, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00810000, 0x12eb09c7, 0x138e138d, 0x138e138e, 0x138e138e, 0x138e138e,
+	0x138e138e, 0x138e138e, 0x138e138e, 0x136d138e, 0x09c712eb, 0x00000082, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// ssd_icon, 32x32px
+	0x00000000, 0x00000000, 0x00c63180, 0x00c63180, 0x00c63180, 0x00c63180, 0x03ffffe0, 0x03ffdfe0,
+	0x3f3f9ffe, 0x3f3f9ffe, 0x03ff1fe0, 0x03ff1fe0, 0x03fe3fe0, 0x3ffe3ffe, 0x3ffc3ffe, 0x03fc03e0,
+	0x03f007e0, 0x03e01fe0, 0x3ffe3ffe, 0x3ffe7ffe, 0x03fc7fe0, 0x03fc7fe0, 0x03fcffe0, 0x3ff8fffe,
+	0x3ff9fffe, 0x03f9ffe0, 0x03ffffe0, 0x00c63180, 0x00c63180, 0x00c63180, 0x00c63180, 0x00000000,
+	// start_icon, 32x32px
+	0x0007e000, 0x0007e000, 0x0007e000, 0x00038000, 0x00038000, 0x070ff060, 0x0ffffcf0, 0x07ffffe0,
+	0x03f00fc0, 0x03c0e3c0, 0x0780f9e0, 0x0f00fce0, 0x0e00fe70, 0x0e00ff70, 0x1c00ff38, 0x1c00ffb8,
+	0x1c00ffb8, 0x1c00ffb8, 0x1c000038, 0x1c000038, 0x1c000038, 0x1c000038, 0x0e000070, 0x0e000070,
+	0x070000e0, 0x078001e0, 0x03e007c0, 0x01f81f80, 0x007ffe00, 0x003ffc00, 0x0007e000, 0x00000000,
+	// clock_icon, 32x32px
+	0x00000000, 0x00000000, 0x00000000, 0x0003c000, 0x001ff800, 0x00781e00, 0x00c18300, 0x01818180,
+	0x030180c0, 0x06018060, 0x04018020, 0x0c018030, 0x0c018030, 0x08018010, 0x18018018, 0x1801fe18,
+	0x1801fe18, 0x18000018, 0x08000010, 0x0c000030, 0x0c000030, 0x04000020, 0x06000060, 0x030000c0,
+	0x01800180, 0x00c00300, 0x00781e00, 0x001ff800, 0x0003c000, 0x00000000, 0x00000000, 0x00000000,
+	// gps_icon, 32x32px
+	0x00000000, 0x00000000, 0x00000000, 0x0007f000, 0x007fff00, 0x01ffffc0, 0x07fffff0, 0x1ff80ffc,
+	0x3f8000fe, 0x7e00003f, 0x7c0ff81f, 0x787fff0f, 0x20ffff82, 0x03ffffe0, 0x07f007f0, 0x07c001f0,
+	0x0781c0f0, 0x020ff820, 0x001ffc00, 0x003ffe00, 0x007e3f00, 0x00780f00, 0x00000000, 0x0001c000,
+	0x0003e000, 0x0003e000, 0x0003e000, 0x0001c000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// battery_icon, 32x32px
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1fffffc0, 0x30000060,
+	0x20000020, 0x2fbe0020, 0x2fbe0020, 0x2fbe0020, 0x2fbe003c, 0x2fbe0004, 0x2fbe0004, 0x2fbe0004,
+	0x2fbe0004, 0x2fbe0004, 0x2fbe0004, 0x2fbe003c, 0x2fbe0020, 0x2fbe0020, 0x2fbe0020, 0x20000020,
+	0x30000060, 0x1fffffc0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// temp_icon, 32x32px
+	0x000fe000, 0x00183000, 0x00101000, 0x00301800, 0x00200800, 0x00200800, 0x0027c800, 0x0027c800,
+	0x0027c800, 0x0027c800, 0x0027c800, 0x0027c800, 0x0027c800, 0x0027c800, 0x0027c800, 0x0027c800,
+	0x0027c800, 0x0027c800, 0x0027c800, 0x0027c800, 0x0067cc00, 0x00cfe600, 0x009ff200, 0x009ff200,
+	0x009ff200, 0x009ff200, 0x00dff600, 0x004fe400, 0x0067cc00, 0x00301800, 0x001ff000, 0x00000000,
+	// amps_icon, 32x32px
+	0x00000000, 0x00000000, 0x0001ff00, 0x0003ff00, 0x0003fe00, 0x0003fe00, 0x0007fc00, 0x0007f800,
+	0x000ff800, 0x000ff000, 0x000fe000, 0x001fe000, 0x001fff80, 0x001fff80, 0x003fff00, 0x003fff00,
+	0x007ffe00, 0x007ffc00, 0x007ff800, 0x0003f000, 0x0003e000, 0x0007c000, 0x0007c000, 0x000f8000,
+	0x000f0000, 0x000e0000, 0x001c0000, 0x00180000, 0x00380000, 0x00300000, 0x00200000, 0x00000000,
+	// gforce_icon, 32x32px
+	0x00000000, 0x00008000, 0x0001c000, 0x0003e000, 0x0007f000, 0x00008000, 0x00008000, 0x00008000,
+	0x00008000, 0x0001c000, 0x0003e000, 0x000e3800, 0x00380e00, 0x00e00380, 0x00b00680, 0x00980c80,
+	0x008e3880, 0x0083e080, 0x0081c080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x21c081c2,
+	0x27308672, 0x3c1c9c1e, 0x7807f00f, 0x7801c007, 0x1c00801c, 0x00000000, 0x00000000, 0x00000000,
+	// BootImage, 240x160px
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0e000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x3f800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x7b800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x60c00000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0xc0e00000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0xc0600000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0xc0600000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0xc0300000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000001, 0xc0300000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000001, 0x80300000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000001, 0x80180000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000001, 0x80180000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000001, 0x80180000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000001, 0x80180000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000001, 0x800c0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000001, 0x800c0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000001, 0x800c0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000003, 0x80060000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000003, 0x00060000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000003, 0x00060000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000003, 0x00070000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000003, 0x00030000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000003, 0x000300f8, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000003, 0x000301fc, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000003, 0x00018386, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00018300, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0fe00002, 0x0001870f, 0xfc000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x03f0007f, 0xf001c63f, 0xff800000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00f801ff, 0xfe00c0ff, 0xffe00000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x000001ff, 0x007807c1, 0xffc0c1ff, 0xfff80000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000007, 0xc0380e00, 0x3ff80fff, 0xfffe0000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000003, 0xf0381800, 0x0fffffff, 0xffff8000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0007f803, 0xff382006, 0x07ffffff, 0xffffe000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001fff07, 0xfff0403f, 0xe3ffffff, 0xfffff800, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00001fff, 0xffe000ff, 0xf1ffffff, 0xffffff00, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000fff, 0xfc0001f0, 0x78ffffff, 0xfffffff0, 0x000003fc, 0x00000000, 0x00000000,
+	0x00000000, 0x00000ff7, 0xfe000780, 0x3c7fffff, 0xffffffff, 0xffe00ffe, 0x00000000, 0x00000000,
+	0x00000000, 0x00003f83, 0xff000f00, 0x1c1fffff, 0xffffffff, 0xfffc1fbf, 0x00000000, 0x00000000,
+	0x00000000, 0x00007e07, 0xffe41c00, 0x0e0fffff, 0xffffffff, 0xffff8007, 0x80000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1ffc1800, 0x0e07ffff, 0xffffffff, 0xffffe003, 0xc0000000, 0x00000000,
+	0x00000000, 0x0000007e, 0x1ffc3000, 0x0e01ffff, 0xffffffff, 0xfffff001, 0xc0000000, 0x00000000,
+	0x00000000, 0x000001ff, 0xfff87000, 0x0600ffff, 0xffffffff, 0xfffffc00, 0xe0000000, 0x00000000,
+	0x00000000, 0x0000003f, 0xfff8e000, 0x06003fff, 0xfffffffe, 0x001ffe00, 0xe0000000, 0x00000000,
+	0x00000000, 0x0000000f, 0xfff0c000, 0x0e000fff, 0xffffffe0, 0x0003ff00, 0x60000000, 0x00000000,
+	0x00000000, 0x00000003, 0xffe1c000, 0x0e0003ff, 0xffffff00, 0x0000ff80, 0x60000000, 0x00000000,
+	0x00000000, 0x00000000, 0xffc1c000, 0x0e0000ff, 0xfffff000, 0x1fe07fc0, 0x60000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1f018000, 0x0400001f, 0xfffe0000, 0x7ff83fe0, 0x60000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7e000001, 0xfffc1ff0, 0x60000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000003, 0xf0fe0ff8, 0xe0000000, 0x00000000,
+	0x00000000, 0x00000fe0, 0x0781ff9f, 0xc07807e0, 0x7fe00007, 0xc01f0ffc, 0xe0000000, 0x00000000,
+	0x00000000, 0x00001ff8, 0x1f83ff3f, 0xf0f83ff8, 0x7fe0000f, 0x000f07fc, 0xc0000000, 0x00000000,
+	0x00000000, 0x00003ffc, 0x3f87ff7f, 0xf0f0fff8, 0xffe0001e, 0x000f07fe, 0x40000000, 0x00000000,
+	0x00000000, 0x00003cf8, 0x7f80f079, 0xf1e1f8fc, 0x1e00003c, 0x000787ff, 0x00000000, 0x00000000,
+	0x00000000, 0x000078f8, 0xff81f0f1, 0xf1e7c07c, 0x3c000038, 0x000783ff, 0x00000000, 0x00000000,
+	0x00000000, 0x0000f9f1, 0xe781e0ff, 0xe3c78078, 0x7c000070, 0x000383ff, 0x80000000, 0x00000000,
+	0x00000000, 0x0000ffe3, 0xcf83c1ff, 0x87cf0078, 0x78000070, 0x000383ff, 0xc0000000, 0x00000000,
+	0x00000000, 0x0001ff87, 0xcf83c3fe, 0x078f00f0, 0xf80000e0, 0x000383ff, 0xc0000000, 0x00000000,
+	0x00000000, 0x0001e00f, 0xff8783de, 0x0f9f83e0, 0xf00000e0, 0x000387ff, 0xe0000000, 0x00000000,
+	0x00000000, 0x0003c01f, 0xff0f87df, 0x0f0fffc1, 0xe00001c0, 0x000387ff, 0xe0000000, 0x00000000,
+	0x00000000, 0x0003c03c, 0x0f0f079f, 0x1e0fff81, 0xe00001c0, 0x000707ff, 0xf0000000, 0x00000000,
+	0x00000000, 0x00078078, 0x0f1e0f1f, 0x9e07fc03, 0xc00001c0, 0x00070fff, 0xf0000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000001c0, 0x00070fff, 0xf8000000, 0x00000000,
+	0x00000000, 0x00000000, 0xffc01f00, 0x3fcf1f03, 0xe07fc1c0, 0x000e1fff, 0xf8000000, 0x00000000,
+	0x00000000, 0x00000000, 0xffc03f01, 0xff9f3f03, 0xc1ffc1c0, 0x000e1fff, 0xf8000000, 0x00000000,
+	0x00000000, 0x00000001, 0xffe07f03, 0xff9e3f87, 0x87f7e1c0, 0x001c00ff, 0xf0000000, 0x00000000,
+	0x00000000, 0x00000001, 0xe3c0ff07, 0xc13c7f87, 0x8f8381c0, 0x003c000f, 0xc0000000, 0x00000000,
+	0x00000000, 0x00000003, 0xc781ff0f, 0x003c7fcf, 0x1f0001e0, 0x00780000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000003, 0xff07df1e, 0x0078f7df, 0x3e3fc1f0, 0x00f00000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000007, 0xfc0f9f3e, 0x00f8f3fe, 0x3c3fc0f0, 0x01e00000, 0x00000000, 0x00000000,
+	0x00000000, 0x0000000f, 0xf81fff3e, 0x00f1e3fe, 0x7c3f80fc, 0x07c00000, 0x00000000, 0x00000000,
+	0x00000000, 0x0000000f, 0x7c3ffe3f, 0x19f3e1fc, 0x7c1f007f, 0xff800000, 0x00000000, 0x00000000,
+	0x00000000, 0x0000001f, 0x7c7ffe3f, 0xf9e3c1f8, 0x3ffe003f, 0xfe000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0000001e, 0x3ef81e1f, 0xf3c7c0f8, 0x3ff8000f, 0xf8000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0000001c, 0x3ee01e07, 0xe3c780f0, 0x0fc00003, 0xe0000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	// Key, 20x20px
+	0x00700000, 0x01fc0000, 0x03fe0000, 0x038e0000, 0x07070000, 0x06030000, 0x06030000, 0x07070000,
+	0x0fff8000, 0x0fff8000, 0x1fffc000, 0x1f8fc000, 0x1f8fc000, 0x1fdfc000, 0x1fdfc000, 0x1fdfc000,
+	0x1fdfc000, 0x1fffc000, 0x0fff8000, 0x07ff0000,
+	// Unlock, 20x20px
+	0x00f80000, 0x01dc0000, 0x038c0000, 0x030c0000, 0x03000000, 0x03000000, 0x03000000, 0x1fff8000,
+	0x3fffc000, 0x3e07c000, 0x3cf3c000, 0x3cf3c000, 0x3cf3c000, 0x3c63c000, 0x3c63c000, 0x3c63c000,
+	0x3c63c000, 0x3e07c000, 0x3fffc000, 0x1fff8000,
+	// Flag_01, 34x34px
+	0x0000f800, 0x00000000, 0x001ff800, 0x00000000, 0x007ff818, 0x00000000, 0x1dfff9f0, 0x00000000,
+	0x1dfffbf0, 0x00000000, 0x1dfffbf0, 0x00000000, 0x0dfffbf0, 0x00000000, 0x0dfffbf0, 0x00000000,
+	0x0ffffbf0, 0x00000000, 0x0efffbf0, 0x00000000, 0x0efffbf0, 0x00000000, 0x06fffbf0, 0x00000000,
+	0x07fffbf0, 0x00000000, 0x077ffbf0, 0x00000000, 0x077f3bf0, 0x00000000, 0x077003f0, 0x00000000,
+	0x036007c0, 0x00000000, 0x03800700, 0x00000000, 0x03800000, 0x00000000, 0x03800000, 0x00000000,
+	0x01800000, 0x00000000, 0x01800000, 0x00000000, 0x01c00000, 0x00000000, 0x01c00000, 0x00000000,
+	0x01c00000, 0x00000000, 0x00c00000, 0x00000000, 0x00e00000, 0x00000000, 0x00e00000, 0x00000000,
+	0x00e00000, 0x00000000, 0x00e00000, 0x00000000, 0x00600000, 0x00000000, 0x00700000, 0x00000000,
+	0x00300000, 0x00000000, 0x00000000, 0x00000000,
+	// Checkard, 34x34px
+	0x00f00000, 0x00000000, 0x00f00000, 0x00000000, 0x00600000, 0x00000000, 0x00e00000, 0x00000000,
+	0x00ffc000, 0x80000000, 0x00e7f001, 0x80000000, 0x01c79c07, 0x80000000, 0x01c787ff, 0x80000000,
+	0x01c78fcf, 0x00000000, 0x01f10f1f, 0x00000000, 0x03f0cf1f, 0x00000000, 0x03f1fe13, 0x00000000,
+	0x03f1e1e2, 0x00000000, 0x079de1c6, 0x00000000, 0x071ee3c6, 0x00000000, 0x073e23dc, 0x00000000,
+	0x0e3c3ffc, 0x00000000, 0x0ffc3c7c, 0x00000000, 0x0f1f7c78, 0x00000000, 0x1e03f8f8, 0x00000000,
+	0x1e007fe0, 0x00000000, 0x1c001f00, 0x00000000, 0x1c000000, 0x00000000, 0x3c000000, 0x00000000,
+	0x38000000, 0x00000000, 0x38000000, 0x00000000, 0x78000000, 0x00000000, 0x70000000, 0x00000000,
+	0x70000000, 0x00000000, 0x70000000, 0x00000000, 0xf0000000, 0x00000000, 0xe0000000, 0x00000000,
+	0xe0000000, 0x00000000, 0xe0000000, 0x00000000,
+	// GPUSA_Logo, 295x125px
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08410000,
+	0x08410841, 0x10a310c3, 0x108210a2, 0x00000861, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00410000, 0x110510a3, 0x21aa1968, 0x220d21eb,
+	0x2a90222e, 0x2af22ad1, 0x2ad23313, 0x33143314, 0x2b352af4, 0x2b142b34, 0x2af42af4, 0x21ca32d1,
+	0x00000021, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08830020, 0x21cb1947, 0x2ab12a4e,
+	0x2af42af3, 0x2b152b15, 0x2af42b15, 0x2af52af4, 0x2b152af4, 0x2b142b15, 0x2af52af4, 0x2b152af4,
+	0x2b142b15, 0x2af42b15, 0x2af52af4, 0x10a32b14, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21ca10c4,
+	0x33132a6f, 0x2b152b35, 0x2b152b15, 0x2b352b35, 0x2b152b35, 0x2b152b15, 0x2b352b14, 0x2b352b35,
+	0x2b142b15, 0x2b352b14, 0x2b352b35, 0x2b152b15, 0x2b142b14, 0x2b352b15, 0x2b142b35, 0x00000882,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x08410000, 0x2a2d1947, 0x2af432f3, 0x2b352b15, 0x2b152b35, 0x2af52b15, 0x2b352b14, 0x2b352b34,
+	0x2b152b15, 0x2b142b15, 0x2b352b35, 0x2af42b35, 0x2af42af4, 0x2b552b35, 0x2b352b35, 0x2b142b15,
+	0x2b552b14, 0x2b352b35, 0x002032d1, 0x00000000, 0x00000000, 0x08410000, 0x10c40862, 0x00410062,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00210000, 0x2a4e1947, 0x2b153314, 0x2af42af4, 0x2b152af4, 0x2b152b15,
+	0x2af52b15, 0x2b152af5, 0x2b142b35, 0x2b152b15, 0x2af52b15, 0x2b352b14, 0x23f72376, 0x2ad32395,
+	0x331332f3, 0x2b143334, 0x1bf72b35, 0x23761bf7, 0x2b352b35, 0x21aa2b35, 0x00000000, 0x00000000,
+	0x21880000, 0x32b1220d, 0x2b142ad3, 0x32d13314, 0x086221ca, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x22ae10c4, 0x2b1532f3, 0x2b152b15,
+	0x2b352b15, 0x23762b15, 0x23962396, 0x23762396, 0x23762396, 0x23562376, 0x2ab12b13, 0x21cb2a4e,
+	0x19061968, 0x08a308c4, 0x08410861, 0x00200020, 0x08410841, 0x10a30841, 0x11ea1146, 0x23961c99,
+	0x2b152b15, 0x000010c4, 0x00000000, 0x00000000, 0x00000000, 0x00210000, 0x19aa10e4, 0x2b1532d1,
+	0x21aa2af3, 0x00000041, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10e50000,
+	0x24182ad0, 0x2b3523f7, 0x2b152b15, 0x2b152b15, 0x2b352b35, 0x14991c59, 0x14991499, 0x1bd41c78,
+	0x19c8128d, 0x002010e4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x24990020, 0x2b151bf8, 0x00002ab1, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x2ad11926, 0x2b132b55, 0x000010e5, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x2a901106, 0x2b152b14, 0x2b152b15, 0x2b152b15, 0x2b152af5, 0x2b152b15,
+	0x23d52b14, 0x196822af, 0x002010c4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08410000, 0x239614ba, 0x21ca2b15,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21ca0020,
+	0x2af42b35, 0x00001968, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10e50000, 0x2b1532b0, 0x2b152b15, 0x2b152b15,
+	0x2b152b15, 0x2b152b15, 0x2a4e32f3, 0x10a31988, 0x00000020, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x239610e4, 0x2b152b15, 0x000010c4, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x11050000, 0x2b142af3, 0x00001127, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2a4e10c4,
+	0x2b152b15, 0x2b352b15, 0x2b352b35, 0x2af42b15, 0x222d2af3, 0x00201926, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11470000, 0x2b552b35, 0x00003313, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08820000, 0x00000861, 0x00000000, 0x19050000,
+	0x2b353334, 0x00001947, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x08830000, 0x2b152a2d, 0x2b152b15, 0x2b152b15, 0x2b152b15, 0x2ab12b15, 0x08411948,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x2b151a0b, 0x2a4e2b55, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1cd90a6d, 0x2a4e2b74, 0x110621aa, 0x19260862, 0x33142b75, 0x000010c4, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2a2d0883, 0x2b152af4, 0x2b352b56, 0x2b152b15,
+	0x2b142b15, 0x10e5222d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1a6d0000, 0x2b352b15, 0x00001968, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x128d0000, 0x2b35149a, 0x2b152b15, 0x2b352b35, 0x33343313,
+	0x32b12b15, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08a30000, 0x2b14220c,
+	0x2b352b35, 0x0cda1479, 0x23d714ba, 0x2a0c3334, 0x00000883, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b352b72,
+	0x08832b15, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x14791a2b,
+	0x2b152b15, 0x2b352b15, 0x2b352b35, 0x2b152b35, 0x21ca2b15, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1b1010c3, 0x2b352b55, 0x2b352b35, 0x14591bd7, 0x23b52b35, 0x08621a6d, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1b730000, 0x2ad22b35, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x10e40000, 0x23561479, 0x23762376, 0x2b152356, 0x2b352b15, 0x14fb1c39,
+	0x10c31cb9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x11050000, 0x23d722af, 0x2b350cda, 0x2b152b15, 0x1bf82b14,
+	0x21aa2416, 0x00000841, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x2b352416, 0x00002a4f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x23520000, 0x23562356,
+	0x23562376, 0x2b152b15, 0x14fb2356, 0x23b71bf7, 0x000022ef, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2a6f18e5, 0x149923b7,
+	0x23d71499, 0x2b152b15, 0x2ab12b15, 0x004121a9, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x23f60020, 0x19cb2b15, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x2b1510e4, 0x2b352b36, 0x2b152b35, 0x2b352b15, 0x239614da, 0x1c782b56,
+	0x000008a3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x19260000, 0x2b1532b0, 0x2b152b15, 0x2b152b15, 0x2b152b35, 0x19262a6f, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b352373, 0x00001988, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b141926, 0x2b362b35,
+	0x23762356, 0x1bf82356, 0x14ba14da, 0x21ea1c59, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00200000, 0x2a911127, 0x2b152b15, 0x2af52b15, 0x2af42b15, 0x21ec2af3,
+	0x000010c4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x23110000, 0x10c42b35, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x2a4e08a3, 0x23762b35, 0x23562376, 0x1c382335, 0x2b561459, 0x00002b12,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x19890862, 0x2b153313, 0x2b152b15,
+	0x2b352b15, 0x2a902335, 0x08411947, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b15224c, 0x00000882, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08a30000, 0x2b34220c,
+	0x2b152b36, 0x14381c18, 0x2b562b35, 0x00001082, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x19260021,
+	0x33142a2e, 0x2b352b35, 0x2b152b15, 0x22702af4, 0x088219a9, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x19050000,
+	0x00212b35, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x21cb0841, 0x14593334, 0x2b351c59, 0x19472b36, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x19470841, 0x32f32a4e, 0x2b152af4, 0x2b152b15, 0x220d2ad3, 0x08821968, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x3b120020, 0x00000021, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08620000,
+	0x1c791b10, 0x2b152b35, 0x000021ab, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x08620000, 0x1a8d1987, 0x1c991bb3, 0x149a14ba, 0x1bb41c99, 0x19a91aef,
+	0x000010c4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002146,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b1519a9, 0x222d2b15, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21c810c4, 0x1af02ace, 0x2b941bb4, 0x222d226f,
+	0x198819ca, 0x084110e4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x2b3521a9, 0x000011cc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x120d19eb, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00001905, 0x00000000, 0x00000000, 0x00000000, 0x2ace2166, 0x1a2d1331, 0x224c1a2d, 0x19481189,
+	0x19461968, 0x10a308a4, 0x002010c3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x08a30000, 0x1b721a2b, 0x14ba1c78, 0x14991499, 0x1cba1499, 0x1cba1c99, 0x14581458, 0x1c161c57,
+	0x1b921393, 0x0a6d2372, 0x1a4c1a4c, 0x116709a8, 0x08e41967, 0x08610882, 0x00000841, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000,
+	0x00410041, 0x08830062, 0x08c408a3, 0x090508e5, 0x09270906, 0x11680947, 0x09271168, 0x086208e5,
+	0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00410000, 0x1a4c1146, 0x23b61af1,
+	0x23d723d7, 0x1bf723f7, 0x1bf81bf8, 0x1c181bf8, 0x1c381c18, 0x1bf81418, 0x1c381438, 0x1c581c38,
+	0x1c181c59, 0x1bf61c17, 0x23d51bd5, 0x12d02393, 0x22ae1a8e, 0x19ca09eb, 0x10e521a8, 0x18e410c4,
+	0x00210841, 0x00000041, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00210000, 0x190510c3, 0x11681947, 0x19ea19a9,
+	0x1a4d1a0c, 0x22d0228f, 0x1af21ad1, 0x23341b33, 0x23752354, 0x1b752375, 0x23f923d7, 0x1c5923f8,
+	0x1c7914ba, 0x23d72418, 0x2b762b96, 0x23542b96, 0x11cb1ab0, 0x000008a3, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x19050841, 0x224e19a9, 0x23962b13, 0x23962396, 0x2b352b35,
+	0x23972b35, 0x1bb72396, 0x2b352355, 0x2b562b35, 0x23962396, 0x2b352396, 0x2b352b35, 0x23762376,
+	0x1c992376, 0x2b3523b7, 0x23762b35, 0x23552376, 0x33342b34, 0x22f213f5, 0x1a2e2af1, 0x2a0c1a2d,
+	0x19681989, 0x10e52188, 0x10a310a3, 0x10821082, 0x08621082, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x11a90041, 0x239722f2, 0x2b972bb7, 0x2b962b97, 0x241823b7, 0x14991c59, 0x1c381c79, 0x2b7623d7,
+	0x23962b55, 0x118922f2, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x192610a2, 0x2a4e19ca, 0x333532f2, 0x23762376, 0x23351b96, 0x2b152b15, 0x23762b56,
+	0x23762376, 0x2b152b35, 0x23562b15, 0x23762376, 0x23b71499, 0x2b152b15, 0x23962396, 0x2b362376,
+	0x14ba2b15, 0x2b762396, 0x23962376, 0x2b352b15, 0x2b562b35, 0x23762376, 0x2b152b56, 0x33553315,
+	0x23132b96, 0x2ad22313, 0x32d12ad2, 0x32f132f1, 0x1a0d120d, 0x21eb19cb, 0x19a929eb, 0x11270907,
+	0x19261926, 0x086210c4, 0x08820882, 0x00000841, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00410000, 0x237611ec, 0x23b723b8, 0x235523b7, 0x1a6f22d2, 0x1a0d1a2d,
+	0x226f1a2d, 0x2b5522d1, 0x1c3823d7, 0x14991c79, 0x23f71c58, 0x235423b6, 0x00001189, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x11050862,
+	0x222d1968, 0x2ad32a90, 0x2b352b14, 0x2b552b55, 0x2b152b55, 0x2b152b15, 0x2b552b35, 0x14792b55,
+	0x2b152397, 0x2b552b15, 0x2b562b56, 0x2b152b35, 0x237614ba, 0x2b552b55, 0x2b142356, 0x2b152b15,
+	0x23562b56, 0x2b352376, 0x2b152b15, 0x23762315, 0x23562356, 0x2b152b35, 0x2b352b15, 0x23562b56,
+	0x2b152b56, 0x2b152b15, 0x23562b55, 0x23562376, 0x2b152b35, 0x2b552b15, 0x2b342b75, 0x32d22ad2,
+	0x2a4f32d1, 0x224d222d, 0x11482a2c, 0x21681968, 0x10c408a4, 0x004110a3, 0x00000021, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11680000, 0x23d82375, 0x1ab023b7,
+	0x08831189, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08c40020, 0x22b119aa, 0x23962b55,
+	0x1c5823f7, 0x149a1499, 0x08c41b74, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08820020, 0x196810e5, 0x2a6f21eb,
+	0x2b553313, 0x2b352356, 0x2b352b35, 0x23d71c79, 0x23552356, 0x2b352b35, 0x2b352b35, 0x14da2355,
+	0x2b352376, 0x2b352b35, 0x2b352b15, 0x2b352b35, 0x2b352b35, 0x2b152b35, 0x2b152315, 0x2b352b35,
+	0x2b152b35, 0x2b152b15, 0x2b352b15, 0x2b352b35, 0x2b152b15, 0x2b762b35, 0x24182b97, 0x149a1c79,
+	0x1c181c79, 0x2b7623d7, 0x2b552b76, 0x2b152b35, 0x2b352b15, 0x2b352b35, 0x2b152b14, 0x2b352b15,
+	0x2b552b35, 0x33132b14, 0x2a902ab1, 0x19cc32b0, 0x11282a0c, 0x10c41968, 0x002110a3, 0x00000020,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1a900041, 0x237623d8, 0x006211cb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x08a30000, 0x2b341a0c, 0x2b352b55, 0x23b62b55, 0x11ca2396, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10c40841, 0x19891126, 0x2392220c, 0x23752b74,
+	0x2b152b96, 0x2b152b15, 0x23962376, 0x23961d1b, 0x2b152b15, 0x2b752b15, 0x23962396, 0x2b152b56,
+	0x2b562b15, 0x23962397, 0x2b352b76, 0x2b152b15, 0x23962376, 0x2b562b76, 0x2b152b15, 0x23972b35,
+	0x23b723b7, 0x2b9723b7, 0x2b962b97, 0x2bb72b96, 0x1c5823f7, 0x14991499, 0x23f71c38, 0x2b552b96,
+	0x2b352b35, 0x2b352b15, 0x2b352b36, 0x2b352b35, 0x2b352b15, 0x2b152b35, 0x2b152b15, 0x2b152b15,
+	0x2b152b15, 0x2b152b15, 0x3b342b14, 0x32b02ab1, 0x19cb21ec, 0x10e51989, 0x086210c4, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1b340083, 0x11eb23b7, 0x00000021, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x222d0862,
+	0x2b352b34, 0x2b342b34, 0x1a6e2b55, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x08a30021, 0x19681906, 0x2a8f21cb, 0x1c572af1, 0x2b142b55,
+	0x2b152b15, 0x23762b55, 0x149923d7, 0x23b71479, 0x23762b35, 0x2b552376, 0x2b152b15, 0x2b562b15,
+	0x2b762b56, 0x2b352b35, 0x23d82b77, 0x23b723b8, 0x22f22376, 0x11cb1a2e, 0x11681169, 0x118a1168,
+	0x226f19ec, 0x23b62b13, 0x1c791c18, 0x1c591499, 0x239623f7, 0x2b562b76, 0x2b352b56, 0x2b152b15,
+	0x2b562b35, 0x2b552b55, 0x2b152b15, 0x2b552b15, 0x2b552b56, 0x2b152b35, 0x2b152b15, 0x2b552b56,
+	0x2b152b55, 0x2b152b14, 0x2af33335, 0x2a4e2ab0, 0x194721aa, 0x088210c4, 0x00000020, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x237608a3, 0x08831af2,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x11060000, 0x2b342af2, 0x2b342b34, 0x1a902b55, 0x00000020,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x08410020, 0x190610c4, 0x21eb21a9, 0x23d4224e, 0x1b9623d6, 0x1bb714ba,
+	0x23962397, 0x23562376, 0x23352355, 0x2b762b76, 0x2b762b56, 0x23d823d8, 0x1a2e2376, 0x00210906,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x19aa08a3, 0x2b5522d1, 0x23d72b76,
+	0x14791c38, 0x2b761c59, 0x2b152b15, 0x2b352b15, 0x2b352b35, 0x2b152b35, 0x1bf82b15, 0x23d71c59,
+	0x2b352b35, 0x2af52b14, 0x2b352b15, 0x2b352b35, 0x2af42b15, 0x2b152b15, 0x2b352b35, 0x2b152b35,
+	0x2b152b15, 0x32f23314, 0x21cb2a90, 0x10e41968, 0x00000841, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1b750062, 0x0000120c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00620000,
+	0x2b342290, 0x2b142b34, 0x1a902b35, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x10c40041, 0x11c91146, 0x12ef1a8d, 0x24561bb3, 0x14da24b9, 0x1c3914ba,
+	0x235423d8, 0x00211189, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x226f08e5, 0x2b352b35, 0x2b552b35, 0x2b152b75, 0x2b152b15, 0x2b352b15,
+	0x2b152b15, 0x1bf82af4, 0x1bf7149a, 0x1bf814ba, 0x23352356, 0x23352335, 0x2b352b56, 0x2b152b35,
+	0x2b152b14, 0x2b352b15, 0x2b352b35, 0x2af52b15, 0x2b152af5, 0x2b152b15, 0x2af52b15, 0x2af32af5,
+	0x220d2ab1, 0x10c42189, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1b130021, 0x00001189, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00210000, 0x2b14224e, 0x2b142b14, 0x120d2b55, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00410000, 0x239610e5, 0x11aa23b7, 0x00000020, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10e60000, 0x2b3522d1,
+	0x2b342b34, 0x2b552b34, 0x2b352b76, 0x2b152b15, 0x2b552b35, 0x23f81cba, 0x14382b15, 0x14da14ba,
+	0x14da14da, 0x0cda14fa, 0x0cba14ba, 0x14da0cda, 0x0cba14da, 0x0cba0cba, 0x14ba0cba, 0x14991499,
+	0x14791499, 0x14791479, 0x14591479, 0x14591459, 0x14591438, 0x1c171c38, 0x1a8d1bb3, 0x08621146,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x122d0000,
+	0x00001168, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00210000,
+	0x2b14226f, 0x2b142b14, 0x09471c18, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x23550062, 0x00831af2, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00210000, 0x2b3419ec, 0x2b342b34, 0x2b352b34, 0x2b152b35, 0x2b152b14,
+	0x1c382b35, 0x143814ba, 0x1bb714ba, 0x2b552b35, 0x2b762376, 0x2b352b36, 0x23762356, 0x23962376,
+	0x23762376, 0x23972376, 0x23b723b7, 0x239623b7, 0x1bb723b7, 0x23d71bd7, 0x1bf71bf8, 0x1bd71bd7,
+	0x1c181bf7, 0x1c381c18, 0x1bf71c18, 0x2b1223d6, 0x10c421ca, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x08e50000, 0x00001189, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00410000, 0x2b142ab1, 0x14792b14, 0x00622355, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1b540041, 0x0000122d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b141148,
+	0x2b142b34, 0x2b152b14, 0x2b142b15, 0x2b352b15, 0x1bf72b35, 0x23961c18, 0x2b152b14, 0x2b352b15,
+	0x2b152b35, 0x2b152b15, 0x2b142b35, 0x2b152b35, 0x2b152b15, 0x2b352b15, 0x2b352b15, 0x2b152af5,
+	0x2b152af5, 0x2b352b35, 0x2af52b15, 0x2af52af5, 0x2b152b15, 0x2b152b35, 0x2af52af4, 0x2b352b15,
+	0x32f32b35, 0x10e521ec, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001189, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08a40000,
+	0x23752af3, 0x2b341c38, 0x00001a6f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1ab00000, 0x000011aa, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x2b131106, 0x2b142b14, 0x2b552b14, 0x2b352b55, 0x2b152b15,
+	0x2b352b15, 0x2b352b35, 0x2b142b35, 0x2b152b15, 0x23352b35, 0x2b152b15, 0x2b152b14, 0x2b352b15,
+	0x2b152b35, 0x2b152b15, 0x2b152b15, 0x2b152b15, 0x2b152b15, 0x2b152b15, 0x2af52b15, 0x2b152b15,
+	0x2b152b15, 0x2af42b15, 0x2b152af5, 0x2b152b15, 0x2af52b15, 0x32d32af4, 0x10c421ec, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x002008c3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x19890000, 0x23d623d6, 0x23762b13, 0x000008c4, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11aa0000, 0x000011aa,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b141106,
+	0x2b142b14, 0x23f823f7, 0x19aa21eb, 0x2a6f21ec, 0x2b343333, 0x2b352b55, 0x2af42af4, 0x2b552b15,
+	0x2b352b55, 0x2af42b15, 0x2b352b15, 0x2b562b55, 0x2b152b35, 0x2b152b15, 0x2b352b35, 0x2b152b35,
+	0x2af52b15, 0x2b552b15, 0x2b352b35, 0x2b152b15, 0x2b352b15, 0x2b352b35, 0x2b152b35, 0x2b142b14,
+	0x2b352b35, 0x2b152b35, 0x2ab12af4, 0x00411968, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13d50020,
+	0x2b132b55, 0x1a902b14, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00820000, 0x000011cb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x2b141989, 0x1c792b14, 0x1af22376, 0x00000000, 0x00000000,
+	0x08a30841, 0x21a91106, 0x2a6f21ec, 0x33342ad2, 0x2af52b35, 0x2af42af4, 0x2b352b15, 0x2b352b35,
+	0x2b142b15, 0x2b352b15, 0x2b352b35, 0x2b152b15, 0x2b152b15, 0x2b352b35, 0x2b152b35, 0x2b152af5,
+	0x2b142b15, 0x2b152b35, 0x2af42af4, 0x2b152af4, 0x2b352b15, 0x2af42b15, 0x2b152af5, 0x21eb2af3,
+	0x00000861, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x2b1409c9, 0x2af32b13, 0x08822376, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001168, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b14224e,
+	0x2b141479, 0x116823b7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10c30020,
+	0x21aa1947, 0x2ab1220d, 0x2b152af3, 0x23352b15, 0x2b152b15, 0x2b152b15, 0x2b152b15, 0x2af42af5,
+	0x2b152af4, 0x2b152b15, 0x2af52af4, 0x2b152af5, 0x2b152b14, 0x2af42b15, 0x2af42af4, 0x2b142b15,
+	0x2b152b15, 0x2af52af4, 0x2b152b15, 0x33142b15, 0x086221ec, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b132ab1,
+	0x2b342af3, 0x000011ec, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x08620041, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x08620000, 0x1c382334, 0x2b342b14, 0x00001b76, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00210000, 0x194608a3, 0x23511a6c,
+	0x2af42b53, 0x2b142b14, 0x2b552b35, 0x2b352b35, 0x2b142b15, 0x2b352b15, 0x23d72b35, 0x14381458,
+	0x2b152376, 0x2b152b15, 0x2b142b15, 0x2b152b14, 0x2b152b15, 0x2b152b15, 0x2af42b15, 0x2b152b15,
+	0x218932f3, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x198a0000, 0x2af32af3, 0x1b132af3, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x122c0000, 0x2b1323d6,
+	0x23b72af3, 0x00001168, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10e50861, 0x222e1969, 0x23d62b33, 0x1bb723b7,
+	0x1b962396, 0x1bf823b6, 0x23b714da, 0x14991bf7, 0x2b352b15, 0x2b352b35, 0x2af42af4, 0x2b152af4,
+	0x2b352b35, 0x23352b35, 0x23352335, 0x2b552b56, 0x2ab12b55, 0x000010e4, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af30883, 0x2af32af3,
+	0x08822376, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x23130041, 0x2af32b13, 0x1b332b34, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x11670862, 0x13931aad, 0x14791c58, 0x14791499, 0x23552af4, 0x2b550cba,
+	0x2b142b15, 0x2af42b14, 0x2af42af4, 0x2b152b15, 0x14992b56, 0x0c990cba, 0x14ba0cba, 0x14ba14ba,
+	0x14990c99, 0x00201a8d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x2af32ab1, 0x2b352af3, 0x00001168, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af319aa, 0x2af32af3,
+	0x08a323d8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08620000,
+	0x222d1106, 0x1c381c36, 0x14381479, 0x2b142af4, 0x2b142b14, 0x2af42af4, 0x2b142af4, 0x149a2355,
+	0x2b151c18, 0x2b152b14, 0x2b352b35, 0x2b352b35, 0x2b352b15, 0x08622a6f, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21ec0000, 0x2af32af3, 0x122d2b14,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x08830000, 0x2af32af3, 0x23762af3, 0x000011eb, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x228d1125, 0x2b143334, 0x2af42af4,
+	0x2b152af4, 0x2b352b35, 0x14992376, 0x2b151bf8, 0x2b152b35, 0x2b152b15, 0x2af42af4, 0x2b152b14,
+	0x2b152b14, 0x10a32ab1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x2af31969, 0x2af32af3, 0x00001ab0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2a700000, 0x2af32af3, 0x1af22b34,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00200000, 0x2a901947, 0x2af42af4, 0x2b142b14, 0x14992396, 0x2b151bb7, 0x2b142b15,
+	0x2b152b14, 0x2af42af5, 0x2b142af4, 0x2b142b14, 0x2af42b14, 0x19052ad3, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11060000, 0x2af32af3, 0x23132af3, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x2af319aa, 0x2af32af3, 0x002023b7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x19270000, 0x2af42ab1,
+	0x14992396, 0x2af423b6, 0x2af42af4, 0x2b142b14, 0x2af42b14, 0x2af42af4, 0x2b142af4, 0x2af42b14,
+	0x2af42af4, 0x18e532f3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x2af308c4, 0x2af32af3, 0x00002334, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10e60000, 0x2af32af3, 0x23b82af3, 0x00000883,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x08410000, 0x0c7922af, 0x2b142376, 0x2b152b14, 0x2af42b15, 0x2b142af4,
+	0x2b142b15, 0x2af42b14, 0x2af42af4, 0x2b142b14, 0x2af42b14, 0x08622ad2, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x08a30000, 0x2af32af3, 0x23542af3, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x2af30862, 0x2af32af3, 0x09062397, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00410000, 0x2af42b12,
+	0x2b142b14, 0x2b152b15, 0x2af42af4, 0x2b152af4, 0x2b352b14, 0x2b142b34, 0x2b152b14, 0x2b352b35,
+	0x2af42b14, 0x00212a90, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af308a4,
+	0x2af32af3, 0x00002354, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00210000, 0x2af32ad2, 0x23762af3, 0x00000968, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x19890000, 0x2b142af4, 0x2b152b14, 0x2af42af4, 0x2af42af4, 0x1bd72b15,
+	0x0c991499, 0x0c990c99, 0x14ba0c99, 0x14991499, 0x0c790c79, 0x000022ef, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x08c50000, 0x2af32af3, 0x23132af3, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2ad20000,
+	0x2af32af3, 0x11aa2376, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2b141968, 0x2af42af4,
+	0x2b142af4, 0x2af42b14, 0x1bf72b14, 0x23351438, 0x23352334, 0x23552334, 0x23552355, 0x23552355,
+	0x23552355, 0x00001926, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af31127, 0x2af32af3,
+	0x00001ad1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x2af32ab1, 0x23762af3, 0x000011aa, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x32b00020, 0x2af42b14, 0x2af42af4, 0x33142b14, 0x1c382b34, 0x2b141438, 0x2b142af4,
+	0x2b142b14, 0x2af42af4, 0x2af42af4, 0x33142b14, 0x32d12b14, 0x00000841, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x198a0000, 0x2af32af3, 0x124e2af3, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2ab20000, 0x2af32af3,
+	0x11892376, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2a0c0000, 0x2b142b14, 0x2af42af4, 0x2af42af4,
+	0x14382b34, 0x2b141c18, 0x2af42af4, 0x2b142b14, 0x2af42b14, 0x2af42af4, 0x2af42af4, 0x2b142b14,
+	0x21a92af3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af3222d, 0x2b342af3, 0x000011aa,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00200000, 0x2af32ad2, 0x23762af3, 0x00000947, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x220c0021,
+	0x2af42af4, 0x2af42af4, 0x2af42af4, 0x14582b35, 0x2b141bf7, 0x2af42af4, 0x2af42af4, 0x2af42af4,
+	0x2af42af4, 0x2af42af4, 0x2af42af4, 0x2af32af4, 0x086132f3, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x2ad20020, 0x2af32af3, 0x08c42376, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af30862, 0x2af32af3, 0x08c42397,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x32d11926, 0x2af32b14, 0x2af42af4, 0x2b142b14, 0x14792b55, 0x2af41bb6,
+	0x2b142af4, 0x2b142b14, 0x2af32af4, 0x2b142af3, 0x2b552b14, 0x237523b6, 0x2af42af4, 0x2b142af4,
+	0x000021a9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x10c50000, 0x2af32af3, 0x23542af3, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x10c50000, 0x2af32af3, 0x23b72af3, 0x00000041, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08830000, 0x2b142a4e, 0x2b142b14, 0x2af32af3,
+	0x2b142af3, 0x14792b75, 0x2af323b6, 0x2af42af4, 0x2b142b14, 0x2af42b14, 0x2af32af3, 0x2b552af4,
+	0x1c181499, 0x1bb60c58, 0x2af42af4, 0x32b02af4, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af319ec,
+	0x2af32af3, 0x0000124e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af31969, 0x2af32af3, 0x00001b54, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x220c10e4,
+	0x2af42af3, 0x2af32af4, 0x2af32af4, 0x2af32af3, 0x14792375, 0x2af423b6, 0x2af32af3, 0x2af42af4,
+	0x2af42af4, 0x2af32af4, 0x2af42af3, 0x14381bf7, 0x23552af4, 0x14180c79, 0x1c171417, 0x000021c9,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x2ad20041, 0x2af32af3, 0x08e52376, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x222e0000,
+	0x2af32af3, 0x124e2b34, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x19ea0882, 0x2b752af1, 0x2b752b75, 0x2b342b34, 0x2b142b14, 0x2b342b34, 0x147923b6,
+	0x2af42375, 0x2b142b14, 0x2b142b14, 0x2af42af4, 0x2b142af4, 0x2af42b14, 0x1bb62af4, 0x23550c79,
+	0x14581bd6, 0x23742396, 0x000011a8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x198a0000, 0x2af32af3, 0x1af22af3,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00410000, 0x2af32ad3, 0x23762af3, 0x00000927, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x19880841, 0x14372331, 0x14581458, 0x14781478, 0x14791499,
+	0x0c580c78, 0x14790c79, 0x14791479, 0x2af42355, 0x2b142af4, 0x2b142b14, 0x2af42b14, 0x2af32af3,
+	0x33142b14, 0x2af42b14, 0x1bd72af4, 0x1c381458, 0x2a2d2b54, 0x00000882, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x08620000, 0x2af32ad2, 0x23552af3, 0x00000947, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af31148, 0x2af32af3,
+	0x00202376, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11060041, 0x2af32a4d, 0x2b142b14,
+	0x2af42af4, 0x2b132af3, 0x2b142b13, 0x2af42af4, 0x2b142af3, 0x2b142b14, 0x2af32b14, 0x2af42af3,
+	0x2af32af4, 0x2af42af3, 0x2af32af4, 0x2af42af3, 0x2af32af3, 0x2af42af3, 0x2af32af3, 0x19052a6e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af3220d, 0x2af32af3, 0x00001af2, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x2a700000, 0x2af32af3, 0x122d2b35, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x218810a3,
+	0x33132a6f, 0x2b143334, 0x2af32af4, 0x2b342b14, 0x2b142b34, 0x2af32af3, 0x2b142af4, 0x2b132b14,
+	0x2af32b14, 0x2af32af3, 0x2b142b14, 0x2af42b14, 0x2af32af3, 0x2af42af4, 0x2af42af4, 0x2af32af3,
+	0x2af32af3, 0x2a2d32f3, 0x000010e4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af31127,
+	0x2af32af3, 0x08c42376, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11060000, 0x2af32af3, 0x23972af3, 0x00000062,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08610061,
+	0x08620000, 0x220c1926, 0x2af332b1, 0x2b142af3, 0x2b142b14, 0x2af32b14, 0x2b142af3, 0x2b342b14,
+	0x2af32b14, 0x2af32af3, 0x2b142b14, 0x2b142b13, 0x2af32af3, 0x2b142af3, 0x2b142b14, 0x2af32af4,
+	0x2af42af3, 0x2b142b14, 0x2af32b14, 0x32b02af3, 0x08622189, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x2ad208a3, 0x2af32af3, 0x120c2b35, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000,
+	0x2af32a90, 0x2b342af3, 0x0000124e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x196710a3, 0x32b02a0c, 0x2b143313, 0x2af32af3, 0x2af32af3, 0x2b142b14,
+	0x2af32b13, 0x2af32af3, 0x2b142af3, 0x2b132b14, 0x2af32af3, 0x2af32af3, 0x2af32b13, 0x2ad32af3,
+	0x2af32af3, 0x2b142b13, 0x2af42b14, 0x2af32af3, 0x2b142af4, 0x2ab02b13, 0x10a321ca, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2ab10862, 0x2af32af3, 0x1ad22b14,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x2af319aa, 0x2af32af3, 0x00622376, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x19260862, 0x2a2d21a9, 0x333432d1, 0x2b142b14, 0x2af32b14,
+	0x2b132af3, 0x2b142b14, 0x2af32b13, 0x2af32af3, 0x2b132b13, 0x2af32b13, 0x2af32af3, 0x2af32af3,
+	0x2af32af3, 0x2af32af3, 0x2af32af3, 0x2af32af3, 0x2af32af3, 0x2af42af3, 0x2ad32af3, 0x329032f3,
+	0x10a31989, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x2ab10883, 0x2af32af3, 0x1b342b14, 0x00000042, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2af308c5, 0x2af32af3,
+	0x11892355, 0x00000000, 0x00000000, 0x08820041, 0x196810e4, 0x328f21eb, 0x33342af2, 0x2af32b13,
+	0x2af32af2, 0x33343334, 0x2af43334, 0x2af32af3, 0x2b342b13, 0x33142b34, 0x2af32af3, 0x2b142af3,
+	0x33142b34, 0x2af32b14, 0x2af32af3, 0x2b133313, 0x2af32b34, 0x2af32af3, 0x33132af3, 0x33143313,
+	0x2af32ad3, 0x2a0c2a90, 0x08611947, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x2af30988, 0x2af32b13, 0x23342b14, 0x00000083, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x2ab10862, 0x2af32af3, 0x2b542b14, 0x19681947, 0x231021eb, 0x23b52393, 0x1b9523d6,
+	0x1b952395, 0x23b623b6, 0x239523b5, 0x23542375, 0x23952375, 0x23752375, 0x23342355, 0x2b542334,
+	0x2b542b54, 0x2b142b34, 0x2af32b14, 0x2b342b34, 0x2b132b34, 0x2af32af3, 0x2b132af3, 0x2b142b13,
+	0x2af32af3, 0x2af32af3, 0x32b032f2, 0x194721ec, 0x00000882, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x147919cb, 0x2b132b14,
+	0x1b342b14, 0x00000083, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2a900042, 0x2af32af3, 0x32f32af3, 0x2b132af3,
+	0x2b332b33, 0x23952395, 0x23b52395, 0x1bd623b5, 0x1bd61bd6, 0x1bd61bd6, 0x1bf61bd6, 0x1bf61bd6,
+	0x1bf71bf7, 0x14171c17, 0x14171417, 0x14171417, 0x14371438, 0x14381438, 0x14381437, 0x14581458,
+	0x0c381458, 0x0c380c38, 0x14371437, 0x1b931437, 0x19ea1af0, 0x086210e5, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08a30000, 0x000010e5, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x11060000, 0x2b542ab1, 0x2b141c58, 0x1ad12b55, 0x00000041, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2a910883,
+	0x2af32af3, 0x2af32af3, 0x2af32af3, 0x33343333, 0x2b133334, 0x2af32af3, 0x33332af3, 0x33332b33,
+	0x2af32af3, 0x2b132af3, 0x33133333, 0x2af33313, 0x2af32af3, 0x33332b34, 0x2b133334, 0x2af32af3,
+	0x2b342af3, 0x2b133334, 0x2af32af3, 0x32f22af3, 0x2a6e32d1, 0x196821eb, 0x004110e4, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x08620000, 0x114819eb, 0x00000021, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00210000, 0x22901127, 0x2b142b14, 0x1bf723b6, 0x11cb2376, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x23540967, 0x2af32b13, 0x2af22b14, 0x2a902a6e, 0x2af232d1, 0x33133313,
+	0x2af22af3, 0x2af22af3, 0x2b133312, 0x2af32b13, 0x2ad22af3, 0x2b132af2, 0x33133312, 0x2af32af3,
+	0x2b132af3, 0x2b132b13, 0x2ad22af2, 0x2ab032d2, 0x2a2d2a8f, 0x196821ea, 0x10c31105, 0x00000841,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x22b01127, 0x1168224e,
+	0x00000883, 0x00000000, 0x00000000, 0x00000000, 0x08830000, 0x222d1147, 0x2b142af3, 0x2b142b14,
+	0x23d72b14, 0x08a31ad1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00210000, 0x1c3819cb, 0x2b132b55, 0x1af22b14,
+	0x00000062, 0x08410000, 0x10c40862, 0x216710c4, 0x19682188, 0x19681968, 0x19891989, 0x19aa1989,
+	0x21ca19aa, 0x322c21eb, 0x21891989, 0x112721a9, 0x10c52167, 0x086210e4, 0x00200841, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x11060000, 0x2b34226e, 0x2af22b34, 0x226f2290, 0x226f224e, 0x2b132ad1,
+	0x2b342b34, 0x2b342b34, 0x2b552b34, 0x1ab02376, 0x000008e5, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x08a41126, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11470020,
+	0x2b142ad2, 0x2b141499, 0x1a4e2b35, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x192510c3, 0x11681947, 0x11aa11a9, 0x120c11cb, 0x1a4e1a2d, 0x1a8f1a6f,
+	0x1ab01a90, 0x1ab11ab0, 0x1ad11ad1, 0x1af21ad1, 0x1b131b12, 0x1b331b13, 0x1b541b34, 0x23d82396,
+	0x2b9623b7, 0x2b552b76, 0x2b552b55, 0x2b552b35, 0x23762b55, 0x1af22376, 0x088211cb, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1a2d1126, 0x00201106, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x08620000, 0x2ab11989, 0x2b142b14, 0x1c792b54, 0x09062313, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x08410020, 0x00620861, 0x08830062, 0x08e508c4, 0x09261106, 0x11680947, 0x11aa0969, 0x11cb11ca,
+	0x120c11eb, 0x122d120d, 0x126e124e, 0x1a8f1a6f, 0x1ab01a90, 0x1ab01ab0, 0x1a8f1ab0, 0x11ca122d,
+	0x00410906, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x19aa0041, 0x224e2af2, 0x08e51189,
+	0x00000862, 0x00000000, 0x00200000, 0x11060882, 0x229019aa, 0x2b342b14, 0x2b142b14, 0x23342b34,
+	0x002011ca, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200020,
+	0x00210020, 0x08820841, 0x2ab01989, 0x2b552b55, 0x2b132b34, 0x2b132b13, 0x2b352b34, 0x2b342b34,
+	0x2b342b34, 0x2b352b34, 0x11681a90, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x10a30841, 0x19261905, 0x19681147, 0x11aa1989, 0x1a0b19ca, 0x1a2d1a2c, 0x1a8f1a4e,
+	0x1ad11ab0, 0x23121af2, 0x23542333, 0x1b551b54, 0x1b761b75, 0x1b961b96, 0x23b71bb7, 0x239623b7,
+	0x2b552b75, 0x2b552b55, 0x2b342b34, 0x22b02313, 0x11471a0c, 0x00000041, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00200000, 0x00200020, 0x00410021, 0x00410841, 0x08620041, 0x08610862, 0x00000041, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00610000, 0x08e200a1, 0x09220902, 0x09420922, 0x09220942, 0x09220922, 0x09220922, 0x09020922,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08e20081, 0x004008c1,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08e20000,
+	0x00000081, 0x00000000, 0x00000000, 0x00000000, 0x08c10061, 0x09020902, 0x09220922, 0x09220922,
+	0x09220922, 0x09220922, 0x000008a1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00400000, 0x1b861284, 0x1b461b86, 0x092212c5, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00610000, 0x1bc61244, 0x1c871c67, 0x1ca71ca7, 0x1c871c87, 0x1ca71ca7,
+	0x1c871ca7, 0x1c871c87, 0x1c871c87, 0x09831c87, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1c871224, 0x1ca71ca7, 0x00401c07, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x12640000, 0x1c671c87, 0x00000861, 0x00000000, 0x11e30020, 0x1c671bc6,
+	0x1ca71ca7, 0x1c871ca7, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x000012c5, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71b45, 0x1ca71ca7, 0x1ca71ca7,
+	0x08a11c67, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09830000, 0x1ca71c47, 0x1ca71ca7,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1c871ca7, 0x000008e2,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1bc60000, 0x1ca71ca7, 0x1c471ca7, 0x00000020,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71c07, 0x00201c67,
+	0x00000000, 0x1b460020, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7,
+	0x1ca71ca7, 0x12a51ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1ca709a3, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x000011e3, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x11e30000, 0x1ca71c87, 0x1ca71ca7, 0x1be61ca7, 0x09831264, 0x11830962, 0x09831183, 0x09830983,
+	0x11831183, 0x11831183, 0x000008e2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000,
+	0x1ca71c87, 0x1ca71ca7, 0x00001b86, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1c870861, 0x1bc61ca7, 0x00000000, 0x12840000, 0x1ca71ca7, 0x1ca71ca7, 0x12641c27,
+	0x09621183, 0x11631163, 0x11631163, 0x11631163, 0x09421163, 0x00000020, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1c070040, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x12c51ca7,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x08e20000, 0x1ca71c87, 0x1ca71ca7, 0x12441c87, 0x00000020,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca70902, 0x1ca71ca7, 0x12841ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09220000, 0x1ca71ca7, 0x000012c5, 0x00610000,
+	0x1ca71c67, 0x1ca71ca7, 0x00611ba6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12440000, 0x1ca71ca7,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x00001b86, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71b66,
+	0x1ca71ca7, 0x12241ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11e30000, 0x1ca71ca7,
+	0x1ca71ca7, 0x000009a3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1ca71224, 0x11e31ca7, 0x00000000, 0x1ca71204, 0x1ca71ca7, 0x00a11c67, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00610000, 0x1ca71c67, 0x1c671ca7, 0x1ca71c67, 0x1ca71ca7, 0x1c471ca7, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1c870881, 0x1ca71ca7, 0x1b861ca7, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1ca712c5, 0x1ca71ca7, 0x08c11c87, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x13050000, 0x1ca71ca7, 0x00000902, 0x1b660000, 0x1ca71ca7,
+	0x13051ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca712c5, 0x1bc61ca7, 0x09830081,
+	0x1ca71ca7, 0x1ca71ca7, 0x08811c87, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11c30000, 0x1ca71ca7, 0x1ca71ca7,
+	0x00000983, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x08c20020, 0x08c208c2, 0x08c208c2, 0x08c208c2, 0x006108c2,
+	0x00000000, 0x00000000, 0x00000000, 0x09220881, 0x11a30983, 0x11a311a3, 0x09a311a3, 0x08c10962,
+	0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08a10000, 0x09830942, 0x09a30983,
+	0x09a309a3, 0x09830983, 0x002008e2, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x08c208c2,
+	0x08c208c2, 0x08c208c2, 0x08c208c2, 0x08c208c2, 0x088108c2, 0x00000020, 0x00000000, 0x00000000,
+	0x00000000, 0x08c20040, 0x08c208c2, 0x08c208c2, 0x08c208c2, 0x08c208c2, 0x08c208c2, 0x08e208c2,
+	0x00000061, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x08a10040, 0x08c208c2,
+	0x088108a1, 0x00400040, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200020, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x096208e2, 0x11a30983,
+	0x11a311a3, 0x098309a3, 0x00400922, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08c20881,
+	0x08c208c2, 0x08c208c2, 0x08c208c2, 0x002008c2, 0x00000000, 0x1bc60000, 0x1ca71ca7, 0x1c471ca7,
+	0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71be7,
+	0x00411c67, 0x00200000, 0x1ca71c47, 0x1ca71ca7, 0x00001224, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1c8708c1, 0x1c071ca7, 0x00000061, 0x1be70020, 0x1ca71ca7, 0x1ca71ca7, 0x00000922, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1ca712c5, 0x1ca71ca7, 0x00611c87, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1c0708a1, 0x1c871ca7,
+	0x1c871c87, 0x1c871c87, 0x1c871c87, 0x00001b46, 0x00000000, 0x09830000, 0x1c871bc6, 0x1ca71ca7,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1c071c87, 0x00001203, 0x00000000, 0x00000000, 0x00000000,
+	0x1bc609a3, 0x1ca71c87, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x09c31c07, 0x00000000,
+	0x00000000, 0x09830000, 0x1c871c67, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x1c871c87,
+	0x1c271c87, 0x006112c5, 0x00000000, 0x00000000, 0x1c2700a1, 0x1c871c87, 0x1c871c87, 0x1c871c87,
+	0x1c871c87, 0x1ca71c87, 0x1c871ca7, 0x1c871c87, 0x000012e5, 0x00000000, 0x00000000, 0x00600000,
+	0x1b661224, 0x1c871c27, 0x1ca71ca7, 0x1ca71ca7, 0x1c871ca7, 0x1c671c87, 0x11e31ba6, 0x00000000,
+	0x12030000, 0x1c271be7, 0x00401b25, 0x00000000, 0x00000000, 0x00000000, 0x11e30000, 0x1c271bc6,
+	0x1c071c27, 0x00001244, 0x00000000, 0x00000000, 0x00000000, 0x12840000, 0x00201b66, 0x00000000,
+	0x12e50081, 0x1c871c67, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x13051c67, 0x00000061,
+	0x00000000, 0x00000000, 0x1c871325, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x00001b86,
+	0x00400000, 0x1ca71c67, 0x1ca71ca7, 0x00001b86, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1c870061, 0x1bc61ca7, 0x00000000, 0x1c8708a1, 0x1ca71ca7, 0x12641ca7,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1b250000, 0x1ca71ca7, 0x00000983, 0x00000000, 0x1ca71284,
+	0x1ca71ca7, 0x11e31ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ba60000, 0x1ca71ca7, 0x1be61ca7, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x12c50000, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1c871ca7, 0x12241c47, 0x00000000,
+	0x12840000, 0x1ca71ca7, 0x1ca71ca7, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x1ca71ca7, 0x1ca71ca7,
+	0x000011e3, 0x00000000, 0x00000000, 0x1ca712a4, 0x1ca71ca7, 0x1c871ca7, 0x1c871c87, 0x1c871c87,
+	0x1ca71c87, 0x1ca71ca7, 0x09a31c87, 0x00000000, 0x00000000, 0x1ca71bc7, 0x1ca71ca7, 0x1ca71ca7,
+	0x1c871ca7, 0x1c871c67, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x00601c07, 0x00000000, 0x12640000,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1c871ca7, 0x1c871c87, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7,
+	0x00001203, 0x00000000, 0x08e20000, 0x1ca71c27, 0x1ca71ca7, 0x1ca71ca7, 0x1c871c87, 0x1ca71c87,
+	0x1ca71ca7, 0x1ca71ca7, 0x12441ca7, 0x00000000, 0x1ca71c27, 0x1ca71ca7, 0x00000942, 0x00000000,
+	0x00000000, 0x09420000, 0x1ca71c87, 0x1ca71ca7, 0x1c471ca7, 0x00000000, 0x00000000, 0x00000000,
+	0x11c30000, 0x1be71ca7, 0x00000000, 0x1c2708e1, 0x1ca71ca7, 0x1ca71ca7, 0x1c871c87, 0x1c871c87,
+	0x1ca71c87, 0x1ca71ca7, 0x1ba61ca7, 0x00000000, 0x00000000, 0x1ca70922, 0x1ca71ca7, 0x1ca71ca7,
+	0x1ca71ca7, 0x1c671c87, 0x12a51c27, 0x00000000, 0x1ca70902, 0x1ca71ca7, 0x12a51ca7, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09220000, 0x1ca71ca7, 0x000012e5,
+	0x09020000, 0x1ca71ca7, 0x1ca71ca7, 0x00001ba6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09220000, 0x1ca71c87,
+	0x00001b66, 0x00000000, 0x09420000, 0x1ca71ca7, 0x1ca71ca7, 0x000012a5, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000,
+	0x1ca71c67, 0x1ca71ca7, 0x00001305, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71bc6, 0x1ca71ca7, 0x1ca71ca7,
+	0x09421b86, 0x00200061, 0x00000000, 0x09c30000, 0x1ca71ca7, 0x1b861ca7, 0x08810942, 0x00400060,
+	0x00400040, 0x122408a1, 0x1ca71c87, 0x1c071ca7, 0x00000000, 0x00000000, 0x1ca71203, 0x1ca71ca7,
+	0x09621ba6, 0x00400061, 0x00610040, 0x08a10060, 0x1c871244, 0x1ca71ca7, 0x00001be6, 0x00000000,
+	0x1c870041, 0x1ca71ca7, 0x1ca71ca7, 0x12841c67, 0x004008e2, 0x09420040, 0x1c8712e5, 0x1ca71ca7,
+	0x1ca71ca7, 0x00001244, 0x00000000, 0x1ca71b66, 0x1ca71ca7, 0x1c471ca7, 0x09221264, 0x006108a1,
+	0x092208a1, 0x1c871284, 0x1ca71ca7, 0x1b861ca7, 0x00000000, 0x00400000, 0x1ca71c07, 0x1ca71ca7,
+	0x12241c47, 0x006008e2, 0x08810040, 0x13250942, 0x1ca71ca7, 0x1ca71ca7, 0x00001bc6, 0x1c270000,
+	0x1ca71ca7, 0x09621ca7, 0x00000000, 0x00000000, 0x00000000, 0x1ca71b46, 0x1ca71ca7, 0x1ca71ca7,
+	0x00411c87, 0x00000000, 0x00000000, 0x00000000, 0x1ca71ba6, 0x00001204, 0x1c270061, 0x1ca71ca7,
+	0x12641c87, 0x006108c1, 0x00400040, 0x00610040, 0x1ba60902, 0x1ca71ca7, 0x09621ca7, 0x00000000,
+	0x12240000, 0x1ca71ca7, 0x1ca71ca7, 0x1c471ca7, 0x088111e3, 0x00200040, 0x00000000, 0x11e30000,
+	0x1ca71ca7, 0x1ca71ca7, 0x000009c3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1ca71203, 0x11e31ca7, 0x00000000, 0x1ca71122, 0x1ca71ca7, 0x1ca71ca7, 0x00201264,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1ca71b86, 0x09021c87, 0x00000000, 0x00000000, 0x1c870040, 0x1ca71ca7,
+	0x1b661ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca708e2, 0x1ca71ca7, 0x12041ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1c670020, 0x1ca71ca7, 0x1ca71ca7, 0x00201325, 0x00000000, 0x00000000, 0x00400000, 0x1ca71c27,
+	0x1c071ca7, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x1ba60000, 0x1ca71ca7, 0x08c11c87,
+	0x00000000, 0x1c470081, 0x1ca71ca7, 0x00401bc6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1ca71be7, 0x1c871ca7, 0x00000881, 0x09220000, 0x1ca71ca7, 0x1ca71ca7, 0x08e11c27, 0x00000000,
+	0x00000000, 0x00000000, 0x1c8709a3, 0x1ca71ca7, 0x1b251ca7, 0x00000000, 0x1c270020, 0x1ca71ca7,
+	0x1c471ca7, 0x000008c1, 0x00000000, 0x00000000, 0x00000000, 0x1ca71284, 0x1ca71ca7, 0x00001c27,
+	0x00000000, 0x1ca71224, 0x1ca71ca7, 0x08a11c27, 0x00000000, 0x00000000, 0x00000000, 0x1ba60000,
+	0x1ca71ca7, 0x1bc71ca7, 0x00000000, 0x1ca71c07, 0x1ca71ca7, 0x00000962, 0x00000000, 0x00000000,
+	0x1c8708a1, 0x1ca71ca7, 0x1ca71ca7, 0x1c871ca7, 0x00000881, 0x00000000, 0x00000000, 0x1c8708e2,
+	0x00611c67, 0x12e50000, 0x1ca71ca7, 0x12041ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1ca70942, 0x1ca71ca7, 0x00001284, 0x00000000, 0x1ca71305, 0x1ca71ca7, 0x1c271ca7, 0x000008c1,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca712e5, 0x1ca71ca7, 0x08e21ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12e50000, 0x1ca71ca7, 0x00000902, 0x08e20000,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x13051c07, 0x12a512a5, 0x12a512a5, 0x12a512a5, 0x09831264,
+	0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca70963, 0x1b461ca7, 0x00000000,
+	0x00000000, 0x00000000, 0x1ca71be7, 0x1ca71ca7, 0x00001c07, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11c30000, 0x1ca71ca7,
+	0x1ca71ca7, 0x00000922, 0x00000000, 0x00000000, 0x126408e1, 0x12841284, 0x12841284, 0x12841284,
+	0x12841284, 0x09621284, 0x00000000, 0x08e20000, 0x1ca71ca7, 0x1ca71ca7, 0x00201ba6, 0x00000000,
+	0x00000000, 0x00000000, 0x1ca71224, 0x1ca71ca7, 0x00001224, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1ca71ba6, 0x1ca71ca7, 0x00000962, 0x12440000, 0x1ca71ca7, 0x11e31ca7, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1be70000, 0x1ca71ca7, 0x09221ca7, 0x00000000, 0x1ca71203,
+	0x1ca71ca7, 0x09421c87, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71bc6, 0x1ca71ca7,
+	0x00001b25, 0x08a10000, 0x1ca71c87, 0x1ca71ca7, 0x000011c3, 0x00000000, 0x00000000, 0x00000000,
+	0x09420000, 0x1ca71ca7, 0x1c471ca7, 0x00000020, 0x1c070000, 0x1ca71ca7, 0x09a31ca7, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca71264, 0x1ca71ca7, 0x00001b86, 0x1bc70000, 0x1ca71ca7,
+	0x09621ca7, 0x00000000, 0x00000000, 0x12a40000, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x08c21c87,
+	0x00000000, 0x00000000, 0x12a50000, 0x12c51ca7, 0x00810000, 0x1ca71c67, 0x1c471ca7, 0x00000020,
+	0x00000000, 0x00000000, 0x00000000, 0x09220000, 0x1ca71ca7, 0x1b461ca7, 0x00000000, 0x1c070000,
+	0x1ca71ca7, 0x1c671ca7, 0x000008e2, 0x00000000, 0x00000000, 0x00000000, 0x1bc60000, 0x1ca71ca7,
+	0x1c671ca7, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1ca71be7, 0x00401c67, 0x00000000, 0x1c670040, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1bc61ca7, 0x00000060, 0x00000000, 0x00000000, 0x00000000,
+	0x1bc60020, 0x1c871ca7, 0x00000902, 0x00000000, 0x00000000, 0x1b250000, 0x1ca71ca7, 0x1c871ca7,
+	0x00000060, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1ca712a5, 0x1ca71ca7, 0x00411c87, 0x00000000, 0x00000000, 0x1c270020,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x00001be7, 0x00000000, 0x1ca711e3,
+	0x1ca71ca7, 0x09021c87, 0x00000000, 0x00000000, 0x00000000, 0x1bc60000, 0x1ca71ca7, 0x09421ca7,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1c670020, 0x1ca71ca7, 0x09831ca7, 0x00000000,
+	0x1ca71c07, 0x1ca71ca7, 0x00000922, 0x00000000, 0x00000000, 0x00000000, 0x00610000, 0x1ca71c67,
+	0x1ca71ca7, 0x00000942, 0x12e50000, 0x1ca71ca7, 0x1b861ca7, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1b460000, 0x1ca71ca7, 0x12a51ca7, 0x00000000, 0x1ca70983, 0x1ca71ca7, 0x00401c67,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca70942, 0x1ca71ca7, 0x00001c27, 0x09020000,
+	0x1ca71c87, 0x1c271ca7, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x12640000, 0x1ca71ca7,
+	0x1b051ca7, 0x00000000, 0x1ca71ba6, 0x1ca71ca7, 0x00001163, 0x00000000, 0x00400000, 0x1ca71c47,
+	0x1be71c47, 0x1ca71ca7, 0x1ca71ca7, 0x00000902, 0x00000000, 0x00200000, 0x1c871c47, 0x000008e2,
+	0x1ca711e3, 0x1ca71ca7, 0x00001ba6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71224,
+	0x1ca71ca7, 0x00001b46, 0x08610000, 0x1ca71c87, 0x1ca71ca7, 0x00001284, 0x00000000, 0x00000000,
+	0x00000000, 0x00400000, 0x1ca71c67, 0x1ca71ca7, 0x00001ba6, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1c670061, 0x1bc61ca7, 0x00000000, 0x00000000, 0x1ca71284,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x12c51ca7,
+	0x00000000, 0x00000000, 0x00000000, 0x11e30000, 0x1ca71ca7, 0x00001b45, 0x00000000, 0x00000000,
+	0x00000000, 0x1ca71284, 0x1ca71ca7, 0x09021ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1b860000, 0x1ca71ca7, 0x1be71ca7,
+	0x00000000, 0x00000000, 0x00000000, 0x1be71b46, 0x1be71be7, 0x1c271be7, 0x1ca71c87, 0x1ca71ca7,
+	0x1ba61ca7, 0x00000000, 0x12c50000, 0x1ca71ca7, 0x1bc61ca7, 0x00000000, 0x00000000, 0x00000000,
+	0x08c10000, 0x1ca71c87, 0x1ca71ca7, 0x00000962, 0x00000000, 0x00000000, 0x00000000, 0x12030000,
+	0x1ca71ca7, 0x1ca71ca7, 0x00000922, 0x1c870902, 0x1ca71ca7, 0x09221ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1ca71224, 0x1ca71ca7, 0x08e11c87, 0x00000000, 0x1ca71bc6, 0x1ca71ca7,
+	0x00001244, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71c07, 0x1ca71ca7, 0x000011e3,
+	0x12640000, 0x1ca71ca7, 0x1b861ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11e30000,
+	0x1ca71ca7, 0x1bc61ca7, 0x00000000, 0x1ca71204, 0x1ca71ca7, 0x00001305, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1ca71ae5, 0x1ca71ca7, 0x00001264, 0x1b660000, 0x1ca71ca7, 0x09221ca7,
+	0x00000000, 0x00000000, 0x1ca711e3, 0x08e11c47, 0x1c270040, 0x1ca71ca7, 0x09421ca7, 0x00000000,
+	0x00000000, 0x1ca709a3, 0x00001b86, 0x1b250000, 0x1ca71ca7, 0x1bc61ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1be60040, 0x1ca71ca7, 0x12e51ca7, 0x00000000, 0x1ca70922, 0x1ca71ca7,
+	0x08a11c87, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca70902, 0x1ca71ca7, 0x12c51ca7,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09220000, 0x1ca71ca7,
+	0x000012e5, 0x00000000, 0x00200000, 0x1c6712a4, 0x1ca71c87, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x00001c07, 0x00000000, 0x00000000, 0x00400000, 0x1ca71c07,
+	0x09021c87, 0x00000000, 0x00000000, 0x00000000, 0x12240000, 0x1ca71ca7, 0x1ca71ca7, 0x000011c3,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00200000, 0x1ca71c47, 0x1ca71ca7, 0x00001305, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x08e20000, 0x1ca71c47, 0x1ca71ca7, 0x000012c5, 0x00000000, 0x1ca71ba6, 0x1ca71ca7,
+	0x00001284, 0x00000000, 0x00000000, 0x00000000, 0x1ca71203, 0x1ca71ca7, 0x1b861ca7, 0x000008a1,
+	0x00000000, 0x00000000, 0x12030861, 0x1ca71c87, 0x1ca71ca7, 0x00611c87, 0x12440000, 0x1ca71ca7,
+	0x1ca71ca7, 0x08811325, 0x00000020, 0x00000000, 0x08610020, 0x1c8711e3, 0x1ca71ca7, 0x1c671ca7,
+	0x00000040, 0x1c670040, 0x1ca71ca7, 0x09421ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1c870861, 0x1ca71ca7, 0x09021ca7, 0x00000000, 0x1ca71b46, 0x1ca71ca7, 0x00001284, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca712c5, 0x1ca71ca7, 0x00001b25, 0x1b250000, 0x1ca71ca7,
+	0x12031ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ba60000, 0x1ca71ca7, 0x09a31ca7,
+	0x00000000, 0x1ca71b45, 0x1ca71ca7, 0x00000962, 0x00000000, 0x1be60000, 0x09a31ca7, 0x00000000,
+	0x1ca712c5, 0x1ca71ca7, 0x00001183, 0x00000000, 0x1b660000, 0x09a31ca7, 0x00200000, 0x1ca71c47,
+	0x1ca71ca7, 0x11c31c87, 0x00000040, 0x00000000, 0x00000000, 0x1b6608e2, 0x1ca71ca7, 0x1ca71ca7,
+	0x00001224, 0x12240000, 0x1ca71ca7, 0x1c071ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x11e30000, 0x1ca71ca7, 0x1ca71ca7, 0x000011e3, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1ca71203, 0x12031ca7, 0x00000000, 0x00000000, 0x00000000, 0x08e20040,
+	0x11420942, 0x11421142, 0x09421142, 0x12a41183, 0x1ca71c67, 0x1ca71ca7, 0x1c671ca7, 0x00000020,
+	0x00000000, 0x00000000, 0x1ca71244, 0x1be71ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1ca71284, 0x1ca71ca7, 0x12841ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1c8708c1, 0x1ca71ca7, 0x12241ca7, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1b250000, 0x1ca71ca7, 0x11e31ca7,
+	0x00000000, 0x1c670040, 0x1ca71ca7, 0x09a31ca7, 0x00000000, 0x00000000, 0x00000000, 0x1b250000,
+	0x1ca71ca7, 0x1ca71ca7, 0x1c871ca7, 0x1c071c47, 0x1be71be7, 0x1c671c27, 0x1ca71ca7, 0x1ca71ca7,
+	0x1b661ca7, 0x00000000, 0x1ca71b66, 0x1ca71ca7, 0x1ca71ca7, 0x1c671c87, 0x1c471c47, 0x1c671c47,
+	0x1ca71c87, 0x1ca71ca7, 0x1ca71ca7, 0x00001b25, 0x09020000, 0x1ca71ca7, 0x1c871ca7, 0x00000861,
+	0x00000000, 0x00000000, 0x00000000, 0x09420000, 0x1ca71ca7, 0x1c671ca7, 0x00000040, 0x1c270000,
+	0x1ca71ca7, 0x09831ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ba60000, 0x1ca71ca7,
+	0x12441ca7, 0x00000000, 0x1ca71c27, 0x1ca71ca7, 0x00000922, 0x00000000, 0x00000000, 0x00000000,
+	0x00200000, 0x1ca71c47, 0x1c871ca7, 0x000008c1, 0x13050000, 0x1ca71ca7, 0x09831ca7, 0x00000000,
+	0x09420000, 0x1ba61ca7, 0x00000000, 0x11e30000, 0x1ca71ca7, 0x11c31ca7, 0x00000000, 0x08c10000,
+	0x1c271c87, 0x00000020, 0x1ca70902, 0x1ca71ca7, 0x1ca71ca7, 0x1c671ca7, 0x1be71c27, 0x1c271c07,
+	0x1c871c47, 0x1ca71ca7, 0x1ca71ca7, 0x08c11c87, 0x00000000, 0x1ca71305, 0x1ca71ca7, 0x00001b25,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca712e5, 0x1ca71ca7, 0x08e21c87, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12e50000, 0x1ca71ca7, 0x00000902,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09630000,
+	0x1ca71c87, 0x1ca71ca7, 0x00201c67, 0x00000000, 0x00000000, 0x1c470061, 0x1ca71ca7, 0x00001be7,
+	0x00000000, 0x00000000, 0x00000000, 0x1c270081, 0x1ca71ca7, 0x1ca71ca7, 0x00001b25, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11a30000,
+	0x1ca71ca7, 0x1ca71ca7, 0x00000942, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1ca71b25, 0x1c871ca7, 0x000008e2, 0x08e20000, 0x1ca71c87, 0x1c871ca7, 0x000008c1,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca71c07, 0x1ca71ca7, 0x1c871ca7, 0x1ba61be7, 0x1ba61ba6,
+	0x1ba61ba6, 0x1ba61ba6, 0x1ba61ba6, 0x1b461ba6, 0x000008c1, 0x1c470000, 0x1ca71ca7, 0x1ca71ca7,
+	0x1be71c87, 0x1ba61ba6, 0x1ba61ba6, 0x1ba61ba6, 0x1ba61ba6, 0x1ba61ba6, 0x00a11b46, 0x00000000,
+	0x1ca71203, 0x1ca71ca7, 0x00001c07, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71224,
+	0x1ca71ca7, 0x00001bc6, 0x08810000, 0x1ca71c87, 0x1c871ca7, 0x000008a1, 0x00000000, 0x00000000,
+	0x00000000, 0x00200000, 0x1ca71c47, 0x1ca71ca7, 0x00000942, 0x1c870881, 0x1ca71ca7, 0x00401c87,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1c8708c1, 0x1ca71ca7, 0x00201c47, 0x00000000,
+	0x1ca71ae5, 0x1ca71ca7, 0x000011e3, 0x00000000, 0x1ca71b46, 0x00000983, 0x00000000, 0x1ca70983,
+	0x1ca71ca7, 0x00001203, 0x00000000, 0x1ca71284, 0x00001264, 0x12040000, 0x1ca71ca7, 0x1ca71ca7,
+	0x1c471ca7, 0x1ba61ba6, 0x1bc61bc6, 0x1ba61ba6, 0x1ba61ba6, 0x1ba61ba6, 0x11e31ba6, 0x00000000,
+	0x1be70000, 0x1ca71ca7, 0x12441ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1bc60000,
+	0x1ca71ca7, 0x1c671ca7, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1ca71bc6, 0x00401c87, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1bc60000, 0x1ca71ca7, 0x1c471ca7, 0x00000020, 0x00000000,
+	0x12a50000, 0x1ca71ca7, 0x1ca71ca7, 0x09621305, 0x09220902, 0x09420902, 0x1c071224, 0x1ca71ca7,
+	0x1ca71ca7, 0x1be71ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca712a4, 0x1ca71ca7, 0x08811c87, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ba60000, 0x1ca71ca7, 0x00201c27, 0x00000000,
+	0x1ca711c3, 0x1ca71ca7, 0x00201c47, 0x00000000, 0x00000000, 0x00000000, 0x1c870881, 0x1ca71ca7,
+	0x1c471ca7, 0x00000922, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x08a10000, 0x1ca71c87, 0x1ca71ca7, 0x09221c27, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x12e50000, 0x1ca71ca7, 0x13051ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x13050000, 0x1ca71ca7, 0x12e51ca7, 0x00000000, 0x1ca70962, 0x1ca71ca7,
+	0x00201c27, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1c8708c2, 0x1ca71ca7, 0x00401c67,
+	0x09830000, 0x1ca71ca7, 0x1bc61ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09a30000,
+	0x1ca71ca7, 0x1b661ca7, 0x00000000, 0x1ac50000, 0x1ca71ca7, 0x12441ca7, 0x00000000, 0x1c8708e1,
+	0x00201be6, 0x00000000, 0x09220000, 0x1ca71ca7, 0x12641ca7, 0x00000000, 0x1c470061, 0x08811c87,
+	0x00000000, 0x1ca71b05, 0x1ca71ca7, 0x12841ca7, 0x00000020, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00610000, 0x1ca71c87, 0x1ca71ca7, 0x00000962, 0x00000000,
+	0x00000000, 0x00000000, 0x00400000, 0x1ca71c67, 0x1ca71ca7, 0x00001bc6, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1c670020, 0x1be71ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71b46,
+	0x1ca71ca7, 0x00001bc6, 0x00000000, 0x08a10000, 0x1ca71c87, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x00411c67, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1b860000, 0x1ca71ca7,
+	0x1c271ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00410000,
+	0x1ca71c67, 0x13051ca7, 0x00000000, 0x12a50000, 0x1ca71ca7, 0x1b661ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x09420000, 0x1ca71ca7, 0x1c871ca7, 0x00000983, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca70962, 0x1ca71ca7, 0x09421c87, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71bc6,
+	0x1ca71ca7, 0x00001224, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71be7, 0x1ca71ca7,
+	0x000011e3, 0x12440000, 0x1ca71ca7, 0x1b661ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x09a30000, 0x1ca71ca7, 0x1b661ca7, 0x00000000, 0x1ca71264, 0x1ca71ca7, 0x00001305, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca71284, 0x1ca71ca7, 0x00001244, 0x00000000, 0x1ca712a5,
+	0x1ca71ca7, 0x00001305, 0x1b250000, 0x12041ca7, 0x00000000, 0x00000000, 0x1ca708e2, 0x1ca71ca7,
+	0x00001b46, 0x1b450000, 0x1b251ca7, 0x00000000, 0x1bc60000, 0x1ca71ca7, 0x1b461ca7, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca70922,
+	0x1ca71ca7, 0x08811c87, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca70902, 0x1ca71ca7,
+	0x12e51ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09020000,
+	0x1ca71ca7, 0x000012e5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1b860000, 0x1ca71ca7, 0x1b051ca7, 0x00000000, 0x00000000, 0x1ca71305,
+	0x1ca71ca7, 0x1c871ca7, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x1ca71ca7, 0x1ca71ca7,
+	0x1c871ca7, 0x000008c1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1ca71c27, 0x1ca71ca7, 0x00001be7, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca711e3, 0x1ca71ca7, 0x00000962, 0x00000000, 0x1ca71b86,
+	0x1ca71ca7, 0x00001284, 0x00000000, 0x00000000, 0x00000000, 0x1ca711e3, 0x1ca71ca7, 0x00001bc6,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11e30000,
+	0x1ca71ca7, 0x1ba61ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1c670040, 0x1ca71ca7, 0x09421ca7, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1c870040, 0x1ca71ca7, 0x09021ca7, 0x00000000, 0x1ca71b25, 0x1ca71ca7, 0x00001284,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca712a4, 0x1ca71ca7, 0x000011e3, 0x1b450000,
+	0x1ca71ca7, 0x12441ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1b860000, 0x1ca71ca7,
+	0x09421ca7, 0x00000000, 0x12640000, 0x1ca71ca7, 0x1c871ca7, 0x12e511c3, 0x1c671ca7, 0x00000061,
+	0x00000000, 0x00c10000, 0x1ca71ca7, 0x1c871ca7, 0x1b461284, 0x1ca71ca7, 0x00000942, 0x00000000,
+	0x1ca71c67, 0x1ca71ca7, 0x00000922, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x12030000, 0x1ca71ca7, 0x1c271ca7, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x11e30000, 0x1ca71ca7, 0x1ca71ca7, 0x00001224, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca71224, 0x12241ca7, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x1ca71c27, 0x1ca71ca7,
+	0x000011e3, 0x00000000, 0x1c870902, 0x1c871ca7, 0x08e212e5, 0x00610061, 0x00610061, 0x00610061,
+	0x00610061, 0x11e30081, 0x1ca71c67, 0x1ca71ca7, 0x09831ca7, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1c470000, 0x1ca71ca7, 0x1c471ca7,
+	0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1c070040, 0x1ca71ca7,
+	0x00201c27, 0x00000000, 0x1c470020, 0x1ca71ca7, 0x09a31ca7, 0x00000000, 0x00000000, 0x00000000,
+	0x12440000, 0x1ca71ca7, 0x12c51ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1ca71264, 0x1ca71ca7, 0x00001284, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09020000, 0x1ca71ca7, 0x1c871ca7,
+	0x00000861, 0x00000000, 0x00000000, 0x00000000, 0x09220000, 0x1ca71ca7, 0x1c871ca7, 0x00000040,
+	0x1c270000, 0x1ca71ca7, 0x12031ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1be60000,
+	0x1ca71ca7, 0x08811c87, 0x00000000, 0x1ca71bc6, 0x1ca71ca7, 0x000009c3, 0x00000000, 0x00000000,
+	0x00000000, 0x00610000, 0x1ca71c87, 0x1c671ca7, 0x00000040, 0x00000000, 0x1ca71244, 0x1ca71ca7,
+	0x1ca71ca7, 0x1ca71ca7, 0x000012c5, 0x00000000, 0x00000000, 0x1ca700c1, 0x1ca71ca7, 0x1ca71ca7,
+	0x1ca71ca7, 0x00001be6, 0x00000000, 0x1c870861, 0x1ca71ca7, 0x00201c67, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca712e5, 0x1ca71ca7,
+	0x00001b46, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca712a5, 0x1ca71ca7, 0x12241ca7,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1be70020, 0x1c871ca7,
+	0x00000902, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1ca70942, 0x1ca71ca7, 0x08811c87, 0x00000000, 0x1b660000, 0x1ca71ca7, 0x00001264,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12440000, 0x1ca71ca7, 0x1ca71ca7,
+	0x00001244, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1ca71b86, 0x1ca71ca7, 0x12641ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x13250020, 0x1ca71ca7, 0x12441ca7, 0x00000000, 0x08c10000, 0x1ca71c87, 0x1c871ca7,
+	0x000008c1, 0x00000000, 0x00000000, 0x00000000, 0x1ca71244, 0x1ca71ca7, 0x00001284, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12840000, 0x1ca71ca7,
+	0x12441ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1ca711e3, 0x1ca71ca7, 0x00001c07, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1ca71203, 0x1ca71ca7, 0x00001bc6, 0x08610000, 0x1ca71c87, 0x1ca71ca7, 0x00001224, 0x00000000,
+	0x00000000, 0x00000000, 0x09420000, 0x1ca71c87, 0x1b451ca7, 0x00000000, 0x1be70000, 0x1ca71ca7,
+	0x11e31ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71224, 0x1ca71ca7, 0x00001b66,
+	0x00000000, 0x12030000, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x08e21c87, 0x00000000, 0x00000000,
+	0x00c10000, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x12041ca7, 0x00000000, 0x08810000, 0x1ca71c87,
+	0x1c471ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1be60000, 0x1ca71ca7, 0x12641ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x12c50000, 0x1ca71ca7, 0x1ca71ca7, 0x00201bc6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x12e50020, 0x1ca71ca7, 0x00001bc6, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1c0700a1, 0x1ca71ca7, 0x13251ca7, 0x00000000,
+	0x09620000, 0x1ca71c87, 0x00001b86, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1c8708e2, 0x1ca71ca7, 0x13051ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11e30000, 0x1ca71ca7, 0x1ca71ca7, 0x1b251ca7,
+	0x00400922, 0x00000020, 0x00200000, 0x08e20040, 0x1bc611e3, 0x1ca71ca7, 0x1c071ca7, 0x00000040,
+	0x00000000, 0x1ca711a3, 0x1ca71ca7, 0x00201c47, 0x00000000, 0x00000000, 0x00000000, 0x11e30000,
+	0x1ca71ca7, 0x1b661ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1ca71204, 0x1ca71ca7, 0x00001b25, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12e50000, 0x1ca71ca7, 0x1b051ca7, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x12e50000, 0x1ca71ca7, 0x12e51ca7, 0x00000000, 0x1ca70942,
+	0x1ca71ca7, 0x1b861ca7, 0x00000020, 0x00000000, 0x00000000, 0x00a10000, 0x1ca71c07, 0x1c671ca7,
+	0x000008e1, 0x00000000, 0x1ca71be6, 0x1ca71ca7, 0x00001b45, 0x00000000, 0x00000000, 0x00000000,
+	0x1c670962, 0x1ca71ca7, 0x09621ca7, 0x00000000, 0x00000000, 0x1ca711e3, 0x1ca71ca7, 0x1ca71ca7,
+	0x1ba61ca7, 0x00000000, 0x00000000, 0x00000000, 0x1ca700c1, 0x1ca71ca7, 0x1ca71ca7, 0x1c671ca7,
+	0x00000061, 0x00000000, 0x1c870040, 0x1ca71ca7, 0x08a11c87, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00410000, 0x1ca71c67, 0x1ca71ca7, 0x00000962,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca711c3, 0x1ca71ca7, 0x1ca71ca7, 0x09631ba6,
+	0x00000040, 0x00000000, 0x00000000, 0x08810020, 0x1bc609a3, 0x1ca71ca7, 0x09421c87, 0x00000000,
+	0x00000000, 0x00200020, 0x00200020, 0x00200020, 0x00200020, 0x00200020, 0x08c10020, 0x1c471204,
+	0x1ca71ca7, 0x1c871ca7, 0x000008e2, 0x00000000, 0x1ca71ba6, 0x08e21c87, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x1ca71c47, 0x1ca71ca7, 0x00001bc6,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1b860020, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1c471c87, 0x1c271c27, 0x1c871c47, 0x1ca71c87,
+	0x1ca71ca7, 0x1c671ca7, 0x00000922, 0x00000000, 0x12840000, 0x1ca71ca7, 0x1ba61ca7, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x1c6708a1, 0x1ca71ca7, 0x12c51ca7, 0x08c10942, 0x08a108c1,
+	0x08a108a1, 0x08a108a1, 0x08a108a1, 0x00000000, 0x00000000, 0x08c10000, 0x1ca71c87, 0x1c871ca7,
+	0x092212a4, 0x08c108c1, 0x08a108a1, 0x08a108a1, 0x08a108a1, 0x000008a1, 0x00000000, 0x00000000,
+	0x1ca71bc6, 0x1ca71ca7, 0x00001224, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71bc6,
+	0x1ca71ca7, 0x00001203, 0x12240000, 0x1ca71ca7, 0x1ca71ca7, 0x1b861ca7, 0x090211c3, 0x090208c1,
+	0x12840983, 0x1ca71c47, 0x1ca71ca7, 0x00001203, 0x00000000, 0x13050000, 0x1ca71ca7, 0x1ca71ca7,
+	0x09a31b45, 0x08a108c1, 0x098308c1, 0x1c871305, 0x1ca71ca7, 0x13251ca7, 0x00000000, 0x00000000,
+	0x11c30000, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x000009a3, 0x00000000, 0x00000000, 0x08c10000,
+	0x1ca71c87, 0x1ca71ca7, 0x1ca71ca7, 0x000012a5, 0x00000000, 0x00000000, 0x1ca71b45, 0x1ca71ca7,
+	0x11c31bc6, 0x08c10902, 0x08a108a1, 0x08a108a1, 0x08a108a1, 0x004008a1, 0x00000000, 0x00000000,
+	0x1ca70902, 0x1ca71ca7, 0x08811c87, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1ca71325, 0x1ca71ca7, 0x1ca71ca7, 0x1c871ca7, 0x1bc61c27, 0x1b861ba6, 0x1c271bc6, 0x1ca71c87,
+	0x1ca71ca7, 0x09a31c67, 0x00000000, 0x00000000, 0x1c070020, 0x1c871c87, 0x1c871c87, 0x1c871c87,
+	0x1c871c87, 0x1c871c87, 0x1ca71c87, 0x1ca71ca7, 0x1ca71ca7, 0x00001244, 0x00000000, 0x1ca70983,
+	0x12c51ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1ba60000, 0x1ca71ca7, 0x1c671ca7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13250060, 0x1ca71c87, 0x1ca71ca7, 0x1ca71ca7,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1c271ca7, 0x00000942, 0x00000000, 0x00000000,
+	0x1ca71b66, 0x1ca71ca7, 0x00001284, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1c270982,
+	0x1ca71ca7, 0x1ca71ca7, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x1c871c87, 0x09621c87, 0x00000000,
+	0x00000000, 0x09a30000, 0x1ca71c27, 0x1ca71ca7, 0x1c871ca7, 0x1c871c87, 0x1c871c87, 0x1c871c87,
+	0x1c871c87, 0x00000922, 0x00000000, 0x1c670020, 0x1ca71ca7, 0x09221ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1c670040, 0x1ca71ca7, 0x09021c87, 0x00000000, 0x1ca71b25, 0x1ca71ca7,
+	0x1ca71ca7, 0x1ca71ca7, 0x1c871ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1c471ca7, 0x000011c3, 0x00000000,
+	0x00000000, 0x1c2708c1, 0x1ca71ca7, 0x1ca71ca7, 0x1c871ca7, 0x1c871c87, 0x1ca71ca7, 0x1ca71ca7,
+	0x13051c87, 0x00000040, 0x00000000, 0x00000000, 0x1ca70962, 0x1ca71ca7, 0x1ca71ca7, 0x00201bc6,
+	0x00000000, 0x00000000, 0x00000000, 0x1c670061, 0x1ca71ca7, 0x1ca71ca7, 0x00811c47, 0x00000000,
+	0x00000000, 0x00610000, 0x1c871b66, 0x1ca71ca7, 0x1ca71ca7, 0x1c871c87, 0x1c871c87, 0x1c871c87,
+	0x1c871c87, 0x00001305, 0x00000000, 0x11e30000, 0x1ca71ca7, 0x1c071ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ba609a3, 0x1ca71c87, 0x1ca71ca7, 0x1ca71ca7,
+	0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1c471ca7, 0x08a112e5, 0x00000000, 0x00000000, 0x08a10000,
+	0x1ca71c87, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1ca71ca7, 0x1c671ca7,
+	0x00001224, 0x00000000, 0x1ba60000, 0x1c271ca7, 0x00000061, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71264, 0x1ca71ca7, 0x08a11c87, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x08e20000, 0x12641203, 0x12841284, 0x12841284, 0x12841284, 0x12841284, 0x12841284, 0x11c31284,
+	0x00000060, 0x00000000, 0x00000000, 0x11c30000, 0x1be71bc6, 0x00601305, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x09220020, 0x12841203, 0x1b051ae5, 0x1b261b05, 0x1b261b26,
+	0x1b261b26, 0x12c51b26, 0x00000040, 0x00000000, 0x00000000, 0x00400000, 0x12030922, 0x1ae51284,
+	0x1b051b05, 0x1b261b26, 0x1b261b26, 0x1b261b26, 0x002012a4, 0x00000000, 0x00000000, 0x1be712a4,
+	0x12641bc7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1be712a5, 0x12441bc7,
+	0x00000000, 0x1be70000, 0x1ca71ca7, 0x1c071ca7, 0x12241264, 0x12241224, 0x12241224, 0x12241224,
+	0x09831224, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x11e30061, 0x1b661305, 0x1be71ba6,
+	0x1c271c27, 0x1bc61be7, 0x1b051b66, 0x08e21244, 0x00000000, 0x00000000, 0x00000000, 0x00200000,
+	0x1b251264, 0x1b251325, 0x008112a5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12e50942,
+	0x1b251325, 0x08e212c5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09a308c1, 0x12c51244,
+	0x1b051b05, 0x1b261b25, 0x1b261b26, 0x1b261b26, 0x09221b05, 0x00000000, 0x00000000, 0x1b6608c1,
+	0x1b861c07, 0x00000942, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x08c10000, 0x124411a3, 0x1b2512c5, 0x1be71b86, 0x1bc71c07, 0x1ae51b66, 0x09421244, 0x00000040,
+	0x00000000, 0x00000000, 0x00000000, 0x12440020, 0x12841284, 0x12841284, 0x12841284, 0x12841284,
+	0x12841284, 0x12841284, 0x11c31264, 0x00000081, 0x00000000, 0x00000000, 0x126411e3, 0x000008c1,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000,
+	0x12841224, 0x11e31284, 0x00000020, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00610000, 0x1ca71c87, 0x1ca71ca7, 0x00000942,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1ca70942, 0x1ca71ca7, 0x00401c67, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x12240000, 0x1ca71ca7, 0x1ba61ca7, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08610000, 0x00000000, 0x00000861, 0x00000000,
+	0x08410000, 0x00000000, 0x08410000, 0x18c32945, 0x00000000, 0x00200000, 0x08610861, 0x00200861,
+	0x00000000, 0x08410000, 0x00000000, 0x08610861, 0x08610861, 0x00000020, 0x00000000, 0x00200841,
+	0x08410000, 0x00000020, 0x00000000, 0x00200020, 0x00000000, 0x00200000, 0x21242104, 0x00000020,
+	0x00000000, 0x00000000, 0x08410000, 0x00000020, 0x00200841, 0x00000000, 0x00200000, 0x00000020,
+	0x00200841, 0x00000000, 0x00200000, 0x00000841, 0x00000000, 0x21040000, 0x00002104, 0x00000000,
+	0x00200020, 0x00000000, 0x00000000, 0x08410020, 0x00000000, 0x08610000, 0x00000000, 0x00200000,
+	0x08610861, 0x08610861, 0x08410861, 0x08410000, 0x00000000, 0x00000000, 0x29450861, 0x00000861,
+	0x00000000, 0x08410020, 0x00000000, 0x00000000, 0x00000861, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ca71305,
+	0x1ca71ca7, 0x000012c5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1082f7be, 0xf7be18e3, 0x00004a49, 0x00000000, 0x31a6ce79, 0x42080000, 0xf7bee71c, 0xad75ffdf,
+	0x00000841, 0xf7be8430, 0xf7bef7be, 0x8c71ef5d, 0x00000000, 0x3186d6ba, 0xf79e0000, 0xf7bef7be,
+	0xef5df7be, 0x00008410, 0xa5140000, 0x0000630c, 0x9cd3c618, 0x00000000, 0x7bef0000, 0x00008c51,
+	0x39c70000, 0xffdfd6ba, 0xdedbffdf, 0x000039e7, 0x00000000, 0x00000000, 0x5aeba534, 0xc6380000,
+	0x00009cd3, 0x00000000, 0x84307bef, 0xad550000, 0x0000b596, 0x00000000, 0xa514632c, 0x00000000,
+	0xce792965, 0xffdfffdf, 0x2945ce59, 0x738e0000, 0x00009cd3, 0x00000000, 0x94b20000, 0x00007bcf,
+	0x528a0000, 0x2945f7be, 0x00000000, 0xf7be7bcf, 0xf7bef7be, 0xf7bef7be, 0x0000c638, 0x2124e71c,
+	0x00000000, 0xf79e7bcf, 0xf79ef7be, 0x00008c51, 0x52aa0000, 0x18e3ef5d, 0x00000000, 0xf7be1082,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x1be70000, 0x1ca71ca7, 0x11e31ca7, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0xffff0000, 0x18e31082, 0xce79ffff, 0x00000020, 0xd6ba0000,
+	0x002039c7, 0x5acbdedb, 0x10820000, 0x7befbdf7, 0x8c510000, 0x29459cd3, 0x42282945, 0x52aaef5d,
+	0xdefb0000, 0x00003186, 0x2104ffdf, 0x08610861, 0xf79e4228, 0x000031a6, 0x632cad55, 0xce590000,
+	0x2965ffdf, 0x00000000, 0x8c718410, 0x18e30000, 0x738eef5d, 0x00200020, 0xe73c73ae, 0x00000841,
+	0x00000000, 0xad750000, 0x0000630c, 0xffdfce59, 0x00002965, 0x84300000, 0x00008c51, 0xffffb596,
+	0x00004208, 0x6b4d0000, 0x0000a534, 0xe73c1082, 0x08418410, 0x8c510841, 0x0861e71c, 0xe73c2945,
+	0x00000020, 0x00000000, 0x2965e73c, 0x00000000, 0xc638a534, 0x00008410, 0x10a20000, 0x29452945,
+	0x528ae71c, 0x21042945, 0xef5d0000, 0x00002124, 0xdefb6b6d, 0x00003186, 0xd6ba2965, 0x00007bef,
+	0xffff5acb, 0x00009cd3, 0x10820000, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00610000, 0x1ca71c67, 0x1c871ca7,
+	0x00000902, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1082ffff,
+	0xef7d18e3, 0x5aebd6ba, 0x00000000, 0x39c7d6ba, 0xef7d10a2, 0x00000020, 0x42280000, 0x00008c51,
+	0x84308c51, 0x00000000, 0x94920000, 0x00009492, 0x3186defb, 0xffdf0000, 0x000010a2, 0x00000000,
+	0x632cbdd7, 0xad550000, 0x0000632c, 0xc638ce59, 0x0000b596, 0x84100000, 0x00008c71, 0xa5348c51,
+	0x00000000, 0x00000000, 0x31a6bdf7, 0x00000000, 0x00000000, 0x630cad75, 0xce590000, 0xad75c638,
+	0x00000000, 0x8c518430, 0xb5960000, 0xce59c638, 0x00000000, 0xa5346b4d, 0x7bcf0000, 0x0000b5b6,
+	0x00000000, 0xc6180000, 0x00006b6d, 0x31a6d69a, 0x00000000, 0xd6ba31a6, 0x00000000, 0xe71c0841,
+	0xd69a4a49, 0x00000000, 0x00000000, 0xdefb0000, 0x00002965, 0x00000000, 0x2124ef5d, 0xe71c0020,
+	0x00004228, 0x00000000, 0xef5d39c7, 0x5acb0861, 0xef5dd69a, 0x00002945, 0xffff1082, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x1ca708e2, 0x1ca71ca7, 0x00201c07, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0xffff0000, 0x18e31082, 0x528aef5d, 0x0841defb, 0xd6ba0000, 0x002039c7,
+	0x8c71dedb, 0x00002104, 0x00000000, 0x8c510000, 0x00008430, 0x00000000, 0x8430a514, 0xdefb0000,
+	0x00003186, 0x10a2ffdf, 0x00000000, 0xe71c1082, 0x00004a49, 0x632cad55, 0xce590000, 0xe73c52aa,
+	0x00004208, 0x8c718410, 0xd69a0000, 0x00004a69, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0xad750000, 0x0000630c, 0x52aace59, 0x39e7e73c, 0x84300000, 0x00008c51, 0x632cb596, 0x52aad6ba,
+	0x6b4d0000, 0x0000a534, 0x632cbdd7, 0x00000000, 0x00000000, 0xb5966b6d, 0x84300000, 0x00007bef,
+	0x84300000, 0x00008c51, 0x42280000, 0x0000bdd7, 0x2945e71c, 0x00000000, 0x00000000, 0x2965defb,
+	0x00000000, 0xef5d0000, 0x29652124, 0x0020ef5d, 0x00000000, 0x00000000, 0x4208e71c, 0xb5b65acb,
+	0xad758430, 0x10820000, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12a511e3, 0x00611204, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1082ffff, 0xef5d18e3,
+	0xbdf70841, 0x0000738e, 0x39c7d6ba, 0x31a60000, 0xffffd6ba, 0x8410dedb, 0x00000841, 0xb5968c51,
+	0x5aeb5aeb, 0xf79e8430, 0x000031a6, 0x3186defb, 0xffdf0000, 0xbdf7c618, 0xef5dbdf7, 0x0000b596,
+	0xad550000, 0x0000632c, 0x4228ce59, 0xc6386b4d, 0x84100000, 0x00008c71, 0x2965ef7d, 0x00000000,
+	0x420839e7, 0x18e34208, 0x00000000, 0x00000000, 0x630cad75, 0xce590000, 0x6b6d4208, 0x0000c638,
+	0x8c518430, 0xb5960000, 0x528a5aeb, 0x0841d6ba, 0xa5346b4d, 0xd6ba0000, 0x00004228, 0x00000000,
+	0x4a690000, 0x0000ce79, 0xce5931a6, 0x00000000, 0x39c7d69a, 0x00000000, 0x632c9cd3, 0x94b20000,
+	0x00008410, 0x00000000, 0xdefb0000, 0x00002965, 0x00000000, 0x2124ef5d, 0xd69a4a49, 0x00000000,
+	0x00000000, 0xc6180000, 0x5acb5aeb, 0x1082b5b6, 0x39c7e73c, 0xffff1082, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0xffff0000, 0x18e31082, 0x0020ef5d, 0xef5d39c7, 0xd6ba1082, 0x000039c7, 0x00200000,
+	0x841031a6, 0xa514e73c, 0x8c510000, 0xce79e73c, 0xb5b6ce79, 0x00004a69, 0xdefb0000, 0x00003186,
+	0x7bcfffdf, 0xd69a738e, 0x0000a514, 0x00000000, 0x632cad55, 0xce590000, 0x08414228, 0x528ad6ba,
+	0x8c718410, 0xef5d0000, 0x00003186, 0xdefb0000, 0xf7beef5d, 0x000073ae, 0x00000000, 0xad750000,
+	0x0000630c, 0x4208ce59, 0xdedb0841, 0x84304a69, 0x00008c51, 0x5aebb596, 0xc6380000, 0x6b4d6b4d,
+	0x0000a534, 0x4a49d6ba, 0x00000000, 0x00000000, 0xce79528a, 0x00200000, 0x18c3defb, 0xe71c2104,
+	0x00000000, 0xe73c0000, 0x39e752aa, 0xd69a7bcf, 0x00000000, 0x00000000, 0x2965defb, 0x00000000,
+	0xef5d0000, 0x4a492124, 0x0000d6ba, 0x00000000, 0x00000000, 0x5acbc638, 0xb5b65acb, 0x738e0000,
+	0x1082c618, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1082ffff, 0xef5d18e3, 0x00000020,
+	0x8430ad55, 0x39c7d6ba, 0x52aa2104, 0x00000000, 0x21240000, 0x0841ef7d, 0x84308c51, 0x00000000,
+	0x00000000, 0x00000000, 0x3186defb, 0xffdf0000, 0x000010a2, 0xef5d18c3, 0x0000528a, 0xad550000,
+	0x0000632c, 0x4228ce59, 0x52aa0000, 0x8430d6ba, 0x00008c71, 0x5aebc638, 0x00000000, 0x00000000,
+	0x73ae9cd3, 0x00000000, 0x00000000, 0x630cad75, 0xce590000, 0x00004208, 0xd69a5acb, 0x8c518c51,
+	0xb5960000, 0x00005aeb, 0xe71c4208, 0xa5347bcf, 0xad750000, 0x0000738e, 0x00000000, 0x7bcf0000,
+	0x0000ad55, 0x94920000, 0x6b6d5aeb, 0x00009cd3, 0x39e70000, 0xd69aef7d, 0xd69ad69a, 0x2965f7be,
+	0x00000000, 0xdefb0000, 0x00002965, 0x00000000, 0x2124ef5d, 0xef7d2124, 0x00000861, 0x00000000,
+	0xef5d0020, 0x5acb31a6, 0x0000b5b6, 0xdefb0020, 0xffff5aeb, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0xffff0000, 0x18e31082, 0x0020ef5d, 0x29450000, 0xef7def7d, 0x31a639c7, 0x0841e71c, 0x00000000,
+	0xef5d1082, 0x8c510841, 0x00008430, 0x00000000, 0x00000000, 0xdefb0000, 0x00003186, 0x10a2ffdf,
+	0x00000000, 0xdedb73ae, 0x00000020, 0x632cad55, 0xce590000, 0x00004228, 0xce590000, 0x8c71e71c,
+	0x738e0000, 0x0020c618, 0x00000000, 0xa5140000, 0x000073ae, 0x00000000, 0xad750000, 0x0000630c,
+	0x4208ce59, 0x00000000, 0xe71cce79, 0x00008c51, 0x5aebb596, 0x00000000, 0xe71cb596, 0x0000a534,
+	0xd69a5acb, 0x00000841, 0x08610000, 0x52aadedb, 0x00000000, 0xad554208, 0x4228bdd7, 0x00000000,
+	0x7bef8c71, 0x00000000, 0xa5340000, 0x00007bef, 0x00000000, 0x2965defb, 0x00000000, 0xef5d0000,
+	0x00002124, 0x6b4dce79, 0x00000000, 0x5acb0000, 0x0020dedb, 0xb5b65acb, 0x00000000, 0xe71c5aeb,
+	0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1082ffff, 0xef5d18e3, 0x00000020, 0x94b20000,
+	0x39c7ffff, 0xce590020, 0x4208b5b6, 0xb5b64208, 0x000094b2, 0x84308c51, 0x00000000, 0x00000000,
+	0x00000000, 0x3186defb, 0xffdf0000, 0x000010a2, 0x08610000, 0x632ce71c, 0xad550000, 0x0000632c,
+	0x4228ce59, 0x00000000, 0xffff4208, 0x00008c71, 0xce590841, 0x4228b5b6, 0x94b239e7, 0x4a49f7be,
+	0x00000000, 0x00000000, 0x630cad75, 0xce590000, 0x00004208, 0x42280000, 0x8c51ffff, 0xb5960000,
+	0x00005aeb, 0x29650000, 0xa534ffdf, 0x00000000, 0xbdd7bdf7, 0x42284228, 0xbdf7bdf7, 0x00000000,
+	0x00200000, 0xe71cdedb, 0x00000841, 0xdedb0020, 0x00003186, 0x00000000, 0xd6ba5acb, 0x00000000,
+	0xdefb0000, 0x00002965, 0x00000000, 0x2124ef5d, 0x39e70000, 0x73aeef7d, 0x6b6d31a6, 0x4a69ef7d,
+	0x5acb0000, 0x0000b5b6, 0x00200000, 0xffffce59, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc6180000,
+	0x10a20861, 0x0020b596, 0x00000000, 0xbdf718e3, 0x00002945, 0xa51418c3, 0xdefbe71c, 0x08419492,
+	0x6b4d0000, 0x0000632c, 0x00000000, 0x00000000, 0xa5340000, 0x00002124, 0x0861bdf7, 0x00000000,
+	0x5acb0000, 0x0000a514, 0x4a698410, 0x9cd30000, 0x000031a6, 0x00000000, 0x6b6d9cd3, 0x00000000,
+	0x8c711082, 0xe71cdedb, 0x31a6ad75, 0x00000000, 0x00000000, 0x84100000, 0x00004a49, 0x31869cd3,
+	0x00000000, 0x9cd30000, 0x00006b4d, 0x4a498430, 0x00000000, 0x84300000, 0x00007bef, 0x10820000,
+	0xdefb9492, 0x9492defb, 0x00000861, 0x00000000, 0x84100000, 0x00008430, 0x18e30000, 0x0000b5b6,
+	0x00000000, 0x10a20000, 0x18c3bdf7, 0x00000000, 0x2124ad55, 0x00000000, 0xb5960000, 0x000018e3,
+	0x42080000, 0xef5dc618, 0x4a69c638, 0x00000000, 0x8c514208, 0x00000000, 0x42280000, 0x0000c618,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
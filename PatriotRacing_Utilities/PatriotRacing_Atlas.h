@@ -0,0 +1,85 @@
+/*
+
+	Program name: Bob Jones Patriot Racing sprite atlas table
+
+	made by PatriotRacing_Tools/AtlasBuild from PatriotRacing_Icons.h and GPUSA_Icons.h, don't
+	edit, change the icon and run it again
+
+*/
+
+#ifndef PATRIOT_RACING_ATLAS_H
+#define PATRIOT_RACING_ATLAS_H
+
+#include "PatriotRacing_Sprites.h"
+
+#define ATLAS_SPRITES 25
+#define ATLAS_WORDS 25798
+
+extern const uint32_t AtlasWords[ATLAS_WORDS];
+
+// width, height, format, offset, words
+constexpr SpriteInfo AtlasTable[ATLAS_SPRITES] = {
+	{32, 32, SPRITE_RGB565, 0, 512},		// graph_icon565
+	{32, 32, SPRITE_RGB565, 512, 512},		// sssgraph_icon565
+	{32, 32, SPRITE_RGB565, 1024, 512},		// cyborg_icon565
+	{32, 32, SPRITE_RGB565, 1536, 512},		// race_icon565
+	{32, 32, SPRITE_RGB565, 2048, 512},		// car_icon565
+	{32, 32, SPRITE_RGB565, 2560, 512},		// transceiver_icon565
+	{32, 32, SPRITE_RGB565, 3072, 512},		// calibrate_icon565
+	{32, 32, SPRITE_RGB565, 3584, 512},		// GForce_icon565
+	{32, 33, SPRITE_RGB565, 4096, 528},		// SSD_icon565
+	{32, 32, SPRITE_RGB565, 4624, 512},		// xxSSD_icon565
+	{32, 32, SPRITE_RGB565, 5136, 512},		// clock_icon565
+	{32, 32, SPRITE_MONO, 5648, 32},		// ssd_icon
+	{32, 32, SPRITE_MONO, 5680, 32},		// start_icon
+	{32, 32, SPRITE_MONO, 5712, 32},		// clock_icon
+	{32, 32, SPRITE_MONO, 5744, 32},		// gps_icon
+	{32, 32, SPRITE_MONO, 5776, 32},		// battery_icon
+	{32, 32, SPRITE_MONO, 5808, 32},		// temp_icon
+	{32, 32, SPRITE_MONO, 5840, 32},		// amps_icon
+	{32, 32, SPRITE_MONO, 5872, 32},		// gforce_icon
+	{240, 160, SPRITE_MONO, 5904, 1280},		// BootImage
+	{20, 20, SPRITE_MONO, 7184, 20},		// Key
+	{20, 20, SPRITE_MONO, 7204, 20},		// Unlock
+	{34, 34, SPRITE_MONO, 7224, 68},		// Flag_01
+	{34, 34, SPRITE_MONO, 7292, 68},		// Checkard
+	{295, 125, SPRITE_RGB565, 7360, 18438}		// GPUSA_Logo
+};
+
+constexpr Sprite565 ATLAS_graph_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[0]);
+constexpr Sprite565 ATLAS_sssgraph_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[1]);
+constexpr Sprite565 ATLAS_cyborg_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[2]);
+constexpr Sprite565 ATLAS_race_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[3]);
+constexpr Sprite565 ATLAS_car_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[4]);
+constexpr Sprite565 ATLAS_transceiver_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[5]);
+constexpr Sprite565 ATLAS_calibrate_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[6]);
+constexpr Sprite565 ATLAS_GForce_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[7]);
+constexpr Sprite565 ATLAS_SSD_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[8]);
+constexpr Sprite565 ATLAS_xxSSD_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[9]);
+constexpr Sprite565 ATLAS_clock_icon565 = SpriteHandle<SPRITE_RGB565>(AtlasTable[10]);
+constexpr SpriteMono ATLAS_ssd_icon = SpriteHandle<SPRITE_MONO>(AtlasTable[11]);
+constexpr SpriteMono ATLAS_start_icon = SpriteHandle<SPRITE_MONO>(AtlasTable[12]);
+constexpr SpriteMono ATLAS_clock_icon = SpriteHandle<SPRITE_MONO>(AtlasTable[13]);
+constexpr SpriteMono ATLAS_gps_icon = SpriteHandle<SPRITE_MONO>(AtlasTable[14]);
+constexpr SpriteMono ATLAS_battery_icon = SpriteHandle<SPRITE_MONO>(AtlasTable[15]);
+constexpr SpriteMono ATLAS_temp_icon = SpriteHandle<SPRITE_MONO>(AtlasTable[16]);
+constexpr SpriteMono ATLAS_amps_icon = SpriteHandle<SPRITE_MONO>(AtlasTable[17]);
+constexpr SpriteMono ATLAS_gforce_icon = SpriteHandle<SPRITE_MONO>(AtlasTable[18]);
+constexpr SpriteMono ATLAS_BootImage = SpriteHandle<SPRITE_MONO>(AtlasTable[19]);
+constexpr SpriteMono ATLAS_Key = SpriteHandle<SPRITE_MONO>(AtlasTable[20]);
+constexpr SpriteMono ATLAS_Unlock = SpriteHandle<SPRITE_MONO>(AtlasTable[21]);
+constexpr SpriteMono ATLAS_Flag_01 = SpriteHandle<SPRITE_MONO>(AtlasTable[22]);
+constexpr SpriteMono ATLAS_Checkard = SpriteHandle<SPRITE_MONO>(AtlasTable[23]);
+constexpr Sprite565 ATLAS_GPUSA_Logo = SpriteHandle<SPRITE_RGB565>(AtlasTable[24]);
+
+template <class Display>
+void AtlasDraw(Display &D, int16_t X, int16_t Y, const Sprite565 &S) {
+	SpriteDraw(D, AtlasWords, X, Y, S);
+}
+
+template <class Display>
+void AtlasDraw(Display &D, int16_t X, int16_t Y, const SpriteMono &S, uint16_t Fore, uint16_t Back) {
+	SpriteDraw(D, AtlasWords, X, Y, S, Fore, Back);
+}
+
+#endif
@@ -0,0 +1,64 @@
+/*
+
+	Program name: Bob Jones Patriot Racing packed boot image
+
+	made by PatriotRacing_Tools/BootImagePack from PatriotRacing_Icons.h, don't edit, change the
+	raw image and run it again
+
+*/
+
+#ifndef PATRIOT_RACING_BOOTIMAGE_H
+#define PATRIOT_RACING_BOOTIMAGE_H
+
+#include "PatriotRacing_BootSplash.h"
+
+#ifndef PROGMEM
+ #define PROGMEM
+#endif
+
+// BootImage, 240x160px, 950 bytes (raw 4800)
+static const uint8_t BootImage_packed_data [] PROGMEM = {
+	0xa8, 0xb4, 0x03, 0x80, 0xeb, 0x07, 0x80, 0xe8, 0x04, 0x01, 0x03, 0x80, 0xe8, 0x02, 0x05, 0x02, 0x80, 0xe6, 0x02, 0x06, 0x03, 0x80, 0xe5, 0x02,
+	0x07, 0x02, 0x80, 0xe5, 0x02, 0x07, 0x02, 0x80, 0xe5, 0x02, 0x08, 0x02, 0x80, 0xe3, 0x03, 0x08, 0x02, 0x80, 0xe3, 0x02, 0x09, 0x02, 0x80, 0xe3,
+	0x02, 0x0a, 0x02, 0x80, 0xe2, 0x02, 0x0a, 0x02, 0x80, 0xe2, 0x02, 0x0a, 0x02, 0x80, 0xe2, 0x02, 0x0a, 0x02, 0x80, 0xe2, 0x02, 0x0b, 0x02, 0x80,
+	0xe1, 0x02, 0x0b, 0x02, 0x80, 0xe1, 0x02, 0x0b, 0x02, 0x80, 0xe0, 0x03, 0x0c, 0x02, 0x80, 0xdf, 0x02, 0x0d, 0x02, 0x80, 0xdf, 0x02, 0x0d, 0x02,
+	0x80, 0xdf, 0x02, 0x0d, 0x03, 0x80, 0xde, 0x02, 0x0e, 0x02, 0x80, 0xde, 0x02, 0x0e, 0x02, 0x08, 0x05, 0x80, 0xd1, 0x02, 0x0e, 0x02, 0x07, 0x07,
+	0x80, 0xd0, 0x02, 0x0f, 0x02, 0x05, 0x03, 0x04, 0x02, 0x80, 0xe0, 0x02, 0x05, 0x02, 0x80, 0xbc, 0x07, 0x13, 0x01, 0x10, 0x02, 0x04, 0x03, 0x04,
+	0x0a, 0x80, 0xb0, 0x06, 0x0d, 0x0b, 0x0b, 0x03, 0x03, 0x02, 0x03, 0x0f, 0x80, 0xaf, 0x05, 0x0a, 0x10, 0x09, 0x02, 0x06, 0x13, 0x80, 0x9c, 0x09,
+	0x09, 0x04, 0x08, 0x05, 0x05, 0x0b, 0x06, 0x02, 0x05, 0x16, 0x80, 0xa0, 0x05, 0x08, 0x03, 0x07, 0x03, 0x0b, 0x0b, 0x07, 0x1b, 0x80, 0x9f, 0x06,
+	0x06, 0x03, 0x06, 0x02, 0x0f, 0x2d, 0x80, 0x8c, 0x08, 0x09, 0x0a, 0x02, 0x03, 0x05, 0x01, 0x0a, 0x02, 0x06, 0x2e, 0x80, 0x88, 0x0d, 0x05, 0x0f,
+	0x05, 0x01, 0x08, 0x09, 0x03, 0x2f, 0x80, 0x8e, 0x18, 0x0d, 0x0c, 0x03, 0x31, 0x80, 0x8c, 0x12, 0x11, 0x05, 0x05, 0x04, 0x03, 0x34, 0x1a, 0x08,
+	0x66, 0x08, 0x01, 0x0a, 0x0e, 0x04, 0x09, 0x04, 0x03, 0x42, 0x09, 0x0b, 0x63, 0x07, 0x05, 0x0a, 0x0c, 0x04, 0x0b, 0x03, 0x05, 0x43, 0x05, 0x06,
+	0x01, 0x06, 0x61, 0x06, 0x06, 0x0e, 0x02, 0x01, 0x05, 0x03, 0x0e, 0x03, 0x05, 0x45, 0x0c, 0x04, 0x72, 0x0b, 0x05, 0x02, 0x0f, 0x03, 0x06, 0x46,
+	0x0b, 0x04, 0x67, 0x06, 0x04, 0x0b, 0x04, 0x02, 0x10, 0x03, 0x08, 0x45, 0x0b, 0x03, 0x65, 0x16, 0x04, 0x03, 0x11, 0x02, 0x09, 0x46, 0x0a, 0x03,
+	0x67, 0x13, 0x03, 0x03, 0x12, 0x02, 0x0b, 0x2d, 0x0c, 0x0c, 0x09, 0x03, 0x69, 0x10, 0x04, 0x02, 0x12, 0x03, 0x0d, 0x27, 0x13, 0x0a, 0x09, 0x02,
+	0x6b, 0x0d, 0x04, 0x03, 0x12, 0x03, 0x0f, 0x22, 0x18, 0x09, 0x08, 0x02, 0x6d, 0x0a, 0x05, 0x03, 0x12, 0x03, 0x11, 0x1c, 0x0f, 0x08, 0x06, 0x09,
+	0x07, 0x02, 0x70, 0x05, 0x07, 0x02, 0x14, 0x01, 0x15, 0x14, 0x12, 0x0c, 0x05, 0x09, 0x06, 0x02, 0x80, 0xae, 0x06, 0x18, 0x0f, 0x05, 0x09, 0x05,
+	0x02, 0x80, 0xcb, 0x06, 0x04, 0x07, 0x05, 0x09, 0x03, 0x03, 0x61, 0x07, 0x0a, 0x04, 0x06, 0x0a, 0x02, 0x07, 0x07, 0x04, 0x08, 0x06, 0x06, 0x0a,
+	0x12, 0x05, 0x09, 0x05, 0x04, 0x0a, 0x02, 0x03, 0x60, 0x0a, 0x06, 0x06, 0x05, 0x0a, 0x02, 0x0a, 0x04, 0x05, 0x05, 0x0b, 0x04, 0x0a, 0x11, 0x04,
+	0x0c, 0x04, 0x05, 0x09, 0x02, 0x02, 0x60, 0x0c, 0x04, 0x07, 0x04, 0x0b, 0x01, 0x0b, 0x04, 0x04, 0x04, 0x0d, 0x03, 0x0b, 0x10, 0x04, 0x0d, 0x04,
+	0x05, 0x0a, 0x02, 0x01, 0x60, 0x04, 0x02, 0x05, 0x04, 0x08, 0x07, 0x04, 0x05, 0x04, 0x02, 0x05, 0x03, 0x04, 0x04, 0x06, 0x03, 0x06, 0x05, 0x04,
+	0x13, 0x04, 0x0f, 0x04, 0x04, 0x0b, 0x61, 0x04, 0x03, 0x05, 0x03, 0x09, 0x06, 0x05, 0x04, 0x04, 0x03, 0x05, 0x03, 0x04, 0x02, 0x05, 0x07, 0x05,
+	0x04, 0x04, 0x14, 0x03, 0x10, 0x04, 0x05, 0x0a, 0x60, 0x05, 0x02, 0x05, 0x03, 0x04, 0x02, 0x04, 0x06, 0x04, 0x05, 0x0b, 0x03, 0x04, 0x03, 0x04,
+	0x08, 0x04, 0x04, 0x05, 0x13, 0x03, 0x12, 0x03, 0x05, 0x0b, 0x5f, 0x0b, 0x03, 0x04, 0x02, 0x05, 0x05, 0x04, 0x05, 0x0a, 0x04, 0x05, 0x02, 0x04,
+	0x09, 0x04, 0x04, 0x04, 0x14, 0x03, 0x12, 0x03, 0x05, 0x0c, 0x5d, 0x0a, 0x04, 0x05, 0x02, 0x05, 0x05, 0x04, 0x04, 0x09, 0x06, 0x04, 0x03, 0x04,
+	0x08, 0x04, 0x04, 0x05, 0x13, 0x03, 0x13, 0x03, 0x05, 0x0c, 0x5d, 0x04, 0x09, 0x0d, 0x04, 0x04, 0x05, 0x04, 0x01, 0x04, 0x05, 0x05, 0x02, 0x06,
+	0x05, 0x05, 0x05, 0x04, 0x14, 0x03, 0x13, 0x03, 0x04, 0x0e, 0x5b, 0x04, 0x09, 0x0d, 0x04, 0x05, 0x04, 0x05, 0x01, 0x05, 0x04, 0x04, 0x04, 0x0e,
+	0x05, 0x04, 0x14, 0x03, 0x14, 0x03, 0x04, 0x0e, 0x5b, 0x04, 0x08, 0x04, 0x06, 0x04, 0x04, 0x04, 0x05, 0x04, 0x02, 0x05, 0x03, 0x04, 0x05, 0x0d,
+	0x06, 0x04, 0x14, 0x03, 0x13, 0x03, 0x05, 0x0f, 0x59, 0x04, 0x08, 0x04, 0x07, 0x04, 0x03, 0x04, 0x05, 0x04, 0x03, 0x06, 0x02, 0x04, 0x06, 0x09,
+	0x08, 0x04, 0x15, 0x03, 0x13, 0x03, 0x04, 0x10, 0x80, 0xc3, 0x03, 0x13, 0x03, 0x04, 0x11, 0x6b, 0x0a, 0x09, 0x05, 0x0a, 0x08, 0x02, 0x04, 0x03,
+	0x05, 0x06, 0x05, 0x06, 0x09, 0x05, 0x03, 0x12, 0x03, 0x04, 0x12, 0x6b, 0x0a, 0x08, 0x06, 0x07, 0x0a, 0x02, 0x05, 0x02, 0x06, 0x06, 0x04, 0x05,
+	0x0b, 0x05, 0x03, 0x12, 0x03, 0x04, 0x12, 0x6a, 0x0c, 0x06, 0x07, 0x06, 0x0b, 0x02, 0x04, 0x03, 0x07, 0x04, 0x04, 0x04, 0x07, 0x01, 0x06, 0x04,
+	0x03, 0x11, 0x03, 0x0a, 0x0c, 0x6b, 0x04, 0x03, 0x04, 0x06, 0x08, 0x05, 0x05, 0x05, 0x01, 0x02, 0x04, 0x03, 0x08, 0x04, 0x04, 0x03, 0x05, 0x05,
+	0x03, 0x06, 0x03, 0x10, 0x04, 0x0e, 0x06, 0x6c, 0x04, 0x03, 0x04, 0x06, 0x09, 0x04, 0x04, 0x0a, 0x04, 0x03, 0x09, 0x02, 0x04, 0x03, 0x05, 0x0f,
+	0x04, 0x0e, 0x04, 0x80, 0x81, 0x0a, 0x05, 0x05, 0x01, 0x05, 0x03, 0x04, 0x0a, 0x04, 0x03, 0x04, 0x01, 0x05, 0x01, 0x05, 0x02, 0x05, 0x03, 0x08,
+	0x05, 0x05, 0x0c, 0x04, 0x80, 0x81, 0x09, 0x06, 0x05, 0x02, 0x05, 0x02, 0x05, 0x09, 0x05, 0x03, 0x04, 0x02, 0x09, 0x03, 0x04, 0x04, 0x08, 0x06,
+	0x04, 0x0b, 0x04, 0x80, 0x81, 0x09, 0x06, 0x0d, 0x02, 0x05, 0x09, 0x04, 0x03, 0x04, 0x03, 0x09, 0x02, 0x05, 0x04, 0x07, 0x07, 0x06, 0x07, 0x05,
+	0x80, 0x82, 0x04, 0x01, 0x05, 0x04, 0x0d, 0x03, 0x06, 0x03, 0x02, 0x02, 0x05, 0x02, 0x05, 0x04, 0x07, 0x03, 0x05, 0x05, 0x05, 0x09, 0x10, 0x80,
+	0x82, 0x05, 0x01, 0x05, 0x03, 0x0e, 0x03, 0x0b, 0x02, 0x04, 0x03, 0x04, 0x05, 0x06, 0x05, 0x0d, 0x0b, 0x0d, 0x80, 0x84, 0x04, 0x03, 0x05, 0x01,
+	0x05, 0x06, 0x04, 0x04, 0x09, 0x02, 0x04, 0x03, 0x05, 0x06, 0x05, 0x05, 0x0b, 0x0f, 0x09, 0x80, 0x86, 0x03, 0x04, 0x05, 0x01, 0x03, 0x08, 0x04,
+	0x06, 0x06, 0x03, 0x04, 0x03, 0x04, 0x07, 0x04, 0x08, 0x06, 0x14, 0x05, 0xa8, 0x9d
+};
+const PackedMono BootImage_packed = {240, 160, BootImage_packed_data, 950};
+
+#endif
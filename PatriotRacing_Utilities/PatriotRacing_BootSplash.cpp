@@ -0,0 +1,73 @@
+#include "PatriotRacing_BootSplash.h"
+#include "PatriotRacing_RenderTrace.h"
+
+BootSplash::BootSplash() {
+
+	Image = NULL;
+	Next = NULL;
+	End = NULL;
+	X = 0;
+	Y = 0;
+	Color[0] = 0;
+	Color[1] = 0;
+	Which = 1;
+	Left = 0;
+	Row = 0;
+}
+
+void BootSplash::Begin(const PackedMono &Image, int16_t X, int16_t Y, uint16_t Fore, uint16_t Back) {
+
+	this->Image = &Image;
+	this->X = X;
+	this->Y = Y;
+	Color[0] = Back;
+	Color[1] = Fore;
+	Next = Image.Data;
+	End = Image.Data + Image.Bytes;
+	RenderTraceAsset(Image.Data);
+	// the first run read flips this to Back
+	Which = 1;
+	Left = 0;
+	Row = 0;
+}
+
+bool BootSplash::Done() const {
+	return (Image == NULL) || (Row >= Image->Height);
+}
+
+uint32_t BootSplash::Read(uint16_t *Out, uint32_t Count) {
+
+	uint32_t done = 0;
+	uint16_t n, i, color;
+
+	if (Image == NULL) {
+		return 0;
+	}
+
+	while (done < Count) {
+
+		while (Left == 0) {
+			if (Next >= End) {
+				return done;
+			}
+			Which ^= 1;
+			if (*Next & BOOTSPLASH_LONG) {
+				Left = ((Next[0] & ~BOOTSPLASH_LONG) << 8) | Next[1];
+				Next += 2;
+			}
+			else {
+				Left = *Next++;
+			}
+		}
+
+		n = (Count - done < Left) ? Count - done : Left;
+		color = Color[Which];
+		for (i = 0; i < n; i++) {
+			Out[done + i] = color;
+		}
+		done += n;
+		Left -= n;
+	}
+
+	return done;
+}
@@ -0,0 +1,126 @@
+/*
+
+	Program name: Bob Jones Patriot Racing boot splash
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, run length boot image drawn in bands between the init steps
+	1.1    Kris 	10/19/2026	Begin reports to the render trace
+
+*/
+
+#ifndef PATRIOT_RACING_BOOTSPLASH_H
+#define PATRIOT_RACING_BOOTSPLASH_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+
+#define BOOTSPLASH_VERSION 1.1
+
+/*
+
+BootImage (PatriotRacing_Icons.h) is 240 x 160 at 1 bit a pixel, 4800 bytes and not PROGMEM, and it
+went out a pixel at a time at power on with everything else waiting on it. a PackedMono is the same
+picture as run lengths, alternating Back and Fore starting with Back (a 0 length first run when it
+starts with Fore)
+
+	run < 128       one byte
+	run >= 128      two bytes, 0x80 | the high 7 bits, then the low 8 (up to 32767)
+
+longer runs are split with a 0 length run of the other color between them
+
+BootSplash decodes BOOTSPLASH_BAND pixels (whole rows) at a time into a buffer on the stack and
+writeRects the band, so the panel gets a few big bursts. Step draws one band and returns, so setup
+can start a sensor between bands:
+
+	Splash.Begin(BootImage_packed, 40, 40, C_WHITE, C_BLACK);
+	while (Splash.Step(Display)) {
+		// next bit of init
+	}
+
+PatriotRacing_Tools/BootImagePack makes the tables (PatriotRacing_BootImage.h)
+
+*/
+
+#define BOOTSPLASH_BAND 1920         // pixels per writeRect, 8 rows of the boot image
+#define BOOTSPLASH_LONG 0x80         // first byte of a two byte run
+#define BOOTSPLASH_MAX_RUN 32767
+
+struct PackedMono {
+	uint16_t Width;
+	uint16_t Height;
+	const uint8_t *Data;
+	uint32_t Bytes;
+};
+
+class BootSplash {
+
+public:
+
+	BootSplash();
+
+	void Begin(const PackedMono &Image, int16_t X, int16_t Y, uint16_t Fore, uint16_t Back);
+
+	// draws the next band, false once the whole picture is out
+	template <class Display>
+	bool Step(Display &D);
+
+	// all of it
+	template <class Display>
+	void Draw(Display &D);
+
+	bool Done() const;
+
+	// fills Out with up to Count pixels, returns how many (0 at the end)
+	uint32_t Read(uint16_t *Out, uint32_t Count);
+
+private:
+
+	const PackedMono *Image;
+	const uint8_t *Next;
+	const uint8_t *End;
+	int16_t X;
+	int16_t Y;
+	uint16_t Color[2];           // Back, Fore
+	uint8_t Which;               // color of the current run
+	uint16_t Left;               // pixels left in it
+	uint16_t Row;                // next row to draw
+
+};
+
+template <class Display>
+bool BootSplash::Step(Display &D) {
+
+	uint16_t band[BOOTSPLASH_BAND];
+	uint16_t rows, n;
+
+	if (Done()) {
+		return false;
+	}
+	rows = BOOTSPLASH_BAND / Image->Width;
+	if (rows == 0) {
+		// wider than a band
+		Row = Image->Height;
+		return false;
+	}
+
+	n = (Image->Height - Row < rows) ? Image->Height - Row : rows;
+	Read(band, (uint32_t) n * Image->Width);
+	D.writeRect(X, Y + Row, Image->Width, n, band);
+	Row += n;
+
+	return !Done();
+}
+
+template <class Display>
+void BootSplash::Draw(Display &D) {
+
+	while (Step(D)) {
+	}
+}
+
+#endif
@@ -0,0 +1,123 @@
+#include "PatriotRacing_Font.h"
+#include "PatriotRacing_RenderTrace.h"
+
+bool FontGetGlyph(const ILI9341_t3_font_t &Font, uint16_t Code, FontGlyph &Glyph) {
+
+	uint32_t bit, offset;
+	const uint8_t *data;
+
+	if ((Code >= Font.index1_first) && (Code <= Font.index1_last)) {
+		bit = (uint32_t) (Code - Font.index1_first) * Font.bits_index;
+	}
+	else if ((Code >= Font.index2_first) && (Code <= Font.index2_last) && (Font.index2_last > 0)) {
+		bit = (uint32_t) (Code - Font.index2_first + Font.index1_last - Font.index1_first + 1) * Font.bits_index;
+	}
+	else {
+		return false;
+	}
+
+	offset = FontFetchBits(Font.index, bit, Font.bits_index);
+	data = Font.data + offset;
+
+	// only encoding 0 has ever been defined
+	if (FontFetchBits(data, 0, 3) != 0) {
+		return false;
+	}
+
+	bit = 3;
+	Glyph.Data = data;
+	Glyph.Code = Code;
+	Glyph.Width = FontFetchBits(data, bit, Font.bits_width);
+	bit += Font.bits_width;
+	Glyph.Height = FontFetchBits(data, bit, Font.bits_height);
+	bit += Font.bits_height;
+	Glyph.XOffset = FontFetchSigned(data, bit, Font.bits_xoffset);
+	bit += Font.bits_xoffset;
+	Glyph.YOffset = FontFetchSigned(data, bit, Font.bits_yoffset);
+	bit += Font.bits_yoffset;
+	Glyph.Delta = FontFetchBits(data, bit, Font.bits_delta);
+	bit += Font.bits_delta;
+	Glyph.Bits = bit;
+
+	RenderTraceGlyph(&Font, Code);
+	return true;
+}
+
+int16_t FontDrawChar(FontCanvas &Canvas, const ILI9341_t3_font_t &Font, int16_t X, int16_t Y, uint16_t Code, uint16_t Color) {
+
+	FontGlyph g;
+
+	if (!FontGetGlyph(Font, Code, g)) {
+		return 0;
+	}
+	return FontDrawGlyph(Canvas, Font, X, Y, g, Color);
+}
+
+int16_t FontDrawGlyph(FontCanvas &Canvas, const ILI9341_t3_font_t &Font, int16_t X, int16_t Y, const FontGlyph &Glyph, uint16_t Color) {
+
+	int16_t left, top;
+
+	left = X + Glyph.XOffset;
+	top = Y + FontGlyphTop(Font, Glyph);
+
+	FontDecode(Font, Glyph, [&](uint16_t x, uint16_t y, uint16_t length, uint16_t rows, uint8_t alpha) {
+
+		int16_t x0 = left + x;
+		int16_t x1 = x0 + length;
+		int16_t y0 = top + y;
+		int16_t y1 = y0 + rows;
+		int16_t i, j;
+		uint16_t *p;
+
+		// clip to the canvas
+		if (x0 < 0) {
+			x0 = 0;
+		}
+		if (y0 < 0) {
+			y0 = 0;
+		}
+		if (x1 > Canvas.Width) {
+			x1 = Canvas.Width;
+		}
+		if (y1 > Canvas.Height) {
+			y1 = Canvas.Height;
+		}
+
+		for (j = y0; j < y1; j++) {
+			p = Canvas.Pixels + (int32_t) j * Canvas.Stride;
+			if (alpha == FONT_ALPHA_SOLID) {
+				for (i = x0; i < x1; i++) {
+					p[i] = Color;
+				}
+			}
+			else {
+				for (i = x0; i < x1; i++) {
+					p[i] = FontBlend565(Color, p[i], alpha);
+				}
+			}
+		}
+	});
+
+	return Glyph.Delta;
+}
+
+int16_t FontDrawString(FontCanvas &Canvas, const ILI9341_t3_font_t &Font, int16_t X, int16_t Y, const char *Text, uint16_t Color) {
+
+	while (*Text) {
+		X += FontDrawChar(Canvas, Font, X, Y, (uint8_t) *Text++, Color);
+	}
+	return X;
+}
+
+int16_t FontStringWidth(const ILI9341_t3_font_t &Font, const char *Text) {
+
+	FontGlyph g;
+	int16_t w = 0;
+
+	while (*Text) {
+		if (FontGetGlyph(Font, (uint8_t) *Text++, g)) {
+			w += g.Delta;
+		}
+	}
+	return w;
+}
@@ -0,0 +1,217 @@
+/*
+
+	Program name: Bob Jones Patriot Racing font decoder
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, ILI9341_t3 font decoder and RGB565 rasterizer
+	1.1    Kris 	10/19/2026	constexpr bit fetches for PatriotRacing_FontTable, FontDrawGlyph
+	1.2    Kris 	10/19/2026	FontGetGlyph reports to the render trace
+
+*/
+
+#ifndef PATRIOT_RACING_FONT_H
+#define PATRIOT_RACING_FONT_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include <ILI9341_t3.h>
+
+#define FONT_VERSION 1.2
+
+/*
+
+our own reader for the ILI9341_t3_font_t tables (Arial_100BINO, Arial_100_BINO, Arial_48BINO ...)
+so glyph drawing can be measured and sped up on the PC, and so later code can pre decode glyphs
+instead of bit walking the font on every draw
+
+the format, all fields are bit packed msb first:
+	index   one bits_index wide offset into data per char (index1 range then index2 range)
+	glyph   3 bit encoding (0), width, height, xoffset (signed), yoffset (signed), delta
+	rows    version 1: 1 bit per row, 0 = one row of width bits follows,
+	        1 = 3 bit repeat (n + 2) then one row of width bits used for n rows
+	        version 23 (anti aliased, ILI9341_t3n): starts on a byte, then width x height pixels
+	        of 1 << reserved bits each, no row repeats
+
+the glyph bitmap's top left is at (cursor x + xoffset, cursor y + cap_height - height - yoffset),
+the cursor moves by delta
+
+FontDecode hands back horizontal runs of the same alpha, a run can cover several rows when the font
+repeats a row, which is what makes the big digits cheap to draw as rectangles
+
+*/
+
+#define FONT_ALPHA_SOLID 255
+
+struct FontGlyph {
+	const uint8_t *Data;		// start of the glyph in the font data
+	uint32_t Bits;				// bit offset of the first row (from Data)
+	uint16_t Code;
+	uint8_t Width;
+	uint8_t Height;
+	int8_t XOffset;
+	int8_t YOffset;
+	uint8_t Delta;				// cursor advance
+};
+
+// what the rasterizer draws into, 16 bit RGB565 pixels, Stride in pixels
+struct FontCanvas {
+	uint16_t *Pixels;
+	int16_t Width;
+	int16_t Height;
+	int16_t Stride;
+};
+
+static inline constexpr uint32_t FontFetchBit(const uint8_t *p, uint32_t Index) {
+	return (p[Index >> 3] >> (7 - (Index & 7))) & 1;
+}
+
+static inline constexpr uint32_t FontFetchBits(const uint8_t *p, uint32_t Index, uint8_t Count) {
+
+	uint32_t val = 0;
+	uint8_t i = 0;
+
+	// whole bytes when we're aligned, that's most of the pixel rows
+	while ((Count >= 8) && ((Index & 7) == 0)) {
+		val = (val << 8) | p[Index >> 3];
+		Index += 8;
+		Count -= 8;
+	}
+	for (i = 0; i < Count; i++) {
+		val = (val << 1) | FontFetchBit(p, Index + i);
+	}
+	return val;
+}
+
+static inline constexpr int32_t FontFetchSigned(const uint8_t *p, uint32_t Index, uint8_t Count) {
+
+	uint32_t val = FontFetchBits(p, Index, Count);
+
+	if (val & (1UL << (Count - 1))) {
+		return (int32_t) val - (int32_t) (1UL << Count);
+	}
+	return (int32_t) val;
+}
+
+// true if the font has the char, fills in Glyph
+bool FontGetGlyph(const ILI9341_t3_font_t &Font, uint16_t Code, FontGlyph &Glyph);
+
+// y of the glyph bitmap's top row relative to the cursor
+static inline int16_t FontGlyphTop(const ILI9341_t3_font_t &Font, const FontGlyph &Glyph) {
+	return Font.cap_height - Glyph.Height - Glyph.YOffset;
+}
+
+// bits per pixel of the glyph bitmaps
+static inline uint8_t FontBPP(const ILI9341_t3_font_t &Font) {
+	return (Font.version == 23) ? (1 << Font.reserved) : 1;
+}
+
+/*
+	walks the glyph and calls Run(x, y, length, rows, alpha) for every horizontal run of the same
+	non zero alpha, x and y are from the top left of the glyph bitmap, rows is how many rows the run
+	covers (more than 1 only for repeated rows in version 1 fonts)
+*/
+template <class RunFunc>
+void FontDecode(const ILI9341_t3_font_t &Font, const FontGlyph &Glyph, RunFunc &&Run) {
+
+	const uint8_t *data = Glyph.Data;
+	uint32_t bit = Glyph.Bits;
+	uint16_t y = 0;
+	uint16_t rows, x, start;
+	uint8_t bpp, mask, alpha, prev, v;
+
+	if (Font.version == 1) {
+		while (y < Glyph.Height) {
+			rows = 1;
+			if (FontFetchBit(data, bit++)) {
+				rows = FontFetchBits(data, bit, 3) + 2;
+				bit += 3;
+			}
+			start = 0;
+			prev = 0;
+			for (x = 0; x < Glyph.Width; x++) {
+				v = FontFetchBit(data, bit + x);
+				if (v != prev) {
+					if (v) {
+						start = x;
+					}
+					else {
+						Run(start, y, x - start, rows, FONT_ALPHA_SOLID);
+					}
+					prev = v;
+				}
+			}
+			if (prev) {
+				Run(start, y, Glyph.Width - start, rows, FONT_ALPHA_SOLID);
+			}
+			bit += Glyph.Width;
+			y += rows;
+		}
+		return;
+	}
+
+	if (Font.version == 23) {
+		bpp = FontBPP(Font);
+		mask = (1 << bpp) - 1;
+		bit = (bit + 7) & ~7UL;
+		for (y = 0; y < Glyph.Height; y++) {
+			start = 0;
+			prev = 0;
+			for (x = 0; x < Glyph.Width; x++) {
+				v = FontFetchBits(data, bit, bpp);
+				bit += bpp;
+				if (v != prev) {
+					if (prev) {
+						alpha = (uint16_t) prev * FONT_ALPHA_SOLID / mask;
+						Run(start, y, x - start, 1, alpha);
+					}
+					start = x;
+					prev = v;
+				}
+			}
+			if (prev) {
+				alpha = (uint16_t) prev * FONT_ALPHA_SOLID / mask;
+				Run(start, y, Glyph.Width - start, 1, alpha);
+			}
+		}
+	}
+}
+
+// blends Color over Back, Alpha 0 - 255
+static inline uint16_t FontBlend565(uint16_t Color, uint16_t Back, uint8_t Alpha) {
+
+	uint32_t fg, bg;
+
+	if (Alpha == FONT_ALPHA_SOLID) {
+		return Color;
+	}
+	if (Alpha == 0) {
+		return Back;
+	}
+	// green moves to the top half so red, green and blue have room to blend in one multiply
+	fg = (Color | ((uint32_t) Color << 16)) & 0x07E0F81F;
+	bg = (Back | ((uint32_t) Back << 16)) & 0x07E0F81F;
+	Alpha >>= 3;
+	bg += ((fg - bg) * Alpha) >> 5;
+	bg &= 0x07E0F81F;
+	return (uint16_t) (bg | (bg >> 16));
+}
+
+// draws one char with the cursor at X, Y (top of the line), transparent background
+// returns the cursor advance, 0 if the font doesn't have the char
+int16_t FontDrawChar(FontCanvas &Canvas, const ILI9341_t3_font_t &Font, int16_t X, int16_t Y, uint16_t Code, uint16_t Color);
+
+// same, for a glyph already looked up (FontGetGlyph or a FontTable), returns the advance
+int16_t FontDrawGlyph(FontCanvas &Canvas, const ILI9341_t3_font_t &Font, int16_t X, int16_t Y, const FontGlyph &Glyph, uint16_t Color);
+
+// draws a string, returns the x after the last char
+int16_t FontDrawString(FontCanvas &Canvas, const ILI9341_t3_font_t &Font, int16_t X, int16_t Y, const char *Text, uint16_t Color);
+
+// width in pixels the string would take (sum of the advances)
+int16_t FontStringWidth(const ILI9341_t3_font_t &Font, const char *Text);
+
+#endif
@@ -0,0 +1,116 @@
+#include "PatriotRacing_FontRamp.h"
+
+FontRamp::FontRamp() {
+
+	Hits = 0;
+	Misses = 0;
+	Invalidate();
+}
+
+const uint16_t *FontRamp::Get(uint16_t NewFore, uint16_t NewBack) {
+
+	uint8_t i, oldest = 0;
+
+	Clock++;
+	for (i = 0; i < FONTRAMP_ENTRIES; i++) {
+		if ((Used[i] != 0) && (Fore[i] == NewFore) && (Back[i] == NewBack)) {
+			Used[i] = Clock;
+			Hits++;
+			return Ramp[i];
+		}
+		if (Used[i] < Used[oldest]) {
+			oldest = i;
+		}
+	}
+
+	Misses++;
+	Fore[oldest] = NewFore;
+	Back[oldest] = NewBack;
+	for (i = 0; i < FONTRAMP_LEVELS; i++) {
+		Ramp[oldest][i] = FontBlend565(NewFore, NewBack, i * FONTRAMP_STEP);
+	}
+	Used[oldest] = Clock;
+	return Ramp[oldest];
+}
+
+int16_t FontRamp::DrawChar(FontCanvas &Canvas, const ILI9341_t3_font_t &Font, int16_t X, int16_t Y, uint16_t Code, uint16_t Color, uint16_t Behind) {
+
+	FontGlyph g;
+	int16_t left, top, row, x0, x1, x;
+	const uint16_t *ramp;
+	uint16_t *p;
+	uint32_t bit, b;
+	uint8_t bpp, mask, scale, v, y;
+
+	// version 1 is all solid, and an 8 bit font has more levels than a ramp
+	bpp = FontBPP(Font);
+	if ((Font.version != 23) || (bpp > 4)) {
+		return FontDrawChar(Canvas, Font, X, Y, Code, Color);
+	}
+	if (!FontGetGlyph(Font, Code, g)) {
+		return 0;
+	}
+
+	left = X + g.XOffset;
+	top = Y + FontGlyphTop(Font, g);
+	ramp = Get(Color, Behind);
+	mask = (1 << bpp) - 1;
+	scale = (FONTRAMP_LEVELS - 1) / mask;		// pixel value to ramp level, 15 / 5 / 1 for 1 / 2 / 4 bits
+
+	// clip the columns once, the rows as we go
+	x0 = (left < 0) ? -left : 0;
+	x1 = (left + g.Width > Canvas.Width) ? Canvas.Width - left : g.Width;
+
+	// pixels start on a byte and 1, 2 or 4 bits never straddle one, so each is a shift and a mask
+	bit = (g.Bits + 7) & ~7UL;
+	for (y = 0; y < g.Height; y++, bit += (uint32_t) g.Width * bpp) {
+		row = top + y;
+		if ((row < 0) || (row >= Canvas.Height)) {
+			continue;
+		}
+		p = Canvas.Pixels + (int32_t) row * Canvas.Stride + left;
+		for (x = x0, b = bit + x0 * bpp; x < x1; x++, b += bpp) {
+			v = (g.Data[b >> 3] >> (8 - bpp - (b & 7))) & mask;
+			if (v == 0) {
+				continue;
+			}
+			// the ramp has it unless something other than the background is under the pixel
+			if (p[x] == Behind) {
+				p[x] = ramp[v * scale];
+			}
+			else {
+				p[x] = FontBlend565(Color, p[x], v * scale * FONTRAMP_STEP);
+			}
+		}
+	}
+
+	return g.Delta;
+}
+
+int16_t FontRamp::DrawString(FontCanvas &Canvas, const ILI9341_t3_font_t &Font, int16_t X, int16_t Y, const char *Text, uint16_t Color, uint16_t Behind) {
+
+	while (*Text) {
+		X += DrawChar(Canvas, Font, X, Y, (uint8_t) *Text++, Color, Behind);
+	}
+	return X;
+}
+
+void FontRamp::Invalidate() {
+
+	uint8_t i;
+
+	for (i = 0; i < FONTRAMP_ENTRIES; i++) {
+		Fore[i] = 0;
+		Back[i] = 0;
+		Used[i] = 0;
+	}
+	Clock = 0;
+}
+
+uint32_t FontRamp::GetHits() const {
+	return Hits;
+}
+
+uint32_t FontRamp::GetMisses() const {
+	return Misses;
+}
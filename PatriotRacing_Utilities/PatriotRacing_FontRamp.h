@@ -0,0 +1,83 @@
+/*
+
+	Program name: Bob Jones Patriot Racing font blend ramps
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, 16 level blend ramps cached per text / background color pair
+
+*/
+
+#ifndef PATRIOT_RACING_FONTRAMP_H
+#define PATRIOT_RACING_FONTRAMP_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include "PatriotRacing_Font.h"
+
+#define FONTRAMP_VERSION 1.0
+
+/*
+
+FontDrawChar blends every edge pixel of an anti aliased font with FontBlend565, a mask, a multiply
+and a shift per pixel, and a 4 bit font is mostly edge pixels, runs of one or two. but a 1, 2 or 4
+bit font only has 16 alphas at most (FontDecode hands back level * 17: 0, 17, 34 ... 255), so for a
+given text color and background there are only 16 colors a pixel can come out as
+
+a ramp is those 16 colors, FontBlend565(Fore, Back, level * 17), worked out once. FontRamp keeps the
+last FONTRAMP_ENTRIES color pairs used (32 bytes each), the least recently used one is rebuilt when
+a new pair comes along, so the screen's handful of text colors (readouts, warnings, the menu bar)
+all stay cached
+
+DrawChar / DrawString are FontDrawChar / FontDrawString for text over a known background. a 1, 2
+or 4 bit version 23 glyph is walked a pixel at a time instead of in runs (FontDecode fetches the
+pixel bits one at a time and divides for every run's alpha) and the pixel value indexes the ramp,
+the inner loop is a shift, a mask and a lookup. a pixel that isn't the background any more (glyphs
+that overlap, text over a chart) still gets blended, so the result is the same as FontDrawChar
+pixel for pixel. version 1 fonts (all solid) and 8 bit fonts go straight to FontDrawChar
+
+themed text goes through here too, PatriotRacing_Theme only keeps tables for the icons
+
+*/
+
+#define FONTRAMP_ENTRIES 8           // color pairs cached
+#define FONTRAMP_LEVELS 16           // alphas a 4 bit font has
+#define FONTRAMP_STEP (FONT_ALPHA_SOLID / (FONTRAMP_LEVELS - 1))      // 17, alpha of one level
+
+class FontRamp {
+
+public:
+
+	FontRamp();
+
+	// the 16 colors of NewFore over NewBack, level 0 is NewBack and 15 is NewFore
+	const uint16_t *Get(uint16_t NewFore, uint16_t NewBack);
+
+	// same as FontDrawChar / FontDrawString, Behind is the background color the text goes over
+	int16_t DrawChar(FontCanvas &Canvas, const ILI9341_t3_font_t &Font, int16_t X, int16_t Y, uint16_t Code, uint16_t Color, uint16_t Behind);
+	int16_t DrawString(FontCanvas &Canvas, const ILI9341_t3_font_t &Font, int16_t X, int16_t Y, const char *Text, uint16_t Color, uint16_t Behind);
+
+	// drop every ramp
+	void Invalidate();
+
+	uint32_t GetHits() const;
+	uint32_t GetMisses() const;
+
+private:
+
+	// Used is when the pair was last asked for, the lowest goes first
+	uint16_t Fore[FONTRAMP_ENTRIES];
+	uint16_t Back[FONTRAMP_ENTRIES];
+	uint16_t Ramp[FONTRAMP_ENTRIES][FONTRAMP_LEVELS];
+	uint32_t Used[FONTRAMP_ENTRIES];
+	uint32_t Clock;
+	uint32_t Hits;
+	uint32_t Misses;
+
+};
+
+#endif
@@ -0,0 +1,32 @@
+#include "PatriotRacing_FontTable.h"
+
+int16_t FontTableDrawChar(FontCanvas &Canvas, const FontTable &Table, int16_t X, int16_t Y, uint16_t Code, uint16_t Color) {
+
+	FontGlyph g;
+
+	if (!FontTableGlyph(Table, Code, g)) {
+		return 0;
+	}
+	return FontDrawGlyph(Canvas, *Table.Font, X, Y, g, Color);
+}
+
+int16_t FontTableDrawString(FontCanvas &Canvas, const FontTable &Table, int16_t X, int16_t Y, const char *Text, uint16_t Color) {
+
+	while (*Text) {
+		X += FontTableDrawChar(Canvas, Table, X, Y, (uint8_t) *Text++, Color);
+	}
+	return X;
+}
+
+int16_t FontTableStringWidth(const FontTable &Table, const char *Text) {
+
+	FontGlyph g;
+	int16_t w = 0;
+
+	while (*Text) {
+		if (FontTableGlyph(Table, (uint8_t) *Text++, g)) {
+			w += g.Delta;
+		}
+	}
+	return w;
+}
@@ -0,0 +1,194 @@
+/*
+
+	Program name: Bob Jones Patriot Racing flat glyph tables
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, the packed font index expanded at compile time
+	1.1    Kris 	10/19/2026	FontTableGlyph reports to the render trace
+	1.2    Kris 	10/19/2026	Name_table is declared in its own Name_table.h, the plain font .h is as it was
+
+*/
+
+#ifndef PATRIOT_RACING_FONTTABLE_H
+#define PATRIOT_RACING_FONTTABLE_H
+
+// FontTableBuild and the FontFetchBits it calls are loops in constexpr functions
+#if __cplusplus < 201402L
+ #error "PatriotRacing_FontTable.h needs -std=gnu++14 or later"
+#endif
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include "PatriotRacing_Font.h"
+#include "PatriotRacing_RenderTrace.h"
+
+#define FONTTABLE_VERSION 1.2
+
+/*
+
+FontGetGlyph finds a glyph by pulling a bits_index wide entry out of the packed index, then pulls
+the 3 bit encoding, width, height, xoffset, yoffset and delta out of the glyph header a few bits at
+a time, all before the first pixel gets drawn, and it does it again every time the char is drawn
+
+a FontTable is the same thing worked out by the compiler. FontTableBuild walks the packed index
+and every glyph header in a constexpr function, so each font ends up with a flat array in flash,
+one 12 byte entry per char code (byte offset of the glyph, where its rows start, the metrics),
+and finding a glyph is one array load
+
+each font .cpp ends with FONTTABLE(Name), which builds the table from the font right there (the
+font data is static, only that file can see it) and defines Name_table. Name_table.h declares it,
+the plain Name.h only has the font, so code that just draws with ILI9341_t3 doesn't pull this in.
+FontCompiler writes all three
+
+this needs gnu++14 (what Teensyduino builds with). the font .cpp only builds its table when the
+compiler is gnu++14 or later, so a gnu++11 build still has every font, just no Name_table
+
+the flat table costs 12 bytes a char code against a few bits a char for the packed index, about
+1.1k for a full 32 - 126 font. a build that's short on flash defines FONTTABLE_PACKED, the flat
+arrays aren't emitted, Name_table still exists and FontTableGlyph goes back to FontGetGlyph, so
+nothing that uses the tables has to change. the packed index is always there either way, it's
+what ILI9341_t3 draws with
+
+	#include "Arial_100_BINO_table.h"
+
+	FontGlyph g;
+	if (FontTableGlyph(Arial_100_BINO_table, '5', g)) ...
+	FontTableDrawString(Canvas, Arial_100_BINO_table, 10, 10, "25.4", C_WHITE);
+
+*/
+
+#define FONTTABLE_NONE 0xFFFFFFFF        // Offset of a char the font doesn't have
+
+struct FontTableEntry {
+	uint32_t Offset;			// byte offset of the glyph in the font data, FONTTABLE_NONE if missing
+	uint8_t Width;
+	uint8_t Height;
+	int8_t XOffset;
+	int8_t YOffset;
+	uint8_t Delta;
+	uint8_t Rows;				// bit offset of the first row from the start of the glyph
+};
+
+struct FontTable {
+	const ILI9341_t3_font_t *Font;
+	const FontTableEntry *Glyph;		// Count entries from First, NULL with FONTTABLE_PACKED
+	uint16_t First;
+	uint16_t Count;
+};
+
+// the entries as the constexpr functions hand them back, arrays can't be returned on their own
+template <uint16_t N>
+struct FontTableEntries {
+	FontTableEntry Glyph[N];
+};
+
+// first and last char codes the index covers, index2 can be empty
+static inline constexpr uint16_t FontTableFirst(const ILI9341_t3_font_t &Font) {
+	return Font.index1_first;
+}
+
+static inline constexpr uint16_t FontTableCount(const ILI9341_t3_font_t &Font) {
+	return ((Font.index2_last > 0) ? Font.index2_last : Font.index1_last) - Font.index1_first + 1;
+}
+
+// the same walk as FontGetGlyph, for every code from FontTableFirst, done by the compiler
+template <uint16_t N>
+constexpr FontTableEntries<N> FontTableBuild(const ILI9341_t3_font_t &Font) {
+
+	FontTableEntries<N> table = {};
+	const uint8_t *data = NULL;
+	uint32_t bit = 0;
+	uint16_t code = 0;
+	uint16_t i = 0;
+	bool have = false;
+
+	for (i = 0; i < N; i++) {
+		FontTableEntry &e = table.Glyph[i];
+
+		code = Font.index1_first + i;
+		have = true;
+		if (code <= Font.index1_last) {
+			bit = (uint32_t) i * Font.bits_index;
+		}
+		else if ((code >= Font.index2_first) && (code <= Font.index2_last)) {
+			bit = (uint32_t) (code - Font.index2_first + Font.index1_last - Font.index1_first + 1) * Font.bits_index;
+		}
+		else {
+			have = false;
+		}
+
+		e.Offset = FONTTABLE_NONE;
+		if (have) {
+			data = Font.data + FontFetchBits(Font.index, bit, Font.bits_index);
+			// only encoding 0 has ever been defined
+			if (FontFetchBits(data, 0, 3) == 0) {
+				bit = 3;
+				e.Offset = data - Font.data;
+				e.Width = FontFetchBits(data, bit, Font.bits_width);
+				bit += Font.bits_width;
+				e.Height = FontFetchBits(data, bit, Font.bits_height);
+				bit += Font.bits_height;
+				e.XOffset = FontFetchSigned(data, bit, Font.bits_xoffset);
+				bit += Font.bits_xoffset;
+				e.YOffset = FontFetchSigned(data, bit, Font.bits_yoffset);
+				bit += Font.bits_yoffset;
+				e.Delta = FontFetchBits(data, bit, Font.bits_delta);
+				bit += Font.bits_delta;
+				e.Rows = bit;
+			}
+		}
+	}
+	return table;
+}
+
+// what goes at the end of a font .cpp, the font has to be constexpr for the compiler to read it
+#ifndef FONTTABLE_PACKED
+ #define FONTTABLE(Name) \
+	static constexpr FontTableEntries<FontTableCount(Name)> Name##_entries = FontTableBuild<FontTableCount(Name)>(Name); \
+	const FontTable Name##_table = {&Name, Name##_entries.Glyph, FontTableFirst(Name), FontTableCount(Name)};
+#else
+ #define FONTTABLE(Name) \
+	const FontTable Name##_table = {&Name, NULL, 0, 0};
+#endif
+
+// true if the font has the char, fills in Glyph the same as FontGetGlyph
+static inline bool FontTableGlyph(const FontTable &Table, uint16_t Code, FontGlyph &Glyph) {
+
+	const FontTableEntry *e;
+
+	if (Table.Glyph == NULL) {
+		return FontGetGlyph(*Table.Font, Code, Glyph);
+	}
+	if ((uint16_t) (Code - Table.First) >= Table.Count) {
+		return false;
+	}
+
+	e = &Table.Glyph[Code - Table.First];
+	if (e->Offset == FONTTABLE_NONE) {
+		return false;
+	}
+	Glyph.Data = Table.Font->data + e->Offset;
+	Glyph.Bits = e->Rows;
+	Glyph.Code = Code;
+	Glyph.Width = e->Width;
+	Glyph.Height = e->Height;
+	Glyph.XOffset = e->XOffset;
+	Glyph.YOffset = e->YOffset;
+	Glyph.Delta = e->Delta;
+	RenderTraceGlyph(Table.Font, Code);
+	return true;
+}
+
+// FontDrawChar / FontDrawString with the glyphs found through the table
+int16_t FontTableDrawChar(FontCanvas &Canvas, const FontTable &Table, int16_t X, int16_t Y, uint16_t Code, uint16_t Color);
+int16_t FontTableDrawString(FontCanvas &Canvas, const FontTable &Table, int16_t X, int16_t Y, const char *Text, uint16_t Color);
+
+// width in pixels the string would take (sum of the advances)
+int16_t FontTableStringWidth(const FontTable &Table, const char *Text);
+
+#endif
@@ -0,0 +1,195 @@
+#include "PatriotRacing_GlyphCache.h"
+
+#define NO_RECORD 0xFFFF
+
+GlyphCache::GlyphCache() {
+
+	memset(Lookup, GLYPHCACHE_NONE, sizeof(Lookup));
+	Count = 0;
+	Used = 0;
+	Height = 0;
+	BPP = 1;
+	memset(Palette, 0, sizeof(Palette));
+}
+
+bool GlyphCache::Begin(const ILI9341_t3_font_t &Font, const char *Chars, uint16_t Fore, uint16_t Back) {
+
+	const char *c;
+	FontGlyph g;
+	bool ok = true;
+
+	memset(Lookup, GLYPHCACHE_NONE, sizeof(Lookup));
+	Count = 0;
+	Used = 0;
+	Height = 0;
+	BPP = FontBPP(Font);
+
+	// every cell is as tall as the tallest glyph so any digit fully covers any other
+	for (c = Chars; *c; c++) {
+		if (FontGetGlyph(Font, (uint8_t) *c, g) && (FontGlyphTop(Font, g) + g.Height > Height)) {
+			Height = FontGlyphTop(Font, g) + g.Height;
+		}
+	}
+
+	for (c = Chars; *c; c++) {
+		if (((uint8_t) *c >= 128) || (Lookup[(uint8_t) *c] != GLYPHCACHE_NONE)) {
+			continue;
+		}
+		if (!FontGetGlyph(Font, (uint8_t) *c, g)) {
+			continue;
+		}
+		if ((Count >= GLYPHCACHE_CHARS) || !AddGlyph(Font, g)) {
+			ok = false;
+			break;
+		}
+		Lookup[(uint8_t) *c] = Count++;
+	}
+
+	SetColors(Fore, Back);
+
+	return ok;
+}
+
+void GlyphCache::SetColors(uint16_t Fore, uint16_t Back) {
+
+	uint8_t max = (1 << BPP) - 1;
+	uint8_t i;
+
+	for (i = 0; i <= max; i++) {
+		Palette[i] = FontBlend565(Fore, Back, (uint16_t) i * FONT_ALPHA_SOLID / max);
+	}
+}
+
+// adds Rows copies of the row, or bumps the repeat of the last record if it's the same row
+bool GlyphCache::AddRow(const uint8_t *Level, uint8_t Width, uint8_t Rows, CachedGlyph &Cached, uint16_t &Last) {
+
+	uint16_t run[GLYPHCACHE_MAX_WIDTH];
+	uint8_t count = 0;
+	uint8_t x = 0;
+	uint8_t start, repeat;
+
+	if (Rows == 0) {
+		return true;
+	}
+
+	while (x < Width) {
+		start = x;
+		while ((x < Width) && (Level[x] == Level[start])) {
+			x++;
+		}
+		run[count++] = GLYPHCACHE_RUN(x - start, Level[start]);
+	}
+
+	if ((Last != NO_RECORD) && ((Runs[Last] & 0xFF) == count) && (memcmp(&Runs[Last + 1], run, count * sizeof(uint16_t)) == 0)) {
+		repeat = Runs[Last] >> 8;
+		if (repeat + Rows <= 255) {
+			Runs[Last] += (uint16_t) Rows << 8;
+			return true;
+		}
+	}
+
+	if (Used + 1 + count > GLYPHCACHE_WORDS) {
+		return false;
+	}
+
+	Last = Used;
+	Runs[Used++] = ((uint16_t) Rows << 8) | count;
+	memcpy(&Runs[Used], run, count * sizeof(uint16_t));
+	Used += count;
+	Cached.Records++;
+
+	return true;
+}
+
+bool GlyphCache::AddGlyph(const ILI9341_t3_font_t &Font, const FontGlyph &G) {
+
+	CachedGlyph &cached = Glyph[Count];
+	uint8_t level[GLYPHCACHE_MAX_WIDTH];
+	uint8_t blank[GLYPHCACHE_MAX_WIDTH];
+	uint8_t max = (1 << BPP) - 1;
+	int16_t top = FontGlyphTop(Font, G);
+	int16_t next = 0;			// next cell row to add
+	int16_t row = -1;			// cell row the decoder is on, -1 before the first run
+	uint8_t rows = 0;
+	uint16_t last = NO_RECORD;
+	bool ok = true;
+
+	cached.Code = G.Code;
+	cached.Start = Used;
+	cached.Advance = (G.Delta > GLYPHCACHE_MAX_WIDTH) ? GLYPHCACHE_MAX_WIDTH : G.Delta;
+	cached.Records = 0;
+	memset(level, 0, sizeof(level));
+	memset(blank, 0, sizeof(blank));
+
+	// adds rows from Next up to (not including) Until, clipped to the cell
+	auto add = [&](const uint8_t *Level, int16_t Until) {
+		int16_t from = (next < 0) ? 0 : next;
+		int16_t to = (Until > Height) ? Height : Until;
+		if (to > from) {
+			ok = ok && AddRow(Level, cached.Advance, to - from, cached, last);
+		}
+		next = Until;
+	};
+
+	FontDecode(Font, G, [&](uint16_t x, uint16_t y, uint16_t length, uint16_t n, uint8_t alpha) {
+
+		int16_t cy = top + y;
+		int16_t i;
+
+		if (cy != row) {
+			if (row >= 0) {
+				add(level, row + rows);
+				memset(level, 0, sizeof(level));
+			}
+			// rows with nothing on them
+			if (cy > next) {
+				add(blank, cy);
+			}
+			row = cy;
+			rows = n;
+		}
+
+		for (i = G.XOffset + x; i < G.XOffset + x + length; i++) {
+			if ((i >= 0) && (i < cached.Advance)) {
+				level[i] = ((uint16_t) alpha * max + FONT_ALPHA_SOLID / 2) / FONT_ALPHA_SOLID;
+			}
+		}
+	});
+
+	if (row >= 0) {
+		add(level, row + rows);
+	}
+	add(blank, Height);
+
+	return ok;
+}
+
+bool GlyphCache::Has(uint16_t Code) const {
+	return (Code < 128) && (Lookup[Code] != GLYPHCACHE_NONE);
+}
+
+int16_t GlyphCache::GetAdvance(uint16_t Code) const {
+	return Has(Code) ? Glyph[Lookup[Code]].Advance : 0;
+}
+
+int16_t GlyphCache::GetHeight() const {
+	return Height;
+}
+
+uint16_t GlyphCache::GetBackground() const {
+	return Palette[0];
+}
+
+uint16_t GlyphCache::GetBytes() const {
+	return Used * sizeof(uint16_t);
+}
+
+int16_t GlyphCache::StringWidth(const char *Text) const {
+
+	int16_t w = 0;
+
+	while (*Text) {
+		w += GetAdvance((uint8_t) *Text++);
+	}
+	return w;
+}
@@ -0,0 +1,183 @@
+/*
+
+	Program name: Bob Jones Patriot Racing glyph cache
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, pre decoded big digits for the data readout
+	1.1    Kris 	10/19/2026	run storage sized to the biggest digit set we have, 12k down to 7.4k
+
+*/
+
+#ifndef PATRIOT_RACING_GLYPHCACHE_H
+#define PATRIOT_RACING_GLYPHCACHE_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include <string.h>
+#include "PatriotRacing_Font.h"
+
+#define GLYPHCACHE_VERSION 1.1
+
+/*
+
+the big data readout (DATA_Y) uses Arial_100_BINO, which only has 13 chars (- . 0-9 :), and every
+redraw bit walked the same compressed glyphs again. Begin decodes them once into rows of runs and
+each glyph becomes a fixed cell (advance wide, tallest glyph high) including the background, so a
+digit is drawn by pushing the whole cell in a few writeRect calls, and drawing it also erases
+whatever was there
+
+each run is a length and a level, the level indexes a palette already blended from the text and
+background colors, so a theme change only re-blends the palette (SetColors), the runs stay
+the same. rows the same as the one above are stored once with a repeat count
+
+Display is anything with writeRect(x, y, w, h, const uint16_t *pixels), ILI9341_t3 or a PC mock
+
+the run storage is sized for the biggest set we cache, - . 0-9 : of Arial_100_BINO is 3660 words
+(GlyphCacheBench prints what every font in PatriotRacing_Fonts needs and fails if one doesn't
+fit). each cache is about 7.4k for the runs plus 2k for the band, a sketch that caches more chars
+or a bigger font defines GLYPHCACHE_WORDS before the include, Begin returns false if they don't fit
+
+*/
+
+#ifndef GLYPHCACHE_WORDS
+ #define GLYPHCACHE_WORDS 3712       // run storage (2 bytes each), Arial_100_BINO digits need 3660
+#endif
+#define GLYPHCACHE_CHARS 16          // glyphs one cache holds
+#define GLYPHCACHE_MAX_WIDTH 128     // widest cell
+#define GLYPHCACHE_BAND 1024         // pixels pushed per writeRect
+#define GLYPHCACHE_LEVELS 16         // 4 bit anti aliased fonts at most
+#define GLYPHCACHE_NONE 0xFF
+
+// a run, length in the low 12 bits, palette level in the top 4
+#define GLYPHCACHE_RUN(len, level) ((uint16_t) (((level) << 12) | (len)))
+#define GLYPHCACHE_LEN(run) ((run) & 0x0FFF)
+#define GLYPHCACHE_LEVEL(run) ((run) >> 12)
+
+// a row record is one word, repeat count in the high byte and run count in the low, then the runs
+
+struct CachedGlyph {
+	uint16_t Code;
+	uint16_t Start;			// first word in Runs
+	uint8_t Advance;		// cell width
+	uint8_t Records;		// row records
+};
+
+class GlyphCache {
+
+public:
+
+	GlyphCache();
+
+	// decodes each char of Chars that the font has, false if they didn't all fit
+	bool Begin(const ILI9341_t3_font_t &Font, const char *Chars, uint16_t Fore, uint16_t Back);
+
+	// theme change, re-blends the palette, the runs don't change
+	void SetColors(uint16_t Fore, uint16_t Back);
+
+	bool Has(uint16_t Code) const;
+	int16_t GetAdvance(uint16_t Code) const;
+	int16_t GetHeight() const;              // cell height, same for every glyph
+	uint16_t GetBackground() const;         // what the cells are blended against
+	uint16_t GetBytes() const;              // run storage used
+	int16_t StringWidth(const char *Text) const;
+
+	// draws the cell for Code with the cursor at X, Y, returns the advance (0 if not cached)
+	template <class Display>
+	int16_t DrawChar(Display &D, int16_t X, int16_t Y, uint16_t Code);
+
+	template <class Display>
+	int16_t DrawString(Display &D, int16_t X, int16_t Y, const char *Text);
+
+private:
+
+	bool AddGlyph(const ILI9341_t3_font_t &Font, const FontGlyph &Glyph);
+	bool AddRow(const uint8_t *Level, uint8_t Width, uint8_t Rows, CachedGlyph &Cached, uint16_t &Last);
+
+	CachedGlyph Glyph[GLYPHCACHE_CHARS];
+	uint8_t Lookup[128];				// char -> Glyph index, GLYPHCACHE_NONE if not cached
+	uint8_t Count;
+	uint16_t Runs[GLYPHCACHE_WORDS];
+	uint16_t Used;
+	int16_t Height;
+	uint8_t BPP;
+	uint16_t Palette[GLYPHCACHE_LEVELS];
+	uint16_t Band[GLYPHCACHE_BAND];
+
+};
+
+template <class Display>
+int16_t GlyphCache::DrawChar(Display &D, int16_t X, int16_t Y, uint16_t Code) {
+
+	const CachedGlyph *g;
+	const uint16_t *p;
+	uint16_t *line;
+	uint8_t r, n, repeat, count, w;
+	uint16_t len, top, rows;
+
+	if ((Code >= 128) || (Lookup[Code] == GLYPHCACHE_NONE)) {
+		return 0;
+	}
+
+	g = &Glyph[Lookup[Code]];
+	p = &Runs[g->Start];
+	w = g->Advance;
+	top = 0;
+	rows = 0;
+
+	for (r = 0; r < g->Records; r++) {
+		repeat = *p >> 8;
+		count = *p++ & 0xFF;
+
+		// flush if this record won't fit in the band
+		if ((rows + 1) * w > GLYPHCACHE_BAND) {
+			D.writeRect(X, Y + top, w, rows, Band);
+			top += rows;
+			rows = 0;
+		}
+
+		line = &Band[rows * w];
+		for (n = 0; n < count; n++, p++) {
+			len = GLYPHCACHE_LEN(*p);
+			uint16_t c = Palette[GLYPHCACHE_LEVEL(*p)];
+			while (len--) {
+				*line++ = c;
+			}
+		}
+		rows++;
+
+		// copy the row down for repeats, flushing as the band fills
+		while (--repeat) {
+			if ((rows + 1) * w > GLYPHCACHE_BAND) {
+				// keep the row we're copying at the top of the next band
+				D.writeRect(X, Y + top, w, rows - 1, Band);
+				top += rows - 1;
+				memcpy(Band, &Band[(rows - 1) * w], w * sizeof(uint16_t));
+				rows = 1;
+			}
+			memcpy(&Band[rows * w], &Band[(rows - 1) * w], w * sizeof(uint16_t));
+			rows++;
+		}
+	}
+
+	if (rows) {
+		D.writeRect(X, Y + top, w, rows, Band);
+	}
+
+	return w;
+}
+
+template <class Display>
+int16_t GlyphCache::DrawString(Display &D, int16_t X, int16_t Y, const char *Text) {
+
+	while (*Text) {
+		X += DrawChar(D, X, Y, (uint8_t) *Text++);
+	}
+	return X;
+}
+
+#endif
@@ -0,0 +1,79 @@
+#include "PatriotRacing_IconPack.h"
+#include "PatriotRacing_RenderTrace.h"
+
+IconReader::IconReader() {
+
+	Icon = NULL;
+	Next = NULL;
+	End = NULL;
+	Op = 0;
+	Left = 0;
+	Color = 0;
+}
+
+void IconReader::Begin(const PackedIcon &Icon) {
+
+	this->Icon = &Icon;
+	Next = Icon.Data;
+	End = Icon.Data + Icon.Bytes;
+	Op = 0;
+	Left = 0;
+	RenderTraceAsset(Icon.Data);
+}
+
+uint32_t IconReader::Read(uint16_t *Out, uint32_t Count) {
+
+	uint32_t done = 0;
+	uint8_t n, i;
+
+	if (Icon == NULL) {
+		return 0;
+	}
+
+	while (done < Count) {
+
+		if (Left == 0) {
+			if (Next >= End) {
+				break;
+			}
+			Op = *Next & ICONPACK_COPY_COLOR;
+			Left = (*Next++ & (ICONPACK_MAX_COUNT - 1)) + 1;
+			if (Op == ICONPACK_RUN_INDEX) {
+				Color = Icon->Palette[*Next++];
+			}
+			else if (Op == ICONPACK_RUN_COLOR) {
+				Color = Next[0] | (Next[1] << 8);
+				Next += 2;
+			}
+		}
+
+		n = (Count - done < Left) ? Count - done : Left;
+		switch (Op) {
+			case ICONPACK_RUN_INDEX:
+			case ICONPACK_RUN_COLOR:
+				for (i = 0; i < n; i++) {
+					Out[done + i] = Color;
+				}
+				break;
+			case ICONPACK_COPY_INDEX:
+				for (i = 0; i < n; i++) {
+					Out[done + i] = Icon->Palette[*Next++];
+				}
+				break;
+			default:
+				for (i = 0; i < n; i++) {
+					Out[done + i] = Next[0] | (Next[1] << 8);
+					Next += 2;
+				}
+				break;
+		}
+		done += n;
+		Left -= n;
+	}
+
+	return done;
+}
+
+uint32_t IconPackBytes(const PackedIcon &Icon) {
+	return Icon.Bytes + Icon.Colors * sizeof(uint16_t) + sizeof(PackedIcon);
+}
@@ -0,0 +1,107 @@
+/*
+
+	Program name: Bob Jones Patriot Racing packed icons
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, palette + run length icons decoded straight to the display
+	1.1    Kris 	10/19/2026	IconReader reports to the render trace
+
+*/
+
+#ifndef PATRIOT_RACING_ICONPACK_H
+#define PATRIOT_RACING_ICONPACK_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+
+#define ICONPACK_VERSION 1.1
+
+/*
+
+the icons in PatriotRacing_Icons.h and GPUSA_Icons.h are raw RGB565, 2 bytes a pixel, and most of
+every icon is the black background. a PackedIcon is the same picture as a palette of the colors
+that show up more than a couple of times plus a stream of runs:
+
+	op byte     top 2 bits what, low 6 bits count - 1 (1 - 64 pixels)
+	00 run      one palette index follows, count pixels of it
+	01 copy     count palette indexes follow
+	10 run      one color follows (2 bytes, low byte first), for colors not in the palette
+	11 copy     count colors follow
+
+runs carry on from one row to the next, so a black border is one or two ops
+
+IconDraw decodes ICONPACK_BAND pixels at a time (whole rows) into a buffer on the stack and
+writeRects each band, nothing the size of the icon is ever in RAM. PatriotRacing_Tools/IconPack
+makes the tables (PatriotRacing_PackedIcons.h) from the raw icon headers
+
+*/
+
+#define ICONPACK_BAND 512            // pixels per writeRect, 16 rows of a 32 pixel icon
+#define ICONPACK_RUN_INDEX 0x00
+#define ICONPACK_COPY_INDEX 0x40
+#define ICONPACK_RUN_COLOR 0x80
+#define ICONPACK_COPY_COLOR 0xC0
+#define ICONPACK_MAX_COUNT 64
+
+struct PackedIcon {
+	uint16_t Width;
+	uint16_t Height;
+	const uint16_t *Palette;
+	uint16_t Colors;
+	const uint8_t *Data;
+	uint32_t Bytes;              // of Data
+};
+
+// walks the op stream, hands back pixels in whatever size pieces the caller wants
+class IconReader {
+
+public:
+
+	IconReader();
+
+	void Begin(const PackedIcon &Icon);
+
+	// fills Out with up to Count pixels, returns how many (0 at the end of the icon)
+	uint32_t Read(uint16_t *Out, uint32_t Count);
+
+private:
+
+	const PackedIcon *Icon;
+	const uint8_t *Next;
+	const uint8_t *End;
+	uint8_t Op;                  // op being worked on
+	uint8_t Left;                // pixels left in it
+	uint16_t Color;              // for runs
+
+};
+
+// flash the packed icon takes, data + palette + the struct
+uint32_t IconPackBytes(const PackedIcon &Icon);
+
+template <class Display>
+void IconDraw(Display &D, int16_t X, int16_t Y, const PackedIcon &Icon) {
+
+	uint16_t band[ICONPACK_BAND];
+	uint16_t rows = ICONPACK_BAND / Icon.Width;
+	uint16_t y, n;
+	IconReader reader;
+
+	if (rows == 0) {
+		// wider than a band, one row at a time would need a bigger buffer
+		return;
+	}
+
+	reader.Begin(Icon);
+	for (y = 0; y < Icon.Height; y += n) {
+		n = (Icon.Height - y < rows) ? Icon.Height - y : rows;
+		reader.Read(band, (uint32_t) n * Icon.Width);
+		D.writeRect(X, Y + y, Icon.Width, n, band);
+	}
+}
+
+#endif
@@ -0,0 +1,24 @@
+#include "PatriotRacing_LapTicker.h"
+
+LapTicker::LapTicker() {
+
+	Reverse = false;
+	Columns = true;
+	First = 0;
+	Rows = 0;
+	Cell = 1;
+	Start = 0;
+	Pushed = 0;
+}
+
+int16_t LapTicker::GetCells() const {
+	return Rows / Cell;
+}
+
+uint32_t LapTicker::GetPushed() const {
+	return Pushed;
+}
+
+uint16_t LapTicker::CellRow(int16_t C) const {
+	return First + (Start + (uint32_t) C * Cell) % Rows;
+}
@@ -0,0 +1,191 @@
+/*
+
+	Program name: Bob Jones Patriot Racing lap ticker
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, lap history moved with the panel's hardware scroll
+	1.1    Kris 	10/19/2026	LapTickerTFT, ILI9341_t3 has no VSCRDEF so the sketch's panel gets one
+
+*/
+
+#ifndef PATRIOT_RACING_LAPTICKER_H
+#define PATRIOT_RACING_LAPTICKER_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+
+#define LAPTICKER_VERSION 1.1
+
+/*
+
+the lap list repainted every lap on the screen every second, even though it only changes when a
+lap is done. a LapTicker gives the list its own part of the panel's vertical scroll area (VSCRDEF)
+and each lap is a cell in it. a new lap is drawn over the oldest cell, then the scroll start
+(VSCRSADD, 2 bytes) moves one cell so it shows up as the newest and everything else moves along,
+nothing that's already there gets sent again. in between laps the ticker sends nothing
+
+the scroll runs along the panel's own 320 pixel side, so which way that is depends on the rotation:
+
+	landscape    (rotation 1, 3, the race screens) the cells are columns Cell wide and the full
+	             240 high, the newest comes in at the right and the old ones slide left. the
+	             scroll moves every column top to bottom, so the ticker has the whole height of
+	             From to To, the rest of the screen (the race clock, the readouts) has to be beside
+	             it, not above or below (StripChart doesn't scroll for the same reason)
+	portrait     (rotation 0, 2) the cells are rows 240 wide and Cell high, newest at the bottom
+
+rotation 3 and 2 turn the panel the other way round, Push works the scroll backwards so the newest
+is still at the right or the bottom
+
+Draw(x, y, w, h) paints the new cell, the coordinates are where it goes in the panel's memory,
+which isn't where it shows, so it has to draw inside the box and nowhere else. it also has to
+cover everything the cell before it drew, the easy way is the same boxes every lap (TextRun with
+MinWidth). Begin clears the band once, Push never erases anything
+
+the race clock next to it is a NumberField, only the digits that changed get sent, so a second of
+racing is one digit cell, and a lap is one cell of the ticker and 2 bytes of scroll. the digit cell
+is what sets the rate, in Arial_16_AA4 it's about 450 bytes a second, Arial_24_AA4 about 1000
+(LapTickerBench in PatriotRacing_Tools)
+
+Display is anything with width(), height(), getRotation(), fillRect, setScrollArea(top, bottom)
+(VSCRDEF) and setScroll(offset) (VSCRSADD) the way the PC panel emulator has them. ILI9341_t3 has
+setScroll but nothing that sends VSCRDEF, so on the Teensy declare the panel as a LapTickerTFT
+instead of an ILI9341_t3 (same constructor, it is one), it adds setScrollArea
+
+	LapTickerTFT Display = LapTickerTFT(TFT_CS, TFT_DC);
+
+*/
+
+#define LAPTICKER_GRAM_ROWS 320      // the side the panel scrolls along
+#define LAPTICKER_VSCRDEF 0x33       // vertical scroll definition, top, scrolled and bottom rows
+
+class LapTicker {
+
+public:
+
+	LapTicker();
+
+	// the band from From to To - 1 along the scroll (screen x in landscape, y in portrait) scrolls, one
+	// lap every Cell pixels, the band is cut down to whole cells. clears the band to Back
+	template <class Display>
+	void Begin(Display &D, int16_t From, int16_t To, int16_t Cell, uint16_t Back);
+
+	// the oldest cell becomes the newest, Draw(x, y, w, h) paints it before it's scrolled into place
+	template <class Display, class DrawFunc>
+	void Push(Display &D, DrawFunc &&Draw);
+
+	// the whole panel back to not scrolled, before another screen is drawn
+	template <class Display>
+	void End(Display &D);
+
+	int16_t GetCells() const;              // how many show at once
+	uint32_t GetPushed() const;            // laps since Begin
+
+private:
+
+	// memory row of the first row of cell c (0 is the oldest showing)
+	uint16_t CellRow(int16_t C) const;
+
+	bool Reverse;                // rotation 2, 3, screen order is backwards to memory order
+	bool Columns;                // landscape
+	uint16_t First;              // first memory row of the band
+	uint16_t Rows;               // rows in the band, a whole number of cells
+	int16_t Cell;
+	uint16_t Start;              // scroll start, from First
+	uint32_t Pushed;
+
+};
+
+template <class Display>
+void LapTicker::Begin(Display &D, int16_t From, int16_t To, int16_t Cell, uint16_t Back) {
+
+	uint8_t r = D.getRotation() & 3;
+
+	if ((Cell <= 0) || (From < 0) || (To > LAPTICKER_GRAM_ROWS) || (To - From < Cell)) {
+		Rows = 0;
+		return;
+	}
+	Reverse = (r >= 2);
+	Columns = (r & 1);
+	this->Cell = Cell;
+	Rows = ((To - From) / Cell) * Cell;
+	To = From + Rows;
+	First = Reverse ? LAPTICKER_GRAM_ROWS - To : From;
+	Start = 0;
+	Pushed = 0;
+
+	if (Columns) {
+		D.fillRect(From, 0, Rows, D.height(), Back);
+	}
+	else {
+		D.fillRect(0, From, D.width(), Rows, Back);
+	}
+	D.setScrollArea(First, LAPTICKER_GRAM_ROWS - First - Rows);
+	D.setScroll(First);
+}
+
+template <class Display, class DrawFunc>
+void LapTicker::Push(Display &D, DrawFunc &&Draw) {
+
+	uint16_t row;
+	int16_t at;
+
+	if (Rows == 0) {
+		return;
+	}
+
+	// the oldest is the first cell on the screen, memory first unless the rotation turned it round
+	row = CellRow(Reverse ? Rows / Cell - 1 : 0);
+	at = Reverse ? LAPTICKER_GRAM_ROWS - row - Cell : row;
+	if (Columns) {
+		Draw(at, 0, Cell, D.height());
+	}
+	else {
+		Draw(0, at, D.width(), Cell);
+	}
+
+	// one cell on and the one just drawn is last on the screen
+	Start = Reverse ? (Start + Rows - Cell) % Rows : (Start + Cell) % Rows;
+	D.setScroll(First + Start);
+	Pushed++;
+}
+
+template <class Display>
+void LapTicker::End(Display &D) {
+
+	D.setScrollArea(0, 0);
+	D.setScroll(0);
+	Rows = 0;
+}
+
+#if defined(TEENSYDUINO)
+
+#include <ILI9341_t3.h>
+
+// the sketch's ILI9341_t3 plus VSCRDEF, sent the way the library sends VSCRSADD in its setScroll
+// (its own transaction and CS handling, the helpers are protected so it has to be a subclass)
+class LapTickerTFT : public ILI9341_t3 {
+
+public:
+
+	using ILI9341_t3::ILI9341_t3;
+
+	// Top and Bottom rows (in GRAM order) stay put, the rest scrolls
+	void setScrollArea(uint16_t Top, uint16_t Bottom) {
+		beginSPITransaction();
+		writecommand_cont(LAPTICKER_VSCRDEF);
+		writedata16_cont(Top);
+		writedata16_cont(LAPTICKER_GRAM_ROWS - Top - Bottom);
+		writedata16_last(Bottom);
+		endSPITransaction();
+	}
+
+};
+
+#endif
+
+#endif
@@ -0,0 +1,74 @@
+#include "PatriotRacing_MenuScreen.h"
+
+MenuScreen::MenuScreen() {
+
+	ItemFont = NULL;
+	TitleFont = NULL;
+	Page = NULL;
+	Item = 0;
+	Count = 0;
+	Choices = NULL;
+	memset(&Colors, 0, sizeof(Colors));
+}
+
+void MenuScreen::Begin(const GFXfont *NewItemFont, const GFXfont *NewTitleFont, const MenuScreenColors &NewColors) {
+
+	ItemFont = NewItemFont;
+	TitleFont = NewTitleFont;
+	Colors = NewColors;
+	Metrics.AddFont(ItemFont);
+	Metrics.AddFont(TitleFont);
+}
+
+void MenuScreen::SetColors(const MenuScreenColors &NewColors) {
+	Colors = NewColors;
+}
+
+const MenuScreenPage *MenuScreen::GetPage() const {
+	return Page;
+}
+
+uint8_t MenuScreen::GetItem() const {
+	return Item;
+}
+
+// where the baseline goes to center a capital in Height rows
+int16_t MenuScreen::Baseline(const GFXfont *Font, int16_t Height) {
+
+	int16_t ascent = 0;
+
+	if (('A' >= Font->first) && ('A' <= Font->last)) {
+		ascent = -Font->glyph['A' - Font->first].yOffset;
+	}
+	return (Height + ascent) / 2;
+}
+
+// the band already has the title background
+void MenuScreen::ComposeTitle(int16_t First, int16_t Count) {
+
+	const char *title = Page->Title;
+	uint16_t fore = Colors.TitleFore;
+
+	TextRunPlot(TitleFont, Metrics.CenterX(TitleFont, title, MENUSCREEN_W / 2), Baseline(TitleFont, MENUSCREEN_TITLE_H) - First, title, [&](int16_t X, int16_t Y) {
+		if ((X >= 0) && (X < MENUSCREEN_W) && (Y >= 0) && (Y < Count)) {
+			Band[Y * MENUSCREEN_W + X] = fore;
+		}
+	});
+}
+
+// the band already has the row's background, the label and value straight from the font tables
+void MenuScreen::ComposeRow(uint8_t Row, int16_t First, int16_t Count) {
+
+	const MenuScreenItem &item = Page->Items[Row];
+	const char *value = item.Choices[(Choices[Row] < item.Count) ? Choices[Row] : item.Count - 1];
+	uint16_t fore = (Row == Item) ? Colors.BarFore : Colors.Fore;
+	int16_t base = Baseline(ItemFont, MENUSCREEN_ROW_H) - First;
+	auto plot = [&](int16_t X, int16_t Y) {
+		if ((X >= 0) && (X < MENUSCREEN_ROW_W) && (Y >= 0) && (Y < Count)) {
+			Band[Y * MENUSCREEN_ROW_W + X] = fore;
+		}
+	};
+
+	TextRunPlot(ItemFont, MENUSCREEN_MARGIN, base, item.Label, plot);
+	TextRunPlot(ItemFont, Metrics.RightX(ItemFont, value, MENUSCREEN_ROW_W - MENUSCREEN_MARGIN), base, value, plot);
+}
@@ -0,0 +1,268 @@
+/*
+
+	Program name: Bob Jones Patriot Racing menu screen
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, menu pages that only redraw what a button press changed
+	1.1    Kris 	10/19/2026	rows go out in strips through a 1.9k band, no label masks, 27k of RAM down to 3.2k
+	1.2    Kris 	10/19/2026	the sketch hands in the page, built on its own option arrays, the menu tree is gone
+
+*/
+
+#ifndef PATRIOT_RACING_MENUSCREEN_H
+#define PATRIOT_RACING_MENUSCREEN_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include <string.h>
+#include <ILI9341_t3.h>
+#include "PatriotRacing_TextMetrics.h"
+#include "PatriotRacing_TextRun.h"
+
+#define MENUSCREEN_VERSION 1.2
+
+/*
+
+every button press in the setup menu cleared the screen and drew the title, the border, every
+label and every value again, 300k bytes on the bus to move the highlight one line, and worse when
+the SD card has the bus slowed down
+
+a MenuScreen draws a page (a MenuScreenPage the sketch hands to Show) in two layers:
+
+	static      the title bar and border, drawn once by Show and never touched again
+	rows        a row is built in a RAM band, background (normal or highlight bar), the label
+	            and the value right justified, a few pixel lines at a time, each strip sent with
+	            one writeRect, so nothing flickers and nothing is erased first
+
+after Show a button only sends the rows it changed:
+
+	L_BUTTON       highlight up, the old row and the new row
+	R_BUTTON       highlight down, same
+	C_BUTTON       next choice for the highlighted item, that one row
+	C_BUTTON_LONG  not handled, Press returns 0 and the sketch saves / goes to the next page
+
+a row is 318 x 28 pixels, about 11% of the screen, so a highlight move is two of those and a
+value change one. the band is MENUSCREEN_BAND pixels (3 lines, 1.9k of RAM, a Teensy 3.2 only has
+64k), a row is 10 strips and the label and value are plotted again from the font tables for each
+one. that's CPU for RAM (MenuScreenBench prints how much), and the extra windows cost under 1%
+more on the bus than one writeRect a row did
+
+a page is the sketch's, its items point at the option arrays the setup screens already use
+(AirRateText, TireText ... in PatriotRacing_Utilities.h), so the text is only stored once
+
+	const MenuScreenItem RadioItems[] = {MENUSCREEN_ITEM("Air rate", AirRateText), ...};
+	const MenuScreenPage RadioPage = MENUSCREEN_PAGE("Radio", RadioItems);
+
+Choices is the sketch's settings for the page, one per item in item order, Press changes them
+
+*/
+
+#define MENUSCREEN_W 320
+#define MENUSCREEN_H 240
+#define MENUSCREEN_ROW_H 28
+#define MENUSCREEN_TITLE_H MENUSCREEN_ROW_H      // the title goes through the same band
+#define MENUSCREEN_TOP 32                        // first row, under the title and the border
+#define MENUSCREEN_ROW_X 1                       // rows sit inside the border
+#define MENUSCREEN_ROW_W (MENUSCREEN_W - 2)
+#define MENUSCREEN_ROWS 7                        // most items on a page
+#define MENUSCREEN_MARGIN 8                      // label and value from the row ends
+#define MENUSCREEN_BOTTOM (MENUSCREEN_H - 1)     // bottom border
+#ifndef MENUSCREEN_BAND
+ #define MENUSCREEN_BAND (MENUSCREEN_W * 3)      // pixels composed per writeRect
+#endif
+
+// same values as the buttons in PatriotRacing_Utilities.h
+#define MENUSCREEN_L_BUTTON 1
+#define MENUSCREEN_C_BUTTON 2
+#define MENUSCREEN_R_BUTTON 3
+#define MENUSCREEN_C_BUTTON_LONG 5
+
+// one line of a page, Choices is one of the sketch's option arrays
+struct MenuScreenItem {
+	const char *Label;
+	const char **Choices;
+	uint8_t Count;
+};
+
+struct MenuScreenPage {
+	const char *Title;
+	const MenuScreenItem *Items;
+	uint8_t Count;
+};
+
+#define MENUSCREEN_ITEM(Label, Choices) {Label, Choices, sizeof(Choices) / sizeof(Choices[0])}
+#define MENUSCREEN_PAGE(Title, Items) {Title, Items, sizeof(Items) / sizeof(Items[0])}
+
+struct MenuScreenColors {
+	uint16_t Back;
+	uint16_t Fore;
+	uint16_t TitleBack;
+	uint16_t TitleFore;
+	uint16_t Bar;               // highlighted row
+	uint16_t BarFore;
+	uint16_t Border;
+};
+
+class MenuScreen {
+
+public:
+
+	MenuScreen();
+
+	void Begin(const GFXfont *ItemFont, const GFXfont *TitleFont, const MenuScreenColors &Colors);
+
+	// theme change, call Show after
+	void SetColors(const MenuScreenColors &Colors);
+
+	// the whole page with Item highlighted, returns the pixels pushed
+	template <class Display>
+	uint32_t Show(Display &D, const MenuScreenPage &Page, uint8_t *Choices, uint8_t Item);
+
+	// a button, returns the pixels pushed (0 for buttons it doesn't handle)
+	template <class Display>
+	uint32_t Press(Display &D, uint8_t Button);
+
+	// move the highlight
+	template <class Display>
+	uint32_t Select(Display &D, uint8_t Item);
+
+	// Choices[Item] was changed by the sketch
+	template <class Display>
+	uint32_t Refresh(Display &D, uint8_t Item);
+
+	const MenuScreenPage *GetPage() const;
+	uint8_t GetItem() const;
+
+private:
+
+	static int16_t Baseline(const GFXfont *Font, int16_t Height);
+
+	// lines First to First + Count - 1 of the title or a row into the band
+	void ComposeTitle(int16_t First, int16_t Count);
+	void ComposeRow(uint8_t Row, int16_t First, int16_t Count);
+
+	template <class Display>
+	uint32_t SendRow(Display &D, uint8_t Row);
+
+	// W x H at X, Y in strips through the band, Compose fills in each strip over Back
+	template <class Display, class ComposeFunc>
+	uint32_t Send(Display &D, int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Back, ComposeFunc &&Compose);
+
+	const GFXfont *ItemFont;
+	const GFXfont *TitleFont;
+	MenuScreenColors Colors;
+	TextMetrics Metrics;
+
+	const MenuScreenPage *Page;
+	uint8_t Item;                   // highlighted
+	uint8_t Count;                  // rows on the page
+	uint8_t *Choices;
+
+	uint16_t Band[MENUSCREEN_BAND];
+
+};
+
+template <class Display>
+uint32_t MenuScreen::Show(Display &D, const MenuScreenPage &NewPage, uint8_t *NewChoices, uint8_t NewItem) {
+
+	uint32_t pushed;
+	int16_t below;
+	uint8_t i;
+
+	Page = &NewPage;
+	Count = (Page->Count < MENUSCREEN_ROWS) ? Page->Count : MENUSCREEN_ROWS;
+	Choices = NewChoices;
+	Item = (NewItem < Count) ? NewItem : 0;
+
+	// static layer
+	Send(D, 0, 0, MENUSCREEN_W, MENUSCREEN_TITLE_H, Colors.TitleBack, [&](int16_t First, int16_t Lines) {
+		ComposeTitle(First, Lines);
+	});
+	D.fillRect(0, MENUSCREEN_TITLE_H, MENUSCREEN_W, MENUSCREEN_TOP - 1 - MENUSCREEN_TITLE_H, Colors.Back);
+	D.drawFastHLine(0, MENUSCREEN_TOP - 1, MENUSCREEN_W, Colors.Border);
+	D.drawFastHLine(0, MENUSCREEN_BOTTOM, MENUSCREEN_W, Colors.Border);
+	D.drawFastVLine(0, MENUSCREEN_TOP, MENUSCREEN_BOTTOM - MENUSCREEN_TOP, Colors.Border);
+	D.drawFastVLine(MENUSCREEN_W - 1, MENUSCREEN_TOP, MENUSCREEN_BOTTOM - MENUSCREEN_TOP, Colors.Border);
+	below = MENUSCREEN_BOTTOM - MENUSCREEN_TOP - Count * MENUSCREEN_ROW_H;
+	D.fillRect(MENUSCREEN_ROW_X, MENUSCREEN_TOP + Count * MENUSCREEN_ROW_H, MENUSCREEN_ROW_W, below, Colors.Back);
+	pushed = MENUSCREEN_W * (MENUSCREEN_TOP + 1) + (MENUSCREEN_BOTTOM - MENUSCREEN_TOP) * 2 + MENUSCREEN_ROW_W * below;
+
+	for (i = 0; i < Count; i++) {
+		pushed += SendRow(D, i);
+	}
+	return pushed;
+}
+
+template <class Display>
+uint32_t MenuScreen::Press(Display &D, uint8_t Button) {
+
+	if ((Count == 0) || (Choices == NULL)) {
+		return 0;
+	}
+	switch (Button) {
+	case MENUSCREEN_L_BUTTON:
+		return Select(D, (Item == 0) ? Count - 1 : Item - 1);
+	case MENUSCREEN_R_BUTTON:
+		return Select(D, (Item + 1 < Count) ? Item + 1 : 0);
+	case MENUSCREEN_C_BUTTON:
+		Choices[Item] = (Choices[Item] + 1 < Page->Items[Item].Count) ? Choices[Item] + 1 : 0;
+		return SendRow(D, Item);
+	default:
+		return 0;
+	}
+}
+
+template <class Display>
+uint32_t MenuScreen::Select(Display &D, uint8_t NewItem) {
+
+	uint8_t old = Item;
+
+	if ((NewItem >= Count) || (NewItem == Item)) {
+		return 0;
+	}
+	Item = NewItem;
+	return SendRow(D, old) + SendRow(D, Item);
+}
+
+template <class Display>
+uint32_t MenuScreen::Refresh(Display &D, uint8_t Row) {
+
+	if (Row >= Count) {
+		return 0;
+	}
+	return SendRow(D, Row);
+}
+
+template <class Display>
+uint32_t MenuScreen::SendRow(Display &D, uint8_t Row) {
+
+	uint16_t back = (Row == Item) ? Colors.Bar : Colors.Back;
+
+	return Send(D, MENUSCREEN_ROW_X, MENUSCREEN_TOP + Row * MENUSCREEN_ROW_H, MENUSCREEN_ROW_W, MENUSCREEN_ROW_H, back, [&](int16_t First, int16_t Lines) {
+		ComposeRow(Row, First, Lines);
+	});
+}
+
+template <class Display, class ComposeFunc>
+uint32_t MenuScreen::Send(Display &D, int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Back, ComposeFunc &&Compose) {
+
+	int16_t first, count, per = MENUSCREEN_BAND / W;
+	uint32_t i;
+
+	for (first = 0; first < H; first += count) {
+		count = (H - first < per) ? H - first : per;
+		for (i = 0; i < (uint32_t) count * W; i++) {
+			Band[i] = Back;
+		}
+		Compose(first, count);
+		D.writeRect(X, Y + first, W, count, Band);
+	}
+	return (uint32_t) W * H;
+}
+
+#endif
@@ -0,0 +1,504 @@
+#include "PatriotRacing_Monitor.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// value types in the field tables
+#define MON_U8 0
+#define MON_U16 1
+#define MON_I16 2
+#define MON_F32 3
+
+struct MonitorFieldDef {
+	const char *Tag;
+	uint16_t Channel;
+	uint8_t Type;
+	uint8_t Decimals;
+	uint16_t Offset;
+};
+
+// default tag prefix for our cars, same order as BLUE_CAR, RED_CAR, WHITE_CAR
+static const char *TeamCarTag[MONITOR_CARS] = {"B", "R", "W"};
+
+static const uint8_t TypeSize[] = {1, 2, 2, 4};
+
+static const char XMLHeader[] = "<?xml version = \"1.0\" ?>\n<Data>\n";
+static const char XMLFooter[] = "</Data>\n";
+
+#define GFIELD(tag, ch, type, dec, member) {tag, ch, type, dec, (uint16_t) offsetof(MonitorData, member)}
+#define CFIELD(tag, ch, type, dec, member) {tag, ch, type, dec, (uint16_t) offsetof(MonitorCars, member)}
+#define RFIELD(tag, ch, type, dec, member) {tag, ch, type, dec, (uint16_t) offsetof(RaceMonitorCar, member)}
+
+static const MonitorFieldDef GlobalField[] = {
+	GFIELD("RT", MON_CH_CORE, MON_U16, 0, RaceTime),
+	GFIELD("F_S", MON_CH_CORE, MON_U8, 0, FlagStatus),
+	GFIELD("F_SLT", MON_CH_CORE, MON_U16, 0, LapTimeScale),
+};
+
+// car tags are the car prefix + this, e.g. R_V, offsets are to the start of the array
+static const MonitorFieldDef CarField[MONITOR_CAR_FIELDS] = {
+	CFIELD("_WW", MON_CH_CORE, MON_U16, 0, Warnings),
+	CFIELD("_V", MON_CH_VOLTS, MON_F32, 1, Volts),
+	CFIELD("_DTS", MON_CH_TABLE, MON_F32, 0, DistToStart),
+	CFIELD("_LE", MON_CH_LAPENERGY, MON_F32, 1, LapEnergy),
+	CFIELD("_A", MON_CH_TABLE, MON_F32, 1, Amps),
+	CFIELD("_D", MON_CH_TABLE, MON_F32, 2, Distance),
+	CFIELD("_L2", MON_CH_TABLE, MON_F32, 1, Lap2Amps),
+	CFIELD("_R", MON_CH_TABLE, MON_U16, 0, RPM),
+	CFIELD("_E", MON_CH_ENERGY, MON_F32, 0, Energy),
+	CFIELD("_ER", MON_CH_TABLE, MON_I16, 0, EnergyRemain),
+	CFIELD("_TF", MON_CH_TEMP, MON_I16, 0, TempF),
+	CFIELD("_TX", MON_CH_TEMP, MON_I16, 0, TempX),
+	CFIELD("_CS", MON_CH_SPEED, MON_F32, 1, Speed),
+	CFIELD("_TR", MON_CH_TABLE, MON_U8, 0, TimeRemain),
+	CFIELD("_D0T", MON_CH_TABLE, MON_U16, 0, D0Time),
+	CFIELD("_D1T", MON_CH_TABLE, MON_U16, 0, D1Time),
+	CFIELD("_D2T", MON_CH_TABLE, MON_U16, 0, D2Time),
+	CFIELD("_GF", MON_CH_GFORCE, MON_F32, 2, GForce),
+	CFIELD("_LA", MON_CH_LAPAMPS, MON_F32, 1, LapAmps),
+	CFIELD("_DR", MON_CH_CORE, MON_U8, 0, Driver),
+	CFIELD("_PD", MON_CH_CORE, MON_U8, 0, PitDriver),
+	CFIELD("_DN", MON_CH_CORE, MON_U8, 0, DriverNumber),
+	CFIELD("_HD", MON_CH_CORE, MON_U8, 0, HaveData),
+	CFIELD("TE", MON_CH_ENERGY, MON_U16, 0, TotalEnergy),
+};
+
+// race monitor tags are C + slot + this, e.g. C3BLT
+static const MonitorFieldDef RMField[] = {
+	RFIELD("N", MON_CH_STANDINGS, MON_U16, 0, Number),
+	RFIELD("L", MON_CH_STANDINGS, MON_U16, 0, Laps),
+	RFIELD("LT", MON_CH_LAPTIME, MON_F32, 1, LapTime),
+	RFIELD("BLT", MON_CH_LAPTIME, MON_F32, 1, BestLapTime),
+	RFIELD("P", MON_CH_STANDINGS, MON_U8, 0, Pos),
+};
+
+#define FIELD_COUNT(x) (sizeof(x) / sizeof(x[0]))
+
+static uint16_t AddField(MonitorEncoderField *Field, uint16_t Count, const MonitorFieldDef &Def, uint16_t Base, const char *Prefix) {
+
+	if (Count >= MONITOR_MAX_FIELDS) {
+		return Count;
+	}
+	Field[Count].Offset = Base + Def.Offset;
+	Field[Count].Type = Def.Type;
+	Field[Count].Decimals = Def.Decimals;
+	snprintf(Field[Count].Tag, MONITOR_TAG_SIZE, "%s%s", Prefix, Def.Tag);
+
+	return Count + 1;
+}
+
+uint16_t MonitorPublisher::BuildEncoder(uint16_t Channels, uint32_t CarMask, MonitorEncoderField *Field) const {
+
+	uint16_t count = 0;
+	uint16_t base;
+	uint8_t i, j;
+	char prefix[4];
+
+	Channels |= MON_CH_CORE;
+
+	for (j = 0; j < FIELD_COUNT(GlobalField); j++) {
+		count = AddField(Field, count, GlobalField[j], 0, "");
+	}
+
+	// field by field, so encoding walks each array of the car table front to back
+	for (j = 0; j < FIELD_COUNT(CarField); j++) {
+		if ((CarField[j].Channel & Channels) == 0) {
+			continue;
+		}
+		for (i = 0; i < Cars; i++) {
+			if (CarMask & ((uint32_t) 1 << i)) {
+				base = offsetof(MonitorData, Car) + i * TypeSize[CarField[j].Type];
+				count = AddField(Field, count, CarField[j], base, CarTag[i]);
+			}
+		}
+	}
+
+	for (i = 0; i < RM_CARS; i++) {
+		base = offsetof(MonitorData, RM) + i * sizeof(RaceMonitorCar);
+		snprintf(prefix, sizeof(prefix), "C%u", i);
+		for (j = 0; j < FIELD_COUNT(RMField); j++) {
+			if (RMField[j].Channel & Channels) {
+				count = AddField(Field, count, RMField[j], base, prefix);
+			}
+		}
+	}
+
+	return count;
+}
+
+// number formatting without printf, this runs for every field of every publish
+static char *PutUInt(char *p, uint32_t Value) {
+
+	char tmp[10];
+	uint8_t n = 0;
+
+	do {
+		tmp[n++] = '0' + (Value % 10);
+		Value /= 10;
+	} while (Value);
+
+	while (n) {
+		*p++ = tmp[--n];
+	}
+	return p;
+}
+
+static char *PutFloat(char *p, float Value, uint8_t Decimals) {
+
+	static const uint16_t Scale[] = {1, 10, 100, 1000};
+	uint32_t v, whole, frac;
+	uint8_t i;
+	bool neg = Value < 0.0f;
+
+	if (Decimals > 3) {
+		Decimals = 3;
+	}
+	// a sensor that isn't there, the page shows it as is
+	if (Value != Value) {
+		memcpy(p, "NaN", 3);
+		return p + 3;
+	}
+	if (neg) {
+		Value = -Value;
+	}
+	// it has to fit 32 bits (and the 12 chars Encode allows), NumberField::Format clamps at the same
+	// 4e9 but shows NaN as dashes, the page gets the word
+	if (Value * Scale[Decimals] > 4.0e9f) {
+		Value = 4.0e9f / Scale[Decimals];
+	}
+
+	v = (uint32_t) (Value * Scale[Decimals] + 0.5f);
+	// don't send -0.0
+	if (neg && v) {
+		*p++ = '-';
+	}
+	whole = v / Scale[Decimals];
+	frac = v % Scale[Decimals];
+	p = PutUInt(p, whole);
+
+	if (Decimals) {
+		*p++ = '.';
+		for (i = Decimals; i > 0; i--) {
+			p[i - 1] = '0' + (frac % 10);
+			frac /= 10;
+		}
+		p += Decimals;
+	}
+	return p;
+}
+
+static char *PutTag(char *p, const char *Tag, bool Close) {
+
+	*p++ = '<';
+	if (Close) {
+		*p++ = '/';
+	}
+	while (*Tag) {
+		*p++ = *Tag++;
+	}
+	*p++ = '>';
+	return p;
+}
+
+uint16_t MonitorPublisher::Encode(const MonitorEncoderField *Field, uint16_t Count, const MonitorData &Data, char *Buffer, uint16_t Size) {
+
+	const uint8_t *base = (const uint8_t *) &Data;
+	char *p = Buffer;
+	char *end = Buffer + Size;
+	uint16_t i;
+	const void *v;
+
+	if (Size < sizeof(XMLHeader) + sizeof(XMLFooter)) {
+		return 0;
+	}
+
+	memcpy(p, XMLHeader, sizeof(XMLHeader) - 1);
+	p += sizeof(XMLHeader) - 1;
+
+	for (i = 0; i < Count; i++) {
+
+		// worst case is two tags, a 12 char number and the line feed
+		if (p + 2 * MONITOR_TAG_SIZE + 20 + sizeof(XMLFooter) >= end) {
+			break;
+		}
+
+		v = base + Field[i].Offset;
+		p = PutTag(p, Field[i].Tag, false);
+		switch (Field[i].Type) {
+			case MON_U8:
+				p = PutUInt(p, *(const uint8_t *) v);
+				break;
+			case MON_U16:
+				p = PutUInt(p, *(const uint16_t *) v);
+				break;
+			case MON_I16:
+				if (*(const int16_t *) v < 0) {
+					*p++ = '-';
+					p = PutUInt(p, -(int32_t) *(const int16_t *) v);
+				}
+				else {
+					p = PutUInt(p, *(const int16_t *) v);
+				}
+				break;
+			case MON_F32:
+				p = PutFloat(p, *(const float *) v, Field[i].Decimals);
+				break;
+		}
+		p = PutTag(p, Field[i].Tag, true);
+		*p++ = '\n';
+	}
+
+	memcpy(p, XMLFooter, sizeof(XMLFooter));
+	p += sizeof(XMLFooter) - 1;
+
+	return p - Buffer;
+}
+
+uint16_t MonitorPublisher::Serialize(const MonitorData &Data, char *Buffer, uint16_t Size) const {
+
+	// encoder 0 is always the full document
+	return Encode(Encoder[0].Field, Encoder[0].FieldCount, Data, Buffer, Size);
+}
+
+void MonitorPublisher::InitEncoder(MonitorEncoder &Enc) {
+
+	uint8_t i;
+
+	for (i = 0; i < MONITOR_SNAPSHOTS; i++) {
+		Enc.Slot[i].Version = 0;
+		Enc.Slot[i].Readers = 0;
+		Enc.Slot[i].Length = snprintf(Enc.Slot[i].XML, MONITOR_XML_SIZE, "%s%s", XMLHeader, XMLFooter);
+	}
+	Enc.Current = &Enc.Slot[0];
+}
+
+MonitorPublisher::MonitorPublisher() {
+
+	uint8_t i;
+
+	for (i = 0; i < MONITOR_MAX_CARS; i++) {
+		if (i < MONITOR_CARS) {
+			snprintf(CarTag[i], MONITOR_CAR_TAG_SIZE, "%s", TeamCarTag[i]);
+		}
+		else {
+			snprintf(CarTag[i], MONITOR_CAR_TAG_SIZE, "T%u", i);
+		}
+	}
+
+	Published = 0;
+	Skipped = 0;
+	Started = false;
+	Begin(MONITOR_CARS);
+}
+
+bool MonitorPublisher::Begin(uint8_t NewCars) {
+
+	uint8_t i;
+
+	if (Started.load()) {
+		return false;
+	}
+
+	Cars = (NewCars > MONITOR_MAX_CARS) ? MONITOR_MAX_CARS : NewCars;
+
+	for (i = 0; i < MONITOR_ENCODERS; i++) {
+		InitEncoder(Encoder[i]);
+		Encoder[i].State = ENCODER_FREE;
+		Encoder[i].Channels = 0;
+		Encoder[i].Cars = 0;
+		Encoder[i].LastUsed = 0;
+		Encoder[i].Since = 0;
+		Encoder[i].FieldCount = 0;
+	}
+
+	// encoder 0 is the full document and never goes away
+	Encoder[0].Channels = MON_CH_ALL;
+	Encoder[0].Cars = MON_CARS_ALL;
+	Encoder[0].FieldCount = BuildEncoder(MON_CH_ALL, MON_CARS_ALL, Encoder[0].Field);
+	Encoder[0].State = ENCODER_READY;
+
+	Version = Published.load();
+
+	return true;
+}
+
+bool MonitorPublisher::SetCarTag(uint8_t Car, const char *Tag) {
+
+	if ((Car >= MONITOR_MAX_CARS) || Started.load()) {
+		return false;
+	}
+	snprintf(CarTag[Car], MONITOR_CAR_TAG_SIZE, "%s", Tag);
+	// tags are baked into the encoders
+	return Begin(Cars);
+}
+
+uint8_t MonitorPublisher::GetCars() const {
+	return Cars;
+}
+
+bool MonitorPublisher::PublishEncoder(MonitorEncoder &Enc, const MonitorData &Data) {
+
+	MonitorSnapshot *cur = Enc.Current.load();
+	MonitorSnapshot *next = NULL;
+	uint8_t i;
+
+	// any slot that is not current and that no client is sending is ours to rewrite
+	// a client that grabbed it just before it stopped being current will see Current moved and let go
+	for (i = 0; i < MONITOR_SNAPSHOTS; i++) {
+		if ((&Enc.Slot[i] != cur) && (Enc.Slot[i].Readers.load() == 0)) {
+			next = &Enc.Slot[i];
+			break;
+		}
+	}
+
+	if (next == NULL) {
+		Skipped++;
+		return false;
+	}
+
+	next->Length = Encode(Enc.Field, Enc.FieldCount, Data, next->XML, MONITOR_XML_SIZE);
+	next->Version = Version;
+
+	// publish, everything written above is visible to whoever loads the new pointer
+	Enc.Current.store(next);
+
+	return true;
+}
+
+uint32_t MonitorPublisher::Publish(const MonitorData &Data) {
+
+	uint8_t i, j;
+	bool busy;
+
+	if (!Started.load()) {
+		Started = true;
+	}
+	Version++;
+
+	if (!PublishEncoder(Encoder[0], Data)) {
+		return 0;
+	}
+
+	for (i = 1; i < MONITOR_ENCODERS; i++) {
+
+		MonitorEncoder &enc = Encoder[i];
+
+		if (enc.State.load() != ENCODER_READY) {
+			continue;
+		}
+
+		// nobody has asked for this one in a while, hand the encoder back once no one is sending it
+		if (Version - enc.LastUsed.load() > MONITOR_ENCODER_IDLE) {
+			busy = false;
+			for (j = 0; j < MONITOR_SNAPSHOTS; j++) {
+				busy |= (enc.Slot[j].Readers.load() != 0);
+			}
+			if (!busy) {
+				enc.State = ENCODER_FREE;
+				continue;
+			}
+		}
+
+		PublishEncoder(enc, Data);
+	}
+
+	Published = Version;
+
+	return Version;
+}
+
+// finds the encoder for a subscription or builds one in a free spot, NULL if all are taken
+MonitorEncoder *MonitorPublisher::Subscribe(uint16_t Channels, uint32_t CarMask) {
+
+	uint8_t i;
+	uint8_t expected;
+
+	for (i = 0; i < MONITOR_ENCODERS; i++) {
+		if ((Encoder[i].State.load() == ENCODER_READY) && (Encoder[i].Channels == Channels) && (Encoder[i].Cars == CarMask)) {
+			return &Encoder[i];
+		}
+	}
+
+	for (i = 1; i < MONITOR_ENCODERS; i++) {
+		expected = ENCODER_FREE;
+		if (Encoder[i].State.compare_exchange_strong(expected, ENCODER_BUILDING)) {
+			Encoder[i].Channels = Channels;
+			Encoder[i].Cars = CarMask;
+			Encoder[i].FieldCount = BuildEncoder(Channels, CarMask, Encoder[i].Field);
+			Encoder[i].Since = Published.load();
+			Encoder[i].LastUsed = Encoder[i].Since.load();
+			Encoder[i].State = ENCODER_READY;
+			return &Encoder[i];
+		}
+	}
+
+	return NULL;
+}
+
+const MonitorSnapshot *MonitorPublisher::Acquire(uint16_t Channels, uint32_t CarMask) {
+
+	MonitorEncoder *enc;
+	MonitorSnapshot *snap;
+	// a shift by 32 is undefined, so a full table is spelled out
+	uint32_t all = (Cars < 32) ? (((uint32_t) 1 << Cars) - 1) : 0xFFFFFFFF;
+
+	if (!Started.load()) {
+		Started = true;
+	}
+	Channels = (Channels & MON_CH_ALL) | MON_CH_CORE;
+	CarMask &= all;
+	if ((Channels == MON_CH_ALL) && (CarMask == all)) {
+		CarMask = MON_CARS_ALL;
+	}
+
+	enc = Subscribe(Channels, CarMask);
+	if (enc) {
+		enc->LastUsed = Published.load();
+	}
+
+	// not built yet or nothing published for it yet (the slots may still hold a previous
+	// subscription), the full document is a fine answer
+	if ((enc == NULL) || (enc->Current.load()->Version <= enc->Since.load())) {
+		enc = &Encoder[0];
+	}
+
+	while (true) {
+		snap = enc->Current.load();
+		snap->Readers++;
+		// if the writer swapped in between, this slot may be getting rewritten, drop it and retry
+		// if the encoder was handed to another subscription, fall back to the full document
+		if ((snap == enc->Current.load()) && (enc == &Encoder[0] || ((enc->State.load() == ENCODER_READY) && (enc->Channels == Channels) && (enc->Cars == CarMask)))) {
+			return snap;
+		}
+		snap->Readers--;
+		if (snap == enc->Current.load()) {
+			enc = &Encoder[0];
+		}
+	}
+}
+
+void MonitorPublisher::Release(const MonitorSnapshot *Snap) {
+
+	if (Snap) {
+		Snap->Readers--;
+	}
+}
+
+uint32_t MonitorPublisher::GetVersion() const {
+	return Published.load();
+}
+
+uint32_t MonitorPublisher::GetSkipped() const {
+	return Skipped.load();
+}
+
+uint8_t MonitorPublisher::GetSubscriptions() const {
+
+	uint8_t i;
+	uint8_t count = 0;
+
+	for (i = 0; i < MONITOR_ENCODERS; i++) {
+		count += (Encoder[i].State.load() == ENCODER_READY) ? 1 : 0;
+	}
+	return count;
+}
@@ -0,0 +1,212 @@
+/*
+
+	Program name: Bob Jones Patriot Racing race monitor (base station web server)
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, snapshot-once / fan-out-many publication of car state
+	1.1    Kris 	10/19/2026	per client channel / car subscriptions with a precomputed encoder per mask
+	2.0    Kris 	10/19/2026	any number of cars (set at runtime) in a structure-of-arrays car table
+	2.1    Kris 	10/19/2026	floats in the xml clamped to 4e9 scaled, NaN sent as the text NaN
+	2.2    Kris 	10/19/2026	Begin and SetCarTag are setup only, they refuse once the tasks have started
+
+*/
+
+#ifndef PATRIOT_RACING_MONITOR_H
+#define PATRIOT_RACING_MONITOR_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include <atomic>
+
+#define MONITOR_VERSION 2.2
+
+/*
+
+the race monitor receives car data over the EBYTE, decodes it and serves it to the web page (TestPage.html)
+the page polls the "xml" endpoint every 50 ms, and each poll used to read all the car data and build
+the ~115 tag xml response from scratch, so the work grew with the number of browsers on the network
+
+now the receive side builds the xml once per update (Publish) into an immutable, versioned snapshot
+and the web handler just hands out the bytes of the latest one (Acquire / Release). a slot is only
+rewritten once no web client is still holding it (read-copy-update), so readers never block the radio
+and never see a half written document
+
+clients that only display some channels (the check boxes on the page) or some cars say so in the
+request (?ch=...&car=...). each distinct subscription gets an encoder, a precomputed list of the
+fields it wants with their tags already rendered, and its own set of snapshots. publishing
+serializes once per active subscription, not once per client, and each client only gets the bytes
+it asked for. subscriptions nobody asked for in a while are dropped so the encoder can be reused
+
+the car table is sized at compile time (MONITOR_MAX_CARS) but how many cars are used is set at
+runtime, so the same server handles our three cars at the track or a full field on the test bench.
+car tags come from the car index, so adding a car doesn't mean adding ~25 xml tags by hand
+
+*/
+
+#ifndef MONITOR_MAX_CARS
+ #define MONITOR_MAX_CARS 8    // cars the table can hold, Begin picks how many are used (32 max)
+#endif
+#define MONITOR_CARS 3        // our cars, index by BLUE_CAR, RED_CAR, WHITE_CAR
+#define RM_CARS 8             // cars in the race monitor standings block (C0..C7)
+#define MONITOR_XML_SIZE (1024 + 640 * MONITOR_MAX_CARS)  // max size of one serialized response
+#define MONITOR_SNAPSHOTS 3   // current + one being built + one still held by a slow client
+#define MONITOR_ENCODERS 4    // subscriptions served at once, encoder 0 is always everything
+#define MONITOR_ENCODER_IDLE 200  // publishes without a request before a subscription is dropped
+#define MONITOR_CAR_FIELDS 24
+#define MONITOR_MAX_FIELDS (3 + MONITOR_CAR_FIELDS * MONITOR_MAX_CARS + 5 * RM_CARS)
+#define MONITOR_TAG_SIZE 8
+#define MONITOR_CAR_TAG_SIZE 4
+
+// channels a client can subscribe to, roughly the check boxes on the page
+#define MON_CH_CORE			0x0001	// RT, F_S, F_SLT, _WW, _HD, _DR, _DN, _PD (always sent)
+#define MON_CH_TABLE		0x0002	// data table, _A _D _DTS _L2 _R _ER _TR _D0T _D1T _D2T
+#define MON_CH_VOLTS		0x0004	// checkVolts, _V
+#define MON_CH_LAPAMPS		0x0008	// checkLAmps, _LA
+#define MON_CH_LAPENERGY	0x0010	// checkLNRG, _LE
+#define MON_CH_GFORCE		0x0020	// checkGForce, _GF
+#define MON_CH_TEMP			0x0040	// checkTemp, _TF _TX
+#define MON_CH_SPEED		0x0080	// checkSpeed, _CS
+#define MON_CH_LAPTIME		0x0100	// checkLTime / checkDDP, C#LT C#BLT
+#define MON_CH_ENERGY		0x0200	// checkEnergy / checkRate, _E and the TE total
+#define MON_CH_STANDINGS	0x0400	// C#N C#L C#P
+#define MON_CH_ALL			0x07FF
+
+#define MON_CARS_ALL 0xFFFFFFFF   // car mask, bit n is car n in the table
+
+// race monitor timing data (was the rev 9 race monitor struct)
+struct RaceMonitorCar {
+	uint16_t Number;			// C#N car number
+	uint16_t Laps;				// C#L laps completed
+	float LapTime;				// C#LT last lap time (sec)
+	float BestLapTime;			// C#BLT best lap time (sec)
+	uint8_t Pos;				// C#P position in the race
+};
+
+// the car table, one array per field, [car] is the car index (our cars are BLUE_CAR, RED_CAR, WHITE_CAR)
+// values are already decoded from the Transceiver struct, the tag is the car prefix + the comment
+struct MonitorCars {
+	uint16_t Warnings[MONITOR_MAX_CARS];		// _WW warning bits (KEY_OFF, GPS_WARNING, ...)
+	float Volts[MONITOR_MAX_CARS];				// _V
+	float DistToStart[MONITOR_MAX_CARS];		// _DTS distance to start line (m)
+	float LapEnergy[MONITOR_MAX_CARS];			// _LE
+	float Amps[MONITOR_MAX_CARS];				// _A
+	float Distance[MONITOR_MAX_CARS];			// _D
+	float Lap2Amps[MONITOR_MAX_CARS];			// _L2 target amps
+	uint16_t RPM[MONITOR_MAX_CARS];				// _R
+	float Energy[MONITOR_MAX_CARS];				// _E
+	int16_t EnergyRemain[MONITOR_MAX_CARS];		// _ER percent
+	int16_t TempF[MONITOR_MAX_CARS];			// _TF motor temp
+	int16_t TempX[MONITOR_MAX_CARS];			// _TX aux temp
+	float Speed[MONITOR_MAX_CARS];				// _CS
+	uint8_t TimeRemain[MONITOR_MAX_CARS];		// _TR percent
+	uint16_t D0Time[MONITOR_MAX_CARS];			// _D0T driver 0 time (min)
+	uint16_t D1Time[MONITOR_MAX_CARS];			// _D1T
+	uint16_t D2Time[MONITOR_MAX_CARS];			// _D2T
+	float GForce[MONITOR_MAX_CARS];				// _GF
+	float LapAmps[MONITOR_MAX_CARS];			// _LA
+	uint8_t Driver[MONITOR_MAX_CARS];			// _DR current driver id
+	uint8_t PitDriver[MONITOR_MAX_CARS];		// _PD driver change / track flag
+	uint8_t DriverNumber[MONITOR_MAX_CARS];		// _DN
+	uint8_t HaveData[MONITOR_MAX_CARS];			// _HD 1 if we heard from the car recently
+	uint16_t TotalEnergy[MONITOR_MAX_CARS];		// TE (RTE, WTE, BTE)
+};
+
+// everything one xml response carries
+struct MonitorData {
+	uint16_t RaceTime;			// RT seconds
+	uint8_t FlagStatus;			// F_S (FLAG_NONE, FLAG_GREEN, ...)
+	uint16_t LapTimeScale;		// F_SLT y scale for the lap time plot
+	MonitorCars Car;
+	RaceMonitorCar RM[RM_CARS];
+};
+
+// one immutable, already serialized response
+struct MonitorSnapshot {
+	uint32_t Version;			// 0 means never published
+	uint16_t Length;			// bytes in XML (not counting the null)
+	char XML[MONITOR_XML_SIZE];
+	mutable std::atomic<uint16_t> Readers;	// web clients currently sending this slot
+};
+
+// one precomputed field of an encoder
+struct MonitorEncoderField {
+	uint16_t Offset;			// where the value is in MonitorData
+	uint8_t Type;				// MON_U8, ...
+	uint8_t Decimals;
+	char Tag[MONITOR_TAG_SIZE];
+};
+
+#define ENCODER_FREE 0
+#define ENCODER_BUILDING 1
+#define ENCODER_READY 2
+
+// everything one subscription needs, built once when the first client asks for it
+struct MonitorEncoder {
+	std::atomic<uint8_t> State;		// ENCODER_FREE, ...
+	uint16_t Channels;
+	uint32_t Cars;
+	std::atomic<uint32_t> LastUsed;	// publisher version at the last request
+	std::atomic<uint32_t> Since;	// publisher version when the subscription was built
+	uint16_t FieldCount;
+	MonitorEncoderField Field[MONITOR_MAX_FIELDS];
+	MonitorSnapshot Slot[MONITOR_SNAPSHOTS];
+	std::atomic<MonitorSnapshot *> Current;
+};
+
+class MonitorPublisher {
+
+public:
+
+	MonitorPublisher();
+
+	// how many cars are in the table, call in setup before the web server starts
+	// both of these rebuild every encoder, which Acquire and Publish read without a lock, so once
+	// either of those has run they leave everything as it is and return false
+	bool Begin(uint8_t Cars);
+	// tag prefix for a car, defaults are B, R, W for our cars and T3, T4, ... for the rest
+	bool SetCarTag(uint8_t Car, const char *Tag);
+	uint8_t GetCars() const;
+
+	// receive side, call once per decoded update
+	// returns the new version, or 0 if every spare slot is still held by a client (try again next update)
+	uint32_t Publish(const MonitorData &Data);
+
+	// web side, call per request, send Snap->XML / Snap->Length then Release it
+	// never returns NULL, before the first Publish the snapshot is an empty <Data/> document
+	// a new subscription gets the full document until its own encoder has published once
+	const MonitorSnapshot *Acquire(uint16_t Channels = MON_CH_ALL, uint32_t Cars = MON_CARS_ALL);
+	void Release(const MonitorSnapshot *Snap);
+
+	uint32_t GetVersion() const;
+	uint32_t GetSkipped() const;
+	uint8_t GetSubscriptions() const;
+
+	// builds the full xml for Data into Buffer, returns the length
+	uint16_t Serialize(const MonitorData &Data, char *Buffer, uint16_t Size) const;
+
+	// builds the field list for a subscription, returns the number of fields
+	uint16_t BuildEncoder(uint16_t Channels, uint32_t Cars, MonitorEncoderField *Field) const;
+	static uint16_t Encode(const MonitorEncoderField *Field, uint16_t Count, const MonitorData &Data, char *Buffer, uint16_t Size);
+
+private:
+
+	MonitorEncoder *Subscribe(uint16_t Channels, uint32_t Cars);
+	bool PublishEncoder(MonitorEncoder &Enc, const MonitorData &Data);
+	void InitEncoder(MonitorEncoder &Enc);
+
+	MonitorEncoder Encoder[MONITOR_ENCODERS];
+	char CarTag[MONITOR_MAX_CARS][MONITOR_CAR_TAG_SIZE];
+	uint8_t Cars;
+	uint32_t Version;
+	std::atomic<uint32_t> Published;
+	std::atomic<uint32_t> Skipped;
+	std::atomic<bool> Started;		// a Publish or Acquire has run, no more Begin / SetCarTag
+
+};
+
+#endif
@@ -0,0 +1,330 @@
+#include "PatriotRacing_MonitorTasks.h"
+
+#include <string.h>
+
+#ifdef ESP32
+ #include "freertos/FreeRTOS.h"
+ #include "freertos/task.h"
+#else
+ #include <thread>
+ #include <chrono>
+#endif
+
+// frame parser steps
+#define ET_WAIT_HEADER1 0
+#define ET_WAIT_HEADER2 1
+#define ET_WAIT_LENGTH 2
+#define ET_PAYLOAD 3
+#define ET_CHECKSUM 4
+
+MonitorState::MonitorState() {
+
+	memset(Buffer, 0, sizeof(Buffer));
+	Seq[0] = 0;
+	Seq[1] = 0;
+	Front = 0;
+	Version = 0;
+	Retries = 0;
+}
+
+// seqlock on each half, the radio only ever writes the half that isn't front so a reader is only
+// disturbed if two commits land while it's copying
+void MonitorState::Commit(const MonitorData &Data) {
+
+	uint8_t back = Front.load(std::memory_order_relaxed) ^ 1;
+	uint32_t seq = Seq[back].load(std::memory_order_relaxed);
+
+	Seq[back].store(seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	memcpy(&Buffer[back], &Data, sizeof(MonitorData));
+
+	Seq[back].store(seq + 2, std::memory_order_release);
+	Front.store(back, std::memory_order_release);
+	Version.fetch_add(1, std::memory_order_release);
+}
+
+uint32_t MonitorState::Read(MonitorData &Data) {
+
+	uint8_t front;
+	uint32_t before, after, version;
+
+	while (true) {
+		version = Version.load(std::memory_order_acquire);
+		front = Front.load(std::memory_order_acquire);
+		before = Seq[front].load(std::memory_order_acquire);
+
+		if ((before & 1) == 0) {
+			memcpy(&Data, &Buffer[front], sizeof(MonitorData));
+			std::atomic_thread_fence(std::memory_order_acquire);
+			after = Seq[front].load(std::memory_order_relaxed);
+			if (before == after) {
+				return version;
+			}
+		}
+		Retries.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+uint32_t MonitorState::GetVersion() const {
+	return Version.load(std::memory_order_acquire);
+}
+
+uint32_t MonitorState::GetRetries() const {
+	return Retries.load(std::memory_order_relaxed);
+}
+
+MonitorRadio::MonitorRadio(MonitorState &State, MonitorDecode Decode) : State(State), Decode(Decode) {
+
+	memset(&Work, 0, sizeof(Work));
+	Stats.Bytes = 0;
+	Stats.Frames = 0;
+	Stats.Dropped = 0;
+	Stats.BadChecksum = 0;
+	Stats.BadLength = 0;
+	Stats.Overruns = 0;
+	Stats.MaxBacklog = 0;
+	Step = ET_WAIT_HEADER1;
+	Length = 0;
+	Count = 0;
+	Checksum = 0;
+}
+
+// counters only have one writer so relaxed load + store is enough (the web side just reads them)
+static void Bump(std::atomic<uint32_t> &Counter, uint32_t Amount = 1) {
+	Counter.store(Counter.load(std::memory_order_relaxed) + Amount, std::memory_order_relaxed);
+}
+
+void MonitorRadio::Feed(const uint8_t *Data, uint16_t Length) {
+
+	uint16_t i;
+	uint8_t b;
+
+	Bump(Stats.Bytes, Length);
+
+	for (i = 0; i < Length; i++) {
+		b = Data[i];
+
+		switch (Step) {
+			case ET_WAIT_HEADER1:
+				if (b == ET_HEADER1) {
+					Step = ET_WAIT_HEADER2;
+				}
+				break;
+			case ET_WAIT_HEADER2:
+				if (b == ET_HEADER2) {
+					Step = ET_WAIT_LENGTH;
+				}
+				else {
+					Step = (b == ET_HEADER1) ? ET_WAIT_HEADER2 : ET_WAIT_HEADER1;
+				}
+				break;
+			case ET_WAIT_LENGTH:
+				if ((b == 0) || (b > MONITOR_MAX_PAYLOAD)) {
+					Bump(Stats.BadLength);
+					Step = ET_WAIT_HEADER1;
+					break;
+				}
+				this->Length = b;
+				Checksum = b;
+				Count = 0;
+				Step = ET_PAYLOAD;
+				break;
+			case ET_PAYLOAD:
+				Payload[Count++] = b;
+				Checksum ^= b;
+				if (Count == this->Length) {
+					Step = ET_CHECKSUM;
+				}
+				break;
+			case ET_CHECKSUM:
+				if (b == Checksum) {
+					Frame();
+				}
+				else {
+					Bump(Stats.BadChecksum);
+				}
+				Step = ET_WAIT_HEADER1;
+				break;
+		}
+	}
+}
+
+void MonitorRadio::Frame() {
+
+	if ((Decode == NULL) || !Decode(Payload, Length, Work)) {
+		Bump(Stats.Dropped);
+		return;
+	}
+
+	Bump(Stats.Frames);
+	State.Commit(Work);
+}
+
+void MonitorRadio::Backlog(uint16_t Waiting, uint16_t Capacity) {
+
+	if (Waiting > Stats.MaxBacklog.load(std::memory_order_relaxed)) {
+		Stats.MaxBacklog.store(Waiting, std::memory_order_relaxed);
+	}
+	// a full buffer means the next byte had nowhere to go
+	if ((Capacity > 0) && (Waiting >= Capacity)) {
+		Overrun();
+	}
+}
+
+void MonitorRadio::Overrun() {
+	Bump(Stats.Overruns);
+}
+
+MonitorData &MonitorRadio::GetData() {
+	return Work;
+}
+
+const MonitorRadioStats &MonitorRadio::GetStats() const {
+	return Stats;
+}
+
+MonitorWeb::MonitorWeb(MonitorState &State, MonitorPublisher &Publisher) : State(State), Publisher(Publisher) {
+
+	memset(&Copy, 0, sizeof(Copy));
+	Seen = 0;
+	Published = 0;
+}
+
+bool MonitorWeb::Poll() {
+
+	uint32_t version = State.GetVersion();
+
+	if (version == Seen) {
+		return false;
+	}
+
+	// if every spare slot is held we keep Seen so the next poll tries again
+	version = State.Read(Copy);
+	if (Publisher.Publish(Copy) == 0) {
+		return false;
+	}
+
+	Seen = version;
+	Published++;
+	return true;
+}
+
+uint32_t MonitorWeb::GetPublished() const {
+	return Published;
+}
+
+void MonitorRadioStep(MonitorTaskConfig &Config) {
+
+	uint8_t buf[MONITOR_UART_CHUNK];
+	uint16_t waiting = 0;
+	uint16_t n = Config.Read(buf, sizeof(buf), &waiting);
+
+	if (n == 0) {
+		return;
+	}
+	// what was in the UART when we got here, our bytes plus what's still queued
+	Config.Radio->Backlog(n + waiting, Config.UARTSize);
+	Config.Radio->Feed(buf, n);
+}
+
+void MonitorWebStep(MonitorTaskConfig &Config) {
+
+	Config.Web->Poll();
+	if (Config.Serve != NULL) {
+		Config.Serve();
+	}
+}
+
+#ifdef ESP32
+
+static TaskHandle_t RadioTask = NULL;
+static TaskHandle_t WebTask = NULL;
+
+static void RadioTaskLoop(void *Param) {
+
+	MonitorTaskConfig &config = *(MonitorTaskConfig *) Param;
+
+	while (config.Run.load(std::memory_order_relaxed)) {
+		MonitorRadioStep(config);
+		// one tick is ~1 ms, 10 bytes at 9600 baud, well under the UART buffer
+		vTaskDelay(1);
+	}
+	RadioTask = NULL;
+	vTaskDelete(NULL);
+}
+
+static void WebTaskLoop(void *Param) {
+
+	MonitorTaskConfig &config = *(MonitorTaskConfig *) Param;
+
+	while (config.Run.load(std::memory_order_relaxed)) {
+		MonitorWebStep(config);
+		vTaskDelay(1);
+	}
+	WebTask = NULL;
+	vTaskDelete(NULL);
+}
+
+bool MonitorStartTasks(MonitorTaskConfig &Config) {
+
+	Config.Run = true;
+
+	if (xTaskCreatePinnedToCore(RadioTaskLoop, "radio", MONITOR_RADIO_STACK, &Config, MONITOR_RADIO_PRIORITY, &RadioTask, MONITOR_RADIO_CORE) != pdPASS) {
+		Config.Run = false;
+		return false;
+	}
+	if (xTaskCreatePinnedToCore(WebTaskLoop, "web", MONITOR_WEB_STACK, &Config, MONITOR_WEB_PRIORITY, &WebTask, MONITOR_WEB_CORE) != pdPASS) {
+		Config.Run = false;
+		return false;
+	}
+	return true;
+}
+
+void MonitorStopTasks(MonitorTaskConfig &Config) {
+
+	// tasks delete themselves at the end of their current pass
+	Config.Run = false;
+	while ((RadioTask != NULL) || (WebTask != NULL)) {
+		vTaskDelay(1);
+	}
+}
+
+#else
+
+static std::thread RadioThread;
+static std::thread WebThread;
+
+bool MonitorStartTasks(MonitorTaskConfig &Config) {
+
+	Config.Run = true;
+
+	RadioThread = std::thread([&Config]() {
+		while (Config.Run.load(std::memory_order_relaxed)) {
+			MonitorRadioStep(Config);
+			std::this_thread::sleep_for(std::chrono::microseconds(500));
+		}
+	});
+
+	WebThread = std::thread([&Config]() {
+		while (Config.Run.load(std::memory_order_relaxed)) {
+			MonitorWebStep(Config);
+			std::this_thread::yield();
+		}
+	});
+
+	return true;
+}
+
+void MonitorStopTasks(MonitorTaskConfig &Config) {
+
+	Config.Run = false;
+	if (RadioThread.joinable()) {
+		RadioThread.join();
+	}
+	if (WebThread.joinable()) {
+		WebThread.join();
+	}
+}
+
+#endif
@@ -0,0 +1,175 @@
+/*
+
+	Program name: Bob Jones Patriot Racing race monitor (base station web server)
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, radio and web server on separate ESP32 cores
+
+*/
+
+#ifndef PATRIOT_RACING_MONITORTASKS_H
+#define PATRIOT_RACING_MONITORTASKS_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include <atomic>
+#include "PatriotRacing_Monitor.h"
+
+#define MONITORTASKS_VERSION 1.0
+
+/*
+
+the monitor used to drain the EBYTE UART and serve the web page from the same loop, so a long http
+send (PAGE_MAIN is ~30k) held off reading the radio and the UART buffer overran
+
+now the radio task drains the UART and decodes frames on one core and the web task serves http on the
+other. the only thing they share is MonitorState, a double buffer of the car data: the radio writes the
+buffer the web isn't reading and flips, and never waits. the web side copies the front buffer and
+retries if the radio flipped twice while it was copying (it can't, at 50 ms per packet, but it's counted)
+
+the web task then publishes that copy through MonitorPublisher, so all xml serialization is on the web core
+
+the same code runs on the PC with two std::threads (PatriotRacing_Tools/MonitorTasksHost.cpp)
+
+*/
+
+#ifdef ESP32
+ #define MONITOR_RADIO_CORE 1     // APP_CPU, nothing else runs here once loop() is parked
+ #define MONITOR_WEB_CORE 0       // PRO_CPU, next to the WiFi stack
+#endif
+#define MONITOR_RADIO_STACK 4096
+#define MONITOR_WEB_STACK 8192
+#define MONITOR_RADIO_PRIORITY 5  // above the web task so a burst of requests can't starve it
+#define MONITOR_WEB_PRIORITY 2
+#define MONITOR_UART_CHUNK 64     // bytes read from the UART per pass
+#define MONITOR_MAX_PAYLOAD 64    // largest frame we accept (Transceiver is 40)
+
+// EasyTransfer framing, what the cars send
+#define ET_HEADER1 0x06
+#define ET_HEADER2 0x85
+
+// the car data shared between the two cores, one writer (radio) one reader (web)
+class MonitorState {
+
+public:
+
+	MonitorState();
+
+	// radio side, Commit copies Data into the back buffer and makes it current, never blocks
+	void Commit(const MonitorData &Data);
+
+	// web side, copies the latest data, returns its version (0 = nothing committed yet)
+	uint32_t Read(MonitorData &Data);
+
+	uint32_t GetVersion() const;
+	uint32_t GetRetries() const;
+
+private:
+
+	MonitorData Buffer[2];
+	std::atomic<uint32_t> Seq[2];		// odd while the radio is writing that buffer
+	std::atomic<uint8_t> Front;
+	std::atomic<uint32_t> Version;
+	std::atomic<uint32_t> Retries;		// web copies that had to start over
+
+};
+
+// decodes one frame payload (a Transceiver struct) into the car table, returns false to drop it
+// the sketch supplies this, the bit packing and scaling of the Transceiver fields live in the car code
+typedef bool (*MonitorDecode)(const uint8_t *Payload, uint8_t Length, MonitorData &Data);
+
+// counters for the receive side, all written by the radio task only
+struct MonitorRadioStats {
+	std::atomic<uint32_t> Bytes;
+	std::atomic<uint32_t> Frames;			// good frames decoded
+	std::atomic<uint32_t> Dropped;			// good checksum but the decoder rejected it
+	std::atomic<uint32_t> BadChecksum;
+	std::atomic<uint32_t> BadLength;
+	std::atomic<uint32_t> Overruns;		// the UART buffer filled (or the driver told us it overflowed)
+	std::atomic<uint32_t> MaxBacklog;		// most bytes waiting in the UART at one read, how close we got
+};
+
+// the receive / decode stage, byte at a time frame parser so a partial frame never blocks
+class MonitorRadio {
+
+public:
+
+	MonitorRadio(MonitorState &State, MonitorDecode Decode);
+
+	// feed bytes as they come off the UART, Backlog is what the UART had waiting when we read
+	void Feed(const uint8_t *Data, uint16_t Length);
+	void Backlog(uint16_t Waiting, uint16_t Capacity);
+	// call from the UART error callback (ESP32 onReceiveError) or when the port reports a lost byte
+	void Overrun();
+
+	// the decoder's working copy, setup code can fill in things that don't come over the radio
+	MonitorData &GetData();
+	const MonitorRadioStats &GetStats() const;
+
+private:
+
+	void Frame();
+
+	MonitorState &State;
+	MonitorDecode Decode;
+	MonitorData Work;
+	MonitorRadioStats Stats;
+
+	uint8_t Step;			// where we are in the frame
+	uint8_t Length;
+	uint8_t Count;
+	uint8_t Checksum;
+	uint8_t Payload[MONITOR_MAX_PAYLOAD];
+
+};
+
+// the web side of the hand off, call Poll before serving a request (or once per web task pass)
+class MonitorWeb {
+
+public:
+
+	MonitorWeb(MonitorState &State, MonitorPublisher &Publisher);
+
+	// publishes the latest car data if the radio has committed since the last call, returns true if it did
+	bool Poll();
+
+	uint32_t GetPublished() const;
+
+private:
+
+	MonitorState &State;
+	MonitorPublisher &Publisher;
+	MonitorData Copy;
+	uint32_t Seen;
+	uint32_t Published;
+
+};
+
+// where the tasks get their bytes and do their work, so the same loop runs on the ESP32 and the PC
+// Read returns how many bytes it put in Buffer (0 if none), Waiting is how many are still in the UART
+typedef uint16_t (*MonitorRead)(uint8_t *Buffer, uint16_t Size, uint16_t *Waiting);
+typedef void (*MonitorServe)();
+
+struct MonitorTaskConfig {
+	MonitorRadio *Radio;
+	MonitorWeb *Web;
+	MonitorRead Read;
+	uint16_t UARTSize;			// rx buffer size of the port, for the backlog / overrun check
+	MonitorServe Serve;			// e.g. server.handleClient(), NULL for an async server
+	std::atomic<bool> Run;
+};
+
+// one pass of each task, the task bodies just call these forever
+void MonitorRadioStep(MonitorTaskConfig &Config);
+void MonitorWebStep(MonitorTaskConfig &Config);
+
+// starts both tasks (pinned to their cores on the ESP32, std::thread on the PC)
+bool MonitorStartTasks(MonitorTaskConfig &Config);
+void MonitorStopTasks(MonitorTaskConfig &Config);
+
+#endif
@@ -0,0 +1,110 @@
+#include "PatriotRacing_NumberField.h"
+
+#include <string.h>
+
+NumberField::NumberField() {
+
+	Cache = NULL;
+	X = 0;
+	Y = 0;
+	Justify = NUMBERFIELD_LEFT;
+	Shown[0] = '\0';
+	Length = 0;
+	Left = 0;
+	Right = 0;
+}
+
+void NumberField::Begin(GlyphCache &Cache, int16_t X, int16_t Y, uint8_t Justify) {
+
+	this->Cache = &Cache;
+	this->X = X;
+	this->Y = Y;
+	this->Justify = Justify;
+	Shown[0] = '\0';
+	Length = 0;
+	Left = 0;
+	Right = 0;
+}
+
+// the cells move, Print sees they're not where they were and redraws them
+void NumberField::SetJustify(uint8_t Justify) {
+	this->Justify = Justify;
+}
+
+// forget the cells but keep the extent so a shorter value still clears what was there
+void NumberField::Invalidate() {
+	Shown[0] = '\0';
+	Length = 0;
+}
+
+const char *NumberField::GetText() const {
+	return Shown;
+}
+
+uint8_t NumberField::Format(float Value, uint8_t Decimals, char *Buffer, uint8_t Size) {
+
+	char digits[12];
+	uint32_t scale = 1;
+	uint32_t whole, frac, v;
+	uint8_t n = 0;
+	uint8_t len = 0;
+	uint8_t i;
+	bool neg = Value < 0.0f;
+
+	if (Size == 0) {
+		return 0;
+	}
+	if (Decimals > 6) {
+		Decimals = 6;
+	}
+	for (i = 0; i < Decimals; i++) {
+		scale *= 10;
+	}
+
+	// NaN gets past every compare below and can't be cast, show dashes and not a made up 0.0
+	if (Value != Value) {
+		for (; (len < sizeof(NUMBERFIELD_NAN) - 1) && (len < Size - 1); len++) {
+			Buffer[len] = NUMBERFIELD_NAN[len];
+		}
+		Buffer[len] = '\0';
+		return len;
+	}
+
+	if (neg) {
+		Value = -Value;
+	}
+	// anything that won't fit in 32 bits can't fit on the screen either
+	if (Value * scale > 4.0e9f) {
+		Value = 4.0e9f / scale;
+	}
+	v = (uint32_t) (Value * scale + 0.5f);
+	whole = v / scale;
+	frac = v % scale;
+
+	// don't show -0.0
+	if (neg && (v != 0) && (len < Size - 1)) {
+		Buffer[len++] = '-';
+	}
+
+	do {
+		digits[n++] = '0' + (whole % 10);
+		whole /= 10;
+	} while (whole && (n < sizeof(digits)));
+	while (n && (len < Size - 1)) {
+		Buffer[len++] = digits[--n];
+	}
+
+	if (Decimals && (len < Size - 1)) {
+		Buffer[len++] = '.';
+		for (i = Decimals; i > 0; i--) {
+			digits[i - 1] = '0' + (frac % 10);
+			frac /= 10;
+		}
+		for (i = 0; (i < Decimals) && (len < Size - 1); i++) {
+			Buffer[len++] = digits[i];
+		}
+	}
+
+	Buffer[len] = '\0';
+	return len;
+}
@@ -0,0 +1,167 @@
+/*
+
+	Program name: Bob Jones Patriot Racing numeric readout
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, only redraw the digits that changed
+	1.1    Kris 	10/19/2026	NaN (a sensor that isn't there) shows as NUMBERFIELD_NAN, not 0.0
+
+*/
+
+#ifndef PATRIOT_RACING_NUMBERFIELD_H
+#define PATRIOT_RACING_NUMBERFIELD_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include "PatriotRacing_GlyphCache.h"
+
+#define NUMBERFIELD_VERSION 1.1
+
+/*
+
+the big readouts (DATA_Y, LADATA_X / LADATA_Y) used to erase the whole value and print it again, so
+23.4 -> 23.5 flickered and pushed every pixel of all four digits. a NumberField remembers what it
+drew and where each glyph cell went, and on the next Print only pushes cells whose char or
+position changed, then clears any strip the old value covered that the new one doesn't
+
+with right justification (TextJustifyText "Right") the value grows to the left, so when the width
+changes the cells all move and get redrawn, but 23.4 -> 23.5 is still one cell either way
+
+the cells come from a GlyphCache so each one includes its own background, nothing is erased first
+
+*/
+
+#define NUMBERFIELD_CHARS 12         // longest value
+#define NUMBERFIELD_LEFT 0           // same order as TextJustifyText
+#define NUMBERFIELD_RIGHT 1
+#define NUMBERFIELD_NAN "--"         // what Format gives for NaN, blank if the cache has no '-'
+
+class NumberField {
+
+public:
+
+	NumberField();
+
+	// X is the left edge (NUMBERFIELD_LEFT) or right edge (NUMBERFIELD_RIGHT), Y the top of the cells
+	void Begin(GlyphCache &Cache, int16_t X, int16_t Y, uint8_t Justify);
+	void SetJustify(uint8_t Justify);
+
+	// next Print draws everything (screen was cleared, theme changed)
+	void Invalidate();
+
+	// returns the pixels pushed, 0 if nothing changed
+	template <class Display>
+	uint32_t Print(Display &D, const char *Text);
+
+	template <class Display>
+	uint32_t Print(Display &D, float Value, uint8_t Decimals);
+
+	const char *GetText() const;
+
+	// Value as text with Decimals places, no printf so it works the same on every board
+	static uint8_t Format(float Value, uint8_t Decimals, char *Buffer, uint8_t Size);
+
+private:
+
+	GlyphCache *Cache;
+	int16_t X;
+	int16_t Y;
+	uint8_t Justify;
+
+	char Shown[NUMBERFIELD_CHARS + 1];		// what's on the screen
+	int16_t Pos[NUMBERFIELD_CHARS];			// x of each cell
+	uint8_t Length;
+	int16_t Left;							// what the old value covered
+	int16_t Right;
+
+};
+
+template <class Display>
+uint32_t NumberField::Print(Display &D, const char *Text) {
+
+	int16_t pos[NUMBERFIELD_CHARS];
+	char text[NUMBERFIELD_CHARS + 1];
+	uint8_t len = 0;
+	uint8_t i, j;
+	int16_t width, left, right, x;
+	uint32_t pushed = 0;
+	int16_t h;
+
+	if (Cache == NULL) {
+		return 0;
+	}
+
+	h = Cache->GetHeight();
+
+	// only chars we have cells for
+	for (; *Text && (len < NUMBERFIELD_CHARS); Text++) {
+		if (Cache->Has((uint8_t) *Text)) {
+			text[len++] = *Text;
+		}
+	}
+	text[len] = '\0';
+
+	width = 0;
+	for (i = 0; i < len; i++) {
+		width += Cache->GetAdvance((uint8_t) text[i]);
+	}
+	left = (Justify == NUMBERFIELD_RIGHT) ? X - width : X;
+	right = left + width;
+
+	x = left;
+	j = 0;
+	for (i = 0; i < len; i++) {
+		pos[i] = x;
+
+		// the old cells are in x order, skip the ones left of here
+		while ((j < Length) && (Pos[j] < x)) {
+			j++;
+		}
+		if ((j < Length) && (Pos[j] == x) && (Shown[j] == text[i])) {
+			// same char in the same place, it's already there
+		}
+		else {
+			Cache->DrawChar(D, x, Y, (uint8_t) text[i]);
+			pushed += (uint32_t) Cache->GetAdvance((uint8_t) text[i]) * h;
+		}
+		x += Cache->GetAdvance((uint8_t) text[i]);
+	}
+
+	// whatever the old value covered outside the new one
+	if (Left < Right) {
+		if (Left < left) {
+			x = (Right < left) ? Right : left;
+			D.fillRect(Left, Y, x - Left, h, Cache->GetBackground());
+			pushed += (uint32_t) (x - Left) * h;
+		}
+		if (Right > right) {
+			x = (Left > right) ? Left : right;
+			D.fillRect(x, Y, Right - x, h, Cache->GetBackground());
+			pushed += (uint32_t) (Right - x) * h;
+		}
+	}
+
+	memcpy(Shown, text, len + 1);
+	memcpy(Pos, pos, len * sizeof(int16_t));
+	Length = len;
+	Left = left;
+	Right = right;
+
+	return pushed;
+}
+
+template <class Display>
+uint32_t NumberField::Print(Display &D, float Value, uint8_t Decimals) {
+
+	char buf[NUMBERFIELD_CHARS + 1];
+
+	Format(Value, Decimals, buf, sizeof(buf));
+	return Print(D, buf);
+}
+
+#endif
@@ -0,0 +1,217 @@
+/*
+
+	Program name: Bob Jones Patriot Racing screen orientation
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, one drawing path per orientation picked at startup
+
+*/
+
+#ifndef PATRIOT_RACING_ORIENTATION_H
+#define PATRIOT_RACING_ORIENTATION_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include <string.h>
+#include "PatriotRacing_Font.h"
+
+#define ORIENTATION_VERSION 1.0
+
+/*
+
+OrientationText (Below / Above) is the screen mounted under or over the wheel, the same landscape
+picture turned 180. nothing should have to check which one it is while drawing
+
+	panel       the ILI9341 can scan its memory either way round (MADCTL, what setRotation sets), so
+	            OrientedDisplay sets that once in Begin and every call after goes straight through,
+	            pixels go out in the panel's own order and Above costs exactly what Below does
+	canvas      drawing into RAM (a FontCanvas, the TileBuffer canvas) there's no MADCTL, so
+	            OrientedCanvas<ORIENTATION_ABOVE> writes each row of a rect backwards into the
+	            mirrored rows, still one straight pass through memory per row and no per pixel
+	            coordinate math. OrientedCanvas<ORIENTATION_BELOW> is plain memcpy
+
+the orientation is a template argument, so each screen gets compiled once per orientation and
+OrientationSelect picks which copy runs when the setup screen changes it:
+
+	OrientationSelect(Orientation, [&](auto Flip) {
+		OrientedDisplay<ILI9341_t3, decltype(Flip)::value> screen(Display);
+		screen.Begin();
+		DrawRaceScreen(screen);
+	});
+
+(C++14 generic lambda, Flip is an OrientationTag so its value is a compile time constant)
+
+ORIENTATION_BELOW_ROTATION / ORIENTATION_ABOVE_ROTATION are the setRotation values, change them if
+the panel is mounted the other way round
+
+*/
+
+#define ORIENTATION_BELOW 0          // same order as OrientationText
+#define ORIENTATION_ABOVE 1
+
+#ifndef ORIENTATION_BELOW_ROTATION
+ #define ORIENTATION_BELOW_ROTATION 1
+#endif
+#ifndef ORIENTATION_ABOVE_ROTATION
+ #define ORIENTATION_ABOVE_ROTATION 3
+#endif
+
+template <uint8_t Orientation>
+struct OrientationTag {
+	static constexpr uint8_t value = Orientation;
+};
+
+static constexpr uint8_t OrientationRotation(uint8_t Orientation) {
+	return (Orientation == ORIENTATION_ABOVE) ? ORIENTATION_ABOVE_ROTATION : ORIENTATION_BELOW_ROTATION;
+}
+
+// calls Screen with an OrientationTag for Orientation, the one place it's looked at
+template <class ScreenFunc>
+void OrientationSelect(uint8_t Orientation, ScreenFunc &&Screen) {
+
+	if (Orientation == ORIENTATION_ABOVE) {
+		Screen(OrientationTag<ORIENTATION_ABOVE>());
+	}
+	else {
+		Screen(OrientationTag<ORIENTATION_BELOW>());
+	}
+}
+
+// the panel in one orientation, the controller does the flip
+template <class Display, uint8_t Orientation>
+class OrientedDisplay {
+
+public:
+
+	explicit OrientedDisplay(Display &D) : D(D) {
+	}
+
+	void Begin() {
+		D.setRotation(OrientationRotation(Orientation));
+	}
+
+	void writeRect(int16_t X, int16_t Y, int16_t W, int16_t H, const uint16_t *Colors) {
+		D.writeRect(X, Y, W, H, Colors);
+	}
+
+	void fillRect(int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Color) {
+		D.fillRect(X, Y, W, H, Color);
+	}
+
+	void drawPixel(int16_t X, int16_t Y, uint16_t Color) {
+		D.drawPixel(X, Y, Color);
+	}
+
+	void drawFastHLine(int16_t X, int16_t Y, int16_t W, uint16_t Color) {
+		D.drawFastHLine(X, Y, W, Color);
+	}
+
+	void drawFastVLine(int16_t X, int16_t Y, int16_t H, uint16_t Color) {
+		D.drawFastVLine(X, Y, H, Color);
+	}
+
+private:
+
+	Display &D;
+
+};
+
+// an RGB565 canvas in RAM seen in one orientation, Above stores the picture turned 180
+template <uint8_t Orientation>
+class OrientedCanvas {
+
+public:
+
+	explicit OrientedCanvas(const FontCanvas &C) : C(C) {
+	}
+
+	void writeRect(int16_t X, int16_t Y, int16_t W, int16_t H, const uint16_t *Colors) {
+
+		int16_t x0, x1, j;
+		uint32_t n, i;
+		uint16_t *out;
+		const uint16_t *in;
+
+		if (!Clip(X, Y, W, H, x0, x1)) {
+			return;
+		}
+		n = x1 - x0;
+		for (j = 0; j < H; j++) {
+			if ((Y + j < 0) || (Y + j >= C.Height)) {
+				continue;
+			}
+			in = Colors + j * W + (x0 - X);
+			if (Orientation == ORIENTATION_ABOVE) {
+				// the row read from its end and written from the left, memory still goes up
+				out = Row(Y + j) + (C.Width - x1);
+				in += n;
+				for (i = 0; i < n; i++) {
+					out[i] = *--in;
+				}
+			}
+			else {
+				memcpy(Row(Y + j) + x0, in, n * sizeof(uint16_t));
+			}
+		}
+	}
+
+	void fillRect(int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Color) {
+
+		int16_t x0, x1, j, i;
+		uint16_t *out;
+
+		if (!Clip(X, Y, W, H, x0, x1)) {
+			return;
+		}
+		// a filled rect turned 180 is a filled rect, just somewhere else
+		if (Orientation == ORIENTATION_ABOVE) {
+			i = x0;
+			x0 = C.Width - x1;
+			x1 = C.Width - i;
+		}
+		for (j = 0; j < H; j++) {
+			if ((Y + j < 0) || (Y + j >= C.Height)) {
+				continue;
+			}
+			out = Row(Y + j) + x0;
+			for (i = x0; i < x1; i++) {
+				*out++ = Color;
+			}
+		}
+	}
+
+	void drawPixel(int16_t X, int16_t Y, uint16_t Color) {
+		fillRect(X, Y, 1, 1, Color);
+	}
+
+	void drawFastHLine(int16_t X, int16_t Y, int16_t W, uint16_t Color) {
+		fillRect(X, Y, W, 1, Color);
+	}
+
+	void drawFastVLine(int16_t X, int16_t Y, int16_t H, uint16_t Color) {
+		fillRect(X, Y, 1, H, Color);
+	}
+
+private:
+
+	FontCanvas C;
+
+	// start of the memory row that screen row Y lands on
+	uint16_t *Row(int16_t Y) const {
+		return C.Pixels + (int32_t) ((Orientation == ORIENTATION_ABOVE) ? C.Height - 1 - Y : Y) * C.Stride;
+	}
+
+	bool Clip(int16_t X, int16_t Y, int16_t W, int16_t H, int16_t &X0, int16_t &X1) const {
+		X0 = (X < 0) ? 0 : X;
+		X1 = (X + W > C.Width) ? C.Width : X + W;
+		return (X1 > X0) && (H > 0) && (Y < C.Height) && (Y + H > 0);
+	}
+
+};
+
+#endif
@@ -0,0 +1,1096 @@
+/*
+
+	Program name: Bob Jones Patriot Racing packed icons
+
+	made by PatriotRacing_Tools/IconPack from PatriotRacing_Icons.h and GPUSA_Icons.h, don't edit,
+	change the raw icon and run it again
+
+*/
+
+#ifndef PATRIOT_RACING_PACKEDICONS_H
+#define PATRIOT_RACING_PACKEDICONS_H
+
+#include "PatriotRacing_IconPack.h"
+
+#ifndef PROGMEM
+ #define PROGMEM
+#endif
+
+// graph_icon565, 32x32px, 91 colors, 1475 bytes (raw 2048)
+static const uint16_t graph_icon_packed_palette [] PROGMEM = {
+	0x0000, 0xa5ff, 0x0008, 0x0009, 0xae3f, 0x000a, 0x959f, 0x000e, 0x000f, 0x8d7f, 0x0007, 0x957f, 0x9dbf, 0xae1f, 0x0004, 0x000b, 
+	0x000c, 0x000d, 0x7d1f, 0x853f, 0xd73f, 0x0010, 0x0011, 0x00dc, 0x851f, 0x8d5e, 0x8d5f, 0x957e, 0xa61f, 0xb65f, 0x7cff, 0x0002, 
+	0x851e, 0x8d3e, 0x9ddf, 0xa5df, 0xb67f, 0xbe7f, 0xceff, 0xdf7f, 0x0003, 0x0012, 0x0056, 0x74be, 0x74df, 0x7cfe, 0xdf5f, 0x0005, 
+	0x0006, 0x0013, 0x0034, 0x1a9e, 0x42d3, 0x53fc, 0x645c, 0x7c57, 0x7cbc, 0x7cde, 0x851d, 0x8d5d, 0xae5f, 0xbe9f, 0x0031, 0x0032, 
+	0x0035, 0x0077, 0x0078, 0x0079, 0x009a, 0x00bb, 0x017a, 0x01dd, 0x127e, 0x3295, 0x53bb, 0x541e, 0x5b75, 0x5b96, 0x647d, 0x647e, 
+	0x7437, 0x74ff, 0x7cdd, 0x84fe, 0x8d3d, 0x957d, 0x9d9e, 0x9dbe, 0xa5de, 0xadfe, 0xe79f
+};
+static const uint8_t graph_icon_packed_data [] PROGMEM = {
+	0x0e, 0x00, 0x01, 0x1f, 0x18, 0x00, 0x40, 0x28, 0xc1, 0xad, 0x21, 0x92, 0x3a, 0x41, 0x4c, 0x50, 0x02, 0x37, 0xc0, 0xd6, 0x6b, 0x40, 0x34, 0xc0, 
+	0x90, 0x42, 0x40, 0x0e, 0x11, 0x00, 0x41, 0x0e, 0x34, 0xc0, 0xf6, 0x6b, 0x40, 0x50, 0xc0, 0x3c, 0x95, 0x40, 0x1b, 0xc0, 0x3d, 0x85, 0x01, 0x3a, 
+	0xc0, 0xfd, 0x84, 0x40, 0x21, 0xc1, 0x5d, 0x95, 0x18, 0x6c, 0x40, 0x50, 0xc1, 0xf3, 0x4a, 0x87, 0x00, 0x0e, 0x00, 0xc2, 0x0f, 0x2a, 0xd6, 0x63, 
+	0xb9, 0x84, 0x41, 0x56, 0x55, 0x01, 0x3b, 0x40, 0x54, 0xc0, 0x3d, 0x85, 0x41, 0x3a, 0x21, 0xc1, 0xfd, 0x84, 0xfd, 0x7c, 0x01, 0x52, 0xc2, 0xfc, 
+	0x84, 0xf6, 0x6b, 0xb2, 0x42, 0x0c, 0x00, 0x42, 0x34, 0x37, 0x58, 0xc0, 0x9d, 0x9d, 0x01, 0x55, 0xc0, 0x5d, 0x95, 0x40, 0x3b, 0x01, 0x54, 0x43, 
+	0x21, 0x3a, 0x20, 0x2d, 0x01, 0x39, 0xc0, 0xde, 0x74, 0x40, 0x39, 0xc0, 0x7a, 0x74, 0x40, 0x4c, 0xc0, 0x24, 0x00, 0x09, 0x00, 0xc2, 0x34, 0x4b, 
+	0xd9, 0x8c, 0xbe, 0xa5, 0x41, 0x57, 0x56, 0xc0, 0x9e, 0x95, 0x01, 0x1b, 0x01, 0x19, 0x01, 0x21, 0x01, 0x20, 0x40, 0x53, 0x01, 0x2d, 0x40, 0x39, 
+	0x01, 0x2b, 0x42, 0x38, 0x4d, 0x0e, 0x07, 0x00, 0xc1, 0xd4, 0x42, 0xd9, 0x8c, 0x01, 0x58, 0x01, 0x57, 0x40, 0x56, 0xc0, 0x9e, 0x95, 0x01, 0x1b, 
+	0x01, 0x19, 0x40, 0x21, 0xc0, 0x3e, 0x85, 0x01, 0x20, 0x40, 0x53, 0x01, 0x2d, 0xc0, 0xde, 0x74, 0x01, 0x2b, 0x41, 0x38, 0x4c, 0x06, 0x00, 0xc1, 
+	0x10, 0x2a, 0x58, 0x74, 0x81, 0xfe, 0xa5, 0x01, 0x01, 0x01, 0x23, 0x01, 0x22, 0x41, 0x01, 0x0c, 0x02, 0x06, 0x01, 0x0b, 0x02, 0x09, 0x41, 0x0b, 
+	0x1a, 0xc0, 0x3f, 0x8d, 0x40, 0x2b, 0xc0, 0x9b, 0x7c, 0x40, 0x34, 0x04, 0x00, 0x42, 0x2f, 0x4d, 0x04, 0xc0, 0x1e, 0xae, 0x42, 0x14, 0x0d, 0x1c, 
+	0x02, 0x01, 0x41, 0x26, 0x0d, 0x03, 0x0c, 0x40, 0x06, 0xc0, 0x1f, 0xcf, 0x02, 0x06, 0x01, 0x09, 0xc0, 0xdf, 0xc6, 0x40, 0x18, 0xc2, 0xbf, 0x74, 
+	0xf8, 0x63, 0x4b, 0x19, 0x03, 0x00, 0xc1, 0x73, 0x32, 0x1a, 0x8d, 0x43, 0x04, 0x0d, 0x5a, 0x0d, 0x01, 0x01, 0x46, 0x22, 0x23, 0x14, 0x01, 0x06, 
+	0x0b, 0x09, 0x01, 0x1a, 0x40, 0x2e, 0x01, 0x13, 0x42, 0x18, 0x12, 0x1e, 0xc0, 0x1f, 0xd7, 0x42, 0x13, 0x2c, 0x18, 0xc0, 0x15, 0x4b, 0x02, 0x00, 
+	0x40, 0x0e, 0xc0, 0x76, 0x53, 0x40, 0x1d, 0x01, 0x04, 0x47, 0x5a, 0x0d, 0x1c, 0x01, 0x04, 0x23, 0x14, 0x01, 0x01, 0x06, 0x44, 0x0b, 0x09, 0x1a, 
+	0x27, 0x0b, 0x01, 0x18, 0x41, 0x12, 0x1e, 0xc0, 0x1f, 0xd7, 0x40, 0x13, 0x01, 0x2c, 0xc1, 0x39, 0x6c, 0x4a, 0x19, 0x01, 0x00, 0xc1, 0x4d, 0x11, 
+	0x58, 0x74, 0x01, 0x1d, 0x40, 0x3c, 0xc0, 0xbf, 0xe7, 0x40, 0x04, 0x01, 0x0d, 0x01, 0x01, 0x42, 0x14, 0x1c, 0x0c, 0x01, 0x06, 0x01, 0x0b, 0x47, 
+	0x27, 0x01, 0x3c, 0x20, 0x18, 0x12, 0x14, 0x13, 0x01, 0x1e, 0x40, 0x53, 0xc0, 0x11, 0x22, 0x01, 0x00, 0xc1, 0xd2, 0x19, 0xfd, 0xad, 0x40, 0x24, 
+	0x01, 0x1d, 0xc0, 0xbf, 0xef, 0x01, 0x1d, 0x01, 0x04, 0x42, 0x0d, 0x2e, 0x04, 0x01, 0x01, 0x01, 0x23, 0x40, 0x0c, 0xc0, 0xdf, 0xef, 0x40, 0x2e, 
+	0xc0, 0x9f, 0xc6, 0x42, 0x14, 0x13, 0x09, 0xc0, 0x5f, 0xd7, 0x43, 0x1a, 0x18, 0x1e, 0x51, 0xc0, 0x15, 0x43, 0x01, 0x00, 0xc0, 0x74, 0x2a, 0x41, 
+	0x24, 0x25, 0x01, 0x24, 0xc0, 0xdf, 0xef, 0x40, 0x04, 0x01, 0x1c, 0x01, 0x01, 0x41, 0x27, 0x3c, 0xc0, 0xff, 0x9d, 0x01, 0x22, 0x41, 0x04, 0x2e, 
+	0xc0, 0xff, 0xff, 0x49, 0x04, 0x0c, 0x26, 0x14, 0x26, 0x27, 0x09, 0x18, 0x1e, 0x51, 0xc0, 0x37, 0x4b, 0x40, 0x0e, 0xc0, 0x01, 0x00, 0x40, 0x49, 
+	0x01, 0x3d, 0x41, 0x25, 0x24, 0xc0, 0xbf, 0xef, 0x4c, 0x24, 0x3c, 0x0d, 0x0c, 0x26, 0x2e, 0x04, 0x01, 0x22, 0x1b, 0x26, 0x1d, 0x5a, 0xc0, 0x9f, 
+	0x8d, 0x40, 0x09, 0x01, 0x1a, 0xc1, 0xff, 0xd6, 0xff, 0xf7, 0x40, 0x09, 0x02, 0x12, 0xc0, 0x99, 0x53, 0x43, 0x0a, 0x28, 0x49, 0x3b, 0x02, 0x19, 
+	0x43, 0x27, 0x0b, 0x1b, 0x04, 0xc0, 0x9f, 0xc6, 0x40, 0x1b, 0xc0, 0xff, 0xf7, 0x41, 0x1c, 0x1a, 0xc0, 0x7e, 0x8d, 0x44, 0x26, 0x06, 0x13, 0x27, 
+	0x13, 0x02, 0x12, 0x40, 0x1e, 0xc0, 0x7f, 0xe7, 0x41, 0x13, 0x51, 0x01, 0x2c, 0xc0, 0xba, 0x53, 0x41, 0x03, 0x28, 0xc2, 0xd4, 0x11, 0x13, 0x01, 
+	0x34, 0x01, 0x81, 0x55, 0x01, 0x40, 0x25, 0xc0, 0x9a, 0x4b, 0x40, 0x25, 0xc2, 0xfa, 0x5b, 0xb9, 0x01, 0xd9, 0x01, 0x40, 0x0c, 0xc0, 0x1e, 0xae, 
+	0x41, 0x3d, 0x25, 0xc4, 0xbc, 0x22, 0x3c, 0x0a, 0x3d, 0x0a, 0xbf, 0xc6, 0x7d, 0x12, 0x01, 0x48, 0x42, 0x33, 0x48, 0x1c, 0xc0, 0x5f, 0x33, 0x02, 
+	0x33, 0xc0, 0xba, 0x2a, 0x41, 0x02, 0x1f, 0xc0, 0xb4, 0x11, 0x41, 0x08, 0x3e, 0x01, 0x16, 0xc0, 0x3f, 0xb6, 0x40, 0x14, 0xc8, 0xb7, 0x32, 0x16, 
+	0x01, 0x36, 0x01, 0x57, 0x01, 0x5e, 0x95, 0xba, 0x22, 0x7a, 0x4b, 0xd9, 0x09, 0x79, 0x01, 0x01, 0x46, 0x40, 0x25, 0xc1, 0x9b, 0x01, 0x9c, 0x01, 
+	0x81, 0xdc, 0x01, 0xc0, 0xbc, 0x01, 0x41, 0x0c, 0x47, 0x02, 0x17, 0xc0, 0x19, 0x12, 0x41, 0x30, 0x00, 0xc1, 0xd5, 0x11, 0x2f, 0x00, 0x01, 0x08, 
+	0x40, 0x15, 0xc1, 0x3f, 0xb6, 0xdb, 0x84, 0x02, 0x4a, 0x41, 0x35, 0x3d, 0xc0, 0x9d, 0x6c, 0x02, 0x35, 0x81, 0xfd, 0x53, 0x40, 0x14, 0xc1, 0x1d, 
+	0x54, 0x3e, 0x5c, 0x02, 0x4b, 0xc0, 0xdf, 0xc6, 0x40, 0x47, 0x02, 0x17, 0xc0, 0x38, 0x1a, 0x41, 0x0e, 0x00, 0xc1, 0x13, 0x01, 0xf0, 0x00, 0x40, 
+	0x11, 0x01, 0x07, 0x41, 0x59, 0x3e, 0x01, 0x16, 0x40, 0x3f, 0xc0, 0x33, 0x00, 0x40, 0x52, 0xc0, 0x77, 0x01, 0x40, 0x40, 0x01, 0x2a, 0x42, 0x41, 
+	0x42, 0x04, 0x81, 0xb9, 0x00, 0x01, 0x44, 0x42, 0x45, 0x06, 0x47, 0x01, 0x17, 0xc1, 0xfd, 0x00, 0x75, 0x2a, 0x01, 0x00, 0xc1, 0x2c, 0x00, 0x14, 
+	0x22, 0x01, 0x10, 0x44, 0x11, 0x59, 0x15, 0x08, 0x15, 0xc0, 0xb2, 0x00, 0x41, 0x16, 0x38, 0xc1, 0x56, 0x01, 0x14, 0x00, 0x41, 0x32, 0x40, 0x01, 
+	0x2a, 0x40, 0x0d, 0xc0, 0x19, 0x01, 0x40, 0x42, 0x81, 0x99, 0x00, 0x41, 0x44, 0x0b, 0xc0, 0xbc, 0x01, 0x40, 0x45, 0xc2, 0xbc, 0x00, 0x1c, 0x0a, 
+	0xb2, 0x19, 0x01, 0x00, 0x40, 0x0e, 0xc0, 0xd6, 0x3a, 0x43, 0x05, 0x0f, 0x10, 0x59, 0x01, 0x07, 0x01, 0x08, 0x41, 0x15, 0x38, 0xc0, 0x35, 0x01, 
+	0x41, 0x29, 0x31, 0xc0, 0x14, 0x00, 0x40, 0x32, 0xc0, 0x96, 0x00, 0x40, 0x1c, 0x01, 0x41, 0x40, 0x42, 0x01, 0x43, 0x40, 0x09, 0xc0, 0x9c, 0x01, 
+	0x40, 0x45, 0xc1, 0x1c, 0x01, 0x1c, 0x33, 0x40, 0x0a, 0x02, 0x00, 0xc1, 0x52, 0x09, 0x50, 0x09, 0x01, 0x05, 0xc1, 0xfd, 0xad, 0x4e, 0x00, 0x02, 
+	0x07, 0x40, 0x08, 0xc1, 0xdb, 0x84, 0x74, 0x01, 0x40, 0x16, 0x01, 0x3f, 0xc1, 0x94, 0x00, 0x74, 0x00, 0x40, 0x01, 0x81, 0x76, 0x00, 0x81, 0x97, 
+	0x00, 0xc0, 0x98, 0x00, 0x40, 0x0b, 0xc0, 0x7b, 0x01, 0x81, 0xda, 0x00, 0xc0, 0xf7, 0x42, 0x03, 0x00, 0x40, 0x2f, 0xc0, 0x77, 0x53, 0x01, 0x03, 
+	0xc1, 0x17, 0x6c, 0x7c, 0x6c, 0x03, 0x36, 0xc2, 0x3c, 0x8d, 0x7c, 0x6c, 0x5d, 0x64, 0x40, 0x4e, 0xc0, 0x7d, 0x6c, 0x01, 0x4e, 0x40, 0x19, 0x02, 
+	0x4f, 0x81, 0x7f, 0x64, 0x42, 0x09, 0x46, 0x43, 0xc0, 0x3c, 0x3b, 0x40, 0x05, 0x04, 0x00, 0xc1, 0xaf, 0x00, 0xb4, 0x3a, 0x40, 0x02, 0x01, 0x03, 
+	0x01, 0x05, 0x01, 0x0f, 0x40, 0x10, 0x01, 0x11, 0x41, 0x07, 0x08, 0x01, 0x15, 0x41, 0x16, 0x29, 0x01, 0x31, 0x41, 0x32, 0x40, 0xc0, 0x36, 0x00, 
+	0x40, 0x2a, 0xc0, 0x99, 0x01, 0x40, 0x49, 0x06, 0x00, 0xc1, 0x55, 0x2a, 0x6f, 0x11, 0x02, 0x02, 0x01, 0x03, 0x01, 0x05, 0x41, 0x0f, 0x10, 0x01, 
+	0x11, 0x40, 0x07, 0x01, 0x08, 0x41, 0x15, 0x16, 0x01, 0x29, 0x41, 0x31, 0x32, 0xc1, 0xb5, 0x00, 0xda, 0x5b, 0x40, 0x1f, 0x06, 0x00, 0x40, 0x28, 
+	0xc1, 0x17, 0x43, 0x4e, 0x11, 0x40, 0x0a, 0x02, 0x02, 0x01, 0x03, 0x42, 0x0f, 0x05, 0x0f, 0x01, 0x10, 0x40, 0x11, 0x01, 0x07, 0x43, 0x08, 0x15, 
+	0x3e, 0x29, 0xc1, 0x93, 0x00, 0x1a, 0x64, 0x40, 0x30, 0x08, 0x00, 0x40, 0x1f, 0xc1, 0xd6, 0x3a, 0x72, 0x32, 0x01, 0x0a, 0x01, 0x02, 0x02, 0x03, 
+	0x01, 0x05, 0x40, 0x0f, 0x01, 0x10, 0x41, 0x11, 0x07, 0x01, 0x08, 0xc1, 0x33, 0x01, 0x19, 0x64, 0x40, 0x30, 0x0b, 0x00, 0xc2, 0x71, 0x11, 0x18, 
+	0x6c, 0x6b, 0x00, 0x40, 0x0a, 0x03, 0x02, 0x01, 0x03, 0x01, 0x05, 0x01, 0x0f, 0x41, 0x11, 0x07, 0xc1, 0x78, 0x53, 0xf6, 0x42, 0x40, 0x1f, 0x0d, 
+	0x00, 0x40, 0x0a, 0xc2, 0x36, 0x4b, 0x37, 0x6c, 0x8e, 0x19, 0x02, 0x0a, 0x01, 0x02, 0x01, 0x03, 0x40, 0x05, 0xc3, 0x0f, 0x01, 0x97, 0x5b, 0xd8, 
+	0x63, 0x2a, 0x00, 0x11, 0x00, 0x40, 0x30, 0xc4, 0xd2, 0x19, 0xd8, 0x63, 0xd7, 0x63, 0xb6, 0x63, 0x95, 0x5b, 0x40, 0x4d, 0xc3, 0xb7, 0x63, 0xf8, 
+	0x63, 0xf8, 0x6b, 0xb5, 0x3a, 0x40, 0x0a, 0x16, 0x00, 0xc0, 0x01, 0x00, 0x40, 0x0e, 0x01, 0x2f, 0x41, 0x0e, 0x28, 0x0c, 0x00
+};
+const PackedIcon graph_icon_packed = {32, 32, graph_icon_packed_palette, 91, graph_icon_packed_data, 1293};
+
+// sssgraph_icon565, 32x32px, 87 colors, 1522 bytes (raw 2048)
+static const uint16_t sssgraph_icon_packed_palette [] PROGMEM = {
+	0x20e4, 0x20e3, 0x0203, 0x1eee, 0x1265, 0x1f0e, 0x0223, 0x1285, 0x1a24, 0x1a44, 0x01e2, 0x264d, 0x01c2, 0x04c7, 0x26ee, 0x266d, 
+	0x268d, 0x2e2d, 0x0466, 0x04e7, 0x1ece, 0x26ae, 0x01a2, 0x12a6, 0x260c, 0x2e4d, 0x0486, 0x1245, 0x0405, 0x04a6, 0x172b, 0x2d8b, 
+	0x2e6d, 0x0324, 0x170e, 0x1ead, 0x2dac, 0x2e8e, 0x03a4, 0x03e5, 0x12c6, 0x16ee, 0x262d, 0x26ce, 0x2dec, 0x0181, 0x0344, 0x0363, 
+	0x0384, 0x03c4, 0x0446, 0x04a7, 0x1367, 0x170b, 0x1b87, 0x02c3, 0x02e2, 0x0323, 0x0343, 0x0425, 0x0445, 0x0548, 0x0568, 0x0f4b, 
+	0x13c8, 0x1b67, 0x268e, 0x26ad, 0x2dcc, 0x0263, 0x02a3, 0x02a4, 0x02c2, 0x02e4, 0x0304, 0x0527, 0x0aa5, 0x1183, 0x1347, 0x13a8, 
+	0x16cb, 0x16eb, 0x1a04, 0x1c69, 0x1ecd, 0x2469, 0x24ea
+};
+static const uint8_t sssgraph_icon_packed_data [] PROGMEM = {
+	0x25, 0x00, 0x40, 0x01, 0xc1, 0x04, 0x21, 0xe4, 0x19, 0x0c, 0x08, 0x40, 0x52, 0xc1, 0xc4, 0x19, 0x04, 0x21, 0x09, 0x00, 0x01, 0x01, 0x40, 0x09, 
+	0xc1, 0x87, 0x0d, 0x2a, 0x0f, 0x01, 0x3f, 0x03, 0x1e, 0x02, 0x35, 0x41, 0x51, 0x50, 0xc7, 0xca, 0x16, 0xaa, 0x16, 0x8a, 0x16, 0x6a, 0x16, 0x49, 
+	0x16, 0x08, 0x16, 0x65, 0x14, 0xe4, 0x19, 0x07, 0x00, 0x40, 0x01, 0xc2, 0x46, 0x14, 0x4a, 0x0f, 0xed, 0x16, 0x01, 0x29, 0xc0, 0xed, 0x1e, 0x40, 
+	0x14, 0x01, 0x54, 0x01, 0x23, 0xc0, 0x8d, 0x1e, 0x01, 0x0f, 0x41, 0x0b, 0x2a, 0x01, 0x18, 0xc0, 0xec, 0x25, 0x42, 0x44, 0x24, 0x1f, 0xc1, 0x28, 
+	0x1d, 0x83, 0x12, 0x40, 0x01, 0x04, 0x00, 0x40, 0x01, 0xc1, 0x46, 0x14, 0x4c, 0x0f, 0x01, 0x22, 0x40, 0x29, 0x02, 0x03, 0x01, 0x14, 0x41, 0x23, 
+	0x43, 0x01, 0x10, 0x40, 0x0f, 0x01, 0x0b, 0x44, 0x2a, 0x18, 0x2c, 0x44, 0x24, 0x01, 0x1f, 0xc1, 0xa8, 0x24, 0x03, 0x12, 0x04, 0x00, 0x41, 0x09, 
+	0x3f, 0x02, 0x22, 0x01, 0x05, 0x02, 0x03, 0x01, 0x14, 0x42, 0x43, 0x15, 0x10, 0x01, 0x0f, 0x44, 0x0b, 0x2a, 0x18, 0x2c, 0x24, 0xc1, 0x89, 0x24, 
+	0x4b, 0x2d, 0x40, 0x1f, 0xc2, 0x6b, 0x2d, 0x47, 0x1c, 0xa4, 0x19, 0x02, 0x00, 0x40, 0x01, 0xc1, 0x87, 0x0d, 0xed, 0x16, 0x01, 0x22, 0x03, 0x05, 
+	0x02, 0x03, 0x40, 0x2b, 0x01, 0x15, 0x43, 0x42, 0x10, 0x0f, 0x0b, 0x01, 0x11, 0xc0, 0x0c, 0x2e, 0x43, 0x41, 0x1b, 0x28, 0x1f, 0xc2, 0x6b, 0x35, 
+	0x0a, 0x25, 0x65, 0x0b, 0x01, 0x00, 0x40, 0x01, 0xc1, 0x23, 0x21, 0x2a, 0x0f, 0x01, 0x29, 0x04, 0x05, 0x01, 0x03, 0x41, 0x0e, 0x2b, 0x01, 0x15, 
+	0x43, 0x42, 0x10, 0x0f, 0x0b, 0x01, 0x11, 0xc0, 0x6b, 0x25, 0x41, 0x07, 0x1b, 0xc0, 0xa5, 0x12, 0x40, 0x1f, 0xc0, 0x6b, 0x2d, 0x41, 0x0d, 0x33, 
+	0xc0, 0x24, 0x21, 0x45, 0x00, 0x01, 0x52, 0x3f, 0x29, 0x03, 0x04, 0x05, 0x40, 0x03, 0x01, 0x0e, 0x01, 0x2b, 0x41, 0x15, 0x42, 0xc0, 0x8d, 0x2e, 
+	0x40, 0x20, 0x01, 0x19, 0x40, 0x2c, 0xc0, 0xe6, 0x12, 0x41, 0x1b, 0x41, 0xc2, 0x2b, 0x2d, 0x8c, 0x35, 0x08, 0x15, 0x41, 0x1d, 0x0d, 0xc0, 0xe5, 
+	0x19, 0x42, 0x00, 0x01, 0x09, 0xc0, 0x2b, 0x0f, 0x02, 0x03, 0x02, 0x05, 0x02, 0x0e, 0xc1, 0x6b, 0x1d, 0xca, 0x1c, 0x48, 0x10, 0x15, 0x42, 0x25, 
+	0x20, 0x19, 0x11, 0x41, 0x04, 0xc0, 0x47, 0x1b, 0x40, 0x24, 0xc1, 0xac, 0x35, 0x49, 0x1d, 0x42, 0x0d, 0x1d, 0x13, 0xc0, 0x45, 0x1a, 0x01, 0x00, 
+	0x42, 0x09, 0x1e, 0x14, 0x03, 0x03, 0x02, 0x0e, 0xc3, 0x2d, 0x1e, 0xc6, 0x0a, 0xa6, 0x0a, 0xe8, 0x13, 0x40, 0x0b, 0x01, 0x25, 0x41, 0x20, 0x19, 
+	0xc0, 0xe8, 0x1b, 0x40, 0x04, 0xc0, 0x06, 0x1b, 0x40, 0x24, 0xc2, 0xcc, 0x35, 0x6a, 0x1d, 0x07, 0x05, 0x41, 0x0d, 0x1a, 0xc1, 0x08, 0x05, 0x66, 
+	0x1a, 0x01, 0x00, 0x41, 0x09, 0x1e, 0x01, 0x14, 0x02, 0x03, 0x01, 0x0e, 0x42, 0x15, 0x40, 0x4c, 0x01, 0x17, 0x4a, 0x28, 0x53, 0x11, 0x20, 0x55, 
+	0x04, 0x28, 0x56, 0x36, 0x34, 0x21, 0xc0, 0x26, 0x04, 0x41, 0x0d, 0x1a, 0xc1, 0x28, 0x05, 0x86, 0x1a, 0x01, 0x00, 0x42, 0x09, 0x1e, 0x54, 0x01, 
+	0x14, 0x40, 0x03, 0x01, 0x0e, 0x43, 0x15, 0x40, 0x4c, 0x34, 0xc1, 0x8c, 0x25, 0x49, 0x1c, 0x42, 0x17, 0x07, 0x28, 0xc0, 0xa8, 0x1b, 0x01, 0x07, 
+	0xc2, 0x4b, 0x2d, 0xca, 0x24, 0x44, 0x0a, 0x01, 0x02, 0xc0, 0x85, 0x03, 0x42, 0x1d, 0x12, 0x3d, 0xc0, 0xa6, 0x1a, 0x01, 0x00, 0x41, 0x09, 0x1e, 
+	0x01, 0x23, 0x40, 0x14, 0x01, 0x2b, 0x44, 0x43, 0x40, 0x17, 0x34, 0x0b, 0xc0, 0xae, 0x2e, 0x40, 0x25, 0xc2, 0x0d, 0x26, 0x29, 0x1c, 0xa5, 0x12, 
+	0x41, 0x07, 0x04, 0xc2, 0x8a, 0x24, 0x0d, 0x36, 0xa9, 0x1c, 0x40, 0x06, 0x01, 0x02, 0xc0, 0x65, 0x03, 0x41, 0x1a, 0x12, 0xc1, 0x69, 0x05, 0xa7, 
+	0x1a, 0x01, 0x00, 0x41, 0x09, 0x35, 0x01, 0x23, 0x43, 0x43, 0x15, 0x10, 0x40, 0xc0, 0xa6, 0x0a, 0x40, 0x4e, 0xc0, 0x29, 0x1c, 0x01, 0x34, 0xc0, 
+	0x87, 0x13, 0x40, 0x19, 0xc1, 0x6e, 0x2e, 0x2b, 0x25, 0x42, 0x07, 0x28, 0x24, 0xc0, 0xcb, 0x1d, 0x40, 0x32, 0x01, 0x02, 0x40, 0x0a, 0xc0, 0x64, 
+	0x03, 0x42, 0x1a, 0x32, 0x3d, 0xc0, 0xa6, 0x1a, 0x01, 0x00, 0x41, 0x09, 0x35, 0x01, 0x10, 0x40, 0x15, 0xc1, 0x0a, 0x1d, 0x06, 0x13, 0x43, 0x4c, 
+	0x4e, 0x0b, 0x4f, 0x01, 0x17, 0x44, 0x07, 0x11, 0x20, 0x19, 0x2c, 0xc1, 0xed, 0x2d, 0xca, 0x15, 0x41, 0x3e, 0x32, 0x01, 0x02, 0x43, 0x0a, 0x2e, 
+	0x12, 0x3c, 0xc1, 0x08, 0x05, 0x66, 0x1a, 0x01, 0x00, 0x42, 0x09, 0x51, 0x0f, 0x01, 0x10, 0xc2, 0x06, 0x13, 0x85, 0x0a, 0xc6, 0x0a, 0x43, 0x2a, 
+	0x25, 0x4f, 0x17, 0x01, 0x07, 0x40, 0x11, 0x01, 0x19, 0x40, 0x11, 0xc1, 0xca, 0x15, 0x88, 0x05, 0x40, 0x3e, 0xc0, 0x26, 0x04, 0x40, 0x02, 0x01, 
+	0x0a, 0x43, 0x2e, 0x12, 0x3b, 0x0d, 0xc0, 0x46, 0x1a, 0x01, 0x00, 0x41, 0x09, 0x51, 0x01, 0x0f, 0x43, 0x10, 0x53, 0x17, 0x53, 0x01, 0x25, 0xc0, 
+	0xa7, 0x1b, 0x02, 0x07, 0xc0, 0x0d, 0x2e, 0x41, 0x11, 0x28, 0xc0, 0x84, 0x02, 0x41, 0x45, 0x21, 0xc1, 0x47, 0x05, 0x06, 0x04, 0x46, 0x02, 0x0a, 
+	0x0c, 0x21, 0x3c, 0x1c, 0x1a, 0xc0, 0x25, 0x1a, 0x01, 0x00, 0x41, 0x09, 0x50, 0x01, 0x0b, 0x01, 0x0f, 0x40, 0x0b, 0x02, 0x20, 0x40, 0x36, 0x01, 
+	0x07, 0x42, 0x04, 0x2c, 0x18, 0xc0, 0x43, 0x02, 0x01, 0x06, 0x43, 0x49, 0x4b, 0x1c, 0x0a, 0x01, 0x0c, 0x43, 0x21, 0x3b, 0x1c, 0x32, 0xc0, 0xe5, 
+	0x19, 0x01, 0x00, 0x42, 0x09, 0x50, 0x2a, 0x01, 0x0b, 0x01, 0x18, 0xc0, 0x0d, 0x26, 0x01, 0x19, 0x41, 0x36, 0x07, 0x01, 0x04, 0xc1, 0xcb, 0x25, 
+	0x89, 0x05, 0x02, 0x06, 0xc1, 0xc4, 0x02, 0x07, 0x05, 0x41, 0x27, 0x0a, 0x01, 0x0c, 0x41, 0x4a, 0x1c, 0xc0, 0xe4, 0x03, 0x40, 0x27, 0xc0, 0xc4, 
+	0x19, 0x01, 0x00, 0x40, 0x09, 0xc0, 0xaa, 0x16, 0x41, 0x18, 0x2a, 0xc1, 0xca, 0x1c, 0x85, 0x0a, 0x44, 0x07, 0x04, 0x56, 0x11, 0x36, 0x01, 0x04, 
+	0xc0, 0x44, 0x0a, 0x01, 0x3e, 0x01, 0x06, 0x42, 0x02, 0x47, 0x13, 0xc0, 0xc5, 0x03, 0x01, 0x0c, 0x40, 0x16, 0xc0, 0xe3, 0x02, 0x42, 0x27, 0x31, 
+	0x26, 0xc0, 0xa4, 0x19, 0x01, 0x00, 0x40, 0x08, 0xc0, 0x8a, 0x16, 0x01, 0x18, 0xc0, 0xa9, 0x1c, 0x02, 0x04, 0xc0, 0xca, 0x24, 0x42, 0x11, 0x41, 
+	0x04, 0xc0, 0x44, 0x02, 0x40, 0x06, 0x01, 0x3d, 0x02, 0x02, 0x41, 0x47, 0x0d, 0xc0, 0xa5, 0x03, 0x40, 0x0c, 0x01, 0x16, 0xc0, 0xe3, 0x02, 0x42, 
+	0x31, 0x26, 0x2f, 0xc0, 0x63, 0x19, 0x01, 0x00, 0x40, 0x08, 0xc1, 0x6a, 0x1e, 0xec, 0x25, 0x40, 0x2c, 0xc0, 0x89, 0x1c, 0x02, 0x04, 0xc1, 0xaa, 
+	0x24, 0x0d, 0x2e, 0x40, 0x4e, 0xc0, 0x43, 0x02, 0x01, 0x06, 0x01, 0x4b, 0x01, 0x02, 0x40, 0x0a, 0xc0, 0x83, 0x02, 0x40, 0x1d, 0xc0, 0x85, 0x03, 
+	0x01, 0x16, 0xc0, 0x82, 0x01, 0x43, 0x37, 0x26, 0x30, 0x39, 0xc0, 0x63, 0x19, 0x01, 0x00, 0x40, 0x52, 0xc0, 0x2a, 0x1e, 0x01, 0x44, 0x40, 0x55, 
+	0x01, 0x1b, 0x40, 0x04, 0xc2, 0x8a, 0x24, 0xcb, 0x1d, 0x05, 0x03, 0x01, 0x06, 0x40, 0x02, 0x01, 0x13, 0xc0, 0x02, 0x02, 0x01, 0x0a, 0x41, 0x45, 
+	0x12, 0xc0, 0x64, 0x03, 0x01, 0x16, 0x44, 0x2d, 0x46, 0x30, 0x2f, 0x38, 0xc0, 0x43, 0x19, 0x01, 0x00, 0xc1, 0x44, 0x21, 0x08, 0x16, 0x41, 0x24, 
+	0x1f, 0xc0, 0xa8, 0x1b, 0x01, 0x1b, 0xc1, 0x44, 0x12, 0xa6, 0x0b, 0x42, 0x12, 0x47, 0x06, 0x01, 0x02, 0x01, 0x27, 0x40, 0x0a, 0x01, 0x0c, 0x43, 
+	0x06, 0x30, 0x37, 0x16, 0x01, 0x2d, 0xc0, 0x22, 0x02, 0x01, 0x3a, 0x40, 0x48, 0xc0, 0x23, 0x19, 0x02, 0x00, 0xc0, 0x86, 0x0c, 0x41, 0x1f, 0x55, 
+	0x01, 0x1b, 0xc0, 0x24, 0x0a, 0x40, 0x06, 0x04, 0x02, 0x02, 0x0a, 0x02, 0x0c, 0x01, 0x16, 0xc0, 0x82, 0x01, 0x01, 0x2d, 0x81, 0x61, 0x01, 0xc2, 
+	0x62, 0x02, 0x03, 0x03, 0x62, 0x0a, 0x40, 0x01, 0x02, 0x00, 0x40, 0x09, 0xc0, 0x28, 0x1d, 0x41, 0x56, 0x36, 0xc0, 0x65, 0x0b, 0x02, 0x2e, 0x02, 
+	0x21, 0x01, 0x4a, 0x01, 0x49, 0x01, 0x37, 0x01, 0x46, 0xc0, 0x83, 0x02, 0x40, 0x45, 0xc3, 0x62, 0x02, 0x42, 0x02, 0x22, 0x02, 0x02, 0x02, 0x01, 
+	0x48, 0x41, 0x4d, 0x01, 0x03, 0x00, 0xc2, 0xc3, 0x12, 0xc9, 0x1c, 0x08, 0x0d, 0x03, 0x13, 0x01, 0x0d, 0x01, 0x1d, 0x40, 0x1a, 0x01, 0x12, 0x4a, 
+	0x3c, 0x3b, 0x1c, 0x27, 0x31, 0x26, 0x30, 0x2f, 0x3a, 0x39, 0x38, 0xc0, 0x22, 0x0a, 0x40, 0x01, 0x04, 0x00, 0xc1, 0x03, 0x21, 0x83, 0x0a, 0x41, 
+	0x12, 0x0d, 0x01, 0x33, 0x01, 0x1d, 0x01, 0x1a, 0x01, 0x12, 0x41, 0x3c, 0x3b, 0x01, 0x1c, 0xc0, 0xe4, 0x03, 0x46, 0x31, 0x26, 0x30, 0x2f, 0x3a, 
+	0x39, 0x38, 0xc1, 0x22, 0x0a, 0x03, 0x21, 0x05, 0x00, 0x41, 0x01, 0x00, 0xc1, 0x24, 0x12, 0x06, 0x04, 0x40, 0x33, 0x02, 0x0d, 0x01, 0x13, 0xc0, 
+	0xe8, 0x04, 0x48, 0x13, 0x33, 0x1a, 0x32, 0x1c, 0x31, 0x26, 0x2f, 0x39, 0xc0, 0x03, 0x03, 0x40, 0x38, 0xc1, 0x82, 0x02, 0xa3, 0x11, 0x40, 0x01, 
+	0x0a, 0x00, 0xc0, 0xc5, 0x19, 0x40, 0x17, 0xc3, 0x07, 0x13, 0x27, 0x13, 0x68, 0x13, 0x88, 0x13, 0x40, 0x4f, 0xc2, 0x68, 0x13, 0x27, 0x13, 0xe6, 
+	0x12, 0x41, 0x17, 0x04, 0xc2, 0x24, 0x12, 0x04, 0x12, 0xc3, 0x11, 0x01, 0x4d, 0xc0, 0x43, 0x19, 0x40, 0x01, 0x0d, 0x00, 0x09, 0x01, 0x02, 0x00, 
+	0x02, 0x01, 0x07, 0x00
+};
+const PackedIcon sssgraph_icon_packed = {32, 32, sssgraph_icon_packed_palette, 87, sssgraph_icon_packed_data, 1348};
+
+// cyborg_icon565, 32x32px, 49 colors, 1544 bytes (raw 2048)
+static const uint16_t cyborg_icon_packed_palette [] PROGMEM = {
+	0x0000, 0xfba0, 0x0820, 0xc980, 0xfb20, 0xfb80, 0xfbe0, 0xc160, 0xfb40, 0xfca0, 0x1840, 0xb940, 0xea40, 0xfc20, 0xfc40, 0x0800, 
+	0x2860, 0x879f, 0xc960, 0xd1a0, 0xd9e0, 0xf200, 0xfaa0, 0xfc00, 0xfc80, 0xfd20, 0xfdc0, 0x00a4, 0x0106, 0x11c9, 0x11ea, 0x1a0a, 
+	0xa960, 0xb120, 0xd180, 0xd9c0, 0xdae0, 0xdb40, 0xe220, 0xfa80, 0xfac0, 0xfb60, 0xfc60, 0xfcc0, 0xfd00, 0xfd22, 0xfd60, 0xfda0, 
+	0xffdc
+};
+static const uint8_t cyborg_icon_packed_data [] PROGMEM = {
+	0x29, 0x00, 0x40, 0x02, 0xc8, 0x81, 0x51, 0x03, 0x93, 0xe3, 0xcb, 0x21, 0xec, 0xc0, 0xf3, 0xe0, 0xf2, 0x20, 0xd2, 0x80, 0xa1, 0xc0, 0x60, 0x40, 
+	0x0a, 0x12, 0x00, 0x40, 0x02, 0xc4, 0xa4, 0x72, 0xab, 0xed, 0x6c, 0xfe, 0xc6, 0xfd, 0x21, 0xfd, 0x42, 0x09, 0x0d, 0x05, 0xc0, 0x00, 0xfb, 0x41, 
+	0x16, 0x0c, 0xc2, 0xc0, 0xd1, 0x00, 0x91, 0x40, 0x28, 0x0f, 0x00, 0xc6, 0x22, 0x31, 0xef, 0xdd, 0x76, 0xff, 0x53, 0xff, 0xcf, 0xfe, 0x69, 0xfe, 
+	0x03, 0xfe, 0x48, 0x2e, 0x2b, 0x0d, 0x01, 0x04, 0x16, 0x0c, 0x23, 0x12, 0xc0, 0xc0, 0x70, 0x40, 0x0f, 0x0c, 0x00, 0xc1, 0xc3, 0x49, 0xd3, 0xf6, 
+	0x40, 0x30, 0xc4, 0xfe, 0xff, 0xb8, 0xff, 0x32, 0xff, 0xeb, 0xfe, 0x44, 0xfe, 0x47, 0x1a, 0x19, 0x09, 0x17, 0x05, 0x04, 0x16, 0x0c, 0xc0, 0xc0, 
+	0xd1, 0x40, 0x07, 0xc1, 0x00, 0x99, 0x20, 0x10, 0x0a, 0x00, 0xc2, 0x62, 0x39, 0x8f, 0xf6, 0x76, 0xff, 0x01, 0x30, 0xc3, 0x98, 0xff, 0x31, 0xff, 
+	0xca, 0xfe, 0x43, 0xfe, 0x45, 0x1a, 0x19, 0x09, 0x17, 0x01, 0x08, 0xc0, 0x00, 0xfb, 0x43, 0x27, 0x26, 0x22, 0x07, 0xc0, 0x20, 0xa1, 0x40, 0x0f, 
+	0x08, 0x00, 0xc3, 0x40, 0x08, 0x8a, 0xe5, 0xae, 0xfe, 0x32, 0xff, 0x81, 0x75, 0xff, 0xc4, 0x52, 0xff, 0x0c, 0xff, 0x86, 0xfe, 0x01, 0xfe, 0x80, 
+	0xfd, 0x46, 0x2c, 0x18, 0x06, 0x01, 0x08, 0x04, 0x28, 0xc0, 0x60, 0xf2, 0x42, 0x14, 0x12, 0x03, 0xc0, 0x00, 0x81, 0x08, 0x00, 0xc8, 0xe3, 0x82, 
+	0x2a, 0xfe, 0x6b, 0xfe, 0xac, 0xfe, 0xed, 0xfe, 0xec, 0xfe, 0xca, 0xfe, 0x86, 0xfe, 0x22, 0xfe, 0x40, 0x2f, 0xc0, 0x40, 0xfd, 0x41, 0x09, 0x0e, 
+	0xc0, 0xc0, 0xfb, 0x43, 0x05, 0x08, 0x04, 0x28, 0xc0, 0x60, 0xf2, 0x43, 0x26, 0x13, 0x03, 0x22, 0xc0, 0x80, 0x30, 0x06, 0x00, 0x40, 0x02, 0xc8, 
+	0x05, 0xed, 0x86, 0xfd, 0xa8, 0xfd, 0xc8, 0xfd, 0xe7, 0xfd, 0xc5, 0xfd, 0x43, 0xfd, 0x21, 0xfd, 0x80, 0xfd, 0x44, 0x19, 0x2b, 0x0e, 0x06, 0x01, 
+	0x01, 0x29, 0xc0, 0x21, 0xfc, 0x41, 0x06, 0x05, 0xc0, 0x00, 0xf3, 0x40, 0x0c, 0x01, 0x03, 0xc0, 0x60, 0xa1, 0x06, 0x00, 0xc7, 0x80, 0x49, 0x44, 
+	0xfd, 0x66, 0xfd, 0x6c, 0xed, 0x25, 0xfe, 0x02, 0xfe, 0xc1, 0xfd, 0x40, 0xfd, 0x40, 0x0e, 0xc0, 0xc0, 0xfb, 0x44, 0x2a, 0x0d, 0x06, 0x01, 0x05, 
+	0xc1, 0x22, 0xfc, 0x66, 0xfd, 0x43, 0x09, 0x17, 0x05, 0x08, 0xc0, 0xc0, 0xf2, 0x43, 0x14, 0x07, 0x23, 0x02, 0x05, 0x00, 0xc7, 0x23, 0x93, 0x2b, 
+	0xfe, 0x64, 0xfd, 0xa4, 0xfd, 0xe2, 0xf4, 0xa3, 0xd3, 0x64, 0xcb, 0xe1, 0xeb, 0x45, 0x0d, 0x01, 0x04, 0x01, 0x05, 0x08, 0xc7, 0x02, 0xfc, 0x26, 
+	0xf5, 0x02, 0xfd, 0x61, 0xfc, 0x42, 0xdb, 0xc2, 0xc2, 0xa1, 0xd2, 0x80, 0xe2, 0x42, 0x14, 0x03, 0x12, 0xc0, 0xc0, 0x48, 0x05, 0x00, 0xc5, 0x85, 
+	0xcc, 0x13, 0xff, 0x23, 0xfd, 0x83, 0xa2, 0x6a, 0x32, 0x8d, 0x12, 0x40, 0x1e, 0xc2, 0x47, 0x19, 0xe2, 0x81, 0xc1, 0xfb, 0x43, 0x04, 0x16, 0x04, 
+	0x08, 0xc7, 0x46, 0xfd, 0x24, 0xfd, 0xa3, 0xc3, 0x8a, 0x4a, 0x4f, 0x1b, 0x4f, 0x23, 0x6b, 0x22, 0x44, 0x51, 0x42, 0x20, 0x07, 0x12, 0xc0, 0x40, 
+	0x89, 0x03, 0x00, 0x40, 0x02, 0xcb, 0x22, 0x62, 0x63, 0xfd, 0x82, 0xfd, 0xc5, 0x92, 0x91, 0x23, 0x78, 0x55, 0xfd, 0x8e, 0x5c, 0x56, 0xd2, 0x23, 
+	0x68, 0x09, 0x23, 0x72, 0xc1, 0xfb, 0x41, 0x27, 0x15, 0xc7, 0x41, 0xf3, 0x01, 0xfd, 0xc4, 0xcb, 0x70, 0x2b, 0x17, 0x45, 0xdd, 0x7e, 0xbd, 0x5e, 
+	0x54, 0x34, 0x40, 0x1d, 0xc1, 0x44, 0x41, 0xe0, 0x98, 0x41, 0x07, 0x23, 0xc0, 0x00, 0x51, 0x01, 0x00, 0xc8, 0xc1, 0x20, 0xaa, 0xe5, 0x0a, 0xdd, 
+	0x02, 0xe5, 0x01, 0xdc, 0xed, 0x2a, 0x57, 0x55, 0xff, 0xf7, 0xdf, 0xaf, 0x40, 0x11, 0xc4, 0x9f, 0xa7, 0x50, 0x33, 0x26, 0x09, 0x83, 0xc3, 0xe0, 
+	0xfa, 0x40, 0x15, 0xc5, 0xc1, 0xf3, 0xc1, 0xfc, 0x2c, 0x53, 0xb5, 0x3c, 0xdf, 0xe7, 0xdf, 0xbf, 0x40, 0x11, 0xc3, 0x9f, 0x9f, 0xd1, 0x43, 0x47, 
+	0x09, 0xa1, 0x60, 0x41, 0x21, 0x0b, 0xc1, 0xc3, 0xcb, 0x80, 0xca, 0x40, 0x00, 0xc7, 0xa3, 0x7a, 0x03, 0xfd, 0x64, 0xdc, 0x01, 0xd4, 0xc3, 0xa2, 
+	0x70, 0x2b, 0xda, 0x55, 0x9f, 0x8f, 0x40, 0x11, 0xc4, 0x7f, 0x7f, 0x7e, 0x97, 0xd2, 0x33, 0x27, 0x09, 0x46, 0x72, 0x40, 0x06, 0xc5, 0xe0, 0xe9, 
+	0x01, 0xf4, 0xc1, 0xdb, 0xcd, 0x22, 0x79, 0x2d, 0x9f, 0x9f, 0x40, 0x11, 0xc2, 0x7f, 0x77, 0x5e, 0x97, 0xb1, 0x33, 0x40, 0x1b, 0xc1, 0x45, 0x39, 
+	0xe0, 0xa0, 0x40, 0x0b, 0xc3, 0x01, 0xcb, 0xa0, 0xf2, 0xc0, 0x40, 0x00, 0x82, 0x40, 0x01, 0xc9, 0xa2, 0xdb, 0xa1, 0xcb, 0xa4, 0x92, 0x2b, 0x12, 
+	0x75, 0x1c, 0x3c, 0x3e, 0xfe, 0x5e, 0x1e, 0x67, 0xde, 0x56, 0x90, 0x2b, 0x40, 0x1c, 0xe1, 0x84, 0x59, 0xa2, 0xfc, 0xe0, 0xe9, 0x21, 0xf4, 0xc0, 
+	0xba, 0xe9, 0x19, 0xf3, 0x13, 0x3c, 0x46, 0xfe, 0x5e, 0xde, 0x5e, 0x7d, 0x4e, 0xd2, 0x23, 0x83, 0x00, 0x04, 0x31, 0xe0, 0x98, 0x20, 0xb9, 0xa1, 
+	0xca, 0x00, 0xda, 0x80, 0x40, 0x60, 0x79, 0xc0, 0xea, 0x41, 0xc2, 0x40, 0xcb, 0xc2, 0xc2, 0x29, 0x2a, 0xc9, 0x09, 0x99, 0x2d, 0x1c, 0x36, 0x9d, 
+	0x4e, 0x98, 0x55, 0x67, 0x09, 0xc4, 0x00, 0x28, 0x93, 0xc2, 0xfc, 0x40, 0x15, 0xc8, 0x21, 0xf4, 0x60, 0xba, 0x28, 0x4a, 0x68, 0x01, 0xd7, 0x14, 
+	0xba, 0x25, 0x3c, 0x3e, 0x5c, 0x5e, 0x67, 0x11, 0x40, 0x1b, 0xc6, 0x44, 0x41, 0x00, 0xa1, 0x20, 0xb9, 0x80, 0xb1, 0xa0, 0xc9, 0x80, 0x40, 0xc0, 
+	0x60, 0x40, 0x14, 0xc8, 0x00, 0xc2, 0xc0, 0xca, 0xa2, 0xdb, 0x2b, 0x73, 0xa8, 0x11, 0x26, 0x09, 0xcd, 0x1a, 0x2a, 0x1a, 0xe5, 0x00, 0x40, 0x1c, 
+	0xc1, 0xaf, 0x4b, 0x67, 0xc4, 0x41, 0x2c, 0x15, 0xc2, 0xa1, 0xfc, 0x60, 0xe3, 0xe7, 0x92, 0x40, 0x1f, 0xc3, 0x46, 0x09, 0x90, 0x2b, 0x90, 0x33, 
+	0x06, 0x09, 0x40, 0x1b, 0xc1, 0xac, 0x32, 0xc5, 0x71, 0x42, 0x0b, 0x21, 0x20, 0xc2, 0x40, 0xc1, 0xa0, 0x48, 0xc0, 0x68, 0x40, 0x03, 0xc1, 0xe0, 
+	0xc1, 0xa0, 0xca, 0x40, 0x06, 0xc3, 0x84, 0xc3, 0x28, 0x83, 0xcb, 0x42, 0xc9, 0x19, 0x40, 0x1d, 0xc3, 0xac, 0x2a, 0x4f, 0x74, 0xe8, 0xb3, 0x42, 
+	0xfd, 0x40, 0x19, 0xc1, 0x82, 0xfc, 0xe0, 0xfc, 0x40, 0x0e, 0xc2, 0x80, 0xca, 0x26, 0xab, 0x2b, 0x53, 0x40, 0x1f, 0xc4, 0xa8, 0x11, 0x09, 0x22, 
+	0xcd, 0x6b, 0xc6, 0x9a, 0x40, 0xb1, 0x40, 0x07, 0xc0, 0x60, 0xb9, 0x41, 0x20, 0x07, 0xc1, 0xc0, 0x48, 0xc0, 0x50, 0x40, 0x13, 0xc1, 0xe0, 0xb9, 
+	0x60, 0xc2, 0x01, 0x01, 0xc6, 0x03, 0xec, 0xc3, 0xcb, 0x06, 0xd4, 0x46, 0xd4, 0x25, 0xd4, 0x23, 0xd4, 0xe2, 0xfc, 0x45, 0x2b, 0x09, 0x18, 0x0e, 
+	0x17, 0x01, 0xc6, 0x00, 0xe3, 0xe1, 0xca, 0x63, 0xcb, 0xa5, 0xc3, 0x63, 0xcb, 0x40, 0xca, 0xe0, 0xd1, 0x40, 0x03, 0xc2, 0x24, 0xc2, 0xcb, 0xcb, 
+	0x60, 0xb1, 0x42, 0x22, 0x10, 0x00, 0xc3, 0xa0, 0x99, 0x40, 0xda, 0x40, 0xa1, 0xe0, 0xea, 0x43, 0x05, 0x01, 0x06, 0x2a, 0xc2, 0xe0, 0xfc, 0x01, 
+	0xfd, 0xc2, 0xfc, 0x02, 0x2d, 0xc2, 0x02, 0xfd, 0xe2, 0xfc, 0xc1, 0xfc, 0x41, 0x2a, 0x0d, 0xc1, 0xe1, 0xfb, 0x81, 0xfb, 0x42, 0x04, 0x27, 0x26, 
+	0xc0, 0xa0, 0xc9, 0x01, 0x0b, 0x40, 0x21, 0xc1, 0xc0, 0xc9, 0x00, 0x71, 0x02, 0x00, 0xc4, 0xa0, 0x30, 0xe0, 0xc9, 0x60, 0xb1, 0x00, 0xca, 0xc0, 
+	0xe2, 0x42, 0x29, 0x06, 0x18, 0xc1, 0x40, 0xf4, 0xc6, 0xf4, 0x41, 0x2e, 0x2f, 0x01, 0x1a, 0x43, 0x2f, 0x2e, 0x2c, 0x18, 0xc1, 0xc1, 0xea, 0x81, 
+	0xfb, 0x42, 0x28, 0x0c, 0x13, 0xc3, 0x40, 0xc1, 0x40, 0xb1, 0xe0, 0xc9, 0x80, 0xd2, 0x40, 0x0a, 0x04, 0x00, 0xc9, 0x80, 0x28, 0x80, 0x81, 0xc0, 
+	0xb1, 0x00, 0xd2, 0x00, 0xda, 0x20, 0xda, 0x60, 0xd2, 0xc0, 0xd2, 0x00, 0xd3, 0x20, 0xd3, 0x01, 0x25, 0xc0, 0x00, 0xe3, 0x02, 0x24, 0xc8, 0xa0, 
+	0xda, 0x60, 0xd2, 0x00, 0xca, 0xc0, 0xc1, 0xc0, 0xc9, 0xe0, 0xd1, 0x20, 0xda, 0x20, 0xc2, 0x80, 0x79, 0x40, 0x0a, 0x09, 0x00, 0x40, 0x10, 0xd0, 
+	0xc0, 0x58, 0x40, 0x89, 0xc0, 0xb1, 0x41, 0xc2, 0x01, 0xc2, 0x62, 0xba, 0x82, 0xba, 0xa2, 0xba, 0x62, 0xba, 0x41, 0xb2, 0x21, 0xb2, 0x01, 0xb2, 
+	0x01, 0xba, 0xe0, 0xb1, 0x80, 0x91, 0x00, 0x69, 0x80, 0x38, 0x40, 0x02, 0x0e, 0x00, 0xc0, 0x05, 0x09, 0x40, 0x1c, 0xc1, 0x68, 0x4a, 0x66, 0x29, 
+	0x41, 0x1d, 0x1f, 0xc1, 0xac, 0x2a, 0x8c, 0x22, 0x40, 0x1e, 0xc4, 0x47, 0x09, 0x45, 0x29, 0x88, 0x4a, 0x83, 0x00, 0x83, 0x08, 0x0e, 0x00, 0x40, 
+	0x0a, 0xd2, 0x60, 0xba, 0x84, 0x82, 0xc8, 0x29, 0x2a, 0x22, 0xe3, 0x81, 0x02, 0xd3, 0x23, 0xd3, 0xe3, 0xb2, 0xa9, 0x93, 0x68, 0x93, 0xe3, 0xb2, 
+	0x81, 0xda, 0xa1, 0xda, 0x44, 0x7a, 0x67, 0x11, 0x44, 0x39, 0x40, 0x81, 0x80, 0xba, 0xe0, 0x28, 0x0b, 0x00, 0x40, 0x02, 0xd1, 0x80, 0xdb, 0xe4, 
+	0xd3, 0x85, 0x72, 0x29, 0x2a, 0x0b, 0x1a, 0xc8, 0x21, 0xa5, 0x49, 0x62, 0x69, 0x84, 0xa2, 0x43, 0x92, 0x43, 0x61, 0x85, 0x39, 0x0a, 0x22, 0xea, 
+	0x19, 0xa6, 0x31, 0xa2, 0x69, 0x80, 0xc1, 0x60, 0xb9, 0x40, 0x0f, 0x0c, 0x00, 0xc6, 0xc0, 0x28, 0x20, 0xe3, 0xe3, 0xd3, 0xa4, 0x82, 0x87, 0x62, 
+	0xe8, 0x29, 0xca, 0x19, 0x40, 0x1e, 0xc7, 0x2b, 0x1a, 0x6c, 0x1a, 0xad, 0x22, 0x2a, 0x22, 0xc6, 0x31, 0x05, 0x52, 0xe2, 0x79, 0xa0, 0xc1, 0x41, 
+	0x03, 0x10, 0x0e, 0x00, 0xcc, 0x80, 0x20, 0x80, 0xba, 0xa1, 0xeb, 0x83, 0xb3, 0xa4, 0x82, 0x26, 0x5a, 0x47, 0x5a, 0x67, 0x62, 0x66, 0x62, 0x26, 
+	0x5a, 0x05, 0x5a, 0x64, 0x7a, 0x42, 0xb2, 0x40, 0x13, 0xc0, 0xa0, 0xc1, 0x40, 0x10, 0x10, 0x00, 0x40, 0x02, 0xcb, 0x80, 0x71, 0xc0, 0xd2, 0x60, 
+	0xe3, 0x41, 0xf4, 0x42, 0xd4, 0x22, 0xbc, 0xe2, 0xbb, 0xa1, 0xd3, 0x41, 0xeb, 0x40, 0xd2, 0x00, 0xd2, 0x20, 0x71, 0x40, 0x0f, 0x13, 0x00, 0x40, 
+	0x0a, 0xc2, 0xa0, 0x71, 0x60, 0xaa, 0xe0, 0xd2, 0x40, 0x25, 0xc3, 0x41, 0xdb, 0xc1, 0xca, 0x21, 0x9a, 0x40, 0x59, 0x40, 0x02, 0x19, 0x00, 0xc0, 
+	0x40, 0x10, 0x40, 0x02, 0x0e, 0x00
+};
+const PackedIcon cyborg_icon_packed = {32, 32, cyborg_icon_packed_palette, 49, cyborg_icon_packed_data, 1446};
+
+// race_icon565, 32x32px, 65 colors, 1391 bytes (raw 2048)
+static const uint16_t race_icon_packed_palette [] PROGMEM = {
+	0x0000, 0xf800, 0xf820, 0xf841, 0xfc30, 0xf861, 0xfb8e, 0xfcf3, 0x0841, 0xf882, 0xf924, 0xf965, 0xfdd7, 0x10a2, 0xfa28, 0xfa8a, 
+	0x0020, 0xf840, 0xf8e3, 0xfaeb, 0xfb0c, 0xf8c3, 0x2000, 0x5000, 0xf8a2, 0xf9a6, 0xfa08, 0x2965, 0x5820, 0xf020, 0xfa89, 0xfb0b, 
+	0xfeba, 0x0861, 0x18c3, 0x2800, 0x4208, 0x6820, 0x6841, 0xbdd7, 0xe73c, 0xef5d, 0xfa69, 0xfe9a, 0x1082, 0x2945, 0x3020, 0x3186, 
+	0x31a6, 0x5aeb, 0x6000, 0x632c, 0x6b4d, 0x7020, 0x7061, 0x73ae, 0x9cf3, 0xc020, 0xc186, 0xc820, 0xca69, 0xf000, 0xf821, 0xf8a3, 
+	0xfc51
+};
+static const uint8_t race_icon_packed_data [] PROGMEM = {
+	0x0d, 0x00, 0x40, 0x0d, 0x01, 0x10, 0x41, 0x2c, 0x24, 0x16, 0x00, 0x41, 0x08, 0x16, 0xc7, 0x82, 0x68, 0xa2, 0x98, 0xe4, 0xb8, 0x04, 0xc9, 0x04, 
+	0xd1, 0xe3, 0xb8, 0x86, 0xa9, 0x04, 0x79, 0x41, 0x16, 0x21, 0x11, 0x00, 0x41, 0x08, 0x17, 0xc1, 0x66, 0xc1, 0x6d, 0xfb, 0x47, 0x40, 0x04, 0x06, 
+	0x1f, 0x13, 0x06, 0x04, 0x40, 0xc1, 0x4d, 0xfb, 0x65, 0xb9, 0x41, 0x17, 0x08, 0x0d, 0x00, 0x43, 0x1b, 0x2e, 0x3a, 0x07, 0xc0, 0xb7, 0xfd, 0x43, 
+	0x07, 0x04, 0x06, 0x1f, 0x01, 0x0f, 0x43, 0x1f, 0x06, 0x04, 0x07, 0xc1, 0xb6, 0xfd, 0xd3, 0xfc, 0x42, 0x3a, 0x2e, 0x1b, 0x0a, 0x00, 0x40, 0x0d, 
+	0xc1, 0x41, 0x60, 0xef, 0xf3, 0x40, 0x2b, 0xc0, 0xb6, 0xfd, 0x4d, 0x07, 0x04, 0x06, 0x14, 0x1e, 0x0e, 0x1a, 0x0f, 0x14, 0x06, 0x04, 0x07, 0x0c, 
+	0x2b, 0xc1, 0xae, 0xf3, 0x21, 0x60, 0x40, 0x0d, 0x08, 0x00, 0x41, 0x0d, 0x36, 0xc0, 0x34, 0xfd, 0x47, 0x20, 0x0c, 0x07, 0x04, 0x06, 0x13, 0x2a, 
+	0x0e, 0x01, 0x19, 0x42, 0x0e, 0x0f, 0x1f, 0xc0, 0xae, 0xfb, 0x43, 0x04, 0x07, 0x0c, 0x20, 0xc0, 0x14, 0xfd, 0x41, 0x36, 0x0d, 0x06, 0x00, 0x40, 
+	0x2d, 0xc1, 0x21, 0x60, 0x34, 0xfd, 0x45, 0x20, 0x0c, 0x07, 0x04, 0x06, 0x13, 0xc1, 0xcb, 0xfa, 0x49, 0xfa, 0x40, 0x19, 0x01, 0x0b, 0xc0, 0xc7, 
+	0xf9, 0x40, 0x1a, 0xc0, 0xcb, 0xfa, 0x44, 0x14, 0x06, 0x04, 0x07, 0x0c, 0xc1, 0xdb, 0xfe, 0x14, 0xfd, 0x41, 0x1c, 0x1b, 0x05, 0x00, 0x40, 0x23, 
+	0xc0, 0xcf, 0xf3, 0x49, 0x20, 0x0c, 0x07, 0x04, 0x06, 0x13, 0x1e, 0x13, 0x2a, 0x0b, 0x01, 0x0a, 0x46, 0x0b, 0x1a, 0x0e, 0x1e, 0x14, 0x06, 0x04, 
+	0xc1, 0x55, 0xfd, 0x18, 0xfe, 0x40, 0x20, 0xc0, 0xae, 0xf3, 0x40, 0x23, 0x04, 0x00, 0x4c, 0x08, 0x3a, 0x2b, 0x0c, 0x07, 0x04, 0x06, 0x13, 0x2a, 
+	0x0e, 0x19, 0x0b, 0x0a, 0x01, 0x12, 0xc1, 0x45, 0xf9, 0x86, 0xf9, 0x48, 0x19, 0x0e, 0x0f, 0x13, 0x06, 0x04, 0x07, 0x0c, 0x2b, 0xc0, 0x65, 0xc1, 
+	0x40, 0x08, 0x03, 0x00, 0x48, 0x17, 0x07, 0x0c, 0x07, 0x04, 0x06, 0x14, 0x0f, 0x0e, 0xc0, 0x04, 0x91, 0x42, 0x0b, 0x0a, 0x12, 0x01, 0x15, 0x42, 
+	0x12, 0x0a, 0x0b, 0xc0, 0x04, 0x91, 0x46, 0x0e, 0x0f, 0x14, 0x06, 0x04, 0x07, 0x0c, 0xc1, 0xd3, 0xfc, 0x20, 0x50, 0x02, 0x00, 0x40, 0x08, 0xc1, 
+	0x66, 0xc1, 0xb7, 0xfd, 0x45, 0x07, 0x04, 0x06, 0x14, 0x0f, 0x1a, 0xc0, 0x65, 0xc1, 0x40, 0x00, 0xc1, 0xe3, 0xb0, 0xe4, 0xf8, 0x01, 0x18, 0x42, 
+	0x09, 0x18, 0x12, 0xc2, 0x04, 0xd9, 0x00, 0x08, 0x24, 0x99, 0x46, 0x1a, 0x2a, 0x14, 0x06, 0x04, 0x07, 0x0c, 0xc0, 0x45, 0xb9, 0x40, 0x21, 0x01, 
+	0x00, 0x40, 0x16, 0xc0, 0x6d, 0xfb, 0x46, 0x07, 0x04, 0x06, 0x13, 0x0f, 0x0e, 0x3c, 0xc0, 0x0c, 0x6b, 0x40, 0x00, 0xc0, 0x82, 0x30, 0x41, 0x15, 
+	0x18, 0xc0, 0x62, 0xf8, 0x42, 0x05, 0x18, 0x15, 0xc0, 0x61, 0x50, 0x40, 0x21, 0xc2, 0x49, 0x4a, 0xeb, 0xc2, 0x08, 0xf2, 0x44, 0x0f, 0x1f, 0x06, 
+	0x04, 0x07, 0xc0, 0x2c, 0xfb, 0x40, 0x16, 0x01, 0x00, 0xc0, 0xa2, 0x70, 0x41, 0x40, 0x04, 0xc9, 0x6d, 0xeb, 0xe7, 0x91, 0x4d, 0xab, 0xef, 0xbb, 
+	0x41, 0x20, 0x71, 0x8c, 0x1c, 0xe7, 0xef, 0x7b, 0x51, 0x8c, 0xc3, 0x90, 0x40, 0x09, 0x01, 0x03, 0x40, 0x05, 0xc0, 0xc2, 0xc0, 0x40, 0x34, 0xc7, 
+	0x92, 0x94, 0x79, 0xce, 0xb6, 0xb5, 0x41, 0x18, 0x4d, 0xa3, 0xef, 0xbb, 0xc7, 0x81, 0x2d, 0xdb, 0x01, 0x04, 0x40, 0x26, 0x01, 0x00, 0xc0, 0x82, 
+	0x98, 0x40, 0x04, 0xc2, 0x8e, 0xd3, 0xf7, 0xc5, 0x04, 0x21, 0x41, 0x31, 0x29, 0xc1, 0x49, 0x4a, 0xe7, 0x39, 0x40, 0x33, 0xc3, 0x69, 0x4a, 0x9a, 
+	0xd6, 0x41, 0x18, 0x41, 0xe8, 0x02, 0x03, 0xc0, 0x45, 0x51, 0x45, 0x27, 0x37, 0x24, 0x31, 0x2d, 0x28, 0xc0, 0x0c, 0x63, 0x41, 0x08, 0x27, 0xc0, 
+	0xcf, 0xc3, 0x40, 0x04, 0xc0, 0x45, 0xa9, 0x41, 0x00, 0x0d, 0xc1, 0x04, 0xb9, 0x0c, 0xcb, 0x40, 0x22, 0xc2, 0xfb, 0xde, 0x10, 0x84, 0x55, 0xad, 
+	0x42, 0x34, 0x2f, 0x28, 0xc2, 0x10, 0x84, 0xe3, 0x18, 0x8a, 0x52, 0x43, 0x00, 0x26, 0x3e, 0x02, 0xc0, 0x41, 0x90, 0x40, 0x00, 0x01, 0x30, 0xc0, 
+	0xcb, 0x5a, 0x40, 0x29, 0xc2, 0x8a, 0x52, 0x69, 0x4a, 0xb6, 0xb5, 0x42, 0x37, 0x28, 0x2f, 0xc1, 0x8a, 0xaa, 0xe3, 0xb8, 0x41, 0x22, 0x10, 0xc1, 
+	0x24, 0xc9, 0x8a, 0xd2, 0x42, 0x00, 0x33, 0x00, 0xc0, 0x96, 0xb5, 0x40, 0x27, 0xc1, 0xc7, 0x39, 0x92, 0x94, 0x41, 0x34, 0x27, 0xc2, 0x18, 0xc6, 
+	0x41, 0x40, 0x20, 0x80, 0x40, 0x3b, 0xc1, 0x21, 0xe8, 0x20, 0x60, 0x41, 0x25, 0x38, 0xc1, 0xdb, 0xde, 0xcb, 0x5a, 0x41, 0x38, 0x24, 0xc1, 0xb2, 
+	0x94, 0x79, 0xce, 0x42, 0x08, 0x31, 0x08, 0xc1, 0x28, 0xb2, 0x04, 0xc9, 0x01, 0x10, 0xc0, 0xe3, 0xd0, 0x40, 0x1e, 0xc0, 0x8a, 0xa2, 0x40, 0x28, 
+	0xc1, 0xe7, 0x39, 0xd3, 0x9c, 0x41, 0x10, 0x37, 0xc0, 0xfb, 0xde, 0x41, 0x0d, 0x24, 0xc1, 0x8e, 0xc3, 0x41, 0xf0, 0x42, 0x1d, 0x1c, 0x35, 0xc0, 
+	0x20, 0xd8, 0x40, 0x03, 0xc1, 0xaa, 0xc2, 0x0c, 0x63, 0x40, 0x10, 0xc0, 0x59, 0xce, 0x41, 0x38, 0x00, 0xc3, 0x51, 0x8c, 0xc7, 0x39, 0xba, 0xd6, 
+	0x6d, 0xa3, 0x40, 0x1e, 0xc0, 0xe3, 0xc8, 0x41, 0x08, 0x2c, 0xc0, 0xa2, 0xb8, 0x40, 0x0e, 0xc1, 0xa6, 0xe9, 0x34, 0xb5, 0x41, 0x33, 0x29, 0xc1, 
+	0xaa, 0x62, 0xa2, 0x68, 0x40, 0x3c, 0xc1, 0x04, 0xb1, 0x41, 0xd0, 0x42, 0x11, 0x02, 0x3e, 0xc1, 0x20, 0x90, 0x00, 0x68, 0x02, 0x02, 0xc1, 0x41, 
+	0xe0, 0xa2, 0xa8, 0x40, 0x3c, 0xc1, 0x04, 0x81, 0x65, 0x41, 0x40, 0x29, 0xc2, 0xef, 0x7b, 0x55, 0xad, 0xc7, 0xd9, 0x40, 0x1a, 0xc0, 0x82, 0xb8, 
+	0x41, 0x22, 0x00, 0xc0, 0x61, 0xa0, 0x41, 0x19, 0x0b, 0xc0, 0xe3, 0x98, 0x40, 0x00, 0xc1, 0xaa, 0x9a, 0x04, 0xe1, 0x40, 0x09, 0x01, 0x03, 0x43, 
+	0x11, 0x05, 0x03, 0x02, 0xc0, 0x00, 0x58, 0x47, 0x1c, 0x1d, 0x02, 0x09, 0x05, 0x03, 0x05, 0x09, 0xc1, 0xa2, 0xf0, 0xeb, 0xb2, 0x40, 0x08, 0xc0, 
+	0x82, 0x68, 0x40, 0x0b, 0xc1, 0xc7, 0xf9, 0x41, 0x98, 0x01, 0x00, 0xc0, 0xe3, 0x80, 0x01, 0x0a, 0x40, 0x12, 0xc1, 0x41, 0x60, 0xe3, 0xf0, 0x40, 
+	0x09, 0x01, 0x03, 0x01, 0x02, 0xc0, 0x45, 0xf9, 0x40, 0x0a, 0xc3, 0x00, 0xb0, 0x00, 0x98, 0x00, 0xc8, 0x20, 0x80, 0x43, 0x05, 0x03, 0x02, 0x11, 
+	0x01, 0x03, 0x40, 0x0b, 0xc0, 0xa7, 0xf9, 0x40, 0x26, 0xc0, 0xe3, 0xe8, 0x01, 0x0a, 0x40, 0x26, 0x01, 0x00, 0x40, 0x16, 0xc0, 0xc2, 0xf8, 0x45, 
+	0x12, 0x3f, 0x15, 0x09, 0x05, 0x03, 0x02, 0x02, 0x42, 0x11, 0x1d, 0x1c, 0x01, 0x01, 0xc1, 0x41, 0x70, 0x41, 0xe0, 0x40, 0x01, 0x02, 0x02, 0x41, 
+	0x03, 0x05, 0x01, 0x09, 0x42, 0x15, 0x12, 0x3f, 0xc0, 0x41, 0x28, 0x01, 0x00, 0x40, 0x08, 0xc0, 0x41, 0xc0, 0x43, 0x3f, 0x18, 0x09, 0x05, 0x01, 
+	0x03, 0x03, 0x02, 0xc0, 0x20, 0x88, 0x40, 0x39, 0x01, 0x01, 0xc0, 0x20, 0xe0, 0x41, 0x25, 0x01, 0x02, 0x02, 0x02, 0x03, 0x01, 0x09, 0x40, 0x15, 
+	0xc0, 0x41, 0xb8, 0x40, 0x21, 0x02, 0x00, 0x40, 0x17, 0x01, 0x05, 0x02, 0x03, 0x01, 0x02, 0x01, 0x01, 0xc0, 0x00, 0xe0, 0x40, 0x25, 0x03, 0x01, 
+	0xc0, 0x20, 0x88, 0x44, 0x3b, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x05, 0x40, 0x17, 0x03, 0x00, 0xc0, 0x21, 0x08, 0x40, 0x3b, 0x01, 0x03, 
+	0x40, 0x11, 0x01, 0x02, 0x02, 0x01, 0x40, 0x35, 0xc0, 0x00, 0xe0, 0x03, 0x01, 0x42, 0x3d, 0x1c, 0x02, 0x02, 0x01, 0x44, 0x3e, 0x11, 0x03, 0x05, 
+	0x39, 0xc0, 0x20, 0x08, 0x04, 0x00, 0x41, 0x23, 0x1d, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0xc0, 0x00, 0xe8, 0x41, 0x05, 0x02, 0x03, 0x01, 0xc0, 
+	0x20, 0xe0, 0x02, 0x01, 0x01, 0x02, 0x01, 0x05, 0x41, 0x1d, 0x23, 0x05, 0x00, 0x43, 0x2d, 0x32, 0x01, 0x0b, 0xc0, 0x04, 0xf9, 0x03, 0x01, 0x41, 
+	0x11, 0x03, 0x03, 0x01, 0x01, 0x0a, 0x03, 0x01, 0x40, 0x11, 0xc0, 0x62, 0xf8, 0x40, 0x01, 0xc0, 0x00, 0x58, 0x40, 0x1b, 0x06, 0x00, 0x40, 0x0d, 
+	0xc0, 0x20, 0x78, 0x41, 0x05, 0x02, 0x02, 0x01, 0x41, 0x02, 0x11, 0x04, 0x01, 0x41, 0x03, 0x02, 0x02, 0x01, 0x43, 0x02, 0x05, 0x01, 0x35, 0xc0, 
+	0xc2, 0x18, 0x08, 0x00, 0x42, 0x0d, 0x32, 0x3d, 0x0f, 0x01, 0x42, 0x3d, 0x32, 0x22, 0x0a, 0x00, 0x41, 0x1b, 0x2e, 0xc0, 0x00, 0xc8, 0x0d, 0x01, 
+	0xc1, 0x00, 0xc0, 0x20, 0x28, 0x40, 0x2f, 0x0d, 0x00, 0x40, 0x08, 0xc1, 0x20, 0x50, 0x00, 0xc0, 0x09, 0x01, 0x41, 0x39, 0x17, 0xc0, 0x20, 0x08, 
+	0x11, 0x00, 0x42, 0x08, 0x16, 0x25, 0xc1, 0x00, 0xa0, 0x00, 0xb8, 0x81, 0x00, 0xd0, 0xc1, 0x20, 0xb8, 0x00, 0x98, 0x40, 0x36, 0xc0, 0x41, 0x28, 
+	0x40, 0x08, 0x17, 0x00, 0x40, 0x2c, 0x01, 0x10, 0x41, 0x0d, 0x30, 0x0c, 0x00
+};
+const PackedIcon race_icon_packed = {32, 32, race_icon_packed_palette, 65, race_icon_packed_data, 1261};
+
+// car_icon565, 32x32px, 79 colors, 1405 bytes (raw 2048)
+static const uint16_t car_icon_packed_palette [] PROGMEM = {
+	0x0223, 0x0000, 0x0325, 0x0305, 0x0020, 0x0203, 0x0264, 0x02e5, 0x01e3, 0x00a1, 0x0284, 0x0040, 0x0142, 0x00c1, 0x0385, 0x03c6, 
+	0x0224, 0x0162, 0x01c3, 0x02a4, 0x04a8, 0x0122, 0x0345, 0x00e1, 0x0060, 0x0061, 0x03a6, 0x03e6, 0x0447, 0x06cc, 0x0183, 0x0569, 
+	0x0101, 0x02c4, 0x0467, 0x04c8, 0x0509, 0x05ea, 0x0102, 0x0386, 0x0427, 0x0406, 0x04e8, 0x060a, 0x37f1, 0x0487, 0x0548, 0x0589, 
+	0x062b, 0x0182, 0x0426, 0x0549, 0x05aa, 0x17ef, 0x03a5, 0x0407, 0x064b, 0x068b, 0x27f0, 0x47f2, 0x4ff3, 0x6ff5, 0x02c5, 0x0508, 
+	0x05ca, 0x06cb, 0x072c, 0x076d, 0x0fee, 0x27ef, 0x57f3, 0x5ff4, 0x00e2, 0x02e4, 0x058a, 0x070b, 0x07ed, 0x1ff0, 0x77f5
+};
+static const uint8_t car_icon_packed_data [] PROGMEM = {
+	0x03, 0x01, 0x01, 0x04, 0x40, 0x18, 0x02, 0x09, 0x44, 0x17, 0x20, 0x0c, 0x05, 0x07, 0x01, 0x02, 0x43, 0x03, 0x00, 0x0c, 0x26, 0x01, 0x09, 0x41, 
+	0x18, 0x0b, 0x01, 0x04, 0x06, 0x01, 0x01, 0x04, 0x4a, 0x18, 0x09, 0x0d, 0x17, 0x26, 0x15, 0x0c, 0x11, 0x08, 0x28, 0x43, 0x01, 0x30, 0x45, 0x39, 
+	0x2f, 0x08, 0x0c, 0x20, 0x17, 0x01, 0x09, 0x42, 0x19, 0x0b, 0x04, 0x05, 0x01, 0x44, 0x0b, 0x09, 0x17, 0x26, 0x0c, 0x02, 0x11, 0x53, 0x1e, 0x08, 
+	0x06, 0x25, 0x1c, 0x07, 0x21, 0x16, 0x38, 0x06, 0x1e, 0x0c, 0x15, 0x20, 0x26, 0x48, 0x0d, 0x19, 0x0b, 0x04, 0x02, 0x01, 0x44, 0x0b, 0x09, 0x17, 
+	0x0c, 0x08, 0xc0, 0xa5, 0x02, 0x41, 0x07, 0x0a, 0x01, 0x00, 0x46, 0x06, 0x03, 0x1d, 0x1b, 0x0a, 0x06, 0x03, 0xc0, 0x8c, 0x06, 0x41, 0x07, 0x00, 
+	0x01, 0x12, 0xc0, 0xc2, 0x01, 0x4d, 0x00, 0x05, 0x11, 0x17, 0x0d, 0x0b, 0x04, 0x01, 0x04, 0x18, 0x0d, 0x0c, 0x05, 0x02, 0xc0, 0xef, 0x07, 0x40, 
+	0x44, 0xc0, 0x6a, 0x05, 0x43, 0x02, 0x03, 0x1a, 0x25, 0xc0, 0xee, 0x07, 0x56, 0x27, 0x06, 0x00, 0x13, 0x1d, 0x30, 0x0f, 0x13, 0x06, 0x27, 0x30, 
+	0x2b, 0x3e, 0x1e, 0x17, 0x09, 0x04, 0x01, 0x04, 0x09, 0x15, 0x08, 0x02, 0xc0, 0xef, 0x07, 0x41, 0x3f, 0x29, 0xc0, 0x2d, 0x07, 0x42, 0x1d, 0x42, 
+	0x43, 0xc0, 0xe7, 0x04, 0x48, 0x16, 0x0a, 0x00, 0x05, 0x10, 0x07, 0x0e, 0x25, 0x38, 0xc0, 0xe9, 0x04, 0x45, 0x30, 0x07, 0x03, 0x25, 0x03, 0x0c, 
+	0xc0, 0xc2, 0x00, 0x44, 0x0b, 0x04, 0x0b, 0x09, 0x0c, 0xc1, 0x63, 0x02, 0xae, 0x07, 0x48, 0x1f, 0x27, 0x02, 0x16, 0x25, 0x14, 0x02, 0x13, 0x10, 
+	0x01, 0x00, 0x01, 0x05, 0x55, 0x00, 0x10, 0x0a, 0x03, 0x24, 0x3e, 0x00, 0x10, 0x13, 0x40, 0x00, 0x17, 0x18, 0x0b, 0x19, 0x0d, 0x11, 0x0a, 0x43, 
+	0x2f, 0x16, 0x21, 0x01, 0x13, 0x41, 0x0a, 0x10, 0x01, 0x00, 0x40, 0x10, 0x04, 0x00, 0x01, 0x05, 0x4e, 0x00, 0x05, 0x08, 0x10, 0x13, 0x40, 0x10, 
+	0x20, 0x09, 0x0b, 0x09, 0x17, 0x11, 0x00, 0x0f, 0xc0, 0xf0, 0x17, 0x42, 0x22, 0x07, 0x06, 0x02, 0x00, 0x43, 0x06, 0x03, 0x27, 0x1a, 0x01, 0x0f, 
+	0x42, 0x0e, 0x0a, 0x00, 0x02, 0x05, 0x50, 0x08, 0x06, 0x33, 0x27, 0x31, 0x20, 0x09, 0x0b, 0x0d, 0x15, 0x31, 0x00, 0x03, 0x24, 0x35, 0x03, 0x10, 
+	0x01, 0x00, 0x41, 0x13, 0x16, 0x01, 0x03, 0x01, 0x02, 0x44, 0x03, 0x16, 0x29, 0x1a, 0x10, 0x01, 0x05, 0x58, 0x08, 0x27, 0x23, 0x10, 0x11, 0x17, 
+	0x09, 0x0b, 0x17, 0x0c, 0x08, 0x00, 0x02, 0x39, 0x1d, 0x49, 0x10, 0x00, 0x21, 0x02, 0x13, 0x03, 0x24, 0x4b, 0x1d, 0xc0, 0xc9, 0x05, 0x44, 0x0f, 
+	0x02, 0x0e, 0x1b, 0x00, 0x01, 0x08, 0x6b, 0x0a, 0x1f, 0x00, 0x11, 0x20, 0x0d, 0x18, 0x15, 0x12, 0x00, 0x21, 0x0f, 0x35, 0x37, 0x13, 0x10, 0x0a, 
+	0x02, 0x13, 0x07, 0x1a, 0x3a, 0x4a, 0x2a, 0x1f, 0x42, 0x4a, 0x02, 0x16, 0x1a, 0x05, 0x08, 0x10, 0x1c, 0x02, 0x12, 0x0c, 0x17, 0x09, 0x31, 0x06, 
+	0x03, 0x36, 0x2e, 0xc0, 0xee, 0x07, 0x47, 0x16, 0x0a, 0x06, 0x02, 0x21, 0x49, 0x16, 0x0f, 0xc0, 0x2a, 0x06, 0x48, 0x44, 0x14, 0x29, 0x0f, 0x25, 
+	0x1f, 0x07, 0x1b, 0x0a, 0x01, 0x05, 0x48, 0x0a, 0x14, 0x00, 0x12, 0x0c, 0x48, 0x06, 0x2b, 0x4c, 0xc1, 0xee, 0x17, 0xf0, 0x2f, 0x49, 0x2a, 0x21, 
+	0x0a, 0x13, 0x16, 0x0e, 0x14, 0x2d, 0x32, 0x22, 0xc1, 0xab, 0x06, 0xef, 0x0f, 0x46, 0x22, 0x1a, 0x0e, 0x39, 0x0e, 0x07, 0x1b, 0x01, 0x05, 0x43, 
+	0x10, 0x14, 0x23, 0x22, 0xc0, 0xc7, 0x03, 0x41, 0x11, 0x03, 0xc0, 0xf1, 0x27, 0x48, 0x2e, 0x2d, 0x37, 0x02, 0x13, 0x0a, 0x07, 0x16, 0x23, 0xc0, 
+	0xf4, 0x67, 0x43, 0x3b, 0x1f, 0x14, 0x2a, 0xc0, 0x8e, 0x07, 0x41, 0x42, 0x0e, 0xc0, 0x04, 0x03, 0x47, 0x28, 0x1f, 0x21, 0x29, 0x10, 0x08, 0x12, 
+	0x05, 0x01, 0x00, 0x49, 0x37, 0x10, 0x16, 0x4d, 0x32, 0x0e, 0x03, 0x21, 0x0a, 0x06, 0xc0, 0x04, 0x03, 0x43, 0x27, 0x41, 0x35, 0x43, 0xc1, 0xf3, 
+	0x47, 0xeb, 0x05, 0x40, 0x25, 0xc0, 0xf2, 0x37, 0x4f, 0x1f, 0x0e, 0x03, 0x1a, 0x34, 0x07, 0x29, 0x10, 0x08, 0x12, 0x1e, 0x12, 0x08, 0x27, 0x06, 
+	0x16, 0xc0, 0xf0, 0x17, 0x48, 0x1c, 0x1a, 0x02, 0x07, 0x13, 0x0a, 0x02, 0x0e, 0x2b, 0xc0, 0xef, 0x1f, 0x41, 0x2f, 0x1d, 0x01, 0x3c, 0x46, 0x2b, 
+	0x29, 0x0e, 0x02, 0x0f, 0x34, 0x03, 0xc0, 0x46, 0x04, 0x58, 0x06, 0x05, 0x08, 0x1e, 0x12, 0x08, 0x0e, 0x06, 0x03, 0x2c, 0x38, 0x2e, 0x22, 0x0e, 
+	0x07, 0x13, 0x03, 0x0e, 0x3f, 0x3b, 0x1f, 0x24, 0x34, 0x2f, 0x2d, 0xc0, 0xc5, 0x03, 0x01, 0x0e, 0x43, 0x23, 0x33, 0x02, 0x14, 0xc0, 0xa5, 0x02, 
+	0x40, 0x00, 0x01, 0x05, 0x41, 0x10, 0x06, 0xc1, 0x88, 0x04, 0x04, 0x02, 0x41, 0x00, 0x22, 0xc0, 0x8d, 0x07, 0x54, 0x35, 0x3c, 0x2f, 0x16, 0x21, 
+	0x07, 0x0e, 0x1c, 0x2c, 0x4b, 0x3f, 0x23, 0x14, 0x2d, 0x32, 0x1b, 0x0f, 0x14, 0x39, 0x0f, 0x1c, 0xc0, 0x68, 0x04, 0x60, 0x0a, 0x06, 0x14, 0x28, 
+	0x1a, 0x06, 0x15, 0x12, 0x06, 0x03, 0x0f, 0x1f, 0x4d, 0x0f, 0x49, 0x13, 0x16, 0x0f, 0x33, 0x47, 0x4b, 0x34, 0x1f, 0x2e, 0x1f, 0x2e, 0x2d, 0x32, 
+	0x14, 0x38, 0x1b, 0x28, 0x14, 0xc0, 0x46, 0x03, 0x49, 0x37, 0x08, 0x0c, 0x15, 0x0d, 0x0c, 0x12, 0x06, 0x07, 0x28, 0xc0, 0xf1, 0x2f, 0x45, 0x23, 
+	0x02, 0x21, 0x07, 0x0e, 0x37, 0xc0, 0xa9, 0x05, 0x41, 0x46, 0x47, 0xc0, 0xf1, 0x3f, 0x40, 0x2c, 0x01, 0x3d, 0x51, 0x1d, 0x24, 0x22, 0x2d, 0x30, 
+	0x0f, 0x1b, 0x4a, 0x06, 0x11, 0x15, 0x0d, 0x19, 0x26, 0x1e, 0x05, 0x13, 0x0f, 0xc0, 0xab, 0x06, 0x41, 0x35, 0x36, 0x01, 0x07, 0x45, 0x02, 0x36, 
+	0x32, 0x24, 0x1d, 0x45, 0xc0, 0xf0, 0x37, 0x40, 0x45, 0xc1, 0xf2, 0x4f, 0xf7, 0x87, 0x41, 0x1d, 0x33, 0xc0, 0x46, 0x04, 0x50, 0x1c, 0x40, 0x02, 
+	0x0a, 0x08, 0x15, 0x17, 0x19, 0x0b, 0x0d, 0x11, 0x08, 0x0a, 0x1b, 0x41, 0x3a, 0x0f, 0x02, 0x03, 0x43, 0x16, 0x1b, 0x22, 0x25, 0xc0, 0xad, 0x07, 
+	0x43, 0x44, 0x45, 0x3a, 0x47, 0xc0, 0xf7, 0x87, 0x53, 0x1d, 0x23, 0x1b, 0x1a, 0x2a, 0x3e, 0x12, 0x15, 0x0d, 0x19, 0x0b, 0x0d, 0x0c, 0x08, 0x07, 
+	0x2e, 0x3c, 0x2a, 0x36, 0x16, 0x01, 0x02, 0x42, 0x16, 0x36, 0x1c, 0xc0, 0x0c, 0x07, 0x40, 0x4e, 0xc2, 0xf8, 0x97, 0xf9, 0xa7, 0xfb, 0xc7, 0x50, 
+	0x2c, 0x3d, 0x4e, 0x2b, 0x1c, 0x02, 0x07, 0x28, 0x10, 0x0c, 0x0d, 0x19, 0x04, 0x19, 0x15, 0x12, 0x02, 0xc0, 0xf1, 0x3f, 0x41, 0x2b, 0x1c, 0x01, 
+	0x0f, 0x47, 0x32, 0x29, 0x1b, 0x0f, 0x28, 0x23, 0x40, 0x39, 0xc0, 0x6c, 0x07, 0x40, 0x2c, 0xc0, 0xfb, 0xbf, 0x50, 0x2c, 0x3d, 0x46, 0x24, 0x02, 
+	0x06, 0x00, 0x27, 0x12, 0x17, 0x18, 0x04, 0x19, 0x26, 0x12, 0x07, 0x4d, 0xc0, 0xad, 0x07, 0x4b, 0x14, 0x22, 0x33, 0x2c, 0x45, 0x2f, 0x14, 0x2d, 
+	0x14, 0x2a, 0x2f, 0x30, 0xc0, 0x4c, 0x07, 0x40, 0x3b, 0xc1, 0xfa, 0xb7, 0xef, 0x0f, 0x4f, 0x3b, 0x4c, 0x03, 0x00, 0x31, 0x1e, 0x07, 0x11, 0x18, 
+	0x04, 0x0b, 0x48, 0x11, 0x00, 0x1b, 0x3a, 0xc0, 0xce, 0x07, 0x40, 0x2b, 0xc1, 0xf4, 0x57, 0xce, 0x07, 0x41, 0x4c, 0x47, 0xc0, 0xf2, 0x3f, 0x44, 
+	0x1d, 0x33, 0x23, 0x24, 0x25, 0xc0, 0xcd, 0x07, 0x40, 0x4e, 0xc1, 0xfb, 0xc7, 0x8d, 0x07, 0x44, 0x2a, 0x28, 0x3e, 0x08, 0x11, 0x01, 0x15, 0x41, 
+	0x0a, 0x0d, 0x01, 0x04, 0x47, 0x09, 0x26, 0x1e, 0x0a, 0x29, 0x3a, 0x3c, 0x25, 0x01, 0x1c, 0x41, 0x3f, 0x42, 0xc0, 0xf8, 0x97, 0x42, 0x38, 0x23, 
+	0x24, 0xc1, 0x2a, 0x06, 0xf8, 0x9f, 0x55, 0x2c, 0x1d, 0x14, 0x0e, 0x13, 0x00, 0x12, 0x15, 0x17, 0x0d, 0x0c, 0x15, 0x0b, 0x04, 0x18, 0x0d, 0x20, 
+	0x31, 0x00, 0x02, 0x0e, 0x02, 0x01, 0x03, 0x45, 0x1a, 0x14, 0x3b, 0x41, 0x2a, 0x24, 0xc1, 0x4a, 0x06, 0xf6, 0x7f, 0x51, 0x2b, 0x1c, 0x02, 0x0a, 
+	0x05, 0x11, 0x31, 0x0c, 0x0d, 0x09, 0x12, 0x0d, 0x04, 0x01, 0x0b, 0x19, 0x0d, 0x26, 0xc0, 0x63, 0x01, 0x40, 0x12, 0x01, 0x05, 0x45, 0x00, 0x06, 
+	0x13, 0x0f, 0x35, 0x44, 0x01, 0x34, 0x44, 0x41, 0x3d, 0x14, 0x02, 0x0a, 0xc0, 0xe2, 0x01, 0x47, 0x11, 0x20, 0x17, 0x15, 0x11, 0x1e, 0x15, 0x0b, 
+	0x02, 0x01, 0x4b, 0x04, 0x0b, 0x09, 0x0d, 0x20, 0x15, 0x0c, 0x1e, 0x08, 0x00, 0x07, 0x2e, 0xc0, 0xf6, 0x7f, 0x01, 0x46, 0xc1, 0xf3, 0x5f, 0xef, 
+	0x1f, 0x46, 0x1a, 0x06, 0x08, 0x11, 0x26, 0x09, 0x19, 0x02, 0x18, 0x41, 0x0b, 0x04, 0x03, 0x01, 0x41, 0x04, 0x0b, 0x01, 0x18, 0x48, 0x09, 0x0d, 
+	0x20, 0x0c, 0x1e, 0x00, 0x07, 0x28, 0x14, 0xc0, 0xa7, 0x04, 0x47, 0x22, 0x0e, 0x06, 0x12, 0x0c, 0x17, 0x19, 0x0b, 0x03, 0x04, 0x02, 0x01
+};
+const PackedIcon car_icon_packed = {32, 32, car_icon_packed_palette, 79, car_icon_packed_data, 1247};
+
+// transceiver_icon565, 32x32px, 44 colors, 1156 bytes (raw 2048)
+static const uint16_t transceiver_icon_packed_palette [] PROGMEM = {
+	0x0000, 0x555a, 0x4414, 0xf7df, 0x6d9b, 0x75bc, 0x657b, 0x74d5, 0x5d5a, 0x75bb, 0x5d5b, 0x5c75, 0x5c76, 0xf7bf, 0x4c35, 0x5d7b, 
+	0x4455, 0x8578, 0x43f3, 0x4cd8, 0x553a, 0x6d5a, 0x2a8c, 0x2a8d, 0x3350, 0xae3a, 0x0041, 0x3a4a, 0x6475, 0x64b6, 0x659b, 0x6d9c, 
+	0xefbe, 0x0882, 0x43f4, 0x4c14, 0x5c96, 0x6cf7, 0x7d38, 0x85fc, 0x9e5c, 0xd71d, 0xe77e, 0xef9e
+};
+static const uint8_t transceiver_icon_packed_data [] PROGMEM = {
+	0x23, 0x00, 0x40, 0x21, 0xc1, 0xed, 0x4a, 0x73, 0x6c, 0x11, 0x07, 0xc1, 0x73, 0x74, 0xed, 0x4a, 0x40, 0x21, 0x06, 0x00, 0x40, 0x1b, 0xc0, 0xda, 
+	0x85, 0x40, 0x04, 0x01, 0x08, 0x03, 0x01, 0x40, 0x1e, 0x03, 0x04, 0x40, 0x06, 0x07, 0x01, 0x40, 0x04, 0xc0, 0xda, 0x85, 0x40, 0x1b, 0x04, 0x00, 
+	0x41, 0x1b, 0x27, 0x01, 0x0a, 0x40, 0x08, 0x01, 0x06, 0x40, 0x0a, 0x01, 0x01, 0x40, 0x06, 0x03, 0x04, 0x40, 0x08, 0x09, 0x01, 0xc0, 0xdb, 0x7d, 
+	0x40, 0x1b, 0x02, 0x00, 0x40, 0x21, 0xc0, 0xba, 0x7d, 0x01, 0x06, 0x40, 0x08, 0x02, 0x0f, 0x43, 0x04, 0x08, 0x01, 0x0a, 0x03, 0x04, 0x40, 0x08, 
+	0x05, 0x01, 0x01, 0x06, 0x40, 0x08, 0x01, 0x01, 0xc1, 0x9a, 0x7d, 0x62, 0x08, 0x01, 0x00, 0xc0, 0xcc, 0x42, 0x40, 0x04, 0x02, 0x06, 0x01, 0x04, 
+	0x44, 0x08, 0x06, 0x04, 0x01, 0x0a, 0x01, 0x09, 0x41, 0x04, 0x08, 0x05, 0x01, 0x40, 0x06, 0x02, 0x04, 0x42, 0x0a, 0x06, 0x04, 0xc0, 0xec, 0x42, 
+	0x01, 0x00, 0xc0, 0x33, 0x5c, 0x03, 0x04, 0x40, 0x27, 0xc2, 0x3c, 0x96, 0xfb, 0x85, 0xdc, 0x7d, 0x44, 0x04, 0x01, 0x0a, 0x05, 0x1e, 0x01, 0x01, 
+	0x01, 0x06, 0x02, 0x01, 0x44, 0x0f, 0x04, 0x06, 0x04, 0x06, 0x02, 0x04, 0xc0, 0x33, 0x5c, 0x01, 0x00, 0x40, 0x1c, 0x03, 0x04, 0x40, 0x28, 0x02, 
+	0x03, 0xc1, 0xbf, 0xef, 0x1d, 0xcf, 0x42, 0x28, 0x09, 0x0a, 0x05, 0x01, 0x43, 0x08, 0x05, 0x04, 0x06, 0x04, 0x04, 0x40, 0x1c, 0x01, 0x00, 0x40, 
+	0x0b, 0x02, 0x04, 0x41, 0x09, 0x28, 0x05, 0x03, 0x40, 0x0d, 0xc1, 0xdd, 0xbe, 0xbb, 0x6d, 0x03, 0x01, 0x46, 0x08, 0x01, 0x04, 0x1e, 0x0f, 0x04, 
+	0x09, 0x02, 0x04, 0x40, 0x1c, 0x01, 0x00, 0x40, 0x0b, 0x01, 0x04, 0x41, 0x09, 0x05, 0xc0, 0x7d, 0xa6, 0x07, 0x03, 0x40, 0x0d, 0xc0, 0xbd, 0xae, 
+	0x44, 0x08, 0x01, 0x0f, 0x1e, 0x01, 0x01, 0x06, 0x02, 0x05, 0x40, 0x09, 0x01, 0x04, 0x40, 0x1c, 0x01, 0x00, 0x42, 0x0b, 0x04, 0x09, 0x01, 0x05, 
+	0x40, 0x27, 0xc0, 0xda, 0x9d, 0x40, 0x19, 0xc0, 0xbc, 0xc6, 0x40, 0x2a, 0x05, 0x03, 0xc0, 0x7e, 0xdf, 0x43, 0x09, 0x08, 0x06, 0x1f, 0x05, 0x05, 
+	0x42, 0x09, 0x04, 0x0b, 0x01, 0x00, 0xc0, 0x55, 0x5c, 0x41, 0x04, 0x09, 0x02, 0x05, 0x40, 0x15, 0x01, 0x0c, 0xc2, 0x56, 0x54, 0xd7, 0x6c, 0x5b, 
+	0xae, 0x40, 0x20, 0x03, 0x03, 0x40, 0x20, 0xc0, 0xfb, 0x85, 0x40, 0x06, 0x03, 0x05, 0x42, 0x04, 0x06, 0x05, 0x01, 0x04, 0x40, 0x0b, 0x01, 0x00, 
+	0xc0, 0x54, 0x5c, 0x40, 0x09, 0x04, 0x05, 0x40, 0x15, 0xc0, 0x55, 0x54, 0x02, 0x02, 0xc1, 0x75, 0x54, 0x7b, 0xb6, 0x03, 0x03, 0x40, 0x0d, 0xc0, 
+	0x3d, 0x96, 0x49, 0x0f, 0x0a, 0x06, 0x05, 0x04, 0x06, 0x04, 0x06, 0x04, 0x0b, 0x01, 0x00, 0xc0, 0x34, 0x4c, 0x40, 0x04, 0x04, 0x05, 0x40, 0x1f, 
+	0xc0, 0xf9, 0x54, 0x04, 0x02, 0x41, 0x26, 0x2b, 0x02, 0x03, 0x40, 0x20, 0xc0, 0xbb, 0x7d, 0x45, 0x06, 0x01, 0x08, 0x0f, 0x04, 0x05, 0x01, 0x04, 
+	0x40, 0x0b, 0x01, 0x00, 0x42, 0x23, 0x0a, 0x04, 0x01, 0x05, 0xc4, 0x5d, 0x9e, 0x9e, 0xe7, 0x3e, 0xd7, 0x9d, 0xae, 0x7a, 0x75, 0x04, 0x02, 0x41, 
+	0x1d, 0x2a, 0x02, 0x03, 0xc1, 0x5e, 0xe7, 0x7b, 0x75, 0x01, 0x1f, 0x40, 0x04, 0x01, 0x05, 0x41, 0x04, 0x09, 0xc0, 0x55, 0x5c, 0x01, 0x00, 0x44, 
+	0x23, 0x01, 0x0a, 0x05, 0x04, 0xc0, 0x3c, 0x96, 0x03, 0x03, 0x40, 0x29, 0xc0, 0x17, 0x75, 0x03, 0x02, 0x41, 0x1d, 0x2b, 0x02, 0x03, 0xc0, 0x5b, 
+	0xb6, 0x40, 0x15, 0x01, 0x05, 0x40, 0x04, 0x01, 0x05, 0x40, 0x04, 0xc0, 0x34, 0x54, 0x01, 0x00, 0x40, 0x02, 0x01, 0x01, 0x41, 0x0a, 0x04, 0xc0, 
+	0x7d, 0x9e, 0x05, 0x03, 0x40, 0x19, 0x03, 0x02, 0x40, 0x11, 0x02, 0x03, 0x40, 0x0d, 0xc0, 0xf7, 0x74, 0x40, 0x15, 0x01, 0x05, 0x43, 0x04, 0x05, 
+	0x06, 0x23, 0x01, 0x00, 0x40, 0x02, 0x03, 0x01, 0x40, 0x09, 0xc1, 0x3a, 0xa6, 0xdc, 0xc6, 0x40, 0x0d, 0x03, 0x03, 0xc0, 0x9b, 0xbe, 0x02, 0x02, 
+	0x40, 0x0e, 0xc0, 0x9c, 0xbe, 0x02, 0x03, 0xc0, 0x9c, 0xbe, 0x46, 0x0c, 0x15, 0x05, 0x04, 0x06, 0x01, 0x02, 0x01, 0x00, 0x40, 0x02, 0x04, 0x01, 
+	0x44, 0x13, 0x0e, 0x1d, 0x19, 0x0d, 0x02, 0x03, 0x40, 0x19, 0x02, 0x02, 0x40, 0x24, 0xc0, 0xbe, 0xf7, 0x01, 0x03, 0x40, 0x0d, 0xc0, 0xb6, 0x6c, 
+	0x45, 0x0c, 0x15, 0x05, 0x06, 0x01, 0x02, 0x01, 0x00, 0x40, 0x22, 0x05, 0x01, 0xc0, 0x19, 0x65, 0x01, 0x0c, 0x41, 0x26, 0x2b, 0x02, 0x03, 0xc0, 
+	0x17, 0x75, 0x02, 0x02, 0xc0, 0x5b, 0xae, 0x02, 0x03, 0xc0, 0xda, 0x9d, 0x41, 0x0b, 0x0c, 0xc0, 0x39, 0x5d, 0x01, 0x01, 0x40, 0x22, 0x01, 0x00, 
+	0x40, 0x12, 0x05, 0x01, 0x40, 0x06, 0xc0, 0x3a, 0x6d, 0x01, 0x0c, 0x41, 0x26, 0x0d, 0x01, 0x03, 0x40, 0x29, 0x02, 0x02, 0xc0, 0xd7, 0x6c, 0x02, 
+	0x03, 0xc0, 0xdc, 0xce, 0x01, 0x0b, 0xc1, 0x35, 0x44, 0xf8, 0x54, 0x41, 0x01, 0x22, 0x01, 0x00, 0x40, 0x12, 0x04, 0x01, 0xc3, 0xfb, 0x7d, 0xfd, 
+	0xc6, 0xfe, 0xbe, 0x5a, 0x75, 0x01, 0x0c, 0x40, 0x19, 0x02, 0x03, 0x40, 0x25, 0x02, 0x02, 0x40, 0x2a, 0x01, 0x03, 0x41, 0x20, 0x0b, 0xc0, 0x75, 
+	0x54, 0x41, 0x02, 0x0e, 0xc0, 0xf9, 0x54, 0x40, 0x12, 0x01, 0x00, 0x40, 0x12, 0x03, 0x01, 0x40, 0x06, 0xc0, 0xbf, 0xef, 0x01, 0x03, 0xc1, 0xdd, 
+	0xc6, 0x39, 0x6d, 0x42, 0x0c, 0x1d, 0x0d, 0x01, 0x03, 0xc0, 0x1a, 0xa6, 0x02, 0x02, 0xc0, 0x9b, 0xbe, 0x02, 0x03, 0x44, 0x25, 0x0e, 0x02, 0x0e, 
+	0x02, 0xc0, 0x92, 0x3b, 0x01, 0x00, 0x40, 0x12, 0x03, 0x01, 0xc0, 0xdb, 0x7d, 0x02, 0x03, 0x40, 0x29, 0xc1, 0xb7, 0x5c, 0x39, 0x6d, 0x40, 0x0e, 
+	0xc0, 0xdc, 0xc6, 0x01, 0x03, 0xc0, 0xfc, 0xce, 0x02, 0x02, 0xc0, 0x1a, 0xa6, 0x02, 0x03, 0xc0, 0x58, 0x85, 0x03, 0x02, 0xc0, 0x0f, 0x33, 0x01, 
+	0x00, 0xc0, 0xd3, 0x43, 0x03, 0x01, 0x40, 0x08, 0xc0, 0x5e, 0xd7, 0x01, 0x03, 0xc0, 0xb9, 0x95, 0x40, 0x0b, 0xc0, 0x76, 0x54, 0x40, 0x13, 0xc0, 
+	0x3a, 0xa6, 0x01, 0x03, 0xc0, 0x5d, 0xdf, 0x02, 0x02, 0xc0, 0xb9, 0x95, 0x02, 0x03, 0x40, 0x11, 0x03, 0x02, 0xc0, 0x0f, 0x33, 0x01, 0x00, 0xc0, 
+	0x71, 0x3b, 0x04, 0x01, 0x40, 0x08, 0xc0, 0x58, 0x7d, 0x40, 0x25, 0xc0, 0x55, 0x54, 0x42, 0x0e, 0x02, 0x10, 0xc0, 0x7a, 0x6d, 0x01, 0x11, 0xc0, 
+	0x58, 0x85, 0x02, 0x02, 0x40, 0x24, 0x02, 0x11, 0x40, 0x24, 0x03, 0x02, 0xc0, 0xad, 0x2a, 0x01, 0x00, 0xc0, 0x2a, 0x22, 0x40, 0x14, 0x04, 0x01, 
+	0x40, 0x14, 0xc0, 0x76, 0x54, 0x40, 0x0e, 0x02, 0x02, 0x41, 0x10, 0x13, 0x0d, 0x02, 0xc0, 0xa8, 0x19, 0x01, 0x00, 0x40, 0x1a, 0xc0, 0x97, 0x4c, 
+	0x05, 0x01, 0xc1, 0x5a, 0x65, 0x56, 0x4c, 0x03, 0x02, 0x41, 0x10, 0x13, 0x0b, 0x02, 0xc0, 0x92, 0x3b, 0x40, 0x1a, 0x02, 0x00, 0xc1, 0x88, 0x19, 
+	0xd8, 0x54, 0x40, 0x14, 0x03, 0x01, 0x42, 0x0a, 0x14, 0x10, 0x03, 0x02, 0x41, 0x10, 0x13, 0x09, 0x02, 0xc1, 0xd3, 0x3b, 0x46, 0x11, 0x04, 0x00, 
+	0xc2, 0x87, 0x19, 0x56, 0x4c, 0x19, 0x55, 0x40, 0x14, 0x03, 0x01, 0x41, 0x14, 0x10, 0x03, 0x02, 0x41, 0x10, 0x13, 0x06, 0x02, 0x40, 0x12, 0xc1, 
+	0x51, 0x3b, 0x26, 0x11, 0x06, 0x00, 0x40, 0x1a, 0xc1, 0xe9, 0x19, 0xee, 0x2a, 0x04, 0x18, 0xc0, 0x30, 0x33, 0x04, 0x17, 0xc1, 0xce, 0x2a, 0xee, 
+	0x32, 0x04, 0x16, 0xc1, 0x2b, 0x22, 0x67, 0x19, 0x40, 0x1a, 0x23, 0x00
+};
+const PackedIcon transceiver_icon_packed = {32, 32, transceiver_icon_packed_palette, 44, transceiver_icon_packed_data, 1068};
+
+// calibrate_icon565, 32x32px, 63 colors, 922 bytes (raw 2048)
+static const uint16_t calibrate_icon_packed_palette [] PROGMEM = {
+	0x0000, 0x2124, 0x6b4d, 0x528a, 0x7bcf, 0x738e, 0x4208, 0x4a49, 0xfea6, 0x52aa, 0x31a6, 0xbdf7, 0x39e7, 0x632c, 0x2945, 0x2965, 
+	0x630c, 0xbdd7, 0x5aeb, 0x3186, 0xce59, 0x39c7, 0x5acb, 0xc618, 0xb5b6, 0xce79, 0xd69a, 0xe73c, 0xf94c, 0xdedb, 0x8430, 0x9cd3, 
+	0xb596, 0xc638, 0xdefb, 0x1082, 0x8c51, 0xe71c, 0x0e82, 0x18c3, 0x8c71, 0x94b2, 0xd6ba, 0x0841, 0x4228, 0x7bef, 0xa514, 0xa534, 
+	0x0020, 0x2924, 0x4a69, 0x6b6d, 0x9492, 0xad75, 0xf79e, 0x0861, 0x2104, 0x73ae, 0x9cf3, 0xad55, 0xef7d, 0x18e3, 0xef5d
+};
+static const uint8_t calibrate_icon_packed_data [] PROGMEM = {
+	0x01, 0x00, 0x42, 0x37, 0x2c, 0x02, 0x15, 0x04, 0x42, 0x02, 0x2c, 0x37, 0x02, 0x00, 0x41, 0x27, 0x02, 0x0b, 0x05, 0x01, 0x33, 0x0b, 0x05, 0x44, 
+	0x02, 0x27, 0x00, 0x2b, 0x10, 0x08, 0x02, 0x49, 0x28, 0x18, 0x1a, 0x25, 0x3c, 0x3e, 0x22, 0x14, 0x3b, 0x2d, 0x08, 0x02, 0x42, 0x10, 0x2b, 0x15, 
+	0x06, 0x10, 0x46, 0x0d, 0x3a, 0x25, 0x36, 0x3c, 0x22, 0x19, 0x01, 0x14, 0x41, 0x1a, 0x25, 0x01, 0x36, 0x41, 0x19, 0x24, 0x07, 0x10, 0x41, 0x15, 
+	0x32, 0x05, 0x16, 0x47, 0x04, 0x1d, 0x36, 0x1d, 0x20, 0x28, 0x1e, 0x2d, 0x01, 0x04, 0x47, 0x2d, 0x1e, 0x29, 0x0b, 0x1b, 0x36, 0x0b, 0x0d, 0x05, 
+	0x16, 0x40, 0x32, 0x05, 0x03, 0x47, 0x24, 0x3e, 0x1b, 0x35, 0x1e, 0x05, 0x32, 0x0a, 0x02, 0x01, 0x48, 0x0e, 0x0c, 0x09, 0x04, 0x28, 0x17, 0x3c, 
+	0x1d, 0x02, 0x05, 0x03, 0x04, 0x07, 0x46, 0x1e, 0x3c, 0x1d, 0x29, 0x04, 0x2c, 0x01, 0xc6, 0x44, 0x29, 0xa5, 0x62, 0xc5, 0x8b, 0x45, 0xa4, 0x25, 
+	0x9c, 0x85, 0x83, 0x24, 0x4a, 0x42, 0x01, 0x0e, 0x09, 0xc0, 0x10, 0x84, 0x43, 0x2f, 0x1b, 0x22, 0x10, 0x04, 0x07, 0x03, 0x06, 0x46, 0x02, 0x1b, 
+	0x2a, 0x34, 0x05, 0x0f, 0x31, 0xc1, 0x05, 0x73, 0x25, 0xee, 0x05, 0x08, 0xc1, 0xa5, 0xdd, 0x44, 0x4a, 0x46, 0x01, 0x15, 0x2d, 0x2e, 0x1b, 0x1a, 
+	0x07, 0x03, 0x06, 0x02, 0x15, 0x45, 0x06, 0x1a, 0x22, 0x1f, 0x39, 0x0e, 0xc3, 0x25, 0x41, 0x4b, 0xd9, 0x27, 0x9a, 0x86, 0xfe, 0x05, 0x08, 0xc3, 
+	0x05, 0xe6, 0x83, 0x1c, 0xc3, 0x14, 0x64, 0x21, 0x44, 0x0a, 0x1e, 0x35, 0x1b, 0x2f, 0x03, 0x15, 0x02, 0x13, 0x44, 0x24, 0x1b, 0x20, 0x1e, 0x13, 
+	0xc1, 0x25, 0x41, 0x4c, 0xe9, 0x40, 0x1c, 0xc1, 0x4b, 0xe1, 0x45, 0xac, 0x05, 0x08, 0xc0, 0x04, 0x6c, 0x01, 0x26, 0xc1, 0x23, 0x15, 0x44, 0x21, 
+	0x44, 0x2c, 0x34, 0x21, 0x1b, 0x09, 0x02, 0x13, 0x01, 0x0e, 0x45, 0x13, 0x2a, 0x1a, 0x1f, 0x03, 0x31, 0xc0, 0x4b, 0xd1, 0x02, 0x1c, 0xc1, 0xa9, 
+	0xa1, 0x46, 0xee, 0x03, 0x08, 0xc3, 0x66, 0xcd, 0x23, 0x15, 0xa6, 0x2e, 0xeb, 0x4e, 0x40, 0x26, 0xc0, 0x23, 0x14, 0x44, 0x01, 0x05, 0x2e, 0x25, 
+	0x2f, 0x02, 0x0e, 0x01, 0x38, 0x44, 0x0d, 0x25, 0x20, 0x28, 0x01, 0xc0, 0x28, 0x81, 0x03, 0x1c, 0xc9, 0x6b, 0xf1, 0x86, 0x9b, 0xa7, 0xd5, 0x86, 
+	0xac, 0xa6, 0xac, 0x27, 0xe6, 0x25, 0x4c, 0xa3, 0x16, 0x34, 0x9f, 0x83, 0x0e, 0x01, 0x26, 0xc0, 0x04, 0x22, 0x44, 0x15, 0x1f, 0x21, 0x1d, 0x13, 
+	0x01, 0x38, 0x01, 0x27, 0x44, 0x1f, 0x1d, 0x2e, 0x0d, 0x01, 0xc0, 0x4b, 0xd9, 0x02, 0x1c, 0xc2, 0x8b, 0xf9, 0xca, 0xf9, 0x66, 0x61, 0x03, 0x01, 
+	0xc3, 0x05, 0x2c, 0x2e, 0x77, 0x11, 0x8f, 0x83, 0x0e, 0x01, 0x26, 0xc0, 0x43, 0x14, 0x44, 0x01, 0x1e, 0x20, 0x22, 0x12, 0x01, 0x27, 0x01, 0x23, 
+	0x44, 0x17, 0x19, 0x2f, 0x2c, 0x31, 0xc5, 0x28, 0x89, 0x4a, 0xc1, 0x4c, 0xf1, 0x6c, 0xf9, 0xca, 0xf9, 0x87, 0x81, 0x04, 0x01, 0x40, 0x13, 0xc5, 
+	0x3b, 0xdf, 0xe8, 0x46, 0xa3, 0x16, 0x23, 0x0e, 0xc3, 0x14, 0x04, 0x1b, 0x43, 0x01, 0x02, 0x2f, 0x1d, 0xc0, 0x10, 0x84, 0x01, 0x23, 0x45, 0x2b, 
+	0x23, 0x1a, 0x17, 0x3b, 0x0f, 0x02, 0x01, 0x40, 0x31, 0xc1, 0x46, 0x59, 0x87, 0x91, 0x40, 0x31, 0x04, 0x01, 0x40, 0x3a, 0xc2, 0x36, 0xb6, 0xe5, 
+	0x2b, 0x44, 0x22, 0x03, 0x01, 0x43, 0x09, 0x3b, 0x1a, 0x1f, 0x01, 0x2b, 0x44, 0x00, 0x23, 0x1d, 0x0b, 0x35, 0x02, 0x0e, 0x07, 0x01, 0x43, 0x0e, 
+	0x03, 0x3e, 0x12, 0x05, 0x0e, 0x43, 0x32, 0x35, 0x19, 0x2f, 0x02, 0x00, 0x44, 0x37, 0x2a, 0x0b, 0x18, 0x13, 0x09, 0x0f, 0x40, 0x13, 0x01, 0x14, 
+	0x40, 0x13, 0x05, 0x0f, 0x43, 0x09, 0x20, 0x14, 0x2e, 0x02, 0x00, 0x44, 0x30, 0x14, 0x17, 0x11, 0x2c, 0x09, 0x0a, 0x42, 0x1e, 0x1b, 0x2d, 0x06, 
+	0x0a, 0x43, 0x02, 0x18, 0x19, 0x34, 0x03, 0x00, 0x43, 0x35, 0x21, 0x11, 0x0d, 0x08, 0x0c, 0x43, 0x03, 0x22, 0x2a, 0x07, 0x06, 0x0c, 0x43, 0x24, 
+	0x18, 0x1a, 0x33, 0x03, 0x00, 0x43, 0x2d, 0x19, 0x11, 0x34, 0x08, 0x06, 0x42, 0x20, 0x25, 0x1f, 0x07, 0x06, 0x43, 0x18, 0x11, 0x19, 0x0c, 0x03, 
+	0x00, 0x44, 0x0c, 0x19, 0x11, 0x17, 0x03, 0x07, 0x07, 0x42, 0x14, 0x1a, 0x12, 0x06, 0x07, 0x44, 0x33, 0x21, 0x0b, 0x17, 0x2b, 0x03, 0x00, 0x44, 
+	0x30, 0x20, 0x21, 0x17, 0x29, 0x07, 0x03, 0x41, 0x2e, 0x02, 0x07, 0x03, 0x43, 0x18, 0x11, 0x14, 0x04, 0x05, 0x00, 0x44, 0x03, 0x14, 0x11, 0x1a, 
+	0x39, 0x0f, 0x09, 0x44, 0x29, 0x14, 0x0b, 0x17, 0x3d, 0x05, 0x00, 0x45, 0x30, 0x3a, 0x21, 0x0b, 0x19, 0x05, 0x0d, 0x12, 0x44, 0x28, 0x2a, 0x11, 
+	0x21, 0x0d, 0x07, 0x00, 0x45, 0x3d, 0x11, 0x0b, 0x17, 0x2a, 0x1e, 0x0b, 0x0d, 0x45, 0x3a, 0x1d, 0x11, 0x17, 0x29, 0x30, 0x08, 0x00, 0x41, 0x0a, 
+	0x11, 0x01, 0x0b, 0x42, 0x22, 0x18, 0x04, 0x07, 0x02, 0x46, 0x24, 0x14, 0x1d, 0x11, 0x17, 0x2e, 0x23, 0x0a, 0x00, 0x53, 0x13, 0x20, 0x0b, 0x11, 
+	0x19, 0x1b, 0x14, 0x3b, 0x29, 0x24, 0x28, 0x1f, 0x20, 0x2a, 0x25, 0x21, 0x11, 0x0b, 0x29, 0x23, 0x0c, 0x00, 0xc0, 0xa2, 0x10, 0x40, 0x24, 0x01, 
+	0x0b, 0x4d, 0x18, 0x21, 0x1a, 0x22, 0x1b, 0x25, 0x22, 0x19, 0x17, 0x18, 0x0b, 0x11, 0x0d, 0x30, 0x0f, 0x00, 0x41, 0x15, 0x28, 0x02, 0x0b, 0x41, 
+	0x11, 0x18, 0x01, 0x11, 0x01, 0x0b, 0x42, 0x18, 0x39, 0x3d, 0x13, 0x00, 0x43, 0x27, 0x32, 0x39, 0x34, 0x01, 0x1f, 0x43, 0x24, 0x33, 0x06, 0x37, 
+	0x3f, 0x00, 0x0a, 0x00
+};
+const PackedIcon calibrate_icon_packed = {32, 32, calibrate_icon_packed_palette, 63, calibrate_icon_packed_data, 796};
+
+// GForce_icon565, 32x32px, 37 colors, 1106 bytes (raw 2048)
+static const uint16_t GForce_icon_packed_palette [] PROGMEM = {
+	0xbf5f, 0x0000, 0x367f, 0xfd88, 0xfcaa, 0xaa66, 0x0020, 0xaf3f, 0xfb27, 0xfb47, 0x365f, 0x62c8, 0xfc89, 0x29c7, 0x636d, 0xb73f, 
+	0xbdcf, 0xfc8a, 0x10c3, 0x2986, 0x3e5e, 0xa65b, 0xa67b, 0xb266, 0xb6fe, 0x31e8, 0x5ebf, 0x66bf, 0x7473, 0xaefd, 0xbf3e, 0xbf3f, 
+	0x2145, 0x7cb4, 0x9b0a, 0x9e1a, 0xe591
+};
+static const uint8_t GForce_icon_packed_data [] PROGMEM = {
+	0x08, 0x01, 0x40, 0x06, 0xc1, 0x66, 0x21, 0x0c, 0x4b, 0x42, 0x21, 0x23, 0x18, 0x01, 0x00, 0xc1, 0xfd, 0xb6, 0xf9, 0x9d, 0x40, 0x1c, 0xc0, 0xcc, 
+	0x4a, 0x41, 0x20, 0x06, 0x0f, 0x01, 0x41, 0x06, 0x13, 0xc0, 0xf5, 0x7c, 0x41, 0x16, 0x1f, 0x07, 0x00, 0x41, 0x0f, 0x15, 0xc0, 0x93, 0x74, 0x41, 
+	0x13, 0x06, 0x0c, 0x01, 0xc1, 0xa3, 0x10, 0x52, 0x6c, 0x40, 0x1d, 0x0d, 0x00, 0x40, 0x1d, 0xc0, 0x72, 0x74, 0x40, 0x12, 0x0a, 0x01, 0x40, 0x0d, 
+	0xc0, 0x97, 0x8d, 0x11, 0x00, 0xc0, 0xd8, 0x95, 0x40, 0x19, 0x08, 0x01, 0xc0, 0x09, 0x3a, 0x40, 0x16, 0x13, 0x00, 0x41, 0x15, 0x0d, 0x06, 0x01, 
+	0x41, 0x0d, 0x16, 0x15, 0x00, 0xc0, 0x7c, 0xa6, 0x40, 0x19, 0x04, 0x01, 0x40, 0x12, 0xc0, 0x97, 0x8d, 0x09, 0x00, 0x40, 0x1e, 0xc1, 0x17, 0xce, 
+	0xb7, 0xbd, 0x40, 0x1e, 0x09, 0x00, 0xc0, 0xb8, 0x95, 0x40, 0x12, 0x02, 0x01, 0x40, 0x06, 0xc0, 0x52, 0x6c, 0x40, 0x1f, 0x07, 0x00, 0xc7, 0x1d, 
+	0xbf, 0xf7, 0xcd, 0x0c, 0xec, 0x47, 0xf3, 0x86, 0xb2, 0x6b, 0xb3, 0xb6, 0xb5, 0xfd, 0xbe, 0x08, 0x00, 0x41, 0x1c, 0x06, 0x01, 0x01, 0x41, 0x13, 
+	0x1d, 0x01, 0x00, 0x40, 0x0f, 0xc2, 0xfe, 0xae, 0x7c, 0x96, 0x3e, 0xaf, 0x41, 0x00, 0x1e, 0xc2, 0x38, 0xce, 0x6e, 0xe4, 0x68, 0xfb, 0x43, 0x09, 
+	0x08, 0x17, 0x05, 0xc2, 0xa7, 0xaa, 0xcd, 0xb3, 0xf8, 0xb5, 0x41, 0x1e, 0x00, 0xc3, 0x3e, 0xb7, 0x1a, 0x96, 0xdd, 0xae, 0x1f, 0xb7, 0x45, 0x0f, 
+	0x00, 0x18, 0x13, 0x01, 0x06, 0xc0, 0xf4, 0x7c, 0x41, 0x00, 0x0f, 0xc6, 0x99, 0x75, 0x92, 0x23, 0x10, 0x03, 0xd4, 0x13, 0x1c, 0x66, 0xf7, 0xcd, 
+	0x4d, 0xec, 0x40, 0x09, 0xc0, 0x26, 0xfb, 0x02, 0x08, 0x40, 0x17, 0x03, 0x05, 0xc1, 0xac, 0xb3, 0xb6, 0xb5, 0x40, 0x15, 0xc3, 0xce, 0x2a, 0x48, 
+	0x01, 0x2b, 0x22, 0xb5, 0x5c, 0x41, 0x07, 0x00, 0xc0, 0xd4, 0x7c, 0x40, 0x06, 0xc0, 0x66, 0x21, 0x40, 0x16, 0x01, 0x00, 0xc0, 0x58, 0x65, 0x81, 
+	0xf0, 0x02, 0xc2, 0x14, 0x2c, 0x0f, 0xa4, 0x68, 0xf3, 0x04, 0x09, 0x41, 0x08, 0x17, 0x04, 0x05, 0xc2, 0xa7, 0xaa, 0xad, 0x9b, 0x4f, 0x3b, 0x81, 
+	0x28, 0x01, 0xc0, 0xf4, 0x1b, 0x41, 0x1b, 0x07, 0xc0, 0x5b, 0x9e, 0x40, 0x20, 0xc0, 0x0c, 0x4b, 0x40, 0x1f, 0x01, 0x00, 0xc6, 0x1b, 0x86, 0x52, 
+	0x0b, 0x36, 0x14, 0x51, 0x13, 0xee, 0x32, 0x0a, 0x93, 0x27, 0xe3, 0x40, 0x08, 0x02, 0x09, 0x41, 0x08, 0x17, 0x03, 0x05, 0xc6, 0x46, 0x9a, 0xe7, 
+	0x61, 0x47, 0x21, 0xca, 0x11, 0x10, 0x13, 0xca, 0x09, 0xf8, 0x24, 0x41, 0x02, 0x1a, 0xc1, 0x1f, 0xaf, 0xec, 0x4a, 0x40, 0x21, 0x02, 0x00, 0xc6, 
+	0xde, 0xa6, 0x35, 0x24, 0x9c, 0x2d, 0xf1, 0x94, 0xcc, 0x83, 0x0e, 0x33, 0xee, 0x3a, 0x40, 0x22, 0xc0, 0x28, 0xe3, 0x02, 0x08, 0x40, 0x17, 0x01, 
+	0x05, 0xc2, 0x46, 0x9a, 0xe7, 0x69, 0x67, 0x21, 0x40, 0x0d, 0xc4, 0x68, 0x83, 0x2f, 0x9d, 0x3a, 0x2d, 0xef, 0x12, 0xdd, 0x2d, 0x01, 0x02, 0x40, 
+	0x1a, 0xc0, 0x93, 0x64, 0x40, 0x23, 0x03, 0x00, 0xc2, 0xdf, 0x86, 0x7f, 0x3e, 0x31, 0xb5, 0x40, 0x0c, 0xc3, 0x4a, 0xd4, 0xad, 0x7b, 0x0f, 0x23, 
+	0xed, 0x42, 0x40, 0x22, 0xc0, 0x27, 0xf3, 0x41, 0x08, 0x05, 0xc5, 0x66, 0xa2, 0xe6, 0x69, 0x67, 0x29, 0x87, 0x19, 0x48, 0x7b, 0xc8, 0xd4, 0x40, 
+	0x03, 0xc0, 0xd0, 0xbd, 0x01, 0x0a, 0x03, 0x02, 0xc1, 0x59, 0x45, 0x1e, 0xb7, 0x03, 0x00, 0xc2, 0x5f, 0xb7, 0xff, 0x8e, 0x31, 0xc5, 0x01, 0x0c, 
+	0xc4, 0x8a, 0xf4, 0x6a, 0xdc, 0xad, 0x7b, 0x0f, 0x2b, 0xee, 0x3a, 0x40, 0x22, 0xc1, 0xe6, 0x69, 0x67, 0x29, 0x40, 0x0d, 0xc2, 0x48, 0x7b, 0x08, 
+	0xdd, 0x68, 0xfd, 0x01, 0x03, 0x40, 0x10, 0x05, 0x02, 0xc0, 0x7f, 0x46, 0x06, 0x00, 0xc0, 0x71, 0xdd, 0x41, 0x0c, 0x04, 0x01, 0x0c, 0x40, 0x11, 
+	0xc6, 0x4a, 0xcc, 0x8d, 0x6b, 0xef, 0x1a, 0x88, 0x19, 0x08, 0x6b, 0xa8, 0xcc, 0x68, 0xfd, 0x03, 0x03, 0x40, 0x10, 0x05, 0x02, 0xc0, 0x7f, 0x3e, 
+	0x06, 0x00, 0x41, 0x24, 0x11, 0x04, 0x04, 0x40, 0x11, 0xc0, 0x6d, 0x5b, 0x40, 0x0b, 0x06, 0x03, 0x40, 0x10, 0x06, 0x02, 0xc0, 0xfd, 0xb6, 0x05, 
+	0x00, 0x41, 0x24, 0x11, 0x05, 0x04, 0x41, 0x0e, 0x0b, 0x06, 0x03, 0x40, 0x10, 0x05, 0x02, 0x40, 0x14, 0xc0, 0xf9, 0x9d, 0x05, 0x00, 0x41, 0x24, 
+	0x11, 0x05, 0x04, 0x41, 0x0e, 0x0b, 0x06, 0x03, 0x40, 0x10, 0x05, 0x02, 0xc0, 0x59, 0x35, 0x40, 0x1c, 0x05, 0x00, 0xc1, 0xf4, 0xd5, 0xcb, 0xec, 
+	0x05, 0x04, 0x41, 0x0e, 0x0b, 0x05, 0x03, 0xc1, 0x8a, 0xed, 0xf3, 0x9d, 0x05, 0x02, 0xc1, 0x54, 0x2c, 0xcc, 0x4a, 0x40, 0x0f, 0x04, 0x00, 0xc4, 
+	0x3e, 0xb7, 0x5a, 0x96, 0x31, 0xb5, 0xaa, 0xf4, 0xa9, 0xfc, 0x02, 0x04, 0x41, 0x0e, 0x0b, 0x03, 0x03, 0xc2, 0x89, 0xf5, 0xd0, 0xbd, 0x39, 0x66, 
+	0x40, 0x14, 0x04, 0x02, 0x40, 0x0a, 0xc0, 0xcd, 0x22, 0x41, 0x20, 0x15, 0x05, 0x00, 0x40, 0x07, 0xc3, 0x9e, 0x6e, 0xfa, 0x65, 0x30, 0xbd, 0xab, 
+	0xec, 0x43, 0x0c, 0x11, 0x0e, 0x0b, 0x01, 0x03, 0xc0, 0x8a, 0xed, 0x40, 0x10, 0xc0, 0x39, 0x66, 0x40, 0x14, 0x06, 0x02, 0xc1, 0x9b, 0x35, 0x46, 
+	0x09, 0x40, 0x06, 0xc0, 0x93, 0x74, 0x06, 0x00, 0x42, 0x07, 0x1a, 0x14, 0xc1, 0xd8, 0x6d, 0x30, 0xc5, 0x43, 0x04, 0x0e, 0x0b, 0x03, 0xc1, 0xce, 
+	0xc5, 0x18, 0x6e, 0x41, 0x14, 0x0a, 0x07, 0x02, 0xc1, 0x95, 0x34, 0x41, 0x00, 0x40, 0x01, 0xc0, 0x65, 0x21, 0x40, 0x1d, 0x06, 0x00, 0x43, 0x07, 
+	0x1b, 0x02, 0x0a, 0xc3, 0xf9, 0x6d, 0xd1, 0x3b, 0xec, 0x3a, 0x38, 0x6e, 0x40, 0x0a, 0x09, 0x02, 0xc1, 0x3e, 0x3e, 0x66, 0x11, 0x01, 0x01, 0x40, 
+	0x06, 0xc0, 0x72, 0x74, 0x07, 0x00, 0x41, 0x07, 0x1a, 0xc5, 0x5e, 0x36, 0x9b, 0x2d, 0x15, 0x14, 0x10, 0x13, 0x39, 0x2d, 0x3e, 0x36, 0x08, 0x02, 
+	0x40, 0x0a, 0xc1, 0x33, 0x34, 0x21, 0x00, 0x02, 0x01, 0x40, 0x12, 0xc0, 0xd8, 0x95, 0x07, 0x00, 0x40, 0x07, 0xc5, 0xdb, 0x55, 0x52, 0x0b, 0x11, 
+	0x03, 0xaa, 0x01, 0xaa, 0x09, 0xf8, 0x2c, 0x08, 0x02, 0xc1, 0x39, 0x35, 0xe4, 0x08, 0x04, 0x01, 0x41, 0x19, 0x16, 0x07, 0x00, 0x40, 0x07, 0xc4, 
+	0x18, 0x4d, 0x10, 0x0b, 0x69, 0x01, 0xf4, 0x1b, 0x3e, 0x36, 0x07, 0x02, 0xc1, 0xdc, 0x35, 0xe9, 0x19, 0x06, 0x01, 0x40, 0x0d, 0xc0, 0x7c, 0xa6, 
+	0x07, 0x00, 0x40, 0x07, 0xc2, 0x39, 0x55, 0x55, 0x24, 0x3f, 0x36, 0x07, 0x02, 0xc1, 0xdc, 0x35, 0x09, 0x1a, 0x08, 0x01, 0x40, 0x19, 0xc0, 0xb8, 
+	0x95, 0x40, 0x1f, 0x06, 0x00, 0x40, 0x07, 0xc0, 0x9e, 0x5e, 0x06, 0x02, 0x40, 0x0a, 0xc1, 0x39, 0x35, 0x09, 0x1a, 0x0a, 0x01, 0x42, 0x12, 0x1c, 
+	0x18, 0x06, 0x00, 0x41, 0x07, 0x1b, 0x04, 0x02, 0xc2, 0x3e, 0x3e, 0x33, 0x34, 0xe4, 0x10, 0x0c, 0x01, 0x41, 0x06, 0x13, 0xc0, 0xf5, 0x7c, 0x41, 
+	0x15, 0x0f, 0x04, 0x00, 0x43, 0x07, 0x1b, 0x02, 0x0a, 0xc3, 0x9b, 0x35, 0xb6, 0x34, 0x86, 0x11, 0x21, 0x00, 0x0f, 0x01, 0x40, 0x06, 0xc1, 0x65, 
+	0x21, 0xec, 0x4a, 0x42, 0x21, 0x23, 0x18, 0x01, 0x00, 0x40, 0x18, 0xc4, 0x1a, 0x96, 0x74, 0x3c, 0xac, 0x1a, 0x46, 0x11, 0x41, 0x00, 0x08, 0x01
+};
+const PackedIcon GForce_icon_packed = {32, 32, GForce_icon_packed_palette, 37, GForce_icon_packed_data, 1032};
+
+// SSD_icon565, 32x33px, 56 colors, 1180 bytes (raw 2112)
+static const uint16_t SSD_icon_packed_palette [] PROGMEM = {
+	0x0000, 0xffff, 0x4809, 0x500a, 0x580b, 0x600c, 0x680d, 0x4008, 0x700e, 0x780f, 0xcd99, 0xcd19, 0x3827, 0xe69c, 0x8010, 0xc498, 
+	0xeedd, 0xffbf, 0x1042, 0x2044, 0xffdf, 0xc518, 0xd61a, 0xde1a, 0x0821, 0x2024, 0xaa95, 0x1843, 0x4028, 0x600d, 0xac15, 0xb416, 
+	0xbc97, 0xf75e, 0x3807, 0x4808, 0x5009, 0x604c, 0xa294, 0xa2b4, 0xb496, 0xef3d, 0x1022, 0x3046, 0x3808, 0x4009, 0x4849, 0x586b, 
+	0x680e, 0x702e, 0x800f, 0x8011, 0x8811, 0xab95, 0xcd39, 0xef1d
+};
+static const uint8_t SSD_icon_packed_data [] PROGMEM = {
+	0x2a, 0x00, 0x41, 0x12, 0x19, 0xc7, 0x45, 0x30, 0x0a, 0x51, 0x8c, 0x59, 0x8c, 0x61, 0x6b, 0x59, 0xc8, 0x40, 0x26, 0x28, 0x23, 0x18, 0x40, 0x18, 
+	0x12, 0x00, 0x40, 0x1b, 0xc3, 0x4a, 0x51, 0x51, 0x8b, 0x57, 0xc5, 0xdc, 0xe6, 0x41, 0x29, 0x37, 0x01, 0x29, 0x40, 0x37, 0xc3, 0x5b, 0xde, 0xb6, 
+	0xac, 0x6e, 0x72, 0x66, 0x30, 0x40, 0x12, 0x0e, 0x00, 0x40, 0x12, 0xc2, 0xe8, 0x40, 0x33, 0xa4, 0x7b, 0xde, 0x0a, 0x0d, 0xc3, 0xd9, 0xcd, 0xaf, 
+	0x7a, 0x65, 0x28, 0x20, 0x00, 0x0b, 0x00, 0x40, 0x13, 0xc0, 0x8c, 0x61, 0x40, 0x0a, 0x03, 0x16, 0x06, 0x17, 0x02, 0x16, 0xc3, 0x3a, 0xd6, 0x95, 
+	0xac, 0x29, 0x51, 0x22, 0x08, 0x09, 0x00, 0x40, 0x19, 0xc1, 0x2b, 0x59, 0x78, 0xc5, 0x0e, 0x0a, 0xc1, 0xb9, 0xcd, 0xd9, 0xcd, 0x40, 0x28, 0xc0, 
+	0x47, 0x40, 0x40, 0x2a, 0x07, 0x00, 0x41, 0x13, 0x1c, 0xc1, 0x75, 0xac, 0x17, 0xbd, 0x03, 0x15, 0x81, 0x19, 0xc5, 0x05, 0x0b, 0x40, 0x36, 0x01, 
+	0x15, 0xc3, 0x58, 0xc5, 0x79, 0xcd, 0x17, 0xbd, 0x6f, 0x7a, 0x40, 0x0c, 0xc0, 0x01, 0x08, 0x05, 0x00, 0x40, 0x12, 0xc1, 0x48, 0x40, 0xad, 0x69, 
+	0x01, 0x28, 0x03, 0x20, 0x08, 0x0f, 0xc1, 0xb8, 0xc4, 0xb7, 0xbc, 0x40, 0x20, 0xc0, 0x96, 0xbc, 0x42, 0x28, 0x1e, 0x1c, 0xc0, 0x47, 0x30, 0x05, 
+	0x00, 0x40, 0x2b, 0xc1, 0xaa, 0x50, 0x4f, 0x7a, 0x01, 0x1e, 0x02, 0x1f, 0xc1, 0x16, 0xbc, 0xf8, 0xcc, 0x04, 0x0b, 0x01, 0x36, 0x40, 0x0b, 0xc0, 
+	0x59, 0xcd, 0x40, 0x15, 0x01, 0x1f, 0x01, 0x1e, 0xc0, 0x8a, 0x50, 0x41, 0x07, 0x13, 0x03, 0x00, 0x40, 0x13, 0xc0, 0x69, 0x48, 0x40, 0x02, 0xc2, 
+	0x0f, 0x7a, 0xb4, 0xa3, 0x95, 0xa3, 0x01, 0x35, 0x81, 0x96, 0xb3, 0xc0, 0x7e, 0xf7, 0x49, 0x14, 0x11, 0x14, 0x11, 0x01, 0x11, 0x01, 0x11, 0x14, 
+	0x21, 0xc0, 0xd6, 0xab, 0x40, 0x35, 0x81, 0x94, 0xa3, 0x41, 0x2f, 0x02, 0xc0, 0x28, 0x38, 0x03, 0x00, 0xc1, 0x88, 0x40, 0x29, 0x40, 0x40, 0x03, 
+	0xc1, 0x0d, 0x69, 0x54, 0xa3, 0x81, 0x14, 0xa3, 0xcb, 0x15, 0xab, 0x36, 0xab, 0x16, 0xb3, 0x7e, 0xf7, 0xd9, 0xcc, 0x38, 0xc4, 0xfc, 0xdd, 0x56, 
+	0xbb, 0xfe, 0xf6, 0x36, 0xb3, 0x5c, 0xe6, 0x17, 0xbc, 0x41, 0x0b, 0x29, 0xc3, 0x35, 0xa3, 0x55, 0xa3, 0x14, 0x9b, 0xd2, 0x92, 0x43, 0x03, 0x02, 
+	0x07, 0x19, 0x01, 0x00, 0x44, 0x12, 0x1c, 0x02, 0x03, 0x04, 0xc1, 0x51, 0x92, 0xd4, 0xa2, 0x01, 0x27, 0xc1, 0xb5, 0xaa, 0xb6, 0xaa, 0x40, 0x21, 
+	0xc3, 0x59, 0xcc, 0xb8, 0xc3, 0xdb, 0xdd, 0xb7, 0xb2, 0x40, 0x10, 0xc4, 0xd6, 0xba, 0x3c, 0xe6, 0x77, 0xbb, 0xb9, 0xcc, 0x3e, 0xef, 0x01, 0x27, 
+	0xc2, 0xd3, 0x9a, 0x4f, 0x79, 0x0a, 0x58, 0x42, 0x24, 0x07, 0x0c, 0x01, 0x00, 0x44, 0x19, 0x07, 0x02, 0x03, 0x05, 0xc5, 0x8e, 0x70, 0x12, 0x9a, 
+	0x74, 0xa2, 0x34, 0xa2, 0x35, 0xa2, 0x35, 0xaa, 0x40, 0x21, 0xc7, 0x39, 0xcc, 0x98, 0xc3, 0xbb, 0xdd, 0x76, 0xb2, 0xfe, 0xf6, 0x76, 0xb2, 0x1b, 
+	0xe6, 0x36, 0xb3, 0x41, 0x0f, 0x37, 0x81, 0x33, 0x9a, 0xc1, 0xd1, 0x89, 0x6d, 0x68, 0x45, 0x04, 0x03, 0x02, 0x07, 0x18, 0x00, 0xc0, 0x26, 0x30, 
+	0x44, 0x23, 0x03, 0x04, 0x05, 0x06, 0xc4, 0x8f, 0x78, 0xb2, 0x91, 0xb3, 0x99, 0xd4, 0xa1, 0xd5, 0xa9, 0x40, 0x21, 0x01, 0x11, 0x46, 0x14, 0x11, 
+	0x14, 0x11, 0x14, 0x11, 0x14, 0xc2, 0xfd, 0xee, 0xd3, 0x99, 0x52, 0x91, 0x4e, 0x31, 0x06, 0x25, 0x03, 0x02, 0x07, 0x1b, 0x00, 0x22, 0x02, 0x03, 
+	0x04, 0x05, 0x06, 0x09, 0xc3, 0x30, 0x80, 0xd2, 0x90, 0x54, 0xa1, 0xb8, 0xc3, 0x09, 0x01, 0x40, 0x10, 0xc0, 0xb1, 0x88, 0x51, 0x09, 0x08, 0x06, 
+	0x05, 0x25, 0x02, 0x07, 0x19, 0x00, 0x22, 0x02, 0x03, 0x04, 0x1d, 0x30, 0x09, 0x0e, 0x34, 0xc0, 0x13, 0x99, 0x40, 0x21, 0x09, 0x01, 0x52, 0x10, 
+	0x33, 0x32, 0x08, 0x06, 0x05, 0x04, 0x02, 0x07, 0x2b, 0x12, 0x2c, 0x02, 0x03, 0x04, 0x1d, 0x08, 0x09, 0x0e, 0xc1, 0x31, 0x88, 0x5a, 0xd5, 0x0a, 
+	0x01, 0x48, 0x10, 0x33, 0x0e, 0x08, 0x06, 0x05, 0x04, 0x24, 0x2e, 0xc0, 0x66, 0x30, 0x48, 0x18, 0x22, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0e, 
+	0xc0, 0x93, 0x99, 0x40, 0x14, 0x0a, 0x01, 0x46, 0x10, 0x34, 0x0e, 0x08, 0x06, 0x05, 0x04, 0xc2, 0x2a, 0x50, 0x6a, 0x50, 0x86, 0x30, 0x45, 0x00, 
+	0x22, 0x02, 0x03, 0x04, 0x05, 0xc0, 0x0d, 0x70, 0x41, 0x09, 0x0e, 0xc1, 0x53, 0x99, 0x7c, 0xe6, 0x0a, 0x01, 0x46, 0x10, 0x33, 0x0e, 0x08, 0x06, 
+	0x05, 0x04, 0xc0, 0x4a, 0x50, 0x40, 0x07, 0xc0, 0x25, 0x28, 0x46, 0x00, 0x0c, 0x02, 0x03, 0x04, 0x05, 0x06, 0xc0, 0x0e, 0x78, 0x41, 0x32, 0x34, 
+	0xc0, 0x33, 0x99, 0x0a, 0x01, 0x45, 0x10, 0x0e, 0x09, 0x08, 0x06, 0x05, 0xc1, 0x4b, 0x58, 0x0a, 0x48, 0x40, 0x07, 0xc0, 0x23, 0x18, 0x48, 0x00, 
+	0x19, 0x23, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0xc0, 0x91, 0x88, 0x40, 0x1a, 0x0a, 0x01, 0x4f, 0x10, 0x0e, 0x09, 0x08, 0x06, 0x25, 0x03, 0x02, 
+	0x07, 0x2a, 0x00, 0x1b, 0x07, 0x02, 0x03, 0x04, 0xc0, 0x0c, 0x68, 0x40, 0x30, 0xc1, 0x4f, 0x78, 0xf3, 0x99, 0x0b, 0x01, 0x43, 0x10, 0x09, 0x08, 
+	0x06, 0xc0, 0x4d, 0x68, 0x43, 0x04, 0x03, 0x23, 0x0c, 0x02, 0x00, 0x44, 0x0c, 0x02, 0x03, 0x04, 0x05, 0xc0, 0x4d, 0x70, 0x40, 0x31, 0xc0, 0xd2, 
+	0x91, 0x0b, 0x01, 0x42, 0x10, 0x09, 0x08, 0xc1, 0x4e, 0x68, 0x0c, 0x58, 0x42, 0x03, 0x02, 0x07, 0xc0, 0x45, 0x28, 0x02, 0x00, 0xc0, 0x24, 0x18, 
+	0x43, 0x07, 0x02, 0x03, 0x25, 0xc0, 0x2d, 0x68, 0x40, 0x06, 0xc0, 0xb2, 0x91, 0x0b, 0x01, 0xc0, 0xdc, 0xe6, 0x40, 0x31, 0xc0, 0x4e, 0x70, 0x45, 
+	0x05, 0x04, 0x03, 0x02, 0x2c, 0x18, 0x03, 0x00, 0xc0, 0x68, 0x40, 0x40, 0x02, 0xc1, 0x4a, 0x50, 0x2b, 0x58, 0x41, 0x04, 0x06, 0xc1, 0x8e, 0x70, 
+	0xb3, 0x9a, 0x01, 0x26, 0xc0, 0x94, 0xaa, 0x04, 0x1a, 0xc0, 0x94, 0xaa, 0x01, 0x26, 0xc1, 0x32, 0x92, 0x6e, 0x70, 0x45, 0x05, 0x04, 0x03, 0x02, 
+	0x07, 0x13, 0x04, 0x00, 0x40, 0x1b, 0xc1, 0x89, 0x48, 0x29, 0x48, 0x45, 0x03, 0x04, 0x05, 0x1d, 0x06, 0x08, 0x02, 0x09, 0x41, 0x0e, 0x32, 0x02, 
+	0x09, 0xc0, 0x0f, 0x70, 0x40, 0x08, 0xc0, 0x6e, 0x70, 0x42, 0x05, 0x04, 0x03, 0x01, 0x02, 0xc0, 0x47, 0x30, 0x06, 0x00, 0xc0, 0x64, 0x28, 0x42, 
+	0x2e, 0x02, 0x03, 0x01, 0x04, 0x40, 0x05, 0x01, 0x06, 0x05, 0x08, 0x41, 0x30, 0x06, 0xc1, 0x4d, 0x70, 0x6d, 0x68, 0x45, 0x04, 0x03, 0x02, 0x07, 
+	0x0c, 0x12, 0x07, 0x00, 0xc0, 0x86, 0x30, 0x44, 0x2e, 0x02, 0x24, 0x03, 0x04, 0x01, 0x05, 0x40, 0x1d, 0x04, 0x06, 0x40, 0x1d, 0xc0, 0x4d, 0x68, 
+	0x01, 0x04, 0x40, 0x2f, 0xc0, 0x0a, 0x48, 0x42, 0x2d, 0x0c, 0x2a, 0x09, 0x00, 0x44, 0x13, 0x07, 0x23, 0x02, 0x03, 0x03, 0x04, 0x02, 0x05, 0x40, 
+	0x04, 0xc0, 0x6c, 0x60, 0x46, 0x04, 0x03, 0x24, 0x02, 0x2d, 0x0c, 0x12, 0x0b, 0x00, 0x42, 0x1b, 0x0c, 0x07, 0x01, 0x02, 0x05, 0x03, 0x41, 0x2f, 
+	0x03, 0x01, 0x02, 0x01, 0x07, 0xc0, 0x46, 0x28, 0x40, 0x18, 0x0e, 0x00, 0x43, 0x13, 0x0c, 0x07, 0x2d, 0x03, 0x02, 0xc0, 0x6a, 0x50, 0x01, 0x02, 
+	0x01, 0x07, 0x40, 0x2b, 0xc0, 0x23, 0x10, 0x12, 0x00, 0xc2, 0x23, 0x10, 0x04, 0x20, 0x26, 0x38, 0x41, 0x0c, 0x2c, 0x01, 0x1c, 0x40, 0x0c, 0xc0, 
+	0x26, 0x30, 0x41, 0x13, 0x18, 0x18, 0x00, 0x81, 0x41, 0x08, 0x0e, 0x00
+};
+const PackedIcon SSD_icon_packed = {32, 33, SSD_icon_packed_palette, 56, SSD_icon_packed_data, 1068};
+
+// clock_icon565, 32x32px, 47 colors, 867 bytes (raw 2048)
+static const uint16_t clock_icon_packed_palette [] PROGMEM = {
+	0x0000, 0x25b6, 0x1cb2, 0x2575, 0x13ef, 0x1d34, 0x1c71, 0x1c30, 0x1c50, 0x140f, 0x1410, 0x1cf3, 0x1d13, 0x1c51, 0x13ae, 0x13cf, 
+	0x2554, 0x1cd3, 0x1c92, 0x2595, 0x2596, 0x138e, 0x13ce, 0xf7df, 0xe79e, 0x1d14, 0xffff, 0x0a08, 0x12eb, 0x132c, 0x1c91, 0x1cd2, 
+	0x6534, 0xe77d, 0xe7be, 0xefdf, 0x0082, 0x00c3, 0x2d95, 0x2d96, 0x2db6, 0x6e38, 0x6e79, 0x7638, 0x8659, 0xaf1c, 0xc6fb
+};
+static const uint8_t clock_icon_packed_data [] PROGMEM = {
+	0x3f, 0x00, 0x04, 0x00, 0x43, 0x25, 0x1c, 0x02, 0x03, 0x0d, 0x01, 0x43, 0x03, 0x02, 0x1c, 0x25, 0x08, 0x00, 0x40, 0x1d, 0x07, 0x01, 0xc1, 0xd6, 
+	0x25, 0xf7, 0x3d, 0x81, 0x38, 0x4e, 0xc1, 0x17, 0x3e, 0xd6, 0x25, 0x07, 0x01, 0x40, 0x1d, 0x06, 0x00, 0x40, 0x1d, 0x06, 0x01, 0x40, 0x2a, 0xc0, 
+	0x5c, 0xbf, 0x41, 0x17, 0x1a, 0x01, 0x17, 0x41, 0x1a, 0x17, 0xc1, 0x5d, 0xbf, 0x99, 0x76, 0x40, 0x28, 0x05, 0x01, 0x40, 0x1d, 0x04, 0x00, 0xc0, 
+	0xc2, 0x00, 0x41, 0x14, 0x01, 0x03, 0x14, 0x40, 0x2a, 0x01, 0x22, 0xc1, 0xda, 0x8e, 0x18, 0x56, 0x40, 0x28, 0x01, 0x14, 0x40, 0x28, 0xc2, 0x18, 
+	0x4e, 0xda, 0x8e, 0xbe, 0xdf, 0x41, 0x22, 0x2a, 0x05, 0x14, 0x40, 0x25, 0x03, 0x00, 0xc0, 0xcb, 0x12, 0x03, 0x13, 0x42, 0x14, 0x2d, 0x23, 0xc0, 
+	0x79, 0x7e, 0x40, 0x14, 0x08, 0x13, 0xc0, 0x79, 0x76, 0x42, 0x23, 0x2d, 0x27, 0x03, 0x13, 0xc0, 0xcb, 0x12, 0x03, 0x00, 0x40, 0x06, 0x02, 0x03, 
+	0x40, 0x13, 0xc2, 0x5d, 0xbf, 0x7d, 0xd7, 0xb6, 0x3d, 0x0b, 0x03, 0xc2, 0xb6, 0x35, 0x7d, 0xcf, 0x5d, 0xc7, 0x40, 0x27, 0x02, 0x03, 0x40, 0x06, 
+	0x03, 0x00, 0x40, 0x19, 0x02, 0x03, 0xc1, 0xfb, 0xae, 0x7d, 0xd7, 0x40, 0x26, 0x05, 0x03, 0x41, 0x26, 0x27, 0x05, 0x03, 0x40, 0x26, 0xc0, 0x7d, 
+	0xcf, 0x40, 0x2d, 0x02, 0x03, 0x40, 0x19, 0x03, 0x00, 0x40, 0x05, 0x01, 0x10, 0xc0, 0x38, 0x66, 0x40, 0x23, 0xc0, 0x96, 0x3d, 0x06, 0x10, 0xc1, 
+	0xf7, 0x5d, 0x18, 0x66, 0x06, 0x10, 0xc1, 0x95, 0x35, 0xbe, 0xef, 0x40, 0x29, 0x01, 0x10, 0x40, 0x05, 0x03, 0x00, 0x01, 0x05, 0x41, 0x10, 0x18, 
+	0xc0, 0x58, 0x76, 0x07, 0x05, 0xc0, 0x17, 0x66, 0x40, 0x29, 0x07, 0x05, 0x42, 0x29, 0x22, 0x10, 0x01, 0x05, 0x03, 0x00, 0x41, 0x0c, 0x05, 0xc0, 
+	0x18, 0x6e, 0x40, 0x18, 0xc0, 0x34, 0x25, 0x01, 0x05, 0x01, 0x19, 0x01, 0x05, 0x41, 0x19, 0x05, 0xc0, 0x18, 0x6e, 0x40, 0x2b, 0x01, 0x19, 0x05, 
+	0x05, 0xc1, 0x34, 0x25, 0x9d, 0xdf, 0x42, 0x2b, 0x05, 0x0c, 0x03, 0x00, 0x41, 0x0b, 0x0c, 0xc1, 0x1c, 0xb7, 0x79, 0x8e, 0x08, 0x0c, 0x40, 0x2b, 
+	0xc0, 0x58, 0x7e, 0x08, 0x0c, 0x40, 0x2c, 0xc0, 0x3c, 0xbf, 0x41, 0x0c, 0x0b, 0x03, 0x00, 0x01, 0x0b, 0x40, 0x23, 0xc0, 0x95, 0x4d, 0x08, 0x0b, 
+	0xc0, 0x38, 0x7e, 0x40, 0x2c, 0x08, 0x0b, 0xc0, 0x75, 0x45, 0x40, 0x17, 0xc0, 0xf3, 0x24, 0x40, 0x11, 0x03, 0x00, 0x40, 0x1f, 0xc0, 0x34, 0x35, 
+	0x40, 0x1a, 0xc0, 0xf3, 0x24, 0x08, 0x11, 0x40, 0x2c, 0xc0, 0x79, 0x8e, 0x08, 0x11, 0x41, 0x0b, 0x1a, 0xc0, 0x54, 0x3d, 0x40, 0x1f, 0x03, 0x00, 
+	0x40, 0x02, 0xc0, 0xda, 0xae, 0x40, 0x1a, 0xc0, 0x38, 0x86, 0x02, 0x02, 0x40, 0x1f, 0x04, 0x02, 0xc1, 0x59, 0x8e, 0xba, 0xa6, 0x07, 0x02, 0x42, 
+	0x1f, 0x02, 0x18, 0xc0, 0x75, 0x4d, 0x40, 0x02, 0x03, 0x00, 0x40, 0x12, 0xc0, 0xb6, 0x65, 0x40, 0x1a, 0xc0, 0x34, 0x45, 0x08, 0x02, 0xc2, 0x55, 
+	0x4d, 0xbe, 0xef, 0x75, 0x4d, 0x08, 0x02, 0x40, 0x18, 0xc0, 0x55, 0x4d, 0x40, 0x12, 0x03, 0x00, 0x41, 0x06, 0x1e, 0xc0, 0x96, 0x5d, 0x06, 0x12, 
+	0x40, 0x1e, 0x02, 0x12, 0xc2, 0x34, 0x45, 0x5d, 0xd7, 0x13, 0x3d, 0x01, 0x1e, 0x05, 0x12, 0x40, 0x17, 0xc0, 0x13, 0x3d, 0x40, 0x06, 0x03, 0x00, 
+	0x0e, 0x06, 0xc2, 0xd3, 0x34, 0xdb, 0xb6, 0xb2, 0x2c, 0x05, 0x06, 0xc0, 0xf3, 0x3c, 0x40, 0x17, 0x01, 0x06, 0x03, 0x00, 0x0a, 0x0d, 0x40, 0x06, 
+	0x02, 0x0d, 0x40, 0x06, 0xc1, 0x92, 0x24, 0x96, 0x65, 0x05, 0x0d, 0xc1, 0xf7, 0x7d, 0xfb, 0xbe, 0x41, 0x06, 0x0d, 0x03, 0x00, 0x40, 0x07, 0x16, 
+	0x08, 0xc1, 0x5d, 0xd7, 0xb6, 0x6d, 0x41, 0x08, 0x07, 0x03, 0x00, 0x16, 0x07, 0xc0, 0x75, 0x65, 0x41, 0x18, 0x08, 0x01, 0x07, 0x03, 0x00, 0x40, 
+	0x09, 0x14, 0x0a, 0xc0, 0x71, 0x24, 0x40, 0x18, 0xc0, 0x75, 0x6d, 0x01, 0x0a, 0x40, 0x09, 0x03, 0x00, 0x40, 0x0f, 0x04, 0x09, 0xc0, 0x10, 0x1c, 
+	0x0d, 0x09, 0x41, 0x07, 0x2e, 0xc0, 0x9a, 0xae, 0x02, 0x09, 0x40, 0x0f, 0x03, 0x00, 0xc0, 0x4c, 0x13, 0x03, 0x04, 0xc2, 0x55, 0x65, 0x1c, 0xc7, 
+	0x50, 0x2c, 0x0b, 0x04, 0xc0, 0x30, 0x24, 0x01, 0x2e, 0xc0, 0x10, 0x1c, 0x02, 0x04, 0xc0, 0x4c, 0x13, 0x03, 0x00, 0xc0, 0xe7, 0x09, 0x03, 0x04, 
+	0xc1, 0xef, 0x1b, 0x79, 0xa6, 0x41, 0x18, 0x20, 0x01, 0x04, 0x01, 0x0f, 0x05, 0x04, 0xc0, 0x34, 0x5d, 0x40, 0x18, 0xc1, 0x79, 0xae, 0x0f, 0x1c, 
+	0x03, 0x04, 0xc0, 0xe7, 0x09, 0x03, 0x00, 0x40, 0x24, 0x05, 0x0f, 0x41, 0x20, 0x21, 0xc2, 0x3c, 0xd7, 0xb6, 0x7d, 0x71, 0x3c, 0x03, 0x0f, 0xc2, 
+	0x71, 0x34, 0x96, 0x75, 0x3c, 0xd7, 0x41, 0x21, 0x20, 0x05, 0x0f, 0x40, 0x24, 0x04, 0x00, 0x40, 0x1b, 0x04, 0x16, 0x40, 0x0e, 0xc0, 0xcf, 0x1b, 
+	0x40, 0x20, 0xc1, 0xba, 0xb6, 0xbe, 0xf7, 0x40, 0x17, 0x01, 0x21, 0x40, 0x17, 0xc3, 0xbe, 0xf7, 0xba, 0xbe, 0x54, 0x6d, 0xcf, 0x1b, 0x02, 0x16, 
+	0x40, 0x0e, 0x01, 0x16, 0x40, 0x1b, 0x06, 0x00, 0x40, 0x1b, 0x08, 0x0e, 0xc0, 0x30, 0x2c, 0x81, 0x92, 0x44, 0xc0, 0x30, 0x34, 0x08, 0x0e, 0x40, 
+	0x1b, 0x08, 0x00, 0xc1, 0x81, 0x00, 0xc7, 0x09, 0x40, 0x1c, 0xc0, 0x8d, 0x13, 0x0d, 0x15, 0xc0, 0x6d, 0x13, 0x40, 0x1c, 0xc0, 0xc7, 0x09, 0x40, 
+	0x24, 0x3f, 0x00, 0x04, 0x00
+};
+const PackedIcon clock_icon_packed = {32, 32, clock_icon_packed_palette, 47, clock_icon_packed_data, 773};
+
+// GPUSA_Logo, 295x125px, 256 colors, 11636 bytes (raw 73750)
+static const uint16_t GPUSA_Logo_packed_palette [] PROGMEM = {
+	0x0000, 0x1ca7, 0x2b15, 0x2af3, 0x1c87, 0x2b35, 0x2b14, 0x2af4, 0x0020, 0x2376, 0x0040, 0x1c67, 0x2b55, 0x2b34, 0x0841, 0x1284, 
+	0x1ba6, 0x0922, 0x1c27, 0x1bc6, 0x2b13, 0x0861, 0x1c47, 0x0061, 0x08a1, 0x11e3, 0x08c2, 0x0942, 0x0041, 0x1224, 0x2396, 0x1c07, 
+	0x0862, 0x0902, 0x1be7, 0x08c1, 0x08e2, 0x0983, 0x1499, 0x2af5, 0x1244, 0xef5d, 0x1264, 0x1b86, 0x1082, 0x23b7, 0x2b56, 0x0021, 
+	0x09a3, 0x10c4, 0x12c5, 0x12e5, 0x1305, 0x1b25, 0x1b66, 0x0962, 0x1479, 0x1968, 0x8c51, 0x0881, 0x1203, 0x2355, 0x2356, 0xce59, 
+	0xdefb, 0xffff, 0x2ab1, 0x8430, 0x12a5, 0x14ba, 0xd6ba, 0xe71c, 0xf7be, 0x0882, 0x08a3, 0x1b46, 0x2b76, 0x3313, 0x3334, 0x4208, 
+	0x0883, 0x11c3, 0x1b26, 0x1c38, 0x23d7, 0x2ad2, 0x4228, 0x10a3, 0x1bf7, 0x2965, 0xb596, 0xffdf, 0x1106, 0x1168, 0x1438, 0x18e3, 
+	0x1926, 0x1947, 0x1989, 0x5acb, 0x632c, 0x1c18, 0x2124, 0x2335, 0x2945, 0x31a6, 0x3314, 0x5aeb, 0x8410, 0x10e4, 0x10e5, 0x1bf8, 
+	0x23b6, 0x3186, 0x39c7, 0xa534, 0xad55, 0xad75, 0xd69a, 0x0062, 0x1ab0, 0x1b05, 0x2375, 0x2a4e, 0x2a90, 0x2af2, 0x32f3, 0x8c71, 
+	0x9cd3, 0xb5b6, 0xc638, 0x0081, 0x10a2, 0x1189, 0x1204, 0x1325, 0x1458, 0x19aa, 0x1af2, 0x32d1, 0xbdf7, 0xdedb, 0x0060, 0x08c4, 
+	0x11a3, 0x11aa, 0x14da, 0x1be6, 0x1c79, 0x21eb, 0x222d, 0x2354, 0x2397, 0x6b4d, 0xe73c, 0xef7d, 0x1183, 0x12a4, 0x1b45, 0x1c59, 
+	0x21ca, 0x21ec, 0x2334, 0x23f7, 0x2ad3, 0x2b75, 0x2b96, 0x32b0, 0x4a49, 0x52aa, 0x630c, 0xc618, 0xce79, 0x08e5, 0x0cba, 0x10c3, 
+	0x1127, 0x1163, 0x11cb, 0x1905, 0x1a2d, 0x1ad1, 0x1bd6, 0x2104, 0x21a9, 0x23d8, 0x2a6f, 0x7bcf, 0x7bef, 0xa514, 0x08e1, 0x1459, 
+	0x1a90, 0x1bb7, 0x21aa, 0x224e, 0x226f, 0x2313, 0x2395, 0x23d6, 0x2a2d, 0x2b36, 0x2b54, 0x39e7, 0x4a69, 0x528a, 0x6b6d, 0x738e, 
+	0x00a1, 0x0c79, 0x0c99, 0x122d, 0x1417, 0x1437, 0x149a, 0x19a9, 0x1bc7, 0x1bd7, 0x1c58, 0x220c, 0x220d, 0x2a0c, 0x3333, 0x73ae, 
+	0x9492, 0x08a4, 0x0906, 0x0947, 0x1105, 0x1147, 0x124e, 0x18c3, 0x19cb, 0x1ae5, 0x1b96, 0x1c99, 0x21cb, 0x23b5, 0x2b97, 0x94b2, 
+	0xbdd7, 0xf79e, 0x0083, 0x00c1, 0x09c3, 0x0cda, 0x1142, 0x1146, 0x1148, 0x11ca, 0x120c, 0x120d, 0x1988, 0x19ca, 0x1a6f, 0x1a8d
+};
+static const uint8_t GPUSA_Logo_packed_data [] PROGMEM = {
+	0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x1e, 0x00, 0x02, 0x0e, 
+	0x44, 0xaf, 0x57, 0x84, 0x2c, 0x15, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x11, 0x00, 0x46, 0x1c, 0x57, 0xe4, 0x39, 0xc2, 0x95, 0xdc, 
+	0xc0, 0x2e, 0x22, 0x40, 0x7c, 0xc0, 0xd1, 0x2a, 0x42, 0x7d, 0x4d, 0x55, 0x01, 0x6a, 0x43, 0x07, 0x05, 0x0d, 0x06, 0x01, 0x07, 0x42, 0x8b, 0xa0, 
+	0x2f, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x08, 0x00, 0x47, 0x08, 0x50, 0x61, 0xec, 0x7b, 0x42, 0x03, 0x07, 0x02, 0x02, 0x01, 0x07, 
+	0x41, 0x27, 0x07, 0x01, 0x02, 0x43, 0x06, 0x07, 0x27, 0x07, 0x01, 0x02, 0x41, 0x06, 0x02, 0x01, 0x07, 0x42, 0x27, 0x06, 0x57, 0x3f, 0x00, 0x3f, 
+	0x00, 0x3f, 0x00, 0x3f, 0x00, 0x05, 0x00, 0x44, 0x31, 0xa0, 0xba, 0x4d, 0x05, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x40, 0x06, 0x02, 0x05, 0x40, 
+	0x02, 0x01, 0x06, 0x02, 0x05, 0x01, 0x02, 0x01, 0x06, 0x40, 0x02, 0x01, 0x05, 0x41, 0x06, 0x49, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
+	0x01, 0x00, 0x45, 0x0e, 0x61, 0xc8, 0x7e, 0x07, 0x02, 0x01, 0x05, 0x01, 0x02, 0x44, 0x27, 0x06, 0x05, 0x0d, 0x05, 0x02, 0x02, 0x40, 0x06, 0x02, 
+	0x05, 0x02, 0x07, 0x41, 0x05, 0x0c, 0x01, 0x05, 0x40, 0x02, 0x01, 0x06, 0x40, 0x0c, 0x01, 0x05, 0x41, 0x8b, 0x08, 0x04, 0x00, 0x44, 0x0e, 0x20, 
+	0x31, 0x77, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x34, 0x00, 0x44, 0x2f, 0x61, 0x7b, 0x6a, 0x02, 0x02, 0x07, 0x03, 0x02, 0x01, 0x27, 0x42, 
+	0x02, 0x05, 0x06, 0x02, 0x02, 0x4b, 0x27, 0x06, 0x05, 0x09, 0xa3, 0xc6, 0xa4, 0x7e, 0x4d, 0x4e, 0x06, 0x05, 0x01, 0x58, 0x40, 0x09, 0x02, 0x05, 
+	0x40, 0xc2, 0x04, 0x00, 0xc0, 0x88, 0x21, 0x40, 0xdc, 0xc0, 0xb1, 0x32, 0x45, 0xa4, 0x06, 0x6a, 0x8b, 0xa0, 0x20, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 
+	0x00, 0x2f, 0x00, 0x40, 0x31, 0xc0, 0xae, 0x22, 0x40, 0x7e, 0x03, 0x02, 0x42, 0x05, 0x02, 0x09, 0x02, 0x1e, 0x41, 0x09, 0x1e, 0x01, 0x09, 0x45, 
+	0x3e, 0x14, 0x42, 0x7b, 0xec, 0x39, 0xc0, 0x06, 0x19, 0x43, 0x8f, 0x4a, 0x15, 0x0e, 0x01, 0x08, 0x02, 0x0e, 0x41, 0x57, 0xf7, 0xc0, 0xea, 0x11, 
+	0x41, 0xeb, 0x1e, 0x01, 0x02, 0x40, 0x31, 0x07, 0x00, 0x47, 0x2f, 0x6d, 0x89, 0x8b, 0x02, 0x03, 0xc2, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
+	0x2b, 0x00, 0x40, 0x6e, 0xc1, 0xd0, 0x2a, 0x18, 0x24, 0x41, 0xa3, 0x05, 0x03, 0x02, 0x01, 0x05, 0x40, 0x9f, 0x02, 0x26, 0xc3, 0x78, 0x1c, 0xd4, 
+	0x1b, 0x8d, 0x12, 0xc8, 0x19, 0x41, 0x6d, 0x08, 0x0f, 0x00, 0x40, 0x08, 0xc0, 0x99, 0x24, 0x42, 0x6f, 0x02, 0x42, 0x0c, 0x00, 0x40, 0x60, 0xc0, 
+	0xd1, 0x2a, 0x42, 0x0c, 0x14, 0x6e, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x28, 0x00, 0x42, 0x5c, 0x7c, 0x06, 0x04, 0x02, 0x40, 0x27, 0x02, 0x02, 
+	0x40, 0x06, 0xc1, 0xd5, 0x23, 0xaf, 0x22, 0x42, 0x39, 0x31, 0x08, 0x14, 0x00, 0x44, 0x0e, 0x45, 0x1e, 0x02, 0xa0, 0x0d, 0x00, 0x44, 0x08, 0xa0, 
+	0x05, 0x07, 0x39, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x25, 0x00, 0x41, 0x6e, 0xa7, 0x08, 0x02, 0x44, 0x7e, 0x7b, 0xfc, 0x57, 0x08, 0x18, 0x00, 
+	0x41, 0x6d, 0x1e, 0x01, 0x02, 0x40, 0x31, 0x0f, 0x00, 0x43, 0xe4, 0x03, 0x06, 0xb0, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x22, 0x00, 0x41, 0x31, 
+	0x7b, 0x02, 0x02, 0x02, 0x05, 0x45, 0x02, 0x07, 0x03, 0x96, 0x60, 0x08, 0x1c, 0x00, 0x43, 0xe5, 0x05, 0x0c, 0x4d, 0x0b, 0x00, 0x41, 0x49, 0x15, 
+	0x03, 0x00, 0x43, 0xb3, 0x4e, 0x05, 0x61, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0x41, 0x50, 0xc8, 0x07, 0x02, 0x40, 0x42, 0xc0, 0x48, 
+	0x19, 0x40, 0x0e, 0x1f, 0x00, 0xc0, 0x0b, 0x1a, 0x42, 0x02, 0x0c, 0x7b, 0x0b, 0x00, 0xc2, 0x6d, 0x0a, 0xd9, 0x1c, 0x74, 0x2b, 0x47, 0x7b, 0xc2, 
+	0x5c, 0x20, 0x60, 0xa5, 0x6a, 0x31, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x1c, 0x00, 0x45, 0x50, 0xc8, 0x07, 0x02, 0x2e, 0x05, 0x02, 0x02, 0x42, 
+	0x06, 0x96, 0x6e, 0x22, 0x00, 0xc0, 0x6d, 0x1a, 0x42, 0x02, 0x05, 0x39, 0x0b, 0x00, 0xc0, 0x8d, 0x12, 0x41, 0xd6, 0x05, 0x01, 0x02, 0x01, 0x05, 
+	0x42, 0x4d, 0x4e, 0x02, 0xc0, 0xb1, 0x32, 0x40, 0x08, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x19, 0x00, 0x42, 0x4a, 0xdb, 0x06, 0x01, 0x05, 0x46, 
+	0x38, 0xf5, 0x45, 0x54, 0x4e, 0xdd, 0x50, 0x24, 0x00, 0xc0, 0x72, 0x2b, 0x42, 0x05, 0x02, 0x50, 0x0b, 0x00, 0xc0, 0x2b, 0x1a, 0x40, 0x38, 0x02, 
+	0x02, 0x03, 0x05, 0x01, 0x02, 0x40, 0xa0, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x17, 0x00, 0x40, 0xaf, 0xc0, 0x10, 0x1b, 0x40, 0x0c, 0x02, 0x05, 
+	0x43, 0xd9, 0xbf, 0x05, 0xed, 0xc0, 0x6d, 0x1a, 0x40, 0x20, 0x26, 0x00, 0xc0, 0x73, 0x1b, 0x41, 0x05, 0x55, 0x0c, 0x00, 0x42, 0x6d, 0x38, 0x3e, 
+	0x01, 0x09, 0x40, 0x3e, 0x01, 0x02, 0x40, 0x05, 0xc2, 0x39, 0x1c, 0xfb, 0x14, 0xb9, 0x1c, 0x40, 0xaf, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x14, 
+	0x00, 0x40, 0xe4, 0xc0, 0xaf, 0x22, 0x42, 0x54, 0xf5, 0x05, 0x01, 0x02, 0x41, 0x06, 0x6f, 0xc0, 0x16, 0x24, 0x41, 0xc2, 0x0e, 0x27, 0x00, 0x40, 
+	0x08, 0xc0, 0x16, 0x24, 0x40, 0x05, 0xc0, 0x4f, 0x2a, 0x0d, 0x00, 0xc0, 0x52, 0x23, 0x01, 0x3e, 0x41, 0x09, 0x3e, 0x01, 0x02, 0x40, 0x3e, 0xc0, 
+	0xfb, 0x14, 0x41, 0x58, 0x2d, 0xc0, 0xef, 0x22, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x12, 0x00, 0xc0, 0xe5, 0x18, 0x41, 0xba, 0x2d, 0x01, 0x26, 
+	0x40, 0x54, 0x02, 0x02, 0x42, 0x42, 0xb8, 0x1c, 0x29, 0x00, 0x40, 0x08, 0xc0, 0xf6, 0x23, 0x41, 0x02, 0xe8, 0x0d, 0x00, 0x42, 0x6d, 0x02, 0xc9, 
+	0x01, 0x05, 0x01, 0x02, 0x43, 0x05, 0x92, 0x1e, 0x2e, 0xc0, 0x78, 0x1c, 0x40, 0x4a, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x0f, 0x00, 0x41, 0x60, 
+	0xa7, 0x04, 0x02, 0x43, 0x05, 0x02, 0xba, 0x60, 0x2d, 0x00, 0xc0, 0x73, 0x23, 0x41, 0x05, 0xfc, 0x0e, 0x00, 0x4a, 0x60, 0x06, 0x05, 0xc9, 0x3e, 
+	0x09, 0x3e, 0x6f, 0x92, 0x45, 0x9f, 0xc0, 0xea, 0x21, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x0c, 0x00, 0x41, 0x08, 0xb0, 0xc0, 0x91, 0x2a, 0x02, 
+	0x02, 0x45, 0x27, 0x02, 0x07, 0x03, 0xa1, 0x31, 0x2f, 0x00, 0xc0, 0x11, 0x23, 0x41, 0x05, 0x31, 0x0f, 0x00, 0x42, 0x4a, 0x7b, 0x05, 0x01, 0x09, 
+	0x44, 0x3e, 0x67, 0x53, 0xbf, 0x2e, 0xc0, 0x12, 0x2b, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x0a, 0x00, 0x42, 0x20, 0x62, 0x4d, 0x03, 0x02, 0x44, 
+	0x05, 0x67, 0x7c, 0x61, 0x0e, 0x31, 0x00, 0xc0, 0x4c, 0x22, 0x41, 0x02, 0x49, 0x11, 0x00, 0x49, 0x4a, 0xdb, 0x0d, 0xc9, 0x02, 0x65, 0x5e, 0x05, 
+	0x2e, 0x2c, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x06, 0x00, 0x41, 0x2f, 0x60, 0xc0, 0x2e, 0x2a, 0x40, 0x6a, 0x01, 0x05, 0x01, 0x02, 0x40, 0x07, 
+	0xc0, 0x70, 0x22, 0x41, 0xd7, 0x49, 0x34, 0x00, 0x42, 0xb3, 0x05, 0x2f, 0x13, 0x00, 0x47, 0x0e, 0xec, 0x4e, 0xbf, 0x9f, 0x05, 0xc9, 0x61, 0x3f, 
+	0x00, 0x3f, 0x00, 0x3f, 0x00, 0x03, 0x00, 0x44, 0x0e, 0x61, 0x7b, 0x7e, 0x07, 0x02, 0x02, 0x43, 0xa4, 0xdc, 0x39, 0x49, 0x37, 0x00, 0x40, 0x08, 
+	0xc0, 0x12, 0x3b, 0x40, 0x2f, 0x15, 0x00, 0x40, 0x20, 0xc0, 0x10, 0x1b, 0x42, 0x94, 0x05, 0x02, 0xc0, 0xab, 0x21, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 
+	0x00, 0x40, 0x20, 0xc0, 0x87, 0x19, 0x40, 0xff, 0xc0, 0xb3, 0x1b, 0x43, 0xeb, 0x45, 0xd6, 0xeb, 0xc1, 0xb4, 0x1b, 0xef, 0x1a, 0x41, 0xd7, 0x31, 
+	0x3c, 0x00, 0xc0, 0x46, 0x21, 0x18, 0x00, 0x40, 0xd7, 0x01, 0x02, 0x40, 0x96, 0x3f, 0x00, 0x3f, 0x00, 0x3b, 0x00, 0x40, 0x31, 0xc4, 0xc8, 0x21, 
+	0xce, 0x2a, 0xf0, 0x1a, 0xb4, 0x1b, 0x94, 0x2b, 0x45, 0xc4, 0x96, 0xfd, 0xfc, 0x6d, 0x0e, 0x3f, 0x00, 0x1b, 0x00, 0x41, 0xb8, 0x05, 0xc0, 0xcc, 
+	0x11, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x40, 0x08, 0x3f, 0x00, 0x25, 0x00, 0xc0, 0xeb, 0x19, 0x40, 0xfb, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
+	0x3f, 0x00, 0x25, 0x00, 0x40, 0xb3, 0x06, 0x00, 0xc2, 0x66, 0x21, 0xce, 0x2a, 0x31, 0x13, 0x01, 0xb4, 0xc0, 0x4c, 0x22, 0x40, 0x85, 0xc0, 0x48, 
+	0x19, 0x40, 0x39, 0xc0, 0x46, 0x19, 0x43, 0xe1, 0x57, 0xaf, 0x08, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x1a, 0x00, 0x40, 0x4a, 0xc2, 
+	0x2b, 0x1a, 0x72, 0x1b, 0x78, 0x1c, 0x40, 0x45, 0x02, 0x26, 0xc0, 0xba, 0x1c, 0x40, 0xeb, 0xc0, 0xba, 0x1c, 0x01, 0x88, 0xc5, 0x57, 0x1c, 0x16, 
+	0x1c, 0x93, 0x13, 0x92, 0x1b, 0x72, 0x23, 0x6d, 0x0a, 0x81, 0x4c, 0x1a, 0xc3, 0xa8, 0x09, 0x67, 0x11, 0x67, 0x19, 0xe4, 0x08, 0x42, 0x49, 0x15, 
+	0x0e, 0x3f, 0x00, 0x3f, 0x00, 0x21, 0x00, 0x40, 0x08, 0x01, 0x1c, 0x44, 0x77, 0x50, 0x4a, 0x8f, 0xad, 0xc0, 0x05, 0x09, 0x40, 0xe2, 0xc0, 0x27, 
+	0x09, 0x40, 0xe3, 0x01, 0x5d, 0xc0, 0x27, 0x09, 0x42, 0xad, 0x20, 0x08, 0x3f, 0x00, 0x19, 0x00, 0x41, 0x1c, 0xf7, 0xc1, 0x4c, 0x1a, 0xf1, 0x1a, 
+	0x40, 0x70, 0x01, 0x54, 0x41, 0xa3, 0x58, 0x02, 0x6f, 0x01, 0x65, 0x40, 0x53, 0xc0, 0x18, 0x14, 0x41, 0x6f, 0x5e, 0x01, 0x53, 0x42, 0xda, 0x9f, 
+	0x65, 0xc8, 0x17, 0x1c, 0xf6, 0x1b, 0xd5, 0x1b, 0xd5, 0x23, 0x93, 0x23, 0xd0, 0x12, 0x8e, 0x1a, 0xae, 0x22, 0xeb, 0x09, 0x40, 0xfd, 0xc0, 0xa8, 
+	0x21, 0x41, 0x6e, 0x31, 0xc0, 0xe4, 0x18, 0x42, 0x0e, 0x2f, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 0x05, 0x00, 0x45, 0x2f, 0xaf, 0xb3, 0x61, 0x5d, 0xd7, 
+	0xc4, 0xea, 0x19, 0x0c, 0x1a, 0x4d, 0x1a, 0x8f, 0x22, 0xd0, 0x22, 0x41, 0xb5, 0x8a, 0xc0, 0x33, 0x1b, 0x41, 0xa2, 0x97, 0x01, 0x7a, 0xc0, 0x75, 
+	0x1b, 0x40, 0x54, 0xc1, 0xf9, 0x23, 0xf8, 0x23, 0x42, 0x9f, 0x45, 0x94, 0xc0, 0x18, 0x24, 0x47, 0x54, 0xa6, 0x4c, 0xa6, 0x97, 0x78, 0xb2, 0x4a, 
+	0x3f, 0x00, 0x1a, 0x00, 0x44, 0x0e, 0xb3, 0xd7, 0xc3, 0x14, 0x02, 0x1e, 0x02, 0x05, 0x43, 0x98, 0x1e, 0xc1, 0x3d, 0x01, 0x05, 0x40, 0x2e, 0x02, 
+	0x1e, 0x02, 0x05, 0x02, 0x09, 0x41, 0xeb, 0x2d, 0x01, 0x05, 0x01, 0x09, 0x42, 0x3d, 0x0d, 0x4e, 0xc3, 0xf5, 0x13, 0xf2, 0x22, 0xf1, 0x2a, 0x2e, 
+	0x1a, 0x43, 0xb4, 0xdd, 0x62, 0x39, 0xc0, 0x88, 0x21, 0x40, 0x6e, 0x01, 0x57, 0x02, 0x2c, 0x40, 0x20, 0x3f, 0x00, 0x3f, 0x00, 0x05, 0x00, 0x40, 
+	0x1c, 0xc1, 0xa9, 0x11, 0xf2, 0x22, 0x40, 0x98, 0xc0, 0xb7, 0x2b, 0x01, 0xee, 0x41, 0xa6, 0x2d, 0xc0, 0x18, 0x24, 0x47, 0x9f, 0x26, 0x94, 0x53, 
+	0x54, 0x4c, 0x0c, 0x1e, 0xc0, 0xf2, 0x22, 0x41, 0x85, 0x08, 0x3f, 0x00, 0x1c, 0x00, 0x43, 0x84, 0x60, 0xfd, 0x7b, 0xc1, 0xf2, 0x32, 0x35, 0x33, 
+	0x01, 0x09, 0x41, 0xea, 0x67, 0x01, 0x02, 0x40, 0x2e, 0x02, 0x09, 0x40, 0x05, 0x01, 0x02, 0x40, 0x3e, 0x01, 0x09, 0x41, 0x26, 0x2d, 0x01, 0x02, 
+	0x01, 0x1e, 0x48, 0x09, 0xc9, 0x02, 0x45, 0x1e, 0x4c, 0x09, 0x1e, 0x02, 0x01, 0x05, 0x40, 0x2e, 0x01, 0x09, 0x41, 0x2e, 0x02, 0xc1, 0x15, 0x33, 
+	0x55, 0x33, 0x40, 0xa6, 0x01, 0xc5, 0x01, 0x55, 0x40, 0x8b, 0x81, 0xf1, 0x32, 0x40, 0xfb, 0xc0, 0x0d, 0x1a, 0x41, 0xe8, 0x95, 0xc0, 0xeb, 0x29, 
+	0x40, 0xd7, 0xc0, 0x07, 0x09, 0x40, 0xb0, 0x01, 0x60, 0x41, 0x31, 0x20, 0x01, 0x49, 0x40, 0x0e, 0x3f, 0x00, 0x2d, 0x00, 0x40, 0x1c, 0xc0, 0xec, 
+	0x11, 0x40, 0x09, 0xc0, 0xb8, 0x23, 0x01, 0x2d, 0x40, 0x3d, 0xc0, 0xd2, 0x22, 0x41, 0xfe, 0xb4, 0xc0, 0x0d, 0x1a, 0x41, 0xb4, 0xc4, 0xc0, 0xd1, 
+	0x22, 0x49, 0x0c, 0x54, 0x53, 0x94, 0x26, 0xda, 0xa3, 0x70, 0x97, 0x85, 0x3f, 0x00, 0x1f, 0x00, 0x48, 0x08, 0x20, 0xe4, 0x39, 0x96, 0x7c, 0xa4, 
+	0x06, 0x05, 0x02, 0x0c, 0x02, 0x02, 0x40, 0x05, 0x01, 0x0c, 0x41, 0x38, 0x98, 0x01, 0x02, 0x40, 0x0c, 0x01, 0x2e, 0x43, 0x05, 0x02, 0x45, 0x09, 
+	0x01, 0x0c, 0x41, 0x3e, 0x06, 0x01, 0x02, 0x43, 0x2e, 0x3e, 0x09, 0x05, 0x01, 0x02, 0xc0, 0x15, 0x23, 0x40, 0x09, 0x01, 0x3e, 0x40, 0x05, 0x01, 
+	0x02, 0x43, 0x05, 0x2e, 0x3e, 0x2e, 0x02, 0x02, 0x44, 0x0c, 0x3e, 0x09, 0x3e, 0x05, 0x01, 0x02, 0x43, 0x0c, 0xa5, 0x0d, 0x55, 0xc0, 0xd2, 0x32, 
+	0x40, 0x8b, 0xc0, 0x4f, 0x2a, 0x40, 0x96, 0xc1, 0x4d, 0x22, 0x2c, 0x2a, 0x41, 0xf8, 0x39, 0xc0, 0x68, 0x21, 0x44, 0xe1, 0x31, 0x57, 0x1c, 0x2f, 
+	0x3f, 0x00, 0x1d, 0x00, 0x46, 0x5d, 0x7a, 0xb9, 0x2d, 0x78, 0x85, 0x50, 0x07, 0x00, 0x42, 0x08, 0x8f, 0x89, 0xc0, 0xb1, 0x22, 0x45, 0x0c, 0x1e, 
+	0xa3, 0xda, 0x26, 0xd6, 0xc0, 0x74, 0x1b, 0x40, 0x8f, 0x3f, 0x00, 0x23, 0x00, 0x48, 0x08, 0x49, 0x6e, 0x39, 0x95, 0xba, 0x4d, 0x0c, 0x3e, 0x02, 
+	0x05, 0x43, 0x94, 0x54, 0x3e, 0x3d, 0x03, 0x05, 0x42, 0x3d, 0x92, 0x09, 0x02, 0x05, 0x40, 0x02, 0x05, 0x05, 0x40, 0x02, 0xc0, 0x15, 0x23, 0x40, 
+	0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x05, 0x01, 0x02, 0x42, 0x05, 0x4c, 0xee, 0xc0, 0x18, 0x24, 0x44, 0x94, 0xd6, 0x94, 0x65, 0x54, 0x01, 0x4c, 
+	0x41, 0x0c, 0x05, 0x01, 0x02, 0x02, 0x05, 0x40, 0x06, 0x01, 0x02, 0x01, 0x05, 0x45, 0x0c, 0x06, 0x4d, 0x42, 0x7c, 0xa7, 0xc0, 0xcc, 0x19, 0x40, 
+	0xdd, 0xc0, 0x28, 0x11, 0x44, 0x39, 0x31, 0x57, 0x2f, 0x08, 0x3f, 0x00, 0x10, 0x00, 0x45, 0x1c, 0xc0, 0xb9, 0x09, 0xb2, 0x77, 0x0e, 0x00, 0x40, 
+	0x4a, 0xc0, 0x0c, 0x1a, 0x46, 0x0d, 0x0c, 0x05, 0x0c, 0x70, 0x1e, 0xf9, 0x3f, 0x00, 0x29, 0x00, 0x41, 0x0e, 0x31, 0xc0, 0x26, 0x11, 0x41, 0x62, 
+	0xdb, 0xc1, 0x92, 0x23, 0x74, 0x2b, 0x41, 0x7a, 0xa6, 0x02, 0x02, 0x41, 0x09, 0x1e, 0xc0, 0x1b, 0x1d, 0x40, 0x1e, 0x02, 0x02, 0x40, 0xa5, 0x01, 
+	0x1e, 0x40, 0x2e, 0x01, 0x02, 0x44, 0x2e, 0x98, 0x1e, 0x4c, 0x05, 0x01, 0x02, 0x43, 0x09, 0x1e, 0x4c, 0x2e, 0x01, 0x02, 0x41, 0x05, 0x98, 0x02, 
+	0x2d, 0x01, 0xee, 0x01, 0xa6, 0xc0, 0xb7, 0x2b, 0x41, 0xa3, 0xda, 0x01, 0x26, 0x43, 0x53, 0xa3, 0xa6, 0x0c, 0x01, 0x05, 0x42, 0x02, 0x05, 0xc9, 
+	0x02, 0x05, 0x40, 0x02, 0x01, 0x05, 0x08, 0x02, 0x40, 0x06, 0xc0, 0x34, 0x3b, 0x47, 0x42, 0xa7, 0xa1, 0xe8, 0x62, 0x6e, 0x31, 0x20, 0x3f, 0x00, 
+	0x07, 0x00, 0x40, 0xf2, 0xc0, 0x34, 0x1b, 0x40, 0x2d, 0xc0, 0xeb, 0x11, 0x40, 0x2f, 0x12, 0x00, 0x43, 0x20, 0x96, 0x0d, 0x05, 0x01, 0x0d, 0x40, 
+	0x0c, 0xc0, 0x6e, 0x1a, 0x40, 0x08, 0x3f, 0x00, 0x2e, 0x00, 0x41, 0x2f, 0x4a, 0xc0, 0x06, 0x19, 0x41, 0x39, 0xec, 0xc2, 0x8f, 0x2a, 0xf1, 0x2a, 
+	0x57, 0x1c, 0x41, 0x0c, 0x06, 0x01, 0x02, 0x46, 0x0c, 0x09, 0x54, 0x26, 0x38, 0x2d, 0x05, 0x01, 0x09, 0x40, 0x0c, 0x02, 0x02, 0x01, 0x2e, 0x40, 
+	0x4c, 0x01, 0x05, 0xc0, 0x77, 0x2b, 0x40, 0xb9, 0xc0, 0xb8, 0x23, 0x41, 0x2d, 0x09, 0xc1, 0xf2, 0x22, 0x2e, 0x1a, 0x40, 0xb2, 0xc0, 0x69, 0x11, 
+	0x01, 0x5d, 0xc1, 0x8a, 0x11, 0xec, 0x19, 0x49, 0xc4, 0x14, 0x70, 0x65, 0x94, 0x26, 0x9f, 0xa3, 0x1e, 0x4c, 0x01, 0x2e, 0x40, 0x05, 0x01, 0x02, 
+	0x41, 0x05, 0x2e, 0x01, 0x0c, 0x02, 0x02, 0x43, 0x0c, 0x2e, 0x0c, 0x05, 0x02, 0x02, 0x40, 0x2e, 0x01, 0x0c, 0x42, 0x02, 0x06, 0x02, 0xc0, 0x35, 
+	0x33, 0x40, 0x03, 0xc0, 0xb0, 0x2a, 0x45, 0x7b, 0xc2, 0x61, 0x31, 0x49, 0x08, 0x3e, 0x00, 0x43, 0x4a, 0x09, 0x8a, 0x50, 0x16, 0x00, 0x41, 0x5c, 
+	0x7d, 0x02, 0x0d, 0x42, 0x0c, 0xc0, 0x08, 0x3f, 0x00, 0x34, 0x00, 0x42, 0x08, 0x0e, 0x31, 0xc0, 0x06, 0x19, 0x42, 0xb8, 0x95, 0xc3, 0xc0, 0xd4, 
+	0x23, 0x49, 0xc7, 0xea, 0x45, 0xc1, 0x98, 0x1e, 0x09, 0x3e, 0x3d, 0x67, 0x01, 0x4c, 0x41, 0x2e, 0x4c, 0x01, 0xb9, 0x40, 0x09, 0xc0, 0x2e, 0x1a, 
+	0x41, 0xe2, 0x2f, 0x09, 0x00, 0x41, 0x4a, 0x89, 0xc0, 0xd1, 0x22, 0x46, 0x0c, 0x4c, 0x54, 0x53, 0x38, 0x9f, 0x4c, 0x02, 0x02, 0x03, 0x05, 0x01, 
+	0x02, 0x42, 0x6f, 0x9f, 0x54, 0x01, 0x05, 0x42, 0x06, 0x27, 0x02, 0x02, 0x05, 0x41, 0x02, 0x07, 0x01, 0x02, 0x02, 0x05, 0x02, 0x02, 0x40, 0x6a, 
+	0xc0, 0xf2, 0x32, 0x44, 0x7c, 0xec, 0x39, 0x6d, 0x0e, 0x38, 0x00, 0x40, 0x77, 0xc0, 0x75, 0x1b, 0x40, 0xfa, 0x19, 0x00, 0x40, 0x77, 0xc0, 0x90, 
+	0x22, 0x01, 0x0d, 0x42, 0x06, 0x05, 0xc0, 0x3f, 0x00, 0x3d, 0x00, 0x42, 0x1c, 0x31, 0xf7, 0xc0, 0xc9, 0x11, 0x40, 0xff, 0xc3, 0xef, 0x12, 0xb3, 
+	0x1b, 0x56, 0x24, 0xb9, 0x24, 0x41, 0x92, 0x45, 0xc0, 0x39, 0x1c, 0x43, 0xb9, 0x97, 0x85, 0x2f, 0x0f, 0x00, 0x41, 0xad, 0xc4, 0x02, 0x05, 0x41, 
+	0x0c, 0xa5, 0x03, 0x02, 0x40, 0x05, 0x01, 0x02, 0x46, 0x07, 0x6f, 0xd6, 0x58, 0x45, 0x6f, 0x3e, 0x02, 0x67, 0x40, 0x2e, 0x01, 0x05, 0x41, 0x02, 
+	0x06, 0x01, 0x02, 0x02, 0x05, 0x40, 0x02, 0x01, 0x27, 0x03, 0x02, 0x01, 0x27, 0x42, 0x03, 0x42, 0xdc, 0xc0, 0x89, 0x21, 0x41, 0x31, 0x08, 0x32, 
+	0x00, 0x40, 0x2f, 0xc0, 0x13, 0x1b, 0x40, 0x85, 0x1b, 0x00, 0x41, 0x2f, 0xc3, 0x02, 0x06, 0x41, 0x0c, 0xfb, 0x3f, 0x00, 0x3f, 0x00, 0x04, 0x00, 
+	0x45, 0x1c, 0x6e, 0x1e, 0x2d, 0x91, 0x08, 0x13, 0x00, 0xc1, 0xe6, 0x10, 0xd1, 0x22, 0x40, 0x05, 0x02, 0x0d, 0x42, 0x0c, 0x4c, 0x05, 0x01, 0x02, 
+	0x41, 0x05, 0x0c, 0xc1, 0xba, 0x1c, 0xf8, 0x23, 0x42, 0x02, 0x5e, 0x45, 0x02, 0x92, 0xc0, 0xfa, 0x14, 0x43, 0xf5, 0x45, 0xae, 0xf5, 0x01, 0x92, 
+	0x03, 0xae, 0x40, 0x45, 0x02, 0x26, 0x03, 0x38, 0x02, 0xbf, 0x42, 0x5e, 0xbf, 0x53, 0xc1, 0x17, 0x1c, 0xb3, 0x1b, 0x42, 0xff, 0xf7, 0x20, 0x2e, 
+	0x00, 0x41, 0xd3, 0x5d, 0x1d, 0x00, 0x41, 0x2f, 0xc4, 0x02, 0x06, 0x41, 0x65, 0xe3, 0x3f, 0x00, 0x3f, 0x00, 0x03, 0x00, 0x43, 0x77, 0x3d, 0x8a, 
+	0xf2, 0x16, 0x00, 0x40, 0x2f, 0xc0, 0xec, 0x19, 0x03, 0x0d, 0x01, 0x05, 0x4f, 0x02, 0x06, 0x02, 0x05, 0x53, 0x45, 0x5e, 0x45, 0xc1, 0x05, 0x0c, 
+	0x09, 0x4c, 0xc9, 0x05, 0x3e, 0x01, 0x09, 0x40, 0x1e, 0x02, 0x09, 0x40, 0x98, 0x02, 0x2d, 0x46, 0x1e, 0x2d, 0xc1, 0xd9, 0x54, 0x6f, 0x58, 0x01, 
+	0xd9, 0x40, 0x58, 0x01, 0x65, 0x43, 0x53, 0x65, 0x58, 0xc7, 0xc0, 0x12, 0x2b, 0x41, 0xa0, 0x31, 0x2a, 0x00, 0x41, 0xad, 0x85, 0x1f, 0x00, 0x41, 
+	0x1c, 0x42, 0x01, 0x06, 0x42, 0x38, 0x3d, 0x77, 0x3f, 0x00, 0x3f, 0x00, 0x01, 0x00, 0x40, 0x1c, 0xc0, 0x54, 0x1b, 0x40, 0xd3, 0x1a, 0x00, 0x42, 
+	0xf8, 0x06, 0x0d, 0x01, 0x06, 0x01, 0x02, 0x41, 0x06, 0x02, 0x01, 0x05, 0x43, 0x58, 0x65, 0x1e, 0x06, 0x01, 0x02, 0x01, 0x05, 0x02, 0x02, 0x42, 
+	0x05, 0x06, 0x05, 0x03, 0x02, 0x46, 0x05, 0x02, 0x05, 0x27, 0x02, 0x27, 0x02, 0x01, 0x05, 0x40, 0x02, 0x02, 0x27, 0x01, 0x02, 0x44, 0x05, 0x02, 
+	0x07, 0x27, 0x02, 0x01, 0x05, 0x43, 0x7e, 0xa1, 0x6e, 0x08, 0x26, 0x00, 0x40, 0x85, 0x21, 0x00, 0x45, 0xe1, 0x03, 0x7a, 0x53, 0x0d, 0xfe, 0x3f, 
+	0x00, 0x3f, 0x00, 0x01, 0x00, 0x41, 0x78, 0x91, 0x1c, 0x00, 0x41, 0x5c, 0x14, 0x02, 0x06, 0x01, 0x0c, 0x40, 0x05, 0x02, 0x02, 0x03, 0x05, 0x40, 
+	0x06, 0x01, 0x02, 0x41, 0x05, 0x67, 0x01, 0x02, 0x40, 0x06, 0x01, 0x02, 0x01, 0x05, 0x0b, 0x02, 0x40, 0x27, 0x04, 0x02, 0x41, 0x07, 0x27, 0x03, 
+	0x02, 0x41, 0x27, 0x07, 0xc0, 0xd3, 0x32, 0x41, 0xa1, 0x31, 0x23, 0x00, 0xc0, 0xc3, 0x08, 0x40, 0x08, 0x22, 0x00, 0x40, 0x62, 0x01, 0xc7, 0x42, 
+	0x14, 0x09, 0x8f, 0x3f, 0x00, 0x3f, 0x00, 0x01, 0x91, 0x1e, 0x00, 0x40, 0x5c, 0x02, 0x06, 0x40, 0xa3, 0xc0, 0xf8, 0x23, 0x47, 0x95, 0x89, 0xa1, 
+	0xba, 0xde, 0x0d, 0x0c, 0x05, 0x01, 0x07, 0x40, 0x02, 0x01, 0x0c, 0x47, 0x05, 0x02, 0x07, 0x02, 0x05, 0x0c, 0x2e, 0x05, 0x02, 0x02, 0x02, 0x05, 
+	0x01, 0x02, 0x42, 0x27, 0x02, 0x0c, 0x01, 0x05, 0x02, 0x02, 0x03, 0x05, 0x40, 0x02, 0x01, 0x06, 0x02, 0x05, 0x44, 0x02, 0x07, 0x42, 0x39, 0x1c, 
+	0x3f, 0x00, 0x05, 0x00, 0x40, 0x08, 0xc0, 0xd5, 0x13, 0x43, 0x0c, 0x14, 0x06, 0xc0, 0x3f, 0x00, 0x3e, 0x00, 0xc0, 0x82, 0x00, 0x40, 0xb2, 0x20, 
+	0x00, 0x40, 0x62, 0x01, 0x06, 0x42, 0x94, 0x09, 0x8a, 0x03, 0x00, 0x49, 0x0e, 0x4a, 0x5c, 0xb8, 0xa1, 0xba, 0x55, 0x4e, 0x05, 0x27, 0x01, 0x07, 
+	0x40, 0x02, 0x02, 0x05, 0x42, 0x02, 0x06, 0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x05, 0x41, 0x02, 0x27, 0x01, 0x02, 0x42, 0x06, 0x05, 0x02, 0x02, 
+	0x07, 0x01, 0x02, 0x47, 0x05, 0x02, 0x07, 0x27, 0x02, 0x03, 0x95, 0x15, 0x3f, 0x00, 0x04, 0x00, 0xc0, 0xc9, 0x09, 0x44, 0x06, 0x14, 0x03, 0x09, 
+	0x49, 0x3f, 0x00, 0x3d, 0x00, 0x40, 0x5d, 0x22, 0x00, 0x45, 0xc3, 0x06, 0x38, 0x06, 0x2d, 0x5d, 0x09, 0x00, 0x46, 0x08, 0xaf, 0x61, 0xc2, 0xdc, 
+	0x42, 0x03, 0x01, 0x02, 0x40, 0x67, 0x05, 0x02, 0x40, 0x27, 0x01, 0x07, 0x02, 0x02, 0x40, 0x07, 0x01, 0x27, 0x41, 0x02, 0x06, 0x01, 0x02, 0x02, 
+	0x07, 0x41, 0x02, 0x06, 0x01, 0x02, 0x41, 0x07, 0x27, 0x02, 0x02, 0x42, 0x6a, 0xa1, 0x20, 0x3f, 0x00, 0x03, 0x00, 0x43, 0x42, 0x14, 0x03, 0x0d, 
+	0xc0, 0xec, 0x11, 0x3f, 0x00, 0x3c, 0x00, 0x41, 0x1c, 0x20, 0x22, 0x00, 0x44, 0x20, 0xa2, 0x53, 0x06, 0x0d, 0xc0, 0x76, 0x1b, 0x0c, 0x00, 0x40, 
+	0x0a, 0x01, 0x00, 0x41, 0x2f, 0x4a, 0xc3, 0x46, 0x19, 0x6c, 0x1a, 0x51, 0x23, 0x53, 0x2b, 0x40, 0x07, 0x01, 0x06, 0x41, 0x05, 0x0c, 0x01, 0x05, 
+	0x42, 0x02, 0x06, 0x02, 0x01, 0x05, 0x43, 0x54, 0x88, 0x5e, 0x09, 0x03, 0x02, 0x01, 0x06, 0x05, 0x02, 0x40, 0x07, 0x01, 0x02, 0x40, 0x7e, 0xc0, 
+	0x89, 0x21, 0x40, 0x08, 0x3f, 0x00, 0x01, 0x00, 0xc0, 0x8a, 0x19, 0x02, 0x03, 0xc0, 0x13, 0x1b, 0x3f, 0x00, 0x3f, 0x00, 0x22, 0x00, 0xc0, 0x2c, 
+	0x12, 0x44, 0xc7, 0x14, 0x03, 0x2d, 0x5d, 0x14, 0x00, 0x41, 0x15, 0x6e, 0xc2, 0x69, 0x19, 0x2e, 0x22, 0x33, 0x2b, 0x4b, 0xc7, 0x2d, 0xc1, 0x1e, 
+	0xea, 0x70, 0x6f, 0x92, 0x2d, 0x58, 0x26, 0x02, 0x02, 0x05, 0x02, 0x07, 0x40, 0x02, 0x02, 0x05, 0x02, 0x67, 0x40, 0x2e, 0x01, 0x0c, 0x41, 0x42, 
+	0x6d, 0x3f, 0x00, 0x41, 0x00, 0x50, 0x02, 0x03, 0x41, 0x09, 0x49, 0x3f, 0x00, 0x3f, 0x00, 0x21, 0x00, 0x44, 0x1c, 0xc5, 0x14, 0x03, 0x0d, 0xc0, 
+	0x33, 0x1b, 0x19, 0x00, 0x40, 0x20, 0xc2, 0x67, 0x11, 0xad, 0x1a, 0x93, 0x13, 0x48, 0xda, 0x38, 0x26, 0x38, 0x07, 0x3d, 0xae, 0x0c, 0x02, 0x01, 
+	0x06, 0x02, 0x07, 0x01, 0x02, 0x44, 0x2e, 0x26, 0xae, 0xd2, 0xae, 0x02, 0x45, 0x43, 0xd2, 0x26, 0xff, 0x08, 0x3f, 0x00, 0x40, 0x42, 0x01, 0x03, 
+	0x41, 0x05, 0x5d, 0x3f, 0x00, 0x3f, 0x00, 0x22, 0x00, 0x40, 0x89, 0x02, 0x03, 0x41, 0xb9, 0x4a, 0x1c, 0x00, 0x42, 0x20, 0x5c, 0x96, 0xc0, 0x36, 
+	0x1c, 0x43, 0x53, 0x38, 0x5e, 0x07, 0x02, 0x06, 0x02, 0x07, 0x46, 0x06, 0x3d, 0xd6, 0x65, 0x02, 0x06, 0x02, 0x03, 0x05, 0x43, 0x02, 0x05, 0xba, 
+	0x20, 0x3e, 0x00, 0x40, 0xa1, 0x01, 0x03, 0x41, 0x06, 0xd3, 0x3f, 0x00, 0x3f, 0x00, 0x22, 0x00, 0x40, 0x50, 0x02, 0x03, 0x40, 0x09, 0xc0, 0xeb, 
+	0x11, 0x1f, 0x00, 0x40, 0x08, 0xc1, 0x25, 0x11, 0x8d, 0x22, 0x41, 0x4e, 0x06, 0x02, 0x07, 0x40, 0x02, 0x01, 0x05, 0x44, 0x09, 0x26, 0x6f, 0x02, 
+	0x05, 0x02, 0x02, 0x01, 0x07, 0x45, 0x06, 0x02, 0x06, 0x02, 0x42, 0x57, 0x3d, 0x00, 0xc0, 0x69, 0x19, 0x02, 0x03, 0x40, 0x78, 0x3f, 0x00, 0x3f, 
+	0x00, 0x23, 0x00, 0xc0, 0x70, 0x2a, 0x01, 0x03, 0x41, 0x0d, 0x8a, 0x22, 0x00, 0x42, 0x08, 0x61, 0x7c, 0x01, 0x07, 0x01, 0x06, 0x42, 0x1e, 0x26, 
+	0xc1, 0x01, 0x02, 0x01, 0x06, 0x41, 0x02, 0x27, 0x01, 0x07, 0x03, 0x06, 0x42, 0x07, 0xa4, 0xb3, 0x3c, 0x00, 0x40, 0x5c, 0x02, 0x03, 0x40, 0xc5, 
+	0x3f, 0x00, 0x3f, 0x00, 0x23, 0x00, 0x40, 0x89, 0x02, 0x03, 0x41, 0x2d, 0x08, 0x24, 0x00, 0xc0, 0x27, 0x19, 0x44, 0x42, 0x07, 0x1e, 0x26, 0x70, 
+	0x02, 0x07, 0x02, 0x06, 0x03, 0x07, 0x01, 0x06, 0x02, 0x07, 0x40, 0x7e, 0xc0, 0xe5, 0x18, 0x3b, 0x00, 0x40, 0x8f, 0x02, 0x03, 0x40, 0xa2, 0x3f, 
+	0x00, 0x3f, 0x00, 0x23, 0x00, 0xc0, 0xe6, 0x10, 0x02, 0x03, 0xc0, 0xb8, 0x23, 0x40, 0x50, 0x25, 0x00, 0x40, 0x0e, 0xc0, 0xaf, 0x22, 0x41, 0xd1, 
+	0x09, 0x01, 0x06, 0x01, 0x02, 0x01, 0x07, 0x41, 0x06, 0x02, 0x01, 0x06, 0x02, 0x07, 0x02, 0x06, 0x42, 0x07, 0x55, 0x20, 0x3a, 0x00, 0x40, 0x4a, 
+	0x02, 0x03, 0x40, 0x97, 0x3f, 0x00, 0x3f, 0x00, 0x23, 0x00, 0x40, 0x20, 0x02, 0x03, 0x41, 0x98, 0xe2, 0x26, 0x00, 0x40, 0x1c, 0xc0, 0x12, 0x2b, 
+	0x40, 0x07, 0x01, 0x06, 0x01, 0x02, 0x02, 0x07, 0x43, 0x02, 0x06, 0x05, 0x0d, 0x01, 0x06, 0x40, 0x02, 0x01, 0x05, 0x43, 0x06, 0x07, 0x7c, 0x2f, 
+	0x39, 0x00, 0x40, 0xe1, 0x02, 0x03, 0x40, 0x97, 0x3f, 0x00, 0x3f, 0x00, 0x23, 0x00, 0x41, 0x2f, 0x55, 0x01, 0x03, 0x40, 0x09, 0xc0, 0x68, 0x09, 
+	0x27, 0x00, 0x41, 0x62, 0x07, 0x01, 0x06, 0x40, 0x02, 0x03, 0x07, 0x42, 0x02, 0xd9, 0x26, 0x03, 0xd2, 0x40, 0x45, 0x01, 0x26, 0x01, 0xd1, 0xc0, 
+	0xef, 0x22, 0x39, 0x00, 0xc0, 0xc5, 0x08, 0x02, 0x03, 0x40, 0xc5, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x40, 0x55, 0x01, 0x03, 0x41, 0x09, 0x91, 
+	0x27, 0x00, 0x41, 0x39, 0x06, 0x02, 0x07, 0x01, 0x06, 0x47, 0x07, 0x06, 0x58, 0x5e, 0x67, 0xa2, 0x67, 0xa2, 0x06, 0x3d, 0x40, 0x60, 0x38, 0x00, 
+	0x40, 0xb0, 0x02, 0x03, 0x40, 0xb5, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x40, 0x42, 0x01, 0x03, 0x41, 0x09, 0x91, 0x26, 0x00, 0x42, 0x08, 0xa7, 
+	0x06, 0x02, 0x07, 0x46, 0x06, 0x6a, 0x0d, 0x53, 0x5e, 0x06, 0x07, 0x02, 0x06, 0x03, 0x07, 0x44, 0x06, 0x6a, 0x06, 0x8b, 0x0e, 0x37, 0x00, 0xc0, 
+	0x8a, 0x19, 0x02, 0x03, 0x40, 0xe6, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0xc0, 0xb2, 0x2a, 0x01, 0x03, 0x41, 0x09, 0x85, 0x26, 0x00, 0x40, 0xdd, 
+	0x01, 0x06, 0x03, 0x07, 0x43, 0x0d, 0x5e, 0x65, 0x06, 0x01, 0x07, 0x02, 0x06, 0x04, 0x07, 0x01, 0x06, 0x41, 0x03, 0xb8, 0x37, 0x00, 0x40, 0x96, 
+	0x01, 0x03, 0x41, 0x0d, 0x91, 0x3f, 0x00, 0x3f, 0x00, 0x23, 0x00, 0x41, 0x08, 0x55, 0x01, 0x03, 0x41, 0x09, 0xe3, 0x24, 0x00, 0x41, 0x2f, 0xdb, 
+	0x05, 0x07, 0x43, 0x05, 0x88, 0x58, 0x06, 0x0c, 0x07, 0x42, 0x03, 0x7e, 0x15, 0x35, 0x00, 0x41, 0x08, 0x55, 0x01, 0x03, 0x41, 0x09, 0x8f, 0x3f, 
+	0x00, 0x3f, 0x00, 0x23, 0x00, 0x40, 0x20, 0x02, 0x03, 0x41, 0x98, 0x8f, 0x23, 0x00, 0x43, 0x60, 0x8b, 0x06, 0x03, 0x01, 0x07, 0x01, 0x06, 0x41, 
+	0x0c, 0x38, 0xc0, 0xb6, 0x1b, 0x01, 0x07, 0x02, 0x06, 0x40, 0x07, 0x01, 0x03, 0x01, 0x06, 0x42, 0x0c, 0x70, 0x7a, 0x02, 0x07, 0x41, 0x06, 0xb8, 
+	0x35, 0x00, 0xc0, 0xc5, 0x10, 0x02, 0x03, 0x40, 0x97, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0xc0, 0xc5, 0x10, 0x02, 0x03, 0x41, 0x2d, 0x1c, 0x21, 
+	0x00, 0x41, 0x50, 0x7b, 0x02, 0x06, 0x02, 0x03, 0x44, 0x06, 0xa5, 0x38, 0x70, 0x03, 0x01, 0x07, 0x02, 0x06, 0x40, 0x07, 0x01, 0x03, 0x43, 0x07, 
+	0x0c, 0x26, 0x65, 0xc1, 0x58, 0x0c, 0xb6, 0x1b, 0x02, 0x07, 0x40, 0xa7, 0x35, 0x00, 0xc0, 0xec, 0x19, 0x02, 0x03, 0x40, 0xe6, 0x3f, 0x00, 0x3f, 
+	0x00, 0x24, 0x00, 0xc0, 0x69, 0x19, 0x02, 0x03, 0xc0, 0x54, 0x1b, 0x20, 0x00, 0x42, 0x6d, 0xdb, 0x03, 0x01, 0x07, 0x41, 0x03, 0x07, 0x02, 0x03, 
+	0x43, 0x7a, 0x38, 0x70, 0x07, 0x01, 0x03, 0x04, 0x07, 0x01, 0x03, 0x45, 0x07, 0x58, 0x5e, 0x07, 0x3d, 0xd1, 0xc0, 0x18, 0x14, 0x40, 0xd4, 0xc1, 
+	0x17, 0x1c, 0xc9, 0x21, 0x34, 0x00, 0x41, 0x1c, 0x55, 0x01, 0x03, 0x41, 0x09, 0xad, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0xc0, 0x2e, 0x22, 0x01, 
+	0x03, 0x41, 0x0d, 0xe6, 0x1d, 0x00, 0x40, 0x49, 0xc1, 0xea, 0x19, 0xf1, 0x2a, 0x02, 0xa5, 0x01, 0x0d, 0x01, 0x06, 0x01, 0x0d, 0x43, 0x70, 0x38, 
+	0x7a, 0x07, 0x03, 0x06, 0x02, 0x07, 0x01, 0x06, 0x01, 0x07, 0xc0, 0xb6, 0x1b, 0x44, 0xd1, 0x3d, 0xb6, 0x88, 0x1e, 0xc1, 0x74, 0x23, 0xa8, 0x11, 
+	0x35, 0x00, 0xc0, 0x8a, 0x19, 0x02, 0x03, 0x40, 0x8a, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x41, 0x1c, 0xa4, 0x01, 0x03, 0x40, 0x09, 0xc0, 0x27, 
+	0x09, 0x1a, 0x00, 0x41, 0x0e, 0xfc, 0xc0, 0x31, 0x23, 0x40, 0xd5, 0x01, 0x88, 0x81, 0x78, 0x14, 0x41, 0x26, 0x38, 0xc1, 0x78, 0x0c, 0x58, 0x0c, 
+	0x40, 0xd1, 0x02, 0x38, 0x40, 0x3d, 0x01, 0x07, 0x03, 0x06, 0x40, 0x07, 0x01, 0x03, 0x42, 0x06, 0x6a, 0x06, 0x01, 0x07, 0x45, 0xd9, 0x88, 0x53, 
+	0xca, 0xc8, 0x49, 0x35, 0x00, 0x41, 0x20, 0x55, 0x01, 0x03, 0x41, 0x3d, 0xe3, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x40, 0xf8, 0x02, 0x03, 0x41, 
+	0x09, 0x08, 0x17, 0x00, 0x41, 0x1c, 0x5c, 0xc0, 0x4d, 0x2a, 0x40, 0x03, 0x01, 0x06, 0x01, 0x07, 0x40, 0x03, 0x01, 0x14, 0x40, 0x06, 0x01, 0x07, 
+	0x40, 0x03, 0x03, 0x06, 0x01, 0x03, 0x01, 0x07, 0x01, 0x03, 0x01, 0x07, 0x01, 0x03, 0x40, 0x07, 0x02, 0x03, 0x40, 0x07, 0x01, 0x03, 0xc0, 0x6e, 
+	0x2a, 0x40, 0xb3, 0x37, 0x00, 0x40, 0xdc, 0x02, 0x03, 0x40, 0x8a, 0x3f, 0x00, 0x3f, 0x00, 0x25, 0x00, 0xc0, 0x70, 0x2a, 0x01, 0x03, 0x41, 0x05, 
+	0xd3, 0x15, 0x00, 0x40, 0x57, 0xc0, 0x88, 0x21, 0x46, 0xba, 0x4d, 0x4e, 0x06, 0x07, 0x03, 0x06, 0x01, 0x0d, 0x40, 0x06, 0x01, 0x03, 0x40, 0x07, 
+	0x01, 0x06, 0x41, 0x14, 0x06, 0x02, 0x03, 0x02, 0x06, 0x40, 0x07, 0x01, 0x03, 0x03, 0x07, 0x03, 0x03, 0x42, 0x7e, 0xc8, 0x6d, 0x38, 0x00, 0x40, 
+	0xb0, 0x02, 0x03, 0x41, 0x09, 0x8f, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x40, 0x5c, 0x02, 0x03, 0x41, 0x98, 0x77, 0x0e, 0x00, 0x45, 0x17, 0x15, 
+	0x00, 0x20, 0x60, 0xdb, 0xc0, 0xb1, 0x32, 0x01, 0x03, 0x03, 0x06, 0x01, 0x03, 0x01, 0x06, 0x41, 0x0d, 0x06, 0x02, 0x03, 0x01, 0x06, 0x41, 0x14, 
+	0x06, 0x02, 0x03, 0x02, 0x06, 0x40, 0x07, 0x01, 0x03, 0x40, 0x07, 0x02, 0x06, 0x01, 0x03, 0x40, 0xa7, 0xc0, 0x89, 0x21, 0x40, 0x20, 0x39, 0x00, 
+	0x41, 0x4a, 0x55, 0x01, 0x03, 0x41, 0x05, 0xfa, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x41, 0x08, 0x7c, 0x01, 0x03, 0x41, 0x0d, 0xe6, 0x0e, 0x00, 
+	0x40, 0x57, 0xc0, 0x67, 0x19, 0x43, 0xdd, 0xa7, 0x4d, 0x06, 0x03, 0x03, 0x01, 0x06, 0x40, 0x14, 0x03, 0x03, 0x01, 0x06, 0x40, 0x14, 0x03, 0x03, 
+	0x40, 0x14, 0x01, 0x03, 0x40, 0xa4, 0x01, 0x03, 0x40, 0x14, 0x01, 0x06, 0x40, 0x07, 0x01, 0x03, 0x42, 0x07, 0x06, 0x14, 0xc0, 0xb0, 0x2a, 0x41, 
+	0xa0, 0x57, 0x3b, 0x00, 0x41, 0x20, 0x42, 0x01, 0x03, 0x40, 0x06, 0xc0, 0xd2, 0x1a, 0x3f, 0x00, 0x3f, 0x00, 0x25, 0x00, 0x40, 0x89, 0x02, 0x03, 
+	0x41, 0x09, 0x77, 0x09, 0x00, 0x45, 0x20, 0x60, 0xb8, 0xc8, 0x8b, 0x4e, 0x02, 0x06, 0x01, 0x03, 0x40, 0x14, 0x01, 0x06, 0x40, 0x14, 0x02, 0x03, 
+	0x02, 0x14, 0x0f, 0x03, 0x43, 0x07, 0x03, 0xa4, 0x7e, 0xc0, 0x90, 0x32, 0x41, 0x62, 0x57, 0x3d, 0x00, 0x41, 0x50, 0x42, 0x01, 0x03, 0x40, 0x06, 
+	0xc1, 0x34, 0x1b, 0x42, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0xc0, 0xc5, 0x08, 0x02, 0x03, 0x41, 0x3d, 0x85, 0x03, 0x00, 0x44, 0x1c, 0x49, 
+	0x6d, 0x39, 0x95, 0xc0, 0x8f, 0x32, 0x45, 0x7d, 0x4e, 0x14, 0x03, 0x7d, 0x03, 0x02, 0x4e, 0x40, 0x07, 0x01, 0x03, 0x40, 0x14, 0x01, 0x0d, 0x40, 
+	0x6a, 0x02, 0x03, 0x43, 0x06, 0x0d, 0x6a, 0x06, 0x02, 0x03, 0x42, 0x4d, 0x14, 0x0d, 0x03, 0x03, 0x01, 0x4d, 0x46, 0x6a, 0xa4, 0x03, 0x7c, 0xdd, 
+	0x61, 0x15, 0x3f, 0x00, 0xc0, 0x88, 0x09, 0x45, 0x03, 0x14, 0x03, 0x06, 0xa2, 0xf2, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x41, 0x20, 0x42, 0x01, 
+	0x03, 0x44, 0x06, 0xca, 0x61, 0x39, 0x95, 0xc1, 0x10, 0x23, 0x93, 0x23, 0x41, 0xed, 0xc7, 0xc0, 0x95, 0x1b, 0x40, 0xc6, 0xc0, 0x95, 0x1b, 0x01, 
+	0x70, 0x45, 0xed, 0xc6, 0x7a, 0x97, 0x7a, 0xc6, 0x01, 0x7a, 0x40, 0x3d, 0x01, 0xa2, 0x02, 0xca, 0x40, 0x0d, 0x01, 0x06, 0x40, 0x03, 0x02, 0x0d, 
+	0x40, 0x14, 0x02, 0x03, 0x01, 0x14, 0x40, 0x06, 0x03, 0x03, 0xc0, 0xf2, 0x32, 0x43, 0xa7, 0xa1, 0x61, 0x49, 0x3f, 0x00, 0x01, 0x00, 0x45, 0x08, 
+	0xe8, 0x38, 0x06, 0x14, 0x06, 0xc0, 0x34, 0x1b, 0x40, 0xf2, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0xc0, 0x42, 0x00, 0x40, 0x7c, 0x02, 0x03, 0x42, 
+	0x7e, 0x03, 0x14, 0x81, 0x33, 0x2b, 0x02, 0xc6, 0x01, 0xed, 0x05, 0xb6, 0xc0, 0xf6, 0x1b, 0x40, 0xb6, 0xc0, 0xf6, 0x1b, 0x01, 0x58, 0xc0, 0x17, 
+	0x1c, 0x04, 0xd4, 0x41, 0x5e, 0xd5, 0x01, 0x5e, 0x41, 0xd5, 0x5e, 0x02, 0x88, 0x82, 0x38, 0x0c, 0x02, 0xd5, 0xc2, 0x93, 0x1b, 0xf0, 0x1a, 0xea, 
+	0x19, 0x41, 0x6e, 0x20, 0x2e, 0x00, 0x41, 0x4a, 0x6e, 0x13, 0x00, 0x47, 0x5c, 0x42, 0xca, 0xda, 0x06, 0x0c, 0xb5, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 
+	0x24, 0x00, 0x40, 0x50, 0xc0, 0x91, 0x2a, 0x05, 0x03, 0x40, 0xde, 0x01, 0x4e, 0x40, 0x14, 0x02, 0x03, 0x40, 0xde, 0xc0, 0x33, 0x2b, 0x40, 0xde, 
+	0x02, 0x03, 0x41, 0x14, 0xde, 0x01, 0x4d, 0x02, 0x03, 0x43, 0x0d, 0xde, 0x4e, 0x14, 0x02, 0x03, 0x42, 0x0d, 0x4e, 0x14, 0x02, 0x03, 0xc0, 0xf2, 
+	0x32, 0x40, 0x8b, 0xc0, 0x6e, 0x2a, 0x43, 0x95, 0x39, 0x6d, 0x1c, 0x34, 0x00, 0x40, 0x20, 0xc0, 0xeb, 0x19, 0x41, 0xf8, 0x2f, 0x0d, 0x00, 0x41, 
+	0x2f, 0xb0, 0xc0, 0x90, 0x22, 0x01, 0x06, 0x43, 0x70, 0x58, 0x09, 0xb2, 0x3f, 0x00, 0x3f, 0x00, 0x25, 0x00, 0xc0, 0x67, 0x09, 0x44, 0x97, 0x14, 
+	0x03, 0x06, 0x7d, 0xc0, 0x6e, 0x2a, 0x42, 0x7c, 0x8b, 0x7d, 0x01, 0x4d, 0x43, 0x03, 0x7d, 0x03, 0x7d, 0xc0, 0x12, 0x33, 0x01, 0x14, 0x01, 0x03, 
+	0x42, 0x55, 0x7d, 0x14, 0xc0, 0x12, 0x33, 0x40, 0x4d, 0x02, 0x03, 0x02, 0x14, 0x41, 0x7d, 0x55, 0xc2, 0xd2, 0x32, 0xb0, 0x2a, 0x8f, 0x2a, 0x40, 
+	0xc8, 0xc0, 0xea, 0x21, 0x43, 0x39, 0xe4, 0xaf, 0x0e, 0x3c, 0x00, 0x40, 0xb0, 0xc0, 0xb0, 0x22, 0x42, 0xc3, 0x5d, 0x50, 0x07, 0x00, 0x43, 0x50, 
+	0xe5, 0x96, 0x03, 0x03, 0x06, 0x42, 0x54, 0xb5, 0x4a, 0x3f, 0x00, 0x3f, 0x00, 0x0d, 0x00, 0x40, 0x08, 0x15, 0x00, 0x47, 0x2f, 0xe8, 0x53, 0x0c, 
+	0x14, 0x06, 0x8a, 0x77, 0x01, 0x00, 0x41, 0x0e, 0x20, 0x01, 0x31, 0xc1, 0x67, 0x21, 0x88, 0x21, 0x02, 0x39, 0x02, 0x62, 0x01, 0x89, 0x41, 0xa0, 
+	0x95, 0xc0, 0x2c, 0x32, 0x40, 0x62, 0xc0, 0x89, 0x21, 0x41, 0xb8, 0xb0, 0xc1, 0x67, 0x21, 0xc5, 0x10, 0x43, 0x6d, 0x20, 0x0e, 0x08, 0x3f, 0x00, 
+	0x06, 0x00, 0x40, 0x5c, 0xc0, 0x6e, 0x22, 0x01, 0x0d, 0x40, 0x7d, 0xc0, 0x90, 0x22, 0x42, 0xc4, 0xc3, 0xc4, 0xc0, 0xd1, 0x2a, 0x40, 0x14, 0x04, 
+	0x0d, 0x43, 0x0c, 0x09, 0x78, 0xad, 0x3f, 0x00, 0x3f, 0x00, 0x0f, 0x00, 0x40, 0x08, 0xc0, 0x26, 0x11, 0x40, 0xe1, 0x11, 0x00, 0x46, 0x08, 0xe5, 
+	0x55, 0x06, 0x26, 0x06, 0x05, 0xc0, 0x4e, 0x1a, 0x40, 0x08, 0x3f, 0x00, 0x0c, 0x00, 0x40, 0xaf, 0xc0, 0x25, 0x19, 0x41, 0x61, 0x5d, 0xc0, 0xa9, 
+	0x11, 0x43, 0x91, 0xb2, 0xfa, 0xb4, 0xc0, 0x4e, 0x1a, 0x40, 0xfe, 0xc0, 0x8f, 0x1a, 0x40, 0xc0, 0x01, 0x78, 0xc0, 0xb1, 0x1a, 0x02, 0xb5, 0x40, 
+	0x8a, 0xc0, 0x12, 0x1b, 0x81, 0x13, 0x1b, 0xc2, 0x33, 0x1b, 0x34, 0x1b, 0x54, 0x1b, 0x44, 0x1e, 0xb9, 0x2d, 0xa6, 0x4c, 0x02, 0x0c, 0x40, 0x05, 
+	0x01, 0x0c, 0x01, 0x09, 0x42, 0x8a, 0xb2, 0x49, 0x3f, 0x00, 0x3f, 0x00, 0x13, 0x00, 0xc0, 0x26, 0x11, 0x42, 0xb4, 0x5c, 0x08, 0x0c, 0x00, 0x42, 
+	0x20, 0x62, 0x42, 0x01, 0x06, 0x43, 0xca, 0x94, 0xc5, 0xe2, 0x3f, 0x00, 0x13, 0x00, 0x42, 0x08, 0x0e, 0x15, 0x01, 0x77, 0x43, 0x50, 0x8f, 0xad, 
+	0x5c, 0xc0, 0x26, 0x09, 0x41, 0xe3, 0x5d, 0xc0, 0x69, 0x09, 0x42, 0x91, 0xf9, 0xb2, 0xc0, 0xeb, 0x11, 0x43, 0xfa, 0xfb, 0xd3, 0xe6, 0xc0, 0x6e, 
+	0x12, 0x40, 0xfe, 0xc0, 0x8f, 0x1a, 0x40, 0xc0, 0x03, 0x78, 0xc0, 0x8f, 0x1a, 0x43, 0xd3, 0xf9, 0xe2, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 0x17, 0x00, 
+	0x46, 0x1c, 0x89, 0x7d, 0xc3, 0x85, 0xad, 0x20, 0x03, 0x00, 0x43, 0x08, 0x49, 0x5c, 0x89, 0xc0, 0x90, 0x22, 0x41, 0x06, 0x0d, 0x01, 0x06, 0x43, 
+	0x0d, 0xa2, 0xf9, 0x08, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x0b, 0x00, 0x02, 0x08, 0x43, 0x2f, 0x0e, 0x49, 0x62, 0xc0, 0xb0, 0x2a, 
+	0x01, 0x0c, 0x40, 0x0d, 0x02, 0x14, 0x41, 0x0d, 0x05, 0x04, 0x0d, 0x43, 0x05, 0xc0, 0x5d, 0x08, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3a, 0x00, 
+	0x48, 0x0e, 0x57, 0xb3, 0x60, 0xe5, 0x39, 0x62, 0x91, 0xfd, 0xc1, 0x0b, 0x1a, 0x2c, 0x1a, 0x40, 0xb4, 0xc1, 0x4e, 0x1a, 0x8f, 0x1a, 0x42, 0x78, 
+	0xb5, 0x8a, 0xc1, 0x12, 0x23, 0x33, 0x23, 0x40, 0x97, 0xc3, 0x54, 0x1b, 0x55, 0x1b, 0x75, 0x1b, 0x76, 0x1b, 0x01, 0xea, 0x40, 0xc1, 0x01, 0x2d, 
+	0x41, 0x1e, 0xa5, 0x02, 0x0c, 0x01, 0x0d, 0x40, 0xc5, 0xc1, 0xb0, 0x22, 0x0c, 0x1a, 0x41, 0xe5, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 
+	0x00, 0x15, 0x00, 0x02, 0x08, 0x42, 0x2f, 0x1c, 0x0e, 0x01, 0x1c, 0x01, 0x20, 0x41, 0x15, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
+	0x3f, 0x00, 0x3f, 0x00, 0x13, 0x00, 0x43, 0x17, 0xd0, 0x24, 0x21, 0x01, 0x11, 0x01, 0x1b, 0x05, 0x11, 0x40, 0x21, 0x3f, 0x00, 0x3f, 0x00, 0x3b, 
+	0x00, 0x43, 0x83, 0x24, 0x23, 0x0a, 0x0e, 0x00, 0x41, 0x24, 0x83, 0x06, 0x00, 0x41, 0x17, 0x23, 0x01, 0x21, 0x07, 0x11, 0x40, 0x18, 0x0d, 0x00, 
+	0x41, 0x0a, 0x0f, 0x01, 0x2b, 0x42, 0x4b, 0x32, 0x11, 0x1a, 0x00, 0x44, 0x17, 0x28, 0x13, 0x0b, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x05, 
+	0x04, 0x40, 0x25, 0x3f, 0x00, 0x3f, 0x00, 0x39, 0x00, 0x41, 0x1d, 0x04, 0x01, 0x01, 0x41, 0x1f, 0x0a, 0x0c, 0x00, 0x43, 0x2a, 0x04, 0x0b, 0x15, 
+	0x02, 0x00, 0x43, 0x08, 0x19, 0x13, 0x0b, 0x02, 0x01, 0x08, 0x04, 0x40, 0x32, 0x0c, 0x00, 0x40, 0x9e, 0x04, 0x01, 0x41, 0x0b, 0x18, 0x18, 0x00, 
+	0x41, 0x25, 0x16, 0x0f, 0x01, 0x41, 0x04, 0x24, 0x3f, 0x00, 0x3f, 0x00, 0x39, 0x00, 0x40, 0x13, 0x02, 0x01, 0x41, 0x16, 0x08, 0x0c, 0x00, 0x43, 
+	0x1f, 0x01, 0x0b, 0x08, 0x01, 0x00, 0x41, 0x08, 0x4b, 0x0e, 0x01, 0x40, 0x44, 0x0b, 0x00, 0x40, 0x30, 0x06, 0x01, 0x40, 0x19, 0x17, 0x00, 0x41, 
+	0x19, 0x04, 0x03, 0x01, 0x43, 0x93, 0x2a, 0x25, 0x37, 0x01, 0x9c, 0x02, 0x25, 0x03, 0x9c, 0x40, 0x24, 0x3f, 0x00, 0x3f, 0x00, 0x39, 0x00, 0x41, 
+	0x0a, 0x04, 0x02, 0x01, 0x40, 0x2b, 0x0c, 0x00, 0x43, 0x15, 0x04, 0x01, 0x13, 0x02, 0x00, 0x40, 0x0f, 0x03, 0x01, 0x43, 0x12, 0x2a, 0x9c, 0x37, 
+	0x06, 0xb1, 0x41, 0x1b, 0x08, 0x0a, 0x00, 0x41, 0x0a, 0x1f, 0x06, 0x01, 0x40, 0x32, 0x16, 0x00, 0x41, 0x24, 0x04, 0x02, 0x01, 0x42, 0x04, 0x28, 
+	0x08, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x06, 0x00, 0x40, 0x21, 0x03, 0x01, 0x40, 0x0f, 0x0c, 0x00, 0x40, 0x11, 0x01, 0x01, 0x40, 0x32, 0x01, 
+	0x00, 0x41, 0x17, 0x0b, 0x02, 0x01, 0x41, 0x10, 0x17, 0x16, 0x00, 0x40, 0x28, 0x07, 0x01, 0x40, 0x2b, 0x16, 0x00, 0x40, 0x36, 0x03, 0x01, 0x40, 
+	0x1d, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x08, 0x00, 0x40, 0x19, 0x03, 0x01, 0x40, 0x30, 0x0c, 0x00, 0x40, 0x1d, 0x01, 0x01, 0x40, 0x19, 0x01, 
+	0x00, 0x40, 0x86, 0x02, 0x01, 0x41, 0x0b, 0xd0, 0x16, 0x00, 0x41, 0x17, 0x0b, 0x01, 0x01, 0x01, 0x0b, 0x03, 0x01, 0x40, 0x16, 0x15, 0x00, 0x41, 
+	0x3b, 0x04, 0x02, 0x01, 0x40, 0x2b, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x09, 0x00, 0x40, 0x32, 0x02, 0x01, 0x41, 0x04, 0x23, 0x0c, 0x00, 0x40, 
+	0x34, 0x01, 0x01, 0x40, 0x21, 0x01, 0x00, 0x40, 0x36, 0x02, 0x01, 0x40, 0x34, 0x17, 0x00, 0x40, 0x32, 0x01, 0x01, 0x42, 0x13, 0x83, 0x25, 0x03, 
+	0x01, 0x41, 0x04, 0x3b, 0x14, 0x00, 0x40, 0x51, 0x03, 0x01, 0x40, 0x25, 0x14, 0x00, 0x40, 0x08, 0x07, 0x1a, 0x40, 0x17, 0x05, 0x00, 0x42, 0x3b, 
+	0x11, 0x25, 0x03, 0x90, 0x43, 0x30, 0x37, 0x23, 0x08, 0x09, 0x00, 0x41, 0x18, 0x1b, 0x01, 0x25, 0x02, 0x30, 0x01, 0x25, 0x41, 0x24, 0x08, 0x06, 
+	0x00, 0x40, 0x0a, 0x0a, 0x1a, 0x41, 0x3b, 0x08, 0x06, 0x00, 0x40, 0x0a, 0x0b, 0x1a, 0x41, 0x24, 0x17, 0x09, 0x00, 0x42, 0x08, 0x0a, 0x18, 0x01, 
+	0x1a, 0x41, 0x18, 0x3b, 0x01, 0x0a, 0x40, 0x08, 0x06, 0x00, 0x40, 0x08, 0x0a, 0x00, 0x01, 0x08, 0x10, 0x00, 0x43, 0x08, 0x24, 0x37, 0x25, 0x02, 
+	0x90, 0x43, 0x30, 0x25, 0x11, 0x0a, 0x07, 0x00, 0x40, 0x3b, 0x07, 0x1a, 0x40, 0x08, 0x02, 0x00, 0x40, 0x13, 0x02, 0x01, 0x41, 0x16, 0x08, 0x0c, 
+	0x00, 0x46, 0x22, 0x01, 0x0b, 0x1c, 0x00, 0x08, 0x16, 0x02, 0x01, 0x40, 0x1d, 0x16, 0x00, 0x47, 0x23, 0x04, 0x01, 0x1f, 0x17, 0x00, 0x08, 0x22, 
+	0x03, 0x01, 0x40, 0x11, 0x14, 0x00, 0x40, 0x32, 0x02, 0x01, 0x41, 0x04, 0x17, 0x13, 0x00, 0x42, 0x18, 0x1f, 0x01, 0x06, 0x04, 0x40, 0x4b, 0x03, 
+	0x00, 0x42, 0x25, 0x13, 0x04, 0x07, 0x01, 0x42, 0x04, 0x1f, 0x3c, 0x06, 0x00, 0x42, 0x30, 0x13, 0x04, 0x08, 0x01, 0x41, 0x1f, 0xf4, 0x04, 0x00, 
+	0x41, 0x25, 0x0b, 0x0b, 0x04, 0x42, 0x12, 0x32, 0x17, 0x03, 0x00, 0x41, 0xd0, 0x12, 0x08, 0x04, 0x01, 0x01, 0x02, 0x04, 0x40, 0x33, 0x05, 0x00, 
+	0x44, 0x8e, 0x1d, 0x36, 0x12, 0x04, 0x04, 0x01, 0x01, 0x04, 0x42, 0x0b, 0x10, 0x19, 0x02, 0x00, 0x44, 0x3c, 0x22, 0x12, 0x35, 0x0a, 0x06, 0x00, 
+	0x41, 0x19, 0x13, 0x01, 0x12, 0x41, 0x1f, 0x28, 0x07, 0x00, 0x42, 0x0f, 0x36, 0x08, 0x01, 0x00, 0x43, 0x83, 0x33, 0x0b, 0x04, 0x07, 0x01, 0x42, 
+	0x0b, 0x34, 0x17, 0x04, 0x00, 0x40, 0x87, 0x08, 0x04, 0x40, 0x2b, 0x01, 0x00, 0x41, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x2b, 0x0c, 0x00, 0x43, 0x17, 
+	0x04, 0x01, 0x13, 0x01, 0x00, 0x41, 0x18, 0x04, 0x02, 0x01, 0x40, 0x2a, 0x16, 0x00, 0x40, 0x35, 0x01, 0x01, 0x40, 0x25, 0x02, 0x00, 0x40, 0x0f, 
+	0x03, 0x01, 0x40, 0x19, 0x14, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0x93, 0x14, 0x00, 0x40, 0x32, 0x06, 0x01, 0x42, 0x04, 0x16, 0x1d, 0x02, 0x00, 
+	0x40, 0x0f, 0x03, 0x01, 0x05, 0x04, 0x03, 0x01, 0x40, 0x19, 0x04, 0x00, 0x40, 0x9d, 0x03, 0x01, 0x05, 0x04, 0x02, 0x01, 0x41, 0x04, 0x30, 0x03, 
+	0x00, 0x40, 0xd8, 0x05, 0x01, 0x42, 0x04, 0x0b, 0x04, 0x05, 0x01, 0x41, 0x1f, 0x8e, 0x02, 0x00, 0x40, 0x2a, 0x06, 0x01, 0x02, 0x04, 0x05, 0x01, 
+	0x40, 0x3c, 0x03, 0x00, 0x41, 0x24, 0x12, 0x04, 0x01, 0x02, 0x04, 0x05, 0x01, 0x40, 0x28, 0x01, 0x00, 0x40, 0x12, 0x02, 0x01, 0x40, 0x1b, 0x05, 
+	0x00, 0x41, 0x1b, 0x04, 0x03, 0x01, 0x40, 0x16, 0x06, 0x00, 0x42, 0x51, 0x01, 0x22, 0x01, 0x00, 0x41, 0xbe, 0x12, 0x03, 0x01, 0x04, 0x04, 0x03, 
+	0x01, 0x40, 0x10, 0x03, 0x00, 0x40, 0x11, 0x06, 0x01, 0x43, 0x04, 0x0b, 0x12, 0x44, 0x01, 0x00, 0x40, 0x21, 0x03, 0x01, 0x40, 0x44, 0x0c, 0x00, 
+	0x40, 0x11, 0x01, 0x01, 0x40, 0x33, 0x01, 0x00, 0x40, 0x21, 0x03, 0x01, 0x40, 0x10, 0x15, 0x00, 0x43, 0x11, 0x04, 0x01, 0x36, 0x03, 0x00, 0x40, 
+	0x1b, 0x03, 0x01, 0x40, 0x44, 0x13, 0x00, 0x41, 0x08, 0x0b, 0x02, 0x01, 0x40, 0x34, 0x14, 0x00, 0x40, 0x13, 0x04, 0x01, 0x43, 0x2b, 0x1b, 0x17, 
+	0x08, 0x02, 0x00, 0x40, 0xf4, 0x02, 0x01, 0x43, 0x2b, 0x1b, 0x3b, 0x8e, 0x02, 0x0a, 0x42, 0x18, 0x1d, 0x04, 0x01, 0x01, 0x40, 0x1f, 0x03, 0x00, 
+	0x40, 0x3c, 0x02, 0x01, 0x42, 0x10, 0x37, 0x17, 0x01, 0x0a, 0x44, 0x17, 0x8e, 0x18, 0x28, 0x04, 0x01, 0x01, 0x40, 0x93, 0x02, 0x00, 0x41, 0x1c, 
+	0x04, 0x03, 0x01, 0x42, 0x0b, 0x0f, 0x24, 0x01, 0x0a, 0x42, 0x1b, 0x33, 0x04, 0x03, 0x01, 0x40, 0x28, 0x02, 0x00, 0x40, 0x36, 0x03, 0x01, 0x48, 
+	0x16, 0x2a, 0x11, 0x18, 0x17, 0x18, 0x11, 0x0f, 0x04, 0x02, 0x01, 0x40, 0x2b, 0x02, 0x00, 0x41, 0x0a, 0x1f, 0x02, 0x01, 0x47, 0x16, 0x1d, 0x24, 
+	0x8e, 0x0a, 0x3b, 0x1b, 0x87, 0x03, 0x01, 0x40, 0x13, 0x01, 0x00, 0x40, 0x12, 0x02, 0x01, 0x40, 0x37, 0x05, 0x00, 0x40, 0x4b, 0x04, 0x01, 0x41, 
+	0x04, 0x1c, 0x05, 0x00, 0x45, 0x10, 0x01, 0x86, 0x00, 0x17, 0x12, 0x01, 0x01, 0x43, 0x04, 0x2a, 0x23, 0x17, 0x02, 0x0a, 0x42, 0x17, 0x21, 0x10, 
+	0x02, 0x01, 0x40, 0x37, 0x02, 0x00, 0x40, 0x1d, 0x04, 0x01, 0x44, 0x16, 0x19, 0x3b, 0x0a, 0x08, 0x02, 0x00, 0x40, 0x19, 0x03, 0x01, 0x40, 0xf4, 
+	0x0c, 0x00, 0x40, 0x3c, 0x01, 0x01, 0x40, 0x19, 0x01, 0x00, 0xc0, 0x22, 0x11, 0x04, 0x01, 0x41, 0x2a, 0x08, 0x13, 0x00, 0x43, 0x2b, 0x01, 0x04, 
+	0x21, 0x03, 0x00, 0x41, 0x0a, 0x04, 0x02, 0x01, 0x40, 0x36, 0x13, 0x00, 0x40, 0x24, 0x03, 0x01, 0x40, 0x86, 0x13, 0x00, 0x41, 0x08, 0x0b, 0x03, 
+	0x01, 0x41, 0x87, 0x08, 0x04, 0x00, 0x41, 0x0a, 0x12, 0x01, 0x01, 0x41, 0x1f, 0x0a, 0x07, 0x00, 0x40, 0x10, 0x01, 0x01, 0x41, 0x04, 0x23, 0x01, 
+	0x00, 0x41, 0x83, 0x16, 0x01, 0x01, 0x41, 0x13, 0x0a, 0x07, 0x00, 0x40, 0x22, 0x01, 0x01, 0x41, 0x04, 0x3b, 0x01, 0x00, 0x40, 0x11, 0x03, 0x01, 
+	0x41, 0x12, 0xbe, 0x05, 0x00, 0x41, 0x30, 0x04, 0x02, 0x01, 0x40, 0x35, 0x01, 0x00, 0x41, 0x08, 0x12, 0x02, 0x01, 0x41, 0x16, 0x23, 0x06, 0x00, 
+	0x40, 0x0f, 0x02, 0x01, 0x40, 0x12, 0x02, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x41, 0x12, 0x18, 0x06, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0xd8, 0x01, 
+	0x00, 0x40, 0x1f, 0x02, 0x01, 0x40, 0x37, 0x04, 0x00, 0x41, 0x18, 0x04, 0x04, 0x01, 0x41, 0x04, 0x3b, 0x04, 0x00, 0x45, 0x24, 0x04, 0x0b, 0x17, 
+	0x00, 0x33, 0x02, 0x01, 0x40, 0x86, 0x07, 0x00, 0x40, 0x1b, 0x02, 0x01, 0x40, 0x0f, 0x02, 0x00, 0x40, 0x34, 0x03, 0x01, 0x41, 0x12, 0x23, 0x06, 
+	0x00, 0x40, 0x33, 0x03, 0x01, 0x40, 0x24, 0x0c, 0x00, 0x40, 0x33, 0x01, 0x01, 0x40, 0x21, 0x01, 0x00, 0x40, 0x24, 0x05, 0x01, 0x41, 0x1f, 0x34, 
+	0x05, 0x44, 0x42, 0x2a, 0x25, 0x08, 0x08, 0x00, 0xc0, 0x63, 0x09, 0x01, 0x01, 0x40, 0x4b, 0x05, 0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x1f, 0x13, 
+	0x00, 0x40, 0x51, 0x03, 0x01, 0x40, 0x11, 0x04, 0x00, 0x41, 0xbe, 0x2a, 0x08, 0x0f, 0x40, 0x37, 0x02, 0x00, 0x40, 0x24, 0x03, 0x01, 0x41, 0x10, 
+	0x08, 0x05, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x1d, 0x08, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0x37, 0x01, 0x00, 0x40, 0x28, 0x02, 0x01, 0x40, 
+	0x19, 0x08, 0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x11, 0x01, 0x00, 0x40, 0x3c, 0x02, 0x01, 0x41, 0x04, 0x1b, 0x07, 0x00, 0x40, 0x13, 0x02, 0x01, 
+	0x40, 0x35, 0x01, 0x00, 0x41, 0x18, 0x04, 0x02, 0x01, 0x40, 0x51, 0x07, 0x00, 0x40, 0x1b, 0x02, 0x01, 0x41, 0x16, 0x08, 0x01, 0x00, 0x40, 0x1f, 
+	0x02, 0x01, 0x40, 0x30, 0x07, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x40, 0x2b, 0x01, 0x00, 0x40, 0xd8, 0x02, 0x01, 0x40, 0x37, 0x04, 0x00, 0x40, 0x9d, 
+	0x05, 0x01, 0x41, 0x04, 0x1a, 0x04, 0x00, 0x45, 0x44, 0x01, 0x32, 0x00, 0x83, 0x0b, 0x01, 0x01, 0x41, 0x16, 0x08, 0x07, 0x00, 0x40, 0x11, 0x02, 
+	0x01, 0x40, 0x4b, 0x02, 0x00, 0x40, 0x1f, 0x02, 0x01, 0x41, 0x0b, 0x24, 0x07, 0x00, 0x40, 0x13, 0x02, 0x01, 0x41, 0x0b, 0x08, 0x0c, 0x00, 0x43, 
+	0x22, 0x01, 0x0b, 0x0a, 0x01, 0x00, 0x41, 0x0a, 0x0b, 0x0e, 0x01, 0x41, 0x13, 0x8e, 0x06, 0x00, 0x44, 0x08, 0x13, 0x01, 0x04, 0x21, 0x05, 0x00, 
+	0x40, 0x35, 0x02, 0x01, 0x41, 0x04, 0x8e, 0x12, 0x00, 0x40, 0x44, 0x02, 0x01, 0x41, 0x04, 0x1c, 0x03, 0x00, 0x41, 0x08, 0x12, 0x09, 0x01, 0x40, 
+	0x22, 0x02, 0x00, 0x40, 0x19, 0x02, 0x01, 0x41, 0x04, 0x21, 0x06, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x1b, 0x07, 0x00, 0x41, 0x08, 0x0b, 0x02, 
+	0x01, 0x40, 0x25, 0x01, 0x00, 0x40, 0x1f, 0x02, 0x01, 0x40, 0x11, 0x07, 0x00, 0x41, 0x17, 0x0b, 0x02, 0x01, 0x40, 0x1b, 0x01, 0x00, 0x40, 0x33, 
+	0x02, 0x01, 0x40, 0x2b, 0x08, 0x00, 0x40, 0x4b, 0x02, 0x01, 0x40, 0x44, 0x01, 0x00, 0x40, 0x25, 0x02, 0x01, 0x41, 0x0b, 0x0a, 0x07, 0x00, 0x40, 
+	0x1b, 0x02, 0x01, 0x40, 0x12, 0x01, 0x00, 0x41, 0x21, 0x04, 0x01, 0x01, 0x41, 0x12, 0x08, 0x07, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x40, 0x79, 0x01, 
+	0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0xb1, 0x03, 0x00, 0x44, 0x0a, 0x16, 0x01, 0x16, 0x22, 0x03, 0x01, 0x40, 0x21, 0x03, 0x00, 0x45, 0x08, 0x16, 
+	0x04, 0x24, 0x00, 0x19, 0x02, 0x01, 0x40, 0x10, 0x08, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x4b, 0x01, 0x00, 0x41, 0x15, 0x04, 0x02, 0x01, 0x40, 
+	0x0f, 0x07, 0x00, 0x41, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x10, 0x0c, 0x00, 0x43, 0x17, 0x0b, 0x01, 0x13, 0x03, 0x00, 0x40, 0x0f, 0x0f, 0x01, 0x40, 
+	0x32, 0x06, 0x00, 0x40, 0x19, 0x01, 0x01, 0x40, 0x9e, 0x06, 0x00, 0x40, 0x0f, 0x03, 0x01, 0x40, 0x21, 0x12, 0x00, 0x40, 0x2b, 0x02, 0x01, 0x40, 
+	0x22, 0x05, 0x00, 0x40, 0x4b, 0x03, 0x22, 0x41, 0x12, 0x04, 0x03, 0x01, 0x40, 0x10, 0x02, 0x00, 0x40, 0x32, 0x02, 0x01, 0x40, 0x13, 0x06, 0x00, 
+	0x41, 0x23, 0x04, 0x02, 0x01, 0x40, 0x37, 0x07, 0x00, 0x40, 0x3c, 0x03, 0x01, 0x43, 0x11, 0x00, 0x21, 0x04, 0x02, 0x01, 0x40, 0x11, 0x07, 0x00, 
+	0x40, 0x1d, 0x02, 0x01, 0x41, 0x04, 0xbe, 0x01, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x28, 0x08, 0x00, 0x40, 0x1f, 0x02, 0x01, 0x40, 0x19, 0x01, 
+	0x00, 0x40, 0x2a, 0x02, 0x01, 0x40, 0x2b, 0x08, 0x00, 0x40, 0x19, 0x02, 0x01, 0x40, 0x13, 0x01, 0x00, 0x40, 0x86, 0x02, 0x01, 0x40, 0x34, 0x08, 
+	0x00, 0x40, 0xe9, 0x02, 0x01, 0x40, 0x2a, 0x01, 0x00, 0x40, 0x36, 0x02, 0x01, 0x40, 0x11, 0x03, 0x00, 0x45, 0x19, 0x01, 0x16, 0xbe, 0x0a, 0x12, 
+	0x02, 0x01, 0x40, 0x1b, 0x03, 0x00, 0x42, 0x30, 0x01, 0x2b, 0x01, 0x00, 0x40, 0x35, 0x02, 0x01, 0x40, 0x13, 0x07, 0x00, 0x41, 0x0a, 0x93, 0x02, 
+	0x01, 0x40, 0x33, 0x01, 0x00, 0x40, 0x11, 0x02, 0x01, 0x41, 0x04, 0x18, 0x07, 0x00, 0x40, 0x21, 0x03, 0x01, 0x40, 0x32, 0x0c, 0x00, 0x40, 0x11, 
+	0x01, 0x01, 0x40, 0x33, 0x03, 0x00, 0x43, 0x08, 0x9d, 0x0b, 0x04, 0x0c, 0x01, 0x40, 0x1f, 0x05, 0x00, 0x44, 0x0a, 0x1f, 0x01, 0x04, 0x21, 0x06, 
+	0x00, 0x40, 0x1d, 0x03, 0x01, 0x40, 0x51, 0x11, 0x00, 0x41, 0x08, 0x16, 0x02, 0x01, 0x40, 0x34, 0x0b, 0x00, 0x41, 0x24, 0x16, 0x02, 0x01, 0x40, 
+	0x32, 0x02, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0x0f, 0x06, 0x00, 0x40, 0x3c, 0x03, 0x01, 0x41, 0x2b, 0x18, 0x04, 0x00, 0x42, 0x15, 0x3c, 0x04, 
+	0x02, 0x01, 0x43, 0x04, 0x17, 0x00, 0x28, 0x03, 0x01, 0x42, 0x87, 0x3b, 0x08, 0x02, 0x00, 0x43, 0x08, 0x15, 0x19, 0x04, 0x02, 0x01, 0x44, 0x0b, 
+	0x0a, 0x00, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x1b, 0x07, 0x00, 0x41, 0x15, 0x04, 0x02, 0x01, 0x40, 0x21, 0x01, 0x00, 0x40, 0x4b, 0x02, 0x01, 0x40, 
+	0x0f, 0x08, 0x00, 0x40, 0x32, 0x02, 0x01, 0x40, 0x35, 0x01, 0x00, 0x40, 0x35, 0x02, 0x01, 0x40, 0x3c, 0x08, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 
+	0x30, 0x01, 0x00, 0x40, 0x9e, 0x02, 0x01, 0x40, 0x37, 0x03, 0x00, 0x42, 0x93, 0x01, 0x30, 0x01, 0x00, 0x40, 0x32, 0x02, 0x01, 0x40, 0x9c, 0x03, 
+	0x00, 0x45, 0x36, 0x01, 0x30, 0x00, 0x08, 0x16, 0x02, 0x01, 0x42, 0x04, 0x51, 0x0a, 0x04, 0x00, 0x41, 0x24, 0x36, 0x03, 0x01, 0x40, 0x1d, 0x01, 
+	0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x1f, 0x08, 0x00, 0x40, 0x19, 0x03, 0x01, 0x40, 0x19, 0x0c, 0x00, 0x40, 0x3c, 0x01, 0x01, 0x40, 0x3c, 0x05, 
+	0x00, 0x42, 0x0a, 0x24, 0x1b, 0x03, 0xf6, 0x43, 0x1b, 0x9c, 0x9d, 0x0b, 0x03, 0x01, 0x41, 0x0b, 0x08, 0x04, 0x00, 0x40, 0x28, 0x01, 0x01, 0x40, 
+	0x22, 0x07, 0x00, 0x40, 0x0f, 0x03, 0x01, 0x40, 0x0f, 0x11, 0x00, 0x41, 0x23, 0x04, 0x02, 0x01, 0x40, 0x1d, 0x0c, 0x00, 0x40, 0x35, 0x02, 0x01, 
+	0x40, 0x19, 0x01, 0x00, 0x41, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x30, 0x06, 0x00, 0x40, 0x35, 0x04, 0x01, 0x42, 0x04, 0x16, 0x1f, 0x01, 0x22, 0x41, 
+	0x12, 0x0b, 0x04, 0x01, 0x40, 0x36, 0x01, 0x00, 0x40, 0x36, 0x04, 0x01, 0x41, 0x04, 0x0b, 0x02, 0x16, 0x41, 0x0b, 0x04, 0x04, 0x01, 0x40, 0x35, 
+	0x01, 0x00, 0x40, 0x21, 0x02, 0x01, 0x41, 0x04, 0x15, 0x07, 0x00, 0x40, 0x1b, 0x02, 0x01, 0x41, 0x0b, 0x0a, 0x01, 0x00, 0x40, 0x12, 0x02, 0x01, 
+	0x40, 0x25, 0x08, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0x28, 0x01, 0x00, 0x40, 0x12, 0x02, 0x01, 0x40, 0x11, 0x07, 0x00, 0x41, 0x08, 0x16, 0x01, 
+	0x01, 0x41, 0x04, 0x23, 0x01, 0x00, 0x40, 0x34, 0x02, 0x01, 0x40, 0x25, 0x02, 0x00, 0x42, 0x1b, 0x01, 0x10, 0x02, 0x00, 0x40, 0x19, 0x02, 0x01, 
+	0x40, 0x51, 0x02, 0x00, 0x45, 0x23, 0x04, 0x12, 0x08, 0x00, 0x21, 0x05, 0x01, 0x46, 0x0b, 0x12, 0x22, 0x1f, 0x12, 0x16, 0x04, 0x03, 0x01, 0x41, 
+	0x04, 0x23, 0x01, 0x00, 0x40, 0x34, 0x02, 0x01, 0x40, 0x35, 0x08, 0x00, 0x40, 0x33, 0x02, 0x01, 0x41, 0x04, 0x24, 0x0c, 0x00, 0x40, 0x33, 0x01, 
+	0x01, 0x40, 0x21, 0x0f, 0x00, 0xc0, 0x63, 0x09, 0x40, 0x04, 0x02, 0x01, 0x41, 0x0b, 0x08, 0x03, 0x00, 0x41, 0x17, 0x16, 0x01, 0x01, 0x40, 0x22, 
+	0x06, 0x00, 0x41, 0x83, 0x12, 0x03, 0x01, 0x40, 0x35, 0x11, 0x00, 0x40, 0x90, 0x03, 0x01, 0x40, 0x1b, 0x0c, 0x00, 0x40, 0x35, 0x01, 0x01, 0x41, 
+	0x04, 0x24, 0x01, 0x00, 0x41, 0x24, 0x04, 0x01, 0x01, 0x41, 0x04, 0x23, 0x06, 0x00, 0x40, 0x1f, 0x03, 0x01, 0x41, 0x04, 0x22, 0x09, 0x10, 0x41, 
+	0x4b, 0x23, 0x01, 0x00, 0x40, 0x16, 0x03, 0x01, 0x41, 0x04, 0x22, 0x09, 0x10, 0x41, 0x4b, 0xd0, 0x01, 0x00, 0x40, 0x3c, 0x02, 0x01, 0x40, 0x1f, 
+	0x08, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x13, 0x01, 0x00, 0x41, 0x3b, 0x04, 0x01, 0x01, 0x41, 0x04, 0x18, 0x07, 0x00, 0x41, 0x08, 0x16, 0x02, 
+	0x01, 0x43, 0x1b, 0x00, 0x3b, 0x04, 0x01, 0x01, 0x41, 0x04, 0x0a, 0x07, 0x00, 0x41, 0x23, 0x04, 0x01, 0x01, 0x41, 0x16, 0x08, 0x01, 0x00, 0x40, 
+	0xe9, 0x02, 0x01, 0x40, 0x19, 0x02, 0x00, 0x42, 0x4b, 0x01, 0x25, 0x02, 0x00, 0x40, 0x25, 0x02, 0x01, 0x40, 0x3c, 0x02, 0x00, 0x42, 0x0f, 0x01, 
+	0x2a, 0x01, 0x00, 0x40, 0x86, 0x04, 0x01, 0x40, 0x16, 0x01, 0x10, 0x01, 0x13, 0x06, 0x10, 0x40, 0x19, 0x02, 0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 
+	0x28, 0x08, 0x00, 0x40, 0x13, 0x02, 0x01, 0x41, 0x0b, 0x0a, 0x0c, 0x00, 0x43, 0x13, 0x01, 0x04, 0x0a, 0x10, 0x00, 0x40, 0x13, 0x02, 0x01, 0x41, 
+	0x16, 0x08, 0x03, 0x00, 0x40, 0x44, 0x03, 0x01, 0x47, 0x34, 0x37, 0x21, 0x11, 0x21, 0x1b, 0x1d, 0x1f, 0x04, 0x01, 0x40, 0x22, 0x11, 0x00, 0x40, 
+	0x9d, 0x02, 0x01, 0x41, 0x04, 0x3b, 0x0c, 0x00, 0x40, 0x10, 0x01, 0x01, 0x41, 0x12, 0x08, 0x01, 0x00, 0x40, 0x51, 0x02, 0x01, 0x41, 0x16, 0x08, 
+	0x05, 0x00, 0x41, 0x3b, 0x04, 0x02, 0x01, 0x41, 0x16, 0x11, 0x0d, 0x00, 0x41, 0x18, 0x04, 0x02, 0x01, 0x41, 0x12, 0x11, 0x0e, 0x00, 0x40, 0x33, 
+	0x02, 0x01, 0x40, 0x34, 0x08, 0x00, 0x40, 0x34, 0x02, 0x01, 0x40, 0x33, 0x01, 0x00, 0x40, 0x37, 0x02, 0x01, 0x41, 0x12, 0x08, 0x07, 0x00, 0x41, 
+	0x1a, 0x04, 0x01, 0x01, 0x43, 0x0b, 0x0a, 0x00, 0x25, 0x02, 0x01, 0x40, 0x13, 0x08, 0x00, 0x40, 0x30, 0x02, 0x01, 0x40, 0x36, 0x02, 0x00, 0xc0, 
+	0xc5, 0x1a, 0x02, 0x01, 0x40, 0x28, 0x01, 0x00, 0x43, 0xbe, 0x04, 0x93, 0x08, 0x02, 0x00, 0x40, 0x11, 0x02, 0x01, 0x40, 0x2a, 0x01, 0x00, 0x43, 
+	0x17, 0x16, 0x04, 0x3b, 0x01, 0x00, 0x40, 0x79, 0x03, 0x01, 0x41, 0x0f, 0x08, 0x0d, 0x00, 0x41, 0x17, 0x04, 0x02, 0x01, 0x40, 0x37, 0x07, 0x00, 
+	0x41, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x13, 0x0c, 0x00, 0x43, 0x08, 0x0b, 0x01, 0x22, 0x11, 0x00, 0x40, 0x4b, 0x02, 0x01, 0x40, 0x13, 0x03, 0x00, 
+	0x41, 0x18, 0x04, 0x10, 0x01, 0x41, 0x0b, 0x1c, 0x10, 0x00, 0x40, 0x2b, 0x02, 0x01, 0x40, 0x12, 0x0c, 0x00, 0x41, 0x1c, 0x0b, 0x01, 0x01, 0x40, 
+	0x34, 0x02, 0x00, 0x40, 0x44, 0x02, 0x01, 0x40, 0x36, 0x06, 0x00, 0x40, 0x1b, 0x02, 0x01, 0x41, 0x04, 0x25, 0x0e, 0x00, 0x40, 0x37, 0x02, 0x01, 
+	0x41, 0x04, 0x1b, 0x0f, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x1d, 0x08, 0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x19, 0x01, 0x00, 0x40, 0x28, 0x02, 
+	0x01, 0x40, 0x36, 0x08, 0x00, 0x40, 0x30, 0x02, 0x01, 0x40, 0x36, 0x01, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x40, 0x34, 0x08, 0x00, 0x40, 0x0f, 0x02, 
+	0x01, 0x40, 0x28, 0x02, 0x00, 0x40, 0x44, 0x02, 0x01, 0x40, 0x34, 0x01, 0x00, 0x42, 0x35, 0x01, 0x86, 0x03, 0x00, 0x40, 0x24, 0x02, 0x01, 0x40, 
+	0x4b, 0x01, 0x00, 0x42, 0x9e, 0x01, 0x35, 0x02, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x4b, 0x0f, 0x00, 0x40, 0x11, 0x02, 0x01, 0x41, 0x04, 0x3b, 
+	0x07, 0x00, 0x40, 0x21, 0x03, 0x01, 0x40, 0x33, 0x0c, 0x00, 0x40, 0x21, 0x01, 0x01, 0x40, 0x33, 0x11, 0x00, 0x40, 0x2b, 0x02, 0x01, 0x40, 0x79, 
+	0x03, 0x00, 0x40, 0x34, 0x03, 0x01, 0x08, 0x04, 0x04, 0x01, 0x41, 0x04, 0x23, 0x10, 0x00, 0x40, 0x12, 0x02, 0x01, 0x40, 0x22, 0x0c, 0x00, 0x40, 
+	0x19, 0x02, 0x01, 0x40, 0x37, 0x02, 0x00, 0x40, 0x2b, 0x02, 0x01, 0x40, 0x0f, 0x06, 0x00, 0x40, 0x19, 0x02, 0x01, 0x40, 0x13, 0x0f, 0x00, 0x40, 
+	0x19, 0x02, 0x01, 0x40, 0x10, 0x0f, 0x00, 0x41, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x1b, 0x07, 0x00, 0x41, 0x0a, 0x04, 0x02, 0x01, 0x40, 0x21, 0x01, 
+	0x00, 0x40, 0x35, 0x02, 0x01, 0x40, 0x0f, 0x08, 0x00, 0x40, 0x9d, 0x02, 0x01, 0x40, 0x19, 0x01, 0x00, 0x40, 0x9e, 0x02, 0x01, 0x40, 0x28, 0x08, 
+	0x00, 0x40, 0x2b, 0x02, 0x01, 0x40, 0x1b, 0x02, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x45, 0x04, 0x51, 0x33, 0x01, 0x0b, 0x17, 0x03, 0x00, 0x40, 0xf3, 
+	0x02, 0x01, 0x42, 0x04, 0x0f, 0x4b, 0x01, 0x01, 0x40, 0x1b, 0x02, 0x00, 0x40, 0x0b, 0x02, 0x01, 0x40, 0x11, 0x0f, 0x00, 0x40, 0x3c, 0x02, 0x01, 
+	0x40, 0x12, 0x08, 0x00, 0x40, 0x19, 0x03, 0x01, 0x40, 0x1d, 0x0c, 0x00, 0x40, 0x1d, 0x01, 0x01, 0x40, 0x1d, 0x10, 0x00, 0x41, 0x08, 0x12, 0x02, 
+	0x01, 0x40, 0x19, 0x02, 0x00, 0x45, 0x21, 0x04, 0x01, 0x04, 0x33, 0x24, 0x07, 0x17, 0x42, 0x83, 0x19, 0x0b, 0x03, 0x01, 0x40, 0x25, 0x10, 0x00, 
+	0x40, 0x16, 0x02, 0x01, 0x41, 0x16, 0x0a, 0x0a, 0x00, 0x41, 0x0a, 0x1f, 0x01, 0x01, 0x41, 0x12, 0x08, 0x01, 0x00, 0x41, 0x08, 0x16, 0x02, 0x01, 
+	0x40, 0x30, 0x06, 0x00, 0x40, 0x28, 0x02, 0x01, 0x40, 0x32, 0x0f, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x40, 0x0f, 0x0f, 0x00, 0x40, 0x21, 0x02, 0x01, 
+	0x41, 0x04, 0x15, 0x07, 0x00, 0x40, 0x11, 0x02, 0x01, 0x41, 0x04, 0x0a, 0x01, 0x00, 0x40, 0x12, 0x02, 0x01, 0x40, 0x3c, 0x08, 0x00, 0x40, 0x93, 
+	0x01, 0x01, 0x41, 0x04, 0x3b, 0x01, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0xf4, 0x07, 0x00, 0x41, 0x17, 0x04, 0x01, 0x01, 0x41, 0x0b, 0x0a, 0x02, 
+	0x00, 0x40, 0x28, 0x06, 0x01, 0x40, 0x32, 0x04, 0x00, 0x40, 0xf3, 0x06, 0x01, 0x40, 0x93, 0x02, 0x00, 0x41, 0x15, 0x04, 0x01, 0x01, 0x41, 0x0b, 
+	0x08, 0x0f, 0x00, 0x40, 0x33, 0x02, 0x01, 0x40, 0x4b, 0x08, 0x00, 0x40, 0x44, 0x03, 0x01, 0x40, 0x1d, 0x0b, 0x00, 0x44, 0x08, 0x22, 0x01, 0x04, 
+	0x21, 0x10, 0x00, 0x40, 0x1b, 0x02, 0x01, 0x41, 0x04, 0x3b, 0x02, 0x00, 0x40, 0x36, 0x01, 0x01, 0x40, 0x2a, 0x0b, 0x00, 0x40, 0x28, 0x03, 0x01, 
+	0x40, 0x28, 0x10, 0x00, 0x40, 0x2b, 0x03, 0x01, 0x40, 0x2a, 0x09, 0x00, 0x41, 0x08, 0x87, 0x02, 0x01, 0x40, 0x28, 0x02, 0x00, 0x41, 0x23, 0x04, 
+	0x01, 0x01, 0x41, 0x04, 0x23, 0x06, 0x00, 0x40, 0x28, 0x02, 0x01, 0x40, 0x0f, 0x0f, 0x00, 0x40, 0x0f, 0x02, 0x01, 0x40, 0x28, 0x0f, 0x00, 0x40, 
+	0x19, 0x02, 0x01, 0x40, 0x1f, 0x08, 0x00, 0x40, 0x3c, 0x02, 0x01, 0x40, 0x13, 0x01, 0x00, 0x41, 0x15, 0x04, 0x02, 0x01, 0x40, 0x1d, 0x07, 0x00, 
+	0x41, 0x1b, 0x04, 0x01, 0x01, 0x40, 0x9e, 0x02, 0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x19, 0x07, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x36, 0x03, 
+	0x00, 0x40, 0x3c, 0x05, 0x01, 0x41, 0x04, 0x24, 0x04, 0x00, 0x40, 0xf3, 0x06, 0x01, 0x40, 0x86, 0x02, 0x00, 0x41, 0x3b, 0x04, 0x01, 0x01, 0x40, 
+	0x16, 0x10, 0x00, 0x40, 0x93, 0x02, 0x01, 0x40, 0x2a, 0x08, 0x00, 0x40, 0x32, 0x03, 0x01, 0x41, 0x13, 0x08, 0x09, 0x00, 0x41, 0x08, 0x33, 0x01, 
+	0x01, 0x40, 0x13, 0x10, 0x00, 0x41, 0xd0, 0x1f, 0x02, 0x01, 0x40, 0x87, 0x02, 0x00, 0x43, 0x37, 0x04, 0x01, 0x2b, 0x0c, 0x00, 0x41, 0x24, 0x04, 
+	0x02, 0x01, 0x40, 0x34, 0x10, 0x00, 0x40, 0x19, 0x04, 0x01, 0x43, 0x35, 0x11, 0x0a, 0x08, 0x01, 0x00, 0x44, 0x08, 0x0a, 0x24, 0x19, 0x13, 0x02, 
+	0x01, 0x41, 0x1f, 0x0a, 0x02, 0x00, 0x40, 0x90, 0x02, 0x01, 0x41, 0x16, 0x08, 0x06, 0x00, 0x40, 0x19, 0x02, 0x01, 0x40, 0x36, 0x0f, 0x00, 0x40, 
+	0x86, 0x02, 0x01, 0x40, 0x35, 0x0f, 0x00, 0x40, 0x33, 0x02, 0x01, 0x40, 0x79, 0x08, 0x00, 0x40, 0x33, 0x02, 0x01, 0x40, 0x33, 0x01, 0x00, 0x40, 
+	0x1b, 0x03, 0x01, 0x41, 0x2b, 0x08, 0x05, 0x00, 0x41, 0xd0, 0x1f, 0x01, 0x01, 0x41, 0x0b, 0xbe, 0x02, 0x00, 0x40, 0x93, 0x02, 0x01, 0x40, 0x9e, 
+	0x06, 0x00, 0x41, 0x37, 0x0b, 0x02, 0x01, 0x40, 0x37, 0x03, 0x00, 0x40, 0x19, 0x05, 0x01, 0x40, 0x10, 0x05, 0x00, 0x40, 0xf3, 0x05, 0x01, 0x41, 
+	0x0b, 0x17, 0x02, 0x00, 0x41, 0x0a, 0x04, 0x01, 0x01, 0x41, 0x04, 0x18, 0x0e, 0x00, 0x41, 0x1c, 0x0b, 0x02, 0x01, 0x40, 0x37, 0x08, 0x00, 0x40, 
+	0x51, 0x04, 0x01, 0x40, 0x10, 0xc0, 0x63, 0x09, 0x40, 0x0a, 0x04, 0x00, 0x43, 0x08, 0x3b, 0x30, 0x13, 0x01, 0x01, 0x41, 0x04, 0x1b, 0x03, 0x00, 
+	0x0a, 0x08, 0x42, 0x23, 0x86, 0x16, 0x02, 0x01, 0x41, 0x04, 0x24, 0x02, 0x00, 0x43, 0x10, 0x01, 0x04, 0x24, 0x0c, 0x00, 0x41, 0x0a, 0x16, 0x02, 
+	0x01, 0x40, 0x13, 0x10, 0x00, 0x41, 0x08, 0x2b, 0x05, 0x01, 0x41, 0x04, 0x16, 0x01, 0x12, 0x40, 0x16, 0x01, 0x04, 0x03, 0x01, 0x41, 0x0b, 0x11, 
+	0x03, 0x00, 0x40, 0x0f, 0x02, 0x01, 0x40, 0x10, 0x07, 0x00, 0x41, 0x18, 0x0b, 0x02, 0x01, 0x41, 0x32, 0x1b, 0x01, 0x23, 0x06, 0x18, 0x04, 0x00, 
+	0x41, 0x23, 0x04, 0x01, 0x01, 0x42, 0x04, 0x9d, 0x11, 0x01, 0x23, 0x06, 0x18, 0x04, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x1d, 0x08, 0x00, 0x40, 
+	0x13, 0x02, 0x01, 0x40, 0x3c, 0x01, 0x00, 0x40, 0x1d, 0x04, 0x01, 0x47, 0x2b, 0x51, 0x21, 0x23, 0x21, 0x25, 0x0f, 0x16, 0x02, 0x01, 0x40, 0x3c, 
+	0x03, 0x00, 0x40, 0x34, 0x03, 0x01, 0x47, 0x9e, 0x30, 0x23, 0x18, 0x23, 0x25, 0x34, 0x04, 0x02, 0x01, 0x40, 0x87, 0x04, 0x00, 0x40, 0x51, 0x05, 
+	0x01, 0x40, 0x30, 0x05, 0x00, 0x41, 0x23, 0x04, 0x04, 0x01, 0x40, 0x44, 0x04, 0x00, 0x40, 0x9e, 0x02, 0x01, 0x43, 0x13, 0x51, 0x21, 0x23, 0x06, 
+	0x18, 0x40, 0x0a, 0x03, 0x00, 0x40, 0x21, 0x02, 0x01, 0x41, 0x04, 0x3b, 0x09, 0x00, 0x40, 0x87, 0x05, 0x01, 0x47, 0x04, 0x12, 0x13, 0x10, 0x2b, 
+	0x13, 0x12, 0x04, 0x02, 0x01, 0x41, 0x0b, 0x30, 0x03, 0x00, 0x41, 0x08, 0x1f, 0x0a, 0x04, 0x04, 0x01, 0x40, 0x28, 0x02, 0x00, 0x40, 0x25, 0x01, 
+	0x01, 0x40, 0x32, 0x0e, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0x0b, 0x11, 0x00, 0x42, 0x8e, 0x87, 0x04, 0x0d, 0x01, 0x41, 0x12, 0x1b, 0x04, 0x00, 
+	0x40, 0x36, 0x02, 0x01, 0x40, 0x0f, 0x08, 0x00, 0xc0, 0x82, 0x09, 0x40, 0x12, 0x03, 0x01, 0x08, 0x04, 0x40, 0x37, 0x04, 0x00, 0x41, 0x30, 0x12, 
+	0x03, 0x01, 0x08, 0x04, 0x40, 0x11, 0x02, 0x00, 0x41, 0x08, 0x0b, 0x02, 0x01, 0x40, 0x11, 0x07, 0x00, 0x41, 0x0a, 0x0b, 0x01, 0x01, 0x41, 0x04, 
+	0x21, 0x01, 0x00, 0x40, 0x35, 0x07, 0x01, 0x40, 0x04, 0x04, 0x01, 0x41, 0x16, 0x51, 0x04, 0x00, 0x41, 0x23, 0x12, 0x04, 0x01, 0x02, 0x04, 0x03, 
+	0x01, 0x42, 0x04, 0x34, 0x0a, 0x04, 0x00, 0x40, 0x37, 0x04, 0x01, 0x41, 0x13, 0x08, 0x05, 0x00, 0x41, 0x17, 0x0b, 0x03, 0x01, 0x41, 0x16, 0x83, 
+	0x04, 0x00, 0x42, 0x17, 0x36, 0x04, 0x03, 0x01, 0x07, 0x04, 0x40, 0x34, 0x03, 0x00, 0x40, 0x19, 0x02, 0x01, 0x40, 0x1f, 0x0b, 0x00, 0x42, 0x30, 
+	0x10, 0x04, 0x0b, 0x01, 0x42, 0x16, 0x33, 0x18, 0x04, 0x00, 0x41, 0x18, 0x04, 0x0d, 0x01, 0x41, 0x0b, 0x1d, 0x03, 0x00, 0x43, 0x10, 0x01, 0x12, 
+	0x17, 0x0e, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x41, 0x04, 0x18, 0x12, 0x00, 0x42, 0x24, 0x3c, 0x2a, 0x0a, 0x0f, 0x41, 0x51, 0x8e, 0x05, 0x00, 0x44, 
+	0x51, 0x13, 0x22, 0x34, 0x8e, 0x09, 0x00, 0x44, 0x08, 0x11, 0x3c, 0x0f, 0xe9, 0x01, 0x79, 0x05, 0x52, 0x41, 0x32, 0x0a, 0x05, 0x00, 0x44, 0x0a, 
+	0x11, 0x3c, 0x0f, 0xe9, 0x01, 0x79, 0x05, 0x52, 0x41, 0x9d, 0x08, 0x03, 0x00, 0x43, 0x9d, 0x22, 0xd8, 0x2a, 0x09, 0x00, 0x43, 0x44, 0x22, 0xd8, 
+	0x28, 0x02, 0x00, 0x40, 0x22, 0x02, 0x01, 0x41, 0x1f, 0x2a, 0x07, 0x1d, 0x41, 0x25, 0x0a, 0x06, 0x00, 0x45, 0x17, 0x19, 0x34, 0x36, 0x10, 0x22, 
+	0x01, 0x12, 0x45, 0x22, 0x13, 0x36, 0x79, 0x28, 0x24, 0x06, 0x00, 0x46, 0x08, 0x2a, 0x35, 0x87, 0x35, 0x44, 0x83, 0x07, 0x00, 0x45, 0x1b, 0x33, 
+	0x87, 0x35, 0x32, 0x24, 0x07, 0x00, 0x43, 0x23, 0x30, 0x28, 0x32, 0x01, 0x79, 0x40, 0x35, 0x04, 0x52, 0x41, 0x79, 0x11, 0x03, 0x00, 0x44, 0x23, 
+	0x36, 0x1f, 0x2b, 0x1b, 0x0d, 0x00, 0x4d, 0x23, 0x90, 0x28, 0x32, 0x35, 0x2b, 0x22, 0x1f, 0xd8, 0x36, 0xe9, 0x28, 0x1b, 0x0a, 0x06, 0x00, 0x41, 
+	0x08, 0x28, 0x0b, 0x0f, 0x42, 0x2a, 0x51, 0x83, 0x04, 0x00, 0x42, 0x19, 0x2a, 0x23, 0x0f, 0x00, 0x41, 0x0a, 0x1d, 0x01, 0x0f, 0x41, 0x19, 0x08, 
+	0x3f, 0x00, 0x33, 0x00, 0x41, 0x17, 0x04, 0x02, 0x01, 0x40, 0x1b, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x20, 0x00, 0x40, 0x1b, 0x02, 
+	0x01, 0x41, 0x0b, 0x0a, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x20, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x10, 0x2c, 0x00, 0x40, 0x15, 
+	0x01, 0x00, 0x40, 0x15, 0x03, 0x00, 0x40, 0x0e, 0x02, 0x00, 0x42, 0x0e, 0x68, 0xe7, 0x02, 0x00, 0x40, 0x08, 0x02, 0x15, 0x40, 0x08, 0x02, 0x00, 
+	0x40, 0x0e, 0x01, 0x00, 0x03, 0x15, 0x40, 0x08, 0x02, 0x00, 0x44, 0x0e, 0x08, 0x00, 0x0e, 0x08, 0x02, 0x00, 0x01, 0x08, 0x02, 0x00, 0x43, 0x08, 
+	0xb7, 0x66, 0x08, 0x05, 0x00, 0x44, 0x0e, 0x08, 0x00, 0x0e, 0x08, 0x02, 0x00, 0x01, 0x08, 0x42, 0x00, 0x0e, 0x08, 0x02, 0x00, 0x41, 0x08, 0x0e, 
+	0x03, 0x00, 0x01, 0xb7, 0x02, 0x00, 0x01, 0x08, 0x03, 0x00, 0x41, 0x08, 0x0e, 0x02, 0x00, 0x40, 0x15, 0x02, 0x00, 0x40, 0x08, 0x04, 0x15, 0x42, 
+	0x0e, 0x00, 0x0e, 0x03, 0x00, 0x42, 0x15, 0x68, 0x15, 0x02, 0x00, 0x41, 0x08, 0x0e, 0x03, 0x00, 0x40, 0x15, 0x3f, 0x00, 0x34, 0x00, 0x40, 0x34, 
+	0x02, 0x01, 0x40, 0x32, 0x2c, 0x00, 0x44, 0x48, 0x2c, 0x5f, 0x48, 0xa8, 0x02, 0x00, 0x4a, 0xac, 0x69, 0x00, 0x4f, 0x47, 0x48, 0x5b, 0x75, 0x0e, 
+	0x00, 0x43, 0x02, 0x48, 0x41, 0x29, 0x7f, 0x01, 0x00, 0x43, 0x46, 0x71, 0x00, 0xf1, 0x02, 0x48, 0x41, 0x29, 0x6c, 0x01, 0x00, 0x44, 0xbd, 0xaa, 
+	0x00, 0xab, 0x80, 0x02, 0x00, 0x41, 0xbc, 0x3a, 0x01, 0x00, 0x41, 0x72, 0x46, 0x01, 0x5b, 0x41, 0x8d, 0xcb, 0x04, 0x00, 0x44, 0x73, 0x6b, 0x00, 
+	0x82, 0x80, 0x02, 0x00, 0x44, 0xbc, 0x43, 0x00, 0x74, 0x5a, 0x02, 0x00, 0x41, 0x64, 0xbd, 0x01, 0x00, 0x41, 0x59, 0xac, 0x01, 0x5b, 0x44, 0x3f, 
+	0x68, 0x00, 0xcf, 0x80, 0x03, 0x00, 0x41, 0xef, 0xbb, 0x01, 0x00, 0x42, 0xcd, 0x48, 0x68, 0x01, 0x00, 0x40, 0xbb, 0x04, 0x48, 0x43, 0x82, 0x00, 
+	0x47, 0x66, 0x01, 0x00, 0x44, 0xbb, 0xf1, 0x48, 0xf1, 0x3a, 0x01, 0x00, 0x42, 0xa9, 0x29, 0x5f, 0x01, 0x00, 0x41, 0x2c, 0x48, 0x3f, 0x00, 0x34, 
+	0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x19, 0x2c, 0x00, 0x45, 0x41, 0x2c, 0x5f, 0x41, 0xac, 0x08, 0x01, 0x00, 0x4b, 0x46, 0x72, 0x08, 0x8d, 0x63, 
+	0x00, 0x2c, 0x8c, 0xbc, 0x00, 0x3a, 0x80, 0x01, 0x68, 0x48, 0x56, 0x29, 0xa9, 0x00, 0x40, 0x71, 0x00, 0x5b, 0xb7, 0x01, 0x15, 0x49, 0x56, 0xf1, 
+	0x69, 0x00, 0x74, 0x64, 0x00, 0x3f, 0x5b, 0x59, 0x01, 0x00, 0x45, 0x6c, 0x7f, 0x00, 0x5f, 0x29, 0xcf, 0x01, 0x08, 0x42, 0xdf, 0x9a, 0x0e, 0x03, 
+	0x00, 0x45, 0x75, 0xaa, 0x00, 0x3f, 0x5b, 0x59, 0x01, 0x00, 0x45, 0x43, 0x3a, 0x00, 0x5a, 0x41, 0x4f, 0x01, 0x00, 0x45, 0x99, 0x73, 0x00, 0x2c, 
+	0x9a, 0x6c, 0x01, 0x0e, 0x45, 0x3a, 0x47, 0x15, 0x68, 0x9a, 0x08, 0x02, 0x00, 0x41, 0x9a, 0x59, 0x01, 0x00, 0x42, 0x73, 0x82, 0x6c, 0x01, 0x00, 
+	0x40, 0x84, 0x01, 0x68, 0x52, 0x47, 0xcd, 0x68, 0xb7, 0x00, 0x29, 0x66, 0x00, 0xce, 0x40, 0x71, 0x00, 0x59, 0x46, 0xbc, 0x00, 0x63, 0x41, 0x80, 
+	0x01, 0x00, 0x41, 0x2c, 0x41, 0x3f, 0x00, 0x33, 0x00, 0x41, 0x17, 0x0b, 0x01, 0x01, 0x41, 0x04, 0x21, 0x2c, 0x00, 0x45, 0x41, 0x2c, 0x5f, 0x9b, 
+	0x46, 0x6b, 0x01, 0x00, 0x44, 0x46, 0x72, 0x84, 0x9b, 0x08, 0x01, 0x00, 0x44, 0x56, 0x3a, 0x00, 0x3a, 0x43, 0x02, 0x00, 0x01, 0xe0, 0x45, 0x00, 
+	0x40, 0x71, 0x00, 0x5b, 0x84, 0x02, 0x00, 0x48, 0xf0, 0x64, 0x00, 0x74, 0x64, 0x00, 0x3f, 0x82, 0x5a, 0x01, 0x00, 0x44, 0x6c, 0x7f, 0x00, 0x3a, 
+	0x73, 0x03, 0x00, 0x41, 0x8c, 0x69, 0x03, 0x00, 0x45, 0x75, 0xaa, 0x00, 0x3f, 0x82, 0x75, 0x01, 0x00, 0x45, 0x43, 0x3a, 0x00, 0x5a, 0x82, 0x3f, 
+	0x01, 0x00, 0x44, 0x99, 0x73, 0x00, 0xbb, 0x81, 0x03, 0x00, 0x44, 0xab, 0xce, 0x00, 0x76, 0x69, 0x01, 0x00, 0x41, 0x69, 0x46, 0x01, 0x00, 0x43, 
+	0x0e, 0x47, 0xa8, 0x76, 0x04, 0x00, 0x41, 0x40, 0x59, 0x02, 0x00, 0x44, 0x29, 0x66, 0x08, 0x47, 0x56, 0x02, 0x00, 0x49, 0x72, 0x29, 0x15, 0x63, 
+	0x76, 0x29, 0x68, 0x00, 0x2c, 0x41, 0x3f, 0x00, 0x33, 0x00, 0x40, 0x24, 0x02, 0x01, 0x41, 0x1f, 0x08, 0x2c, 0x00, 0x4d, 0x41, 0x2c, 0x5f, 0x29, 
+	0xcd, 0x40, 0x0e, 0x00, 0x46, 0x72, 0x08, 0x8d, 0x7f, 0xb7, 0x03, 0x00, 0x41, 0x3a, 0x43, 0x02, 0x00, 0x47, 0xbd, 0x43, 0x00, 0x40, 0x71, 0x00, 
+	0x5b, 0x84, 0x01, 0x00, 0x50, 0x2c, 0x47, 0xa8, 0x00, 0x74, 0x64, 0x00, 0x3f, 0xa9, 0x9a, 0x4f, 0x00, 0x6c, 0x7f, 0x00, 0x76, 0xcc, 0x09, 0x00, 
+	0x54, 0x75, 0xaa, 0x00, 0x3f, 0xa9, 0x9a, 0xcb, 0x00, 0x43, 0x3a, 0x00, 0x5a, 0x64, 0x46, 0xa9, 0x00, 0x99, 0x73, 0x00, 0xf0, 0x64, 0x03, 0x00, 
+	0x44, 0xce, 0x5a, 0x00, 0x43, 0xbc, 0x01, 0x00, 0x41, 0x43, 0x3a, 0x01, 0x00, 0x44, 0x56, 0xf0, 0x00, 0x47, 0x68, 0x03, 0x00, 0x41, 0x40, 0x59, 
+	0x02, 0x00, 0x44, 0x29, 0x66, 0x59, 0x29, 0x08, 0x03, 0x00, 0x48, 0x47, 0x4f, 0x63, 0x81, 0x43, 0x75, 0x00, 0x2c, 0x41, 0x3f, 0x00, 0x34, 0x00, 
+	0x43, 0x19, 0x44, 0x86, 0x17, 0x2d, 0x00, 0x53, 0x41, 0x2c, 0x5f, 0x29, 0x0e, 0x8c, 0xcf, 0x00, 0x46, 0x72, 0x00, 0x69, 0x46, 0x41, 0x8d, 0x6c, 
+	0x0e, 0x00, 0x3a, 0x5a, 0x01, 0x6b, 0x48, 0x43, 0xf1, 0x69, 0x00, 0x40, 0x71, 0x00, 0x5b, 0xab, 0x01, 0x8c, 0x41, 0x29, 0x5a, 0x01, 0x00, 0x4c, 
+	0x74, 0x64, 0x00, 0x3f, 0x56, 0x99, 0x82, 0x00, 0x6c, 0x7f, 0x00, 0x9b, 0x59, 0x01, 0x00, 0x40, 0xcb, 0x01, 0x4f, 0x40, 0x5f, 0x03, 0x00, 0x54, 
+	0x75, 0xaa, 0x00, 0x3f, 0x4f, 0xce, 0x82, 0x00, 0x43, 0x3a, 0x00, 0x5a, 0x6b, 0xcd, 0x46, 0x0e, 0x99, 0x73, 0x00, 0x46, 0x56, 0x03, 0x00, 0x44, 
+	0xcc, 0xac, 0x00, 0x69, 0x3f, 0x01, 0x00, 0x41, 0x76, 0x72, 0x01, 0x00, 0x44, 0x80, 0x64, 0x00, 0xef, 0x6c, 0x03, 0x00, 0x41, 0x40, 0x59, 0x02, 
+	0x00, 0x43, 0x29, 0x66, 0xa8, 0x76, 0x04, 0x00, 0x48, 0xab, 0x6b, 0x63, 0x81, 0x2c, 0x9a, 0x72, 0x2c, 0x41, 0x3f, 0x00, 0x3f, 0x00, 0x26, 0x00, 
+	0x49, 0x41, 0x2c, 0x5f, 0x29, 0x08, 0x72, 0x29, 0x2c, 0x46, 0x72, 0x01, 0x00, 0x47, 0x08, 0x69, 0x6c, 0x9a, 0xbd, 0x00, 0x3a, 0x9a, 0x01, 0xac, 
+	0x41, 0x81, 0xcc, 0x01, 0x00, 0x47, 0x40, 0x71, 0x00, 0x5b, 0xbb, 0xcf, 0x76, 0xbd, 0x02, 0x00, 0x4c, 0x74, 0x64, 0x00, 0x3f, 0x56, 0x0e, 0x46, 
+	0xcd, 0x6c, 0x7f, 0x00, 0x29, 0x71, 0x01, 0x00, 0x43, 0x40, 0x29, 0x48, 0xdf, 0x03, 0x00, 0x4e, 0x75, 0xaa, 0x00, 0x3f, 0x4f, 0x0e, 0x8d, 0xcc, 
+	0x43, 0x3a, 0x00, 0x5a, 0x6b, 0x00, 0x82, 0x01, 0x99, 0x43, 0x73, 0x00, 0x46, 0xa8, 0x03, 0x00, 0x47, 0xcd, 0xac, 0x00, 0x08, 0x40, 0xe7, 0xb7, 
+	0x47, 0x02, 0x00, 0x44, 0x9a, 0xa9, 0xcb, 0xbb, 0x76, 0x03, 0x00, 0x41, 0x40, 0x59, 0x02, 0x00, 0x43, 0x29, 0x66, 0xa8, 0x46, 0x04, 0x00, 0x40, 
+	0x82, 0x01, 0x63, 0x45, 0x81, 0x00, 0xcf, 0xab, 0x2c, 0x41, 0x3f, 0x00, 0x3f, 0x00, 0x26, 0x00, 0x4b, 0x41, 0x2c, 0x5f, 0x29, 0x08, 0x00, 0x74, 
+	0x43, 0x46, 0x72, 0xb7, 0xa9, 0x02, 0x00, 0x44, 0x66, 0x9b, 0x0e, 0x3a, 0x43, 0x05, 0x00, 0x48, 0x40, 0x71, 0x00, 0x5b, 0x84, 0x00, 0xe7, 0x29, 
+	0xcd, 0x01, 0x00, 0x4c, 0x74, 0x64, 0x00, 0x3f, 0x56, 0x00, 0xa9, 0x46, 0x43, 0x7f, 0x00, 0x82, 0x6b, 0x03, 0x00, 0x41, 0x80, 0xdf, 0x03, 0x00, 
+	0x47, 0x75, 0xaa, 0x00, 0x3f, 0x4f, 0x00, 0x63, 0x76, 0x01, 0x3a, 0x4a, 0x00, 0x5a, 0x6b, 0x00, 0x4f, 0x47, 0xbb, 0x73, 0x00, 0x75, 0xcf, 0x03, 
+	0x00, 0x41, 0xbb, 0x74, 0x01, 0x00, 0x43, 0xe0, 0x6b, 0xce, 0x80, 0x01, 0x00, 0x41, 0xcb, 0x9b, 0x02, 0x76, 0x41, 0x48, 0x59, 0x02, 0x00, 0x41, 
+	0x40, 0x59, 0x02, 0x00, 0x40, 0x29, 0x01, 0x66, 0x41, 0x9b, 0x15, 0x02, 0x00, 0x49, 0x08, 0x29, 0x69, 0x63, 0x81, 0x00, 0x08, 0x40, 0x6b, 0x41, 
+	0x3f, 0x00, 0x3f, 0x00, 0x26, 0x00, 0x46, 0x41, 0x2c, 0x5f, 0x29, 0x08, 0x00, 0x68, 0x01, 0x9b, 0x43, 0x72, 0x69, 0x47, 0x0e, 0x01, 0x00, 0x44, 
+	0x2c, 0x29, 0x0e, 0x3a, 0x43, 0x05, 0x00, 0x44, 0x40, 0x71, 0x00, 0x5b, 0x84, 0x01, 0x00, 0x48, 0xdf, 0x8d, 0x08, 0x00, 0x74, 0x64, 0x00, 0x3f, 
+	0x56, 0x01, 0x00, 0x46, 0x3f, 0x47, 0x7f, 0x00, 0xcf, 0xab, 0x08, 0x02, 0x00, 0x41, 0xbd, 0xdf, 0x03, 0x00, 0x44, 0x75, 0xaa, 0x00, 0x3f, 0x4f, 
+	0x01, 0x00, 0x45, 0xac, 0x47, 0x3a, 0x00, 0x5a, 0x6b, 0x01, 0x00, 0x46, 0x5a, 0x47, 0x73, 0x00, 0x63, 0x76, 0x0e, 0x01, 0x00, 0x42, 0x15, 0x8d, 
+	0xa9, 0x01, 0x00, 0x43, 0x4f, 0x74, 0xf0, 0x56, 0x01, 0x00, 0x41, 0x7f, 0xbc, 0x02, 0x00, 0x41, 0x73, 0xbc, 0x02, 0x00, 0x41, 0x40, 0x59, 0x02, 
+	0x00, 0x44, 0x29, 0x66, 0x00, 0xac, 0x99, 0x02, 0x00, 0x44, 0x63, 0x8d, 0x08, 0x63, 0x81, 0x01, 0x00, 0x42, 0x6b, 0x47, 0x41, 0x3f, 0x00, 0x3f, 
+	0x00, 0x26, 0x00, 0x44, 0x41, 0x2c, 0x5f, 0x29, 0x08, 0x01, 0x00, 0x45, 0xef, 0x41, 0x72, 0x08, 0x3f, 0x81, 0x01, 0x4f, 0x44, 0x81, 0xef, 0x00, 
+	0x3a, 0x43, 0x05, 0x00, 0x44, 0x40, 0x71, 0x00, 0x5b, 0x84, 0x01, 0x00, 0x48, 0x15, 0x47, 0x64, 0x00, 0x74, 0x64, 0x00, 0x3f, 0x56, 0x01, 0x00, 
+	0x4b, 0x4f, 0x41, 0x7f, 0x00, 0x0e, 0x3f, 0x81, 0x56, 0xcb, 0xef, 0x48, 0xa8, 0x03, 0x00, 0x44, 0x75, 0xaa, 0x00, 0x3f, 0x4f, 0x01, 0x00, 0x45, 
+	0x56, 0x41, 0x3a, 0x00, 0x5a, 0x6b, 0x01, 0x00, 0x42, 0x59, 0x5b, 0x73, 0x01, 0x00, 0x41, 0x8c, 0xf0, 0x01, 0x56, 0x01, 0x8c, 0x02, 0x00, 0x47, 
+	0x08, 0x8d, 0x47, 0x0e, 0x00, 0x08, 0x8d, 0x71, 0x02, 0x00, 0x41, 0x63, 0x46, 0x02, 0x00, 0x41, 0x40, 0x59, 0x02, 0x00, 0x4c, 0x29, 0x66, 0x00, 
+	0xcb, 0x9b, 0xdf, 0x69, 0xce, 0x9b, 0xcc, 0x00, 0x63, 0x81, 0x01, 0x00, 0x42, 0x08, 0x3f, 0x41, 0x3f, 0x00, 0x3f, 0x00, 0x26, 0x00, 0x44, 0xab, 
+	0x15, 0x84, 0x5a, 0x08, 0x01, 0x00, 0x4c, 0x5f, 0x8c, 0x68, 0x00, 0xe7, 0xbd, 0x47, 0x40, 0xe0, 0x0e, 0x00, 0x99, 0x64, 0x05, 0x00, 0x44, 0x73, 
+	0x66, 0x00, 0x8c, 0x15, 0x02, 0x00, 0x47, 0x63, 0xbd, 0x00, 0x6c, 0xcc, 0x00, 0x80, 0x69, 0x02, 0x00, 0x41, 0x80, 0xce, 0x01, 0x00, 0x45, 0x2c, 
+	0x7f, 0x8d, 0x47, 0x75, 0x69, 0x04, 0x00, 0x44, 0x6c, 0xa8, 0x00, 0x80, 0x71, 0x02, 0x00, 0x44, 0x80, 0x99, 0x00, 0x43, 0xa8, 0x02, 0x00, 0x41, 
+	0x43, 0xbc, 0x01, 0x00, 0x41, 0x2c, 0xe0, 0x01, 0x40, 0x41, 0xe0, 0x15, 0x03, 0x00, 0x41, 0x6c, 0x43, 0x01, 0x00, 0x41, 0x5f, 0x81, 0x03, 0x00, 
+	0x42, 0x84, 0x8c, 0xe7, 0x01, 0x00, 0x41, 0x74, 0x66, 0x02, 0x00, 0x41, 0x5a, 0x5f, 0x01, 0x00, 0x44, 0x4f, 0xab, 0x29, 0x82, 0xcc, 0x01, 0x00, 
+	0x41, 0x4f, 0x3a, 0x02, 0x00, 0x41, 0x56, 0xab, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
+	0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3b, 0x00
+};
+const PackedIcon GPUSA_Logo_packed = {295, 125, GPUSA_Logo_packed_palette, 256, GPUSA_Logo_packed_data, 11124};
+
+#endif
@@ -0,0 +1,124 @@
+#include "PatriotRacing_RenderTrace.h"
+
+#ifdef RENDER_TRACE
+
+#include <stdio.h>
+#include <string.h>
+
+struct RenderTraceEntry {
+	const void *Asset;
+	const char *Name;				// NULL until RenderTraceName
+	bool Drawn;
+	uint8_t Seen[RENDERTRACE_CODES / 8];
+};
+
+static RenderTraceEntry Entries[RENDERTRACE_ASSETS];
+static uint8_t Used = 0;
+static void (*Out)(const char *Line) = NULL;
+static bool Held = false;
+
+// the entry for Asset, a new one the first time, NULL when they're all taken
+static RenderTraceEntry *RenderTraceFind(const void *Asset) {
+
+	uint8_t i;
+
+	for (i = 0; i < Used; i++) {
+		if (Entries[i].Asset == Asset) {
+			return &Entries[i];
+		}
+	}
+	if (Used == RENDERTRACE_ASSETS) {
+		return NULL;
+	}
+	memset(&Entries[Used], 0, sizeof(RenderTraceEntry));
+	Entries[Used].Asset = Asset;
+	return &Entries[Used++];
+}
+
+// Code < 0 for an icon
+static void RenderTraceLine(const RenderTraceEntry *Entry, int32_t Code) {
+
+	char line[RENDERTRACE_LINE];
+	char name[20];
+	const char *n = Entry->Name;
+
+	if (n == NULL) {
+		snprintf(name, sizeof(name), "@%p", Entry->Asset);
+		n = name;
+	}
+	if (Code < 0) {
+		snprintf(line, sizeof(line), "RT %s", n);
+	}
+	else {
+		snprintf(line, sizeof(line), "RT %s %ld", n, (long) Code);
+	}
+	Out(line);
+}
+
+void RenderTraceBegin(void (*NewOut)(const char *Line)) {
+
+	uint8_t i;
+
+	Out = NewOut;
+	for (i = 0; i < Used; i++) {
+		Entries[i].Drawn = false;
+		memset(Entries[i].Seen, 0, sizeof(Entries[i].Seen));
+	}
+}
+
+void RenderTraceName(const void *Asset, const char *Name) {
+
+	RenderTraceEntry *e = RenderTraceFind(Asset);
+
+	if (e != NULL) {
+		e->Name = Name;
+	}
+}
+
+void RenderTraceGlyph(const void *Asset, uint16_t Code) {
+
+	RenderTraceEntry *e;
+
+	if ((Out == NULL) || Held) {
+		return;
+	}
+	e = RenderTraceFind(Asset);
+	if (e == NULL) {
+		return;
+	}
+	if (Code < RENDERTRACE_CODES) {
+		if (e->Seen[Code >> 3] & (1 << (Code & 7))) {
+			return;
+		}
+		e->Seen[Code >> 3] |= 1 << (Code & 7);
+	}
+	RenderTraceLine(e, Code);
+}
+
+void RenderTraceHold(bool Hold) {
+	Held = Hold;
+}
+
+void RenderTraceText(const void *Asset, const char *Text) {
+
+	for (; *Text; Text++) {
+		RenderTraceGlyph(Asset, (uint8_t) *Text);
+	}
+}
+
+void RenderTraceAsset(const void *Asset) {
+
+	RenderTraceEntry *e;
+
+	if ((Out == NULL) || Held) {
+		return;
+	}
+	e = RenderTraceFind(Asset);
+	if ((e == NULL) || e->Drawn) {
+		return;
+	}
+	e->Drawn = true;
+	RenderTraceLine(e, -1);
+}
+
+#endif
@@ -0,0 +1,111 @@
+/*
+
+	Program name: Bob Jones Patriot Racing render trace
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, which glyphs and icons actually get drawn
+
+*/
+
+#ifndef PATRIOT_RACING_RENDERTRACE_H
+#define PATRIOT_RACING_RENDERTRACE_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+
+#define RENDERTRACE_VERSION 1.0
+
+/*
+
+the fonts and icons are most of what goes in flash and nobody knows which glyphs ever get drawn.
+a build with RENDER_TRACE defined writes a line the first time each glyph of each font and the
+first time each icon gets drawn:
+
+	RT arial12 83        arial12 drew 'S' (the char code)
+	RT car_icon_packed   the icon got drawn
+	RT @0x1fff8a30 83    something that wasn't given a name
+
+the hooks are where the glyphs get found (FontGetGlyph, FontTableGlyph, TextRunPlot) and where
+the packed images and sprites get read (IconReader, BootSplash, SpriteDraw), so everything that
+goes through this library is caught. anything drawn straight with the display library (tft.print
+with a GFXfont, drawRGBBitmap) needs a RenderTraceText / RenderTraceAsset next to it
+
+assets are known by address, a font by its struct and an icon by its pixels (the array for a raw
+icon, Data for a packed one, where it starts in the atlas for a sprite). RENDERTRACE_NAME,
+RENDERTRACE_ICON and RENDERTRACE_SPRITE give them the name the report goes by, do it in the file
+that draws them, the fonts and icons in Adafruit_fonts.h and the icon headers are const in a
+header so every file that includes one has its own copy
+
+	RenderTraceBegin([](const char *Line) { Serial.println(Line); });
+	RENDERTRACE_NAME(arial12);
+	RENDERTRACE_NAME(Arial_100_BINO);
+	RENDERTRACE_ICON(car_icon_packed);
+	RENDERTRACE_SPRITE(AtlasWords, ATLAS_GPUSA_Logo);
+
+then drive every screen and menu page and save what came out of Serial for
+PatriotRacing_Tools/AssetFootprint. without RENDER_TRACE everything here is an empty inline and
+costs nothing. the Arduino IDE has no build flags, uncomment the define below for a trace build
+
+*/
+
+// #define RENDER_TRACE
+
+#define RENDERTRACE_ASSETS 48        // fonts and icons told apart, about 40 bytes of RAM each
+#define RENDERTRACE_CODES 256        // glyphs above this get a line every time
+#define RENDERTRACE_LINE 48
+
+#ifdef RENDER_TRACE
+
+// starts a trace (everything counts as not drawn yet), Out gets each line without a newline
+void RenderTraceBegin(void (*Out)(const char *Line));
+
+void RenderTraceName(const void *Asset, const char *Name);
+
+// Code drawn from the font Asset
+void RenderTraceGlyph(const void *Asset, uint16_t Code);
+
+// every char of Text drawn from the font Asset
+void RenderTraceText(const void *Asset, const char *Text);
+
+// the icon or image Asset drawn
+void RenderTraceAsset(const void *Asset);
+
+// while held nothing counts, for code that looks at every glyph of a font to measure it
+void RenderTraceHold(bool Hold);
+
+ #define RENDERTRACE_NAME(Asset) RenderTraceName(&(Asset), #Asset)
+ #define RENDERTRACE_ICON(Icon) RenderTraceName((Icon).Data, #Icon)
+ #define RENDERTRACE_SPRITE(Atlas, Sprite) RenderTraceName((Atlas) + (Sprite).Offset, #Sprite)
+
+#else
+
+static inline void RenderTraceBegin(void (*)(const char *)) {
+}
+
+static inline void RenderTraceName(const void *, const char *) {
+}
+
+static inline void RenderTraceGlyph(const void *, uint16_t) {
+}
+
+static inline void RenderTraceText(const void *, const char *) {
+}
+
+static inline void RenderTraceAsset(const void *) {
+}
+
+static inline void RenderTraceHold(bool) {
+}
+
+ #define RENDERTRACE_NAME(Asset)
+ #define RENDERTRACE_ICON(Icon)
+ #define RENDERTRACE_SPRITE(Atlas, Sprite)
+
+#endif
+
+#endif
@@ -0,0 +1,149 @@
+/*
+
+	Program name: Bob Jones Patriot Racing sprite atlas
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, one flash blob and typed handles for every icon
+	1.1    Kris 	10/19/2026	SpriteDraw reports to the render trace
+	1.2    Kris 	10/19/2026	SpriteHandle catches a wrong format without throw, the Teensy builds with -fno-exceptions
+
+*/
+
+#ifndef PATRIOT_RACING_SPRITES_H
+#define PATRIOT_RACING_SPRITES_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include "PatriotRacing_RenderTrace.h"
+
+#define SPRITES_VERSION 1.2
+
+/*
+
+the icons are globals all over PatriotRacing_Icons.h and GPUSA_Icons.h, some RGB565, some 1 bit,
+some PROGMEM and some not (on a Teensy 4 a const array without PROGMEM gets copied into RAM at
+boot). PatriotRacing_Tools/AtlasBuild puts all of them in one uint32_t array in flash
+(PatriotRacing_Atlas.h) with a constexpr table of where each one is, and a handle per sprite
+
+	RGB565      two pixels a word, first pixel in the low half, rows run on
+	mono        1 bit a pixel, msb is the leftmost, every row starts on a new word
+
+the handle type says the format, so SpriteDraw picks the right blit at compile time and a mono
+sprite can't be drawn without its colors. the handles are constexpr so there's no lookup at run
+time, everything the blit needs is an offset into the atlas
+
+both blits read whole words, expand SPRITES_BAND pixels (whole rows) at a time into a buffer on the
+stack and writeRect it, same as IconDraw. mono sprites are drawn opaque (Fore on Back)
+
+*/
+
+#define SPRITES_BAND 512             // pixels per writeRect
+#define SPRITE_RGB565 0
+#define SPRITE_MONO 1
+
+// one row of the generated table
+struct SpriteInfo {
+	uint16_t Width;
+	uint16_t Height;
+	uint8_t Format;
+	uint32_t Offset;             // in words from the start of the atlas
+	uint32_t Words;
+};
+
+template <uint8_t Format>
+struct Sprite {
+	uint16_t Width;
+	uint16_t Height;
+	uint32_t Offset;
+};
+
+typedef Sprite<SPRITE_RGB565> Sprite565;
+typedef Sprite<SPRITE_MONO> SpriteMono;
+
+// never defined and not constexpr, a handle that gets here isn't a constant and the constexpr
+// ATLAS_ line doesn't compile (throw would do the same, but not with -fno-exceptions)
+template <uint8_t Format>
+Sprite<Format> SpriteFormatDoesntMatchItsHandle();
+
+// handle from a table row, doesn't compile if the row is some other format
+template <uint8_t Format>
+constexpr Sprite<Format> SpriteHandle(const SpriteInfo &Info) {
+	return (Info.Format == Format) ? Sprite<Format>{Info.Width, Info.Height, Info.Offset} : SpriteFormatDoesntMatchItsHandle<Format>();
+}
+
+// words a mono row takes
+static constexpr uint32_t SpriteMonoStride(uint16_t Width) {
+	return (Width + 31) / 32;
+}
+
+template <class Display>
+void SpriteDraw(Display &D, const uint32_t *Atlas, int16_t X, int16_t Y, const Sprite565 &S) {
+
+	uint16_t band[SPRITES_BAND];
+	const uint32_t *word = Atlas + S.Offset;
+	uint16_t rows = SPRITES_BAND / S.Width;
+	uint32_t pixels, i, w = 0;
+	uint16_t y, n;
+	bool low = true;
+
+	if (rows == 0) {
+		return;
+	}
+	RenderTraceAsset(Atlas + S.Offset);
+
+	for (y = 0; y < S.Height; y += n) {
+		n = (S.Height - y < rows) ? S.Height - y : rows;
+		pixels = (uint32_t) n * S.Width;
+		for (i = 0; i < pixels; i++) {
+			if (low) {
+				w = *word++;
+				band[i] = w & 0xFFFF;
+			}
+			else {
+				band[i] = w >> 16;
+			}
+			low = !low;
+		}
+		D.writeRect(X, Y + y, S.Width, n, band);
+	}
+}
+
+template <class Display>
+void SpriteDraw(Display &D, const uint32_t *Atlas, int16_t X, int16_t Y, const SpriteMono &S, uint16_t Fore, uint16_t Back) {
+
+	uint16_t band[SPRITES_BAND];
+	const uint32_t *row = Atlas + S.Offset;
+	uint16_t rows = SPRITES_BAND / S.Width;
+	uint32_t stride = SpriteMonoStride(S.Width);
+	uint32_t w = 0;
+	uint16_t *out;
+	uint16_t y, n, j, x;
+
+	if (rows == 0) {
+		return;
+	}
+	RenderTraceAsset(Atlas + S.Offset);
+
+	for (y = 0; y < S.Height; y += n) {
+		n = (S.Height - y < rows) ? S.Height - y : rows;
+		out = band;
+		for (j = 0; j < n; j++) {
+			for (x = 0; x < S.Width; x++) {
+				if ((x & 31) == 0) {
+					w = row[x >> 5];
+				}
+				*out++ = (w & 0x80000000UL) ? Fore : Back;
+				w <<= 1;
+			}
+			row += stride;
+		}
+		D.writeRect(X, Y + y, S.Width, n, band);
+	}
+}
+
+#endif
@@ -0,0 +1,265 @@
+#include "PatriotRacing_Standings.h"
+
+#include <string.h>
+
+#define NO_CROSS -1.0f
+
+Standings::Standings() {
+	Reset();
+}
+
+void Standings::Reset() {
+
+	uint16_t i;
+
+	memset(Car, 0, sizeof(Car));
+	memset(Order, 0, sizeof(Order));
+	memset(Hash, STANDING_NOT_FOUND, sizeof(Hash));
+	memset(Flags, 0, sizeof(Flags));
+	for (i = 0; i <= STANDINGS_MAX_LAPS; i++) {
+		FirstCross[i] = NO_CROSS;
+	}
+	FirstCross[0] = 0.0f;
+	Count = 0;
+	ChangeCount = 0;
+}
+
+uint8_t Standings::GetSlot(uint16_t Number) const {
+
+	uint8_t h = Number & (STANDINGS_HASH_SIZE - 1);
+
+	while (Hash[h] != STANDING_NOT_FOUND) {
+		if (Car[Hash[h]].Number == Number) {
+			return Hash[h];
+		}
+		h = (h + 1) & (STANDINGS_HASH_SIZE - 1);
+	}
+	return STANDING_NOT_FOUND;
+}
+
+uint8_t Standings::AddCar(uint16_t Number) {
+
+	uint8_t h = Number & (STANDINGS_HASH_SIZE - 1);
+	uint8_t slot;
+
+	if (Count >= STANDINGS_MAX_CARS) {
+		return STANDING_NOT_FOUND;
+	}
+
+	while (Hash[h] != STANDING_NOT_FOUND) {
+		h = (h + 1) & (STANDINGS_HASH_SIZE - 1);
+	}
+
+	// new cars start at the back with no laps
+	slot = Count++;
+	Hash[h] = slot;
+	Car[slot].Number = Number;
+	Car[slot].Pos = Count;
+	Order[Count - 1] = slot;
+	MarkChanged(slot, STANDING_NEW | STANDING_POS);
+
+	return slot;
+}
+
+// more laps, or the same laps and crossed the line first
+bool Standings::Ahead(uint8_t A, uint8_t B) const {
+
+	if (Car[A].Laps != Car[B].Laps) {
+		return Car[A].Laps > Car[B].Laps;
+	}
+	return Car[A].CrossTime < Car[B].CrossTime;
+}
+
+void Standings::MarkChanged(uint8_t Slot, uint8_t NewFlags) {
+
+	if (Flags[Slot] == 0) {
+		Changed[ChangeCount++] = Slot;
+	}
+	Flags[Slot] |= NewFlags;
+}
+
+// gaps are measured when the car crosses the line, so this is only for the car that crossed
+void Standings::UpdateGaps(uint8_t Slot) {
+
+	Standing &c = Car[Slot];
+	const Standing &leader = Car[Order[0]];
+	float oldleader = c.GapLeader;
+	float oldahead = c.GapAhead;
+	uint16_t oldlapsleader = c.LapsLeader;
+	uint16_t oldlapsahead = c.LapsAhead;
+
+	if (c.Pos == 1) {
+		c.GapLeader = 0.0f;
+		c.GapAhead = 0.0f;
+		c.LapsLeader = 0;
+		c.LapsAhead = 0;
+	}
+	else {
+		const Standing &ahead = Car[Order[c.Pos - 2]];
+
+		c.LapsLeader = leader.Laps - c.Laps;
+		c.GapLeader = (FirstCross[c.Laps] == NO_CROSS) ? 0.0f : c.CrossTime - FirstCross[c.Laps];
+
+		c.LapsAhead = ahead.Laps - c.Laps;
+		if (c.LapsAhead == 0) {
+			c.GapAhead = c.GapLeader - ahead.GapLeader;
+		}
+		else {
+			c.GapAhead = 0.0f;
+		}
+	}
+
+	if ((oldleader != c.GapLeader) || (oldahead != c.GapAhead) || (oldlapsleader != c.LapsLeader) || (oldlapsahead != c.LapsAhead)) {
+		MarkChanged(Slot, STANDING_GAP);
+	}
+}
+
+// a car that didn't cross but has a new car ahead. its gaps stay what they were at its own
+// crossing, unless the car ahead is on the same lap, then both crossings are known and the gap
+// is exact (the first crossing of the lap can move too when the feed is out of order)
+void Standings::UpdateBehind(uint8_t Slot) {
+
+	Standing &c = Car[Slot];
+	const Standing &ahead = Car[Order[c.Pos - 2]];
+	float oldleader = c.GapLeader;
+	float oldahead = c.GapAhead;
+	uint16_t oldlapsahead = c.LapsAhead;
+
+	if (ahead.Laps != c.Laps) {
+		return;
+	}
+	c.GapLeader = c.CrossTime - FirstCross[c.Laps];
+	c.GapAhead = c.CrossTime - ahead.CrossTime;
+	c.LapsAhead = 0;
+
+	if ((oldleader != c.GapLeader) || (oldahead != c.GapAhead) || (oldlapsahead != c.LapsAhead)) {
+		MarkChanged(Slot, STANDING_GAP);
+	}
+}
+
+uint8_t Standings::LapEvent(uint16_t Number, uint16_t Laps, float CrossTime, float LapTime) {
+
+	uint8_t slot = GetSlot(Number);
+	uint8_t p, oldp, behind;
+
+	if (slot == STANDING_NOT_FOUND) {
+		slot = AddCar(Number);
+		if (slot == STANDING_NOT_FOUND) {
+			return 0;
+		}
+	}
+
+	Standing &c = Car[slot];
+
+	// repeats and late packets, the feed resends the last crossing
+	if ((Laps <= c.Laps) || (Laps > STANDINGS_MAX_LAPS)) {
+		return 0;
+	}
+
+	if (LapTime <= 0.0f) {
+		LapTime = (CrossTime - c.CrossTime) / (Laps - c.Laps);
+	}
+
+	c.DeltaPrev = (c.LapTime > 0.0f) ? LapTime - c.LapTime : 0.0f;
+	c.DeltaBest = (c.BestLapTime > 0.0f) ? LapTime - c.BestLapTime : 0.0f;
+	if ((c.BestLapTime <= 0.0f) || (LapTime < c.BestLapTime)) {
+		c.BestLapTime = LapTime;
+	}
+	c.LapTime = LapTime;
+	c.Laps = Laps;
+	c.CrossTime = CrossTime;
+	MarkChanged(slot, STANDING_LAP);
+
+	if ((FirstCross[Laps] == NO_CROSS) || (CrossTime < FirstCross[Laps])) {
+		FirstCross[Laps] = CrossTime;
+	}
+
+	// completing a lap can only move us forward, walk up past anyone now behind us
+	// normally that's only cars on fewer laps, but the feed can deliver two crossings out of order
+	oldp = c.Pos - 1;
+	p = oldp;
+	while ((p > 0) && Ahead(slot, Order[p - 1])) {
+		Order[p] = Order[p - 1];
+		Car[Order[p]].Pos = p + 1;
+		MarkChanged(Order[p], STANDING_POS);
+		p--;
+	}
+
+	if (p != oldp) {
+		Order[p] = slot;
+		c.Pos = p + 1;
+		MarkChanged(slot, STANDING_POS);
+	}
+
+	// ours first, the cars behind measure against it
+	UpdateGaps(slot);
+
+	if (p != oldp) {
+		// everyone we passed has a new car ahead, and so does the car that was right behind our old spot
+		for (behind = p + 1; (behind <= oldp + 1) && (behind < Count); behind++) {
+			UpdateBehind(Order[behind]);
+		}
+	}
+
+	return c.Pos;
+}
+
+uint8_t Standings::GetCount() const {
+	return Count;
+}
+
+const Standing &Standings::GetCar(uint8_t Slot) const {
+	return Car[Slot];
+}
+
+uint8_t Standings::GetSlotAtPos(uint8_t Pos) const {
+
+	if ((Pos == 0) || (Pos > Count)) {
+		return STANDING_NOT_FOUND;
+	}
+	return Order[Pos - 1];
+}
+
+uint8_t Standings::GetChangeCount() const {
+	return ChangeCount;
+}
+
+uint8_t Standings::GetChangedSlot(uint8_t Index) const {
+	return Changed[Index];
+}
+
+uint8_t Standings::GetChangeFlags(uint8_t Slot) const {
+	return Flags[Slot];
+}
+
+void Standings::ClearChanges() {
+
+	uint8_t i;
+
+	for (i = 0; i < ChangeCount; i++) {
+		Flags[Changed[i]] = 0;
+	}
+	ChangeCount = 0;
+}
+
+uint8_t Standings::Fill(const uint16_t *Numbers, uint8_t Cars, RaceMonitorCar *RM) const {
+
+	uint8_t i, slot;
+	uint8_t found = 0;
+
+	for (i = 0; i < Cars; i++) {
+		memset(&RM[i], 0, sizeof(RaceMonitorCar));
+		RM[i].Number = Numbers[i];
+		slot = GetSlot(Numbers[i]);
+		if (slot == STANDING_NOT_FOUND) {
+			continue;
+		}
+		RM[i].Laps = Car[slot].Laps;
+		RM[i].LapTime = Car[slot].LapTime;
+		RM[i].BestLapTime = Car[slot].BestLapTime;
+		RM[i].Pos = Car[slot].Pos;
+		found++;
+	}
+
+	return found;
+}
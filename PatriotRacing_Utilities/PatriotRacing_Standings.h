@@ -0,0 +1,113 @@
+/*
+
+	Program name: Bob Jones Patriot Racing race monitor (base station web server)
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, incremental standings from race monitor lap events
+	1.1    Kris 	10/19/2026	cars that didn't cross keep the gaps from their own crossing
+
+*/
+
+#ifndef PATRIOT_RACING_STANDINGS_H
+#define PATRIOT_RACING_STANDINGS_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include "PatriotRacing_Monitor.h"
+
+#define STANDINGS_VERSION 1.1
+
+/*
+
+the race monitor feed only gives us a lap event when a car crosses the line, so instead of
+sorting the whole field and recomputing every gap on every update, each lap event moves that one
+car up the running order (a car can only gain places when it completes a lap) and touches only the
+cars it passed. gaps are measured at the line: gap to leader is how long after the first car to
+complete the same lap we crossed, gap ahead is the difference to the car in front when on the same lap.
+a car that didn't cross keeps what it had at its last crossing (the leader finishing a lap doesn't
+put everyone a lap down), only a car with a new car ahead on its own lap gets its gaps measured again
+
+cars whose numbers we have never seen get a slot on first lap, the field is not limited to the 8
+race monitor slots the web page shows (use Fill to pick which cars go there)
+
+*/
+
+#define STANDINGS_MAX_CARS 80    // full field plus spares
+#define STANDINGS_MAX_LAPS 250   // 90 min race, even the test stand won't do more
+#define STANDINGS_HASH_SIZE 128  // car number lookup, must be a power of 2 and > STANDINGS_MAX_CARS
+
+// what changed for a car since the last ClearChanges
+#define STANDING_POS 1     // position in the race
+#define STANDING_GAP 2     // gap to leader or gap to car ahead
+#define STANDING_LAP 4     // laps, last lap, best lap or lap deltas
+#define STANDING_NEW 8     // first time we've seen this car
+
+#define STANDING_NOT_FOUND 0xFF
+
+struct Standing {
+	uint16_t Number;        // car number
+	uint16_t Laps;          // laps completed
+	uint8_t Pos;            // 1 = leader
+	float CrossTime;        // race time (sec) when the car last crossed the line
+	float LapTime;          // last lap (sec)
+	float BestLapTime;      // best lap (sec)
+	float DeltaBest;        // last lap - best lap before this one (negative is a new best)
+	float DeltaPrev;        // last lap - lap before that
+	float GapLeader;        // sec behind the leader on the same lap
+	float GapAhead;         // sec behind the car ahead on the same lap
+	uint16_t LapsLeader;    // laps down to the leader (gap is in laps when not 0)
+	uint16_t LapsAhead;     // laps down to the car ahead
+};
+
+class Standings {
+
+public:
+
+	Standings();
+
+	void Reset();
+
+	// one car crossed the line, LapTime can be 0 if the feed doesn't send it (we use the crossing times)
+	// returns the car's position, or 0 if the field is full or the event is stale
+	uint8_t LapEvent(uint16_t Number, uint16_t Laps, float CrossTime, float LapTime);
+
+	uint8_t GetCount() const;
+	const Standing &GetCar(uint8_t Slot) const;
+	uint8_t GetSlotAtPos(uint8_t Pos) const;           // Pos is 1 based
+	uint8_t GetSlot(uint16_t Number) const;            // STANDING_NOT_FOUND if never seen
+
+	// change set, only cars that moved or crossed since the last ClearChanges
+	uint8_t GetChangeCount() const;
+	uint8_t GetChangedSlot(uint8_t Index) const;
+	uint8_t GetChangeFlags(uint8_t Slot) const;
+	void ClearChanges();
+
+	// copies the given car numbers into the web page race monitor block (C0..C7), returns how many were found
+	uint8_t Fill(const uint16_t *Numbers, uint8_t Cars, RaceMonitorCar *RM) const;
+
+private:
+
+	uint8_t AddCar(uint16_t Number);
+	bool Ahead(uint8_t A, uint8_t B) const;
+	void MarkChanged(uint8_t Slot, uint8_t Flags);
+	void UpdateGaps(uint8_t Slot);
+	void UpdateBehind(uint8_t Slot);
+
+	Standing Car[STANDINGS_MAX_CARS];
+	uint8_t Order[STANDINGS_MAX_CARS];          // slot for each position (0 based)
+	uint8_t Hash[STANDINGS_HASH_SIZE];          // car number -> slot
+	float FirstCross[STANDINGS_MAX_LAPS + 1];   // race time the first car completed each lap
+	uint8_t Count;
+
+	uint8_t Flags[STANDINGS_MAX_CARS];
+	uint8_t Changed[STANDINGS_MAX_CARS];
+	uint8_t ChangeCount;
+
+};
+
+#endif
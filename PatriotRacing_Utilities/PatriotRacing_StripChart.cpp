@@ -0,0 +1,181 @@
+#include "PatriotRacing_StripChart.h"
+
+StripChart::StripChart() {
+
+	X = 0;
+	Top = 0;
+	W = 0;
+	H = 0;
+	High = 0.0f;
+	Scale = 0.0f;
+	Back = 0;
+	GridLines = 0;
+	GridColor = 0;
+	Traces = 0;
+	Samples = 1;
+	Clear();
+}
+
+void StripChart::Begin(int16_t X, int16_t Y, int16_t W, int16_t H, float Low, float High, uint16_t Back) {
+
+	if (W > STRIPCHART_MAX_W) {
+		W = STRIPCHART_MAX_W;
+	}
+	if (H > STRIPCHART_MAX_H) {
+		H = STRIPCHART_MAX_H;
+	}
+	if ((W <= STRIPCHART_GAP) || (H <= 0)) {
+		W = 0;
+		H = 0;
+	}
+
+	this->X = X;
+	this->Top = Y - H;
+	this->W = W;
+	this->H = H;
+	this->High = High;
+	this->Back = Back;
+	Scale = (High > Low) ? (H - 1) / (High - Low) : 0.0f;
+	Traces = 0;
+	Clear();
+}
+
+void StripChart::SetSamplesPerColumn(uint16_t Samples) {
+
+	this->Samples = (Samples == 0) ? 1 : Samples;
+	StartColumn();
+}
+
+void StripChart::SetGrid(uint8_t Lines, uint16_t Color) {
+
+	GridLines = Lines;
+	GridColor = Color;
+	Dirty = true;
+}
+
+int8_t StripChart::AddTrace(uint16_t Color) {
+
+	if (Traces >= STRIPCHART_TRACES) {
+		return -1;
+	}
+	this->Color[Traces] = Color;
+	return Traces++;
+}
+
+void StripChart::Clear() {
+
+	uint8_t t;
+
+	for (t = 0; t < STRIPCHART_TRACES; t++) {
+		memset(Lo[t], STRIPCHART_EMPTY_LO, sizeof(Lo[t]));
+		memset(Hi[t], STRIPCHART_EMPTY_HI, sizeof(Hi[t]));
+	}
+	HaveLast = false;
+	Head = 0;
+	Finished.store(0, std::memory_order_relaxed);
+	Drawn = 0;
+	Dirty = true;
+	StartColumn();
+}
+
+void StripChart::StartColumn() {
+
+	uint8_t t;
+
+	for (t = 0; t < STRIPCHART_TRACES; t++) {
+		if (HaveLast) {
+			// start from where the last column ended so the line joins up
+			CurLo[t] = Last[t];
+			CurHi[t] = Last[t];
+		}
+		else {
+			CurLo[t] = STRIPCHART_EMPTY_LO;
+			CurHi[t] = STRIPCHART_EMPTY_HI;
+		}
+	}
+	Count = 0;
+}
+
+uint8_t StripChart::Row(float Value) const {
+
+	float r = (High - Value) * Scale;
+
+	// NaN fails every compare, it goes to the top with the values over High
+	if (!(r > 0.0f)) {
+		return 0;
+	}
+	if (r >= H - 1) {
+		return H - 1;
+	}
+	return (uint8_t) (r + 0.5f);
+}
+
+void StripChart::Add(const float *Values) {
+
+	uint8_t t, r;
+
+	if (W <= 0) {
+		return;
+	}
+
+	for (t = 0; t < Traces; t++) {
+		r = Row(Values[t]);
+		if (r < CurLo[t]) {
+			CurLo[t] = r;
+		}
+		if (r > CurHi[t]) {
+			CurHi[t] = r;
+		}
+		Last[t] = r;
+	}
+	HaveLast = true;
+
+	if (++Count < Samples) {
+		return;
+	}
+
+	for (t = 0; t < Traces; t++) {
+		Lo[t][Head] = CurLo[t];
+		Hi[t][Head] = CurHi[t];
+	}
+	Head = (Head + 1) % W;
+	// the column is in the ring before Draw can see it's finished
+	Finished.store(Finished.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	StartColumn();
+}
+
+void StripChart::Add(float Value) {
+
+	// Add(const float *) reads a value for every trace
+	if (Traces != 1) {
+		return;
+	}
+	Add(&Value);
+}
+
+uint16_t StripChart::GetSamplesPerColumn() const {
+	return Samples;
+}
+
+void StripChart::BuildColumn(uint16_t *Out, uint16_t C, bool Empty) const {
+
+	uint8_t t, r;
+	int16_t i;
+
+	for (i = 0; i < H; i++) {
+		Out[i] = Back;
+	}
+	for (t = 1; t <= GridLines; t++) {
+		Out[((int32_t) (H - 1) * t) / (GridLines + 1)] = GridColor;
+	}
+	if (Empty) {
+		return;
+	}
+
+	// later traces draw over earlier ones
+	for (t = 0; t < Traces; t++) {
+		for (r = Lo[t][C]; r <= Hi[t][C]; r++) {
+			Out[r] = Color[t];
+		}
+	}
+}
@@ -0,0 +1,195 @@
+/*
+
+	Program name: Bob Jones Patriot Racing strip chart
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, constant cost per sample graph for the GRAPH_X / Y / W / H area
+	1.1    Kris 	10/19/2026	Add and Draw hand columns over with one counter each side writes, Add(float)
+	                            	for one trace charts only, NaN samples clamped
+
+*/
+
+#ifndef PATRIOT_RACING_STRIPCHART_H
+#define PATRIOT_RACING_STRIPCHART_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+
+#include <string.h>
+#include <atomic>
+
+#define STRIPCHART_VERSION 1.1
+
+/*
+
+the car graph redrew the whole plot every time a point came in, so the cost went up with how much
+history was on the screen. a StripChart keeps one column per screen column in a ring (min and max
+of each trace for the samples that landed in that column) and only ever draws the newest column
+
+the plot doesn't move, a cursor sweeps left to right and wraps (like a heart monitor) with
+STRIPCHART_GAP blank columns in front of it so you can see where now is. each finished column is
+one writeRect of H pixels, plus one more to blank the column at the far side of the gap, however
+long the history is. the ILI9341 does have a hardware scroll but it scrolls whole panel rows,
+which in landscape is every column top to bottom, so it would take the big readouts above the
+graph with it
+
+several samples can go in one column (SetSamplesPerColumn), the column keeps the min and max of
+each trace so a spike still shows. each column also reaches to the last sample of the one before
+so the trace is a connected line and not dots
+
+Add only does the math, Draw pushes whatever columns finished since the last Draw, so the samples
+can come in from the data task and the drawing happen with the rest of the screen update. Add is
+the only one that writes Finished (columns done, stored after the column is) and Draw the only one
+that writes Drawn, Draw reads Finished once and draws up to there, so one task can Add while
+another Draws without a lock. Draw has to keep up to within W - STRIPCHART_GAP columns or it
+redraws everything, and a column Add writes again while Draw is reading it (Add a whole chart
+ahead) can come out mixed, the Draw after puts it right. Begin, AddTrace, SetSamplesPerColumn and Clear change both sides, call them
+when Add isn't running
+
+X, Y is the lower left corner, same as GRAPH_X / GRAPH_Y
+
+*/
+
+#define STRIPCHART_TRACES 4          // most traces on one chart
+#define STRIPCHART_MAX_W 320
+#define STRIPCHART_MAX_H 240
+#define STRIPCHART_GAP 4             // blank columns in front of the cursor
+#define STRIPCHART_EMPTY_LO 255      // Lo > Hi is a column with no data for that trace
+#define STRIPCHART_EMPTY_HI 0
+
+class StripChart {
+
+public:
+
+	StripChart();
+
+	// Low and High are the values at the bottom and top of the chart, it starts out empty
+	void Begin(int16_t X, int16_t Y, int16_t W, int16_t H, float Low, float High, uint16_t Back);
+	void SetSamplesPerColumn(uint16_t Samples);
+
+	// Lines evenly spaced horizontal lines (0 for none)
+	void SetGrid(uint8_t Lines, uint16_t Color);
+
+	// returns the trace number for Add, -1 if there's no room
+	int8_t AddTrace(uint16_t Color);
+
+	// one sample for every trace, in AddTrace order
+	void Add(const float *Values);
+
+	// a chart with one trace, does nothing with more
+	void Add(float Value);
+
+	// forget the history, next Draw blanks the chart
+	void Clear();
+
+	// draws the columns finished since the last Draw, returns the pixels pushed
+	template <class Display>
+	uint32_t Draw(Display &D);
+
+	// the whole chart (screen was cleared)
+	template <class Display>
+	uint32_t Redraw(Display &D);
+
+	uint16_t GetSamplesPerColumn() const;
+
+private:
+
+	int16_t X;
+	int16_t Top;
+	int16_t W;
+	int16_t H;
+	float High;
+	float Scale;                 // rows per unit
+	uint16_t Back;
+	uint8_t GridLines;
+	uint16_t GridColor;
+
+	uint8_t Traces;
+	uint16_t Color[STRIPCHART_TRACES];
+
+	// the ring, column c is drawn at X + c, rows from the top
+	uint8_t Lo[STRIPCHART_TRACES][STRIPCHART_MAX_W];
+	uint8_t Hi[STRIPCHART_TRACES][STRIPCHART_MAX_W];
+
+	// column being filled
+	uint8_t CurLo[STRIPCHART_TRACES];
+	uint8_t CurHi[STRIPCHART_TRACES];
+	uint8_t Last[STRIPCHART_TRACES];		// row of the last sample
+	bool HaveLast;
+	uint16_t Samples;
+	uint16_t Count;
+	uint16_t Head;               // next column to finish, the cursor, Add's own
+
+	std::atomic<uint32_t> Finished;   // columns finished since Clear, only Add writes it
+	uint32_t Drawn;              // Finished at the last Draw, only Draw writes it
+	bool Dirty;                  // whole chart needs drawing
+
+	uint8_t Row(float Value) const;
+	void StartColumn();
+
+	// column c as pixels, Empty for a gap column
+	void BuildColumn(uint16_t *Out, uint16_t C, bool Empty) const;
+
+};
+
+template <class Display>
+uint32_t StripChart::Draw(Display &D) {
+
+	uint16_t col[STRIPCHART_MAX_H];
+	uint16_t c;
+	uint32_t pushed = 0, done;
+
+	if (W <= 0) {
+		return 0;
+	}
+	done = Finished.load(std::memory_order_acquire);
+	if (Dirty || (done - Drawn + STRIPCHART_GAP >= (uint32_t) W)) {
+		// more to draw than the chart has columns, just do all of it
+		return Redraw(D);
+	}
+
+	for (; Drawn != done; Drawn++) {
+		c = Drawn % W;
+		BuildColumn(col, c, false);
+		D.writeRect(X + c, Top, 1, H, col);
+
+		// the far side of the gap, the columns between were blanked by the ones before
+		c = (c + STRIPCHART_GAP) % W;
+		BuildColumn(col, c, true);
+		D.writeRect(X + c, Top, 1, H, col);
+		pushed += 2 * (uint32_t) H;
+	}
+
+	return pushed;
+}
+
+template <class Display>
+uint32_t StripChart::Redraw(Display &D) {
+
+	uint16_t col[STRIPCHART_MAX_H];
+	uint16_t c, head;
+	uint32_t done;
+
+	if (W <= 0) {
+		return 0;
+	}
+	done = Finished.load(std::memory_order_acquire);
+	head = done % W;
+
+	for (c = 0; c < W; c++) {
+		// the gap is the cursor and the STRIPCHART_GAP - 1 after it
+		BuildColumn(col, c, ((c + W - head) % W) < STRIPCHART_GAP);
+		D.writeRect(X + c, Top, 1, H, col);
+	}
+	Drawn = done;
+	Dirty = false;
+
+	return (uint32_t) W * H;
+}
+
+#endif
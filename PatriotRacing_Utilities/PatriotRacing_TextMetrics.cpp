@@ -0,0 +1,138 @@
+#include "PatriotRacing_TextMetrics.h"
+
+TextMetrics::TextMetrics() {
+
+	FontCount = 0;
+	Hits = 0;
+	Misses = 0;
+	Invalidate();
+}
+
+bool TextMetrics::AddFont(const GFXfont *Font) {
+
+	uint8_t i;
+	uint16_t c;
+
+	if (Find(Font) >= 0) {
+		return true;
+	}
+	if (FontCount >= TEXTMETRICS_FONTS) {
+		return false;
+	}
+
+	for (i = 0; i < TEXTMETRICS_CHARS; i++) {
+		c = TEXTMETRICS_FIRST + i;
+		if ((c >= Font->first) && (c <= Font->last)) {
+			Advance[FontCount][i] = Font->glyph[c - Font->first].xAdvance;
+		}
+		else {
+			Advance[FontCount][i] = 0;
+		}
+	}
+	Fonts[FontCount++] = Font;
+	return true;
+}
+
+int8_t TextMetrics::Find(const GFXfont *Font) const {
+
+	uint8_t i;
+
+	for (i = 0; i < FontCount; i++) {
+		if (Fonts[i] == Font) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+uint16_t TextMetrics::Width(const GFXfont *Font, const char *Text) const {
+
+	int8_t f = Find(Font);
+	const uint8_t *advance;
+	uint16_t width = 0;
+	uint8_t c;
+
+	if (f < 0) {
+		return GlyphWidth(Font, Text);
+	}
+
+	advance = Advance[f];
+	for (; *Text; Text++) {
+		c = (uint8_t) *Text - TEXTMETRICS_FIRST;
+		if (c < TEXTMETRICS_CHARS) {
+			width += advance[c];
+		}
+	}
+	return width;
+}
+
+uint16_t TextMetrics::LabelWidth(const GFXfont *Font, const char *Label) {
+
+	uint8_t i, oldest = 0;
+
+	Clock++;
+	for (i = 0; i < TEXTMETRICS_CACHE; i++) {
+		if ((CacheText[i] == Label) && (CacheFont[i] == Font)) {
+			CacheUsed[i] = Clock;
+			Hits++;
+			return CacheWidth[i];
+		}
+		if (CacheUsed[i] < CacheUsed[oldest]) {
+			oldest = i;
+		}
+	}
+
+	Misses++;
+	CacheFont[oldest] = Font;
+	CacheText[oldest] = Label;
+	CacheWidth[oldest] = Width(Font, Label);
+	CacheUsed[oldest] = Clock;
+	return CacheWidth[oldest];
+}
+
+uint8_t TextMetrics::Height(const GFXfont *Font) const {
+	return Font->yAdvance;
+}
+
+int16_t TextMetrics::RightX(const GFXfont *Font, const char *Label, int16_t Right) {
+	return Right - LabelWidth(Font, Label);
+}
+
+int16_t TextMetrics::CenterX(const GFXfont *Font, const char *Label, int16_t Center) {
+	return Center - LabelWidth(Font, Label) / 2;
+}
+
+void TextMetrics::Invalidate() {
+
+	uint8_t i;
+
+	for (i = 0; i < TEXTMETRICS_CACHE; i++) {
+		CacheFont[i] = NULL;
+		CacheText[i] = NULL;
+		CacheWidth[i] = 0;
+		CacheUsed[i] = 0;
+	}
+	Clock = 0;
+}
+
+uint32_t TextMetrics::GetHits() const {
+	return Hits;
+}
+
+uint32_t TextMetrics::GetMisses() const {
+	return Misses;
+}
+
+uint16_t TextMetrics::GlyphWidth(const GFXfont *Font, const char *Text) {
+
+	uint16_t width = 0;
+	uint8_t c;
+
+	for (; *Text; Text++) {
+		c = (uint8_t) *Text;
+		if ((c >= Font->first) && (c <= Font->last)) {
+			width += Font->glyph[c - Font->first].xAdvance;
+		}
+	}
+	return width;
+}
@@ -0,0 +1,97 @@
+/*
+
+	Program name: Bob Jones Patriot Racing text metrics
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, advance tables and a label width cache for the GFXfont menus
+
+*/
+
+#ifndef PATRIOT_RACING_TEXTMETRICS_H
+#define PATRIOT_RACING_TEXTMETRICS_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include <ILI9341_t3.h>
+
+#define TEXTMETRICS_VERSION 1.0
+
+/*
+
+the menu and label fonts (arial6 - arial18, arialbd6 - arialbd18 in Adafruit_fonts.h) are GFXfonts,
+and laying out a menu (right justified values, centered titles) measured every string by walking
+the glyph table, 7 bytes a glyph in flash for one byte we want
+
+AddFont copies just the xAdvance of every char into a byte table (95 bytes for 0x20 - 0x7E), so
+Width is one load and an add per char. LabelWidth also remembers the answer in a small LRU cache
+keyed by the string pointer and the font, so a menu drawn every update measures each label once
+
+LabelWidth is only for text that doesn't change under the same pointer (string constants, the
+menu tables), a buffer that gets sprintf'd into has to use Width. GFXfonts have no kerning pairs
+so a width is just the sum of the advances, same as where the cursor ends up after print
+
+a font that wasn't added still works, Width falls back to walking the glyphs
+
+*/
+
+#define TEXTMETRICS_FONTS 8          // fonts with advance tables
+#define TEXTMETRICS_CHARS 96         // 0x20 - 0x7F
+#define TEXTMETRICS_FIRST 0x20
+#define TEXTMETRICS_CACHE 16         // label widths remembered
+
+class TextMetrics {
+
+public:
+
+	TextMetrics();
+
+	// build the advance table for Font, false if the tables are full
+	bool AddFont(const GFXfont *Font);
+
+	// pixels the cursor moves printing Text
+	uint16_t Width(const GFXfont *Font, const char *Text) const;
+
+	// same, cached by pointer, for text that never changes
+	uint16_t LabelWidth(const GFXfont *Font, const char *Label);
+
+	// line height
+	uint8_t Height(const GFXfont *Font) const;
+
+	// the x to print at so Text ends at Right, or is centered on Center
+	int16_t RightX(const GFXfont *Font, const char *Label, int16_t Right);
+	int16_t CenterX(const GFXfont *Font, const char *Label, int16_t Center);
+
+	// drop the cached widths (a label table was rebuilt)
+	void Invalidate();
+
+	uint32_t GetHits() const;
+	uint32_t GetMisses() const;
+
+	// the old way, walks the glyph table
+	static uint16_t GlyphWidth(const GFXfont *Font, const char *Text);
+
+private:
+
+	const GFXfont *Fonts[TEXTMETRICS_FONTS];
+	uint8_t Advance[TEXTMETRICS_FONTS][TEXTMETRICS_CHARS];	// 0 for chars the font doesn't have
+	uint8_t FontCount;
+
+	// the cache, Used is when it was last hit, the lowest goes first
+	const GFXfont *CacheFont[TEXTMETRICS_CACHE];
+	const char *CacheText[TEXTMETRICS_CACHE];
+	uint16_t CacheWidth[TEXTMETRICS_CACHE];
+	uint32_t CacheUsed[TEXTMETRICS_CACHE];
+	uint32_t Clock;
+	uint32_t Hits;
+	uint32_t Misses;
+
+	int8_t Find(const GFXfont *Font) const;
+
+};
+
+#endif
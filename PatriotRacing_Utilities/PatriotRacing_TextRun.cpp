@@ -0,0 +1,75 @@
+#include "PatriotRacing_TextRun.h"
+
+TextRun::TextRun() {
+
+	Font = NULL;
+	Ascent = 0;
+	Line = 0;
+	Windows = 0;
+}
+
+int16_t TextRun::Height(const GFXfont *GFX) {
+
+	Measure(GFX);
+	return Line;
+}
+
+int16_t TextRun::Height(const FontTable &Table) {
+
+	Measure(Table);
+	return Line;
+}
+
+uint32_t TextRun::GetWindows() const {
+	return Windows;
+}
+
+void TextRun::ResetCount() {
+	Windows = 0;
+}
+
+// the baseline goes below the tallest glyph, the line is yAdvance like print uses
+void TextRun::Measure(const GFXfont *GFX) {
+
+	uint16_t i;
+
+	if (Font == GFX) {
+		return;
+	}
+	Font = GFX;
+	Ascent = 0;
+	for (i = 0; i <= GFX->last - GFX->first; i++) {
+		if (-GFX->glyph[i].yOffset > Ascent) {
+			Ascent = -GFX->glyph[i].yOffset;
+		}
+	}
+	Line = GFX->yAdvance;
+}
+
+// down to the bottom of the lowest glyph, every char the font has, so any string fits the same line
+void TextRun::Measure(const FontTable &Table) {
+
+	const ILI9341_t3_font_t &font = *Table.Font;
+	FontGlyph g;
+	uint16_t code, last;
+	int16_t bottom;
+
+	if (Font == &Table) {
+		return;
+	}
+	Font = &Table;
+	Ascent = 0;
+	Line = 0;
+	last = FontTableFirst(font) + FontTableCount(font);
+	// measuring, not drawing
+	RenderTraceHold(true);
+	for (code = FontTableFirst(font); code < last; code++) {
+		if (FontTableGlyph(Table, code, g)) {
+			bottom = FontGlyphTop(font, g) + g.Height;
+			if (bottom > Line) {
+				Line = bottom;
+			}
+		}
+	}
+	RenderTraceHold(false);
+}
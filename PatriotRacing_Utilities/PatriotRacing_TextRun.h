@@ -0,0 +1,182 @@
+/*
+
+	Program name: Bob Jones Patriot Racing text runs
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, a whole string composed in RAM and sent in one window
+	1.1    Kris 	10/19/2026	TextRunPlot reports to the render trace
+
+*/
+
+#ifndef PATRIOT_RACING_TEXTRUN_H
+#define PATRIOT_RACING_TEXTRUN_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include <ILI9341_t3.h>
+#include "PatriotRacing_Font.h"
+#include "PatriotRacing_FontTable.h"
+#include "PatriotRacing_TextMetrics.h"
+#include "PatriotRacing_RenderTrace.h"
+
+#define TEXTRUN_VERSION 1.1
+
+/*
+
+printing a label or a value draws it a glyph at a time, every glyph sets its own address window
+(CASET, PASET, RAMWR) and sends its own box, so "19.2k" in arial12 is five windows, five sets of
+commands and five waits on the bus, and the glyph boxes don't cover the gaps between them, so the
+old text has to be erased first, another window
+
+a TextRun composes the whole string into a RAM band, background and all, the line height tall and
+as wide as the string (or MinWidth, so a shorter value covers what a longer one left), and sends it
+with one writeRect, one window and one burst of pixels. nothing is erased first, so it doesn't
+flicker either
+
+	GFXfonts     the menu fonts (arial6 - arial18, arialbd6 - arialbd18 in Adafruit_fonts.h), 1 bit,
+	             Y is the top of the line, the line is yAdvance tall
+	FontTables   the ILI9341_t3 fonts through their flat tables (PatriotRacing_FontTable.h),
+	             anti aliased ones blended onto the background, Y is the top of the line like
+	             FontDrawChar, the line goes down to the lowest glyph in the font
+
+a string bigger than the band (TEXTRUN_BAND pixels) goes in several windows of whole rows, the big
+readout fonts do that and so do long titles in arialbd14, a menu label or value always fits in
+one. Display is anything with writeRect(x, y, w, h, const uint16_t *pixels), ILI9341_t3 or a PC
+mock
+
+*/
+
+#ifndef TEXTRUN_BAND
+ #define TEXTRUN_BAND 4096           // pixels composed per writeRect, 8k of RAM
+#endif
+
+// GFXfont text, Plot(x, y) for every set pixel, the glyph bits run on from row to row
+template <class PlotFunc>
+void TextRunPlot(const GFXfont *Font, int16_t X, int16_t Baseline, const char *Text, PlotFunc &&Plot) {
+
+	const GFXglyph *glyph;
+	const uint8_t *bits;
+	uint32_t bit;
+	uint8_t c, gx, gy;
+
+	for (; *Text; Text++) {
+		c = (uint8_t) *Text;
+		if ((c < Font->first) || (c > Font->last)) {
+			continue;
+		}
+		glyph = &Font->glyph[c - Font->first];
+		RenderTraceGlyph(Font, c);
+		bits = Font->bitmap + glyph->bitmapOffset;
+		bit = 0;
+		for (gy = 0; gy < glyph->height; gy++) {
+			for (gx = 0; gx < glyph->width; gx++, bit++) {
+				if (bits[bit >> 3] & (0x80 >> (bit & 7))) {
+					Plot(X + glyph->xOffset + gx, Baseline + glyph->yOffset + gy);
+				}
+			}
+		}
+		X += glyph->xAdvance;
+	}
+}
+
+class TextRun {
+
+public:
+
+	TextRun();
+
+	// draws Text with the top left of its line at X, Y, returns the width sent
+	template <class Display>
+	int16_t Draw(Display &D, int16_t X, int16_t Y, const GFXfont *GFX, const char *Text, uint16_t Fore, uint16_t Back, int16_t MinWidth = 0);
+
+	template <class Display>
+	int16_t Draw(Display &D, int16_t X, int16_t Y, const FontTable &Table, const char *Text, uint16_t Fore, uint16_t Back, int16_t MinWidth = 0);
+
+	// the line a Draw covers
+	int16_t Height(const GFXfont *GFX);
+	int16_t Height(const FontTable &Table);
+
+	// windows sent since it was made or ResetCount, for the benchmarks
+	uint32_t GetWindows() const;
+	void ResetCount();
+
+private:
+
+	void Measure(const GFXfont *GFX);
+	void Measure(const FontTable &Table);
+
+	template <class Display, class ComposeFunc>
+	int16_t Send(Display &D, int16_t X, int16_t Y, int16_t Width, uint16_t Back, ComposeFunc &&Compose);
+
+	// the last font measured, so a screen of labels in one font works the line out once
+	const void *Font;
+	int16_t Ascent;					// GFXfonts, top of the line to the baseline
+	int16_t Line;					// line height
+	uint32_t Windows;
+	uint16_t Band[TEXTRUN_BAND];
+
+};
+
+template <class Display>
+int16_t TextRun::Draw(Display &D, int16_t X, int16_t Y, const GFXfont *GFX, const char *Text, uint16_t Fore, uint16_t Back, int16_t MinWidth) {
+
+	int16_t width = TextMetrics::GlyphWidth(GFX, Text);
+
+	Measure(GFX);
+	return Send(D, X, Y, (width > MinWidth) ? width : MinWidth, Back, [&](uint16_t *Rows, int16_t W, int16_t First, int16_t Count) {
+		TextRunPlot(GFX, 0, Ascent - First, Text, [&](int16_t PX, int16_t PY) {
+			if ((PX >= 0) && (PX < W) && (PY >= 0) && (PY < Count)) {
+				Rows[PY * W + PX] = Fore;
+			}
+		});
+	});
+}
+
+template <class Display>
+int16_t TextRun::Draw(Display &D, int16_t X, int16_t Y, const FontTable &Table, const char *Text, uint16_t Fore, uint16_t Back, int16_t MinWidth) {
+
+	int16_t width = FontTableStringWidth(Table, Text);
+
+	Measure(Table);
+	return Send(D, X, Y, (width > MinWidth) ? width : MinWidth, Back, [&](uint16_t *Rows, int16_t W, int16_t First, int16_t Count) {
+		FontCanvas canvas = {Rows, W, Count, W};
+
+		FontTableDrawString(canvas, Table, 0, -First, Text, Fore);
+	});
+}
+
+// fills the band with Back, has Compose draw rows First to First + Count - 1 of the line into it and
+// sends it, as many times as it takes to cover the line
+template <class Display, class ComposeFunc>
+int16_t TextRun::Send(Display &D, int16_t X, int16_t Y, int16_t Width, uint16_t Back, ComposeFunc &&Compose) {
+
+	int16_t first, count, per;
+	uint32_t i;
+
+	// a line wider than the band gets cut off, no font we have comes close
+	if (Width > TEXTRUN_BAND) {
+		Width = TEXTRUN_BAND;
+	}
+	if ((Width <= 0) || (Line <= 0)) {
+		return 0;
+	}
+
+	per = TEXTRUN_BAND / Width;
+	for (first = 0; first < Line; first += count) {
+		count = (Line - first < per) ? Line - first : per;
+		for (i = 0; i < (uint32_t) count * Width; i++) {
+			Band[i] = Back;
+		}
+		Compose(Band, Width, first, count);
+		D.writeRect(X, Y + first, Width, count, Band);
+		Windows++;
+	}
+	return Width;
+}
+
+#endif
@@ -0,0 +1,42 @@
+#include "PatriotRacing_Theme.h"
+
+uint16_t ThemeRecolor(uint16_t Color, uint16_t Back) {
+
+	uint16_t r = Color >> 11, g = (Color >> 5) & 0x3F, b = Color & 0x1F;
+	uint16_t br = Back >> 11, bg = (Back >> 5) & 0x3F, bb = Back & 0x1F;
+	uint16_t cover, rest;
+
+	// how much of the pixel is icon, 0 - 255, from the brightest channel
+	cover = r * 255 / 31;
+	if (g * 255 / 63 > cover) {
+		cover = g * 255 / 63;
+	}
+	if (b * 255 / 31 > cover) {
+		cover = b * 255 / 31;
+	}
+	rest = 255 - cover;
+
+	// the icon color was already times cover (it was on black), add what shows through
+	r += (br * rest + 127) / 255;
+	g += (bg * rest + 127) / 255;
+	b += (bb * rest + 127) / 255;
+	if (r > 31) {
+		r = 31;
+	}
+	if (g > 63) {
+		g = 63;
+	}
+	if (b > 31) {
+		b = 31;
+	}
+	return (r << 11) | (g << 5) | b;
+}
+
+void ThemeIconLUT(ThemeLUT &Lut, const PackedIcon &Icon, uint16_t Back) {
+
+	uint16_t i;
+
+	for (i = 0; i < THEME_LUT_SIZE; i++) {
+		Lut.Color[i] = (i < Icon.Colors) ? ThemeRecolor(Icon.Palette[i], Back) : Back;
+	}
+}
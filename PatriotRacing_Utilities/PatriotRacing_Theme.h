@@ -0,0 +1,77 @@
+/*
+
+	Program name: Bob Jones Patriot Racing theme color tables
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, per theme lookup tables for icons and anti aliased glyphs
+	1.1    Kris 	10/19/2026	glyph tables dropped, a lookup per run was slower than blending, icons only
+
+*/
+
+#ifndef PATRIOT_RACING_THEME_H
+#define PATRIOT_RACING_THEME_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+#endif
+#include "PatriotRacing_IconPack.h"
+
+#define THEME_VERSION 1.1
+
+/*
+
+the icons were drawn on black, so on the Light theme they sat in black boxes, and blending them to
+white meant doing the math for every pixel every time one was drawn
+
+a ThemeLUT is 256 finished RGB565 colors, the blit just looks pixels up in it. the theme icons
+(PatriotRacing_ThemeIcons.h, IconPack -t) have every pixel in the palette, ThemeIconLUT puts each
+palette color over the theme background once, and ThemeIconDraw decodes the icon with the LUT as
+its palette
+
+there's no table for text. a glyph comes out of FontDecode as runs, one blend a run, and a lookup
+a run was slower than that (ThemeBench had it at 0.5x on Arial_48_BINO), so themed text is drawn
+with FontDrawChar, or FontRamp (PatriotRacing_FontRamp.h) for anti aliased fonts
+
+build one LUT per theme when the screen starts and pass the one for the current theme, a theme
+change picks the other table, nothing gets blended again
+
+	ThemeIconLUT(CarLut[THEME_DARK], car_icon_theme, C_BLACK);
+	ThemeIconLUT(CarLut[THEME_LIGHT], car_icon_theme, C_WHITE);
+	...
+	ThemeIconDraw(Display, 10, 10, car_icon_theme, CarLut[Theme]);
+
+an icon pixel on black is the icon color times how much of the pixel it covers, the brightest channel
+is taken as that coverage, so a dark edge pixel becomes mostly background instead of a dark smudge
+
+*/
+
+#define THEME_DARK 0                 // same order as ThemeText
+#define THEME_LIGHT 1
+#define THEME_COUNT 2
+#define THEME_LUT_SIZE 256
+
+struct ThemeLUT {
+	uint16_t Color[THEME_LUT_SIZE];
+};
+
+// one icon color put over Back, what ThemeIconLUT does for each palette entry
+uint16_t ThemeRecolor(uint16_t Color, uint16_t Back);
+
+// Color[i] is Icon's palette entry i over Back
+void ThemeIconLUT(ThemeLUT &Lut, const PackedIcon &Icon, uint16_t Back);
+
+// a theme icon (every pixel through the palette) drawn with Lut as the palette
+template <class Display>
+void ThemeIconDraw(Display &D, int16_t X, int16_t Y, const PackedIcon &Icon, const ThemeLUT &Lut) {
+
+	PackedIcon themed = Icon;
+
+	themed.Palette = Lut.Color;
+	IconDraw(D, X, Y, themed);
+}
+
+#endif
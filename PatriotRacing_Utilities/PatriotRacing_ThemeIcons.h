@@ -0,0 +1,1086 @@
+/*
+
+	Program name: Bob Jones Patriot Racing theme icons
+
+	made by PatriotRacing_Tools/IconPack from PatriotRacing_Icons.h and GPUSA_Icons.h, don't edit,
+	change the raw icon and run it again
+
+*/
+
+#ifndef PATRIOT_RACING_THEMEICONS_H
+#define PATRIOT_RACING_THEMEICONS_H
+
+#include "PatriotRacing_IconPack.h"
+
+#ifndef PROGMEM
+ #define PROGMEM
+#endif
+
+// graph_icon565, 32x32px, 256 colors, 1433 bytes (raw 2048)
+static const uint16_t graph_icon_theme_palette [] PROGMEM = {
+	0x0000, 0xa5ff, 0x0008, 0x0009, 0xae3f, 0x000a, 0x959f, 0x000e, 0x000f, 0x8d7f, 0x0007, 0x957f, 0x9dbf, 0xae1f, 0x0004, 0x000b, 
+	0x000c, 0x000d, 0x7d1f, 0x853f, 0xd73f, 0x0010, 0x0011, 0x00dc, 0x851f, 0x8d5e, 0x8d5f, 0x957e, 0xa61f, 0xb65f, 0x7cff, 0x0002, 
+	0x851e, 0x8d3e, 0x9ddf, 0xa5df, 0xb67f, 0xbe7f, 0xceff, 0xdf7f, 0x0003, 0x0012, 0x0056, 0x74be, 0x74df, 0x7cfe, 0xdf5f, 0x0005, 
+	0x0006, 0x0013, 0x0034, 0x1a9e, 0x42d3, 0x53fc, 0x645c, 0x7c57, 0x7cbc, 0x7cde, 0x851d, 0x8d5d, 0xae5f, 0xbe9f, 0x0031, 0x0032, 
+	0x0035, 0x0077, 0x0078, 0x0079, 0x009a, 0x00bb, 0x017a, 0x01dd, 0x127e, 0x3295, 0x53bb, 0x541e, 0x5b75, 0x5b96, 0x647d, 0x647e, 
+	0x7437, 0x74ff, 0x7cdd, 0x84fe, 0x8d3d, 0x957d, 0x9d9e, 0x9dbe, 0xa5de, 0xadfe, 0xe79f, 0x0001, 0x0014, 0x0076, 0x0097, 0x0099, 
+	0x00b9, 0x00da, 0x0113, 0x0155, 0x019c, 0x01bc, 0x01dc, 0x19d2, 0x3ad6, 0x53fd, 0x63d8, 0x63f8, 0x647f, 0x6bf6, 0x6c18, 0x6c7c, 
+	0x7458, 0x74de, 0x84db, 0x84fd, 0x853d, 0x8cd9, 0x955d, 0x959e, 0xa5fe, 0xadfd, 0xae1e, 0xb63f, 0xc69f, 0xc6df, 0xd71f, 0xefbf, 
+	0xefdf, 0xf7ff, 0x0024, 0x002a, 0x002c, 0x002f, 0x0033, 0x0036, 0x004e, 0x006b, 0x0074, 0x0087, 0x0093, 0x0094, 0x0096, 0x0098, 
+	0x00af, 0x00b2, 0x00b5, 0x00bc, 0x00f0, 0x00fd, 0x010f, 0x0116, 0x0119, 0x011c, 0x0133, 0x0134, 0x0135, 0x0136, 0x0156, 0x0157, 
+	0x0174, 0x0177, 0x0179, 0x017b, 0x0199, 0x019b, 0x01b9, 0x01d9, 0x0950, 0x0952, 0x09d9, 0x0a1c, 0x0a3c, 0x0a3d, 0x114d, 0x114e, 
+	0x116f, 0x1171, 0x11b4, 0x11d4, 0x11d5, 0x1219, 0x127d, 0x194a, 0x194b, 0x198e, 0x19b2, 0x1a38, 0x21ad, 0x2211, 0x2214, 0x22ba, 
+	0x22bc, 0x2a0f, 0x2a10, 0x2a55, 0x2a74, 0x2a75, 0x2aba, 0x3272, 0x3273, 0x32b7, 0x331c, 0x335f, 0x3a92, 0x3ab4, 0x3ab5, 0x3b3c, 
+	0x4290, 0x42b2, 0x42d4, 0x42f6, 0x42f7, 0x4315, 0x4317, 0x4af3, 0x4b15, 0x4b34, 0x4b36, 0x4b37, 0x4b7a, 0x4b9a, 0x5376, 0x5377, 
+	0x5378, 0x5399, 0x53ba, 0x541d, 0x5b95, 0x5b97, 0x5bda, 0x5bfa, 0x5c3e, 0x63b6, 0x63b7, 0x63d6, 0x63d7, 0x6419, 0x641a, 0x645d, 
+	0x6bd6, 0x6bf8, 0x6c17, 0x6c37, 0x6c39, 0x6c7d, 0x6c9d, 0x747a, 0x74bf, 0x7c9b, 0x7cfd, 0x84b9, 0x84fc, 0x853e, 0x8d1a, 0x8d3c
+};
+static const uint8_t graph_icon_theme_data [] PROGMEM = {
+	0x0e, 0x00, 0x01, 0x1f, 0x18, 0x00, 0x44, 0x28, 0xbc, 0xcc, 0x4c, 0x50, 0x02, 0x37, 0x43, 0xf0, 0x34, 0xd0, 0x0e, 0x11, 0x00, 0x46, 0x0e, 0x34, 
+	0x6d, 0x50, 0x3b, 0x1b, 0x74, 0x01, 0x3a, 0x46, 0x73, 0x21, 0x76, 0x6e, 0x50, 0xd7, 0x8b, 0x0e, 0x00, 0x44, 0xc1, 0xeb, 0xfb, 0x56, 0x55, 0x01, 
+	0x3b, 0x45, 0x54, 0x74, 0x3a, 0x21, 0x73, 0xfa, 0x01, 0x52, 0x42, 0xfc, 0x6d, 0xd1, 0x0c, 0x00, 0x43, 0x34, 0x37, 0x58, 0x1b, 0x01, 0x55, 0x41, 
+	0x76, 0x3b, 0x01, 0x54, 0x43, 0x21, 0x3a, 0x20, 0x2d, 0x01, 0x39, 0x44, 0x71, 0x39, 0xf7, 0x4c, 0x82, 0x09, 0x00, 0x45, 0xd9, 0x75, 0x58, 0x57, 
+	0x56, 0x77, 0x01, 0x1b, 0x01, 0x19, 0x01, 0x21, 0x01, 0x20, 0x40, 0x53, 0x01, 0x2d, 0x40, 0x39, 0x01, 0x2b, 0x42, 0x38, 0x4d, 0x0e, 0x07, 0x00, 
+	0x41, 0xd2, 0x75, 0x01, 0x58, 0x01, 0x57, 0x41, 0x56, 0x77, 0x01, 0x1b, 0x01, 0x19, 0x41, 0x21, 0xfd, 0x01, 0x20, 0x40, 0x53, 0x01, 0x2d, 0x40, 
+	0x71, 0x01, 0x2b, 0x41, 0x38, 0x4c, 0x06, 0x00, 0x41, 0xc2, 0x70, 0x01, 0x78, 0x01, 0x01, 0x01, 0x23, 0x01, 0x22, 0x41, 0x01, 0x0c, 0x02, 0x06, 
+	0x01, 0x0b, 0x02, 0x09, 0x40, 0x0b, 0x01, 0x1a, 0x42, 0x2b, 0xf9, 0x34, 0x04, 0x00, 0x46, 0x2f, 0x4d, 0x04, 0x7a, 0x14, 0x0d, 0x1c, 0x02, 0x01, 
+	0x41, 0x26, 0x0d, 0x03, 0x0c, 0x41, 0x06, 0x26, 0x02, 0x06, 0x01, 0x09, 0x44, 0x7d, 0x18, 0xf8, 0x6b, 0xb8, 0x03, 0x00, 0x45, 0xc8, 0xfe, 0x04, 
+	0x0d, 0x5a, 0x0d, 0x01, 0x01, 0x46, 0x22, 0x23, 0x14, 0x01, 0x06, 0x0b, 0x09, 0x01, 0x1a, 0x40, 0x2e, 0x01, 0x13, 0x47, 0x18, 0x12, 0x1e, 0x7e, 
+	0x13, 0x2c, 0x18, 0xd8, 0x02, 0x00, 0x42, 0x0e, 0xde, 0x1d, 0x01, 0x04, 0x47, 0x5a, 0x0d, 0x1c, 0x01, 0x04, 0x23, 0x14, 0x01, 0x01, 0x06, 0x44, 
+	0x0b, 0x09, 0x1a, 0x27, 0x0b, 0x01, 0x18, 0x43, 0x12, 0x1e, 0x7e, 0x13, 0x01, 0x2c, 0x41, 0xf4, 0xb7, 0x01, 0x00, 0x41, 0xae, 0x70, 0x01, 0x1d, 
+	0x42, 0x3c, 0x5a, 0x04, 0x01, 0x0d, 0x01, 0x01, 0x42, 0x14, 0x1c, 0x0c, 0x01, 0x06, 0x01, 0x0b, 0x47, 0x27, 0x01, 0x3c, 0x20, 0x18, 0x12, 0x14, 
+	0x13, 0x01, 0x1e, 0x41, 0x53, 0xbd, 0x01, 0x00, 0x42, 0x67, 0x79, 0x24, 0x01, 0x1d, 0x40, 0x7f, 0x01, 0x1d, 0x01, 0x04, 0x42, 0x0d, 0x2e, 0x04, 
+	0x01, 0x01, 0x01, 0x23, 0x4c, 0x0c, 0x80, 0x2e, 0x7c, 0x14, 0x13, 0x09, 0x14, 0x1a, 0x18, 0x1e, 0x51, 0xd5, 0x01, 0x00, 0x42, 0xc4, 0x24, 0x25, 
+	0x01, 0x24, 0x41, 0x80, 0x04, 0x01, 0x1c, 0x01, 0x01, 0x41, 0x27, 0x3c, 0x02, 0x22, 0x50, 0x04, 0x2e, 0x81, 0x04, 0x0c, 0x26, 0x14, 0x26, 0x27, 
+	0x09, 0x18, 0x1e, 0x51, 0xdb, 0x0e, 0x5b, 0x49, 0x01, 0x3d, 0x4f, 0x25, 0x24, 0x7f, 0x24, 0x3c, 0x0d, 0x0c, 0x26, 0x2e, 0x04, 0x01, 0x22, 0x1b, 
+	0x26, 0x1d, 0x5a, 0x01, 0x09, 0x01, 0x1a, 0x42, 0x7e, 0x81, 0x09, 0x02, 0x12, 0x44, 0xe1, 0x0a, 0x28, 0x49, 0x3b, 0x02, 0x19, 0x4e, 0x27, 0x0b, 
+	0x1b, 0x04, 0x7c, 0x1b, 0x81, 0x1c, 0x1a, 0x19, 0x26, 0x06, 0x13, 0x27, 0x13, 0x02, 0x12, 0x43, 0x1e, 0x5a, 0x13, 0x51, 0x01, 0x2c, 0x45, 0xe2, 
+	0x03, 0x28, 0xb3, 0x62, 0x9b, 0x01, 0x63, 0x4e, 0x25, 0xdd, 0x25, 0xe7, 0xa6, 0xa7, 0x0c, 0x7a, 0x3d, 0x25, 0xc0, 0xac, 0xad, 0x7c, 0xb6, 0x01, 
+	0x48, 0x43, 0x33, 0x48, 0x1c, 0xcb, 0x02, 0x33, 0x45, 0xc6, 0x02, 0x1f, 0xb2, 0x08, 0x3e, 0x01, 0x16, 0x4a, 0x7b, 0x14, 0xc9, 0x97, 0x9d, 0x9f, 
+	0x1b, 0xbf, 0xdc, 0xaa, 0xa2, 0x01, 0x46, 0x42, 0x25, 0xa5, 0x64, 0x01, 0x66, 0x42, 0x65, 0x0c, 0x47, 0x02, 0x17, 0x44, 0xb5, 0x30, 0x00, 0xb4, 
+	0x85, 0x01, 0x08, 0x42, 0x15, 0x7b, 0x72, 0x02, 0x4a, 0x42, 0x35, 0x3d, 0xf6, 0x02, 0x35, 0x01, 0x69, 0x42, 0x14, 0xe3, 0xe8, 0x02, 0x4b, 0x41, 
+	0x7d, 0x47, 0x02, 0x17, 0x45, 0xbb, 0x0e, 0x00, 0x62, 0x94, 0x11, 0x01, 0x07, 0x41, 0x59, 0x3e, 0x01, 0x16, 0x44, 0x3f, 0x86, 0x52, 0xa1, 0x40, 
+	0x01, 0x2a, 0x42, 0x41, 0x42, 0x04, 0x01, 0x60, 0x01, 0x44, 0x42, 0x45, 0x06, 0x47, 0x01, 0x17, 0x41, 0x95, 0xc5, 0x01, 0x00, 0x41, 0x84, 0xbe, 
+	0x01, 0x10, 0x4b, 0x11, 0x59, 0x15, 0x08, 0x15, 0x91, 0x16, 0x38, 0x9e, 0x5c, 0x32, 0x40, 0x01, 0x2a, 0x42, 0x0d, 0x98, 0x42, 0x01, 0x5f, 0x46, 
+	0x44, 0x0b, 0x65, 0x45, 0x93, 0xab, 0xba, 0x01, 0x00, 0x45, 0x0e, 0x68, 0x05, 0x0f, 0x10, 0x59, 0x01, 0x07, 0x01, 0x08, 0x48, 0x15, 0x38, 0x9c, 
+	0x29, 0x31, 0x5c, 0x32, 0x8e, 0x1c, 0x01, 0x41, 0x40, 0x42, 0x01, 0x43, 0x45, 0x09, 0x64, 0x45, 0x99, 0xca, 0x0a, 0x02, 0x00, 0x41, 0xa9, 0xa8, 
+	0x01, 0x05, 0x41, 0x79, 0x88, 0x02, 0x07, 0x43, 0x08, 0x72, 0xa0, 0x16, 0x01, 0x3f, 0x42, 0x8d, 0x8a, 0x01, 0x01, 0x5d, 0x01, 0x5e, 0x42, 0x8f, 
+	0x0b, 0xa3, 0x01, 0x61, 0x40, 0xd4, 0x03, 0x00, 0x41, 0x2f, 0xdf, 0x01, 0x03, 0x41, 0xf2, 0x6f, 0x03, 0x36, 0x44, 0xff, 0x6f, 0xef, 0x4e, 0xf5, 
+	0x01, 0x4e, 0x40, 0x19, 0x02, 0x4f, 0x01, 0x6c, 0x44, 0x09, 0x46, 0x43, 0xcf, 0x05, 0x04, 0x00, 0x42, 0x90, 0xcd, 0x02, 0x01, 0x03, 0x01, 0x05, 
+	0x01, 0x0f, 0x40, 0x10, 0x01, 0x11, 0x41, 0x07, 0x08, 0x01, 0x15, 0x41, 0x16, 0x29, 0x01, 0x31, 0x45, 0x32, 0x40, 0x87, 0x2a, 0xa4, 0x49, 0x06, 
+	0x00, 0x41, 0xc3, 0xb0, 0x02, 0x02, 0x01, 0x03, 0x01, 0x05, 0x41, 0x0f, 0x10, 0x01, 0x11, 0x40, 0x07, 0x01, 0x08, 0x41, 0x15, 0x16, 0x01, 0x29, 
+	0x44, 0x31, 0x32, 0x92, 0xe6, 0x1f, 0x06, 0x00, 0x43, 0x28, 0xd6, 0xaf, 0x0a, 0x02, 0x02, 0x01, 0x03, 0x42, 0x0f, 0x05, 0x0f, 0x01, 0x10, 0x40, 
+	0x11, 0x01, 0x07, 0x46, 0x08, 0x15, 0x3e, 0x29, 0x8c, 0xee, 0x30, 0x08, 0x00, 0x42, 0x1f, 0x68, 0xc7, 0x01, 0x0a, 0x01, 0x02, 0x02, 0x03, 0x01, 
+	0x05, 0x40, 0x0f, 0x01, 0x10, 0x41, 0x11, 0x07, 0x01, 0x08, 0x42, 0x9a, 0xed, 0x30, 0x0b, 0x00, 0x43, 0xb1, 0x6e, 0x89, 0x0a, 0x03, 0x02, 0x01, 
+	0x03, 0x01, 0x05, 0x01, 0x0f, 0x44, 0x11, 0x07, 0xe0, 0xd3, 0x1f, 0x0d, 0x00, 0x43, 0x0a, 0xda, 0xf3, 0xb9, 0x02, 0x0a, 0x01, 0x02, 0x01, 0x03, 
+	0x44, 0x05, 0x96, 0xe5, 0x6a, 0x83, 0x11, 0x00, 0x4b, 0x30, 0x67, 0x6a, 0xec, 0xe9, 0xe4, 0x4d, 0xea, 0x6b, 0xf1, 0xce, 0x0a, 0x16, 0x00, 0x41, 
+	0x5b, 0x0e, 0x01, 0x2f, 0x41, 0x0e, 0x28, 0x0c, 0x00
+};
+const PackedIcon graph_icon_theme = {32, 32, graph_icon_theme_palette, 256, graph_icon_theme_data, 921};
+
+// sssgraph_icon565, 32x32px, 232 colors, 1451 bytes (raw 2048)
+static const uint16_t sssgraph_icon_theme_palette [] PROGMEM = {
+	0x20e4, 0x20e3, 0x0203, 0x1eee, 0x1265, 0x1f0e, 0x0223, 0x1285, 0x1a24, 0x1a44, 0x01e2, 0x264d, 0x01c2, 0x04c7, 0x26ee, 0x266d, 
+	0x268d, 0x2e2d, 0x0466, 0x04e7, 0x1ece, 0x26ae, 0x01a2, 0x12a6, 0x260c, 0x2e4d, 0x0486, 0x1245, 0x0405, 0x04a6, 0x172b, 0x2d8b, 
+	0x2e6d, 0x0324, 0x170e, 0x1ead, 0x2dac, 0x2e8e, 0x03a4, 0x03e5, 0x12c6, 0x16ee, 0x262d, 0x26ce, 0x2dec, 0x0181, 0x0344, 0x0363, 
+	0x0384, 0x03c4, 0x0446, 0x04a7, 0x1367, 0x170b, 0x1b87, 0x02c3, 0x02e2, 0x0323, 0x0343, 0x0425, 0x0445, 0x0548, 0x0568, 0x0f4b, 
+	0x13c8, 0x1b67, 0x268e, 0x26ad, 0x2dcc, 0x0263, 0x02a3, 0x02a4, 0x02c2, 0x02e4, 0x0304, 0x0527, 0x0aa5, 0x1183, 0x1347, 0x13a8, 
+	0x16cb, 0x16eb, 0x1a04, 0x1c69, 0x1ecd, 0x2469, 0x24ea, 0x0161, 0x0182, 0x0202, 0x0222, 0x0243, 0x0262, 0x0283, 0x02e3, 0x0303, 
+	0x0364, 0x0385, 0x03e4, 0x0406, 0x0426, 0x0507, 0x0508, 0x0a22, 0x0a44, 0x0a85, 0x0aa6, 0x0ac6, 0x0b65, 0x0d87, 0x0f2a, 0x1224, 
+	0x12a5, 0x12e6, 0x1306, 0x1327, 0x1368, 0x1446, 0x15ca, 0x1608, 0x168a, 0x16aa, 0x16ed, 0x1943, 0x1963, 0x19a4, 0x19c4, 0x19e4, 
+	0x19e5, 0x1a66, 0x1aa6, 0x1ba8, 0x1c29, 0x1ca9, 0x1cca, 0x1d28, 0x1dcb, 0x2103, 0x2104, 0x248a, 0x24ca, 0x25ec, 0x260d, 0x2d4b, 
+	0x2d6b, 0x2e0d, 0x0242, 0x0244, 0x0282, 0x0284, 0x02c4, 0x0305, 0x0365, 0x03a5, 0x03c5, 0x04e8, 0x0528, 0x0547, 0x0569, 0x0588, 
+	0x0589, 0x0a24, 0x0a62, 0x0a83, 0x0ba6, 0x0c86, 0x0d08, 0x0f2b, 0x0f4a, 0x0f4c, 0x11a3, 0x11c3, 0x1203, 0x1204, 0x1244, 0x1283, 
+	0x12c3, 0x1307, 0x1387, 0x1388, 0x13e8, 0x1465, 0x1508, 0x1649, 0x166a, 0x16ca, 0x1923, 0x19c5, 0x1a25, 0x1a45, 0x1a46, 0x1a86, 
+	0x1aa7, 0x1b06, 0x1b47, 0x1ba7, 0x1be8, 0x1c47, 0x1c49, 0x1c89, 0x1cc9, 0x1d0a, 0x1d49, 0x1d6a, 0x1d6b, 0x1e2a, 0x1e2d, 0x1e6a, 
+	0x1e8d, 0x1eed, 0x2123, 0x2124, 0x2144, 0x2489, 0x24a8, 0x24aa, 0x250a, 0x252b, 0x256b, 0x258c, 0x25cb, 0x2d2b, 0x2ded, 0x2e0c, 
+	0x2e6e, 0x2e8d, 0x2eae, 0x356b, 0x358c, 0x35ac, 0x35cc, 0x360d
+};
+static const uint8_t sssgraph_icon_theme_data [] PROGMEM = {
+	0x25, 0x00, 0x42, 0x01, 0x8a, 0x7f, 0x0c, 0x08, 0x42, 0x52, 0x7e, 0x8a, 0x09, 0x00, 0x01, 0x01, 0x42, 0x09, 0x6d, 0x6e, 0x01, 0x3f, 0x03, 0x1e, 
+	0x02, 0x35, 0x49, 0x51, 0x50, 0xb9, 0x79, 0x78, 0xb8, 0xb7, 0x77, 0xb5, 0x7f, 0x07, 0x00, 0x43, 0x01, 0x75, 0xa8, 0x7a, 0x01, 0x29, 0x41, 0xd1, 
+	0x14, 0x01, 0x54, 0x01, 0x23, 0x40, 0xd0, 0x01, 0x0f, 0x41, 0x0b, 0x2a, 0x01, 0x18, 0x46, 0x8d, 0x44, 0x24, 0x1f, 0x87, 0xaf, 0x01, 0x04, 0x00, 
+	0x42, 0x01, 0x75, 0xa9, 0x01, 0x22, 0x40, 0x29, 0x02, 0x03, 0x01, 0x14, 0x41, 0x23, 0x43, 0x01, 0x10, 0x40, 0x0f, 0x01, 0x0b, 0x44, 0x2a, 0x18, 
+	0x2c, 0x44, 0x24, 0x01, 0x1f, 0x41, 0xd6, 0xac, 0x04, 0x00, 0x41, 0x09, 0x3f, 0x02, 0x22, 0x01, 0x05, 0x02, 0x03, 0x01, 0x14, 0x42, 0x43, 0x15, 
+	0x10, 0x01, 0x0f, 0x4a, 0x0b, 0x2a, 0x18, 0x2c, 0x24, 0xd5, 0x8f, 0x1f, 0x90, 0xc5, 0x7d, 0x02, 0x00, 0x42, 0x01, 0x6d, 0x7a, 0x01, 0x22, 0x03, 
+	0x05, 0x02, 0x03, 0x40, 0x2b, 0x01, 0x15, 0x43, 0x42, 0x10, 0x0f, 0x0b, 0x01, 0x11, 0x47, 0xdf, 0x41, 0x1b, 0x28, 0x1f, 0xe3, 0xd8, 0x6c, 0x01, 
+	0x00, 0x42, 0x01, 0xd2, 0x6e, 0x01, 0x29, 0x04, 0x05, 0x01, 0x03, 0x41, 0x0e, 0x2b, 0x01, 0x15, 0x43, 0x42, 0x10, 0x0f, 0x0b, 0x01, 0x11, 0x4e, 
+	0xda, 0x07, 0x1b, 0x70, 0x1f, 0x90, 0x0d, 0x33, 0xd3, 0x00, 0x01, 0x52, 0x3f, 0x29, 0x03, 0x04, 0x05, 0x40, 0x03, 0x01, 0x0e, 0x01, 0x2b, 0x43, 
+	0x15, 0x42, 0xe1, 0x20, 0x01, 0x19, 0x4d, 0x2c, 0x71, 0x1b, 0x41, 0xdd, 0xe4, 0xb6, 0x1d, 0x0d, 0x80, 0x00, 0x01, 0x09, 0xa7, 0x02, 0x03, 0x02, 
+	0x05, 0x02, 0x0e, 0x52, 0xcc, 0x86, 0x10, 0x15, 0x42, 0x25, 0x20, 0x19, 0x11, 0x41, 0x04, 0xc2, 0x24, 0xe5, 0xca, 0x0d, 0x1d, 0x13, 0xbd, 0x01, 
+	0x00, 0x42, 0x09, 0x1e, 0x14, 0x03, 0x03, 0x02, 0x0e, 0x44, 0xce, 0x6b, 0x6a, 0xb4, 0x0b, 0x01, 0x25, 0x4c, 0x20, 0x19, 0xc4, 0x04, 0xc1, 0x24, 
+	0xe6, 0xcb, 0x65, 0x0d, 0x1a, 0x66, 0x81, 0x01, 0x00, 0x41, 0x09, 0x1e, 0x01, 0x14, 0x02, 0x03, 0x01, 0x0e, 0x42, 0x15, 0x40, 0x4c, 0x01, 0x17, 
+	0x4f, 0x28, 0x53, 0x11, 0x20, 0x55, 0x04, 0x28, 0x56, 0x36, 0x34, 0x21, 0x64, 0x0d, 0x1a, 0x9c, 0xbf, 0x01, 0x00, 0x42, 0x09, 0x1e, 0x54, 0x01, 
+	0x14, 0x40, 0x03, 0x01, 0x0e, 0x49, 0x15, 0x40, 0x4c, 0x34, 0xdb, 0xc6, 0x17, 0x07, 0x28, 0x83, 0x01, 0x07, 0x42, 0x8f, 0x8c, 0x68, 0x01, 0x02, 
+	0x44, 0x61, 0x1d, 0x12, 0x3d, 0x82, 0x01, 0x00, 0x41, 0x09, 0x1e, 0x01, 0x23, 0x40, 0x14, 0x01, 0x2b, 0x4f, 0x43, 0x40, 0x17, 0x34, 0x0b, 0xe2, 
+	0x25, 0x8e, 0x84, 0x70, 0x07, 0x04, 0x8b, 0xe7, 0x85, 0x06, 0x01, 0x02, 0x44, 0x98, 0x1a, 0x12, 0x9e, 0xc0, 0x01, 0x00, 0x41, 0x09, 0x35, 0x01, 
+	0x23, 0x46, 0x43, 0x15, 0x10, 0x40, 0x6a, 0x4e, 0x84, 0x01, 0x34, 0x48, 0xb2, 0x19, 0xe0, 0xd9, 0x07, 0x28, 0x24, 0x88, 0x32, 0x01, 0x02, 0x45, 
+	0x0a, 0x60, 0x1a, 0x32, 0x3d, 0x82, 0x01, 0x00, 0x41, 0x09, 0x35, 0x01, 0x10, 0x46, 0x15, 0xc9, 0x72, 0x4c, 0x4e, 0x0b, 0x4f, 0x01, 0x17, 0x48, 
+	0x07, 0x11, 0x20, 0x19, 0x2c, 0xde, 0x76, 0x3e, 0x32, 0x01, 0x02, 0x45, 0x0a, 0x2e, 0x12, 0x3c, 0x66, 0x81, 0x01, 0x00, 0x42, 0x09, 0x51, 0x0f, 
+	0x01, 0x10, 0x46, 0x72, 0x69, 0x6b, 0x2a, 0x25, 0x4f, 0x17, 0x01, 0x07, 0x40, 0x11, 0x01, 0x19, 0x45, 0x11, 0x76, 0x9f, 0x3e, 0x64, 0x02, 0x01, 
+	0x0a, 0x44, 0x2e, 0x12, 0x3b, 0x0d, 0xbe, 0x01, 0x00, 0x41, 0x09, 0x51, 0x01, 0x0f, 0x43, 0x10, 0x53, 0x17, 0x53, 0x01, 0x25, 0x40, 0xc3, 0x02, 
+	0x07, 0x4f, 0x91, 0x11, 0x28, 0x95, 0x45, 0x21, 0x9d, 0x63, 0x02, 0x0a, 0x0c, 0x21, 0x3c, 0x1c, 0x1a, 0xbc, 0x01, 0x00, 0x41, 0x09, 0x50, 0x01, 
+	0x0b, 0x01, 0x0f, 0x40, 0x0b, 0x02, 0x20, 0x40, 0x36, 0x01, 0x07, 0x43, 0x04, 0x2c, 0x18, 0x5b, 0x01, 0x06, 0x43, 0x49, 0x4b, 0x1c, 0x0a, 0x01, 
+	0x0c, 0x44, 0x21, 0x3b, 0x1c, 0x32, 0x80, 0x01, 0x00, 0x42, 0x09, 0x50, 0x2a, 0x01, 0x0b, 0x01, 0x18, 0x40, 0x8e, 0x01, 0x19, 0x41, 0x36, 0x07, 
+	0x01, 0x04, 0x41, 0xdc, 0xa0, 0x02, 0x06, 0x43, 0x96, 0x65, 0x27, 0x0a, 0x01, 0x0c, 0x44, 0x4a, 0x1c, 0x62, 0x27, 0x7e, 0x01, 0x00, 0x4a, 0x09, 
+	0x79, 0x18, 0x2a, 0x86, 0x69, 0x07, 0x04, 0x56, 0x11, 0x36, 0x01, 0x04, 0x40, 0x68, 0x01, 0x3e, 0x01, 0x06, 0x43, 0x02, 0x47, 0x13, 0x9a, 0x01, 
+	0x0c, 0x45, 0x16, 0x5e, 0x27, 0x31, 0x26, 0x7d, 0x01, 0x00, 0x41, 0x08, 0x78, 0x01, 0x18, 0x40, 0x85, 0x02, 0x04, 0x45, 0x8c, 0x11, 0x41, 0x04, 
+	0x93, 0x06, 0x01, 0x3d, 0x02, 0x02, 0x43, 0x47, 0x0d, 0x99, 0x0c, 0x01, 0x16, 0x44, 0x5e, 0x31, 0x26, 0x2f, 0x7c, 0x01, 0x00, 0x44, 0x08, 0xcf, 
+	0x8d, 0x2c, 0xc7, 0x02, 0x04, 0x43, 0xd7, 0x91, 0x4e, 0x5b, 0x01, 0x06, 0x01, 0x4b, 0x01, 0x02, 0x43, 0x0a, 0x5d, 0x1d, 0x61, 0x01, 0x16, 0x45, 
+	0x58, 0x37, 0x26, 0x30, 0x39, 0x7c, 0x01, 0x00, 0x41, 0x52, 0xcd, 0x01, 0x44, 0x40, 0x55, 0x01, 0x1b, 0x43, 0x04, 0x8b, 0x88, 0x97, 0x01, 0x06, 
+	0x40, 0x02, 0x01, 0x13, 0x40, 0x59, 0x01, 0x0a, 0x42, 0x45, 0x12, 0x60, 0x01, 0x16, 0x45, 0x2d, 0x46, 0x30, 0x2f, 0x38, 0x7b, 0x01, 0x00, 0x44, 
+	0xd4, 0x77, 0x24, 0x1f, 0x83, 0x01, 0x1b, 0x44, 0xae, 0xa4, 0x12, 0x47, 0x06, 0x01, 0x02, 0x01, 0x27, 0x40, 0x0a, 0x01, 0x0c, 0x43, 0x06, 0x30, 
+	0x37, 0x16, 0x01, 0x2d, 0x40, 0x5a, 0x01, 0x3a, 0x41, 0x48, 0xba, 0x02, 0x00, 0x42, 0xa5, 0x1f, 0x55, 0x01, 0x1b, 0x41, 0xa1, 0x06, 0x04, 0x02, 
+	0x02, 0x0a, 0x02, 0x0c, 0x01, 0x16, 0x40, 0x58, 0x01, 0x2d, 0x01, 0x57, 0x43, 0x5c, 0x5f, 0xa2, 0x01, 0x02, 0x00, 0x44, 0x09, 0x87, 0x56, 0x36, 
+	0x6c, 0x02, 0x2e, 0x02, 0x21, 0x01, 0x4a, 0x01, 0x49, 0x01, 0x37, 0x01, 0x46, 0x45, 0x5d, 0x45, 0x5c, 0x92, 0x5a, 0x59, 0x01, 0x48, 0x41, 0x4d, 
+	0x01, 0x03, 0x00, 0x42, 0xb0, 0xc8, 0xa6, 0x03, 0x13, 0x01, 0x0d, 0x01, 0x1d, 0x40, 0x1a, 0x01, 0x12, 0x4c, 0x3c, 0x3b, 0x1c, 0x27, 0x31, 0x26, 
+	0x30, 0x2f, 0x3a, 0x39, 0x38, 0x67, 0x01, 0x04, 0x00, 0x43, 0x89, 0xa3, 0x12, 0x0d, 0x01, 0x33, 0x01, 0x1d, 0x01, 0x1a, 0x01, 0x12, 0x41, 0x3c, 
+	0x3b, 0x01, 0x1c, 0x49, 0x62, 0x31, 0x26, 0x30, 0x2f, 0x3a, 0x39, 0x38, 0x67, 0x89, 0x05, 0x00, 0x44, 0x01, 0x00, 0x6f, 0x63, 0x33, 0x02, 0x0d, 
+	0x01, 0x13, 0x4e, 0x9b, 0x13, 0x33, 0x1a, 0x32, 0x1c, 0x31, 0x26, 0x2f, 0x39, 0x5f, 0x38, 0x94, 0xaa, 0x01, 0x0a, 0x00, 0x4e, 0xbb, 0x17, 0xb1, 
+	0x73, 0x74, 0xb3, 0x4f, 0x74, 0x73, 0x71, 0x17, 0x04, 0x6f, 0xad, 0xab, 0x01, 0x4d, 0x41, 0x7b, 0x01, 0x0d, 0x00, 0x09, 0x01, 0x02, 0x00, 0x02, 
+	0x01, 0x07, 0x00
+};
+const PackedIcon sssgraph_icon_theme = {32, 32, sssgraph_icon_theme_palette, 232, sssgraph_icon_theme_data, 987};
+
+// cyborg_icon565, 32x32px, 256 colors, 1308 bytes (raw 2048)
+static const uint16_t cyborg_icon_theme_palette [] PROGMEM = {
+	0x0000, 0xfba0, 0x0820, 0xc980, 0xfb20, 0xfb80, 0xfbe0, 0xc160, 0xfb40, 0xfca0, 0x1840, 0xb940, 0xea40, 0xfc20, 0xfc40, 0x0800, 
+	0x2860, 0x879f, 0xc960, 0xd1a0, 0xd9e0, 0xf200, 0xfaa0, 0xfc00, 0xfc80, 0xfd20, 0xfdc0, 0x00a4, 0x0106, 0x11c9, 0x11ea, 0x1a0a, 
+	0xa960, 0xb120, 0xd180, 0xd9c0, 0xdae0, 0xdb40, 0xe220, 0xfa80, 0xfac0, 0xfb60, 0xfc60, 0xfcc0, 0xfd00, 0xfd22, 0xfd60, 0xfda0, 
+	0xffdc, 0x0083, 0x0926, 0x0947, 0x1167, 0x11a8, 0x222a, 0x23d2, 0x2a29, 0x2aac, 0x2b70, 0x2b90, 0x3e3c, 0x4080, 0x4144, 0x48c0, 
+	0x5a26, 0x5efe, 0x60c0, 0x82a4, 0x8940, 0x98e0, 0x9f9f, 0xb140, 0xb160, 0xb1c0, 0xb2e3, 0xb920, 0xb960, 0xba60, 0xba62, 0xba80, 
+	0xc140, 0xc1a0, 0xc241, 0xc2c2, 0xc9a0, 0xc9c0, 0xc9e0, 0xca00, 0xca80, 0xcb63, 0xcbc3, 0xd1c0, 0xd1e0, 0xd200, 0xd260, 0xd2c0, 
+	0xda00, 0xda20, 0xdba2, 0xe300, 0xe360, 0xe9e0, 0xf260, 0xf421, 0xfb00, 0xfb81, 0xfbc0, 0xfbc1, 0xfcc1, 0xfcc2, 0xfce0, 0xfce2, 
+	0xfd01, 0xfd02, 0xfd21, 0xfd40, 0xfd66, 0xfd80, 0xfe86, 0xfeca, 0xff32, 0xff75, 0xff76, 0x00c4, 0x00e5, 0x0168, 0x0840, 0x0883, 
+	0x0905, 0x0906, 0x0927, 0x0946, 0x0967, 0x0968, 0x09c9, 0x1020, 0x1040, 0x122b, 0x128d, 0x13f3, 0x14d7, 0x1947, 0x19c9, 0x19ca, 
+	0x19e9, 0x19ea, 0x1a0b, 0x1a2a, 0x1a2b, 0x1a6c, 0x1acd, 0x1b4f, 0x1c75, 0x2080, 0x20c1, 0x21c8, 0x2209, 0x220a, 0x226b, 0x228c, 
+	0x22ad, 0x22cd, 0x234f, 0x2391, 0x25ba, 0x2840, 0x2880, 0x28c0, 0x28e0, 0x2945, 0x2966, 0x29c8, 0x29e8, 0x2aed, 0x2d79, 0x2d99, 
+	0x3080, 0x30a0, 0x3104, 0x3122, 0x31a6, 0x31c6, 0x326a, 0x32ac, 0x3350, 0x3390, 0x33b1, 0x33d2, 0x3454, 0x361c, 0x3880, 0x3944, 
+	0x3945, 0x3962, 0x3985, 0x3cb5, 0x40c0, 0x42cb, 0x43d1, 0x4517, 0x463c, 0x48a0, 0x4980, 0x49a5, 0x49c3, 0x4a28, 0x4a68, 0x4a88, 
+	0x4a8a, 0x4baf, 0x4e7d, 0x4e9d, 0x50c0, 0x5100, 0x5144, 0x5181, 0x5205, 0x532b, 0x532c, 0x5557, 0x5578, 0x5598, 0x55da, 0x565c, 
+	0x56de, 0x58c0, 0x5940, 0x5984, 0x5a05, 0x5a47, 0x5e5c, 0x5ebd, 0x5ede, 0x60a1, 0x6143, 0x6222, 0x6266, 0x6267, 0x6287, 0x671e, 
+	0x68c0, 0x6900, 0x6962, 0x69a2, 0x6bcd, 0x70c0, 0x7100, 0x7120, 0x7180, 0x71a0, 0x71c5, 0x7223, 0x7246, 0x7285, 0x72a4, 0x732b
+};
+static const uint8_t cyborg_icon_theme_data [] PROGMEM = {
+	0x29, 0x00, 0x4a, 0x02, 0xd7, 0x43, 0x5a, 0x67, 0x01, 0x04, 0x5d, 0x20, 0x42, 0x0a, 0x12, 0x00, 0x41, 0x02, 0xfe, 0x01, 0x77, 0x4a, 0x74, 0x72, 
+	0x09, 0x0d, 0x05, 0x68, 0x16, 0x0c, 0x5b, 0x44, 0xa5, 0x0f, 0x00, 0x42, 0xb3, 0x77, 0x7a, 0x01, 0x78, 0x4c, 0x77, 0x19, 0x2e, 0x2b, 0x0d, 0x01, 
+	0x04, 0x16, 0x0c, 0x23, 0x12, 0xf5, 0x0f, 0x0c, 0x00, 0x41, 0xcc, 0x78, 0x01, 0x30, 0x4f, 0x7a, 0x78, 0x77, 0x76, 0x1a, 0x19, 0x09, 0x17, 0x05, 
+	0x04, 0x16, 0x0c, 0x5b, 0x07, 0x45, 0x87, 0x0a, 0x00, 0x42, 0xc1, 0x78, 0x7a, 0x01, 0x30, 0x42, 0x7a, 0x78, 0x77, 0x01, 0x1a, 0x4b, 0x19, 0x09, 
+	0x17, 0x01, 0x08, 0x68, 0x27, 0x26, 0x22, 0x07, 0x20, 0x0f, 0x08, 0x00, 0x43, 0x7e, 0x74, 0x77, 0x78, 0x01, 0x79, 0x50, 0x78, 0x77, 0x76, 0x1a, 
+	0x75, 0x2c, 0x18, 0x06, 0x01, 0x08, 0x04, 0x28, 0x66, 0x14, 0x12, 0x03, 0x44, 0x08, 0x00, 0x40, 0x43, 0x05, 0x77, 0x50, 0x76, 0x1a, 0x2f, 0x73, 
+	0x09, 0x0e, 0x6a, 0x05, 0x08, 0x04, 0x28, 0x66, 0x26, 0x13, 0x03, 0x22, 0xb0, 0x06, 0x00, 0x40, 0x02, 0x05, 0x74, 0x47, 0x2d, 0x72, 0x75, 0x19, 
+	0x2b, 0x0e, 0x06, 0x01, 0x01, 0x29, 0x01, 0x06, 0x42, 0x05, 0x04, 0x0c, 0x01, 0x03, 0x40, 0x20, 0x06, 0x00, 0x44, 0xca, 0x2d, 0x74, 0x77, 0x76, 
+	0x01, 0x1a, 0x52, 0x73, 0x0e, 0x6a, 0x2a, 0x0d, 0x06, 0x01, 0x05, 0x67, 0x74, 0x09, 0x17, 0x05, 0x08, 0x04, 0x14, 0x07, 0x23, 0x02, 0x05, 0x00, 
+	0x41, 0x43, 0x77, 0x02, 0x2d, 0x01, 0x59, 0x52, 0x67, 0x0d, 0x01, 0x04, 0x01, 0x05, 0x08, 0x67, 0x74, 0x71, 0x09, 0x62, 0x53, 0x24, 0x0c, 0x14, 
+	0x03, 0x12, 0x3f, 0x05, 0x00, 0x59, 0x5a, 0x78, 0x2d, 0x4a, 0xb6, 0x8a, 0x1e, 0x8d, 0x44, 0x6b, 0x04, 0x16, 0x04, 0x08, 0x74, 0x2d, 0x59, 0xd0, 
+	0x97, 0xa2, 0x9e, 0xd6, 0x20, 0x07, 0x12, 0x44, 0x03, 0x00, 0x41, 0x02, 0xeb, 0x01, 0x2d, 0x58, 0x43, 0xa3, 0xdc, 0x11, 0xdf, 0x37, 0x85, 0xfb, 
+	0x6b, 0x27, 0x15, 0x01, 0x70, 0x59, 0x3a, 0xc7, 0x11, 0xe7, 0xbc, 0x1d, 0x3e, 0x45, 0x07, 0x23, 0xd5, 0x01, 0x00, 0x40, 0x9a, 0x01, 0x74, 0x63, 
+	0x09, 0x62, 0xad, 0xdb, 0x30, 0x46, 0x11, 0x46, 0xb8, 0x32, 0x59, 0x28, 0x15, 0x01, 0x6c, 0xda, 0xc3, 0x30, 0x46, 0x11, 0x46, 0xc6, 0x33, 0xe9, 
+	0x21, 0x0b, 0x5a, 0x58, 0x00, 0x43, 0x2d, 0x5a, 0x62, 0x4a, 0x3a, 0xde, 0x02, 0x11, 0x4a, 0x46, 0xbb, 0x82, 0xfc, 0x06, 0x65, 0x67, 0x62, 0xa1, 
+	0xae, 0x46, 0x01, 0x11, 0x7f, 0x46, 0xba, 0x1b, 0xc0, 0x45, 0x0b, 0x53, 0x0c, 0xc4, 0xf8, 0x01, 0x62, 0x25, 0x43, 0x89, 0x98, 0x3c, 0x41, 0xef, 
+	0xe0, 0x3b, 0x1c, 0xe3, 0x6d, 0x65, 0x67, 0x4d, 0x90, 0x8b, 0xc8, 0x41, 0xe8, 0xd2, 0x37, 0x31, 0xb2, 0x45, 0x4b, 0x52, 0x60, 0x3d, 0xf6, 0x63, 
+	0x52, 0x24, 0x53, 0x38, 0x86, 0xaf, 0xbd, 0xd3, 0xdd, 0x84, 0x7b, 0x43, 0x6d, 0x15, 0x67, 0x4d, 0xcd, 0x7d, 0x8c, 0xa4, 0x3c, 0x69, 0xe6, 0x34, 
+	0x1b, 0x3e, 0x20, 0x4b, 0x48, 0x54, 0x3d, 0x42, 0x14, 0x4d, 0x58, 0x62, 0xff, 0x35, 0x32, 0x96, 0x93, 0x7c, 0x1c, 0xd1, 0x59, 0x2c, 0x15, 0x6c, 
+	0x64, 0x43, 0x1f, 0x83, 0x3b, 0xb9, 0x81, 0x1b, 0xb7, 0xfa, 0x0b, 0x21, 0x20, 0x50, 0xc9, 0xf0, 0x01, 0x03, 0x60, 0x58, 0x06, 0x59, 0xfc, 0xc5, 
+	0x8e, 0x1d, 0x39, 0xf4, 0x4a, 0x2d, 0x19, 0x67, 0x6e, 0x0e, 0x58, 0x4a, 0xd9, 0x1f, 0x35, 0x9c, 0xf4, 0x43, 0x47, 0x07, 0x4c, 0x20, 0x07, 0x3f, 
+	0xd4, 0x13, 0x49, 0x4d, 0x01, 0x01, 0x41, 0x62, 0x5a, 0x01, 0x59, 0x01, 0x5a, 0x48, 0x6f, 0x2b, 0x09, 0x18, 0x0e, 0x17, 0x01, 0x63, 0x53, 0x02, 
+	0x59, 0x53, 0x52, 0x5c, 0x03, 0x4e, 0x74, 0x48, 0x22, 0x10, 0x00, 0x20, 0x61, 0x20, 0x63, 0x05, 0x01, 0x06, 0x2a, 0x6e, 0x70, 0x6d, 0x02, 0x2d, 
+	0x4a, 0x71, 0x6f, 0x6c, 0x2a, 0x0d, 0x6b, 0x69, 0x04, 0x27, 0x26, 0x54, 0x01, 0x0b, 0x42, 0x21, 0x55, 0xf6, 0x02, 0x00, 0x4b, 0xb1, 0x56, 0x48, 
+	0x57, 0x24, 0x29, 0x06, 0x18, 0x06, 0x74, 0x2e, 0x2f, 0x01, 0x1a, 0x4d, 0x2f, 0x2e, 0x2c, 0x18, 0x63, 0x69, 0x28, 0x0c, 0x13, 0x50, 0x47, 0x56, 
+	0x5e, 0x0a, 0x04, 0x00, 0x47, 0xa6, 0x44, 0x49, 0x5d, 0x60, 0x61, 0x5e, 0x5f, 0x01, 0x24, 0x01, 0x25, 0x40, 0x63, 0x03, 0x24, 0x48, 0x5e, 0x57, 
+	0x51, 0x55, 0x5c, 0x61, 0x4d, 0xf7, 0x0a, 0x09, 0x00, 0x45, 0x10, 0xe1, 0x44, 0x49, 0x52, 0x4d, 0x01, 0x4e, 0x42, 0x4a, 0x4e, 0x4d, 0x03, 0x49, 
+	0x43, 0x44, 0xf1, 0xbe, 0x02, 0x0e, 0x00, 0x4d, 0x80, 0x1c, 0xce, 0xaa, 0x1d, 0x1f, 0x39, 0x9f, 0x1e, 0x33, 0xa9, 0xcf, 0x31, 0x7f, 0x0e, 0x00, 
+	0x45, 0x0a, 0x4d, 0x43, 0xab, 0x36, 0xfa, 0x01, 0x59, 0x43, 0x4a, 0xfd, 0x43, 0x4a, 0x01, 0x24, 0x45, 0x43, 0x34, 0xbf, 0x44, 0x4f, 0xa8, 0x0b, 
+	0x00, 0x53, 0x02, 0x25, 0x5a, 0xfd, 0x38, 0x92, 0x9b, 0xcb, 0xf2, 0x4a, 0x43, 0xea, 0xc2, 0x9d, 0x91, 0xb4, 0xf3, 0x07, 0x4c, 0x0f, 0x0c, 0x00, 
+	0x51, 0xa7, 0x63, 0x5a, 0x43, 0xee, 0xac, 0x8f, 0x1e, 0x94, 0x95, 0xa0, 0x36, 0xb5, 0xd8, 0xfb, 0x51, 0x03, 0x10, 0x0e, 0x00, 0x4f, 0x99, 0x4f, 
+	0x64, 0x4a, 0x43, 0x40, 0xe5, 0xed, 0xec, 0x40, 0xe4, 0x43, 0x4e, 0x13, 0x51, 0x10, 0x10, 0x00, 0x44, 0x02, 0xf8, 0x5f, 0x64, 0x67, 0x01, 0x5a, 
+	0x46, 0x59, 0x25, 0x63, 0x5e, 0x5d, 0xf7, 0x0f, 0x13, 0x00, 0x49, 0x0a, 0xf9, 0x49, 0x5f, 0x25, 0x24, 0x53, 0x20, 0xe2, 0x02, 0x19, 0x00, 0x41, 
+	0x88, 0x02, 0x0e, 0x00
+};
+const PackedIcon cyborg_icon_theme = {32, 32, cyborg_icon_theme_palette, 256, cyborg_icon_theme_data, 796};
+
+// race_icon565, 32x32px, 227 colors, 1302 bytes (raw 2048)
+static const uint16_t race_icon_theme_palette [] PROGMEM = {
+	0x0000, 0xf800, 0xf820, 0xf841, 0xfc30, 0xf861, 0xfb8e, 0xfcf3, 0x0841, 0xf882, 0xf924, 0xf965, 0xfdd7, 0x10a2, 0xfa28, 0xfa8a, 
+	0x0020, 0xf840, 0xf8e3, 0xfaeb, 0xfb0c, 0xf8c3, 0x2000, 0x5000, 0xf8a2, 0xf9a6, 0xfa08, 0x2965, 0x5820, 0xf020, 0xfa89, 0xfb0b, 
+	0xfeba, 0x0861, 0x18c3, 0x2800, 0x4208, 0x6820, 0x6841, 0xbdd7, 0xe73c, 0xef5d, 0xfa69, 0xfe9a, 0x1082, 0x2945, 0x3020, 0x3186, 
+	0x31a6, 0x5aeb, 0x6000, 0x632c, 0x6b4d, 0x7020, 0x7061, 0x73ae, 0x9cf3, 0xc020, 0xc186, 0xc820, 0xca69, 0xf000, 0xf821, 0xf8a3, 
+	0xfc51, 0x0820, 0x1841, 0x2841, 0x39c7, 0x39e7, 0x4a49, 0x4a69, 0x5020, 0x528a, 0x5800, 0x5acb, 0x6021, 0x6041, 0x630c, 0x6882, 
+	0x7bef, 0x8020, 0x8410, 0x8820, 0x8c51, 0x9104, 0x9492, 0x9800, 0xad55, 0xb5b6, 0xb8e3, 0xbbef, 0xc000, 0xc165, 0xc166, 0xc800, 
+	0xc904, 0xce79, 0xd000, 0xdefb, 0xe000, 0xe020, 0xe041, 0xf3ae, 0xf862, 0xf945, 0xf9c7, 0xfacb, 0xfb6d, 0xfcd3, 0xfd14, 0xfd34, 
+	0xfdb6, 0xfdb7, 0x0800, 0x0821, 0x18c2, 0x18e3, 0x2041, 0x2104, 0x2820, 0x3082, 0x4041, 0x4165, 0x5061, 0x5145, 0x6020, 0x62aa, 
+	0x6800, 0x68a2, 0x6b0c, 0x7041, 0x70a2, 0x7820, 0x7904, 0x80e3, 0x8104, 0x81c7, 0x8c71, 0x9020, 0x9041, 0x90c3, 0x91e7, 0x94b2, 
+	0x9841, 0x9882, 0x98a2, 0x98e3, 0x9924, 0x9aaa, 0x9cd3, 0xa000, 0xa061, 0xa28a, 0xa34d, 0xa36d, 0xa8a2, 0xa945, 0xa986, 0xaa8a, 
+	0xab4d, 0xb000, 0xb0e3, 0xb104, 0xb228, 0xb2eb, 0xb534, 0xb596, 0xb800, 0xb820, 0xb841, 0xb882, 0xb8a2, 0xb8e4, 0xb904, 0xb945, 
+	0xb965, 0xc041, 0xc0c2, 0xc2aa, 0xc2eb, 0xc38e, 0xc3cf, 0xc5f7, 0xc618, 0xc8e3, 0xc924, 0xcb0c, 0xce59, 0xd041, 0xd0e3, 0xd104, 
+	0xd28a, 0xd38e, 0xd69a, 0xd6ba, 0xd820, 0xd904, 0xd9c7, 0xdb2d, 0xdedb, 0xe104, 0xe71c, 0xe800, 0xe821, 0xe841, 0xe8e3, 0xe9a6, 
+	0xeb6d, 0xf041, 0xf0a2, 0xf0e3, 0xf208, 0xf3cf, 0xf3ef, 0xf8c2, 0xf8e4, 0xf904, 0xf986, 0xf9a7, 0xfa49, 0xfb2c, 0xfb4d, 0xfbae, 
+	0xfd55, 0xfe18, 0xfedb
+};
+static const uint8_t race_icon_theme_data [] PROGMEM = {
+	0x0d, 0x00, 0x40, 0x0d, 0x01, 0x10, 0x41, 0x2c, 0x24, 0x16, 0x00, 0x4b, 0x08, 0x16, 0x4f, 0x92, 0xad, 0x60, 0xbf, 0x5a, 0x9e, 0x86, 0x16, 0x21, 
+	0x11, 0x00, 0x4f, 0x08, 0x17, 0x5e, 0x6c, 0x40, 0x04, 0x06, 0x1f, 0x13, 0x06, 0x04, 0x40, 0xde, 0xb0, 0x17, 0x08, 0x0d, 0x00, 0x48, 0x1b, 0x2e, 
+	0x3a, 0x07, 0x71, 0x07, 0x04, 0x06, 0x1f, 0x01, 0x0f, 0x48, 0x1f, 0x06, 0x04, 0x07, 0x70, 0x6d, 0x3a, 0x2e, 0x1b, 0x0a, 0x00, 0x55, 0x0d, 0x4d, 
+	0xd6, 0x2b, 0x70, 0x07, 0x04, 0x06, 0x14, 0x1e, 0x0e, 0x1a, 0x0f, 0x14, 0x06, 0x04, 0x07, 0x0c, 0x2b, 0x67, 0x4c, 0x0d, 0x08, 0x00, 0x4a, 0x0d, 
+	0x36, 0x6f, 0x20, 0x0c, 0x07, 0x04, 0x06, 0x13, 0x2a, 0x0e, 0x01, 0x19, 0x4a, 0x0e, 0x0f, 0x1f, 0xdf, 0x04, 0x07, 0x0c, 0x20, 0x6e, 0x36, 0x0d, 
+	0x06, 0x00, 0x4b, 0x2d, 0x4c, 0x6f, 0x20, 0x0c, 0x07, 0x04, 0x06, 0x13, 0x6b, 0xdc, 0x19, 0x01, 0x0b, 0x4b, 0x6a, 0x1a, 0x6b, 0x14, 0x06, 0x04, 
+	0x07, 0x0c, 0xe2, 0x6e, 0x1c, 0x1b, 0x05, 0x00, 0x4b, 0x23, 0xd5, 0x20, 0x0c, 0x07, 0x04, 0x06, 0x13, 0x1e, 0x13, 0x2a, 0x0b, 0x01, 0x0a, 0x4b, 
+	0x0b, 0x1a, 0x0e, 0x1e, 0x14, 0x06, 0x04, 0xe0, 0xe1, 0x20, 0x67, 0x23, 0x04, 0x00, 0x4c, 0x08, 0x3a, 0x2b, 0x0c, 0x07, 0x04, 0x06, 0x13, 0x2a, 
+	0x0e, 0x19, 0x0b, 0x0a, 0x01, 0x12, 0x4c, 0x69, 0xda, 0x19, 0x0e, 0x0f, 0x13, 0x06, 0x04, 0x07, 0x0c, 0x2b, 0x5d, 0x08, 0x03, 0x00, 0x4c, 0x17, 
+	0x07, 0x0c, 0x07, 0x04, 0x06, 0x14, 0x0f, 0x0e, 0x55, 0x0b, 0x0a, 0x12, 0x01, 0x15, 0x4c, 0x12, 0x0a, 0x0b, 0x55, 0x0e, 0x0f, 0x14, 0x06, 0x04, 
+	0x07, 0x0c, 0x6d, 0x48, 0x02, 0x00, 0x4c, 0x08, 0x5e, 0x71, 0x07, 0x04, 0x06, 0x14, 0x0f, 0x1a, 0x5d, 0x00, 0xa2, 0xd8, 0x01, 0x18, 0x4e, 0x09, 
+	0x18, 0x12, 0xc5, 0x72, 0x94, 0x1a, 0x2a, 0x14, 0x06, 0x04, 0x07, 0x0c, 0xaf, 0x21, 0x01, 0x00, 0x5d, 0x16, 0x6c, 0x07, 0x04, 0x06, 0x13, 0x0f, 
+	0x0e, 0x3c, 0x82, 0x00, 0x79, 0x15, 0x18, 0x68, 0x05, 0x18, 0x15, 0x7c, 0x21, 0x46, 0xb4, 0xd4, 0x0f, 0x1f, 0x06, 0x04, 0x07, 0xdd, 0x16, 0x01, 
+	0x00, 0x4d, 0x84, 0x40, 0x04, 0xd0, 0x8e, 0xa0, 0x5b, 0x76, 0x8a, 0xca, 0x50, 0x54, 0x8d, 0x09, 0x01, 0x03, 0x4a, 0x05, 0xb2, 0x34, 0x56, 0x61, 
+	0x59, 0x42, 0x9a, 0x5b, 0x89, 0xc7, 0x01, 0x04, 0x40, 0x26, 0x01, 0x00, 0x4d, 0x91, 0x04, 0xc1, 0xb7, 0x77, 0x31, 0x29, 0x46, 0x45, 0x33, 0x47, 
+	0xc2, 0x42, 0xcd, 0x02, 0x03, 0x60, 0x7d, 0x27, 0x37, 0x24, 0x31, 0x2d, 0x28, 0x4e, 0x08, 0x27, 0xb6, 0x04, 0x9d, 0x00, 0x0d, 0xae, 0xbb, 0x22, 
+	0x63, 0x52, 0x58, 0x34, 0x2f, 0x28, 0x52, 0x75, 0x49, 0x00, 0x26, 0x3e, 0x02, 0x8c, 0x00, 0x01, 0x30, 0x69, 0x4b, 0x29, 0x49, 0x47, 0x59, 0x37, 
+	0x28, 0x2f, 0x9f, 0x5a, 0x22, 0x10, 0xba, 0xc0, 0x00, 0x33, 0x00, 0xa7, 0x27, 0x44, 0x56, 0x34, 0x27, 0xb8, 0x7a, 0x51, 0x3b, 0xcc, 0x7e, 0x25, 
+	0x38, 0xc8, 0x4b, 0x38, 0x24, 0x8f, 0x61, 0x08, 0x31, 0x08, 0xa4, 0x60, 0x01, 0x10, 0x6f, 0xbe, 0x1e, 0x99, 0x28, 0x45, 0x96, 0x10, 0x37, 0x63, 
+	0x0d, 0x24, 0xb5, 0xd1, 0x1d, 0x1c, 0x35, 0xc4, 0x03, 0xb3, 0x4e, 0x10, 0xbc, 0x38, 0x00, 0x54, 0x44, 0xc3, 0x9b, 0x1e, 0xb9, 0x08, 0x2c, 0xac, 
+	0x0e, 0xcf, 0xa6, 0x33, 0x29, 0x7f, 0x81, 0x3c, 0xa3, 0xbd, 0x11, 0x02, 0x3e, 0x8b, 0x80, 0x02, 0x02, 0x54, 0x66, 0x9c, 0x3c, 0x88, 0x7b, 0x29, 
+	0x50, 0x58, 0xc6, 0x1a, 0xab, 0x22, 0x00, 0x98, 0x19, 0x0b, 0x93, 0x00, 0x95, 0xc9, 0x09, 0x01, 0x03, 0x53, 0x11, 0x05, 0x03, 0x02, 0x4a, 0x1c, 
+	0x1d, 0x02, 0x09, 0x05, 0x03, 0x05, 0x09, 0xd2, 0xa5, 0x08, 0x4f, 0x0b, 0x6a, 0x90, 0x01, 0x00, 0x40, 0x87, 0x01, 0x0a, 0x43, 0x12, 0x4d, 0xd3, 
+	0x09, 0x01, 0x03, 0x01, 0x02, 0x49, 0x69, 0x0a, 0xa1, 0x57, 0x5f, 0x51, 0x05, 0x03, 0x02, 0x11, 0x01, 0x03, 0x43, 0x0b, 0xdb, 0x26, 0xce, 0x01, 
+	0x0a, 0x40, 0x26, 0x01, 0x00, 0x47, 0x16, 0xd7, 0x12, 0x3f, 0x15, 0x09, 0x05, 0x03, 0x02, 0x02, 0x42, 0x11, 0x1d, 0x1c, 0x01, 0x01, 0x42, 0x83, 
+	0x66, 0x01, 0x02, 0x02, 0x41, 0x03, 0x05, 0x01, 0x09, 0x43, 0x15, 0x12, 0x3f, 0x43, 0x01, 0x00, 0x45, 0x08, 0xb1, 0x3f, 0x18, 0x09, 0x05, 0x01, 
+	0x03, 0x03, 0x02, 0x41, 0x53, 0x39, 0x01, 0x01, 0x42, 0x65, 0x25, 0x01, 0x02, 0x02, 0x02, 0x03, 0x01, 0x09, 0x42, 0x15, 0xaa, 0x21, 0x02, 0x00, 
+	0x40, 0x17, 0x01, 0x05, 0x02, 0x03, 0x01, 0x02, 0x01, 0x01, 0x41, 0x64, 0x25, 0x03, 0x01, 0x45, 0x53, 0x3b, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 
+	0x01, 0x05, 0x40, 0x17, 0x03, 0x00, 0x41, 0x73, 0x3b, 0x01, 0x03, 0x40, 0x11, 0x01, 0x02, 0x02, 0x01, 0x41, 0x35, 0x64, 0x03, 0x01, 0x42, 0x3d, 
+	0x1c, 0x02, 0x02, 0x01, 0x45, 0x3e, 0x11, 0x03, 0x05, 0x39, 0x41, 0x04, 0x00, 0x41, 0x23, 0x1d, 0x01, 0x03, 0x01, 0x02, 0x02, 0x01, 0x42, 0xcb, 
+	0x05, 0x02, 0x03, 0x01, 0x40, 0x65, 0x02, 0x01, 0x01, 0x02, 0x01, 0x05, 0x41, 0x1d, 0x23, 0x05, 0x00, 0x44, 0x2d, 0x32, 0x01, 0x0b, 0xd9, 0x03, 
+	0x01, 0x41, 0x11, 0x03, 0x03, 0x01, 0x01, 0x0a, 0x03, 0x01, 0x44, 0x11, 0x68, 0x01, 0x4a, 0x1b, 0x06, 0x00, 0x43, 0x0d, 0x85, 0x05, 0x02, 0x02, 
+	0x01, 0x41, 0x02, 0x11, 0x04, 0x01, 0x41, 0x03, 0x02, 0x02, 0x01, 0x44, 0x02, 0x05, 0x01, 0x35, 0x74, 0x08, 0x00, 0x42, 0x0d, 0x32, 0x3d, 0x0f, 
+	0x01, 0x42, 0x3d, 0x32, 0x22, 0x0a, 0x00, 0x42, 0x1b, 0x2e, 0x5f, 0x0d, 0x01, 0x42, 0x5c, 0x78, 0x2f, 0x0d, 0x00, 0x42, 0x08, 0x48, 0x5c, 0x09, 
+	0x01, 0x42, 0x39, 0x17, 0x41, 0x11, 0x00, 0x44, 0x08, 0x16, 0x25, 0x97, 0xa8, 0x01, 0x62, 0x44, 0xa9, 0x57, 0x36, 0x43, 0x08, 0x17, 0x00, 0x40, 
+	0x2c, 0x01, 0x10, 0x41, 0x0d, 0x30, 0x0c, 0x00
+};
+const PackedIcon race_icon_theme = {32, 32, race_icon_theme_palette, 227, race_icon_theme_data, 848};
+
+// car_icon565, 32x32px, 140 colors, 1325 bytes (raw 2048)
+static const uint16_t car_icon_theme_palette [] PROGMEM = {
+	0x0223, 0x0000, 0x0325, 0x0305, 0x0020, 0x0203, 0x0264, 0x02e5, 0x01e3, 0x00a1, 0x0284, 0x0040, 0x0142, 0x00c1, 0x0385, 0x03c6, 
+	0x0224, 0x0162, 0x01c3, 0x02a4, 0x04a8, 0x0122, 0x0345, 0x00e1, 0x0060, 0x0061, 0x03a6, 0x03e6, 0x0447, 0x06cc, 0x0183, 0x0569, 
+	0x0101, 0x02c4, 0x0467, 0x04c8, 0x0509, 0x05ea, 0x0102, 0x0386, 0x0427, 0x0406, 0x04e8, 0x060a, 0x37f1, 0x0487, 0x0548, 0x0589, 
+	0x062b, 0x0182, 0x0426, 0x0549, 0x05aa, 0x17ef, 0x03a5, 0x0407, 0x064b, 0x068b, 0x27f0, 0x47f2, 0x4ff3, 0x6ff5, 0x02c5, 0x0508, 
+	0x05ca, 0x06cb, 0x072c, 0x076d, 0x0fee, 0x27ef, 0x57f3, 0x5ff4, 0x00e2, 0x02e4, 0x058a, 0x070b, 0x07ed, 0x1ff0, 0x77f5, 0x02a5, 
+	0x0304, 0x0446, 0x062a, 0x06ab, 0x078d, 0x07ad, 0x07ce, 0x07ee, 0x07ef, 0x0fef, 0x17f0, 0x1fef, 0x3ff1, 0x7ff6, 0x87f7, 0x97f8, 
+	0xc7fb, 0x00c2, 0x0163, 0x01c2, 0x01e2, 0x0204, 0x0263, 0x0346, 0x03c5, 0x03c7, 0x0468, 0x0488, 0x04a7, 0x04e7, 0x04e9, 0x056a, 
+	0x05a9, 0x05c9, 0x05eb, 0x064a, 0x068c, 0x070c, 0x072d, 0x074c, 0x076c, 0x078e, 0x07ae, 0x07cd, 0x17ee, 0x27f1, 0x2ff0, 0x2ff1, 
+	0x37f0, 0x37f2, 0x3ff2, 0x47f3, 0x4ff2, 0x57f4, 0x5ff3, 0x67f4, 0x9ff8, 0xa7f9, 0xb7fa, 0xbffb
+};
+static const uint8_t car_icon_theme_data [] PROGMEM = {
+	0x03, 0x01, 0x01, 0x04, 0x40, 0x18, 0x02, 0x09, 0x44, 0x17, 0x20, 0x0c, 0x05, 0x07, 0x01, 0x02, 0x43, 0x03, 0x00, 0x0c, 0x26, 0x01, 0x09, 0x41, 
+	0x18, 0x0b, 0x01, 0x04, 0x06, 0x01, 0x01, 0x04, 0x4a, 0x18, 0x09, 0x0d, 0x17, 0x26, 0x15, 0x0c, 0x11, 0x08, 0x28, 0x43, 0x01, 0x30, 0x45, 0x39, 
+	0x2f, 0x08, 0x0c, 0x20, 0x17, 0x01, 0x09, 0x42, 0x19, 0x0b, 0x04, 0x05, 0x01, 0x44, 0x0b, 0x09, 0x17, 0x26, 0x0c, 0x02, 0x11, 0x53, 0x1e, 0x08, 
+	0x06, 0x25, 0x1c, 0x07, 0x21, 0x16, 0x38, 0x06, 0x1e, 0x0c, 0x15, 0x20, 0x26, 0x48, 0x0d, 0x19, 0x0b, 0x04, 0x02, 0x01, 0x47, 0x0b, 0x09, 0x17, 
+	0x0c, 0x08, 0x4f, 0x07, 0x0a, 0x01, 0x00, 0x49, 0x06, 0x03, 0x1d, 0x1b, 0x0a, 0x06, 0x03, 0x74, 0x07, 0x00, 0x01, 0x12, 0x7f, 0x63, 0x00, 0x05, 
+	0x11, 0x17, 0x0d, 0x0b, 0x04, 0x01, 0x04, 0x18, 0x0d, 0x0c, 0x05, 0x02, 0x58, 0x44, 0x6f, 0x02, 0x03, 0x1a, 0x25, 0x57, 0x27, 0x06, 0x00, 0x13, 
+	0x1d, 0x30, 0x0f, 0x13, 0x06, 0x27, 0x30, 0x2b, 0x3e, 0x1e, 0x17, 0x09, 0x04, 0x01, 0x04, 0x09, 0x15, 0x08, 0x02, 0x58, 0x3f, 0x29, 0x76, 0x1d, 
+	0x42, 0x43, 0x6d, 0x16, 0x0a, 0x00, 0x05, 0x10, 0x07, 0x0e, 0x25, 0x38, 0x6e, 0x56, 0x30, 0x07, 0x03, 0x25, 0x03, 0x0c, 0x61, 0x0b, 0x04, 0x0b, 
+	0x09, 0x0c, 0x66, 0x7a, 0x1f, 0x27, 0x02, 0x16, 0x25, 0x14, 0x02, 0x13, 0x10, 0x01, 0x00, 0x01, 0x05, 0x55, 0x00, 0x10, 0x0a, 0x03, 0x24, 0x3e, 
+	0x00, 0x10, 0x13, 0x40, 0x00, 0x17, 0x18, 0x0b, 0x19, 0x0d, 0x11, 0x0a, 0x43, 0x2f, 0x16, 0x21, 0x01, 0x13, 0x41, 0x0a, 0x10, 0x01, 0x00, 0x40, 
+	0x10, 0x04, 0x00, 0x01, 0x05, 0x52, 0x00, 0x05, 0x08, 0x10, 0x13, 0x40, 0x10, 0x20, 0x09, 0x0b, 0x09, 0x17, 0x11, 0x00, 0x0f, 0x5a, 0x22, 0x07, 
+	0x06, 0x02, 0x00, 0x43, 0x06, 0x03, 0x27, 0x1a, 0x01, 0x0f, 0x42, 0x0e, 0x0a, 0x00, 0x02, 0x05, 0x50, 0x08, 0x06, 0x33, 0x27, 0x31, 0x20, 0x09, 
+	0x0b, 0x0d, 0x15, 0x31, 0x00, 0x03, 0x24, 0x35, 0x03, 0x10, 0x01, 0x00, 0x41, 0x13, 0x16, 0x01, 0x03, 0x01, 0x02, 0x44, 0x03, 0x16, 0x29, 0x1a, 
+	0x10, 0x01, 0x05, 0x5e, 0x08, 0x27, 0x23, 0x10, 0x11, 0x17, 0x09, 0x0b, 0x17, 0x0c, 0x08, 0x00, 0x02, 0x39, 0x1d, 0x49, 0x10, 0x00, 0x21, 0x02, 
+	0x13, 0x03, 0x24, 0x4b, 0x1d, 0x71, 0x0f, 0x02, 0x0e, 0x1b, 0x00, 0x01, 0x08, 0x7e, 0x0a, 0x1f, 0x00, 0x11, 0x20, 0x0d, 0x18, 0x15, 0x12, 0x00, 
+	0x21, 0x0f, 0x35, 0x37, 0x13, 0x10, 0x0a, 0x02, 0x13, 0x07, 0x1a, 0x3a, 0x4a, 0x2a, 0x1f, 0x42, 0x4a, 0x02, 0x16, 0x1a, 0x05, 0x08, 0x10, 0x1c, 
+	0x02, 0x12, 0x0c, 0x17, 0x09, 0x31, 0x06, 0x03, 0x36, 0x2e, 0x57, 0x16, 0x0a, 0x06, 0x02, 0x21, 0x49, 0x16, 0x0f, 0x52, 0x44, 0x14, 0x29, 0x0f, 
+	0x25, 0x1f, 0x07, 0x1b, 0x0a, 0x01, 0x05, 0x5d, 0x0a, 0x14, 0x00, 0x12, 0x0c, 0x48, 0x06, 0x2b, 0x4c, 0x7c, 0x7e, 0x2a, 0x21, 0x0a, 0x13, 0x16, 
+	0x0e, 0x14, 0x2d, 0x32, 0x22, 0x53, 0x59, 0x22, 0x1a, 0x0e, 0x39, 0x0e, 0x07, 0x1b, 0x01, 0x05, 0x61, 0x10, 0x14, 0x23, 0x22, 0x69, 0x11, 0x03, 
+	0x7d, 0x2e, 0x2d, 0x37, 0x02, 0x13, 0x0a, 0x07, 0x16, 0x23, 0x87, 0x3b, 0x1f, 0x14, 0x2a, 0x79, 0x42, 0x0e, 0x50, 0x28, 0x1f, 0x21, 0x29, 0x10, 
+	0x08, 0x12, 0x05, 0x01, 0x00, 0x6f, 0x37, 0x10, 0x16, 0x4d, 0x32, 0x0e, 0x03, 0x21, 0x0a, 0x06, 0x50, 0x27, 0x41, 0x35, 0x43, 0x83, 0x72, 0x25, 
+	0x81, 0x1f, 0x0e, 0x03, 0x1a, 0x34, 0x07, 0x29, 0x10, 0x08, 0x12, 0x1e, 0x12, 0x08, 0x27, 0x06, 0x16, 0x5a, 0x1c, 0x1a, 0x02, 0x07, 0x13, 0x0a, 
+	0x02, 0x0e, 0x2b, 0x5b, 0x2f, 0x1d, 0x01, 0x3c, 0x61, 0x2b, 0x29, 0x0e, 0x02, 0x0f, 0x34, 0x03, 0x51, 0x06, 0x05, 0x08, 0x1e, 0x12, 0x08, 0x0e, 
+	0x06, 0x03, 0x2c, 0x38, 0x2e, 0x22, 0x0e, 0x07, 0x13, 0x03, 0x0e, 0x3f, 0x3b, 0x1f, 0x24, 0x34, 0x2f, 0x2d, 0x68, 0x01, 0x0e, 0x45, 0x23, 0x33, 
+	0x02, 0x14, 0x4f, 0x00, 0x01, 0x05, 0x7f, 0x10, 0x06, 0x6b, 0x65, 0x00, 0x22, 0x54, 0x35, 0x3c, 0x2f, 0x16, 0x21, 0x07, 0x0e, 0x1c, 0x2c, 0x4b, 
+	0x3f, 0x23, 0x14, 0x2d, 0x32, 0x1b, 0x0f, 0x14, 0x39, 0x0f, 0x1c, 0x6a, 0x0a, 0x06, 0x14, 0x28, 0x1a, 0x06, 0x15, 0x12, 0x06, 0x03, 0x0f, 0x1f, 
+	0x4d, 0x0f, 0x49, 0x13, 0x16, 0x0f, 0x33, 0x47, 0x4b, 0x34, 0x1f, 0x2e, 0x1f, 0x2e, 0x2d, 0x32, 0x14, 0x38, 0x1b, 0x28, 0x14, 0x67, 0x37, 0x54, 
+	0x08, 0x0c, 0x15, 0x0d, 0x0c, 0x12, 0x06, 0x07, 0x28, 0x7f, 0x23, 0x02, 0x21, 0x07, 0x0e, 0x37, 0x70, 0x46, 0x47, 0x5c, 0x2c, 0x01, 0x3d, 0x54, 
+	0x1d, 0x24, 0x22, 0x2d, 0x30, 0x0f, 0x1b, 0x4a, 0x06, 0x11, 0x15, 0x0d, 0x19, 0x26, 0x1e, 0x05, 0x13, 0x0f, 0x53, 0x35, 0x36, 0x01, 0x07, 0x5d, 
+	0x02, 0x36, 0x32, 0x24, 0x1d, 0x45, 0x80, 0x45, 0x84, 0x5e, 0x1d, 0x33, 0x51, 0x1c, 0x40, 0x02, 0x0a, 0x08, 0x15, 0x17, 0x19, 0x0b, 0x0d, 0x11, 
+	0x08, 0x0a, 0x1b, 0x41, 0x3a, 0x0f, 0x02, 0x03, 0x5d, 0x16, 0x1b, 0x22, 0x25, 0x55, 0x44, 0x45, 0x3a, 0x47, 0x5e, 0x1d, 0x23, 0x1b, 0x1a, 0x2a, 
+	0x3e, 0x12, 0x15, 0x0d, 0x19, 0x0b, 0x0d, 0x0c, 0x08, 0x07, 0x2e, 0x3c, 0x2a, 0x36, 0x16, 0x01, 0x02, 0x5b, 0x16, 0x36, 0x1c, 0x75, 0x4e, 0x5f, 
+	0x89, 0x60, 0x2c, 0x3d, 0x4e, 0x2b, 0x1c, 0x02, 0x07, 0x28, 0x10, 0x0c, 0x0d, 0x19, 0x04, 0x19, 0x15, 0x12, 0x02, 0x5c, 0x2b, 0x1c, 0x01, 0x0f, 
+	0x7f, 0x32, 0x29, 0x1b, 0x0f, 0x28, 0x23, 0x40, 0x39, 0x78, 0x2c, 0x8b, 0x2c, 0x3d, 0x46, 0x24, 0x02, 0x06, 0x00, 0x27, 0x12, 0x17, 0x18, 0x04, 
+	0x19, 0x26, 0x12, 0x07, 0x4d, 0x55, 0x14, 0x22, 0x33, 0x2c, 0x45, 0x2f, 0x14, 0x2d, 0x14, 0x2a, 0x2f, 0x30, 0x77, 0x3b, 0x8a, 0x59, 0x3b, 0x4c, 
+	0x03, 0x00, 0x31, 0x1e, 0x07, 0x11, 0x18, 0x04, 0x0b, 0x48, 0x11, 0x00, 0x1b, 0x3a, 0x56, 0x2b, 0x85, 0x51, 0x56, 0x4c, 0x47, 0x82, 0x1d, 0x33, 
+	0x23, 0x24, 0x25, 0x7b, 0x4e, 0x60, 0x54, 0x2a, 0x28, 0x3e, 0x08, 0x11, 0x01, 0x15, 0x41, 0x0a, 0x0d, 0x01, 0x04, 0x47, 0x09, 0x26, 0x1e, 0x0a, 
+	0x29, 0x3a, 0x3c, 0x25, 0x01, 0x1c, 0x5d, 0x3f, 0x42, 0x5f, 0x38, 0x23, 0x24, 0x52, 0x88, 0x2c, 0x1d, 0x14, 0x0e, 0x13, 0x00, 0x12, 0x15, 0x17, 
+	0x0d, 0x0c, 0x15, 0x0b, 0x04, 0x18, 0x0d, 0x20, 0x31, 0x00, 0x02, 0x0e, 0x02, 0x01, 0x03, 0x5b, 0x1a, 0x14, 0x3b, 0x41, 0x2a, 0x24, 0x73, 0x5d, 
+	0x2b, 0x1c, 0x02, 0x0a, 0x05, 0x11, 0x31, 0x0c, 0x0d, 0x09, 0x12, 0x0d, 0x04, 0x01, 0x0b, 0x19, 0x0d, 0x26, 0x62, 0x12, 0x01, 0x05, 0x45, 0x00, 
+	0x06, 0x13, 0x0f, 0x35, 0x44, 0x01, 0x34, 0x4d, 0x41, 0x3d, 0x14, 0x02, 0x0a, 0x64, 0x11, 0x20, 0x17, 0x15, 0x11, 0x1e, 0x15, 0x0b, 0x02, 0x01, 
+	0x4c, 0x04, 0x0b, 0x09, 0x0d, 0x20, 0x15, 0x0c, 0x1e, 0x08, 0x00, 0x07, 0x2e, 0x5d, 0x01, 0x46, 0x48, 0x86, 0x5b, 0x1a, 0x06, 0x08, 0x11, 0x26, 
+	0x09, 0x19, 0x02, 0x18, 0x41, 0x0b, 0x04, 0x03, 0x01, 0x41, 0x04, 0x0b, 0x01, 0x18, 0x51, 0x09, 0x0d, 0x20, 0x0c, 0x1e, 0x00, 0x07, 0x28, 0x14, 
+	0x6c, 0x22, 0x0e, 0x06, 0x12, 0x0c, 0x17, 0x19, 0x0b, 0x03, 0x04, 0x02, 0x01
+};
+const PackedIcon car_icon_theme = {32, 32, car_icon_theme_palette, 140, car_icon_theme_data, 1045};
+
+// transceiver_icon565, 32x32px, 144 colors, 1146 bytes (raw 2048)
+static const uint16_t transceiver_icon_theme_palette [] PROGMEM = {
+	0x0000, 0x555a, 0x4414, 0xf7df, 0x6d9b, 0x75bc, 0x657b, 0x74d5, 0x5d5a, 0x75bb, 0x5d5b, 0x5c75, 0x5c76, 0xf7bf, 0x4c35, 0x5d7b, 
+	0x4455, 0x8578, 0x43f3, 0x4cd8, 0x553a, 0x6d5a, 0x2a8c, 0x2a8d, 0x3350, 0xae3a, 0x0041, 0x3a4a, 0x6475, 0x64b6, 0x659b, 0x6d9c, 
+	0xefbe, 0x0882, 0x43f4, 0x4c14, 0x5c96, 0x6cf7, 0x7d38, 0x85fc, 0x9e5c, 0xd71d, 0xe77e, 0xef9e, 0x330f, 0x3b92, 0x4aed, 0x4c56, 
+	0x5455, 0x5475, 0x5476, 0x54f9, 0x5c33, 0x5c55, 0x6cd7, 0x6d39, 0x7517, 0x7ddb, 0x8558, 0x85da, 0x85fb, 0x95b9, 0x963c, 0x9dda, 
+	0xa61a, 0xa63a, 0xae5b, 0xbe9b, 0xbe9c, 0xc6dc, 0xefbf, 0x0862, 0x1126, 0x1146, 0x1967, 0x1987, 0x1988, 0x19a8, 0x19e9, 0x222a, 
+	0x222b, 0x2aad, 0x2ace, 0x2aee, 0x32ee, 0x3330, 0x3b51, 0x3b71, 0x3bd3, 0x42cc, 0x42ec, 0x43d3, 0x4435, 0x4c34, 0x4c97, 0x5434, 
+	0x5456, 0x54d8, 0x54f8, 0x5519, 0x5c54, 0x5cb7, 0x5d39, 0x6519, 0x655a, 0x6c73, 0x6cb6, 0x6d3a, 0x6d7a, 0x6dbb, 0x7473, 0x74f7, 
+	0x755a, 0x757a, 0x757b, 0x7d58, 0x7d9a, 0x7dba, 0x7dbb, 0x7ddc, 0x7dfb, 0x963d, 0x9e5d, 0x9e7d, 0xa67d, 0xae9d, 0xaebd, 0xb65b, 
+	0xb67b, 0xbedd, 0xbefe, 0xc6bc, 0xc6dd, 0xc6fd, 0xcedc, 0xcefc, 0xcf1d, 0xd73e, 0xd75e, 0xdf5d, 0xdf7e, 0xe75e, 0xe79e, 0xf7be
+};
+static const uint8_t transceiver_icon_theme_data [] PROGMEM = {
+	0x23, 0x00, 0x42, 0x21, 0x2e, 0x69, 0x11, 0x07, 0x42, 0x6e, 0x2e, 0x21, 0x06, 0x00, 0x42, 0x1b, 0x3b, 0x04, 0x01, 0x08, 0x03, 0x01, 0x40, 0x1e, 
+	0x03, 0x04, 0x40, 0x06, 0x07, 0x01, 0x42, 0x04, 0x3b, 0x1b, 0x04, 0x00, 0x41, 0x1b, 0x27, 0x01, 0x0a, 0x40, 0x08, 0x01, 0x06, 0x40, 0x0a, 0x01, 
+	0x01, 0x40, 0x06, 0x03, 0x04, 0x40, 0x08, 0x09, 0x01, 0x41, 0x39, 0x1b, 0x02, 0x00, 0x41, 0x21, 0x75, 0x01, 0x06, 0x40, 0x08, 0x02, 0x0f, 0x43, 
+	0x04, 0x08, 0x01, 0x0a, 0x03, 0x04, 0x40, 0x08, 0x05, 0x01, 0x01, 0x06, 0x40, 0x08, 0x01, 0x01, 0x41, 0x74, 0x47, 0x01, 0x00, 0x41, 0x59, 0x04, 
+	0x02, 0x06, 0x01, 0x04, 0x44, 0x08, 0x06, 0x04, 0x01, 0x0a, 0x01, 0x09, 0x41, 0x04, 0x08, 0x05, 0x01, 0x40, 0x06, 0x02, 0x04, 0x43, 0x0a, 0x06, 
+	0x04, 0x5a, 0x01, 0x00, 0x40, 0x34, 0x03, 0x04, 0x48, 0x27, 0x3e, 0x3c, 0x77, 0x04, 0x01, 0x0a, 0x05, 0x1e, 0x01, 0x01, 0x01, 0x06, 0x02, 0x01, 
+	0x44, 0x0f, 0x04, 0x06, 0x04, 0x06, 0x02, 0x04, 0x40, 0x34, 0x01, 0x00, 0x40, 0x1c, 0x03, 0x04, 0x40, 0x28, 0x02, 0x03, 0x44, 0x46, 0x88, 0x28, 
+	0x09, 0x0a, 0x05, 0x01, 0x43, 0x08, 0x05, 0x04, 0x06, 0x04, 0x04, 0x40, 0x1c, 0x01, 0x00, 0x40, 0x0b, 0x02, 0x04, 0x41, 0x09, 0x28, 0x05, 0x03, 
+	0x42, 0x0d, 0x81, 0x6d, 0x03, 0x01, 0x46, 0x08, 0x01, 0x04, 0x1e, 0x0f, 0x04, 0x09, 0x02, 0x04, 0x40, 0x1c, 0x01, 0x00, 0x40, 0x0b, 0x01, 0x04, 
+	0x42, 0x09, 0x05, 0x7c, 0x07, 0x03, 0x46, 0x0d, 0x7e, 0x08, 0x01, 0x0f, 0x1e, 0x01, 0x01, 0x06, 0x02, 0x05, 0x40, 0x09, 0x01, 0x04, 0x40, 0x1c, 
+	0x01, 0x00, 0x42, 0x0b, 0x04, 0x09, 0x01, 0x05, 0x44, 0x27, 0x3f, 0x19, 0x83, 0x2a, 0x05, 0x03, 0x44, 0x8c, 0x09, 0x08, 0x06, 0x1f, 0x05, 0x05, 
+	0x42, 0x09, 0x04, 0x0b, 0x01, 0x00, 0x42, 0x35, 0x04, 0x09, 0x02, 0x05, 0x40, 0x15, 0x01, 0x0c, 0x43, 0x60, 0x36, 0x42, 0x20, 0x03, 0x03, 0x42, 
+	0x20, 0x3c, 0x06, 0x03, 0x05, 0x42, 0x04, 0x06, 0x05, 0x01, 0x04, 0x40, 0x0b, 0x01, 0x00, 0x41, 0x64, 0x09, 0x04, 0x05, 0x41, 0x15, 0x30, 0x02, 
+	0x02, 0x41, 0x31, 0x80, 0x03, 0x03, 0x4b, 0x0d, 0x79, 0x0f, 0x0a, 0x06, 0x05, 0x04, 0x06, 0x04, 0x06, 0x04, 0x0b, 0x01, 0x00, 0x41, 0x5d, 0x04, 
+	0x04, 0x05, 0x41, 0x1f, 0x33, 0x04, 0x02, 0x41, 0x26, 0x2b, 0x02, 0x03, 0x47, 0x20, 0x76, 0x06, 0x01, 0x08, 0x0f, 0x04, 0x05, 0x01, 0x04, 0x40, 
+	0x0b, 0x01, 0x00, 0x42, 0x23, 0x0a, 0x04, 0x01, 0x05, 0x44, 0x7a, 0x8e, 0x89, 0x7d, 0x71, 0x04, 0x02, 0x41, 0x1d, 0x2a, 0x02, 0x03, 0x41, 0x8d, 
+	0x72, 0x01, 0x1f, 0x40, 0x04, 0x01, 0x05, 0x42, 0x04, 0x09, 0x35, 0x01, 0x00, 0x45, 0x23, 0x01, 0x0a, 0x05, 0x04, 0x3e, 0x03, 0x03, 0x41, 0x29, 
+	0x38, 0x03, 0x02, 0x41, 0x1d, 0x2b, 0x02, 0x03, 0x41, 0x7f, 0x15, 0x01, 0x05, 0x40, 0x04, 0x01, 0x05, 0x41, 0x04, 0x5f, 0x01, 0x00, 0x40, 0x02, 
+	0x01, 0x01, 0x42, 0x0a, 0x04, 0x7b, 0x05, 0x03, 0x40, 0x19, 0x03, 0x02, 0x40, 0x11, 0x02, 0x03, 0x42, 0x0d, 0x6f, 0x15, 0x01, 0x05, 0x43, 0x04, 
+	0x05, 0x06, 0x23, 0x01, 0x00, 0x40, 0x02, 0x03, 0x01, 0x43, 0x09, 0x41, 0x45, 0x0d, 0x03, 0x03, 0x40, 0x43, 0x02, 0x02, 0x41, 0x0e, 0x44, 0x02, 
+	0x03, 0x47, 0x44, 0x0c, 0x15, 0x05, 0x04, 0x06, 0x01, 0x02, 0x01, 0x00, 0x40, 0x02, 0x04, 0x01, 0x44, 0x13, 0x0e, 0x1d, 0x19, 0x0d, 0x02, 0x03, 
+	0x40, 0x19, 0x02, 0x02, 0x41, 0x24, 0x8f, 0x01, 0x03, 0x47, 0x0d, 0x6a, 0x0c, 0x15, 0x05, 0x06, 0x01, 0x02, 0x01, 0x00, 0x40, 0x22, 0x05, 0x01, 
+	0x40, 0x67, 0x01, 0x0c, 0x41, 0x26, 0x2b, 0x02, 0x03, 0x40, 0x38, 0x02, 0x02, 0x40, 0x42, 0x02, 0x03, 0x43, 0x3f, 0x0b, 0x0c, 0x66, 0x01, 0x01, 
+	0x40, 0x22, 0x01, 0x00, 0x40, 0x12, 0x05, 0x01, 0x41, 0x06, 0x6b, 0x01, 0x0c, 0x41, 0x26, 0x0d, 0x01, 0x03, 0x40, 0x29, 0x02, 0x02, 0x40, 0x36, 
+	0x02, 0x03, 0x40, 0x86, 0x01, 0x0b, 0x43, 0x5c, 0x62, 0x01, 0x22, 0x01, 0x00, 0x40, 0x12, 0x04, 0x01, 0x43, 0x78, 0x85, 0x82, 0x70, 0x01, 0x0c, 
+	0x40, 0x19, 0x02, 0x03, 0x40, 0x25, 0x02, 0x02, 0x40, 0x2a, 0x01, 0x03, 0x46, 0x20, 0x0b, 0x31, 0x02, 0x0e, 0x33, 0x12, 0x01, 0x00, 0x40, 0x12, 
+	0x03, 0x01, 0x41, 0x06, 0x46, 0x01, 0x03, 0x44, 0x84, 0x37, 0x0c, 0x1d, 0x0d, 0x01, 0x03, 0x40, 0x40, 0x02, 0x02, 0x40, 0x43, 0x02, 0x03, 0x45, 
+	0x25, 0x0e, 0x02, 0x0e, 0x02, 0x2d, 0x01, 0x00, 0x40, 0x12, 0x03, 0x01, 0x40, 0x39, 0x02, 0x03, 0x44, 0x29, 0x65, 0x37, 0x0e, 0x45, 0x01, 0x03, 
+	0x40, 0x87, 0x02, 0x02, 0x40, 0x40, 0x02, 0x03, 0x40, 0x3a, 0x03, 0x02, 0x40, 0x2c, 0x01, 0x00, 0x40, 0x5b, 0x03, 0x01, 0x41, 0x08, 0x8a, 0x01, 
+	0x03, 0x44, 0x3d, 0x0b, 0x32, 0x13, 0x41, 0x01, 0x03, 0x40, 0x8b, 0x02, 0x02, 0x40, 0x3d, 0x02, 0x03, 0x40, 0x11, 0x03, 0x02, 0x40, 0x2c, 0x01, 
+	0x00, 0x40, 0x57, 0x04, 0x01, 0x47, 0x08, 0x73, 0x25, 0x30, 0x0e, 0x02, 0x10, 0x6c, 0x01, 0x11, 0x40, 0x3a, 0x02, 0x02, 0x40, 0x24, 0x02, 0x11, 
+	0x40, 0x24, 0x03, 0x02, 0x40, 0x51, 0x01, 0x00, 0x41, 0x4f, 0x14, 0x04, 0x01, 0x42, 0x14, 0x32, 0x0e, 0x02, 0x02, 0x41, 0x10, 0x13, 0x0d, 0x02, 
+	0x40, 0x4d, 0x01, 0x00, 0x41, 0x1a, 0x5e, 0x05, 0x01, 0x41, 0x68, 0x2f, 0x03, 0x02, 0x41, 0x10, 0x13, 0x0b, 0x02, 0x41, 0x2d, 0x1a, 0x02, 0x00, 
+	0x42, 0x4c, 0x61, 0x14, 0x03, 0x01, 0x42, 0x0a, 0x14, 0x10, 0x03, 0x02, 0x41, 0x10, 0x13, 0x09, 0x02, 0x41, 0x58, 0x49, 0x04, 0x00, 0x43, 0x4b, 
+	0x2f, 0x63, 0x14, 0x03, 0x01, 0x41, 0x14, 0x10, 0x03, 0x02, 0x41, 0x10, 0x13, 0x06, 0x02, 0x42, 0x12, 0x56, 0x48, 0x06, 0x00, 0x42, 0x1a, 0x4e, 
+	0x53, 0x04, 0x18, 0x40, 0x55, 0x04, 0x17, 0x41, 0x52, 0x54, 0x04, 0x16, 0x42, 0x50, 0x4a, 0x1a, 0x23, 0x00
+};
+const PackedIcon transceiver_icon_theme = {32, 32, transceiver_icon_theme_palette, 144, transceiver_icon_theme_data, 858};
+
+// calibrate_icon565, 32x32px, 130 colors, 953 bytes (raw 2048)
+static const uint16_t calibrate_icon_theme_palette [] PROGMEM = {
+	0x0000, 0x2124, 0x6b4d, 0x528a, 0x7bcf, 0x738e, 0x4208, 0x4a49, 0xfea6, 0x52aa, 0x31a6, 0xbdf7, 0x39e7, 0x632c, 0x2945, 0x2965, 
+	0x630c, 0xbdd7, 0x5aeb, 0x3186, 0xce59, 0x39c7, 0x5acb, 0xc618, 0xb5b6, 0xce79, 0xd69a, 0xe73c, 0xf94c, 0xdedb, 0x8430, 0x9cd3, 
+	0xb596, 0xc638, 0xdefb, 0x1082, 0x8c51, 0xe71c, 0x0e82, 0x18c3, 0x8c71, 0x94b2, 0xd6ba, 0x0841, 0x4228, 0x7bef, 0xa514, 0xa534, 
+	0x0020, 0x2924, 0x4a69, 0x6b6d, 0x9492, 0xad75, 0xf79e, 0x0861, 0x2104, 0x73ae, 0x9cf3, 0xad55, 0xef7d, 0x18e3, 0xef5d, 0x0e83, 
+	0x14c3, 0x1523, 0x16a3, 0x4125, 0x8410, 0xd94b, 0xf9ca, 0x0e23, 0x10a2, 0x1423, 0x1443, 0x1b04, 0x1c83, 0x2144, 0x2164, 0x2204, 
+	0x2244, 0x2944, 0x2be5, 0x2c05, 0x2ea6, 0x46e8, 0x4a24, 0x4a44, 0x4c25, 0x4eeb, 0x5946, 0x6166, 0x62a5, 0x6c04, 0x7305, 0x772e, 
+	0x8128, 0x8187, 0x8385, 0x8928, 0x8bc5, 0x8f11, 0x9187, 0x9a27, 0x9b86, 0x9c25, 0x9f34, 0xa1a9, 0xa445, 0xac45, 0xac86, 0xaca6, 
+	0xb636, 0xc14a, 0xcd66, 0xd14b, 0xd5a7, 0xdda5, 0xdf3b, 0xe14b, 0xe605, 0xe627, 0xe94c, 0xee25, 0xee46, 0xf14c, 0xf16b, 0xf96c, 
+	0xf98b, 0xfe86
+};
+static const uint8_t calibrate_icon_theme_data [] PROGMEM = {
+	0x01, 0x00, 0x42, 0x37, 0x2c, 0x02, 0x15, 0x04, 0x42, 0x02, 0x2c, 0x37, 0x02, 0x00, 0x41, 0x27, 0x02, 0x0b, 0x05, 0x01, 0x33, 0x0b, 0x05, 0x44, 
+	0x02, 0x27, 0x00, 0x2b, 0x10, 0x08, 0x02, 0x49, 0x28, 0x18, 0x1a, 0x25, 0x3c, 0x3e, 0x22, 0x14, 0x3b, 0x2d, 0x08, 0x02, 0x42, 0x10, 0x2b, 0x15, 
+	0x06, 0x10, 0x46, 0x0d, 0x3a, 0x25, 0x36, 0x3c, 0x22, 0x19, 0x01, 0x14, 0x41, 0x1a, 0x25, 0x01, 0x36, 0x41, 0x19, 0x24, 0x07, 0x10, 0x41, 0x15, 
+	0x32, 0x05, 0x16, 0x47, 0x04, 0x1d, 0x36, 0x1d, 0x20, 0x28, 0x1e, 0x2d, 0x01, 0x04, 0x47, 0x2d, 0x1e, 0x29, 0x0b, 0x1b, 0x36, 0x0b, 0x0d, 0x05, 
+	0x16, 0x40, 0x32, 0x05, 0x03, 0x47, 0x24, 0x3e, 0x1b, 0x35, 0x1e, 0x05, 0x32, 0x0a, 0x02, 0x01, 0x48, 0x0e, 0x0c, 0x09, 0x04, 0x28, 0x17, 0x3c, 
+	0x1d, 0x02, 0x05, 0x03, 0x04, 0x07, 0x55, 0x1e, 0x3c, 0x1d, 0x29, 0x04, 0x2c, 0x01, 0x51, 0x5c, 0x64, 0x6c, 0x69, 0x62, 0x56, 0x01, 0x0e, 0x09, 
+	0x44, 0x2f, 0x1b, 0x22, 0x10, 0x04, 0x07, 0x03, 0x06, 0x48, 0x02, 0x1b, 0x2a, 0x34, 0x05, 0x0f, 0x31, 0x5e, 0x7b, 0x05, 0x08, 0x48, 0x75, 0x57, 
+	0x01, 0x15, 0x2d, 0x2e, 0x1b, 0x1a, 0x07, 0x03, 0x06, 0x02, 0x15, 0x49, 0x06, 0x1a, 0x22, 0x1f, 0x39, 0x0e, 0x43, 0x45, 0x67, 0x81, 0x05, 0x08, 
+	0x48, 0x78, 0x4c, 0x40, 0x4e, 0x0a, 0x1e, 0x35, 0x1b, 0x2f, 0x03, 0x15, 0x02, 0x13, 0x49, 0x24, 0x1b, 0x20, 0x1e, 0x13, 0x43, 0x7a, 0x1c, 0x77, 
+	0x6d, 0x05, 0x08, 0x40, 0x5d, 0x01, 0x26, 0x46, 0x41, 0x4d, 0x2c, 0x34, 0x21, 0x1b, 0x09, 0x02, 0x13, 0x01, 0x0e, 0x46, 0x13, 0x2a, 0x1a, 0x1f, 
+	0x03, 0x31, 0x73, 0x02, 0x1c, 0x41, 0x6b, 0x7c, 0x03, 0x08, 0x4a, 0x72, 0x41, 0x54, 0x59, 0x26, 0x49, 0x01, 0x05, 0x2e, 0x25, 0x2f, 0x02, 0x0e, 
+	0x01, 0x38, 0x45, 0x0d, 0x25, 0x20, 0x28, 0x01, 0x60, 0x03, 0x1c, 0x49, 0x7e, 0x68, 0x74, 0x6e, 0x6f, 0x79, 0x58, 0x42, 0x6a, 0x3f, 0x01, 0x26, 
+	0x45, 0x4f, 0x15, 0x1f, 0x21, 0x1d, 0x13, 0x01, 0x38, 0x01, 0x27, 0x45, 0x1f, 0x1d, 0x2e, 0x0d, 0x01, 0x45, 0x02, 0x1c, 0x42, 0x80, 0x46, 0x5b, 
+	0x03, 0x01, 0x43, 0x53, 0x5f, 0x65, 0x3f, 0x01, 0x26, 0x45, 0x4a, 0x01, 0x1e, 0x20, 0x22, 0x12, 0x01, 0x27, 0x01, 0x23, 0x4a, 0x17, 0x19, 0x2f, 
+	0x2c, 0x31, 0x63, 0x71, 0x7d, 0x7f, 0x46, 0x61, 0x04, 0x01, 0x4b, 0x13, 0x76, 0x55, 0x42, 0x47, 0x40, 0x4b, 0x01, 0x02, 0x2f, 0x1d, 0x44, 0x01, 
+	0x23, 0x45, 0x2b, 0x23, 0x1a, 0x17, 0x3b, 0x0f, 0x02, 0x01, 0x43, 0x31, 0x5a, 0x66, 0x31, 0x04, 0x01, 0x43, 0x3a, 0x70, 0x52, 0x50, 0x03, 0x01, 
+	0x43, 0x09, 0x3b, 0x1a, 0x1f, 0x01, 0x2b, 0x44, 0x00, 0x23, 0x1d, 0x0b, 0x35, 0x02, 0x0e, 0x07, 0x01, 0x43, 0x0e, 0x03, 0x3e, 0x12, 0x05, 0x0e, 
+	0x43, 0x32, 0x35, 0x19, 0x2f, 0x02, 0x00, 0x44, 0x37, 0x2a, 0x0b, 0x18, 0x13, 0x09, 0x0f, 0x40, 0x13, 0x01, 0x14, 0x40, 0x13, 0x05, 0x0f, 0x43, 
+	0x09, 0x20, 0x14, 0x2e, 0x02, 0x00, 0x44, 0x30, 0x14, 0x17, 0x11, 0x2c, 0x09, 0x0a, 0x42, 0x1e, 0x1b, 0x2d, 0x06, 0x0a, 0x43, 0x02, 0x18, 0x19, 
+	0x34, 0x03, 0x00, 0x43, 0x35, 0x21, 0x11, 0x0d, 0x08, 0x0c, 0x43, 0x03, 0x22, 0x2a, 0x07, 0x06, 0x0c, 0x43, 0x24, 0x18, 0x1a, 0x33, 0x03, 0x00, 
+	0x43, 0x2d, 0x19, 0x11, 0x34, 0x08, 0x06, 0x42, 0x20, 0x25, 0x1f, 0x07, 0x06, 0x43, 0x18, 0x11, 0x19, 0x0c, 0x03, 0x00, 0x44, 0x0c, 0x19, 0x11, 
+	0x17, 0x03, 0x07, 0x07, 0x42, 0x14, 0x1a, 0x12, 0x06, 0x07, 0x44, 0x33, 0x21, 0x0b, 0x17, 0x2b, 0x03, 0x00, 0x44, 0x30, 0x20, 0x21, 0x17, 0x29, 
+	0x07, 0x03, 0x41, 0x2e, 0x02, 0x07, 0x03, 0x43, 0x18, 0x11, 0x14, 0x04, 0x05, 0x00, 0x44, 0x03, 0x14, 0x11, 0x1a, 0x39, 0x0f, 0x09, 0x44, 0x29, 
+	0x14, 0x0b, 0x17, 0x3d, 0x05, 0x00, 0x45, 0x30, 0x3a, 0x21, 0x0b, 0x19, 0x05, 0x0d, 0x12, 0x44, 0x28, 0x2a, 0x11, 0x21, 0x0d, 0x07, 0x00, 0x45, 
+	0x3d, 0x11, 0x0b, 0x17, 0x2a, 0x1e, 0x0b, 0x0d, 0x45, 0x3a, 0x1d, 0x11, 0x17, 0x29, 0x30, 0x08, 0x00, 0x41, 0x0a, 0x11, 0x01, 0x0b, 0x42, 0x22, 
+	0x18, 0x04, 0x07, 0x02, 0x46, 0x24, 0x14, 0x1d, 0x11, 0x17, 0x2e, 0x23, 0x0a, 0x00, 0x53, 0x13, 0x20, 0x0b, 0x11, 0x19, 0x1b, 0x14, 0x3b, 0x29, 
+	0x24, 0x28, 0x1f, 0x20, 0x2a, 0x25, 0x21, 0x11, 0x0b, 0x29, 0x23, 0x0c, 0x00, 0x41, 0x48, 0x24, 0x01, 0x0b, 0x4d, 0x18, 0x21, 0x1a, 0x22, 0x1b, 
+	0x25, 0x22, 0x19, 0x17, 0x18, 0x0b, 0x11, 0x0d, 0x30, 0x0f, 0x00, 0x41, 0x15, 0x28, 0x02, 0x0b, 0x41, 0x11, 0x18, 0x01, 0x11, 0x01, 0x0b, 0x42, 
+	0x18, 0x39, 0x3d, 0x13, 0x00, 0x43, 0x27, 0x32, 0x39, 0x34, 0x01, 0x1f, 0x43, 0x24, 0x33, 0x06, 0x37, 0x3f, 0x00, 0x0a, 0x00
+};
+const PackedIcon calibrate_icon_theme = {32, 32, calibrate_icon_theme_palette, 130, calibrate_icon_theme_data, 693};
+
+// GForce_icon565, 32x32px, 226 colors, 1138 bytes (raw 2048)
+static const uint16_t GForce_icon_theme_palette [] PROGMEM = {
+	0xbf5f, 0x0000, 0x367f, 0xfd88, 0xfcaa, 0xaa66, 0x0020, 0xaf3f, 0xfb27, 0xfb47, 0x365f, 0x62c8, 0xfc89, 0x29c7, 0x636d, 0xb73f, 
+	0xbdcf, 0xfc8a, 0x10c3, 0x2986, 0x3e5e, 0xa65b, 0xa67b, 0xb266, 0xb6fe, 0x31e8, 0x5ebf, 0x66bf, 0x7473, 0xaefd, 0xbf3e, 0xbf3f, 
+	0x2145, 0x7cb4, 0x9b0a, 0x9e1a, 0xe591, 0x0021, 0x0041, 0x0128, 0x02f0, 0x0b52, 0x1310, 0x1a09, 0x1bf4, 0x2165, 0x2166, 0x2967, 
+	0x3433, 0x3539, 0x359b, 0x35dc, 0x363e, 0x3aee, 0x3e3e, 0x3e7f, 0x4acc, 0x4aec, 0x4b0c, 0x6639, 0x69e6, 0x6c52, 0x7472, 0x7493, 
+	0x7b48, 0x7bad, 0x7cf5, 0x8d97, 0x95b8, 0x95d8, 0x961a, 0x9a46, 0x9df9, 0xa67c, 0xaaa7, 0xb531, 0xb5b6, 0xb6fd, 0xb73e, 0xbdd0, 
+	0xcdf7, 0xed8a, 0xfd68, 0x0148, 0x0169, 0x01aa, 0x0310, 0x0311, 0x08e4, 0x0946, 0x09aa, 0x09ca, 0x0b10, 0x10a3, 0x10e4, 0x1146, 
+	0x1166, 0x1186, 0x11ca, 0x12ef, 0x1351, 0x13d4, 0x1415, 0x1436, 0x1987, 0x1988, 0x19e9, 0x1aac, 0x1aef, 0x2147, 0x2167, 0x222b, 
+	0x22cd, 0x230f, 0x2392, 0x2435, 0x2455, 0x24f8, 0x2ace, 0x2b0f, 0x2c14, 0x2c54, 0x2cf8, 0x2d39, 0x2d3a, 0x2d9b, 0x2d9c, 0x2ddd, 
+	0x32ee, 0x330e, 0x3495, 0x34b6, 0x3559, 0x363f, 0x365e, 0x3a09, 0x3aec, 0x3b4f, 0x3bd1, 0x3c74, 0x42ed, 0x4559, 0x467f, 0x4d18, 
+	0x5539, 0x55db, 0x5b6d, 0x5cb5, 0x5e9e, 0x61e7, 0x6493, 0x6558, 0x65fa, 0x661c, 0x69e7, 0x6b08, 0x6b8d, 0x6dd8, 0x6df9, 0x6e18, 
+	0x6e38, 0x6e9e, 0x7599, 0x7cd4, 0x7cf4, 0x8368, 0x83cc, 0x861b, 0x86df, 0x8eff, 0x930a, 0x94f1, 0x965a, 0x967c, 0x9bad, 0x9d2f, 
+	0x9df3, 0x9e5b, 0xa266, 0xa40f, 0xa6de, 0xaedd, 0xaefe, 0xaf1f, 0xaf3e, 0xb286, 0xb36b, 0xb3ac, 0xb3cd, 0xb5f8, 0xb71e, 0xb71f, 
+	0xb75f, 0xbd30, 0xbdb7, 0xbefd, 0xbf1d, 0xc530, 0xc531, 0xc5ce, 0xcc4a, 0xcca8, 0xce17, 0xce38, 0xd44a, 0xd4c8, 0xd5f4, 0xdc6a, 
+	0xdd08, 0xdd71, 0xe327, 0xe328, 0xe46e, 0xec0c, 0xec4d, 0xecab, 0xeccb, 0xf327, 0xf347, 0xf368, 0xf48a, 0xf4aa, 0xf589, 0xfb26, 
+	0xfb68, 0xfca9
+};
+static const uint8_t GForce_icon_theme_data [] PROGMEM = {
+	0x08, 0x01, 0x45, 0x06, 0x2e, 0x3a, 0x21, 0x23, 0x18, 0x01, 0x00, 0x45, 0x4d, 0x48, 0x1c, 0x38, 0x20, 0x06, 0x0f, 0x01, 0x44, 0x06, 0x13, 0x42, 
+	0x16, 0x1f, 0x07, 0x00, 0x44, 0x0f, 0x15, 0x3f, 0x13, 0x06, 0x0c, 0x01, 0x42, 0x5d, 0x3d, 0x1d, 0x0d, 0x00, 0x42, 0x1d, 0x3e, 0x12, 0x0a, 0x01, 
+	0x41, 0x0d, 0x43, 0x11, 0x00, 0x41, 0x45, 0x19, 0x08, 0x01, 0x41, 0x87, 0x16, 0x13, 0x00, 0x41, 0x15, 0x0d, 0x06, 0x01, 0x41, 0x0d, 0x16, 0x15, 
+	0x00, 0x41, 0x49, 0x19, 0x04, 0x01, 0x41, 0x12, 0x43, 0x09, 0x00, 0x43, 0x1e, 0xca, 0xc2, 0x1e, 0x09, 0x00, 0x41, 0x44, 0x12, 0x02, 0x01, 0x42, 
+	0x06, 0x3d, 0x1f, 0x07, 0x00, 0x47, 0xc4, 0x50, 0xd5, 0xda, 0xb9, 0xba, 0x4c, 0xc3, 0x08, 0x00, 0x41, 0x1c, 0x06, 0x01, 0x01, 0x41, 0x13, 0x1d, 
+	0x01, 0x00, 0x67, 0x0f, 0xb6, 0xad, 0xb8, 0x00, 0x1e, 0xcb, 0xd4, 0xe0, 0x09, 0x08, 0x17, 0x05, 0x4a, 0xbc, 0xbd, 0x1e, 0x00, 0x4e, 0x46, 0xb5, 
+	0xbf, 0x0f, 0x00, 0x18, 0x13, 0x01, 0x06, 0xa4, 0x00, 0x0f, 0xa2, 0x72, 0x56, 0x65, 0x99, 0x50, 0xd6, 0x09, 0xdf, 0x02, 0x08, 0x40, 0x17, 0x03, 
+	0x05, 0x4c, 0xbb, 0x4c, 0x15, 0x76, 0x53, 0x6f, 0x93, 0x07, 0x00, 0xa3, 0x06, 0x2e, 0x16, 0x01, 0x00, 0x40, 0x97, 0x01, 0x28, 0x42, 0x78, 0xb3, 
+	0xdb, 0x04, 0x09, 0x41, 0x08, 0x17, 0x04, 0x05, 0x42, 0x4a, 0xae, 0x89, 0x01, 0x27, 0x46, 0x2c, 0x1b, 0x07, 0xb1, 0x20, 0x3a, 0x1f, 0x01, 0x00, 
+	0x47, 0xa7, 0x29, 0x67, 0x64, 0x80, 0xaa, 0xd2, 0x08, 0x02, 0x09, 0x41, 0x08, 0x17, 0x03, 0x05, 0x4b, 0x47, 0x95, 0x6d, 0x62, 0x2a, 0x5b, 0x75, 
+	0x02, 0x1a, 0xb7, 0x39, 0x21, 0x02, 0x00, 0x48, 0xb4, 0x73, 0x7e, 0xab, 0xa6, 0x81, 0x35, 0x22, 0xd3, 0x02, 0x08, 0x40, 0x17, 0x01, 0x05, 0x48, 
+	0x47, 0x9a, 0x6e, 0x0d, 0xa5, 0xaf, 0x7c, 0x63, 0x7f, 0x01, 0x02, 0x42, 0x1a, 0x96, 0x23, 0x03, 0x00, 0x53, 0xa8, 0x37, 0x4b, 0x0c, 0xcc, 0x41, 
+	0x71, 0x8c, 0x22, 0xd9, 0x08, 0x05, 0xb2, 0x3c, 0x2f, 0x68, 0x40, 0xcd, 0x03, 0x4f, 0x01, 0x0a, 0x03, 0x02, 0x41, 0x8d, 0xbe, 0x03, 0x00, 0x42, 
+	0xc0, 0xa9, 0xc6, 0x01, 0x0c, 0x4b, 0xdc, 0xcf, 0x41, 0x77, 0x35, 0x22, 0x3c, 0x2f, 0x0d, 0x40, 0xd0, 0x52, 0x01, 0x03, 0x40, 0x10, 0x05, 0x02, 
+	0x40, 0x8e, 0x06, 0x00, 0x42, 0xd1, 0x0c, 0x04, 0x01, 0x0c, 0x47, 0x11, 0xc8, 0x9c, 0x6c, 0x69, 0x9b, 0xc9, 0x52, 0x03, 0x03, 0x40, 0x10, 0x05, 
+	0x02, 0x40, 0x37, 0x06, 0x00, 0x41, 0x24, 0x11, 0x04, 0x04, 0x42, 0x11, 0x92, 0x0b, 0x06, 0x03, 0x40, 0x10, 0x06, 0x02, 0x40, 0x4d, 0x05, 0x00, 
+	0x41, 0x24, 0x11, 0x05, 0x04, 0x41, 0x0e, 0x0b, 0x06, 0x03, 0x40, 0x10, 0x05, 0x02, 0x41, 0x14, 0x48, 0x05, 0x00, 0x41, 0x24, 0x11, 0x05, 0x04, 
+	0x41, 0x0e, 0x0b, 0x06, 0x03, 0x40, 0x10, 0x05, 0x02, 0x41, 0x84, 0x1c, 0x05, 0x00, 0x41, 0xce, 0xd8, 0x05, 0x04, 0x41, 0x0e, 0x0b, 0x05, 0x03, 
+	0x41, 0x51, 0xb0, 0x05, 0x02, 0x42, 0x79, 0x38, 0x0f, 0x04, 0x00, 0x44, 0x4e, 0xac, 0x4b, 0xdd, 0xe1, 0x02, 0x04, 0x41, 0x0e, 0x0b, 0x03, 0x03, 
+	0x43, 0xde, 0x4f, 0x3b, 0x14, 0x04, 0x02, 0x43, 0x0a, 0x70, 0x20, 0x15, 0x05, 0x00, 0x48, 0x07, 0xa1, 0x98, 0xc1, 0xd7, 0x0c, 0x11, 0x0e, 0x0b, 
+	0x01, 0x03, 0x43, 0x51, 0x10, 0x3b, 0x14, 0x06, 0x02, 0x43, 0x32, 0x59, 0x06, 0x3f, 0x06, 0x00, 0x4c, 0x07, 0x1a, 0x14, 0x9d, 0xc5, 0x04, 0x0e, 
+	0x0b, 0x03, 0xc7, 0x9f, 0x14, 0x0a, 0x07, 0x02, 0x44, 0x82, 0x26, 0x01, 0x2d, 0x1d, 0x06, 0x00, 0x48, 0x07, 0x1b, 0x02, 0x0a, 0x9e, 0x8a, 0x88, 
+	0xa0, 0x0a, 0x09, 0x02, 0x41, 0x36, 0x60, 0x01, 0x01, 0x41, 0x06, 0x3e, 0x07, 0x00, 0x47, 0x07, 0x1a, 0x86, 0x7d, 0x66, 0x2a, 0x7b, 0x34, 0x08, 
+	0x02, 0x42, 0x0a, 0x30, 0x25, 0x02, 0x01, 0x41, 0x12, 0x45, 0x07, 0x00, 0x46, 0x07, 0x91, 0x29, 0x57, 0x55, 0x5a, 0x7a, 0x08, 0x02, 0x41, 0x31, 
+	0x58, 0x04, 0x01, 0x41, 0x19, 0x16, 0x07, 0x00, 0x45, 0x07, 0x8f, 0x5c, 0x54, 0x2c, 0x34, 0x07, 0x02, 0x41, 0x33, 0x6a, 0x06, 0x01, 0x41, 0x0d, 
+	0x49, 0x07, 0x00, 0x43, 0x07, 0x90, 0x74, 0x85, 0x07, 0x02, 0x41, 0x33, 0x2b, 0x08, 0x01, 0x42, 0x19, 0x44, 0x1f, 0x06, 0x00, 0x41, 0x07, 0x94, 
+	0x06, 0x02, 0x42, 0x0a, 0x31, 0x2b, 0x0a, 0x01, 0x42, 0x12, 0x1c, 0x18, 0x06, 0x00, 0x41, 0x07, 0x1b, 0x04, 0x02, 0x42, 0x36, 0x30, 0x5e, 0x0c, 
+	0x01, 0x44, 0x06, 0x13, 0x42, 0x15, 0x0f, 0x04, 0x00, 0x47, 0x07, 0x1b, 0x02, 0x0a, 0x32, 0x83, 0x61, 0x25, 0x0f, 0x01, 0x45, 0x06, 0x2d, 0x39, 
+	0x21, 0x23, 0x18, 0x01, 0x00, 0x45, 0x18, 0x46, 0x8b, 0x6b, 0x5f, 0x26, 0x08, 0x01
+};
+const PackedIcon GForce_icon_theme = {32, 32, GForce_icon_theme_palette, 226, GForce_icon_theme_data, 686};
+
+// SSD_icon565, 32x33px, 223 colors, 1198 bytes (raw 2112)
+static const uint16_t SSD_icon_theme_palette [] PROGMEM = {
+	0x0000, 0xffff, 0x4809, 0x500a, 0x580b, 0x600c, 0x680d, 0x4008, 0x700e, 0x780f, 0xcd99, 0xcd19, 0x3827, 0xe69c, 0x8010, 0xc498, 
+	0xeedd, 0xffbf, 0x1042, 0x2044, 0xffdf, 0xc518, 0xd61a, 0xde1a, 0x0821, 0x2024, 0xaa95, 0x1843, 0x4028, 0x600d, 0xac15, 0xb416, 
+	0xbc97, 0xf75e, 0x3807, 0x4808, 0x5009, 0x604c, 0xa294, 0xa2b4, 0xb496, 0xef3d, 0x1022, 0x3046, 0x3808, 0x4009, 0x4849, 0x586b, 
+	0x680e, 0x702e, 0x800f, 0x8011, 0x8811, 0xab95, 0xcd39, 0xef1d, 0x0841, 0x1023, 0x1823, 0x3026, 0x3047, 0x3066, 0x3086, 0x480a, 
+	0x504a, 0x506a, 0x618c, 0x684d, 0x686d, 0x704d, 0x706e, 0x708e, 0x91b2, 0x9a33, 0xa314, 0xa394, 0xaa94, 0xb276, 0xb336, 0xb396, 
+	0xbd17, 0xc3b8, 0xc519, 0xcdd9, 0xe6dc, 0xf6fe, 0xf77e, 0x0020, 0x0801, 0x0822, 0x1824, 0x2004, 0x2825, 0x2826, 0x2845, 0x2846, 
+	0x2864, 0x2865, 0x3045, 0x3826, 0x3828, 0x4029, 0x4047, 0x4048, 0x4068, 0x4088, 0x40c8, 0x40e8, 0x4829, 0x4869, 0x4889, 0x502a, 
+	0x508a, 0x50aa, 0x510a, 0x5129, 0x514a, 0x580a, 0x580c, 0x582b, 0x584b, 0x592b, 0x596b, 0x598c, 0x606c, 0x680c, 0x682d, 0x684e, 
+	0x690d, 0x69ad, 0x700d, 0x700f, 0x704e, 0x726e, 0x780e, 0x784f, 0x788f, 0x794f, 0x7a0f, 0x7a4f, 0x7a6f, 0x7aaf, 0x8030, 0x8831, 
+	0x8891, 0x88b1, 0x89d1, 0x8b51, 0x90d2, 0x9152, 0x91d2, 0x9232, 0x9251, 0x92d2, 0x9913, 0x9933, 0x9953, 0x9993, 0x99b3, 0x99d3, 
+	0x99f3, 0x9a12, 0x9ab3, 0x9ad3, 0x9b14, 0xa154, 0xa1d4, 0xa234, 0xa235, 0xa274, 0xa2d4, 0xa335, 0xa354, 0xa355, 0xa395, 0xa3b4, 
+	0xa433, 0xa9d5, 0xaa35, 0xaab5, 0xaab6, 0xab15, 0xab36, 0xabd6, 0xac75, 0xac95, 0xacb6, 0xb2b7, 0xb316, 0xbad6, 0xbb56, 0xbb77, 
+	0xbc16, 0xbc17, 0xbc96, 0xbcb7, 0xc398, 0xc438, 0xc4b8, 0xc557, 0xc558, 0xc578, 0xcc39, 0xcc59, 0xccb9, 0xccd9, 0xccf8, 0xcd59, 
+	0xcd79, 0xcdb9, 0xd55a, 0xd63a, 0xddbb, 0xdddb, 0xddfc, 0xde5b, 0xde7b, 0xe61b, 0xe63c, 0xe65c, 0xe67c, 0xeefd, 0xef3e
+};
+static const uint8_t SSD_icon_theme_data [] PROGMEM = {
+	0x2a, 0x00, 0x4a, 0x12, 0x19, 0x62, 0x72, 0x7b, 0x42, 0x7a, 0x6a, 0x5d, 0x3a, 0x18, 0x12, 0x00, 0x46, 0x1b, 0x74, 0x93, 0xc7, 0x54, 0x29, 0x37, 
+	0x01, 0x29, 0x45, 0x37, 0xd7, 0xba, 0x85, 0x3d, 0x12, 0x0e, 0x00, 0x43, 0x12, 0x6b, 0xb0, 0xd8, 0x0a, 0x0d, 0x43, 0x53, 0x8d, 0x61, 0x57, 0x0b, 
+	0x00, 0x42, 0x13, 0x42, 0x0a, 0x03, 0x16, 0x06, 0x17, 0x02, 0x16, 0x43, 0xd3, 0xb9, 0x73, 0x59, 0x09, 0x00, 0x42, 0x19, 0x79, 0xc9, 0x0e, 0x0a, 
+	0x44, 0xd1, 0x53, 0x28, 0x66, 0x2a, 0x07, 0x00, 0x43, 0x13, 0x1c, 0xb8, 0x50, 0x03, 0x15, 0x01, 0x52, 0x05, 0x0b, 0x40, 0x36, 0x01, 0x15, 0x45, 
+	0xc8, 0xd0, 0x50, 0x8c, 0x0c, 0x58, 0x05, 0x00, 0x42, 0x12, 0x67, 0x81, 0x01, 0x28, 0x03, 0x20, 0x08, 0x0f, 0x47, 0xc6, 0xc3, 0x20, 0xc2, 0x28, 
+	0x1e, 0x1c, 0x3c, 0x05, 0x00, 0x42, 0x2b, 0x71, 0x8b, 0x01, 0x1e, 0x02, 0x1f, 0x41, 0xc0, 0xce, 0x04, 0x0b, 0x01, 0x36, 0x42, 0x0b, 0xcf, 0x15, 
+	0x01, 0x1f, 0x01, 0x1e, 0x42, 0x70, 0x07, 0x13, 0x03, 0x00, 0x45, 0x13, 0x6d, 0x02, 0x8a, 0xaf, 0xae, 0x01, 0x35, 0x01, 0x4f, 0x4c, 0x56, 0x14, 
+	0x11, 0x14, 0x11, 0x01, 0x11, 0x01, 0x11, 0x14, 0x21, 0xb7, 0x35, 0x01, 0x4b, 0x42, 0x2f, 0x02, 0x64, 0x03, 0x00, 0x44, 0x69, 0x65, 0x03, 0x80, 
+	0xac, 0x01, 0x4a, 0x55, 0xb5, 0xb6, 0xbc, 0x56, 0xcd, 0xc5, 0xd6, 0xbe, 0x55, 0x4e, 0xdb, 0xc1, 0x0b, 0x29, 0xab, 0xad, 0xa4, 0x99, 0x03, 0x02, 
+	0x07, 0x19, 0x01, 0x00, 0x46, 0x12, 0x1c, 0x02, 0x03, 0x04, 0x98, 0xaa, 0x01, 0x27, 0x4c, 0xb3, 0xb4, 0x21, 0xcb, 0x51, 0xd5, 0xbb, 0x10, 0xbd, 
+	0xda, 0xbf, 0xcc, 0xde, 0x01, 0x27, 0x45, 0xa3, 0x89, 0x75, 0x24, 0x07, 0x0c, 0x01, 0x00, 0x55, 0x19, 0x07, 0x02, 0x03, 0x05, 0x47, 0xa1, 0xa9, 
+	0xa7, 0xa8, 0xb2, 0x21, 0xca, 0xc4, 0xd4, 0x4d, 0x55, 0x4d, 0xd9, 0x4e, 0x0f, 0x37, 0x01, 0x49, 0x53, 0x92, 0x44, 0x04, 0x03, 0x02, 0x07, 0x18, 
+	0x00, 0x3b, 0x23, 0x03, 0x04, 0x05, 0x06, 0x88, 0x48, 0x9e, 0xa6, 0xb1, 0x21, 0x01, 0x11, 0x5c, 0x14, 0x11, 0x14, 0x11, 0x14, 0x11, 0x14, 0xdd, 
+	0x9f, 0x95, 0x31, 0x06, 0x25, 0x03, 0x02, 0x07, 0x1b, 0x00, 0x22, 0x02, 0x03, 0x04, 0x05, 0x06, 0x09, 0x8e, 0x94, 0xa5, 0x51, 0x09, 0x01, 0x55, 
+	0x10, 0x91, 0x09, 0x08, 0x06, 0x05, 0x25, 0x02, 0x07, 0x19, 0x00, 0x22, 0x02, 0x03, 0x04, 0x1d, 0x30, 0x09, 0x0e, 0x34, 0x9a, 0x21, 0x09, 0x01, 
+	0x54, 0x10, 0x33, 0x32, 0x08, 0x06, 0x05, 0x04, 0x02, 0x07, 0x2b, 0x12, 0x2c, 0x02, 0x03, 0x04, 0x1d, 0x08, 0x09, 0x0e, 0x8f, 0xd2, 0x0a, 0x01, 
+	0x54, 0x10, 0x33, 0x0e, 0x08, 0x06, 0x05, 0x04, 0x24, 0x2e, 0x3d, 0x18, 0x22, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0e, 0x9d, 0x14, 0x0a, 0x01, 
+	0x54, 0x10, 0x34, 0x0e, 0x08, 0x06, 0x05, 0x04, 0x6f, 0x41, 0x3e, 0x00, 0x22, 0x02, 0x03, 0x04, 0x05, 0x82, 0x09, 0x0e, 0x9c, 0xdc, 0x0a, 0x01, 
+	0x54, 0x10, 0x33, 0x0e, 0x08, 0x06, 0x05, 0x04, 0x40, 0x07, 0x5c, 0x00, 0x0c, 0x02, 0x03, 0x04, 0x05, 0x06, 0x86, 0x32, 0x34, 0x9b, 0x0a, 0x01, 
+	0x54, 0x10, 0x0e, 0x09, 0x08, 0x06, 0x05, 0x78, 0x3f, 0x07, 0x3a, 0x00, 0x19, 0x23, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x90, 0x1a, 0x0a, 0x01, 
+	0x53, 0x10, 0x0e, 0x09, 0x08, 0x06, 0x25, 0x03, 0x02, 0x07, 0x2a, 0x00, 0x1b, 0x07, 0x02, 0x03, 0x04, 0x7d, 0x30, 0x87, 0xa0, 0x0b, 0x01, 0x48, 
+	0x10, 0x09, 0x08, 0x06, 0x43, 0x04, 0x03, 0x23, 0x0c, 0x02, 0x00, 0x47, 0x0c, 0x02, 0x03, 0x04, 0x05, 0x45, 0x31, 0x96, 0x0b, 0x01, 0x48, 0x10, 
+	0x09, 0x08, 0x7f, 0x76, 0x03, 0x02, 0x07, 0x5e, 0x02, 0x00, 0x47, 0x5a, 0x07, 0x02, 0x03, 0x25, 0x7e, 0x06, 0x48, 0x0b, 0x01, 0x48, 0x54, 0x31, 
+	0x84, 0x05, 0x04, 0x03, 0x02, 0x2c, 0x18, 0x03, 0x00, 0x47, 0x68, 0x02, 0x40, 0x77, 0x04, 0x06, 0x47, 0xa2, 0x01, 0x26, 0x40, 0x4c, 0x04, 0x1a, 
+	0x40, 0x4c, 0x01, 0x26, 0x47, 0x97, 0x46, 0x05, 0x04, 0x03, 0x02, 0x07, 0x13, 0x04, 0x00, 0x48, 0x1b, 0x6e, 0x6c, 0x03, 0x04, 0x05, 0x1d, 0x06, 
+	0x08, 0x02, 0x09, 0x41, 0x0e, 0x32, 0x02, 0x09, 0x45, 0x83, 0x08, 0x46, 0x05, 0x04, 0x03, 0x01, 0x02, 0x40, 0x3c, 0x06, 0x00, 0x43, 0x60, 0x2e, 
+	0x02, 0x03, 0x01, 0x04, 0x40, 0x05, 0x01, 0x06, 0x05, 0x08, 0x49, 0x30, 0x06, 0x45, 0x44, 0x04, 0x03, 0x02, 0x07, 0x0c, 0x12, 0x07, 0x00, 0x45, 
+	0x3e, 0x2e, 0x02, 0x24, 0x03, 0x04, 0x01, 0x05, 0x40, 0x1d, 0x04, 0x06, 0x41, 0x1d, 0x43, 0x01, 0x04, 0x44, 0x2f, 0x3f, 0x2d, 0x0c, 0x2a, 0x09, 
+	0x00, 0x44, 0x13, 0x07, 0x23, 0x02, 0x03, 0x03, 0x04, 0x02, 0x05, 0x48, 0x04, 0x7c, 0x04, 0x03, 0x24, 0x02, 0x2d, 0x0c, 0x12, 0x0b, 0x00, 0x42, 
+	0x1b, 0x0c, 0x07, 0x01, 0x02, 0x05, 0x03, 0x41, 0x2f, 0x03, 0x01, 0x02, 0x01, 0x07, 0x41, 0x5f, 0x18, 0x0e, 0x00, 0x43, 0x13, 0x0c, 0x07, 0x2d, 
+	0x03, 0x02, 0x40, 0x41, 0x01, 0x02, 0x01, 0x07, 0x41, 0x2b, 0x39, 0x12, 0x00, 0x44, 0x39, 0x5b, 0x63, 0x0c, 0x2c, 0x01, 0x1c, 0x43, 0x0c, 0x3b, 
+	0x13, 0x18, 0x18, 0x00, 0x01, 0x38, 0x0e, 0x00
+};
+const PackedIcon SSD_icon_theme = {32, 33, SSD_icon_theme_palette, 223, SSD_icon_theme_data, 752};
+
+// xxSSD_icon565, 32x32px, 256 colors, 1578 bytes (raw 2048)
+static const uint16_t xxSSD_icon_theme_palette [] PROGMEM = {
+	0x0020, 0x0040, 0x0000, 0x0001, 0x0060, 0x0002, 0x6420, 0x7483, 0x6c26, 0x7464, 0x7c68, 0x0003, 0x0004, 0x3a07, 0x63e4, 0x6402, 
+	0x7482, 0x0880, 0x63e1, 0x6c24, 0x6c25, 0x6c42, 0x7c85, 0x7c89, 0x10c2, 0x6c03, 0x6c23, 0x6c43, 0x6c45, 0x6c60, 0x7444, 0x7465, 
+	0x7481, 0x74a2, 0x7ca7, 0x7cc3, 0x0021, 0x18e3, 0x31c7, 0x39e8, 0x39ea, 0x4229, 0x422a, 0x5b68, 0x63c3, 0x63e0, 0x63e2, 0x63e3, 
+	0x6421, 0x6441, 0x6bc8, 0x6be6, 0x6be8, 0x6c05, 0x6c40, 0x6c61, 0x7427, 0x7462, 0x7485, 0x7c87, 0x7c8b, 0x848b, 0x0023, 0x0042, 
+	0x0080, 0x00a0, 0x0841, 0x08e0, 0x1083, 0x10a0, 0x10c3, 0x1920, 0x1986, 0x2124, 0x2125, 0x2144, 0x2145, 0x2164, 0x2965, 0x2966, 
+	0x2969, 0x2985, 0x2987, 0x2988, 0x29e0, 0x3187, 0x31a6, 0x31c6, 0x31c8, 0x39e7, 0x3a67, 0x420b, 0x4248, 0x4ac4, 0x4ac7, 0x5344, 
+	0x5360, 0x5b48, 0x5ba7, 0x5bc2, 0x5be0, 0x5c00, 0x636a, 0x6388, 0x6389, 0x638b, 0x63a2, 0x63a3, 0x63e5, 0x6401, 0x6403, 0x6404, 
+	0x6406, 0x6440, 0x6443, 0x6ba6, 0x6bc7, 0x6be4, 0x6be9, 0x6c04, 0x6c06, 0x6c07, 0x6c08, 0x6c41, 0x6c44, 0x6c63, 0x6c65, 0x73ac, 
+	0x73ae, 0x7408, 0x7424, 0x742a, 0x742b, 0x7445, 0x7446, 0x7447, 0x7449, 0x744b, 0x744c, 0x7463, 0x7467, 0x746b, 0x74a4, 0x7c0e, 
+	0x7c0f, 0x7c2d, 0x7c4c, 0x7c4d, 0x7c6a, 0x7c6b, 0x7c83, 0x7c88, 0x7c8a, 0x7ca3, 0x7ca5, 0x7ca6, 0x7ca8, 0x7cc4, 0x7cc5, 0x7ce3, 
+	0x846f, 0x84a6, 0x84a7, 0x84aa, 0x84c6, 0x8c4f, 0x8caf, 0x8cca, 0x8ccc, 0x8d05, 0x8d08, 0x8d0b, 0x952d, 0xc693, 0x0005, 0x0025, 
+	0x0041, 0x00a2, 0x00a7, 0x00c1, 0x00e3, 0x00ed, 0x0162, 0x0804, 0x0807, 0x0824, 0x0840, 0x0860, 0x0861, 0x0863, 0x08a1, 0x08a3, 
+	0x08a4, 0x08c0, 0x08e9, 0x0900, 0x0901, 0x0940, 0x0960, 0x0964, 0x098c, 0x09a4, 0x1082, 0x1085, 0x1087, 0x10a3, 0x10c0, 0x10e0, 
+	0x1101, 0x1102, 0x112a, 0x1140, 0x114d, 0x1160, 0x116b, 0x118f, 0x11a0, 0x11a6, 0x1202, 0x1884, 0x1885, 0x1887, 0x18c4, 0x1900, 
+	0x1902, 0x1928, 0x1942, 0x1960, 0x1962, 0x1965, 0x1967, 0x1985, 0x19a0, 0x19e0, 0x1a32, 0x20c3, 0x20c5, 0x20e7, 0x2105, 0x2121, 
+	0x2180, 0x2181, 0x2189, 0x21c0, 0x21c8, 0x21e2, 0x2200, 0x2202, 0x2243, 0x2246, 0x2263, 0x2269, 0x2292, 0x2905, 0x2927, 0x2946
+};
+static const uint8_t xxSSD_icon_theme_data [] PROGMEM = {
+	0x46, 0xb8, 0x0c, 0x03, 0xbc, 0x02, 0x11, 0x02, 0x01, 0x03, 0x40, 0x00, 0x03, 0x01, 0x44, 0x3e, 0xaf, 0x0c, 0x0b, 0x00, 0x02, 0x01, 0x42, 0x00, 
+	0x24, 0x03, 0x01, 0x00, 0x01, 0x02, 0x49, 0x03, 0xdd, 0xae, 0x0c, 0xcb, 0x42, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x03, 0x01, 0x40, 0x00, 0x01, 
+	0x03, 0x40, 0x00, 0x03, 0x01, 0x01, 0x00, 0x56, 0x18, 0x00, 0xc1, 0x00, 0x45, 0x02, 0x05, 0x0c, 0x44, 0x02, 0x00, 0xcf, 0xad, 0x0a, 0xa8, 0x2b, 
+	0x95, 0x94, 0x97, 0x22, 0x3b, 0x17, 0x8d, 0x01, 0x8a, 0x4b, 0x8d, 0x17, 0x9c, 0x22, 0x9c, 0x98, 0x3c, 0x32, 0x94, 0x0a, 0xad, 0x04, 0x01, 0x00, 
+	0x4f, 0x44, 0x02, 0x01, 0x04, 0x0a, 0xa2, 0xa7, 0x0e, 0xa7, 0x08, 0x14, 0x1b, 0x15, 0x1b, 0x13, 0x08, 0x01, 0x79, 0x41, 0x08, 0x1a, 0x01, 0x15, 
+	0x49, 0x1b, 0x14, 0x08, 0x86, 0xa2, 0xaa, 0x19, 0xa7, 0x01, 0xbb, 0x01, 0x02, 0x49, 0x47, 0xad, 0xaa, 0x8b, 0x15, 0xa1, 0x13, 0x85, 0x1e, 0x39, 
+	0x01, 0x20, 0x45, 0x10, 0x09, 0x85, 0x08, 0x3a, 0x07, 0x01, 0x21, 0x48, 0x07, 0x09, 0x1f, 0xaa, 0x60, 0x0f, 0xaa, 0x6a, 0xad, 0x01, 0x00, 0x47, 
+	0x01, 0x00, 0xa7, 0x16, 0x2d, 0xa9, 0x1e, 0x60, 0x01, 0x2c, 0x02, 0x12, 0x46, 0x2e, 0x2f, 0x0e, 0x6c, 0x0e, 0x0f, 0x6d, 0x01, 0x12, 0x51, 0x2c, 
+	0x6b, 0x60, 0xa4, 0xa9, 0x12, 0x16, 0xa7, 0x00, 0x11, 0xbe, 0x00, 0xab, 0x75, 0xaa, 0x60, 0x86, 0x0a, 0x01, 0x88, 0x01, 0x0a, 0x52, 0x97, 0x17, 
+	0x98, 0x3c, 0x95, 0x94, 0x0a, 0x8c, 0x87, 0x38, 0x81, 0x7a, 0x0a, 0x75, 0x09, 0x2e, 0xa7, 0x5d, 0xa6, 0x01, 0x02, 0x47, 0xce, 0x33, 0x85, 0x82, 
+	0x19, 0x0a, 0xac, 0x61, 0x02, 0x2b, 0x41, 0x67, 0x68, 0x03, 0x69, 0x42, 0x68, 0x67, 0x2b, 0x01, 0x61, 0x52, 0x2b, 0xac, 0x38, 0x6a, 0xa4, 0x6b, 
+	0x74, 0x7f, 0xb0, 0x00, 0x01, 0x74, 0x14, 0x6e, 0x13, 0xab, 0xad, 0xa0, 0x29, 0x02, 0x0d, 0x42, 0x29, 0x2a, 0x5b, 0x01, 0x2a, 0x40, 0x29, 0x01, 
+	0x0d, 0x49, 0x57, 0x5c, 0xa0, 0xad, 0x17, 0x2f, 0x09, 0x9b, 0x2b, 0x7f, 0x02, 0x00, 0x4c, 0x33, 0x9b, 0x9d, 0x19, 0x5d, 0x5e, 0x29, 0x26, 0x2a, 
+	0x29, 0x52, 0x53, 0x50, 0x01, 0x28, 0x58, 0x50, 0x53, 0x52, 0x29, 0x27, 0x4f, 0x29, 0x5e, 0x0e, 0x09, 0x15, 0x2e, 0x33, 0x91, 0x01, 0x00, 0x01, 
+	0x14, 0x07, 0x1d, 0x06, 0x86, 0xa8, 0x69, 0x27, 0x01, 0x58, 0x40, 0x55, 0x01, 0x28, 0x01, 0x5b, 0x01, 0x28, 0x47, 0x27, 0x58, 0x27, 0x26, 0x69, 
+	0x3c, 0x14, 0x7b, 0x01, 0x07, 0x4f, 0x0e, 0x83, 0x04, 0x01, 0x04, 0x7c, 0x20, 0x06, 0x36, 0xa4, 0xad, 0x93, 0x0d, 0x4f, 0xff, 0x26, 0x01, 0x2a, 
+	0x01, 0x5b, 0x40, 0x2a, 0x01, 0x29, 0x65, 0x4c, 0x56, 0x0d, 0x8f, 0xad, 0x16, 0x06, 0x10, 0x23, 0x63, 0x76, 0x04, 0x01, 0x04, 0x6f, 0x23, 0x10, 
+	0x36, 0x12, 0x5f, 0x5e, 0x4d, 0x51, 0x56, 0x59, 0x29, 0x59, 0x0d, 0x27, 0x57, 0x0d, 0x29, 0x4b, 0x26, 0x4b, 0x5e, 0x5f, 0x63, 0x01, 0x1d, 0x51, 
+	0x06, 0x13, 0x3c, 0x01, 0x00, 0x01, 0x78, 0x07, 0x1d, 0x36, 0x7c, 0xa3, 0x66, 0x4d, 0x49, 0x4e, 0x29, 0x7f, 0x03, 0x66, 0x5a, 0x7f, 0x8f, 0x49, 
+	0x4e, 0x51, 0x66, 0xa3, 0x1a, 0x06, 0x1d, 0x7d, 0x70, 0x93, 0x00, 0x05, 0x01, 0x76, 0x1c, 0x06, 0x30, 0xa7, 0xad, 0x8f, 0x4f, 0x46, 0x4e, 0x66, 
+	0x01, 0xa5, 0x40, 0x8f, 0x01, 0xa5, 0x01, 0xa0, 0x58, 0x25, 0x4a, 0x26, 0xa0, 0xad, 0x3b, 0x2d, 0x23, 0x22, 0x62, 0x80, 0x0b, 0x05, 0x00, 0x32, 
+	0x22, 0x8e, 0x2e, 0x5f, 0x2b, 0x5c, 0xde, 0xee, 0x55, 0x29, 0x03, 0x7f, 0x5d, 0x66, 0x7f, 0xa0, 0x25, 0x4a, 0x46, 0x0d, 0x5d, 0x2c, 0x15, 0x07, 
+	0x35, 0x67, 0x90, 0x0b, 0x00, 0x01, 0x08, 0x9e, 0x15, 0x6d, 0x38, 0xa0, 0x66, 0xed, 0xdc, 0xdb, 0xeb, 0x56, 0x4e, 0x01, 0x0d, 0x77, 0xf1, 0x4d, 
+	0x4b, 0xe0, 0x18, 0x4c, 0x66, 0xa8, 0x77, 0x2d, 0x39, 0x16, 0x81, 0x90, 0x03, 0x01, 0x04, 0x6c, 0x1b, 0x06, 0x8b, 0xab, 0xad, 0x69, 0xfe, 0xec, 
+	0xfd, 0x4e, 0x5c, 0x2b, 0x76, 0x32, 0xa3, 0x62, 0xf0, 0x51, 0xd1, 0x18, 0xa6, 0xad, 0xaa, 0x39, 0x10, 0x19, 0x73, 0x8f, 0x24, 0x00, 0x01, 0x08, 
+	0x9e, 0x23, 0x30, 0x60, 0x5d, 0x0d, 0x01, 0x11, 0x40, 0xef, 0x01, 0x54, 0x42, 0x5d, 0x5f, 0x22, 0x01, 0xaa, 0x41, 0x35, 0xf3, 0x01, 0x01, 0x43, 
+	0x5a, 0x5d, 0x60, 0x06, 0x01, 0x16, 0x4e, 0x73, 0x7f, 0x02, 0x3f, 0x01, 0x08, 0x09, 0x10, 0x37, 0x1c, 0x17, 0x2b, 0x43, 0x41, 0xe3, 0x03, 0x54, 
+	0x78, 0x60, 0x37, 0xa9, 0xac, 0x5d, 0xd3, 0xe2, 0x5e, 0x3c, 0x78, 0x1a, 0x96, 0x1e, 0x0e, 0x91, 0x04, 0x03, 0x01, 0x88, 0x1f, 0x06, 0x7b, 0xaa, 
+	0xad, 0x76, 0xc3, 0x04, 0xc5, 0xf5, 0xf7, 0xc6, 0xe8, 0xe9, 0xa9, 0xad, 0xac, 0xa8, 0x57, 0xd0, 0x7f, 0xad, 0xab, 0x19, 0x7b, 0x1e, 0x08, 0x92, 
+	0x00, 0x03, 0x00, 0x34, 0x9b, 0x99, 0x06, 0x60, 0x5f, 0x5a, 0x01, 0x04, 0x7f, 0xf9, 0x2b, 0x5a, 0xb4, 0x04, 0xd8, 0x70, 0xad, 0xac, 0x89, 0xe4, 
+	0x00, 0x5a, 0x2b, 0x5f, 0x0f, 0x9d, 0x9a, 0x6c, 0x84, 0x00, 0xca, 0x00, 0x2c, 0x1a, 0x21, 0x07, 0x1c, 0x34, 0x5a, 0x40, 0xd9, 0x90, 0xad, 0x90, 
+	0xc8, 0xb2, 0x3f, 0xb3, 0x66, 0x8f, 0x0d, 0x40, 0xb1, 0x5a, 0x83, 0x70, 0x09, 0x99, 0x0f, 0x5f, 0x89, 0x43, 0x02, 0x00, 0x0a, 0x9a, 0x06, 0x65, 
+	0x22, 0xad, 0x2b, 0xc7, 0xfb, 0x60, 0x90, 0xad, 0xfc, 0xea, 0xd7, 0xc2, 0xf2, 0xf4, 0x48, 0xe7, 0x01, 0x04, 0x91, 0xad, 0x9c, 0x64, 0x31, 0x9d, 
+	0x8c, 0x92, 0x00, 0x02, 0x00, 0x2c, 0xa1, 0x10, 0x31, 0x7e, 0x62, 0xf8, 0xb6, 0xc9, 0x66, 0x01, 0x90, 0x66, 0xfc, 0xb5, 0xd4, 0xd2, 0xe6, 0xe5, 
+	0xc4, 0x41, 0xd5, 0x54, 0x0e, 0x06, 0x37, 0x23, 0x0f, 0x08, 0xa0, 0x00, 0x02, 0x00, 0x0a, 0x82, 0x2d, 0x30, 0x7c, 0x0a, 0x2b, 0xfa, 0xda, 0x5a, 
+	0x2b, 0x69, 0xfc, 0xd7, 0xd6, 0xe1, 0x48, 0xf8, 0x54, 0x01, 0xf6, 0x48, 0x60, 0x8e, 0x21, 0x60, 0x37, 0x2f, 0x3c, 0x00, 0xc0, 0x01, 0x02, 0x47, 
+	0xa8, 0xa2, 0x96, 0xa9, 0x0f, 0x0e, 0x86, 0x0e, 0x01, 0x5f, 0x43, 0x2b, 0x5d, 0x5a, 0x29, 0x01, 0x26, 0x45, 0xf5, 0x5f, 0x63, 0x64, 0x65, 0x31, 
+	0x01, 0x71, 0x53, 0x23, 0x9d, 0x3b, 0x68, 0xbf, 0x0c, 0x03, 0xba, 0xac, 0x0e, 0xa1, 0x60, 0x3a, 0x22, 0x08, 0x7e, 0x13, 0x07, 0x0f, 0x5f, 0x01, 
+	0xf8, 0x40, 0x5a, 0x01, 0x5d, 0x41, 0x0f, 0x10, 0x01, 0x20, 0x56, 0x10, 0x9f, 0x10, 0x9f, 0x60, 0x38, 0xad, 0x05, 0xcc, 0x05, 0xcd, 0x01, 0x3d, 
+	0x0e, 0xab, 0x6c, 0x08, 0x87, 0x1c, 0x72, 0x0f, 0x72, 0x0e, 0x01, 0x62, 0x43, 0x2b, 0x62, 0x6f, 0x7d, 0x01, 0x07, 0x42, 0x09, 0x3a, 0x77, 0x01, 
+	0x1f, 0x58, 0x16, 0xa8, 0x00, 0xbd, 0x0c, 0xb7, 0x03, 0x02, 0xdf, 0xac, 0x62, 0xac, 0x2b, 0x34, 0x33, 0x0e, 0x6e, 0x13, 0x08, 0x7a, 0x32, 0x2b, 
+	0x76, 0x79, 0x35, 0x01, 0x0e, 0x53, 0x74, 0x34, 0x83, 0x32, 0x81, 0xad, 0x01, 0x04, 0x03, 0x05, 0xb9, 0x05, 0x18, 0x00, 0x47, 0x00, 0x2b, 0xa0, 
+	0x91, 0x8f, 0x02, 0x3d, 0x48, 0x3c, 0x8f, 0x80, 0x90, 0x8f, 0x93, 0x95, 0x84, 0x8a, 0x01, 0x90, 0x41, 0x80, 0xa0, 0x01, 0x00, 0x01, 0x04, 0x44, 
+	0x25, 0x03, 0x0b, 0x05, 0x02, 0x01, 0x00, 0x43, 0x45, 0x02, 0x42, 0x02, 0x03, 0x00, 0x44, 0x02, 0x24, 0x3e, 0x03, 0x02, 0x03, 0x00, 0x40, 0x05, 
+	0x01, 0x0b, 0x42, 0x03, 0x02, 0x11, 0x02, 0x00, 0x40, 0x02
+};
+const PackedIcon xxSSD_icon_theme = {32, 32, xxSSD_icon_theme_palette, 256, xxSSD_icon_theme_data, 1066};
+
+// clock_icon565, 32x32px, 142 colors, 861 bytes (raw 2048)
+static const uint16_t clock_icon_theme_palette [] PROGMEM = {
+	0x0000, 0x25b6, 0x1cb2, 0x2575, 0x13ef, 0x1d34, 0x1c71, 0x1c30, 0x1c50, 0x140f, 0x1410, 0x1cf3, 0x1d13, 0x1c51, 0x13ae, 0x13cf, 
+	0x2554, 0x1cd3, 0x1c92, 0x2595, 0x2596, 0x138e, 0x13ce, 0xf7df, 0xe79e, 0x1d14, 0xffff, 0x0a08, 0x12eb, 0x132c, 0x1c91, 0x1cd2, 
+	0x6534, 0xe77d, 0xe7be, 0xefdf, 0x0082, 0x00c3, 0x2d95, 0x2d96, 0x2db6, 0x6e38, 0x6e79, 0x7638, 0x8659, 0xaf1c, 0xc6fb, 0x09c7, 
+	0x09e7, 0x12cb, 0x134c, 0x1bcf, 0x1c10, 0x24f3, 0x2534, 0x25d6, 0x3d13, 0x4492, 0x4534, 0x4d55, 0x4d75, 0x4e38, 0x6e18, 0x8e79, 
+	0x8eda, 0xbf5d, 0xcf7d, 0xd73c, 0xd75d, 0xd77d, 0xefbe, 0xf7be, 0x0081, 0x00c2, 0x136d, 0x138d, 0x1bef, 0x1c0f, 0x2430, 0x2471, 
+	0x2492, 0x2c30, 0x2c50, 0x2cb2, 0x3430, 0x3471, 0x34d3, 0x3534, 0x3595, 0x35b6, 0x3c71, 0x3cf3, 0x3d54, 0x3d96, 0x3db6, 0x3df7, 
+	0x3e17, 0x4575, 0x4d95, 0x4e18, 0x5618, 0x5d34, 0x5d96, 0x5df7, 0x6555, 0x6575, 0x6596, 0x65b6, 0x6617, 0x6618, 0x6638, 0x6d54, 
+	0x6d75, 0x6db6, 0x7596, 0x7658, 0x7679, 0x7699, 0x7db6, 0x7df7, 0x7e38, 0x7e58, 0x7e79, 0x8638, 0x8e59, 0xa679, 0xa6ba, 0xae79, 
+	0xae9a, 0xaeda, 0xaefb, 0xb6ba, 0xb6db, 0xb71c, 0xbeba, 0xbefb, 0xbf3c, 0xbf5c, 0xc71c, 0xc75d, 0xdf9d, 0xdfbe
+};
+static const uint8_t clock_icon_theme_data [] PROGMEM = {
+	0x3f, 0x00, 0x04, 0x00, 0x43, 0x25, 0x1c, 0x02, 0x03, 0x0d, 0x01, 0x43, 0x03, 0x02, 0x1c, 0x25, 0x08, 0x00, 0x40, 0x1d, 0x07, 0x01, 0x41, 0x37, 
+	0x5f, 0x01, 0x3d, 0x41, 0x60, 0x37, 0x07, 0x01, 0x40, 0x1d, 0x06, 0x00, 0x40, 0x1d, 0x06, 0x01, 0x43, 0x2a, 0x89, 0x17, 0x1a, 0x01, 0x17, 0x44, 
+	0x1a, 0x17, 0x41, 0x75, 0x28, 0x05, 0x01, 0x40, 0x1d, 0x04, 0x00, 0x42, 0x49, 0x14, 0x01, 0x03, 0x14, 0x40, 0x2a, 0x01, 0x22, 0x42, 0x40, 0x64, 
+	0x28, 0x01, 0x14, 0x45, 0x28, 0x63, 0x40, 0x8d, 0x22, 0x2a, 0x05, 0x14, 0x40, 0x25, 0x03, 0x00, 0x40, 0x31, 0x03, 0x13, 0x44, 0x14, 0x2d, 0x23, 
+	0x7a, 0x14, 0x08, 0x13, 0x43, 0x74, 0x23, 0x2d, 0x27, 0x03, 0x13, 0x40, 0x31, 0x03, 0x00, 0x40, 0x06, 0x02, 0x03, 0x43, 0x13, 0x41, 0x45, 0x5e, 
+	0x0b, 0x03, 0x43, 0x59, 0x42, 0x8b, 0x27, 0x02, 0x03, 0x40, 0x06, 0x03, 0x00, 0x40, 0x19, 0x02, 0x03, 0x42, 0x82, 0x45, 0x26, 0x05, 0x03, 0x41, 
+	0x26, 0x27, 0x05, 0x03, 0x42, 0x26, 0x42, 0x2d, 0x02, 0x03, 0x40, 0x19, 0x03, 0x00, 0x40, 0x05, 0x01, 0x10, 0x42, 0x6e, 0x23, 0x5d, 0x06, 0x10, 
+	0x41, 0x67, 0x6d, 0x06, 0x10, 0x42, 0x58, 0x46, 0x29, 0x01, 0x10, 0x40, 0x05, 0x03, 0x00, 0x01, 0x05, 0x42, 0x10, 0x18, 0x73, 0x07, 0x05, 0x41, 
+	0x6c, 0x29, 0x07, 0x05, 0x42, 0x29, 0x22, 0x10, 0x01, 0x05, 0x03, 0x00, 0x44, 0x0c, 0x05, 0x3e, 0x18, 0x36, 0x01, 0x05, 0x01, 0x19, 0x01, 0x05, 
+	0x43, 0x19, 0x05, 0x3e, 0x2b, 0x01, 0x19, 0x05, 0x05, 0x44, 0x36, 0x8c, 0x2b, 0x05, 0x0c, 0x03, 0x00, 0x43, 0x0b, 0x0c, 0x85, 0x3f, 0x08, 0x0c, 
+	0x41, 0x2b, 0x79, 0x08, 0x0c, 0x43, 0x2c, 0x88, 0x0c, 0x0b, 0x03, 0x00, 0x01, 0x0b, 0x41, 0x23, 0x62, 0x08, 0x0b, 0x41, 0x78, 0x2c, 0x08, 0x0b, 
+	0x43, 0x61, 0x17, 0x35, 0x11, 0x03, 0x00, 0x43, 0x1f, 0x57, 0x1a, 0x35, 0x08, 0x11, 0x41, 0x2c, 0x3f, 0x08, 0x11, 0x43, 0x0b, 0x1a, 0x5c, 0x1f, 
+	0x03, 0x00, 0x43, 0x02, 0x81, 0x1a, 0x7b, 0x02, 0x02, 0x40, 0x1f, 0x04, 0x02, 0x41, 0x7c, 0x7e, 0x07, 0x02, 0x44, 0x1f, 0x02, 0x18, 0x3c, 0x02, 
+	0x03, 0x00, 0x43, 0x12, 0x6b, 0x1a, 0x3a, 0x08, 0x02, 0x42, 0x3b, 0x46, 0x3c, 0x08, 0x02, 0x42, 0x18, 0x3b, 0x12, 0x03, 0x00, 0x42, 0x06, 0x1e, 
+	0x66, 0x06, 0x12, 0x40, 0x1e, 0x02, 0x12, 0x42, 0x3a, 0x44, 0x38, 0x01, 0x1e, 0x05, 0x12, 0x42, 0x17, 0x38, 0x06, 0x03, 0x00, 0x0e, 0x06, 0x42, 
+	0x56, 0x84, 0x53, 0x05, 0x06, 0x41, 0x5b, 0x17, 0x01, 0x06, 0x03, 0x00, 0x0a, 0x0d, 0x40, 0x06, 0x02, 0x0d, 0x42, 0x06, 0x50, 0x6a, 0x05, 0x0d, 
+	0x43, 0x77, 0x87, 0x06, 0x0d, 0x03, 0x00, 0x40, 0x07, 0x16, 0x08, 0x43, 0x44, 0x71, 0x08, 0x07, 0x03, 0x00, 0x16, 0x07, 0x42, 0x69, 0x18, 0x08, 
+	0x01, 0x07, 0x03, 0x00, 0x40, 0x09, 0x14, 0x0a, 0x42, 0x4f, 0x18, 0x70, 0x01, 0x0a, 0x40, 0x09, 0x03, 0x00, 0x40, 0x0f, 0x04, 0x09, 0x40, 0x34, 
+	0x0d, 0x09, 0x42, 0x07, 0x2e, 0x80, 0x02, 0x09, 0x40, 0x0f, 0x03, 0x00, 0x40, 0x32, 0x03, 0x04, 0x42, 0x68, 0x8a, 0x52, 0x0b, 0x04, 0x40, 0x4e, 
+	0x01, 0x2e, 0x40, 0x34, 0x02, 0x04, 0x40, 0x32, 0x03, 0x00, 0x40, 0x30, 0x03, 0x04, 0x43, 0x4c, 0x7d, 0x18, 0x20, 0x01, 0x04, 0x01, 0x0f, 0x05, 
+	0x04, 0x43, 0x65, 0x18, 0x7f, 0x4d, 0x03, 0x04, 0x40, 0x30, 0x03, 0x00, 0x40, 0x24, 0x05, 0x0f, 0x44, 0x20, 0x21, 0x43, 0x76, 0x5a, 0x03, 0x0f, 
+	0x44, 0x55, 0x72, 0x43, 0x21, 0x20, 0x05, 0x0f, 0x40, 0x24, 0x04, 0x00, 0x40, 0x1b, 0x04, 0x16, 0x45, 0x0e, 0x33, 0x20, 0x83, 0x47, 0x17, 0x01, 
+	0x21, 0x44, 0x17, 0x47, 0x86, 0x6f, 0x33, 0x02, 0x16, 0x40, 0x0e, 0x01, 0x16, 0x40, 0x1b, 0x06, 0x00, 0x40, 0x1b, 0x08, 0x0e, 0x40, 0x51, 0x01, 
+	0x39, 0x40, 0x54, 0x08, 0x0e, 0x40, 0x1b, 0x08, 0x00, 0x43, 0x48, 0x2f, 0x1c, 0x4b, 0x0d, 0x15, 0x43, 0x4a, 0x1c, 0x2f, 0x24, 0x3f, 0x00, 0x04, 
+	0x00
+};
+const PackedIcon clock_icon_theme = {32, 32, clock_icon_theme_palette, 142, clock_icon_theme_data, 577};
+
+// GPUSA_Logo, 295x125px, 256 colors, 10892 bytes (raw 73750)
+static const uint16_t GPUSA_Logo_theme_palette [] PROGMEM = {
+	0x0000, 0x1ca7, 0x2b15, 0x2af3, 0x1c87, 0x2b35, 0x2b14, 0x2af4, 0x0020, 0x2376, 0x0040, 0x1c67, 0x2b55, 0x2b34, 0x0841, 0x1284, 
+	0x1ba6, 0x0922, 0x1c27, 0x1bc6, 0x2b13, 0x0861, 0x1c47, 0x0061, 0x08a1, 0x11e3, 0x08c2, 0x0942, 0x0041, 0x1224, 0x2396, 0x1c07, 
+	0x0862, 0x0902, 0x1be7, 0x08c1, 0x08e2, 0x0983, 0x1499, 0x2af5, 0x1244, 0xef5d, 0x1264, 0x1b86, 0x1082, 0x23b7, 0x2b56, 0x0021, 
+	0x09a3, 0x10c4, 0x12c5, 0x12e5, 0x1305, 0x1b25, 0x1b66, 0x0962, 0x1479, 0x1968, 0x8c51, 0x0881, 0x1203, 0x2355, 0x2356, 0xce59, 
+	0xdefb, 0xffff, 0x2ab1, 0x8430, 0x12a5, 0x14ba, 0xd6ba, 0xe71c, 0xf7be, 0x0882, 0x08a3, 0x1b46, 0x2b76, 0x3313, 0x3334, 0x4208, 
+	0x0883, 0x11c3, 0x1b26, 0x1c38, 0x23d7, 0x2ad2, 0x4228, 0x10a3, 0x1bf7, 0x2965, 0xb596, 0xffdf, 0x1106, 0x1168, 0x1438, 0x18e3, 
+	0x1926, 0x1947, 0x1989, 0x5acb, 0x632c, 0x1c18, 0x2124, 0x2335, 0x2945, 0x31a6, 0x3314, 0x5aeb, 0x8410, 0x10e4, 0x10e5, 0x1bf8, 
+	0x23b6, 0x3186, 0x39c7, 0xa534, 0xad55, 0xad75, 0xd69a, 0x0062, 0x1ab0, 0x1b05, 0x2375, 0x2a4e, 0x2a90, 0x2af2, 0x32f3, 0x8c71, 
+	0x9cd3, 0xb5b6, 0xc638, 0x0081, 0x10a2, 0x1189, 0x1204, 0x1325, 0x1458, 0x19aa, 0x1af2, 0x32d1, 0xbdf7, 0xdedb, 0x0060, 0x08c4, 
+	0x11a3, 0x11aa, 0x14da, 0x1be6, 0x1c79, 0x21eb, 0x222d, 0x2354, 0x2397, 0x6b4d, 0xe73c, 0xef7d, 0x1183, 0x12a4, 0x1b45, 0x1c59, 
+	0x21ca, 0x21ec, 0x2334, 0x23f7, 0x2ad3, 0x2b75, 0x2b96, 0x32b0, 0x4a49, 0x52aa, 0x630c, 0xc618, 0xce79, 0x08e5, 0x0cba, 0x10c3, 
+	0x1127, 0x1163, 0x11cb, 0x1905, 0x1a2d, 0x1ad1, 0x1bd6, 0x2104, 0x21a9, 0x23d8, 0x2a6f, 0x7bcf, 0x7bef, 0xa514, 0x08e1, 0x1459, 
+	0x1a90, 0x1bb7, 0x21aa, 0x224e, 0x226f, 0x2313, 0x2395, 0x23d6, 0x2a2d, 0x2b36, 0x2b54, 0x39e7, 0x4a69, 0x528a, 0x6b6d, 0x738e, 
+	0x00a1, 0x0c79, 0x0c99, 0x122d, 0x1417, 0x1437, 0x149a, 0x19a9, 0x1bc7, 0x1bd7, 0x1c58, 0x220c, 0x220d, 0x2a0c, 0x3333, 0x73ae, 
+	0x9492, 0x08a4, 0x0906, 0x0947, 0x1105, 0x1147, 0x124e, 0x18c3, 0x19cb, 0x1ae5, 0x1b96, 0x1c99, 0x21cb, 0x23b5, 0x2b97, 0x94b2, 
+	0xbdd7, 0xf79e, 0x0083, 0x00c1, 0x09c3, 0x0cda, 0x1142, 0x1146, 0x1148, 0x11ca, 0x120c, 0x120d, 0x1988, 0x19ca, 0x1a6f, 0x1a8d
+};
+static const uint8_t GPUSA_Logo_theme_data [] PROGMEM = {
+	0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x1e, 0x00, 0x02, 0x0e, 
+	0x44, 0xaf, 0x57, 0x84, 0x2c, 0x15, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x11, 0x00, 0x4c, 0x1c, 0x57, 0xe4, 0x39, 0xc2, 0x95, 0xdc, 
+	0xc3, 0x7c, 0x42, 0x7d, 0x4d, 0x55, 0x01, 0x6a, 0x43, 0x07, 0x05, 0x0d, 0x06, 0x01, 0x07, 0x42, 0x8b, 0xa0, 0x2f, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 
+	0x00, 0x3f, 0x00, 0x08, 0x00, 0x47, 0x08, 0x50, 0x61, 0xec, 0x7b, 0x42, 0x03, 0x07, 0x02, 0x02, 0x01, 0x07, 0x41, 0x27, 0x07, 0x01, 0x02, 0x43, 
+	0x06, 0x07, 0x27, 0x07, 0x01, 0x02, 0x41, 0x06, 0x02, 0x01, 0x07, 0x42, 0x27, 0x06, 0x57, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x05, 
+	0x00, 0x44, 0x31, 0xa0, 0xba, 0x4d, 0x05, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x40, 0x06, 0x02, 0x05, 0x40, 0x02, 0x01, 0x06, 0x02, 0x05, 0x01, 
+	0x02, 0x01, 0x06, 0x40, 0x02, 0x01, 0x05, 0x41, 0x06, 0x49, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x01, 0x00, 0x45, 0x0e, 0x61, 0xc8, 
+	0x7e, 0x07, 0x02, 0x01, 0x05, 0x01, 0x02, 0x44, 0x27, 0x06, 0x05, 0x0d, 0x05, 0x02, 0x02, 0x40, 0x06, 0x02, 0x05, 0x02, 0x07, 0x41, 0x05, 0x0c, 
+	0x01, 0x05, 0x40, 0x02, 0x01, 0x06, 0x40, 0x0c, 0x01, 0x05, 0x41, 0x8b, 0x08, 0x04, 0x00, 0x44, 0x0e, 0x20, 0x31, 0x77, 0x1c, 0x3f, 0x00, 0x3f, 
+	0x00, 0x3f, 0x00, 0x34, 0x00, 0x44, 0x2f, 0x61, 0x7b, 0x6a, 0x02, 0x02, 0x07, 0x03, 0x02, 0x01, 0x27, 0x42, 0x02, 0x05, 0x06, 0x02, 0x02, 0x4b, 
+	0x27, 0x06, 0x05, 0x09, 0xa3, 0xc6, 0xa4, 0x7e, 0x4d, 0x4e, 0x06, 0x05, 0x01, 0x58, 0x40, 0x09, 0x02, 0x05, 0x40, 0xc2, 0x04, 0x00, 0x48, 0x39, 
+	0xdc, 0x8b, 0xa4, 0x06, 0x6a, 0x8b, 0xa0, 0x20, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x2f, 0x00, 0x42, 0x31, 0x7b, 0x7e, 0x03, 0x02, 0x42, 0x05, 
+	0x02, 0x09, 0x02, 0x1e, 0x41, 0x09, 0x1e, 0x01, 0x09, 0x4a, 0x3e, 0x14, 0x42, 0x7b, 0xec, 0x39, 0x60, 0x8f, 0x4a, 0x15, 0x0e, 0x01, 0x08, 0x02, 
+	0x0e, 0x44, 0x57, 0xf7, 0xf9, 0xeb, 0x1e, 0x01, 0x02, 0x40, 0x31, 0x07, 0x00, 0x47, 0x2f, 0x6d, 0x89, 0x8b, 0x02, 0x03, 0xc2, 0x1c, 0x3f, 0x00, 
+	0x3f, 0x00, 0x3f, 0x00, 0x2b, 0x00, 0x44, 0x6e, 0x42, 0x2d, 0xa3, 0x05, 0x03, 0x02, 0x01, 0x05, 0x40, 0x9f, 0x02, 0x26, 0x45, 0xda, 0x7a, 0xb4, 
+	0x39, 0x6d, 0x08, 0x0f, 0x00, 0x44, 0x08, 0x53, 0x6f, 0x02, 0x42, 0x0c, 0x00, 0x44, 0x60, 0x42, 0x0c, 0x14, 0x6e, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 
+	0x00, 0x28, 0x00, 0x42, 0x5c, 0x7c, 0x06, 0x04, 0x02, 0x40, 0x27, 0x02, 0x02, 0x45, 0x06, 0xed, 0x78, 0x39, 0x31, 0x08, 0x14, 0x00, 0x44, 0x0e, 
+	0x45, 0x1e, 0x02, 0xa0, 0x0d, 0x00, 0x44, 0x08, 0xa0, 0x05, 0x07, 0x39, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x25, 0x00, 0x41, 0x6e, 0xa7, 0x08, 
+	0x02, 0x44, 0x7e, 0x7b, 0xfc, 0x57, 0x08, 0x18, 0x00, 0x41, 0x6d, 0x1e, 0x01, 0x02, 0x40, 0x31, 0x0f, 0x00, 0x43, 0xe4, 0x03, 0x06, 0xb0, 0x3f, 
+	0x00, 0x3f, 0x00, 0x3f, 0x00, 0x22, 0x00, 0x41, 0x31, 0x7b, 0x02, 0x02, 0x02, 0x05, 0x45, 0x02, 0x07, 0x03, 0x96, 0x60, 0x08, 0x1c, 0x00, 0x43, 
+	0xe5, 0x05, 0x0c, 0x4d, 0x0b, 0x00, 0x41, 0x49, 0x15, 0x03, 0x00, 0x43, 0xb3, 0x4e, 0x05, 0x61, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x1f, 0x00, 
+	0x41, 0x50, 0xc8, 0x07, 0x02, 0x42, 0x42, 0x39, 0x0e, 0x1f, 0x00, 0x43, 0x89, 0x02, 0x0c, 0x7b, 0x0b, 0x00, 0x4a, 0xd3, 0x26, 0xca, 0x7b, 0xc2, 
+	0x5c, 0x20, 0x60, 0xa5, 0x6a, 0x31, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x1c, 0x00, 0x45, 0x50, 0xc8, 0x07, 0x02, 0x2e, 0x05, 0x02, 0x02, 0x42, 
+	0x06, 0x96, 0x6e, 0x22, 0x00, 0x43, 0xff, 0x02, 0x05, 0x39, 0x0b, 0x00, 0x42, 0xb4, 0xd6, 0x05, 0x01, 0x02, 0x01, 0x05, 0x44, 0x4d, 0x4e, 0x02, 
+	0x8b, 0x08, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x19, 0x00, 0x42, 0x4a, 0xdb, 0x06, 0x01, 0x05, 0x46, 0x38, 0xf5, 0x45, 0x54, 0x4e, 0xdd, 0x50, 
+	0x24, 0x00, 0x43, 0x14, 0x05, 0x02, 0x50, 0x0b, 0x00, 0x41, 0x95, 0x38, 0x02, 0x02, 0x03, 0x05, 0x01, 0x02, 0x40, 0xa0, 0x3f, 0x00, 0x3f, 0x00, 
+	0x3f, 0x00, 0x17, 0x00, 0x42, 0xaf, 0x78, 0x0c, 0x02, 0x05, 0x45, 0xd9, 0xbf, 0x05, 0xed, 0xff, 0x20, 0x26, 0x00, 0x42, 0x97, 0x05, 0x55, 0x0c, 
+	0x00, 0x42, 0x6d, 0x38, 0x3e, 0x01, 0x09, 0x40, 0x3e, 0x01, 0x02, 0x44, 0x05, 0x9f, 0x45, 0xeb, 0xaf, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x14, 
+	0x00, 0x44, 0xe4, 0x78, 0x54, 0xf5, 0x05, 0x01, 0x02, 0x44, 0x06, 0x6f, 0x2d, 0xc2, 0x0e, 0x27, 0x00, 0x43, 0x08, 0x2d, 0x05, 0xba, 0x0d, 0x00, 
+	0x40, 0x03, 0x01, 0x3e, 0x41, 0x09, 0x3e, 0x01, 0x02, 0x44, 0x3e, 0x45, 0x58, 0x2d, 0x78, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x12, 0x00, 0x42, 
+	0xb3, 0xba, 0x2d, 0x01, 0x26, 0x40, 0x54, 0x02, 0x02, 0x42, 0x42, 0xb8, 0x1c, 0x29, 0x00, 0x43, 0x08, 0xc7, 0x02, 0xe8, 0x0d, 0x00, 0x42, 0x6d, 
+	0x02, 0xc9, 0x01, 0x05, 0x01, 0x02, 0x45, 0x05, 0x92, 0x1e, 0x2e, 0xda, 0x4a, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x0f, 0x00, 0x41, 0x60, 0xa7, 
+	0x04, 0x02, 0x43, 0x05, 0x02, 0xba, 0x60, 0x2d, 0x00, 0x42, 0x06, 0x05, 0xfc, 0x0e, 0x00, 0x4b, 0x60, 0x06, 0x05, 0xc9, 0x3e, 0x09, 0x3e, 0x6f, 
+	0x92, 0x45, 0x9f, 0xa0, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x0c, 0x00, 0x42, 0x08, 0xb0, 0x42, 0x02, 0x02, 0x45, 0x27, 0x02, 0x07, 0x03, 0xa1, 
+	0x31, 0x2f, 0x00, 0x42, 0x42, 0x05, 0x31, 0x0f, 0x00, 0x42, 0x4a, 0x7b, 0x05, 0x01, 0x09, 0x45, 0x3e, 0x67, 0x53, 0xbf, 0x2e, 0x7d, 0x3f, 0x00, 
+	0x3f, 0x00, 0x3f, 0x00, 0x0a, 0x00, 0x42, 0x20, 0x62, 0x4d, 0x03, 0x02, 0x44, 0x05, 0x67, 0x7c, 0x61, 0x0e, 0x31, 0x00, 0x42, 0x95, 0x02, 0x49, 
+	0x11, 0x00, 0x49, 0x4a, 0xdb, 0x0d, 0xc9, 0x02, 0x65, 0x5e, 0x05, 0x2e, 0x2c, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x06, 0x00, 0x43, 0x2f, 0x60, 
+	0x7b, 0x6a, 0x01, 0x05, 0x01, 0x02, 0x43, 0x07, 0x42, 0xd7, 0x49, 0x34, 0x00, 0x42, 0xb3, 0x05, 0x2f, 0x13, 0x00, 0x47, 0x0e, 0xec, 0x4e, 0xbf, 
+	0x9f, 0x05, 0xc9, 0x61, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x03, 0x00, 0x44, 0x0e, 0x61, 0x7b, 0x7e, 0x07, 0x02, 0x02, 0x43, 0xa4, 0xdc, 0x39, 
+	0x49, 0x37, 0x00, 0x42, 0x08, 0x4d, 0x2f, 0x15, 0x00, 0x45, 0x20, 0x78, 0x94, 0x05, 0x02, 0xec, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x4b, 0x20, 
+	0x39, 0xff, 0x97, 0xeb, 0x45, 0xd6, 0xeb, 0x3d, 0x78, 0xd7, 0x31, 0x3c, 0x00, 0x40, 0x59, 0x18, 0x00, 0x40, 0xd7, 0x01, 0x02, 0x40, 0x96, 0x3f, 
+	0x00, 0x3f, 0x00, 0x3b, 0x00, 0x4b, 0x31, 0x39, 0xba, 0x78, 0x3d, 0x05, 0xc4, 0x96, 0xfd, 0xfc, 0x6d, 0x0e, 0x3f, 0x00, 0x1b, 0x00, 0x42, 0xb8, 
+	0x05, 0xb2, 0x3f, 0x00, 0x3f, 0x00, 0x3d, 0x00, 0x40, 0x08, 0x3f, 0x00, 0x25, 0x00, 0x41, 0xe8, 0xfb, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 
+	0x00, 0x25, 0x00, 0x40, 0xb3, 0x06, 0x00, 0x42, 0x59, 0xba, 0x8a, 0x01, 0xb4, 0x41, 0x95, 0x85, 0x01, 0x39, 0x44, 0x60, 0xe1, 0x57, 0xaf, 0x08, 
+	0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x1a, 0x00, 0x44, 0x4a, 0x95, 0xc5, 0xda, 0x45, 0x03, 0x26, 0x41, 0xeb, 0x26, 0x01, 0x88, 0x45, 
+	0x53, 0x2d, 0x3d, 0x03, 0x14, 0xd3, 0x01, 0x95, 0x46, 0x5d, 0xe5, 0x61, 0x8f, 0x49, 0x15, 0x0e, 0x3f, 0x00, 0x3f, 0x00, 0x21, 0x00, 0x40, 0x08, 
+	0x01, 0x1c, 0x43, 0x77, 0x50, 0x4a, 0x8f, 0x01, 0xad, 0x40, 0xe2, 0x01, 0xe3, 0x01, 0x5d, 0x43, 0xe3, 0xad, 0x20, 0x08, 0x3f, 0x00, 0x19, 0x00, 
+	0x44, 0x1c, 0xf7, 0x95, 0xb5, 0x70, 0x01, 0x54, 0x41, 0xa3, 0x58, 0x02, 0x6f, 0x01, 0x65, 0x43, 0x53, 0x5e, 0x6f, 0x5e, 0x01, 0x53, 0x4e, 0xda, 
+	0x9f, 0x65, 0x58, 0xb6, 0x09, 0xed, 0x0d, 0x78, 0x96, 0x7b, 0x91, 0xfd, 0x39, 0x6e, 0x01, 0x31, 0x42, 0x0e, 0x2f, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 
+	0x05, 0x00, 0x4b, 0x2f, 0xaf, 0xb3, 0x61, 0x5d, 0xd7, 0xfd, 0x95, 0xb4, 0xc4, 0x42, 0xb5, 0x01, 0x8a, 0x41, 0xa2, 0x97, 0x01, 0x7a, 0x4f, 0x09, 
+	0x54, 0x53, 0xb9, 0x9f, 0x45, 0x94, 0x2d, 0x54, 0xa6, 0x4c, 0xa6, 0x97, 0x78, 0xb2, 0x4a, 0x3f, 0x00, 0x1a, 0x00, 0x44, 0x0e, 0xb3, 0xd7, 0xc3, 
+	0x14, 0x02, 0x1e, 0x02, 0x05, 0x43, 0x98, 0x1e, 0xc1, 0x3d, 0x01, 0x05, 0x40, 0x2e, 0x02, 0x1e, 0x02, 0x05, 0x02, 0x09, 0x41, 0xeb, 0x2d, 0x01, 
+	0x05, 0x01, 0x09, 0x49, 0x3d, 0x0d, 0x4e, 0xb6, 0x03, 0x42, 0x96, 0xb4, 0xdd, 0x62, 0x01, 0x39, 0x40, 0x6e, 0x01, 0x57, 0x02, 0x2c, 0x40, 0x20, 
+	0x3f, 0x00, 0x3f, 0x00, 0x05, 0x00, 0x43, 0x1c, 0x85, 0x03, 0x98, 0x02, 0xee, 0x40, 0xa6, 0x01, 0x2d, 0x4a, 0x9f, 0x26, 0x94, 0x53, 0x54, 0x4c, 
+	0x0c, 0x1e, 0x03, 0x85, 0x08, 0x3f, 0x00, 0x1c, 0x00, 0x45, 0x84, 0x60, 0xfd, 0x7b, 0x03, 0x02, 0x01, 0x09, 0x41, 0xea, 0x67, 0x01, 0x02, 0x40, 
+	0x2e, 0x02, 0x09, 0x40, 0x05, 0x01, 0x02, 0x40, 0x3e, 0x01, 0x09, 0x41, 0x26, 0x2d, 0x01, 0x02, 0x01, 0x1e, 0x48, 0x09, 0xc9, 0x02, 0x45, 0x1e, 
+	0x4c, 0x09, 0x1e, 0x02, 0x01, 0x05, 0x40, 0x2e, 0x01, 0x09, 0x40, 0x2e, 0x02, 0x02, 0x40, 0xa6, 0x01, 0xc5, 0x01, 0x55, 0x02, 0x8b, 0x42, 0xfb, 
+	0xb4, 0xe8, 0x01, 0x95, 0x42, 0xd7, 0x5c, 0xb0, 0x01, 0x60, 0x41, 0x31, 0x20, 0x01, 0x49, 0x40, 0x0e, 0x3f, 0x00, 0x2d, 0x00, 0x43, 0x1c, 0xfa, 
+	0x09, 0xb9, 0x01, 0x2d, 0x42, 0x3d, 0x03, 0xfe, 0x02, 0xb4, 0x4b, 0xc4, 0x42, 0x0c, 0x54, 0x53, 0x94, 0x26, 0xda, 0xa3, 0x70, 0x97, 0x85, 0x3f, 
+	0x00, 0x1f, 0x00, 0x48, 0x08, 0x20, 0xe4, 0x39, 0x96, 0x7c, 0xa4, 0x06, 0x05, 0x02, 0x0c, 0x02, 0x02, 0x40, 0x05, 0x01, 0x0c, 0x41, 0x38, 0x98, 
+	0x01, 0x02, 0x40, 0x0c, 0x01, 0x2e, 0x43, 0x05, 0x02, 0x45, 0x09, 0x01, 0x0c, 0x41, 0x3e, 0x06, 0x01, 0x02, 0x43, 0x2e, 0x3e, 0x09, 0x05, 0x01, 
+	0x02, 0x41, 0x67, 0x09, 0x01, 0x3e, 0x40, 0x05, 0x01, 0x02, 0x43, 0x05, 0x2e, 0x3e, 0x2e, 0x02, 0x02, 0x44, 0x0c, 0x3e, 0x09, 0x3e, 0x05, 0x01, 
+	0x02, 0x46, 0x0c, 0xa5, 0x0d, 0x55, 0x03, 0x8b, 0xba, 0x01, 0x96, 0x41, 0xdd, 0xf8, 0x01, 0x39, 0x44, 0xe1, 0x31, 0x57, 0x1c, 0x2f, 0x3f, 0x00, 
+	0x1d, 0x00, 0x46, 0x5d, 0x7a, 0xb9, 0x2d, 0x78, 0x85, 0x50, 0x07, 0x00, 0x4b, 0x08, 0x8f, 0x89, 0x42, 0x0c, 0x1e, 0xa3, 0xda, 0x26, 0xd6, 0x3d, 
+	0x8f, 0x3f, 0x00, 0x23, 0x00, 0x48, 0x08, 0x49, 0x6e, 0x39, 0x95, 0xba, 0x4d, 0x0c, 0x3e, 0x02, 0x05, 0x43, 0x94, 0x54, 0x3e, 0x3d, 0x03, 0x05, 
+	0x42, 0x3d, 0x92, 0x09, 0x02, 0x05, 0x40, 0x02, 0x05, 0x05, 0x42, 0x02, 0x67, 0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x05, 0x01, 0x02, 0x48, 0x05, 
+	0x4c, 0xee, 0x2d, 0x94, 0xd6, 0x94, 0x65, 0x54, 0x01, 0x4c, 0x41, 0x0c, 0x05, 0x01, 0x02, 0x02, 0x05, 0x40, 0x06, 0x01, 0x02, 0x01, 0x05, 0x4d, 
+	0x0c, 0x06, 0x4d, 0x42, 0x7c, 0xa7, 0x95, 0xdd, 0xf8, 0x39, 0x31, 0x57, 0x2f, 0x08, 0x3f, 0x00, 0x10, 0x00, 0x45, 0x1c, 0xc0, 0xb9, 0x09, 0xb2, 
+	0x77, 0x0e, 0x00, 0x48, 0x4a, 0x95, 0x0d, 0x0c, 0x05, 0x0c, 0x70, 0x1e, 0xf9, 0x3f, 0x00, 0x29, 0x00, 0x48, 0x0e, 0x31, 0x5c, 0x62, 0xdb, 0x03, 
+	0xca, 0x7a, 0xa6, 0x02, 0x02, 0x43, 0x09, 0x1e, 0x45, 0x1e, 0x02, 0x02, 0x40, 0xa5, 0x01, 0x1e, 0x40, 0x2e, 0x01, 0x02, 0x44, 0x2e, 0x98, 0x1e, 
+	0x4c, 0x05, 0x01, 0x02, 0x43, 0x09, 0x1e, 0x4c, 0x2e, 0x01, 0x02, 0x41, 0x05, 0x98, 0x02, 0x2d, 0x01, 0xee, 0x01, 0xa6, 0x42, 0xee, 0xa3, 0xda, 
+	0x01, 0x26, 0x43, 0x53, 0xa3, 0xa6, 0x0c, 0x01, 0x05, 0x42, 0x02, 0x05, 0xc9, 0x02, 0x05, 0x40, 0x02, 0x01, 0x05, 0x08, 0x02, 0x49, 0x06, 0x4d, 
+	0x42, 0xa7, 0xa1, 0xe8, 0x62, 0x6e, 0x31, 0x20, 0x3f, 0x00, 0x07, 0x00, 0x44, 0xf2, 0x3d, 0x2d, 0xb2, 0x2f, 0x12, 0x00, 0x43, 0x20, 0x96, 0x0d, 
+	0x05, 0x01, 0x0d, 0x42, 0x0c, 0x96, 0x08, 0x3f, 0x00, 0x2e, 0x00, 0x49, 0x2f, 0x4a, 0x60, 0x39, 0xec, 0xba, 0x42, 0x53, 0x0c, 0x06, 0x01, 0x02, 
+	0x46, 0x0c, 0x09, 0x54, 0x26, 0x38, 0x2d, 0x05, 0x01, 0x09, 0x40, 0x0c, 0x02, 0x02, 0x01, 0x2e, 0x40, 0x4c, 0x01, 0x05, 0x40, 0xee, 0x01, 0xb9, 
+	0x45, 0x2d, 0x09, 0x03, 0x96, 0xb2, 0x85, 0x01, 0x5d, 0x4b, 0x91, 0x95, 0xc4, 0x14, 0x70, 0x65, 0x94, 0x26, 0x9f, 0xa3, 0x1e, 0x4c, 0x01, 0x2e, 
+	0x40, 0x05, 0x01, 0x02, 0x41, 0x05, 0x2e, 0x01, 0x0c, 0x02, 0x02, 0x43, 0x0c, 0x2e, 0x0c, 0x05, 0x02, 0x02, 0x40, 0x2e, 0x01, 0x0c, 0x41, 0x02, 
+	0x06, 0x01, 0x02, 0x47, 0x03, 0x7c, 0x7b, 0xc2, 0x61, 0x31, 0x49, 0x08, 0x3e, 0x00, 0x43, 0x4a, 0x09, 0x8a, 0x50, 0x16, 0x00, 0x41, 0x5c, 0x7d, 
+	0x02, 0x0d, 0x42, 0x0c, 0xc0, 0x08, 0x3f, 0x00, 0x34, 0x00, 0x51, 0x08, 0x0e, 0x31, 0x60, 0xb8, 0x95, 0xc3, 0x7a, 0xc7, 0xea, 0x45, 0xc1, 0x98, 
+	0x1e, 0x09, 0x3e, 0x3d, 0x67, 0x01, 0x4c, 0x41, 0x2e, 0x4c, 0x01, 0xb9, 0x43, 0x09, 0x96, 0xe2, 0x2f, 0x09, 0x00, 0x49, 0x4a, 0x89, 0x42, 0x0c, 
+	0x4c, 0x54, 0x53, 0x38, 0x9f, 0x4c, 0x02, 0x02, 0x03, 0x05, 0x01, 0x02, 0x42, 0x6f, 0x9f, 0x54, 0x01, 0x05, 0x42, 0x06, 0x27, 0x02, 0x02, 0x05, 
+	0x41, 0x02, 0x07, 0x01, 0x02, 0x02, 0x05, 0x02, 0x02, 0x46, 0x6a, 0x03, 0x7c, 0xec, 0x39, 0x6d, 0x0e, 0x38, 0x00, 0x42, 0x77, 0x09, 0xfa, 0x19, 
+	0x00, 0x41, 0x77, 0x42, 0x01, 0x0d, 0x42, 0x06, 0x05, 0xc0, 0x3f, 0x00, 0x3d, 0x00, 0x4f, 0x1c, 0x31, 0xf7, 0x39, 0xff, 0x78, 0x97, 0x58, 0x94, 
+	0x92, 0x45, 0x9f, 0xb9, 0x97, 0x85, 0x2f, 0x0f, 0x00, 0x41, 0xad, 0xc4, 0x02, 0x05, 0x41, 0x0c, 0xa5, 0x03, 0x02, 0x40, 0x05, 0x01, 0x02, 0x46, 
+	0x07, 0x6f, 0xd6, 0x58, 0x45, 0x6f, 0x3e, 0x02, 0x67, 0x40, 0x2e, 0x01, 0x05, 0x41, 0x02, 0x06, 0x01, 0x02, 0x02, 0x05, 0x40, 0x02, 0x01, 0x27, 
+	0x03, 0x02, 0x01, 0x27, 0x45, 0x03, 0x42, 0xdc, 0xb8, 0x31, 0x08, 0x32, 0x00, 0x42, 0x2f, 0x8a, 0x85, 0x1b, 0x00, 0x41, 0x2f, 0xc3, 0x02, 0x06, 
+	0x41, 0x0c, 0xfb, 0x3f, 0x00, 0x3f, 0x00, 0x04, 0x00, 0x45, 0x1c, 0x6e, 0x1e, 0x2d, 0x91, 0x08, 0x13, 0x00, 0x42, 0x5c, 0x42, 0x05, 0x02, 0x0d, 
+	0x42, 0x0c, 0x4c, 0x05, 0x01, 0x02, 0x46, 0x05, 0x0c, 0x26, 0xb9, 0x02, 0x5e, 0x45, 0x03, 0x92, 0x43, 0xf5, 0x45, 0xae, 0xf5, 0x01, 0x92, 0x03, 
+	0xae, 0x40, 0x45, 0x02, 0x26, 0x03, 0x38, 0x02, 0xbf, 0x47, 0x5e, 0xbf, 0x53, 0x58, 0x97, 0xff, 0xf7, 0x20, 0x2e, 0x00, 0x41, 0xd3, 0x5d, 0x1d, 
+	0x00, 0x41, 0x2f, 0xc4, 0x02, 0x06, 0x41, 0x65, 0xe3, 0x3f, 0x00, 0x3f, 0x00, 0x03, 0x00, 0x43, 0x77, 0x3d, 0x8a, 0xf2, 0x16, 0x00, 0x41, 0x2f, 
+	0x95, 0x03, 0x0d, 0x01, 0x05, 0x4f, 0x02, 0x06, 0x02, 0x05, 0x53, 0x45, 0x5e, 0x45, 0xc1, 0x05, 0x0c, 0x09, 0x4c, 0xc9, 0x05, 0x3e, 0x01, 0x09, 
+	0x40, 0x1e, 0x02, 0x09, 0x40, 0x98, 0x02, 0x2d, 0x46, 0x1e, 0x2d, 0xc1, 0xd9, 0x54, 0x6f, 0x58, 0x01, 0xd9, 0x40, 0x58, 0x01, 0x65, 0x46, 0x53, 
+	0x65, 0x58, 0xc7, 0x7d, 0xa0, 0x31, 0x2a, 0x00, 0x41, 0xad, 0x85, 0x1f, 0x00, 0x41, 0x1c, 0x42, 0x01, 0x06, 0x42, 0x38, 0x3d, 0x77, 0x3f, 0x00, 
+	0x3f, 0x00, 0x01, 0x00, 0x42, 0x1c, 0x3d, 0xd3, 0x1a, 0x00, 0x42, 0xf8, 0x06, 0x0d, 0x01, 0x06, 0x01, 0x02, 0x41, 0x06, 0x02, 0x01, 0x05, 0x43, 
+	0x58, 0x65, 0x1e, 0x06, 0x01, 0x02, 0x01, 0x05, 0x02, 0x02, 0x42, 0x05, 0x06, 0x05, 0x03, 0x02, 0x46, 0x05, 0x02, 0x05, 0x27, 0x02, 0x27, 0x02, 
+	0x01, 0x05, 0x40, 0x02, 0x02, 0x27, 0x01, 0x02, 0x44, 0x05, 0x02, 0x07, 0x27, 0x02, 0x01, 0x05, 0x43, 0x7e, 0xa1, 0x6e, 0x08, 0x26, 0x00, 0x40, 
+	0x85, 0x21, 0x00, 0x45, 0xe1, 0x03, 0x7a, 0x53, 0x0d, 0xfe, 0x3f, 0x00, 0x3f, 0x00, 0x01, 0x00, 0x41, 0x78, 0x91, 0x1c, 0x00, 0x41, 0x5c, 0x14, 
+	0x02, 0x06, 0x01, 0x0c, 0x40, 0x05, 0x02, 0x02, 0x03, 0x05, 0x40, 0x06, 0x01, 0x02, 0x41, 0x05, 0x67, 0x01, 0x02, 0x40, 0x06, 0x01, 0x02, 0x01, 
+	0x05, 0x0b, 0x02, 0x40, 0x27, 0x04, 0x02, 0x41, 0x07, 0x27, 0x03, 0x02, 0x44, 0x27, 0x07, 0x7e, 0xa1, 0x31, 0x23, 0x00, 0x41, 0x4a, 0x08, 0x22, 
+	0x00, 0x40, 0x62, 0x01, 0xc7, 0x42, 0x14, 0x09, 0x8f, 0x3f, 0x00, 0x3f, 0x00, 0x01, 0x91, 0x1e, 0x00, 0x40, 0x5c, 0x02, 0x06, 0x49, 0xa3, 0xb9, 
+	0x95, 0x89, 0xa1, 0xba, 0xde, 0x0d, 0x0c, 0x05, 0x01, 0x07, 0x40, 0x02, 0x01, 0x0c, 0x47, 0x05, 0x02, 0x07, 0x02, 0x05, 0x0c, 0x2e, 0x05, 0x02, 
+	0x02, 0x02, 0x05, 0x01, 0x02, 0x42, 0x27, 0x02, 0x0c, 0x01, 0x05, 0x02, 0x02, 0x03, 0x05, 0x40, 0x02, 0x01, 0x06, 0x02, 0x05, 0x44, 0x02, 0x07, 
+	0x42, 0x39, 0x1c, 0x3f, 0x00, 0x05, 0x00, 0x45, 0x08, 0xb6, 0x0c, 0x14, 0x06, 0xc0, 0x3f, 0x00, 0x3e, 0x00, 0x41, 0x77, 0xb2, 0x20, 0x00, 0x40, 
+	0x62, 0x01, 0x06, 0x42, 0x94, 0x09, 0x8a, 0x03, 0x00, 0x49, 0x0e, 0x4a, 0x5c, 0xb8, 0xa1, 0xba, 0x55, 0x4e, 0x05, 0x27, 0x01, 0x07, 0x40, 0x02, 
+	0x02, 0x05, 0x42, 0x02, 0x06, 0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x05, 0x41, 0x02, 0x27, 0x01, 0x02, 0x42, 0x06, 0x05, 0x02, 0x02, 0x07, 0x01, 
+	0x02, 0x47, 0x05, 0x02, 0x07, 0x27, 0x02, 0x03, 0x95, 0x15, 0x3f, 0x00, 0x04, 0x00, 0x45, 0x5d, 0x06, 0x14, 0x03, 0x09, 0x49, 0x3f, 0x00, 0x3d, 
+	0x00, 0x40, 0x5d, 0x22, 0x00, 0x45, 0xc3, 0x06, 0x38, 0x06, 0x2d, 0x5d, 0x09, 0x00, 0x46, 0x08, 0xaf, 0x61, 0xc2, 0xdc, 0x42, 0x03, 0x01, 0x02, 
+	0x40, 0x67, 0x05, 0x02, 0x40, 0x27, 0x01, 0x07, 0x02, 0x02, 0x40, 0x07, 0x01, 0x27, 0x41, 0x02, 0x06, 0x01, 0x02, 0x02, 0x07, 0x41, 0x02, 0x06, 
+	0x01, 0x02, 0x41, 0x07, 0x27, 0x02, 0x02, 0x42, 0x6a, 0xa1, 0x20, 0x3f, 0x00, 0x03, 0x00, 0x44, 0x42, 0x14, 0x03, 0x0d, 0xfa, 0x3f, 0x00, 0x3c, 
+	0x00, 0x41, 0x1c, 0x20, 0x22, 0x00, 0x45, 0x20, 0xa2, 0x53, 0x06, 0x0d, 0xea, 0x0c, 0x00, 0x40, 0x0a, 0x01, 0x00, 0x46, 0x2f, 0x4a, 0x60, 0x96, 
+	0x7d, 0x03, 0x07, 0x01, 0x06, 0x41, 0x05, 0x0c, 0x01, 0x05, 0x42, 0x02, 0x06, 0x02, 0x01, 0x05, 0x43, 0x54, 0x88, 0x5e, 0x09, 0x03, 0x02, 0x01, 
+	0x06, 0x05, 0x02, 0x40, 0x07, 0x01, 0x02, 0x42, 0x7e, 0xb8, 0x08, 0x3f, 0x00, 0x01, 0x00, 0x40, 0x89, 0x02, 0x03, 0x40, 0x8a, 0x3f, 0x00, 0x3f, 
+	0x00, 0x22, 0x00, 0x45, 0xfa, 0xc7, 0x14, 0x03, 0x2d, 0x5d, 0x14, 0x00, 0x50, 0x15, 0x6e, 0x62, 0xc3, 0x14, 0xc7, 0x2d, 0xc1, 0x1e, 0xea, 0x70, 
+	0x6f, 0x92, 0x2d, 0x58, 0x26, 0x02, 0x02, 0x05, 0x02, 0x07, 0x40, 0x02, 0x02, 0x05, 0x02, 0x67, 0x40, 0x2e, 0x01, 0x0c, 0x41, 0x42, 0x6d, 0x3f, 
+	0x00, 0x41, 0x00, 0x50, 0x02, 0x03, 0x41, 0x09, 0x49, 0x3f, 0x00, 0x3f, 0x00, 0x21, 0x00, 0x45, 0x1c, 0xc5, 0x14, 0x03, 0x0d, 0x8a, 0x19, 0x00, 
+	0x4c, 0x20, 0xe5, 0xff, 0x3d, 0xda, 0x38, 0x26, 0x38, 0x07, 0x3d, 0xae, 0x0c, 0x02, 0x01, 0x06, 0x02, 0x07, 0x01, 0x02, 0x44, 0x2e, 0x26, 0xae, 
+	0xd2, 0xae, 0x02, 0x45, 0x43, 0xd2, 0x26, 0xff, 0x08, 0x3f, 0x00, 0x40, 0x42, 0x01, 0x03, 0x41, 0x05, 0x5d, 0x3f, 0x00, 0x3f, 0x00, 0x22, 0x00, 
+	0x40, 0x89, 0x02, 0x03, 0x41, 0xb9, 0x4a, 0x1c, 0x00, 0x47, 0x20, 0x5c, 0x96, 0x54, 0x53, 0x38, 0x5e, 0x07, 0x02, 0x06, 0x02, 0x07, 0x46, 0x06, 
+	0x3d, 0xd6, 0x65, 0x02, 0x06, 0x02, 0x03, 0x05, 0x43, 0x02, 0x05, 0xba, 0x20, 0x3e, 0x00, 0x40, 0xa1, 0x01, 0x03, 0x41, 0x06, 0xd3, 0x3f, 0x00, 
+	0x3f, 0x00, 0x22, 0x00, 0x40, 0x50, 0x02, 0x03, 0x41, 0x09, 0xb2, 0x1f, 0x00, 0x44, 0x08, 0xe4, 0x7b, 0x4e, 0x06, 0x02, 0x07, 0x40, 0x02, 0x01, 
+	0x05, 0x44, 0x09, 0x26, 0x6f, 0x02, 0x05, 0x02, 0x02, 0x01, 0x07, 0x45, 0x06, 0x02, 0x06, 0x02, 0x42, 0x57, 0x3d, 0x00, 0x40, 0x62, 0x02, 0x03, 
+	0x40, 0x78, 0x3f, 0x00, 0x3f, 0x00, 0x23, 0x00, 0x40, 0x7c, 0x01, 0x03, 0x41, 0x0d, 0x8a, 0x22, 0x00, 0x42, 0x08, 0x61, 0x7c, 0x01, 0x07, 0x01, 
+	0x06, 0x42, 0x1e, 0x26, 0xc1, 0x01, 0x02, 0x01, 0x06, 0x41, 0x02, 0x27, 0x01, 0x07, 0x03, 0x06, 0x42, 0x07, 0xa4, 0xb3, 0x3c, 0x00, 0x40, 0x5c, 
+	0x02, 0x03, 0x40, 0xc5, 0x3f, 0x00, 0x3f, 0x00, 0x23, 0x00, 0x40, 0x89, 0x02, 0x03, 0x41, 0x2d, 0x08, 0x24, 0x00, 0x45, 0x61, 0x42, 0x07, 0x1e, 
+	0x26, 0x70, 0x02, 0x07, 0x02, 0x06, 0x03, 0x07, 0x01, 0x06, 0x02, 0x07, 0x41, 0x7e, 0xb3, 0x3b, 0x00, 0x40, 0x8f, 0x02, 0x03, 0x40, 0xa2, 0x3f, 
+	0x00, 0x3f, 0x00, 0x23, 0x00, 0x40, 0x5c, 0x02, 0x03, 0x41, 0xb9, 0x50, 0x25, 0x00, 0x43, 0x0e, 0x78, 0xd1, 0x09, 0x01, 0x06, 0x01, 0x02, 0x01, 
+	0x07, 0x41, 0x06, 0x02, 0x01, 0x06, 0x02, 0x07, 0x02, 0x06, 0x42, 0x07, 0x55, 0x20, 0x3a, 0x00, 0x40, 0x4a, 0x02, 0x03, 0x40, 0x97, 0x3f, 0x00, 
+	0x3f, 0x00, 0x23, 0x00, 0x40, 0x20, 0x02, 0x03, 0x41, 0x98, 0xe2, 0x26, 0x00, 0x42, 0x1c, 0x7d, 0x07, 0x01, 0x06, 0x01, 0x02, 0x02, 0x07, 0x43, 
+	0x02, 0x06, 0x05, 0x0d, 0x01, 0x06, 0x40, 0x02, 0x01, 0x05, 0x43, 0x06, 0x07, 0x7c, 0x2f, 0x39, 0x00, 0x40, 0xe1, 0x02, 0x03, 0x40, 0x97, 0x3f, 
+	0x00, 0x3f, 0x00, 0x23, 0x00, 0x41, 0x2f, 0x55, 0x01, 0x03, 0x41, 0x09, 0x5d, 0x27, 0x00, 0x41, 0x62, 0x07, 0x01, 0x06, 0x40, 0x02, 0x03, 0x07, 
+	0x42, 0x02, 0xd9, 0x26, 0x03, 0xd2, 0x40, 0x45, 0x01, 0x26, 0x01, 0xd1, 0x40, 0x78, 0x39, 0x00, 0x40, 0xad, 0x02, 0x03, 0x40, 0xc5, 0x3f, 0x00, 
+	0x3f, 0x00, 0x24, 0x00, 0x40, 0x55, 0x01, 0x03, 0x41, 0x09, 0x91, 0x27, 0x00, 0x41, 0x39, 0x06, 0x02, 0x07, 0x01, 0x06, 0x47, 0x07, 0x06, 0x58, 
+	0x5e, 0x67, 0xa2, 0x67, 0xa2, 0x06, 0x3d, 0x40, 0x60, 0x38, 0x00, 0x40, 0xb0, 0x02, 0x03, 0x40, 0xb5, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x40, 
+	0x42, 0x01, 0x03, 0x41, 0x09, 0x91, 0x26, 0x00, 0x42, 0x08, 0xa7, 0x06, 0x02, 0x07, 0x46, 0x06, 0x6a, 0x0d, 0x53, 0x5e, 0x06, 0x07, 0x02, 0x06, 
+	0x03, 0x07, 0x44, 0x06, 0x6a, 0x06, 0x8b, 0x0e, 0x37, 0x00, 0x40, 0x89, 0x02, 0x03, 0x40, 0xe6, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x40, 0x55, 
+	0x01, 0x03, 0x41, 0x09, 0x85, 0x26, 0x00, 0x40, 0xdd, 0x01, 0x06, 0x03, 0x07, 0x43, 0x0d, 0x5e, 0x65, 0x06, 0x01, 0x07, 0x02, 0x06, 0x04, 0x07, 
+	0x01, 0x06, 0x41, 0x03, 0xb8, 0x37, 0x00, 0x40, 0x96, 0x01, 0x03, 0x41, 0x0d, 0x91, 0x3f, 0x00, 0x3f, 0x00, 0x23, 0x00, 0x41, 0x08, 0x55, 0x01, 
+	0x03, 0x41, 0x09, 0xe3, 0x24, 0x00, 0x41, 0x2f, 0xdb, 0x05, 0x07, 0x43, 0x05, 0x88, 0x58, 0x06, 0x0c, 0x07, 0x42, 0x03, 0x7e, 0x15, 0x35, 0x00, 
+	0x41, 0x08, 0x55, 0x01, 0x03, 0x41, 0x09, 0x8f, 0x3f, 0x00, 0x3f, 0x00, 0x23, 0x00, 0x40, 0x20, 0x02, 0x03, 0x41, 0x98, 0x8f, 0x23, 0x00, 0x43, 
+	0x60, 0x8b, 0x06, 0x03, 0x01, 0x07, 0x01, 0x06, 0x42, 0x0c, 0x38, 0xb6, 0x01, 0x07, 0x02, 0x06, 0x40, 0x07, 0x01, 0x03, 0x01, 0x06, 0x42, 0x0c, 
+	0x70, 0x7a, 0x02, 0x07, 0x41, 0x06, 0xb8, 0x35, 0x00, 0x40, 0x6e, 0x02, 0x03, 0x40, 0x97, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x40, 0x6e, 0x02, 
+	0x03, 0x41, 0x2d, 0x1c, 0x21, 0x00, 0x41, 0x50, 0x7b, 0x02, 0x06, 0x02, 0x03, 0x44, 0x06, 0xa5, 0x38, 0x70, 0x03, 0x01, 0x07, 0x02, 0x06, 0x40, 
+	0x07, 0x01, 0x03, 0x45, 0x07, 0x0c, 0x26, 0x65, 0x26, 0xb6, 0x02, 0x07, 0x40, 0xa7, 0x35, 0x00, 0x40, 0x95, 0x02, 0x03, 0x40, 0xe6, 0x3f, 0x00, 
+	0x3f, 0x00, 0x24, 0x00, 0x40, 0x62, 0x02, 0x03, 0x40, 0x3d, 0x20, 0x00, 0x42, 0x6d, 0xdb, 0x03, 0x01, 0x07, 0x41, 0x03, 0x07, 0x02, 0x03, 0x43, 
+	0x7a, 0x38, 0x70, 0x07, 0x01, 0x03, 0x04, 0x07, 0x01, 0x03, 0x49, 0x07, 0x58, 0x5e, 0x07, 0x3d, 0xd1, 0x5e, 0xd4, 0x58, 0xb8, 0x34, 0x00, 0x41, 
+	0x1c, 0x55, 0x01, 0x03, 0x41, 0x09, 0xad, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x40, 0xc3, 0x01, 0x03, 0x41, 0x0d, 0xe6, 0x1d, 0x00, 0x42, 0x49, 
+	0xfd, 0x42, 0x02, 0xa5, 0x01, 0x0d, 0x01, 0x06, 0x01, 0x0d, 0x43, 0x70, 0x38, 0x7a, 0x07, 0x03, 0x06, 0x02, 0x07, 0x01, 0x06, 0x01, 0x07, 0x47, 
+	0xb6, 0xd1, 0x3d, 0xb6, 0x88, 0x1e, 0x97, 0x39, 0x35, 0x00, 0x40, 0x89, 0x02, 0x03, 0x40, 0x8a, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x41, 0x1c, 
+	0xa4, 0x01, 0x03, 0x41, 0x09, 0xe3, 0x1a, 0x00, 0x43, 0x0e, 0xfc, 0x55, 0xd5, 0x03, 0x88, 0x41, 0x26, 0x38, 0x01, 0x26, 0x40, 0xd1, 0x02, 0x38, 
+	0x40, 0x3d, 0x01, 0x07, 0x03, 0x06, 0x40, 0x07, 0x01, 0x03, 0x42, 0x06, 0x6a, 0x06, 0x01, 0x07, 0x45, 0xd9, 0x88, 0x53, 0xca, 0xc8, 0x49, 0x35, 
+	0x00, 0x41, 0x20, 0x55, 0x01, 0x03, 0x41, 0x3d, 0xe3, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x40, 0xf8, 0x02, 0x03, 0x41, 0x09, 0x08, 0x17, 0x00, 
+	0x43, 0x1c, 0x5c, 0xc8, 0x03, 0x01, 0x06, 0x01, 0x07, 0x40, 0x03, 0x01, 0x14, 0x40, 0x06, 0x01, 0x07, 0x40, 0x03, 0x03, 0x06, 0x01, 0x03, 0x01, 
+	0x07, 0x01, 0x03, 0x01, 0x07, 0x01, 0x03, 0x40, 0x07, 0x02, 0x03, 0x40, 0x07, 0x01, 0x03, 0x41, 0x7b, 0xb3, 0x37, 0x00, 0x40, 0xdc, 0x02, 0x03, 
+	0x40, 0x8a, 0x3f, 0x00, 0x3f, 0x00, 0x25, 0x00, 0x40, 0x7c, 0x01, 0x03, 0x41, 0x05, 0xd3, 0x15, 0x00, 0x48, 0x57, 0x39, 0xba, 0x4d, 0x4e, 0x06, 
+	0x07, 0x03, 0x06, 0x01, 0x0d, 0x40, 0x06, 0x01, 0x03, 0x40, 0x07, 0x01, 0x06, 0x41, 0x14, 0x06, 0x02, 0x03, 0x02, 0x06, 0x40, 0x07, 0x01, 0x03, 
+	0x03, 0x07, 0x03, 0x03, 0x42, 0x7e, 0xc8, 0x6d, 0x38, 0x00, 0x40, 0xb0, 0x02, 0x03, 0x41, 0x09, 0x8f, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x40, 
+	0x5c, 0x02, 0x03, 0x41, 0x98, 0x77, 0x0e, 0x00, 0x46, 0x17, 0x15, 0x00, 0x20, 0x60, 0xdb, 0x8b, 0x01, 0x03, 0x03, 0x06, 0x01, 0x03, 0x01, 0x06, 
+	0x41, 0x0d, 0x06, 0x02, 0x03, 0x01, 0x06, 0x41, 0x14, 0x06, 0x02, 0x03, 0x02, 0x06, 0x40, 0x07, 0x01, 0x03, 0x40, 0x07, 0x02, 0x06, 0x01, 0x03, 
+	0x42, 0xa7, 0xb8, 0x20, 0x39, 0x00, 0x41, 0x4a, 0x55, 0x01, 0x03, 0x41, 0x05, 0xfa, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x41, 0x08, 0x7c, 0x01, 
+	0x03, 0x41, 0x0d, 0xe6, 0x0e, 0x00, 0x45, 0x57, 0x61, 0xdd, 0xa7, 0x4d, 0x06, 0x03, 0x03, 0x01, 0x06, 0x40, 0x14, 0x03, 0x03, 0x01, 0x06, 0x40, 
+	0x14, 0x03, 0x03, 0x40, 0x14, 0x01, 0x03, 0x40, 0xa4, 0x01, 0x03, 0x40, 0x14, 0x01, 0x06, 0x40, 0x07, 0x01, 0x03, 0x45, 0x07, 0x06, 0x14, 0x7c, 
+	0xa0, 0x57, 0x3b, 0x00, 0x41, 0x20, 0x42, 0x01, 0x03, 0x41, 0x06, 0x8a, 0x3f, 0x00, 0x3f, 0x00, 0x25, 0x00, 0x40, 0x89, 0x02, 0x03, 0x41, 0x09, 
+	0x77, 0x09, 0x00, 0x45, 0x20, 0x60, 0xb8, 0xc8, 0x8b, 0x4e, 0x02, 0x06, 0x01, 0x03, 0x40, 0x14, 0x01, 0x06, 0x40, 0x14, 0x02, 0x03, 0x02, 0x14, 
+	0x0f, 0x03, 0x46, 0x07, 0x03, 0xa4, 0x7e, 0xa7, 0x62, 0x57, 0x3d, 0x00, 0x41, 0x50, 0x42, 0x01, 0x03, 0x42, 0x06, 0x3d, 0x77, 0x3f, 0x00, 0x3f, 
+	0x00, 0x24, 0x00, 0x40, 0xad, 0x02, 0x03, 0x41, 0x3d, 0x85, 0x03, 0x00, 0x4b, 0x1c, 0x49, 0x6d, 0x39, 0x95, 0x7b, 0x7d, 0x4e, 0x14, 0x03, 0x7d, 
+	0x03, 0x02, 0x4e, 0x40, 0x07, 0x01, 0x03, 0x40, 0x14, 0x01, 0x0d, 0x40, 0x6a, 0x02, 0x03, 0x43, 0x06, 0x0d, 0x6a, 0x06, 0x02, 0x03, 0x42, 0x4d, 
+	0x14, 0x0d, 0x03, 0x03, 0x01, 0x4d, 0x46, 0x6a, 0xa4, 0x03, 0x7c, 0xdd, 0x61, 0x15, 0x3f, 0x00, 0x46, 0x5d, 0x03, 0x14, 0x03, 0x06, 0xa2, 0xf2, 
+	0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x41, 0x20, 0x42, 0x01, 0x03, 0x4b, 0x06, 0xca, 0x61, 0x39, 0x95, 0x42, 0x0d, 0xed, 0xc7, 0x09, 0xc6, 0x09, 
+	0x01, 0x70, 0x45, 0xed, 0xc6, 0x7a, 0x97, 0x7a, 0xc6, 0x01, 0x7a, 0x40, 0x3d, 0x01, 0xa2, 0x02, 0xca, 0x40, 0x0d, 0x01, 0x06, 0x40, 0x03, 0x02, 
+	0x0d, 0x40, 0x14, 0x02, 0x03, 0x01, 0x14, 0x40, 0x06, 0x04, 0x03, 0x43, 0xa7, 0xa1, 0x61, 0x49, 0x3f, 0x00, 0x01, 0x00, 0x47, 0x08, 0xe8, 0x38, 
+	0x06, 0x14, 0x06, 0x3d, 0xf2, 0x3f, 0x00, 0x3f, 0x00, 0x24, 0x00, 0x41, 0x77, 0x7c, 0x02, 0x03, 0x41, 0x7e, 0x03, 0x02, 0x14, 0x02, 0xc6, 0x01, 
+	0xed, 0x08, 0xb6, 0x02, 0x58, 0x04, 0xd4, 0x41, 0x5e, 0xd5, 0x01, 0x5e, 0x41, 0xd5, 0x5e, 0x02, 0x88, 0x02, 0x26, 0x02, 0xd5, 0x44, 0x97, 0x78, 
+	0xfd, 0x6e, 0x20, 0x2e, 0x00, 0x41, 0x4a, 0x6e, 0x13, 0x00, 0x47, 0x5c, 0x42, 0xca, 0xda, 0x06, 0x0c, 0xb5, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 0x24, 
+	0x00, 0x41, 0x50, 0x42, 0x05, 0x03, 0x40, 0xde, 0x01, 0x4e, 0x40, 0x14, 0x02, 0x03, 0x42, 0xde, 0x14, 0xde, 0x02, 0x03, 0x41, 0x14, 0xde, 0x01, 
+	0x4d, 0x02, 0x03, 0x43, 0x0d, 0xde, 0x4e, 0x14, 0x02, 0x03, 0x42, 0x0d, 0x4e, 0x14, 0x03, 0x03, 0x45, 0x8b, 0x7b, 0x95, 0x39, 0x6d, 0x1c, 0x34, 
+	0x00, 0x43, 0x20, 0xe8, 0xf8, 0x2f, 0x0d, 0x00, 0x42, 0x2f, 0xb0, 0x42, 0x01, 0x06, 0x43, 0x70, 0x58, 0x09, 0xb2, 0x3f, 0x00, 0x3f, 0x00, 0x25, 
+	0x00, 0x49, 0xe3, 0x97, 0x14, 0x03, 0x06, 0x7d, 0x7b, 0x7c, 0x8b, 0x7d, 0x01, 0x4d, 0x44, 0x03, 0x7d, 0x03, 0x7d, 0x03, 0x01, 0x14, 0x01, 0x03, 
+	0x44, 0x55, 0x7d, 0x14, 0x03, 0x4d, 0x02, 0x03, 0x02, 0x14, 0x4a, 0x7d, 0x55, 0x03, 0x7c, 0xba, 0xc8, 0xa0, 0x39, 0xe4, 0xaf, 0x0e, 0x3c, 0x00, 
+	0x44, 0xb0, 0x42, 0xc3, 0x5d, 0x50, 0x07, 0x00, 0x43, 0x50, 0xe5, 0x96, 0x03, 0x03, 0x06, 0x42, 0x54, 0xb5, 0x4a, 0x3f, 0x00, 0x3f, 0x00, 0x0d, 
+	0x00, 0x40, 0x08, 0x15, 0x00, 0x47, 0x2f, 0xe8, 0x53, 0x0c, 0x14, 0x06, 0x8a, 0x77, 0x01, 0x00, 0x41, 0x0e, 0x20, 0x01, 0x31, 0x04, 0x39, 0x02, 
+	0x62, 0x01, 0x89, 0x43, 0xa0, 0x95, 0xc8, 0x62, 0x01, 0xb8, 0x46, 0xb0, 0x39, 0x6e, 0x6d, 0x20, 0x0e, 0x08, 0x3f, 0x00, 0x06, 0x00, 0x41, 0x5c, 
+	0xc3, 0x01, 0x0d, 0x46, 0x7d, 0x42, 0xc4, 0xc3, 0xc4, 0x42, 0x14, 0x04, 0x0d, 0x43, 0x0c, 0x09, 0x78, 0xad, 0x3f, 0x00, 0x3f, 0x00, 0x0f, 0x00, 
+	0x42, 0x08, 0x5c, 0xe1, 0x11, 0x00, 0x48, 0x08, 0xe5, 0x55, 0x06, 0x26, 0x06, 0x05, 0x96, 0x08, 0x3f, 0x00, 0x0c, 0x00, 0x49, 0xaf, 0xb3, 0x61, 
+	0x5d, 0x85, 0x91, 0xb2, 0xfa, 0xb4, 0x96, 0x01, 0xfe, 0x40, 0xc0, 0x01, 0x78, 0x03, 0xb5, 0x04, 0x8a, 0x01, 0x3d, 0x44, 0x1e, 0xb9, 0x2d, 0xa6, 
+	0x4c, 0x02, 0x0c, 0x40, 0x05, 0x01, 0x0c, 0x01, 0x09, 0x42, 0x8a, 0xb2, 0x49, 0x3f, 0x00, 0x3f, 0x00, 0x13, 0x00, 0x43, 0x5c, 0xb4, 0x5c, 0x08, 
+	0x0c, 0x00, 0x42, 0x20, 0x62, 0x42, 0x01, 0x06, 0x43, 0xca, 0x94, 0xc5, 0xe2, 0x3f, 0x00, 0x13, 0x00, 0x42, 0x08, 0x0e, 0x15, 0x01, 0x77, 0x45, 
+	0x50, 0x8f, 0xad, 0x5c, 0xe2, 0xe3, 0x01, 0x5d, 0x41, 0x91, 0xf9, 0x01, 0xb2, 0x42, 0xfa, 0xfb, 0xd3, 0x01, 0xe6, 0x01, 0xfe, 0x40, 0xc0, 0x03, 
+	0x78, 0x44, 0xfe, 0xd3, 0xf9, 0xe2, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 0x17, 0x00, 0x46, 0x1c, 0x89, 0x7d, 0xc3, 0x85, 0xad, 0x20, 0x03, 0x00, 0x46, 
+	0x08, 0x49, 0x5c, 0x89, 0x42, 0x06, 0x0d, 0x01, 0x06, 0x43, 0x0d, 0xa2, 0xf9, 0x08, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x0b, 0x00, 
+	0x02, 0x08, 0x44, 0x2f, 0x0e, 0x49, 0x62, 0x7c, 0x01, 0x0c, 0x40, 0x0d, 0x02, 0x14, 0x41, 0x0d, 0x05, 0x04, 0x0d, 0x43, 0x05, 0xc0, 0x5d, 0x08, 
+	0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3a, 0x00, 0x54, 0x0e, 0x57, 0xb3, 0x60, 0xe5, 0x39, 0x62, 0x91, 0xfd, 0x89, 0x95, 0xb4, 0x96, 0xfe, 0x78, 
+	0xb5, 0x8a, 0x03, 0xc5, 0x97, 0x3d, 0x01, 0x09, 0x02, 0xea, 0x40, 0xc1, 0x01, 0x2d, 0x41, 0x1e, 0xa5, 0x02, 0x0c, 0x01, 0x0d, 0x44, 0xc5, 0x42, 
+	0x95, 0xe5, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x15, 0x00, 0x02, 0x08, 0x42, 0x2f, 0x1c, 0x0e, 0x01, 0x1c, 0x01, 0x20, 0x41, 
+	0x15, 0x1c, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x13, 0x00, 0x43, 0x17, 0xd0, 0x24, 0x21, 0x01, 0x11, 0x01, 
+	0x1b, 0x05, 0x11, 0x40, 0x21, 0x3f, 0x00, 0x3f, 0x00, 0x3b, 0x00, 0x43, 0x83, 0x24, 0x23, 0x0a, 0x0e, 0x00, 0x41, 0x24, 0x83, 0x06, 0x00, 0x41, 
+	0x17, 0x23, 0x01, 0x21, 0x07, 0x11, 0x40, 0x18, 0x0d, 0x00, 0x41, 0x0a, 0x0f, 0x01, 0x2b, 0x42, 0x4b, 0x32, 0x11, 0x1a, 0x00, 0x44, 0x17, 0x28, 
+	0x13, 0x0b, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x05, 0x04, 0x40, 0x25, 0x3f, 0x00, 0x3f, 0x00, 0x39, 0x00, 0x41, 0x1d, 0x04, 0x01, 0x01, 
+	0x41, 0x1f, 0x0a, 0x0c, 0x00, 0x43, 0x2a, 0x04, 0x0b, 0x15, 0x02, 0x00, 0x43, 0x08, 0x19, 0x13, 0x0b, 0x02, 0x01, 0x08, 0x04, 0x40, 0x32, 0x0c, 
+	0x00, 0x40, 0x9e, 0x04, 0x01, 0x41, 0x0b, 0x18, 0x18, 0x00, 0x41, 0x25, 0x16, 0x0f, 0x01, 0x41, 0x04, 0x24, 0x3f, 0x00, 0x3f, 0x00, 0x39, 0x00, 
+	0x40, 0x13, 0x02, 0x01, 0x41, 0x16, 0x08, 0x0c, 0x00, 0x43, 0x1f, 0x01, 0x0b, 0x08, 0x01, 0x00, 0x41, 0x08, 0x4b, 0x0e, 0x01, 0x40, 0x44, 0x0b, 
+	0x00, 0x40, 0x30, 0x06, 0x01, 0x40, 0x19, 0x17, 0x00, 0x41, 0x19, 0x04, 0x03, 0x01, 0x43, 0x93, 0x2a, 0x25, 0x37, 0x01, 0x9c, 0x02, 0x25, 0x03, 
+	0x9c, 0x40, 0x24, 0x3f, 0x00, 0x3f, 0x00, 0x39, 0x00, 0x41, 0x0a, 0x04, 0x02, 0x01, 0x40, 0x2b, 0x0c, 0x00, 0x43, 0x15, 0x04, 0x01, 0x13, 0x02, 
+	0x00, 0x40, 0x0f, 0x03, 0x01, 0x43, 0x12, 0x2a, 0x9c, 0x37, 0x06, 0xb1, 0x41, 0x1b, 0x08, 0x0a, 0x00, 0x41, 0x0a, 0x1f, 0x06, 0x01, 0x40, 0x32, 
+	0x16, 0x00, 0x41, 0x24, 0x04, 0x02, 0x01, 0x42, 0x04, 0x28, 0x08, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x06, 0x00, 0x40, 0x21, 0x03, 0x01, 0x40, 
+	0x0f, 0x0c, 0x00, 0x40, 0x11, 0x01, 0x01, 0x40, 0x32, 0x01, 0x00, 0x41, 0x17, 0x0b, 0x02, 0x01, 0x41, 0x10, 0x17, 0x16, 0x00, 0x40, 0x28, 0x07, 
+	0x01, 0x40, 0x2b, 0x16, 0x00, 0x40, 0x36, 0x03, 0x01, 0x40, 0x1d, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x08, 0x00, 0x40, 0x19, 0x03, 0x01, 0x40, 
+	0x30, 0x0c, 0x00, 0x40, 0x1d, 0x01, 0x01, 0x40, 0x19, 0x01, 0x00, 0x40, 0x86, 0x02, 0x01, 0x41, 0x0b, 0xd0, 0x16, 0x00, 0x41, 0x17, 0x0b, 0x01, 
+	0x01, 0x01, 0x0b, 0x03, 0x01, 0x40, 0x16, 0x15, 0x00, 0x41, 0x3b, 0x04, 0x02, 0x01, 0x40, 0x2b, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x09, 0x00, 
+	0x40, 0x32, 0x02, 0x01, 0x41, 0x04, 0x23, 0x0c, 0x00, 0x40, 0x34, 0x01, 0x01, 0x40, 0x21, 0x01, 0x00, 0x40, 0x36, 0x02, 0x01, 0x40, 0x34, 0x17, 
+	0x00, 0x40, 0x32, 0x01, 0x01, 0x42, 0x13, 0x83, 0x25, 0x03, 0x01, 0x41, 0x04, 0x3b, 0x14, 0x00, 0x40, 0x51, 0x03, 0x01, 0x40, 0x25, 0x14, 0x00, 
+	0x40, 0x08, 0x07, 0x1a, 0x40, 0x17, 0x05, 0x00, 0x42, 0x3b, 0x11, 0x25, 0x03, 0x90, 0x43, 0x30, 0x37, 0x23, 0x08, 0x09, 0x00, 0x41, 0x18, 0x1b, 
+	0x01, 0x25, 0x02, 0x30, 0x01, 0x25, 0x41, 0x24, 0x08, 0x06, 0x00, 0x40, 0x0a, 0x0a, 0x1a, 0x41, 0x3b, 0x08, 0x06, 0x00, 0x40, 0x0a, 0x0b, 0x1a, 
+	0x41, 0x24, 0x17, 0x09, 0x00, 0x42, 0x08, 0x0a, 0x18, 0x01, 0x1a, 0x41, 0x18, 0x3b, 0x01, 0x0a, 0x40, 0x08, 0x06, 0x00, 0x40, 0x08, 0x0a, 0x00, 
+	0x01, 0x08, 0x10, 0x00, 0x43, 0x08, 0x24, 0x37, 0x25, 0x02, 0x90, 0x43, 0x30, 0x25, 0x11, 0x0a, 0x07, 0x00, 0x40, 0x3b, 0x07, 0x1a, 0x40, 0x08, 
+	0x02, 0x00, 0x40, 0x13, 0x02, 0x01, 0x41, 0x16, 0x08, 0x0c, 0x00, 0x46, 0x22, 0x01, 0x0b, 0x1c, 0x00, 0x08, 0x16, 0x02, 0x01, 0x40, 0x1d, 0x16, 
+	0x00, 0x47, 0x23, 0x04, 0x01, 0x1f, 0x17, 0x00, 0x08, 0x22, 0x03, 0x01, 0x40, 0x11, 0x14, 0x00, 0x40, 0x32, 0x02, 0x01, 0x41, 0x04, 0x17, 0x13, 
+	0x00, 0x42, 0x18, 0x1f, 0x01, 0x06, 0x04, 0x40, 0x4b, 0x03, 0x00, 0x42, 0x25, 0x13, 0x04, 0x07, 0x01, 0x42, 0x04, 0x1f, 0x3c, 0x06, 0x00, 0x42, 
+	0x30, 0x13, 0x04, 0x08, 0x01, 0x41, 0x1f, 0xf4, 0x04, 0x00, 0x41, 0x25, 0x0b, 0x0b, 0x04, 0x42, 0x12, 0x32, 0x17, 0x03, 0x00, 0x41, 0xd0, 0x12, 
+	0x08, 0x04, 0x01, 0x01, 0x02, 0x04, 0x40, 0x33, 0x05, 0x00, 0x44, 0x8e, 0x1d, 0x36, 0x12, 0x04, 0x04, 0x01, 0x01, 0x04, 0x42, 0x0b, 0x10, 0x19, 
+	0x02, 0x00, 0x44, 0x3c, 0x22, 0x12, 0x35, 0x0a, 0x06, 0x00, 0x41, 0x19, 0x13, 0x01, 0x12, 0x41, 0x1f, 0x28, 0x07, 0x00, 0x42, 0x0f, 0x36, 0x08, 
+	0x01, 0x00, 0x43, 0x83, 0x33, 0x0b, 0x04, 0x07, 0x01, 0x42, 0x0b, 0x34, 0x17, 0x04, 0x00, 0x40, 0x87, 0x08, 0x04, 0x40, 0x2b, 0x01, 0x00, 0x41, 
+	0x0a, 0x0b, 0x02, 0x01, 0x40, 0x2b, 0x0c, 0x00, 0x43, 0x17, 0x04, 0x01, 0x13, 0x01, 0x00, 0x41, 0x18, 0x04, 0x02, 0x01, 0x40, 0x2a, 0x16, 0x00, 
+	0x40, 0x35, 0x01, 0x01, 0x40, 0x25, 0x02, 0x00, 0x40, 0x0f, 0x03, 0x01, 0x40, 0x19, 0x14, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0x93, 0x14, 0x00, 
+	0x40, 0x32, 0x06, 0x01, 0x42, 0x04, 0x16, 0x1d, 0x02, 0x00, 0x40, 0x0f, 0x03, 0x01, 0x05, 0x04, 0x03, 0x01, 0x40, 0x19, 0x04, 0x00, 0x40, 0x9d, 
+	0x03, 0x01, 0x05, 0x04, 0x02, 0x01, 0x41, 0x04, 0x30, 0x03, 0x00, 0x40, 0xd8, 0x05, 0x01, 0x42, 0x04, 0x0b, 0x04, 0x05, 0x01, 0x41, 0x1f, 0x8e, 
+	0x02, 0x00, 0x40, 0x2a, 0x06, 0x01, 0x02, 0x04, 0x05, 0x01, 0x40, 0x3c, 0x03, 0x00, 0x41, 0x24, 0x12, 0x04, 0x01, 0x02, 0x04, 0x05, 0x01, 0x40, 
+	0x28, 0x01, 0x00, 0x40, 0x12, 0x02, 0x01, 0x40, 0x1b, 0x05, 0x00, 0x41, 0x1b, 0x04, 0x03, 0x01, 0x40, 0x16, 0x06, 0x00, 0x42, 0x51, 0x01, 0x22, 
+	0x01, 0x00, 0x41, 0xbe, 0x12, 0x03, 0x01, 0x04, 0x04, 0x03, 0x01, 0x40, 0x10, 0x03, 0x00, 0x40, 0x11, 0x06, 0x01, 0x43, 0x04, 0x0b, 0x12, 0x44, 
+	0x01, 0x00, 0x40, 0x21, 0x03, 0x01, 0x40, 0x44, 0x0c, 0x00, 0x40, 0x11, 0x01, 0x01, 0x40, 0x33, 0x01, 0x00, 0x40, 0x21, 0x03, 0x01, 0x40, 0x10, 
+	0x15, 0x00, 0x43, 0x11, 0x04, 0x01, 0x36, 0x03, 0x00, 0x40, 0x1b, 0x03, 0x01, 0x40, 0x44, 0x13, 0x00, 0x41, 0x08, 0x0b, 0x02, 0x01, 0x40, 0x34, 
+	0x14, 0x00, 0x40, 0x13, 0x04, 0x01, 0x43, 0x2b, 0x1b, 0x17, 0x08, 0x02, 0x00, 0x40, 0xf4, 0x02, 0x01, 0x43, 0x2b, 0x1b, 0x3b, 0x8e, 0x02, 0x0a, 
+	0x42, 0x18, 0x1d, 0x04, 0x01, 0x01, 0x40, 0x1f, 0x03, 0x00, 0x40, 0x3c, 0x02, 0x01, 0x42, 0x10, 0x37, 0x17, 0x01, 0x0a, 0x44, 0x17, 0x8e, 0x18, 
+	0x28, 0x04, 0x01, 0x01, 0x40, 0x93, 0x02, 0x00, 0x41, 0x1c, 0x04, 0x03, 0x01, 0x42, 0x0b, 0x0f, 0x24, 0x01, 0x0a, 0x42, 0x1b, 0x33, 0x04, 0x03, 
+	0x01, 0x40, 0x28, 0x02, 0x00, 0x40, 0x36, 0x03, 0x01, 0x48, 0x16, 0x2a, 0x11, 0x18, 0x17, 0x18, 0x11, 0x0f, 0x04, 0x02, 0x01, 0x40, 0x2b, 0x02, 
+	0x00, 0x41, 0x0a, 0x1f, 0x02, 0x01, 0x47, 0x16, 0x1d, 0x24, 0x8e, 0x0a, 0x3b, 0x1b, 0x87, 0x03, 0x01, 0x40, 0x13, 0x01, 0x00, 0x40, 0x12, 0x02, 
+	0x01, 0x40, 0x37, 0x05, 0x00, 0x40, 0x4b, 0x04, 0x01, 0x41, 0x04, 0x1c, 0x05, 0x00, 0x45, 0x10, 0x01, 0x86, 0x00, 0x17, 0x12, 0x01, 0x01, 0x43, 
+	0x04, 0x2a, 0x23, 0x17, 0x02, 0x0a, 0x42, 0x17, 0x21, 0x10, 0x02, 0x01, 0x40, 0x37, 0x02, 0x00, 0x40, 0x1d, 0x04, 0x01, 0x44, 0x16, 0x19, 0x3b, 
+	0x0a, 0x08, 0x02, 0x00, 0x40, 0x19, 0x03, 0x01, 0x40, 0xf4, 0x0c, 0x00, 0x40, 0x3c, 0x01, 0x01, 0x40, 0x19, 0x01, 0x00, 0x40, 0xf6, 0x04, 0x01, 
+	0x41, 0x2a, 0x08, 0x13, 0x00, 0x43, 0x2b, 0x01, 0x04, 0x21, 0x03, 0x00, 0x41, 0x0a, 0x04, 0x02, 0x01, 0x40, 0x36, 0x13, 0x00, 0x40, 0x24, 0x03, 
+	0x01, 0x40, 0x86, 0x13, 0x00, 0x41, 0x08, 0x0b, 0x03, 0x01, 0x41, 0x87, 0x08, 0x04, 0x00, 0x41, 0x0a, 0x12, 0x01, 0x01, 0x41, 0x1f, 0x0a, 0x07, 
+	0x00, 0x40, 0x10, 0x01, 0x01, 0x41, 0x04, 0x23, 0x01, 0x00, 0x41, 0x83, 0x16, 0x01, 0x01, 0x41, 0x13, 0x0a, 0x07, 0x00, 0x40, 0x22, 0x01, 0x01, 
+	0x41, 0x04, 0x3b, 0x01, 0x00, 0x40, 0x11, 0x03, 0x01, 0x41, 0x12, 0xbe, 0x05, 0x00, 0x41, 0x30, 0x04, 0x02, 0x01, 0x40, 0x35, 0x01, 0x00, 0x41, 
+	0x08, 0x12, 0x02, 0x01, 0x41, 0x16, 0x23, 0x06, 0x00, 0x40, 0x0f, 0x02, 0x01, 0x40, 0x12, 0x02, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x41, 0x12, 0x18, 
+	0x06, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0xd8, 0x01, 0x00, 0x40, 0x1f, 0x02, 0x01, 0x40, 0x37, 0x04, 0x00, 0x41, 0x18, 0x04, 0x04, 0x01, 0x41, 
+	0x04, 0x3b, 0x04, 0x00, 0x45, 0x24, 0x04, 0x0b, 0x17, 0x00, 0x33, 0x02, 0x01, 0x40, 0x86, 0x07, 0x00, 0x40, 0x1b, 0x02, 0x01, 0x40, 0x0f, 0x02, 
+	0x00, 0x40, 0x34, 0x03, 0x01, 0x41, 0x12, 0x23, 0x06, 0x00, 0x40, 0x33, 0x03, 0x01, 0x40, 0x24, 0x0c, 0x00, 0x40, 0x33, 0x01, 0x01, 0x40, 0x21, 
+	0x01, 0x00, 0x40, 0x24, 0x05, 0x01, 0x41, 0x1f, 0x34, 0x05, 0x44, 0x42, 0x2a, 0x25, 0x08, 0x08, 0x00, 0x40, 0x25, 0x01, 0x01, 0x40, 0x4b, 0x05, 
+	0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x1f, 0x13, 0x00, 0x40, 0x51, 0x03, 0x01, 0x40, 0x11, 0x04, 0x00, 0x41, 0xbe, 0x2a, 0x08, 0x0f, 0x40, 0x37, 
+	0x02, 0x00, 0x40, 0x24, 0x03, 0x01, 0x41, 0x10, 0x08, 0x05, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x1d, 0x08, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 
+	0x37, 0x01, 0x00, 0x40, 0x28, 0x02, 0x01, 0x40, 0x19, 0x08, 0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x11, 0x01, 0x00, 0x40, 0x3c, 0x02, 0x01, 0x41, 
+	0x04, 0x1b, 0x07, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x35, 0x01, 0x00, 0x41, 0x18, 0x04, 0x02, 0x01, 0x40, 0x51, 0x07, 0x00, 0x40, 0x1b, 0x02, 
+	0x01, 0x41, 0x16, 0x08, 0x01, 0x00, 0x40, 0x1f, 0x02, 0x01, 0x40, 0x30, 0x07, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x40, 0x2b, 0x01, 0x00, 0x40, 0xd8, 
+	0x02, 0x01, 0x40, 0x37, 0x04, 0x00, 0x40, 0x9d, 0x05, 0x01, 0x41, 0x04, 0x1a, 0x04, 0x00, 0x45, 0x44, 0x01, 0x32, 0x00, 0x83, 0x0b, 0x01, 0x01, 
+	0x41, 0x16, 0x08, 0x07, 0x00, 0x40, 0x11, 0x02, 0x01, 0x40, 0x4b, 0x02, 0x00, 0x40, 0x1f, 0x02, 0x01, 0x41, 0x0b, 0x24, 0x07, 0x00, 0x40, 0x13, 
+	0x02, 0x01, 0x41, 0x0b, 0x08, 0x0c, 0x00, 0x43, 0x22, 0x01, 0x0b, 0x0a, 0x01, 0x00, 0x41, 0x0a, 0x0b, 0x0e, 0x01, 0x41, 0x13, 0x8e, 0x06, 0x00, 
+	0x44, 0x08, 0x13, 0x01, 0x04, 0x21, 0x05, 0x00, 0x40, 0x35, 0x02, 0x01, 0x41, 0x04, 0x8e, 0x12, 0x00, 0x40, 0x44, 0x02, 0x01, 0x41, 0x04, 0x1c, 
+	0x03, 0x00, 0x41, 0x08, 0x12, 0x09, 0x01, 0x40, 0x22, 0x02, 0x00, 0x40, 0x19, 0x02, 0x01, 0x41, 0x04, 0x21, 0x06, 0x00, 0x40, 0x13, 0x02, 0x01, 
+	0x40, 0x1b, 0x07, 0x00, 0x41, 0x08, 0x0b, 0x02, 0x01, 0x40, 0x25, 0x01, 0x00, 0x40, 0x1f, 0x02, 0x01, 0x40, 0x11, 0x07, 0x00, 0x41, 0x17, 0x0b, 
+	0x02, 0x01, 0x40, 0x1b, 0x01, 0x00, 0x40, 0x33, 0x02, 0x01, 0x40, 0x2b, 0x08, 0x00, 0x40, 0x4b, 0x02, 0x01, 0x40, 0x44, 0x01, 0x00, 0x40, 0x25, 
+	0x02, 0x01, 0x41, 0x0b, 0x0a, 0x07, 0x00, 0x40, 0x1b, 0x02, 0x01, 0x40, 0x12, 0x01, 0x00, 0x41, 0x21, 0x04, 0x01, 0x01, 0x41, 0x12, 0x08, 0x07, 
+	0x00, 0x40, 0x2a, 0x02, 0x01, 0x40, 0x79, 0x01, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0xb1, 0x03, 0x00, 0x44, 0x0a, 0x16, 0x01, 0x16, 0x22, 0x03, 
+	0x01, 0x40, 0x21, 0x03, 0x00, 0x45, 0x08, 0x16, 0x04, 0x24, 0x00, 0x19, 0x02, 0x01, 0x40, 0x10, 0x08, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x4b, 
+	0x01, 0x00, 0x41, 0x15, 0x04, 0x02, 0x01, 0x40, 0x0f, 0x07, 0x00, 0x41, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x10, 0x0c, 0x00, 0x43, 0x17, 0x0b, 0x01, 
+	0x13, 0x03, 0x00, 0x40, 0x0f, 0x0f, 0x01, 0x40, 0x32, 0x06, 0x00, 0x40, 0x19, 0x01, 0x01, 0x40, 0x9e, 0x06, 0x00, 0x40, 0x0f, 0x03, 0x01, 0x40, 
+	0x21, 0x12, 0x00, 0x40, 0x2b, 0x02, 0x01, 0x40, 0x22, 0x05, 0x00, 0x40, 0x4b, 0x03, 0x22, 0x41, 0x12, 0x04, 0x03, 0x01, 0x40, 0x10, 0x02, 0x00, 
+	0x40, 0x32, 0x02, 0x01, 0x40, 0x13, 0x06, 0x00, 0x41, 0x23, 0x04, 0x02, 0x01, 0x40, 0x37, 0x07, 0x00, 0x40, 0x3c, 0x03, 0x01, 0x43, 0x11, 0x00, 
+	0x21, 0x04, 0x02, 0x01, 0x40, 0x11, 0x07, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x41, 0x04, 0xbe, 0x01, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x28, 0x08, 
+	0x00, 0x40, 0x1f, 0x02, 0x01, 0x40, 0x19, 0x01, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x40, 0x2b, 0x08, 0x00, 0x40, 0x19, 0x02, 0x01, 0x40, 0x13, 0x01, 
+	0x00, 0x40, 0x86, 0x02, 0x01, 0x40, 0x34, 0x08, 0x00, 0x40, 0xe9, 0x02, 0x01, 0x40, 0x2a, 0x01, 0x00, 0x40, 0x36, 0x02, 0x01, 0x40, 0x11, 0x03, 
+	0x00, 0x45, 0x19, 0x01, 0x16, 0xbe, 0x0a, 0x12, 0x02, 0x01, 0x40, 0x1b, 0x03, 0x00, 0x42, 0x30, 0x01, 0x2b, 0x01, 0x00, 0x40, 0x35, 0x02, 0x01, 
+	0x40, 0x13, 0x07, 0x00, 0x41, 0x0a, 0x93, 0x02, 0x01, 0x40, 0x33, 0x01, 0x00, 0x40, 0x11, 0x02, 0x01, 0x41, 0x04, 0x18, 0x07, 0x00, 0x40, 0x21, 
+	0x03, 0x01, 0x40, 0x32, 0x0c, 0x00, 0x40, 0x11, 0x01, 0x01, 0x40, 0x33, 0x03, 0x00, 0x43, 0x08, 0x9d, 0x0b, 0x04, 0x0c, 0x01, 0x40, 0x1f, 0x05, 
+	0x00, 0x44, 0x0a, 0x1f, 0x01, 0x04, 0x21, 0x06, 0x00, 0x40, 0x1d, 0x03, 0x01, 0x40, 0x51, 0x11, 0x00, 0x41, 0x08, 0x16, 0x02, 0x01, 0x40, 0x34, 
+	0x0b, 0x00, 0x41, 0x24, 0x16, 0x02, 0x01, 0x40, 0x32, 0x02, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0x0f, 0x06, 0x00, 0x40, 0x3c, 0x03, 0x01, 0x41, 
+	0x2b, 0x18, 0x04, 0x00, 0x42, 0x15, 0x3c, 0x04, 0x02, 0x01, 0x43, 0x04, 0x17, 0x00, 0x28, 0x03, 0x01, 0x42, 0x87, 0x3b, 0x08, 0x02, 0x00, 0x43, 
+	0x08, 0x15, 0x19, 0x04, 0x02, 0x01, 0x44, 0x0b, 0x0a, 0x00, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x1b, 0x07, 0x00, 0x41, 0x15, 0x04, 0x02, 0x01, 0x40, 
+	0x21, 0x01, 0x00, 0x40, 0x4b, 0x02, 0x01, 0x40, 0x0f, 0x08, 0x00, 0x40, 0x32, 0x02, 0x01, 0x40, 0x35, 0x01, 0x00, 0x40, 0x35, 0x02, 0x01, 0x40, 
+	0x3c, 0x08, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0x30, 0x01, 0x00, 0x40, 0x9e, 0x02, 0x01, 0x40, 0x37, 0x03, 0x00, 0x42, 0x93, 0x01, 0x30, 0x01, 
+	0x00, 0x40, 0x32, 0x02, 0x01, 0x40, 0x9c, 0x03, 0x00, 0x45, 0x36, 0x01, 0x30, 0x00, 0x08, 0x16, 0x02, 0x01, 0x42, 0x04, 0x51, 0x0a, 0x04, 0x00, 
+	0x41, 0x24, 0x36, 0x03, 0x01, 0x40, 0x1d, 0x01, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x1f, 0x08, 0x00, 0x40, 0x19, 0x03, 0x01, 0x40, 0x19, 0x0c, 
+	0x00, 0x40, 0x3c, 0x01, 0x01, 0x40, 0x3c, 0x05, 0x00, 0x42, 0x0a, 0x24, 0x1b, 0x03, 0xf6, 0x43, 0x1b, 0x9c, 0x9d, 0x0b, 0x03, 0x01, 0x41, 0x0b, 
+	0x08, 0x04, 0x00, 0x40, 0x28, 0x01, 0x01, 0x40, 0x22, 0x07, 0x00, 0x40, 0x0f, 0x03, 0x01, 0x40, 0x0f, 0x11, 0x00, 0x41, 0x23, 0x04, 0x02, 0x01, 
+	0x40, 0x1d, 0x0c, 0x00, 0x40, 0x35, 0x02, 0x01, 0x40, 0x19, 0x01, 0x00, 0x41, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x30, 0x06, 0x00, 0x40, 0x35, 0x04, 
+	0x01, 0x42, 0x04, 0x16, 0x1f, 0x01, 0x22, 0x41, 0x12, 0x0b, 0x04, 0x01, 0x40, 0x36, 0x01, 0x00, 0x40, 0x36, 0x04, 0x01, 0x41, 0x04, 0x0b, 0x02, 
+	0x16, 0x41, 0x0b, 0x04, 0x04, 0x01, 0x40, 0x35, 0x01, 0x00, 0x40, 0x21, 0x02, 0x01, 0x41, 0x04, 0x15, 0x07, 0x00, 0x40, 0x1b, 0x02, 0x01, 0x41, 
+	0x0b, 0x0a, 0x01, 0x00, 0x40, 0x12, 0x02, 0x01, 0x40, 0x25, 0x08, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0x28, 0x01, 0x00, 0x40, 0x12, 0x02, 0x01, 
+	0x40, 0x11, 0x07, 0x00, 0x41, 0x08, 0x16, 0x01, 0x01, 0x41, 0x04, 0x23, 0x01, 0x00, 0x40, 0x34, 0x02, 0x01, 0x40, 0x25, 0x02, 0x00, 0x42, 0x1b, 
+	0x01, 0x10, 0x02, 0x00, 0x40, 0x19, 0x02, 0x01, 0x40, 0x51, 0x02, 0x00, 0x45, 0x23, 0x04, 0x12, 0x08, 0x00, 0x21, 0x05, 0x01, 0x46, 0x0b, 0x12, 
+	0x22, 0x1f, 0x12, 0x16, 0x04, 0x03, 0x01, 0x41, 0x04, 0x23, 0x01, 0x00, 0x40, 0x34, 0x02, 0x01, 0x40, 0x35, 0x08, 0x00, 0x40, 0x33, 0x02, 0x01, 
+	0x41, 0x04, 0x24, 0x0c, 0x00, 0x40, 0x33, 0x01, 0x01, 0x40, 0x21, 0x0f, 0x00, 0x41, 0x25, 0x04, 0x02, 0x01, 0x41, 0x0b, 0x08, 0x03, 0x00, 0x41, 
+	0x17, 0x16, 0x01, 0x01, 0x40, 0x22, 0x06, 0x00, 0x41, 0x83, 0x12, 0x03, 0x01, 0x40, 0x35, 0x11, 0x00, 0x40, 0x90, 0x03, 0x01, 0x40, 0x1b, 0x0c, 
+	0x00, 0x40, 0x35, 0x01, 0x01, 0x41, 0x04, 0x24, 0x01, 0x00, 0x41, 0x24, 0x04, 0x01, 0x01, 0x41, 0x04, 0x23, 0x06, 0x00, 0x40, 0x1f, 0x03, 0x01, 
+	0x41, 0x04, 0x22, 0x09, 0x10, 0x41, 0x4b, 0x23, 0x01, 0x00, 0x40, 0x16, 0x03, 0x01, 0x41, 0x04, 0x22, 0x09, 0x10, 0x41, 0x4b, 0xd0, 0x01, 0x00, 
+	0x40, 0x3c, 0x02, 0x01, 0x40, 0x1f, 0x08, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x13, 0x01, 0x00, 0x41, 0x3b, 0x04, 0x01, 0x01, 0x41, 0x04, 0x18, 
+	0x07, 0x00, 0x41, 0x08, 0x16, 0x02, 0x01, 0x43, 0x1b, 0x00, 0x3b, 0x04, 0x01, 0x01, 0x41, 0x04, 0x0a, 0x07, 0x00, 0x41, 0x23, 0x04, 0x01, 0x01, 
+	0x41, 0x16, 0x08, 0x01, 0x00, 0x40, 0xe9, 0x02, 0x01, 0x40, 0x19, 0x02, 0x00, 0x42, 0x4b, 0x01, 0x25, 0x02, 0x00, 0x40, 0x25, 0x02, 0x01, 0x40, 
+	0x3c, 0x02, 0x00, 0x42, 0x0f, 0x01, 0x2a, 0x01, 0x00, 0x40, 0x86, 0x04, 0x01, 0x40, 0x16, 0x01, 0x10, 0x01, 0x13, 0x06, 0x10, 0x40, 0x19, 0x02, 
+	0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x28, 0x08, 0x00, 0x40, 0x13, 0x02, 0x01, 0x41, 0x0b, 0x0a, 0x0c, 0x00, 0x43, 0x13, 0x01, 0x04, 0x0a, 0x10, 
+	0x00, 0x40, 0x13, 0x02, 0x01, 0x41, 0x16, 0x08, 0x03, 0x00, 0x40, 0x44, 0x03, 0x01, 0x47, 0x34, 0x37, 0x21, 0x11, 0x21, 0x1b, 0x1d, 0x1f, 0x04, 
+	0x01, 0x40, 0x22, 0x11, 0x00, 0x40, 0x9d, 0x02, 0x01, 0x41, 0x04, 0x3b, 0x0c, 0x00, 0x40, 0x10, 0x01, 0x01, 0x41, 0x12, 0x08, 0x01, 0x00, 0x40, 
+	0x51, 0x02, 0x01, 0x41, 0x16, 0x08, 0x05, 0x00, 0x41, 0x3b, 0x04, 0x02, 0x01, 0x41, 0x16, 0x11, 0x0d, 0x00, 0x41, 0x18, 0x04, 0x02, 0x01, 0x41, 
+	0x12, 0x11, 0x0e, 0x00, 0x40, 0x33, 0x02, 0x01, 0x40, 0x34, 0x08, 0x00, 0x40, 0x34, 0x02, 0x01, 0x40, 0x33, 0x01, 0x00, 0x40, 0x37, 0x02, 0x01, 
+	0x41, 0x12, 0x08, 0x07, 0x00, 0x41, 0x1a, 0x04, 0x01, 0x01, 0x43, 0x0b, 0x0a, 0x00, 0x25, 0x02, 0x01, 0x40, 0x13, 0x08, 0x00, 0x40, 0x30, 0x02, 
+	0x01, 0x40, 0x36, 0x02, 0x00, 0x40, 0xe9, 0x02, 0x01, 0x40, 0x28, 0x01, 0x00, 0x43, 0xbe, 0x04, 0x93, 0x08, 0x02, 0x00, 0x40, 0x11, 0x02, 0x01, 
+	0x40, 0x2a, 0x01, 0x00, 0x43, 0x17, 0x16, 0x04, 0x3b, 0x01, 0x00, 0x40, 0x79, 0x03, 0x01, 0x41, 0x0f, 0x08, 0x0d, 0x00, 0x41, 0x17, 0x04, 0x02, 
+	0x01, 0x40, 0x37, 0x07, 0x00, 0x41, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x13, 0x0c, 0x00, 0x43, 0x08, 0x0b, 0x01, 0x22, 0x11, 0x00, 0x40, 0x4b, 0x02, 
+	0x01, 0x40, 0x13, 0x03, 0x00, 0x41, 0x18, 0x04, 0x10, 0x01, 0x41, 0x0b, 0x1c, 0x10, 0x00, 0x40, 0x2b, 0x02, 0x01, 0x40, 0x12, 0x0c, 0x00, 0x41, 
+	0x1c, 0x0b, 0x01, 0x01, 0x40, 0x34, 0x02, 0x00, 0x40, 0x44, 0x02, 0x01, 0x40, 0x36, 0x06, 0x00, 0x40, 0x1b, 0x02, 0x01, 0x41, 0x04, 0x25, 0x0e, 
+	0x00, 0x40, 0x37, 0x02, 0x01, 0x41, 0x04, 0x1b, 0x0f, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x1d, 0x08, 0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x19, 
+	0x01, 0x00, 0x40, 0x28, 0x02, 0x01, 0x40, 0x36, 0x08, 0x00, 0x40, 0x30, 0x02, 0x01, 0x40, 0x36, 0x01, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x40, 0x34, 
+	0x08, 0x00, 0x40, 0x0f, 0x02, 0x01, 0x40, 0x28, 0x02, 0x00, 0x40, 0x44, 0x02, 0x01, 0x40, 0x34, 0x01, 0x00, 0x42, 0x35, 0x01, 0x86, 0x03, 0x00, 
+	0x40, 0x24, 0x02, 0x01, 0x40, 0x4b, 0x01, 0x00, 0x42, 0x9e, 0x01, 0x35, 0x02, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x4b, 0x0f, 0x00, 0x40, 0x11, 
+	0x02, 0x01, 0x41, 0x04, 0x3b, 0x07, 0x00, 0x40, 0x21, 0x03, 0x01, 0x40, 0x33, 0x0c, 0x00, 0x40, 0x21, 0x01, 0x01, 0x40, 0x33, 0x11, 0x00, 0x40, 
+	0x2b, 0x02, 0x01, 0x40, 0x79, 0x03, 0x00, 0x40, 0x34, 0x03, 0x01, 0x08, 0x04, 0x04, 0x01, 0x41, 0x04, 0x23, 0x10, 0x00, 0x40, 0x12, 0x02, 0x01, 
+	0x40, 0x22, 0x0c, 0x00, 0x40, 0x19, 0x02, 0x01, 0x40, 0x37, 0x02, 0x00, 0x40, 0x2b, 0x02, 0x01, 0x40, 0x0f, 0x06, 0x00, 0x40, 0x19, 0x02, 0x01, 
+	0x40, 0x13, 0x0f, 0x00, 0x40, 0x19, 0x02, 0x01, 0x40, 0x10, 0x0f, 0x00, 0x41, 0x0a, 0x0b, 0x02, 0x01, 0x40, 0x1b, 0x07, 0x00, 0x41, 0x0a, 0x04, 
+	0x02, 0x01, 0x40, 0x21, 0x01, 0x00, 0x40, 0x35, 0x02, 0x01, 0x40, 0x0f, 0x08, 0x00, 0x40, 0x9d, 0x02, 0x01, 0x40, 0x19, 0x01, 0x00, 0x40, 0x9e, 
+	0x02, 0x01, 0x40, 0x28, 0x08, 0x00, 0x40, 0x2b, 0x02, 0x01, 0x40, 0x1b, 0x02, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x45, 0x04, 0x51, 0x33, 0x01, 0x0b, 
+	0x17, 0x03, 0x00, 0x40, 0xf3, 0x02, 0x01, 0x42, 0x04, 0x0f, 0x4b, 0x01, 0x01, 0x40, 0x1b, 0x02, 0x00, 0x40, 0x0b, 0x02, 0x01, 0x40, 0x11, 0x0f, 
+	0x00, 0x40, 0x3c, 0x02, 0x01, 0x40, 0x12, 0x08, 0x00, 0x40, 0x19, 0x03, 0x01, 0x40, 0x1d, 0x0c, 0x00, 0x40, 0x1d, 0x01, 0x01, 0x40, 0x1d, 0x10, 
+	0x00, 0x41, 0x08, 0x12, 0x02, 0x01, 0x40, 0x19, 0x02, 0x00, 0x45, 0x21, 0x04, 0x01, 0x04, 0x33, 0x24, 0x07, 0x17, 0x42, 0x83, 0x19, 0x0b, 0x03, 
+	0x01, 0x40, 0x25, 0x10, 0x00, 0x40, 0x16, 0x02, 0x01, 0x41, 0x16, 0x0a, 0x0a, 0x00, 0x41, 0x0a, 0x1f, 0x01, 0x01, 0x41, 0x12, 0x08, 0x01, 0x00, 
+	0x41, 0x08, 0x16, 0x02, 0x01, 0x40, 0x30, 0x06, 0x00, 0x40, 0x28, 0x02, 0x01, 0x40, 0x32, 0x0f, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x40, 0x0f, 0x0f, 
+	0x00, 0x40, 0x21, 0x02, 0x01, 0x41, 0x04, 0x15, 0x07, 0x00, 0x40, 0x11, 0x02, 0x01, 0x41, 0x04, 0x0a, 0x01, 0x00, 0x40, 0x12, 0x02, 0x01, 0x40, 
+	0x3c, 0x08, 0x00, 0x40, 0x93, 0x01, 0x01, 0x41, 0x04, 0x3b, 0x01, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0xf4, 0x07, 0x00, 0x41, 0x17, 0x04, 0x01, 
+	0x01, 0x41, 0x0b, 0x0a, 0x02, 0x00, 0x40, 0x28, 0x06, 0x01, 0x40, 0x32, 0x04, 0x00, 0x40, 0xf3, 0x06, 0x01, 0x40, 0x93, 0x02, 0x00, 0x41, 0x15, 
+	0x04, 0x01, 0x01, 0x41, 0x0b, 0x08, 0x0f, 0x00, 0x40, 0x33, 0x02, 0x01, 0x40, 0x4b, 0x08, 0x00, 0x40, 0x44, 0x03, 0x01, 0x40, 0x1d, 0x0b, 0x00, 
+	0x44, 0x08, 0x22, 0x01, 0x04, 0x21, 0x10, 0x00, 0x40, 0x1b, 0x02, 0x01, 0x41, 0x04, 0x3b, 0x02, 0x00, 0x40, 0x36, 0x01, 0x01, 0x40, 0x2a, 0x0b, 
+	0x00, 0x40, 0x28, 0x03, 0x01, 0x40, 0x28, 0x10, 0x00, 0x40, 0x2b, 0x03, 0x01, 0x40, 0x2a, 0x09, 0x00, 0x41, 0x08, 0x87, 0x02, 0x01, 0x40, 0x28, 
+	0x02, 0x00, 0x41, 0x23, 0x04, 0x01, 0x01, 0x41, 0x04, 0x23, 0x06, 0x00, 0x40, 0x28, 0x02, 0x01, 0x40, 0x0f, 0x0f, 0x00, 0x40, 0x0f, 0x02, 0x01, 
+	0x40, 0x28, 0x0f, 0x00, 0x40, 0x19, 0x02, 0x01, 0x40, 0x1f, 0x08, 0x00, 0x40, 0x3c, 0x02, 0x01, 0x40, 0x13, 0x01, 0x00, 0x41, 0x15, 0x04, 0x02, 
+	0x01, 0x40, 0x1d, 0x07, 0x00, 0x41, 0x1b, 0x04, 0x01, 0x01, 0x40, 0x9e, 0x02, 0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x19, 0x07, 0x00, 0x40, 0x1d, 
+	0x02, 0x01, 0x40, 0x36, 0x03, 0x00, 0x40, 0x3c, 0x05, 0x01, 0x41, 0x04, 0x24, 0x04, 0x00, 0x40, 0xf3, 0x06, 0x01, 0x40, 0x86, 0x02, 0x00, 0x41, 
+	0x3b, 0x04, 0x01, 0x01, 0x40, 0x16, 0x10, 0x00, 0x40, 0x93, 0x02, 0x01, 0x40, 0x2a, 0x08, 0x00, 0x40, 0x32, 0x03, 0x01, 0x41, 0x13, 0x08, 0x09, 
+	0x00, 0x41, 0x08, 0x33, 0x01, 0x01, 0x40, 0x13, 0x10, 0x00, 0x41, 0xd0, 0x1f, 0x02, 0x01, 0x40, 0x87, 0x02, 0x00, 0x43, 0x37, 0x04, 0x01, 0x2b, 
+	0x0c, 0x00, 0x41, 0x24, 0x04, 0x02, 0x01, 0x40, 0x34, 0x10, 0x00, 0x40, 0x19, 0x04, 0x01, 0x43, 0x35, 0x11, 0x0a, 0x08, 0x01, 0x00, 0x44, 0x08, 
+	0x0a, 0x24, 0x19, 0x13, 0x02, 0x01, 0x41, 0x1f, 0x0a, 0x02, 0x00, 0x40, 0x90, 0x02, 0x01, 0x41, 0x16, 0x08, 0x06, 0x00, 0x40, 0x19, 0x02, 0x01, 
+	0x40, 0x36, 0x0f, 0x00, 0x40, 0x86, 0x02, 0x01, 0x40, 0x35, 0x0f, 0x00, 0x40, 0x33, 0x02, 0x01, 0x40, 0x79, 0x08, 0x00, 0x40, 0x33, 0x02, 0x01, 
+	0x40, 0x33, 0x01, 0x00, 0x40, 0x1b, 0x03, 0x01, 0x41, 0x2b, 0x08, 0x05, 0x00, 0x41, 0xd0, 0x1f, 0x01, 0x01, 0x41, 0x0b, 0xbe, 0x02, 0x00, 0x40, 
+	0x93, 0x02, 0x01, 0x40, 0x9e, 0x06, 0x00, 0x41, 0x37, 0x0b, 0x02, 0x01, 0x40, 0x37, 0x03, 0x00, 0x40, 0x19, 0x05, 0x01, 0x40, 0x10, 0x05, 0x00, 
+	0x40, 0xf3, 0x05, 0x01, 0x41, 0x0b, 0x17, 0x02, 0x00, 0x41, 0x0a, 0x04, 0x01, 0x01, 0x41, 0x04, 0x18, 0x0e, 0x00, 0x41, 0x1c, 0x0b, 0x02, 0x01, 
+	0x40, 0x37, 0x08, 0x00, 0x40, 0x51, 0x04, 0x01, 0x42, 0x10, 0x25, 0x0a, 0x04, 0x00, 0x43, 0x08, 0x3b, 0x30, 0x13, 0x01, 0x01, 0x41, 0x04, 0x1b, 
+	0x03, 0x00, 0x0a, 0x08, 0x42, 0x23, 0x86, 0x16, 0x02, 0x01, 0x41, 0x04, 0x24, 0x02, 0x00, 0x43, 0x10, 0x01, 0x04, 0x24, 0x0c, 0x00, 0x41, 0x0a, 
+	0x16, 0x02, 0x01, 0x40, 0x13, 0x10, 0x00, 0x41, 0x08, 0x2b, 0x05, 0x01, 0x41, 0x04, 0x16, 0x01, 0x12, 0x40, 0x16, 0x01, 0x04, 0x03, 0x01, 0x41, 
+	0x0b, 0x11, 0x03, 0x00, 0x40, 0x0f, 0x02, 0x01, 0x40, 0x10, 0x07, 0x00, 0x41, 0x18, 0x0b, 0x02, 0x01, 0x41, 0x32, 0x1b, 0x01, 0x23, 0x06, 0x18, 
+	0x04, 0x00, 0x41, 0x23, 0x04, 0x01, 0x01, 0x42, 0x04, 0x9d, 0x11, 0x01, 0x23, 0x06, 0x18, 0x04, 0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x1d, 0x08, 
+	0x00, 0x40, 0x13, 0x02, 0x01, 0x40, 0x3c, 0x01, 0x00, 0x40, 0x1d, 0x04, 0x01, 0x47, 0x2b, 0x51, 0x21, 0x23, 0x21, 0x25, 0x0f, 0x16, 0x02, 0x01, 
+	0x40, 0x3c, 0x03, 0x00, 0x40, 0x34, 0x03, 0x01, 0x47, 0x9e, 0x30, 0x23, 0x18, 0x23, 0x25, 0x34, 0x04, 0x02, 0x01, 0x40, 0x87, 0x04, 0x00, 0x40, 
+	0x51, 0x05, 0x01, 0x40, 0x30, 0x05, 0x00, 0x41, 0x23, 0x04, 0x04, 0x01, 0x40, 0x44, 0x04, 0x00, 0x40, 0x9e, 0x02, 0x01, 0x43, 0x13, 0x51, 0x21, 
+	0x23, 0x06, 0x18, 0x40, 0x0a, 0x03, 0x00, 0x40, 0x21, 0x02, 0x01, 0x41, 0x04, 0x3b, 0x09, 0x00, 0x40, 0x87, 0x05, 0x01, 0x47, 0x04, 0x12, 0x13, 
+	0x10, 0x2b, 0x13, 0x12, 0x04, 0x02, 0x01, 0x41, 0x0b, 0x30, 0x03, 0x00, 0x41, 0x08, 0x1f, 0x0a, 0x04, 0x04, 0x01, 0x40, 0x28, 0x02, 0x00, 0x40, 
+	0x25, 0x01, 0x01, 0x40, 0x32, 0x0e, 0x00, 0x40, 0x10, 0x02, 0x01, 0x40, 0x0b, 0x11, 0x00, 0x42, 0x8e, 0x87, 0x04, 0x0d, 0x01, 0x41, 0x12, 0x1b, 
+	0x04, 0x00, 0x40, 0x36, 0x02, 0x01, 0x40, 0x0f, 0x08, 0x00, 0x41, 0x37, 0x12, 0x03, 0x01, 0x08, 0x04, 0x40, 0x37, 0x04, 0x00, 0x41, 0x30, 0x12, 
+	0x03, 0x01, 0x08, 0x04, 0x40, 0x11, 0x02, 0x00, 0x41, 0x08, 0x0b, 0x02, 0x01, 0x40, 0x11, 0x07, 0x00, 0x41, 0x0a, 0x0b, 0x01, 0x01, 0x41, 0x04, 
+	0x21, 0x01, 0x00, 0x40, 0x35, 0x07, 0x01, 0x40, 0x04, 0x04, 0x01, 0x41, 0x16, 0x51, 0x04, 0x00, 0x41, 0x23, 0x12, 0x04, 0x01, 0x02, 0x04, 0x03, 
+	0x01, 0x42, 0x04, 0x34, 0x0a, 0x04, 0x00, 0x40, 0x37, 0x04, 0x01, 0x41, 0x13, 0x08, 0x05, 0x00, 0x41, 0x17, 0x0b, 0x03, 0x01, 0x41, 0x16, 0x83, 
+	0x04, 0x00, 0x42, 0x17, 0x36, 0x04, 0x03, 0x01, 0x07, 0x04, 0x40, 0x34, 0x03, 0x00, 0x40, 0x19, 0x02, 0x01, 0x40, 0x1f, 0x0b, 0x00, 0x42, 0x30, 
+	0x10, 0x04, 0x0b, 0x01, 0x42, 0x16, 0x33, 0x18, 0x04, 0x00, 0x41, 0x18, 0x04, 0x0d, 0x01, 0x41, 0x0b, 0x1d, 0x03, 0x00, 0x43, 0x10, 0x01, 0x12, 
+	0x17, 0x0e, 0x00, 0x40, 0x2a, 0x02, 0x01, 0x41, 0x04, 0x18, 0x12, 0x00, 0x42, 0x24, 0x3c, 0x2a, 0x0a, 0x0f, 0x41, 0x51, 0x8e, 0x05, 0x00, 0x44, 
+	0x51, 0x13, 0x22, 0x34, 0x8e, 0x09, 0x00, 0x44, 0x08, 0x11, 0x3c, 0x0f, 0xe9, 0x01, 0x79, 0x05, 0x52, 0x41, 0x32, 0x0a, 0x05, 0x00, 0x44, 0x0a, 
+	0x11, 0x3c, 0x0f, 0xe9, 0x01, 0x79, 0x05, 0x52, 0x41, 0x9d, 0x08, 0x03, 0x00, 0x43, 0x9d, 0x22, 0xd8, 0x2a, 0x09, 0x00, 0x43, 0x44, 0x22, 0xd8, 
+	0x28, 0x02, 0x00, 0x40, 0x22, 0x02, 0x01, 0x41, 0x1f, 0x2a, 0x07, 0x1d, 0x41, 0x25, 0x0a, 0x06, 0x00, 0x45, 0x17, 0x19, 0x34, 0x36, 0x10, 0x22, 
+	0x01, 0x12, 0x45, 0x22, 0x13, 0x36, 0x79, 0x28, 0x24, 0x06, 0x00, 0x46, 0x08, 0x2a, 0x35, 0x87, 0x35, 0x44, 0x83, 0x07, 0x00, 0x45, 0x1b, 0x33, 
+	0x87, 0x35, 0x32, 0x24, 0x07, 0x00, 0x43, 0x23, 0x30, 0x28, 0x32, 0x01, 0x79, 0x40, 0x35, 0x04, 0x52, 0x41, 0x79, 0x11, 0x03, 0x00, 0x44, 0x23, 
+	0x36, 0x1f, 0x2b, 0x1b, 0x0d, 0x00, 0x4d, 0x23, 0x90, 0x28, 0x32, 0x35, 0x2b, 0x22, 0x1f, 0xd8, 0x36, 0xe9, 0x28, 0x1b, 0x0a, 0x06, 0x00, 0x41, 
+	0x08, 0x28, 0x0b, 0x0f, 0x42, 0x2a, 0x51, 0x83, 0x04, 0x00, 0x42, 0x19, 0x2a, 0x23, 0x0f, 0x00, 0x41, 0x0a, 0x1d, 0x01, 0x0f, 0x41, 0x19, 0x08, 
+	0x3f, 0x00, 0x33, 0x00, 0x41, 0x17, 0x04, 0x02, 0x01, 0x40, 0x1b, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x20, 0x00, 0x40, 0x1b, 0x02, 
+	0x01, 0x41, 0x0b, 0x0a, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x20, 0x00, 0x40, 0x1d, 0x02, 0x01, 0x40, 0x10, 0x2c, 0x00, 0x40, 0x15, 
+	0x01, 0x00, 0x40, 0x15, 0x03, 0x00, 0x40, 0x0e, 0x02, 0x00, 0x42, 0x0e, 0x68, 0xe7, 0x02, 0x00, 0x40, 0x08, 0x02, 0x15, 0x40, 0x08, 0x02, 0x00, 
+	0x40, 0x0e, 0x01, 0x00, 0x03, 0x15, 0x40, 0x08, 0x02, 0x00, 0x44, 0x0e, 0x08, 0x00, 0x0e, 0x08, 0x02, 0x00, 0x01, 0x08, 0x02, 0x00, 0x43, 0x08, 
+	0xb7, 0x66, 0x08, 0x05, 0x00, 0x44, 0x0e, 0x08, 0x00, 0x0e, 0x08, 0x02, 0x00, 0x01, 0x08, 0x42, 0x00, 0x0e, 0x08, 0x02, 0x00, 0x41, 0x08, 0x0e, 
+	0x03, 0x00, 0x01, 0xb7, 0x02, 0x00, 0x01, 0x08, 0x03, 0x00, 0x41, 0x08, 0x0e, 0x02, 0x00, 0x40, 0x15, 0x02, 0x00, 0x40, 0x08, 0x04, 0x15, 0x42, 
+	0x0e, 0x00, 0x0e, 0x03, 0x00, 0x42, 0x15, 0x68, 0x15, 0x02, 0x00, 0x41, 0x08, 0x0e, 0x03, 0x00, 0x40, 0x15, 0x3f, 0x00, 0x34, 0x00, 0x40, 0x34, 
+	0x02, 0x01, 0x40, 0x32, 0x2c, 0x00, 0x44, 0x48, 0x2c, 0x5f, 0x48, 0xa8, 0x02, 0x00, 0x4a, 0xac, 0x69, 0x00, 0x4f, 0x47, 0x48, 0x5b, 0x75, 0x0e, 
+	0x00, 0x43, 0x02, 0x48, 0x41, 0x29, 0x7f, 0x01, 0x00, 0x43, 0x46, 0x71, 0x00, 0xf1, 0x02, 0x48, 0x41, 0x29, 0x6c, 0x01, 0x00, 0x44, 0xbd, 0xaa, 
+	0x00, 0xab, 0x80, 0x02, 0x00, 0x41, 0xbc, 0x3a, 0x01, 0x00, 0x41, 0x72, 0x46, 0x01, 0x5b, 0x41, 0x8d, 0xcb, 0x04, 0x00, 0x44, 0x73, 0x6b, 0x00, 
+	0x82, 0x80, 0x02, 0x00, 0x44, 0xbc, 0x43, 0x00, 0x74, 0x5a, 0x02, 0x00, 0x41, 0x64, 0xbd, 0x01, 0x00, 0x41, 0x59, 0xac, 0x01, 0x5b, 0x44, 0x3f, 
+	0x68, 0x00, 0xcf, 0x80, 0x03, 0x00, 0x41, 0xef, 0xbb, 0x01, 0x00, 0x42, 0xcd, 0x48, 0x68, 0x01, 0x00, 0x40, 0xbb, 0x04, 0x48, 0x43, 0x82, 0x00, 
+	0x47, 0x66, 0x01, 0x00, 0x44, 0xbb, 0xf1, 0x48, 0xf1, 0x3a, 0x01, 0x00, 0x42, 0xa9, 0x29, 0x5f, 0x01, 0x00, 0x41, 0x2c, 0x48, 0x3f, 0x00, 0x34, 
+	0x00, 0x40, 0x22, 0x02, 0x01, 0x40, 0x19, 0x2c, 0x00, 0x45, 0x41, 0x2c, 0x5f, 0x41, 0xac, 0x08, 0x01, 0x00, 0x4b, 0x46, 0x72, 0x08, 0x8d, 0x63, 
+	0x00, 0x2c, 0x8c, 0xbc, 0x00, 0x3a, 0x80, 0x01, 0x68, 0x48, 0x56, 0x29, 0xa9, 0x00, 0x40, 0x71, 0x00, 0x5b, 0xb7, 0x01, 0x15, 0x49, 0x56, 0xf1, 
+	0x69, 0x00, 0x74, 0x64, 0x00, 0x3f, 0x5b, 0x59, 0x01, 0x00, 0x45, 0x6c, 0x7f, 0x00, 0x5f, 0x29, 0xcf, 0x01, 0x08, 0x42, 0xdf, 0x9a, 0x0e, 0x03, 
+	0x00, 0x45, 0x75, 0xaa, 0x00, 0x3f, 0x5b, 0x59, 0x01, 0x00, 0x45, 0x43, 0x3a, 0x00, 0x5a, 0x41, 0x4f, 0x01, 0x00, 0x45, 0x99, 0x73, 0x00, 0x2c, 
+	0x9a, 0x6c, 0x01, 0x0e, 0x45, 0x3a, 0x47, 0x15, 0x68, 0x9a, 0x08, 0x02, 0x00, 0x41, 0x9a, 0x59, 0x01, 0x00, 0x42, 0x73, 0x82, 0x6c, 0x01, 0x00, 
+	0x40, 0x84, 0x01, 0x68, 0x52, 0x47, 0xcd, 0x68, 0xb7, 0x00, 0x29, 0x66, 0x00, 0xce, 0x40, 0x71, 0x00, 0x59, 0x46, 0xbc, 0x00, 0x63, 0x41, 0x80, 
+	0x01, 0x00, 0x41, 0x2c, 0x41, 0x3f, 0x00, 0x33, 0x00, 0x41, 0x17, 0x0b, 0x01, 0x01, 0x41, 0x04, 0x21, 0x2c, 0x00, 0x45, 0x41, 0x2c, 0x5f, 0x9b, 
+	0x46, 0x6b, 0x01, 0x00, 0x44, 0x46, 0x72, 0x84, 0x9b, 0x08, 0x01, 0x00, 0x44, 0x56, 0x3a, 0x00, 0x3a, 0x43, 0x02, 0x00, 0x01, 0xe0, 0x45, 0x00, 
+	0x40, 0x71, 0x00, 0x5b, 0x84, 0x02, 0x00, 0x48, 0xf0, 0x64, 0x00, 0x74, 0x64, 0x00, 0x3f, 0x82, 0x5a, 0x01, 0x00, 0x44, 0x6c, 0x7f, 0x00, 0x3a, 
+	0x73, 0x03, 0x00, 0x41, 0x8c, 0x69, 0x03, 0x00, 0x45, 0x75, 0xaa, 0x00, 0x3f, 0x82, 0x75, 0x01, 0x00, 0x45, 0x43, 0x3a, 0x00, 0x5a, 0x82, 0x3f, 
+	0x01, 0x00, 0x44, 0x99, 0x73, 0x00, 0xbb, 0x81, 0x03, 0x00, 0x44, 0xab, 0xce, 0x00, 0x76, 0x69, 0x01, 0x00, 0x41, 0x69, 0x46, 0x01, 0x00, 0x43, 
+	0x0e, 0x47, 0xa8, 0x76, 0x04, 0x00, 0x41, 0x40, 0x59, 0x02, 0x00, 0x44, 0x29, 0x66, 0x08, 0x47, 0x56, 0x02, 0x00, 0x49, 0x72, 0x29, 0x15, 0x63, 
+	0x76, 0x29, 0x68, 0x00, 0x2c, 0x41, 0x3f, 0x00, 0x33, 0x00, 0x40, 0x24, 0x02, 0x01, 0x41, 0x1f, 0x08, 0x2c, 0x00, 0x4d, 0x41, 0x2c, 0x5f, 0x29, 
+	0xcd, 0x40, 0x0e, 0x00, 0x46, 0x72, 0x08, 0x8d, 0x7f, 0xb7, 0x03, 0x00, 0x41, 0x3a, 0x43, 0x02, 0x00, 0x47, 0xbd, 0x43, 0x00, 0x40, 0x71, 0x00, 
+	0x5b, 0x84, 0x01, 0x00, 0x50, 0x2c, 0x47, 0xa8, 0x00, 0x74, 0x64, 0x00, 0x3f, 0xa9, 0x9a, 0x4f, 0x00, 0x6c, 0x7f, 0x00, 0x76, 0xcc, 0x09, 0x00, 
+	0x54, 0x75, 0xaa, 0x00, 0x3f, 0xa9, 0x9a, 0xcb, 0x00, 0x43, 0x3a, 0x00, 0x5a, 0x64, 0x46, 0xa9, 0x00, 0x99, 0x73, 0x00, 0xf0, 0x64, 0x03, 0x00, 
+	0x44, 0xce, 0x5a, 0x00, 0x43, 0xbc, 0x01, 0x00, 0x41, 0x43, 0x3a, 0x01, 0x00, 0x44, 0x56, 0xf0, 0x00, 0x47, 0x68, 0x03, 0x00, 0x41, 0x40, 0x59, 
+	0x02, 0x00, 0x44, 0x29, 0x66, 0x59, 0x29, 0x08, 0x03, 0x00, 0x48, 0x47, 0x4f, 0x63, 0x81, 0x43, 0x75, 0x00, 0x2c, 0x41, 0x3f, 0x00, 0x34, 0x00, 
+	0x43, 0x19, 0x44, 0x86, 0x17, 0x2d, 0x00, 0x53, 0x41, 0x2c, 0x5f, 0x29, 0x0e, 0x8c, 0xcf, 0x00, 0x46, 0x72, 0x00, 0x69, 0x46, 0x41, 0x8d, 0x6c, 
+	0x0e, 0x00, 0x3a, 0x5a, 0x01, 0x6b, 0x48, 0x43, 0xf1, 0x69, 0x00, 0x40, 0x71, 0x00, 0x5b, 0xab, 0x01, 0x8c, 0x41, 0x29, 0x5a, 0x01, 0x00, 0x4c, 
+	0x74, 0x64, 0x00, 0x3f, 0x56, 0x99, 0x82, 0x00, 0x6c, 0x7f, 0x00, 0x9b, 0x59, 0x01, 0x00, 0x40, 0xcb, 0x01, 0x4f, 0x40, 0x5f, 0x03, 0x00, 0x54, 
+	0x75, 0xaa, 0x00, 0x3f, 0x4f, 0xce, 0x82, 0x00, 0x43, 0x3a, 0x00, 0x5a, 0x6b, 0xcd, 0x46, 0x0e, 0x99, 0x73, 0x00, 0x46, 0x56, 0x03, 0x00, 0x44, 
+	0xcc, 0xac, 0x00, 0x69, 0x3f, 0x01, 0x00, 0x41, 0x76, 0x72, 0x01, 0x00, 0x44, 0x80, 0x64, 0x00, 0xef, 0x6c, 0x03, 0x00, 0x41, 0x40, 0x59, 0x02, 
+	0x00, 0x43, 0x29, 0x66, 0xa8, 0x76, 0x04, 0x00, 0x48, 0xab, 0x6b, 0x63, 0x81, 0x2c, 0x9a, 0x72, 0x2c, 0x41, 0x3f, 0x00, 0x3f, 0x00, 0x26, 0x00, 
+	0x49, 0x41, 0x2c, 0x5f, 0x29, 0x08, 0x72, 0x29, 0x2c, 0x46, 0x72, 0x01, 0x00, 0x47, 0x08, 0x69, 0x6c, 0x9a, 0xbd, 0x00, 0x3a, 0x9a, 0x01, 0xac, 
+	0x41, 0x81, 0xcc, 0x01, 0x00, 0x47, 0x40, 0x71, 0x00, 0x5b, 0xbb, 0xcf, 0x76, 0xbd, 0x02, 0x00, 0x4c, 0x74, 0x64, 0x00, 0x3f, 0x56, 0x0e, 0x46, 
+	0xcd, 0x6c, 0x7f, 0x00, 0x29, 0x71, 0x01, 0x00, 0x43, 0x40, 0x29, 0x48, 0xdf, 0x03, 0x00, 0x4e, 0x75, 0xaa, 0x00, 0x3f, 0x4f, 0x0e, 0x8d, 0xcc, 
+	0x43, 0x3a, 0x00, 0x5a, 0x6b, 0x00, 0x82, 0x01, 0x99, 0x43, 0x73, 0x00, 0x46, 0xa8, 0x03, 0x00, 0x47, 0xcd, 0xac, 0x00, 0x08, 0x40, 0xe7, 0xb7, 
+	0x47, 0x02, 0x00, 0x44, 0x9a, 0xa9, 0xcb, 0xbb, 0x76, 0x03, 0x00, 0x41, 0x40, 0x59, 0x02, 0x00, 0x43, 0x29, 0x66, 0xa8, 0x46, 0x04, 0x00, 0x40, 
+	0x82, 0x01, 0x63, 0x45, 0x81, 0x00, 0xcf, 0xab, 0x2c, 0x41, 0x3f, 0x00, 0x3f, 0x00, 0x26, 0x00, 0x4b, 0x41, 0x2c, 0x5f, 0x29, 0x08, 0x00, 0x74, 
+	0x43, 0x46, 0x72, 0xb7, 0xa9, 0x02, 0x00, 0x44, 0x66, 0x9b, 0x0e, 0x3a, 0x43, 0x05, 0x00, 0x48, 0x40, 0x71, 0x00, 0x5b, 0x84, 0x00, 0xe7, 0x29, 
+	0xcd, 0x01, 0x00, 0x4c, 0x74, 0x64, 0x00, 0x3f, 0x56, 0x00, 0xa9, 0x46, 0x43, 0x7f, 0x00, 0x82, 0x6b, 0x03, 0x00, 0x41, 0x80, 0xdf, 0x03, 0x00, 
+	0x47, 0x75, 0xaa, 0x00, 0x3f, 0x4f, 0x00, 0x63, 0x76, 0x01, 0x3a, 0x4a, 0x00, 0x5a, 0x6b, 0x00, 0x4f, 0x47, 0xbb, 0x73, 0x00, 0x75, 0xcf, 0x03, 
+	0x00, 0x41, 0xbb, 0x74, 0x01, 0x00, 0x43, 0xe0, 0x6b, 0xce, 0x80, 0x01, 0x00, 0x41, 0xcb, 0x9b, 0x02, 0x76, 0x41, 0x48, 0x59, 0x02, 0x00, 0x41, 
+	0x40, 0x59, 0x02, 0x00, 0x40, 0x29, 0x01, 0x66, 0x41, 0x9b, 0x15, 0x02, 0x00, 0x49, 0x08, 0x29, 0x69, 0x63, 0x81, 0x00, 0x08, 0x40, 0x6b, 0x41, 
+	0x3f, 0x00, 0x3f, 0x00, 0x26, 0x00, 0x46, 0x41, 0x2c, 0x5f, 0x29, 0x08, 0x00, 0x68, 0x01, 0x9b, 0x43, 0x72, 0x69, 0x47, 0x0e, 0x01, 0x00, 0x44, 
+	0x2c, 0x29, 0x0e, 0x3a, 0x43, 0x05, 0x00, 0x44, 0x40, 0x71, 0x00, 0x5b, 0x84, 0x01, 0x00, 0x48, 0xdf, 0x8d, 0x08, 0x00, 0x74, 0x64, 0x00, 0x3f, 
+	0x56, 0x01, 0x00, 0x46, 0x3f, 0x47, 0x7f, 0x00, 0xcf, 0xab, 0x08, 0x02, 0x00, 0x41, 0xbd, 0xdf, 0x03, 0x00, 0x44, 0x75, 0xaa, 0x00, 0x3f, 0x4f, 
+	0x01, 0x00, 0x45, 0xac, 0x47, 0x3a, 0x00, 0x5a, 0x6b, 0x01, 0x00, 0x46, 0x5a, 0x47, 0x73, 0x00, 0x63, 0x76, 0x0e, 0x01, 0x00, 0x42, 0x15, 0x8d, 
+	0xa9, 0x01, 0x00, 0x43, 0x4f, 0x74, 0xf0, 0x56, 0x01, 0x00, 0x41, 0x7f, 0xbc, 0x02, 0x00, 0x41, 0x73, 0xbc, 0x02, 0x00, 0x41, 0x40, 0x59, 0x02, 
+	0x00, 0x44, 0x29, 0x66, 0x00, 0xac, 0x99, 0x02, 0x00, 0x44, 0x63, 0x8d, 0x08, 0x63, 0x81, 0x01, 0x00, 0x42, 0x6b, 0x47, 0x41, 0x3f, 0x00, 0x3f, 
+	0x00, 0x26, 0x00, 0x44, 0x41, 0x2c, 0x5f, 0x29, 0x08, 0x01, 0x00, 0x45, 0xef, 0x41, 0x72, 0x08, 0x3f, 0x81, 0x01, 0x4f, 0x44, 0x81, 0xef, 0x00, 
+	0x3a, 0x43, 0x05, 0x00, 0x44, 0x40, 0x71, 0x00, 0x5b, 0x84, 0x01, 0x00, 0x48, 0x15, 0x47, 0x64, 0x00, 0x74, 0x64, 0x00, 0x3f, 0x56, 0x01, 0x00, 
+	0x4b, 0x4f, 0x41, 0x7f, 0x00, 0x0e, 0x3f, 0x81, 0x56, 0xcb, 0xef, 0x48, 0xa8, 0x03, 0x00, 0x44, 0x75, 0xaa, 0x00, 0x3f, 0x4f, 0x01, 0x00, 0x45, 
+	0x56, 0x41, 0x3a, 0x00, 0x5a, 0x6b, 0x01, 0x00, 0x42, 0x59, 0x5b, 0x73, 0x01, 0x00, 0x41, 0x8c, 0xf0, 0x01, 0x56, 0x01, 0x8c, 0x02, 0x00, 0x47, 
+	0x08, 0x8d, 0x47, 0x0e, 0x00, 0x08, 0x8d, 0x71, 0x02, 0x00, 0x41, 0x63, 0x46, 0x02, 0x00, 0x41, 0x40, 0x59, 0x02, 0x00, 0x4c, 0x29, 0x66, 0x00, 
+	0xcb, 0x9b, 0xdf, 0x69, 0xce, 0x9b, 0xcc, 0x00, 0x63, 0x81, 0x01, 0x00, 0x42, 0x08, 0x3f, 0x41, 0x3f, 0x00, 0x3f, 0x00, 0x26, 0x00, 0x44, 0xab, 
+	0x15, 0x84, 0x5a, 0x08, 0x01, 0x00, 0x4c, 0x5f, 0x8c, 0x68, 0x00, 0xe7, 0xbd, 0x47, 0x40, 0xe0, 0x0e, 0x00, 0x99, 0x64, 0x05, 0x00, 0x44, 0x73, 
+	0x66, 0x00, 0x8c, 0x15, 0x02, 0x00, 0x47, 0x63, 0xbd, 0x00, 0x6c, 0xcc, 0x00, 0x80, 0x69, 0x02, 0x00, 0x41, 0x80, 0xce, 0x01, 0x00, 0x45, 0x2c, 
+	0x7f, 0x8d, 0x47, 0x75, 0x69, 0x04, 0x00, 0x44, 0x6c, 0xa8, 0x00, 0x80, 0x71, 0x02, 0x00, 0x44, 0x80, 0x99, 0x00, 0x43, 0xa8, 0x02, 0x00, 0x41, 
+	0x43, 0xbc, 0x01, 0x00, 0x41, 0x2c, 0xe0, 0x01, 0x40, 0x41, 0xe0, 0x15, 0x03, 0x00, 0x41, 0x6c, 0x43, 0x01, 0x00, 0x41, 0x5f, 0x81, 0x03, 0x00, 
+	0x42, 0x84, 0x8c, 0xe7, 0x01, 0x00, 0x41, 0x74, 0x66, 0x02, 0x00, 0x41, 0x5a, 0x5f, 0x01, 0x00, 0x44, 0x4f, 0xab, 0x29, 0x82, 0xcc, 0x01, 0x00, 
+	0x41, 0x4f, 0x3a, 0x02, 0x00, 0x41, 0x56, 0xab, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 
+	0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3b, 0x00
+};
+const PackedIcon GPUSA_Logo_theme = {295, 125, GPUSA_Logo_theme_palette, 256, GPUSA_Logo_theme_data, 10380};
+
+#endif
@@ -0,0 +1,391 @@
+#include "PatriotRacing_TileBuffer.h"
+
+TileBuffer::TileBuffer() {
+
+	Pixels = NULL;
+	X = 0;
+	Y = 0;
+	W = 0;
+	H = 0;
+	Cols = 0;
+	Rows = 0;
+	memset(Dirty, 0, sizeof(Dirty));
+	memset(&Stats, 0, sizeof(Stats));
+	FrameStart = 0;
+}
+
+bool TileBuffer::Begin(uint16_t *Pixels, int16_t X, int16_t Y, int16_t W, int16_t H) {
+
+	uint8_t cols = (W + TILE_W - 1) / TILE_W;
+	uint8_t rows = (H + TILE_H - 1) / TILE_H;
+
+	if ((Pixels == NULL) || (W <= 0) || (H <= 0) || (cols > TILEBUFFER_MAX_COLS) || (rows > TILEBUFFER_MAX_ROWS)) {
+		return false;
+	}
+
+	this->Pixels = Pixels;
+	this->X = X;
+	this->Y = Y;
+	this->W = W;
+	this->H = H;
+	Cols = cols;
+	Rows = rows;
+	memset(Dirty, 0, sizeof(Dirty));
+	memset(&Stats, 0, sizeof(Stats));
+
+	return true;
+}
+
+bool TileBuffer::Covers(int16_t X, int16_t Y, int16_t W, int16_t H) const {
+	return (X >= this->X) && (Y >= this->Y) && (X + W <= this->X + this->W) && (Y + H <= this->Y + this->H);
+}
+
+// screen rectangle to buffer coordinates, false if nothing is left
+bool TileBuffer::Clip(int16_t &X, int16_t &Y, int16_t &W, int16_t &H) const {
+
+	X -= this->X;
+	Y -= this->Y;
+	if (X < 0) {
+		W += X;
+		X = 0;
+	}
+	if (Y < 0) {
+		H += Y;
+		Y = 0;
+	}
+	if (X + W > this->W) {
+		W = this->W - X;
+	}
+	if (Y + H > this->H) {
+		H = this->H - Y;
+	}
+	return (Pixels != NULL) && (W > 0) && (H > 0);
+}
+
+void TileBuffer::MarkDirty(int16_t X, int16_t Y, int16_t W, int16_t H) {
+
+	uint8_t c0, c1, r;
+	uint32_t bits;
+
+	if (!Clip(X, Y, W, H)) {
+		return;
+	}
+
+	c0 = X / TILE_W;
+	c1 = (X + W - 1) / TILE_W;
+	bits = ((c1 - c0 == 31) ? 0xFFFFFFFF : ((1UL << (c1 - c0 + 1)) - 1)) << c0;
+	for (r = Y / TILE_H; r <= (Y + H - 1) / TILE_H; r++) {
+		Dirty[r] |= bits;
+	}
+}
+
+void TileBuffer::MarkAll() {
+	MarkDirty(X, Y, W, H);
+}
+
+void TileBuffer::fillScreen(uint16_t Color) {
+	fillRect(X, Y, W, H, Color);
+}
+
+void TileBuffer::fillRect(int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Color) {
+
+	int16_t sx = X, sy = Y, sw = W, sh = H;
+	uint16_t *p;
+	int16_t i, j;
+
+	if (!Clip(X, Y, W, H)) {
+		return;
+	}
+
+	for (j = 0; j < H; j++) {
+		p = Pixels + (int32_t) (Y + j) * this->W + X;
+		for (i = 0; i < W; i++) {
+			p[i] = Color;
+		}
+	}
+	MarkDirty(sx, sy, sw, sh);
+}
+
+void TileBuffer::drawPixel(int16_t X, int16_t Y, uint16_t Color) {
+	fillRect(X, Y, 1, 1, Color);
+}
+
+void TileBuffer::drawFastHLine(int16_t X, int16_t Y, int16_t W, uint16_t Color) {
+	fillRect(X, Y, W, 1, Color);
+}
+
+void TileBuffer::drawFastVLine(int16_t X, int16_t Y, int16_t H, uint16_t Color) {
+	fillRect(X, Y, 1, H, Color);
+}
+
+void TileBuffer::writeRect(int16_t X, int16_t Y, int16_t W, int16_t H, const uint16_t *Colors) {
+
+	int16_t sx = X, sy = Y, sw = W, sh = H;
+	int16_t j;
+
+	if (!Clip(X, Y, W, H)) {
+		return;
+	}
+
+	// skip the part of the source that was clipped off
+	Colors += (int32_t) (Y - (sy - this->Y)) * sw + (X - (sx - this->X));
+	for (j = 0; j < H; j++) {
+		memcpy(Pixels + (int32_t) (Y + j) * this->W + X, Colors + (int32_t) j * sw, W * sizeof(uint16_t));
+	}
+	MarkDirty(sx, sy, sw, sh);
+}
+
+// the canvas is in buffer coordinates, draw at (screen x - region x, screen y - region y)
+FontCanvas TileBuffer::Canvas() {
+
+	FontCanvas c;
+
+	c.Pixels = Pixels;
+	c.Width = W;
+	c.Height = H;
+	c.Stride = W;
+	return c;
+}
+
+uint16_t TileBuffer::DirtyTiles() const {
+
+	uint16_t n = 0;
+	uint32_t bits;
+	uint8_t r;
+
+	for (r = 0; r < Rows; r++) {
+		for (bits = Dirty[r]; bits; bits &= bits - 1) {
+			n++;
+		}
+	}
+	return n;
+}
+
+// runs of dirty tiles across each tile row, stacked when the row below has the same run
+uint8_t TileBuffer::Coalesce(TileRect *Rect) {
+
+	uint8_t c0[TILEBUFFER_MAX_RECTS], c1[TILEBUFFER_MAX_RECTS], r0[TILEBUFFER_MAX_RECTS], r1[TILEBUFFER_MAX_RECTS];
+	uint8_t count = 0;
+	uint8_t r, a, b, k;
+	uint32_t bits;
+	bool stacked;
+
+	for (r = 0; r < Rows; r++) {
+		bits = Dirty[r];
+		while (bits) {
+			a = 0;
+			while (!(bits & (1UL << a))) {
+				a++;
+			}
+			b = a;
+			while ((b < 32) && (bits & (1UL << b))) {
+				bits &= ~(1UL << b);
+				b++;
+			}
+
+			stacked = false;
+			for (k = 0; k < count; k++) {
+				if ((r1[k] == r) && (c0[k] == a) && (c1[k] == b)) {
+					r1[k] = r + 1;
+					stacked = true;
+					break;
+				}
+			}
+			if (stacked) {
+				continue;
+			}
+
+			if (count < TILEBUFFER_MAX_RECTS) {
+				c0[count] = a;
+				c1[count] = b;
+				r0[count] = r;
+				r1[count] = r + 1;
+				count++;
+			}
+			else {
+				// out of rectangles, grow the last one to cover this run too
+				k = count - 1;
+				c0[k] = (a < c0[k]) ? a : c0[k];
+				c1[k] = (b > c1[k]) ? b : c1[k];
+				r1[k] = r + 1;
+			}
+		}
+	}
+
+	for (k = 0; k < count; k++) {
+		int16_t x = c0[k] * TILE_W;
+		int16_t y = r0[k] * TILE_H;
+
+		Rect[k].X = this->X + x;
+		Rect[k].Y = this->Y + y;
+		Rect[k].W = ((c1[k] * TILE_W > W) ? W : c1[k] * TILE_W) - x;
+		Rect[k].H = ((r1[k] * TILE_H > H) ? H : r1[k] * TILE_H) - y;
+		Rect[k].Pixels = Pixels + (int32_t) y * W + x;
+		Rect[k].Stride = W;
+	}
+
+	return count;
+}
+
+void TileBuffer::BeginFrame() {
+	FrameStart = TileMicros();
+}
+
+const TileStats &TileBuffer::GetStats() const {
+	return Stats;
+}
+
+#if defined(TEENSYDUINO)
+
+#define ILI9341_CASET 0x2A
+#define ILI9341_PASET 0x2B
+#define ILI9341_RAMWR 0x2C
+
+TileSPIPort::TileSPIPort(SPIClass &Port, uint8_t CS, uint8_t DC, uint32_t Speed) : SPIPort(Port), CS(CS), DC(DC), Settings(Speed, MSBFIRST, SPI_MODE0) {
+
+	Count = 0;
+	Current = 0;
+	Row = 0;
+	Sending = false;
+	Which = 0;
+}
+
+void TileSPIPort::Begin() {
+
+	// CS / DC stay the panel's until a frame is sent
+	// runs from the DMA interrupt so the next row starts right away
+	Event.setContext(this);
+	Event.attachImmediate(RowDone);
+	// the next window is blocking transfers, those wait for yield()
+	Between.setContext(this);
+	Between.attach(RectDone);
+}
+
+bool TileSPIPort::Busy() const {
+	return Sending;
+}
+
+void TileSPIPort::Send(const TileRect *Rect, uint8_t Count) {
+
+	if ((Count == 0) || Sending) {
+		return;
+	}
+
+	memcpy(this->Rect, Rect, Count * sizeof(TileRect));
+	this->Count = Count;
+	Current = 0;
+	Sending = true;
+
+	SPIPort.beginTransaction(Settings);
+	TakePins();
+	digitalWrite(CS, LOW);
+	StartRect();
+}
+
+// CS / DC as plain outputs for the frame, the DMA transfers don't drive the hardware chip selects
+void TileSPIPort::TakePins() {
+
+	pinMode(CS, OUTPUT);
+	pinMode(DC, OUTPUT);
+	digitalWrite(CS, HIGH);
+	digitalWrite(DC, HIGH);
+}
+
+// back to how ILI9341_t3's begin() leaves them: both hardware chip selects on a Teensy 3.x, on a
+// Teensy 4 DC is (when it can be) and CS is a plain output it drives itself, idle high
+void TileSPIPort::GivePins() {
+
+	digitalWrite(CS, HIGH);
+#if defined(KINETISK)
+	if (SPIPort.pinIsChipSelect(CS, DC)) {
+		SPIPort.setCS(CS);
+		SPIPort.setCS(DC);
+	}
+#else
+	if (SPIPort.pinIsChipSelect(DC)) {
+		SPIPort.setCS(DC);
+	}
+#endif
+}
+
+// not from the interrupt and no DMA running, the window, then the first two rows staged before
+// the first one starts
+void TileSPIPort::StartRect() {
+
+	const TileRect &r = Rect[Current];
+
+	Window(r);
+	Row = 0;
+	Which = 0;
+	Stage(0, r, 0);
+	if (r.H > 1) {
+		Stage(1, r, 1);
+	}
+	SPIPort.transfer(Staging[0], NULL, r.W * sizeof(uint16_t), Event);
+}
+
+// column / page address then memory write, the pixels that follow fill the window row by row
+void TileSPIPort::Window(const TileRect &R) {
+
+	digitalWrite(DC, LOW);
+	SPIPort.transfer(ILI9341_CASET);
+	digitalWrite(DC, HIGH);
+	SPIPort.transfer16(R.X);
+	SPIPort.transfer16(R.X + R.W - 1);
+	digitalWrite(DC, LOW);
+	SPIPort.transfer(ILI9341_PASET);
+	digitalWrite(DC, HIGH);
+	SPIPort.transfer16(R.Y);
+	SPIPort.transfer16(R.Y + R.H - 1);
+	digitalWrite(DC, LOW);
+	SPIPort.transfer(ILI9341_RAMWR);
+	digitalWrite(DC, HIGH);
+}
+
+// the panel wants the high byte first
+void TileSPIPort::Stage(uint8_t Which, const TileRect &R, int16_t Row) {
+
+	const uint16_t *src = R.Pixels + (int32_t) Row * R.Stride;
+	uint16_t *dst = Staging[Which];
+	int16_t i;
+
+	for (i = 0; i < R.W; i++) {
+		dst[i] = (src[i] >> 8) | (src[i] << 8);
+	}
+}
+
+// DMA interrupt, a row is out. the next one is already staged, start it, then stage the one after
+// into the buffer that just finished. nothing blocking in here
+void TileSPIPort::RowDone(EventResponderRef Event) {
+
+	TileSPIPort &port = *(TileSPIPort *) Event.getContext();
+	const TileRect &r = port.Rect[port.Current];
+
+	port.Row++;
+	if (port.Row >= r.H) {
+		port.Between.triggerEvent();
+		return;
+	}
+	port.Which ^= 1;
+	port.SPIPort.transfer(port.Staging[port.Which], NULL, r.W * sizeof(uint16_t), port.Event);
+	if (port.Row + 1 < r.H) {
+		port.Stage(port.Which ^ 1, r, port.Row + 1);
+	}
+}
+
+// from yield(), a rectangle is out, the next window or the end of the frame
+void TileSPIPort::RectDone(EventResponderRef Event) {
+
+	TileSPIPort &port = *(TileSPIPort *) Event.getContext();
+
+	port.Current++;
+	if (port.Current >= port.Count) {
+		port.GivePins();
+		port.SPIPort.endTransaction();
+		port.Sending = false;
+		return;
+	}
+	port.StartRect();
+}
+
+#endif
@@ -0,0 +1,283 @@
+/*
+
+	Program name: Bob Jones Patriot Racing off screen frame buffer
+
+	Revision table
+	rev   author    date        description
+	1.0    Kris 	10/19/2026	initial creation, tiled dirty rectangles flushed in the background
+	1.1    Kris 	10/19/2026	TileSPIPort stages rows ahead of the DMA, windows are sent outside the interrupt
+	1.2    Kris 	10/19/2026	TileSPIPort only takes CS / DC while it sends, gives them back to the panel's
+	                            	hardware chip selects after
+
+*/
+
+#ifndef PATRIOT_RACING_TILEBUFFER_H
+#define PATRIOT_RACING_TILEBUFFER_H
+
+#ifdef ARDUINO
+ #include "Arduino.h"
+#else
+ #include <stdint.h>
+ #include <stddef.h>
+ #include <chrono>
+#endif
+#include <string.h>
+#include "PatriotRacing_Font.h"
+
+#define TILEBUFFER_VERSION 1.2
+
+/*
+
+the screens draw straight to the ILI9341 inside the UPDATE_LIMIT loop, every fillRect and print
+waits on SPI. a TileBuffer is an RGB565 copy of (part of) the screen in RAM, drawing into it is just
+memory writes, and each write marks the 16 x 16 tiles it touched. at the end of the frame Flush turns
+the dirty tiles into as few rectangles as it can (runs of tiles across a row, then rows with the same
+run stacked) and hands them to a port that sends them while the CPU goes back to sampling
+
+ports
+	TileDisplayPort    any ILI9341_t3 style display (writeRect), sends right away, for boards without DMA
+	TileSPIPort        Teensy, sends with SPI.transfer's DMA, one row after another from the
+	                   completion interrupt, Flush returns as soon as the first one is started
+
+if the port is still busy with the last frame, Flush leaves the tiles dirty and they go next time.
+drawing into a tile that is being sent can show up half drawn for one frame, but it is marked dirty
+again so the next flush fixes it
+
+memory budget: the buffer doesn't have to be the whole screen (320 x 240 x 2 = 150k is more than a
+Teensy 3.2 has). Begin takes the region it covers and the memory for it, so a RAM tight build can
+buffer just the data area and keep drawing the rest direct (Covers tells you which is which)
+
+GetStats has how long the CPU spent drawing into the buffer and setting up the flush for the last
+frame (BeginFrame / EndFrame), and what got sent
+
+*/
+
+#define TILE_W 16
+#define TILE_H 16
+#define TILEBUFFER_MAX_COLS 20            // 320 / TILE_W, one bit each in a uint32_t
+#define TILEBUFFER_MAX_ROWS 20            // 320 / TILE_H (portrait)
+#define TILEBUFFER_MAX_RECTS 32           // rectangles per flush, more than this get merged
+
+#if TILEBUFFER_MAX_COLS > 32
+ #error "dirty columns are one uint32_t per tile row"
+#endif
+
+struct TileRect {
+	int16_t X;                // screen coordinates
+	int16_t Y;
+	int16_t W;
+	int16_t H;
+	const uint16_t *Pixels;   // top left in the buffer
+	int16_t Stride;           // pixels from one row to the next in the buffer
+};
+
+struct TileStats {
+	uint32_t DrawMicros;      // BeginFrame to EndFrame, CPU drawing into the buffer
+	uint32_t FlushMicros;     // CPU time in Flush (the DMA itself is not counted)
+	uint16_t Tiles;           // dirty tiles flushed
+	uint8_t Rects;            // rectangles sent
+	uint32_t Pixels;          // pixels sent
+	uint32_t Deferred;        // flushes skipped because the port was busy (running total)
+};
+
+#ifdef ARDUINO
+static inline uint32_t TileMicros() {
+	return micros();
+}
+#else
+static inline uint32_t TileMicros() {
+	return (uint32_t) std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+class TileBuffer {
+
+public:
+
+	TileBuffer();
+
+	// Pixels must hold W x H, the region is in screen coordinates (tiles on the right and bottom edge can be partial)
+	bool Begin(uint16_t *Pixels, int16_t X, int16_t Y, int16_t W, int16_t H);
+
+	// true if the rectangle is entirely inside the buffered region
+	bool Covers(int16_t X, int16_t Y, int16_t W, int16_t H) const;
+
+	// the ILI9341_t3 calls the screens use, clipped to the region, screen coordinates
+	void fillScreen(uint16_t Color);
+	void fillRect(int16_t X, int16_t Y, int16_t W, int16_t H, uint16_t Color);
+	void drawPixel(int16_t X, int16_t Y, uint16_t Color);
+	void drawFastHLine(int16_t X, int16_t Y, int16_t W, uint16_t Color);
+	void drawFastVLine(int16_t X, int16_t Y, int16_t H, uint16_t Color);
+	void writeRect(int16_t X, int16_t Y, int16_t W, int16_t H, const uint16_t *Colors);
+
+	// for the font code, draw into the canvas then say what changed
+	FontCanvas Canvas();
+	void MarkDirty(int16_t X, int16_t Y, int16_t W, int16_t H);
+	void MarkAll();
+
+	// time the frame, EndFrame flushes through the port
+	void BeginFrame();
+	template <class Port>
+	bool EndFrame(Port &P);
+
+	// turns the dirty tiles into rectangles and starts the port on them, false if the port was busy
+	template <class Port>
+	bool Flush(Port &P);
+
+	const TileStats &GetStats() const;
+	uint16_t DirtyTiles() const;
+
+private:
+
+	uint8_t Coalesce(TileRect *Rect);
+	bool Clip(int16_t &X, int16_t &Y, int16_t &W, int16_t &H) const;
+
+	uint16_t *Pixels;
+	int16_t X;
+	int16_t Y;
+	int16_t W;
+	int16_t H;
+	uint8_t Cols;
+	uint8_t Rows;
+	uint32_t Dirty[TILEBUFFER_MAX_ROWS];
+
+	TileRect Rect[TILEBUFFER_MAX_RECTS];
+	TileStats Stats;
+	uint32_t FrameStart;
+
+};
+
+template <class Port>
+bool TileBuffer::Flush(Port &P) {
+
+	uint32_t start = TileMicros();
+	uint8_t count, i;
+
+	if (P.Busy()) {
+		Stats.Deferred++;
+		return false;
+	}
+
+	Stats.Tiles = DirtyTiles();
+	count = Coalesce(Rect);
+	Stats.Rects = count;
+	Stats.Pixels = 0;
+	for (i = 0; i < count; i++) {
+		Stats.Pixels += (uint32_t) Rect[i].W * Rect[i].H;
+	}
+	memset(Dirty, 0, sizeof(Dirty));
+
+	if (count) {
+		P.Send(Rect, count);
+	}
+
+	Stats.FlushMicros = TileMicros() - start;
+	return true;
+}
+
+template <class Port>
+bool TileBuffer::EndFrame(Port &P) {
+
+	Stats.DrawMicros = TileMicros() - FrameStart;
+	return Flush(P);
+}
+
+// sends right away through any display with writeRect, row by row when the rectangle isn't contiguous
+template <class Display>
+class TileDisplayPort {
+
+public:
+
+	TileDisplayPort(Display &D) : D(D) {
+	}
+
+	bool Busy() const {
+		return false;
+	}
+
+	void Send(const TileRect *Rect, uint8_t Count) {
+
+		uint8_t i;
+		int16_t row;
+
+		for (i = 0; i < Count; i++) {
+			if (Rect[i].Stride == Rect[i].W) {
+				D.writeRect(Rect[i].X, Rect[i].Y, Rect[i].W, Rect[i].H, Rect[i].Pixels);
+				continue;
+			}
+			for (row = 0; row < Rect[i].H; row++) {
+				D.writeRect(Rect[i].X, Rect[i].Y + row, Rect[i].W, 1, Rect[i].Pixels + (int32_t) row * Rect[i].Stride);
+			}
+		}
+	}
+
+private:
+
+	Display &D;
+
+};
+
+#if defined(TEENSYDUINO)
+
+#include <SPI.h>
+#include <EventResponder.h>
+
+/*
+	sends the rectangles with the SPI library's DMA transfers. the panel wants big endian pixels and
+	one window (CASET / PASET / RAMWR) per rectangle, so each row is byte swapped into one of two
+	staging rows. a row is always staged before the transfer in front of it starts, the completion
+	interrupt starts the row that's ready and only then stages the one after into the buffer that
+	just finished, so the DMA never sends a half staged row
+
+	the window is command bytes with DC toggled in between, plain blocking transfers that don't
+	belong in an interrupt, so the end of a rectangle triggers a deferred event instead and the next
+	window goes out from yield() (after loop(), in delay()). a frame with many rectangles takes as
+	many trips through yield(). the rectangles are copied so the buffer's list can be reused
+
+	sharing the bus with the panel object: ILI9341_t3 drives CS and DC as the SPI module's hardware
+	chip selects (PCS, both on a Teensy 3.x, DC on a Teensy 4 where CS is a plain pin), the DMA
+	transfers here can't, so Send turns them into plain outputs for the frame and the end of the
+	frame hands them back to the SPI module the way ILI9341_t3's begin() set them up (setCS). that's
+	the only way the two share the bus: the port owns it until Busy() goes false, no direct draws
+	to the panel before then, and CS / DC have to be the same pins the panel object was given
+*/
+class TileSPIPort {
+
+public:
+
+	TileSPIPort(SPIClass &Port, uint8_t CS, uint8_t DC, uint32_t Speed);
+
+	void Begin();
+	bool Busy() const;
+	void Send(const TileRect *Rect, uint8_t Count);
+
+private:
+
+	static void RowDone(EventResponderRef Event);
+	static void RectDone(EventResponderRef Event);
+	void StartRect();
+	void TakePins();
+	void GivePins();
+	void Window(const TileRect &R);
+	void Stage(uint8_t Which, const TileRect &R, int16_t Row);
+
+	SPIClass &SPIPort;
+	uint8_t CS;
+	uint8_t DC;
+	SPISettings Settings;
+	EventResponder Event;				// DMA done, from the interrupt
+	EventResponder Between;				// rectangle done, deferred to yield()
+
+	TileRect Rect[TILEBUFFER_MAX_RECTS];
+	uint8_t Count;
+	volatile uint8_t Current;			// rectangle being sent
+	volatile int16_t Row;				// row of it being sent
+	volatile bool Sending;
+	uint16_t Staging[2][TILEBUFFER_MAX_COLS * TILE_W];
+	volatile uint8_t Which;				// staging row being sent
+
+};
+
+#endif
+
+#endif